@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -12,85 +12,359 @@
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
+// * To start reading a block that will be needed soon without
+//     waiting for it, call breada.  To write a buffer without
+//     waiting, call bawrite instead of bwrite and brelse.
 //
 // The implementation uses two state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_ASYNC: a read or write nobody waits for is in flight; the
+//     disk interrupt releases the buffer when it is done.
+//
+// NBUF buffers are always there.  While free memory lasts, a miss
+// adds a kalloc() page of buffers instead of recycling one, up to
+// NBUFPAGE pages; when memory runs short those pages are given
+// back (see bshrink).  There are enough buckets for about four
+// buffers each once the cache is fully grown.
+//
+// A buffer holding a block sits in the bucket its (dev, blockno)
+// hashes to, on that bucket's LRU list, and its refcnt is
+// protected by that bucket's lock.  Buffers holding no block
+// (dev == NODEV) are on the free list instead, under
+// bcache.freelock, which nests inside bucket locks.  Lookups and
+// most misses only take one bucket lock.  Growing, shrinking and
+// taking a buffer from another bucket take bcache.lock first, so
+// only one CPU ever holds two bucket locks at a time.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "semaphore.h"
 #include "buf.h"
 
-struct {
+#define BUFPERPAGE (PGSIZE / sizeof(struct buf))
+#define NBUCKET ((NBUF + NBUFPAGE*BUFPERPAGE) / 4 | 1)
+#define BHASH(dev, blockno) (((dev) * 31 + (blockno)) % NBUCKET)
+#define NODEV ((uint)-1)
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  // Linked list of the bucket's buffers, through prev/next.
+  // head is most recently used.
+  struct buf *head;
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct spinlock lock; // serializes stealing and resizing
+  struct spinlock freelock;
+  struct buf *free;     // buffers holding no block
+  struct buf buf[NBUF];
+  struct bucket bucket[NBUCKET];
+  struct buf *page[NBUFPAGE]; // pages of extra buffers
+  int npage;
+  int hand;             // next bucket to steal from
 } bcache;
 
+// Put b at the front of list *head.
+// Caller must hold the list's lock.
+static void
+bpush(struct buf **head, struct buf *b)
+{
+  b->prev = 0;
+  b->next = *head;
+  if(*head)
+    (*head)->prev = b;
+  *head = b;
+}
+
+static void
+bunlink(struct buf **head, struct buf *b)
+{
+  if(b->prev)
+    b->prev->next = b->next;
+  else
+    *head = b->next;
+  if(b->next)
+    b->next->prev = b->prev;
+}
+
+// The list b is on and the lock protecting it, going by the
+// block b holds.
+static struct buf**
+blist(struct buf *b)
+{
+  if(b->dev == NODEV)
+    return &bcache.free;
+  return &bcache.bucket[BHASH(b->dev, b->blockno)].head;
+}
+
+static struct spinlock*
+blistlock(struct buf *b)
+{
+  if(b->dev == NODEV)
+    return &bcache.freelock;
+  return &bcache.bucket[BHASH(b->dev, b->blockno)].lock;
+}
+
+// Add b, which holds no block, to the free list.
+static void
+bfreelist(struct buf *b)
+{
+  acquire(&bcache.freelock);
+  b->dev = NODEV;
+  b->blockno = 0;
+  b->flags = 0;
+  b->refcnt = 0;
+  bpush(&bcache.free, b);
+  release(&bcache.freelock);
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.freelock, "bcache.free");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache.bucket");
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    bfreelist(b);
   }
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Look for the block in bucket bk and take a reference on it.
+// Caller must hold bk->lock.
 static struct buf*
-bget(uint dev, uint blockno)
+bfind(struct bucket *bk, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bk->head; b; b = b->next){
     if(b->dev == dev && b->blockno == blockno){
       b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
       return b;
     }
   }
+  return 0;
+}
+
+// Least recently used buffer in bucket bk that can be recycled.
+// Even if when refcnt==0, B_DIRTY indicates a buffer is in use
+// because log.c has modified it but not yet committed it.
+// Caller must hold bk->lock.
+static struct buf*
+bvictim(struct bucket *bk)
+{
+  struct buf *b, *v;
+
+  v = 0;
+  for(b = bk->head; b; b = b->next)
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+      v = b;
+  return v;
+}
+
+// Add a kalloc() page of free buffers to the cache.
+// Returns 0 if there is no memory to spare.
+// Caller must hold bcache.lock.
+static int
+bgrow(void)
+{
+  struct buf *b, *pg;
+
+  if(bcache.npage == NBUFPAGE || kfreepages() <= BUFMINFREE)
+    return 0;
+  if((pg = (struct buf*)kalloc()) == 0)
+    return 0;
+  for(b = pg; b < pg+BUFPERPAGE; b++){
+    initsleeplock(&b->lock, "buffer");
+    bfreelist(b);
+  }
+  bcache.page[bcache.npage++] = pg;
+  return 1;
+}
+
+// Give one page of buffers back to kalloc() if all of its buffers
+// are free and clean.  Returns 1 if it did.
+// Caller must hold bcache.lock.
+static int
+bshrink1(void)
+{
+  struct buf *b, *pg;
+  struct spinlock *lk;
+  uint dev, blockno;
+  int i;
+
+  for(i = bcache.npage-1; i >= 0; i--){
+    pg = bcache.page[i];
+    // Unlink the page's buffers one at a time; once unlinked
+    // no lookup can find them.  Put them back if one is busy.
+    for(b = pg; b < pg+BUFPERPAGE; b++){
+      // Only a buffer coming off the free list can change
+      // lists without bcache.lock, so check it stayed put.
+      for(;;){
+        dev = b->dev;
+        blockno = b->blockno;
+        lk = blistlock(b);
+        acquire(lk);
+        if(b->dev == dev && b->blockno == blockno)
+          break;
+        release(lk);
+      }
+      if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+        release(lk);
+        break;
+      }
+      bunlink(blist(b), b);
+      release(lk);
+    }
+    if(b == pg+BUFPERPAGE){
+      bcache.page[i] = bcache.page[--bcache.npage];
+      kfree((char*)pg);
+      return 1;
+    }
+    while(b-- > pg){
+      lk = blistlock(b);
+      acquire(lk);
+      bpush(blist(b), b);
+      release(lk);
+    }
+  }
+  return 0;
+}
 
-  // Not cached; recycle an unused buffer.
-  // Even if when refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+// Called by kalloc() when it has run out of pages.
+// Returns 1 if a page of buffers was freed.
+int
+bshrink(void)
+{
+  int r;
+
+  if(holding(&bcache.lock)) // kalloc() from bgrow()
+    return 0;
+  acquire(&bcache.lock);
+  r = bshrink1();
+  release(&bcache.lock);
+  return r;
+}
+
+// Should a miss grow or shrink the cache rather than recycle a
+// buffer?  Unlocked, so only a hint.
+static int
+bresize(void)
+{
+  if(kfreepages() < BUFMINFREE)
+    return bcache.npage > 0;
+  return bcache.free == 0 && bcache.npage < NBUFPAGE;
+}
+
+// Put a buffer for block (dev, blockno), which is not cached, in
+// bucket bk and take a reference on it.  It comes off the free
+// list, else it is the least recently used unused buffer in bk,
+// else, if steal is set, in some other bucket.  Its new identity
+// is set before the lock of the list it came from is released.
+// Returns 0 if there is none.
+// Caller must hold bk->lock, and bcache.lock if steal is set.
+static struct buf*
+bnew(struct bucket *bk, uint dev, uint blockno, int steal)
+{
+  struct buf *b;
+  struct bucket *o;
+  int i;
+
+  acquire(&bcache.freelock);
+  if((b = bcache.free) != 0){
+    bunlink(&bcache.free, b);
+    b->dev = dev;
+    b->blockno = blockno;
+  }
+  release(&bcache.freelock);
+  if(b == 0 && (b = bvictim(bk)) != 0)
+    bunlink(&bk->head, b);
+  for(i = 0; b == 0 && steal && i < NBUCKET; i++){
+    o = &bcache.bucket[bcache.hand];
+    bcache.hand = (bcache.hand + 1) % NBUCKET;
+    if(o == bk)
+      continue;
+    acquire(&o->lock);
+    if((b = bvictim(o)) != 0){
+      bunlink(&o->head, b);
       b->dev = dev;
       b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
     }
+    release(&o->lock);
+  }
+  if(b == 0){
+    if(steal)
+      panic("bget: no buffers");
+    return 0;
+  }
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = 1;
+  bpush(&bk->head, b);
+  return b;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+// If ahead is set, return 0 instead when the block is cached.
+static struct buf*
+bget(uint dev, uint blockno, int ahead)
+{
+  struct buf *b;
+  struct bucket *bk;
+  int hit;
+
+  bk = &bcache.bucket[BHASH(dev, blockno)];
+  acquire(&bk->lock);
+
+  // Is the block already cached?  If not, take a free buffer or
+  // recycle one from this bucket, unless the cache should grow
+  // or shrink first.
+  hit = (b = bfind(bk, dev, blockno)) != 0;
+  if(!hit && !bresize())
+    b = bnew(bk, dev, blockno, 0);
+  release(&bk->lock);
+
+  if(b == 0){
+    // Resize the cache, or failing that take a buffer from
+    // another bucket.  Check again once holding the locks, as
+    // another CPU may have read the block in meanwhile.
+    acquire(&bcache.lock);
+    if(kfreepages() < BUFMINFREE)
+      bshrink1();
+    else
+      bgrow();
+    acquire(&bk->lock);
+    hit = (b = bfind(bk, dev, blockno)) != 0;
+    if(!hit)
+      b = bnew(bk, dev, blockno, 1);
+    release(&bk->lock);
+    release(&bcache.lock);
+  }
+
+  if(hit && ahead){
+    acquire(&bk->lock);
+    b->refcnt--;
+    release(&bk->lock);
+    return 0;
   }
-  panic("bget: no buffers");
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -99,7 +373,7 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
     if(b->dev<2){
       iderw(b);
@@ -110,6 +384,24 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Start reading the indicated block into the cache, unless it is
+// there already, and return without waiting for the disk.
+void
+breada(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  // A fresh buffer: nobody else can be holding it.
+  b->flags |= B_ASYNC;
+  if(b->dev<2){
+    iderw(b);
+  } else if(b->dev<4){
+    ide2rw(b);
+  }
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -124,29 +416,59 @@ bwrite(struct buf *b)
   }
 }
 
-// Release a locked buffer.
-// Move to the head of the MRU list.
+// Start writing b to disk and release it once written, without
+// waiting.  Must be locked; the caller may not use b afterwards.
 void
-brelse(struct buf *b)
+bawrite(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
-    panic("brelse");
+    panic("bawrite");
+  b->flags |= B_DIRTY|B_ASYNC;
+  if(b->dev<2){
+    iderw(b);
+  } else if(b->dev<4){
+    ide2rw(b);
+  }
+}
+
+// Drop a reference to b and unlock it.
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  // b can't change buckets while we hold a reference.
+  bk = &bcache.bucket[BHASH(b->dev, b->blockno)];
+  acquire(&bk->lock);
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    bunlink(&bk->head, b);
+    bpush(&bk->head, b);
   }
   
-  release(&bcache.lock);
+  release(&bk->lock);
+}
+
+// Release a locked buffer.
+// Move to the head of its bucket's MRU list.
+void
+brelse(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("brelse");
+  bput(b);
+}
+
+// Release a buffer whose B_ASYNC read or write has completed.  Called by
+// the disk drivers, on behalf of the process that started it.
+void
+bdone(struct buf *b)
+{
+  b->flags &= ~B_ASYNC;
+  bput(b);
 }
 //PAGEBREAK!
 // Blank page.
@@ -7,9 +7,11 @@ struct buf {
   struct buf *prev; // LRU cache list
   struct buf *next;
   struct buf *qnext; // disk queue
+  uint qtick; // ticks when it joined the disk queue
   uchar data[BSIZE];
   struct semaphore sem;
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // nobody waits; released by the disk interrupt
 
@@ -11,13 +11,21 @@ struct stat;
 struct superblock;
 struct semaphore;
 struct ptimes;
+struct schedparam;
+struct memstat;
+struct iostat;
+struct trapframe;
 struct pte_t;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+void            breada(uint, uint);
+void            bdone(struct buf*);
 void            brelse(struct buf*);
+int             bshrink(void);
 void            bwrite(struct buf*);
+void            bawrite(struct buf*);
 
 // console.c
 void            consoleinit(void);
@@ -46,6 +54,7 @@ struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
+void            itext(struct inode*, int);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
@@ -60,11 +69,13 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            idestat(struct iostat*);
 
 // ide2.c
 void            ide2init(void);
 void            ide2intr(void);
 void            ide2rw(struct buf*);
+void            ide2stat(struct iostat*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -73,11 +84,16 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kalloc_zeroed(void);
+int             kzerofill(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
-void            chgpgrefc(void *va, uint dif);
-uchar           getpgrefc(void *va);
+int             kallocpages(void);
+int             kfreepages(void);
+void            kmemstat(struct memstat*);
+uint            chgpgrefc(void *va, int dif);
+uint            getpgrefc(void *va);
 
 // kbd.c
 void            kbdintr(void);
@@ -91,6 +107,7 @@ void            cmostime(struct rtcdate *r);
 int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
+void            lapicipi(uchar, int);
 void            lapicinit(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
@@ -105,6 +122,12 @@ void            end_op();
 extern int      ismp;
 void            mpinit(void);
 
+// pagecache.c
+void            pcacheinit(void);
+char*           pcacheget(struct inode*, uint);
+void            pcacheinval(struct inode*);
+int             pcacheheld(char*);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -117,9 +140,7 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
-#define         POLICY 0 // Policies - 0:RR; 1:SPN; 2:SRT; 3:HRRN
-extern uint      loadavg;
-extern int      runnables;
+#define         POLICY 0 // Boot policy - 0:RR; 1:SPN; 2:SRT; 3:HRRN; 4:MLFQ (see sched.h)
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
@@ -131,11 +152,19 @@ void            pinit(void);
 void            procdump(void);
 void            idle(void) __attribute__((noreturn));
 void            reschedule(void);
+void            balance(void);
+void            schedtick(void);
+int             schedctl(struct schedparam*);
+int             nswtch(void);
+void            getloadavg(int*);
+int             memstat(int, struct memstat*);
+pde_t*          setpgdir(pde_t*, uint);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(struct ptimes *);
 void            wakeup(void*);
+void            wakeup_one(void*);
 void            yield(void);
 void            kfork(void (*func)(void));
 void            kfortret(void);
@@ -173,6 +202,7 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argout(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
@@ -208,7 +238,8 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
-void            pgfaultintr();
+int             pgfaultintr(struct trapframe*);
+int             pagein(uint, uint, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
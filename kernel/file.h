@@ -14,6 +14,7 @@ struct inode {
   uint dev;               // Device number
   uint inum;              // Inode number
   int ref;                // Reference count
+  int nexec;              // Processes running it; no writes while > 0
   struct sleeplock lock;  // protects everything below here
   int valid;              // inode has been read from disk?
   // Hold copy of disk inode (xv6 is smooth cast)
@@ -23,6 +24,9 @@ struct inode {
   short nlink;            // Uv5: [char] i_nlink
   uint size;              // Uv5: [char] i_size_0<<16 | [char*] i_size1
   uint addrs[NDIRECT+1];  // xv6: 7(d)+1(id); Uv5: S8(d), L8(id)
+  uint lastr;             // Uv5: i_lastr, last block read (for read-ahead)
+  uint rahead;            // next block to read ahead, if past lastr
+  int pcached;            // may have pages in the page cache
 };
 
 // table mapping major device number to
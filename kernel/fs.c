@@ -305,7 +305,11 @@ iget(uint dev, uint inum) // just gives a free designated spot for inode
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
+  ip->nexec = 0;
   ip->valid = 0;
+  ip->lastr = -1; // so reading block 0 first counts as sequential
+  ip->rahead = 0;
+  ip->pcached = 1; // pages from before it was recycled may remain
   release(&icache.lock);
 
   return ip;
@@ -322,6 +326,19 @@ idup(struct inode *ip)
   return ip;
 }
 
+// Add n to the number of processes running ip (proc->exe).
+// They page it in on demand, so writei refuses to change it
+// while there are any.  Caller holds a reference to ip.
+void
+itext(struct inode *ip, int n)
+{
+  acquire(&icache.lock);
+  ip->nexec += n;
+  if(ip->nexec < 0)
+    panic("itext");
+  release(&icache.lock);
+}
+
 // Lock the given inode.
 // Reads the inode from disk if necessary.
 void
@@ -465,6 +482,25 @@ bmap(struct inode *ip, uint bn)
   panic("bmap: out of range");
 }
 
+// Like bmap, but return 0 instead of allocating a block that
+// isn't there; for read-ahead, which runs outside any transaction.
+static uint
+bmapped(struct inode *ip, uint bn)
+{
+  uint addr;
+  struct buf *bp;
+
+  if(bn < NDIRECT)
+    return ip->addrs[bn];
+  bn -= NDIRECT;
+  if(bn >= NINDIRECT || (addr = ip->addrs[NDIRECT]) == 0)
+    return 0;
+  bp = bread(ip->dev, addr);
+  addr = ((uint*)bp->data)[bn];
+  brelse(bp);
+  return addr;
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
@@ -477,6 +513,9 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  if(ip->nexec > 0)
+    panic("itrunc: running executable");
+  pcacheinval(ip);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -520,7 +559,7 @@ stati(struct inode *ip, struct stat *st)
 // Otherwise we request buffer from disk
 int
 readi(struct inode *ip, char *dst, uint off, uint n){
-  uint tot, m;
+  uint tot, m, lbn, addr;
   struct buf *bp;
 // cprintf("readi proc_pid %d dev:%d inode:%d\n", getppid(0), ip->dev, ip->inum); // what inode are reading from?
   if(ip->type == T_DEV){ // check if we're reading from external device, else file system
@@ -552,7 +591,20 @@ readi(struct inode *ip, char *dst, uint off, uint n){
     }
   }else{
     for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-      bp = bread(ip->dev, bmap(ip, off/BSIZE)); // take offset from beginning of file to see what blocks we need to read
+      lbn = off/BSIZE;
+      bp = bread(ip->dev, bmap(ip, lbn)); // take offset from beginning of file to see what blocks we need to read
+      // Reading the file in order (Uv5 i_lastr): keep the disk
+      // NREADAHEAD blocks ahead while we copy this one out, asking
+      // only for the blocks not asked for yet.
+      if(lbn == ip->lastr+1){
+        if(ip->rahead <= lbn)
+          ip->rahead = lbn+1;
+        for(; ip->rahead <= lbn+NREADAHEAD && ip->rahead*BSIZE < ip->size; ip->rahead++)
+          if((addr = bmapped(ip, ip->rahead)) != 0)
+            breada(ip->dev, addr);
+      } else if(lbn != ip->lastr)
+        ip->rahead = 0;
+      ip->lastr = lbn;
       m = min(n - tot, BSIZE - off%BSIZE);
       memmove(dst, bp->data + off%BSIZE, m); // copy out read operation from buffer cache object to destination buffer ==> read from disk to buffer object
       brelse(bp);
@@ -580,6 +632,9 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->nexec > 0) // text busy: running processes page it in
+    return -1;
+  pcacheinval(ip); // cached text is stale now
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
@@ -13,6 +13,7 @@
 #include "semaphore.h"
 #include "buf.h"
 #include "proc.h"
+#include "iostat.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -24,15 +25,31 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+
+#define IDE_MULT      16  // sectors per interrupt asked of READ/WRITE MULTIPLE
+#define IDE_MAXSECT  256  // most sectors one command transfers
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The command in progress covers the first idenbuf bufs on the
+// queue, for consecutive blocks; idendone of its idensect
+// sectors have been transferred so far.  The rest of the queue
+// is in C-SCAN order: up from the block after idepos, where that
+// command ends, then round from the lowest block.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenbuf;
+static int idensect;
+static int idendone;
+static uint idepos;
+static uint idecmdtick;  // ticks when the command in progress started
+static struct iostat idestats;
 
 static int havedisk1;
+static int idemult[2];  // sectors per interrupt for each disk
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
@@ -48,6 +65,18 @@ idewait(int checkerr)
   return 0;
 }
 
+// Have the disk transfer IDE_MULT sectors per interrupt,
+// or one if it can't.
+static void
+idesetmult(int disk)
+{
+  idewait(0);
+  outb(0x1f2, IDE_MULT);
+  outb(0x1f6, 0xe0 | (disk<<4));
+  outb(0x1f7, IDE_CMD_SETMUL);
+  idemult[disk] = (idewait(1) < 0) ? 1 : IDE_MULT;
+}
+
 void
 ideinit(void)
 {
@@ -66,35 +95,93 @@ ideinit(void)
     }
   }
 
-  // Switch back to disk 0.
-  outb(0x1f6, 0xe0 | (0<<4));
+  if(havedisk1)
+    idesetmult(1);
+  idesetmult(0);  // also switches back to disk 0
+}
+
+// Position of b on the channel: its disk, then its block.
+static uint
+idekey(struct buf *b)
+{
+  return ((b->dev&1) << 24) | b->blockno;
+}
+
+// How far the disk has to go from idepos to reach b, serving
+// higher blocks first and then wrapping around.
+static uint
+idedist(struct buf *b)
+{
+  return idekey(b) - idepos - 1;
+}
+
+// Move the next idemult sectors of the command in progress
+// between the disk and its bufs.  Caller must hold idelock.
+static void
+idexfer(void)
+{
+  int sector_per_block = BSIZE/SECTOR_SIZE;
+  struct buf *b;
+  uchar *p;
+  int i;
+
+  b = idequeue;
+  for(i = idendone/sector_per_block; i > 0; i--)
+    b = b->qnext;
+  for(i = idemult[b->dev&1]; i > 0 && idendone < idensect; i--){
+    p = b->data + (idendone%sector_per_block)*SECTOR_SIZE;
+    if(b->flags & B_DIRTY)
+      outsl(0x1f0, p, SECTOR_SIZE/4);
+    else
+      insl(0x1f0, p, SECTOR_SIZE/4);
+    if(++idendone % sector_per_block == 0)
+      b = b->qnext;
+  }
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b, merged with the bufs queued right
+// behind it for the blocks right after it, in one command of up
+// to IDE_MAXSECT sectors.  Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *n;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int read_cmd = (idemult[b->dev&1] == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (idemult[b->dev&1] == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   if (sector_per_block > 7) panic("idestart");
 
+  idenbuf = 1;
+  for(n = b; n->qnext != 0 && (idenbuf+1)*sector_per_block <= IDE_MAXSECT; n = n->qnext){
+    if(n->qnext->dev != b->dev || n->qnext->blockno != n->blockno+1 ||
+       ((n->qnext->flags ^ b->flags) & B_DIRTY) != 0)
+      break;
+    idenbuf++;
+  }
+  if(n->blockno >= FSSIZE)
+    panic("incorrect blockno");
+  idensect = idenbuf*sector_per_block;
+  idendone = 0;
+  idepos = idekey(n);
+  idecmdtick = ticks;
+  idestats.ncmd++;
+  idestats.nsect += idensect;
+
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, idensect & 0xff);  // number of sectors, 0 means 256
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
   if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    idexfer();
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -106,24 +193,42 @@ ideintr(void)
 {
   struct buf *b;
 
-  // First queued buffer is the active request.
+  // First queued buffers are the active request.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if(idequeue == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(idewait(1) < 0)
+    idendone = idensect;  // error; give up on the rest
+  else if(idendone < idensect){
+    // Read the sectors the disk has ready, or write the next
+    // ones it asks for; a write ends with one more interrupt.
+    idexfer();
+    if(idendone < idensect || (idequeue->flags & B_DIRTY)){
+      release(&idelock);
+      return;
+    }
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  // wakeup(b); CHANGES HERE
-  sem_V(&b->sem);
+  // Wake processes waiting for these bufs.
+  idestats.service += ticks - idecmdtick;
+  for(; idenbuf > 0; idenbuf--){
+    b = idequeue;
+    idequeue = b->qnext;
+    idestats.depth--;
+    idestats.nreq++;
+    idestats.wait += ticks - b->qtick;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    // wakeup(b); CHANGES HERE
+    if(b->flags & B_ASYNC)
+      bdone(b);  // nobody is waiting
+    else
+      sem_V(&b->sem);
+  }
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
@@ -140,6 +245,7 @@ void
 iderw(struct buf *b)
 {
   struct buf **pp;
+  int async, i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -148,15 +254,24 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
+  // Once queued, an async b may be done and reused any time.
+  async = b->flags & B_ASYNC;
   sem_init(&b->sem, 0);
   
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  // Insert b into idequeue behind the command in progress, in
+  // C-SCAN order, where idestart will merge it with its neighbours.
+  b->qtick = ticks;
+  pp = &idequeue;
+  for(i = 0; i < idenbuf; i++)
+    pp = &(*pp)->qnext;
+  for(; *pp && idedist(*pp) < idedist(b); pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+  if(++idestats.depth > idestats.maxdepth)
+    idestats.maxdepth = idestats.depth;
 
   // Start disk if necessary.
   if(idequeue == b)
@@ -170,5 +285,18 @@ iderw(struct buf *b)
 
   // release(&idelock); CHANGES HERE
   release(&idelock);
-  sem_P(&b->sem);
+  if(!async)
+    sem_P(&b->sem);
+}
+
+// Copy out the statistics of this channel's queue.
+void
+idestat(struct iostat *st)
+{
+  struct iostat s;
+
+  acquire(&idelock);
+  s = idestats;
+  release(&idelock);
+  *st = s;
 }
@@ -0,0 +1,14 @@
+// Disk request queue statistics returned by iostat().
+// Both the kernel and user programs use this header file.
+// Each IDE channel has one queue: disks 0 and 1 share one,
+// disks 2 and 3 the other.  Times are in timer ticks.
+
+struct iostat {
+  uint depth;     // bufs queued now, including the command in progress
+  uint maxdepth;  // most bufs ever queued at once
+  uint nreq;      // bufs read or written
+  uint ncmd;      // disk commands issued for them
+  uint nsect;     // sectors transferred by those commands
+  uint wait;      // total ticks from queueing a buf until it was done
+  uint service;   // total ticks from starting a command until it was done
+};
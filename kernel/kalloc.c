@@ -4,10 +4,12 @@
 
 #include "types.h"
 #include "defs.h"
+#include "x86.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "memstat.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -17,17 +19,40 @@ struct run {
   struct run *next;
 };
 
+// Per-CPU cache of free pages.  Only its own cpu touches it, with
+// interrupts off, so it needs no lock.  It refills from and drains
+// to the global list KBATCH pages at a time and holds at most
+// 2*KBATCH, which bounds what can be stranded on other CPUs.
+struct kcache {
+  struct run *freelist;
+  int nfree;    // Pages on freelist
+  int nalloc;   // kalloc()s minus kfree()s on this cpu
+};
+
 struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;    // Pages on freelist
+  int npages;   // Pages given to the allocator at boot
+  struct kcache cache[NCPU];
 } kmem;
 
+// Pool of pages zeroed ahead of time by idle CPUs (see kzerofill).
+// Pool pages already count as allocated.
+struct {
+  struct spinlock lock;
+  struct run *list;
+  int n;
+} kzero;
+
+static void kdrain(struct kcache *kc);
+static char *kzeropop(void);
+
 // There exists max (PHYSTOP)>>12 PPNs to use, indexed by PPN
-unsigned char pgrefcounter[PHYSTOP>>12]; // Refcnt for Pt entry
-struct spinlock pgreflock; // Lock pgrefcounter
+// Updated with atomic instructions only, no lock
+volatile uint pgrefcounter[PHYSTOP>>12]; // Refcnt for Pt entry
 uint allocpages; // Total number of tracked Pt entries
-int kallocpages; // Total number of Pages alloced
 
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
@@ -38,7 +63,7 @@ void
 kinit1(void *vstart, void *vend)
 {
   initlock(&kmem.lock, "kmem");
-  initlock(&pgreflock, "Pgref");
+  initlock(&kzero.lock, "kzero");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -50,13 +75,26 @@ kinit2(void *vstart, void *vend)
   kmem.use_lock = 1;
 }
 
+// Put every page in [vstart, vend) on the free list.  Boot-time
+// only (kmem.use_lock is off), so the pages are linked straight
+// onto the global list instead of going through kfree() one by one,
+// and never poisoned: nothing can hold a dangling ref to them yet.
 void
 freerange(void *vstart, void *vend)
 {
   char *p;
+  struct run *r;
+
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
-    kfree(p);
+  if(p < end || V2P(vend) > PHYSTOP)
+    panic("freerange");
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    r = (struct run*)p;
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+    kmem.npages++;
+  }
 }
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by virt. addr,
@@ -67,23 +105,93 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct kcache *kc;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+#ifdef KDEBUG
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock){
-    acquire(&kmem.lock);
-  }
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock){
-    kallocpages--;
-    release(&kmem.lock);
+  if(!kmem.use_lock){
+    // Still booting on one cpu, straight onto the global list
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+    return;
+  }
+  pushcli();
+  kc = &kmem.cache[cpuid()];
+  r->next = kc->freelist;
+  kc->freelist = r;
+  kc->nfree++;
+  kc->nalloc--;
+  if(kc->nfree >= 2*KBATCH)
+    kdrain(kc);
+  popcli();
+}
+
+// Move KBATCH pages from a cpu's cache to the global free list.
+static void
+kdrain(struct kcache *kc)
+{
+  struct run *first, *last;
+  int n;
+
+  first = last = kc->freelist;
+  for(n = 1; n < KBATCH; n++)
+    last = last->next;
+  kc->freelist = last->next;
+  kc->nfree -= KBATCH;
+  acquire(&kmem.lock);
+  last->next = kmem.freelist;
+  kmem.freelist = first;
+  kmem.nfree += KBATCH;
+  release(&kmem.lock);
+}
+
+// Move up to KBATCH pages from the global free list to a cpu's
+// cache.
+static void
+krefill(struct kcache *kc)
+{
+  struct run *r;
+
+  acquire(&kmem.lock);
+  while(kc->nfree < KBATCH && (r = kmem.freelist) != 0){
+    // Freelist is from highest virt. addr to lowest virt.addr
+    // Within run *r points to next left free addr of r addr
+    kmem.freelist = r->next;
+    kmem.nfree--;
+    r->next = kc->freelist;
+    kc->freelist = r;
+    kc->nfree++;
+  }
+  release(&kmem.lock);
+}
+
+// Take a page from this cpu's cache, refilling it from the
+// global free list when empty.  Returns 0 if both are empty.
+static char*
+kalloc1(void)
+{
+  struct run *r;
+  struct kcache *kc;
+
+  pushcli();
+  kc = &kmem.cache[cpuid()];
+  if(kc->freelist == 0)
+    krefill(kc);
+  if((r = kc->freelist) != 0){
+    kc->freelist = r->next;
+    kc->nfree--;
+    kc->nalloc++;
   }
+  popcli();
+  return (char*)r;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -94,45 +202,143 @@ char*
 kalloc(void)
 {
   struct run *r;
+  char *v;
 
-  if(kmem.use_lock){
-    acquire(&kmem.lock);
-  }
-  r = kmem.freelist;
-  if(r){
-    // Freelist is from highest virt. addr to lowest virt.addr
-    // Within run *r points to next left free addr of r addr
-    kmem.freelist = r->next;
+  if(!kmem.use_lock){
+    if((r = kmem.freelist) != 0){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+    }
+    return (char*)r;
   }
-  if(kmem.use_lock){
-    kallocpages++;
-    release(&kmem.lock);
+  if((v = kalloc1()) != 0)
+    return v;
+  // Out of free pages: take one back from the buffer cache,
+  // else the zero pool may have some.
+  if(bshrink() && (v = kalloc1()) != 0)
+    return v;
+  return kzeropop();
+}
+
+static char*
+kzeropop(void)
+{
+  struct run *r;
+
+  acquire(&kzero.lock);
+  if((r = kzero.list) != 0){
+    kzero.list = r->next;
+    kzero.n--;
   }
+  release(&kzero.lock);
   return (char*)r;
 }
 
-void chgpgrefc(void *va, uint dif){
+// Allocate one page of physical memory filled with zeros, from the
+// pre-zeroed pool when it has one so the caller skips the memset.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc_zeroed(void)
+{
+  char *v;
+
+  if(kmem.use_lock && (v = kzeropop()) != 0){
+    *(struct run**)v = 0; // clear the list link
+    return v;
+  }
+  if((v = kalloc()) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero one more page for the kalloc_zeroed() pool if it is not
+// full.  Called by idle CPUs with nothing to run; returns 1 if it
+// added a page, 0 if the pool is full or fewer than ZEROMINFREE
+// pages are free.  Only takes pages off the free lists.
+int
+kzerofill(void)
+{
+  struct run *r;
+
+  if(!kmem.use_lock || kzero.n >= NZEROPAGES) // racy peek, fine
+    return 0;
+  if(kfreepages() < ZEROMINFREE)
+    return 0;
+  if((r = (struct run*)kalloc1()) == 0)
+    return 0;
+  memset(r, 0, PGSIZE);
+  acquire(&kzero.lock);
+  r->next = kzero.list;
+  kzero.list = r;
+  kzero.n++;
+  release(&kzero.lock);
+  return 1;
+}
+
+// Total number of pages alloced since kinit2(), summed from the
+// per-cpu counts.  Only a snapshot while other CPUs allocate.
+int
+kallocpages(void)
+{
+  int i, n;
+
+  n = 0;
+  for(i = 0; i < NCPU; i++)
+    n += kmem.cache[i].nalloc;
+  return n;
+}
+
+// Number of pages on the free lists.  Summed without locks, so
+// only a snapshot while other CPUs allocate.
+int
+kfreepages(void)
+{
+  int i, n;
+
+  n = kmem.nfree;
+  for(i = 0; i < NCPU; i++)
+    n += kmem.cache[i].nfree;
+  return n;
+}
+
+// Fill in the system-wide page counts of ms from the free lists
+// and the coremap.  A snapshot: other CPUs keep allocating.
+void
+kmemstat(struct memstat *ms)
+{
+  int i;
+
+  ms->total = kmem.npages;
+  ms->free = kfreepages();
+  ms->used = ms->total - ms->free;
+  ms->shared = 0;
+  for(i = 0; i < PHYSTOP>>12; i++)
+    if(pgrefcounter[i] > 1 &&
+       pgrefcounter[i] - pcacheheld(P2V(i<<12)) > 1)
+      ms->shared++;
+}
+
+// Returns the new count, so that two sharers dropping a page at
+// once can't both see it still in use (or both free it).
+uint chgpgrefc(void *va, int dif){
   if(kmem.use_lock){
     // Purpose is for use after kinits
     // indexed PPN for ref counter is (r-KERNBASE)>>12
     unsigned int ppn=((uint)va - KERNBASE)>>12;
-    acquire(&pgreflock);
-    pgrefcounter[ppn]+=dif;
-    release(&pgreflock);
+    uint c=xadd(&pgrefcounter[ppn], dif)+dif;
     // cprintf("changed ppn %d by dif %d resulting %d\n",
-        // ppn, dif, pgrefcounter[ppn]);
+        // ppn, dif, c);
+    return c;
   }
+  return 0;
 }
 
-uchar getpgrefc(void *va){
+uint getpgrefc(void *va){
   if(kmem.use_lock){
     // Purpose is for use after kinits
     // indexed PPN for ref counter is (r-KERNBASE)>>12
     unsigned int ppn=((uint)va - KERNBASE)>>12;
-    acquire(&pgreflock);
-    uchar c=pgrefcounter[ppn];
-    release(&pgreflock);
-    return c;
+    return pgrefcounter[ppn];
   }
   panic("somehow ended up here before kinit2 done?");
   return 0;
@@ -113,6 +113,21 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send a fixed interrupt with the given vector to one CPU.
+// Used to wake a CPU halted in idle() when work is queued for it.
+void
+lapicipi(uchar apicid, int vector)
+{
+  if(!lapic)
+    return;
+
+  // Wait for any previous IPI to be accepted before reusing ICR.
+  while(lapic[ICRLO] & DELIVS)
+    ;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
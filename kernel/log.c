@@ -137,6 +137,10 @@ begin_op(void)
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      // end_op() wakes only one waiter; pass the wakeup
+      // along while there is room for another op.
+      if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS <= LOGSIZE)
+        wakeup_one(&log);
       release(&log.lock);
       break;
     }
@@ -161,7 +165,7 @@ end_op(void)
     // begin_op() may be waiting for log space,
     // and decrementing log.outstanding has decreased
     // the amount of reserved space.
-    wakeup(&log);
+    wakeup_one(&log);
   }
   release(&log.lock);
 
@@ -171,7 +175,7 @@ end_op(void)
     commit();
     acquire(&log.lock);
     log.committing = 0;
-    wakeup(&log);
+    wakeup_one(&log);  // begin_op() wakes the rest in turn
     release(&log.lock);
   }
 }
@@ -186,10 +190,13 @@ write_log(void)
     struct buf *to = bread(log.dev, log.start+tail+1); // log block
     struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    bawrite(to);  // write the log; the disk merges consecutive blocks
     brelse(from);
-    brelse(to);
   }
+  // Wait for the log writes, as bread() can't lock a block
+  // until its write is done.
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(bread(log.dev, log.start+tail+1));
 }
 
 static void
@@ -32,6 +32,7 @@ main(void)
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
+  pcacheinit();    // executable page cache
   fileinit();      // file table
   ideinit();       // disk (ide1)
   ide2init();      // disk (ide2)
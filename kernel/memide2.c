@@ -13,6 +13,7 @@
 #include "fs.h"
 #include "semaphore.h"
 #include "buf.h"
+#include "iostat.h"
 
 extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
 
@@ -58,4 +59,13 @@ ide2rw(struct buf *b)
   } else
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
+  if(b->flags & B_ASYNC)
+    bdone(b);
+}
+
+// There is no queue to report on.
+void
+ide2stat(struct iostat *st)
+{
+  memset(st, 0, sizeof(*st));
 }
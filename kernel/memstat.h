@@ -0,0 +1,17 @@
+// Physical memory accounting returned by memstat().
+// Both the kernel and user programs use this header file.
+// All counts are in 4096-byte pages.
+
+struct memstat {
+  // System wide
+  uint total;     // pages the allocator manages
+  uint free;      // pages on the free lists
+  uint used;      // pages handed out by kalloc()
+  uint shared;    // pages mapped more than once (CoW or page cache);
+                  // the page cache's own reference doesn't count
+  uint pgtab;     // page directories and page tables of processes
+  // The process asked about
+  uint resident;  // user pages it has mapped
+  uint pshared;   // of those, pages it shares with others
+  uint ppgtab;    // its page directory and page tables
+};
@@ -178,7 +178,7 @@ static int readmouse(char* pkt){
 
 int sys_readmouse(void){
   char *pkt;
-  if(argptr(0, &pkt, 3)==-1){
+  if(argout(0, &pkt, 3)==-1){
     return -1;
   }
   return readmouse(pkt);
@@ -0,0 +1,171 @@
+// Executable page cache.
+//
+// Holds whole pages of executables, keyed by (dev, inum, offset),
+// so that processes running the same binary map the same physical
+// frames instead of each reading its own copy.  The cache keeps one
+// pgrefcounter reference on each page it holds and every mapping
+// adds another.  Mappings are copy-on-write (see loadpage in vm.c),
+// so a cached page is never written once it is in the cache.
+//
+// Interface:
+// * pcacheget returns the page for (ip, off) with a reference
+//     already counted for the caller.
+// * pcacheinval forgets an inode's pages when its contents change.
+//     Processes already mapping them keep the old contents.  The
+//     inode's pcached flag lets writes to other files skip the scan.
+// * pcacheheld tells whether one of a page's references is the
+//     cache's own.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+extern uint allocpages;
+
+struct pcpage {
+  uint dev;
+  uint inum;
+  uint off;
+  char *page;   // 0 if the slot is free
+};
+
+struct {
+  struct spinlock lock;
+  struct pcpage pg[NPCACHE];
+} pcache;
+
+void
+pcacheinit(void)
+{
+  initlock(&pcache.lock, "pcache");
+}
+
+// Drop the cache's reference on a slot's page.
+// Caller must hold pcache.lock.
+static void
+pcdrop(struct pcpage *pc)
+{
+  if(chgpgrefc(pc->page, -1) == 0){
+    kfree(pc->page);
+    allocpages--;
+  }
+  pc->page = 0;
+}
+
+// Look up (ip, off) and count a reference on it for the caller.
+// Caller must hold pcache.lock.
+static char*
+pclookup(struct inode *ip, uint off)
+{
+  struct pcpage *pc;
+
+  for(pc = pcache.pg; pc < &pcache.pg[NPCACHE]; pc++){
+    if(pc->page && pc->dev == ip->dev && pc->inum == ip->inum &&
+       pc->off == off){
+      chgpgrefc(pc->page, 1);
+      return pc->page;
+    }
+  }
+  return 0;
+}
+
+// Return the PGSIZE bytes of ip at off, in a page shared with
+// every other process that has the same bytes mapped.  The caller
+// owns one pgrefcounter reference and must only map it read-only.
+// Returns 0 if out of memory or the bytes can't be read.
+// Caller must hold ip->lock.
+char*
+pcacheget(struct inode *ip, uint off)
+{
+  struct pcpage *pc, *slot;
+  char *mem, *v;
+
+  acquire(&pcache.lock);
+  v = pclookup(ip, off);
+  release(&pcache.lock);
+  if(v){
+    ip->pcached = 1;
+    return v;
+  }
+
+  // Read it in without holding the spinlock.
+  if((mem = kalloc()) == 0)
+    return 0;
+  if(readi(ip, mem, off, PGSIZE) != PGSIZE){
+    kfree(mem);
+    return 0;
+  }
+  chgpgrefc(mem, 1);
+  allocpages++;
+
+  acquire(&pcache.lock);
+  if((v = pclookup(ip, off)) != 0){
+    // Another CPU read it in first; use its copy.
+    release(&pcache.lock);
+    chgpgrefc(mem, -1);
+    kfree(mem);
+    allocpages--;
+    ip->pcached = 1;
+    return v;
+  }
+  // Take a free slot, else one whose page nobody maps any more.
+  slot = 0;
+  for(pc = pcache.pg; pc < &pcache.pg[NPCACHE]; pc++){
+    if(pc->page == 0){
+      slot = pc;
+      break;
+    }
+    if(slot == 0 && getpgrefc(pc->page) == 1)
+      slot = pc;
+  }
+  if(slot){
+    if(slot->page)
+      pcdrop(slot);
+    slot->dev = ip->dev;
+    slot->inum = ip->inum;
+    slot->off = off;
+    slot->page = mem;
+    chgpgrefc(mem, 1);
+    ip->pcached = 1;
+  }
+  release(&pcache.lock);
+  return mem;
+}
+
+// Forget every cached page of ip.  Cheap for inodes that were
+// never paged in through the cache, i.e. almost every file written.
+// Caller must hold ip->lock.
+void
+pcacheinval(struct inode *ip)
+{
+  struct pcpage *pc;
+
+  if(!ip->pcached)
+    return;
+  acquire(&pcache.lock);
+  for(pc = pcache.pg; pc < &pcache.pg[NPCACHE]; pc++)
+    if(pc->page && pc->dev == ip->dev && pc->inum == ip->inum)
+      pcdrop(pc);
+  release(&pcache.lock);
+  ip->pcached = 0;
+}
+
+// Does the cache hold a reference on page?  Lets memstat() count
+// only the mappings of a cached page.
+int
+pcacheheld(char *page)
+{
+  struct pcpage *pc;
+
+  acquire(&pcache.lock);
+  for(pc = pcache.pg; pc < &pcache.pg[NPCACHE]; pc++)
+    if(pc->page == page)
+      break;
+  release(&pcache.lock);
+  return pc < &pcache.pg[NPCACHE];
+}
@@ -1,14 +1,31 @@
 #define NPROC        64  // maximum number of processes
+#define NSLEEPQ      61  // wait queue hash buckets for sleep()/wakeup()
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define BALANCETICKS  4  // timer ticks between run queue load balancing
+#define SLICEMAX      8  // CPU-bound time slices grow up to this many quanta
+#define HRRNSHIFT     8  // fraction bits of HRRN response ratios
+#define HRRNTICKS     4  // timer ticks between HRRN key updates
+#define NMLFQ         3  // MLFQ priority levels
+#define MLFQALLOT     2  // CPU ticks a process may use at MLFQ level 0
+                         // before demotion, doubling at each lower level
+#define MLFQBOOST   100  // ticks between MLFQ boosts back to level 0
+#define KBATCH       32  // pages moved at once between per-CPU and global free lists
+#define NZEROPAGES   64  // pre-zeroed pages idle CPUs keep for kalloc_zeroed()
+#define ZEROMINFREE 256  // free pages below which idle CPUs stop zeroing
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define NEXECSEG      4  // ELF segments per process exec() can demand page
+#define NPCACHE     128  // executable pages shared through the page cache
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (MAXOPBLOCKS*3)  // disk block cache buffers always present
+#define NBUFPAGE    512  // most kalloc() pages the block cache grows by
+#define NREADAHEAD    4  // blocks readi() reads ahead of a sequential reader
+#define BUFMINFREE 1024  // free pages the block cache leaves to others
 #define FSSIZE       1000  // size of file system in blocks
 
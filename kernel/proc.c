@@ -4,47 +4,72 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "traps.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "proc.h"
+#include "sched.h"
+#include "memstat.h"
 #include "helper.h"
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct proc *sleepq[NSLEEPQ]; // SLEEPING procs, hashed by chan
 } ptable;
 
-uint loadavg=0; // load_avg = p * current_load + (1-p) * load_avg
-int runnables=0; // runnables and loadavg updated every tick timer
+// Wait queue bucket for a sleep channel.  Channels are kernel
+// addresses, so drop the alignment bits before hashing.
+#define SLEEPHASH(chan) ((((uint)(chan)) >> 2) % NSLEEPQ)
+
+// 1, 5 and 15 second load averages, fixed point with FSHIFT bits
+// of fraction.  Each tick, cpu 0 moves them a fraction LOADK/FIXED_1
+// of the way toward the current number of RUNNABLE+RUNNING procs,
+// i.e. LOADK = FIXED_1*(1-exp(-1/(100*seconds))) at 100 ticks/s.
+#define FSHIFT  16
+#define FIXED_1 (1<<FSHIFT)
+static const uint loadk[3] = { 652, 131, 44 };
+static uint loadavg[3];
 
 static struct proc *initproc;
-static int newproc=0; // new proc flag step 1 hw 3
 
 extern uint allocpages;
-extern int kallocpages;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static void wakeup1(void *chan, int one);
 static void sched(void);
-static struct proc *roundrobin(void);
-static struct proc *shortestprocessnext(void); // step 6 hw 3
-static struct proc *shortestremainingtime(void);
-static struct proc *highestresponseratio(void);
-static struct proc *(*policy[])(void)={
-  [0]       roundrobin,
-  [1]       shortestprocessnext,
-  [2]       shortestremainingtime,
-  [3]       highestresponseratio
+static void setrunnable(struct proc *p);
+static void rekeyall(void);
+static struct cpu *busiestcpu(struct cpu *c);
+static struct proc *roundrobin(struct cpu *c);
+static struct proc *shortestprocessnext(struct cpu *c); // step 6 hw 3
+static struct proc *shortestremainingtime(struct cpu *c);
+static struct proc *highestresponseratio(struct cpu *c);
+static struct proc *mlfq(struct cpu *c);
+static struct proc *(*policy[])(struct cpu *)={
+  [SCHED_RR]    roundrobin,
+  [SCHED_SPN]   shortestprocessnext,
+  [SCHED_SRT]   shortestremainingtime,
+  [SCHED_HRRN]  highestresponseratio,
+  [SCHED_MLFQ]  mlfq
 };
-static void adjustallpticks(int ind);
+
+// Active policy and tunables, changed at runtime by schedctl().
+// Written under ptable.lock.
+static struct schedparam sparam={POLICY, 1, MLFQBOOST};
+static void adjustallpticks(void);
 
 void
 pinit(void)
 {
+  struct cpu *c;
+
   initlock(&ptable.lock, "ptable");
+  for(c = cpus; c < &cpus[NCPU]; c++)
+    initlock(&c->rq.lock, "runq");
 }
 
 // Must be called with interrupts disabled
@@ -108,10 +133,17 @@ allocproc(void)
         p->func[i]=(void (*) (int)) -1;
       }
       p->tramp=sigreturn_bounce;
-      newproc=1;
       p->tick=(struct ptimes) {0};
       p->tick.pt_real=ticks;
       p->eticks=0;
+      p->level=0;
+      p->levelcpu=0;
+      p->slice=sparam.quantum;
+      p->rqnext=0;
+      p->rqprev=0;
+      p->cpu=-1;
+      p->exe=0;
+      p->nseg=0;
       goto found;
     }
 
@@ -181,7 +213,7 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  setrunnable(p);
 
   release(&ptable.lock);
 }
@@ -196,8 +228,11 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Only reserve the addresses; pgfaultintr() allocates a zero
+    // page the first time each one is touched.
+    if(sz + n >= KERNBASE || sz + n < sz)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -207,6 +242,23 @@ growproc(int n)
   return 0;
 }
 
+// Install pgdir and sz as the current process's user memory and
+// return the old page table for the caller to free.  Done under
+// ptable.lock so that memstat() never walks a table being freed.
+pde_t*
+setpgdir(pde_t *pgdir, uint sz)
+{
+  struct proc *curproc = myproc();
+  pde_t *old;
+
+  acquire(&ptable.lock);
+  old = curproc->pgdir;
+  curproc->pgdir = pgdir;
+  curproc->sz = sz;
+  release(&ptable.lock);
+  return old;
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
@@ -241,6 +293,13 @@ fork(void)
     if(curproc->ofile[i])
       np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
+  // Pages the parent never touched are still paged in on demand
+  if(curproc->exe){
+    np->exe = idup(curproc->exe);
+    itext(np->exe, 1);
+  }
+  memmove(np->seg, curproc->seg, sizeof(curproc->seg));
+  np->nseg = curproc->nseg;
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
@@ -248,7 +307,7 @@ fork(void)
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  setrunnable(np);
 
   release(&ptable.lock);
 
@@ -278,22 +337,27 @@ exit(void)
     }
   }
 
+  if(curproc->exe)
+    itext(curproc->exe, -1);
   begin_op();
   iput(curproc->cwd);
+  if(curproc->exe)
+    iput(curproc->exe);
   end_op();
   curproc->cwd = 0;
+  curproc->exe = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup1(curproc->parent, 0);
 
   // Pass abandoned children to init.
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->parent == curproc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup1(initproc, 0);
     }
   }
 
@@ -357,9 +421,10 @@ wait(struct ptimes *ptime)
 // Each CPU calls idle() after setting itself up.
 // Idle never returns.  It loops, executing a HLT instruction in each
 // iteration.  The HLT instruction waits for an interrupt (such as a
-// timer interrupt) to occur.  Actual work gets done by the CPU when
-// the scheduler is invoked to switch the CPU from the idle loop to
-// a process context.
+// timer interrupt, or the IRQ_RESCHED IPI setrunnable() sends when
+// it queues work here) to occur.  Actual work gets done by the CPU
+// when the scheduler is invoked to switch the CPU from the idle loop
+// to a process context.
 void
 idle(void)
 {
@@ -369,24 +434,292 @@ idle(void)
     if(!(readeflags()&FL_IF)) // if (hardware interrupts is blocked)
       panic("idle non-interruptible");
     
-    // step 1 hw3 (working?)
-    acquire(&(ptable.lock));
-    int found=newproc; // check new proc flag
-    newproc=0;
-    release(&(ptable.lock));
-    if(found){
-      // pushcli();
-      cli();
+    // step 1 hw3: don't sit out a tick when work is queued here or
+    // could be stolen from a peer.  The counts are only hints; sched()
+    // rechecks them with the locks held.
+    // Advertise idling before looking, and with a locked xchg, so
+    // that a CPU queueing work after our check is sure to see the
+    // flag and send an IPI.
+    cli();
+    xchg(&mycpu()->idling, 1);
+    if(mycpu()->rq.nready > 0 || busiestcpu(mycpu()) != 0){
       // cprintf("from idle!\n");
+      mycpu()->idling = 0;
       reschedule();
-      // popcli();
+      sti();
+    }else if(kzerofill()){
+      // Nothing to run, so zero a page for kalloc_zeroed() instead
+      // of halting, then look for work again.
+      mycpu()->idling = 0;
       sti();
     }else{
+      // sti takes effect after the next instruction, so an interrupt
+      // arriving after the check above still ends the hlt.
+      sti();
       hlt(); // Wait for an interrupt
     }
+  }
+}
+
+// Heap key of a queued process under the active policy; the
+// process with the lowest key is at rq->heap[0].  Processes with
+// a negative predict_cpu() hint go first and processes preempted
+// in kernel mode go last.  SPN orders by predicted ticks and SRT
+// by predicted ticks still to run.  HRRN uses the response ratio
+// (wait + remaining) / remaining in HRRNSHIFT-bit fixed point,
+// negated so that the highest ratio sorts lowest.  Wait and
+// remaining ticks are clamped to HRRNMAXT so the shifted sum
+// fits in 31 bits.
+// Caller must hold ptable.lock.
+#define HRRNMAXT ((1<<(30-HRRNSHIFT))-1)
+
+static int
+rqkey(struct proc *p)
+{
+  int s, w;
+
+  if(p->kernelmode==1)
+    return 0x7fffffff;
+  if(p->eticks<0)
+    return -0x7fffffff;
+  switch(sparam.policy){
+  case SCHED_SPN:
+    return p->eticks;
+  case SCHED_SRT:
+    return p->eticks-p->tick.pt_cpu;
+  case SCHED_HRRN:
+    s=p->eticks-p->tick.pt_cpu;
+    if(s<1) // ran past its estimate
+      s=1;
+    if(s>HRRNMAXT)
+      s=HRRNMAXT;
+    w=p->tick.pt_wait;
+    if(w<0)
+      w=0;
+    if(w>HRRNMAXT)
+      w=HRRNMAXT;
+    return -(int)(((uint)(w+s)<<HRRNSHIFT)/s);
+  }
+  return 0;
+}
+
+// Does the active policy pick from the run queue heap?
+static int
+keyed(void)
+{
+  return sparam.policy==SCHED_SPN || sparam.policy==SCHED_SRT ||
+         sparam.policy==SCHED_HRRN;
+}
+
+static void
+heapswap(struct runq *rq, int i, int j)
+{
+  struct proc *p;
+
+  p = rq->heap[i];
+  rq->heap[i] = rq->heap[j];
+  rq->heap[j] = p;
+  rq->heap[i]->heapidx = i;
+  rq->heap[j]->heapidx = j;
+}
+
+// Restore the heap order around rq->heap[i] after its key changed.
+static void
+heapfix(struct runq *rq, int i)
+{
+  int c;
+
+  while(i > 0 && rq->heap[i]->key < rq->heap[(i-1)/2]->key){
+    heapswap(rq, i, (i-1)/2);
+    i = (i-1)/2;
+  }
+  for(;;){
+    c = 2*i+1;
+    if(c >= rq->nready)
+      break;
+    if(c+1 < rq->nready && rq->heap[c+1]->key < rq->heap[c]->key)
+      c++;
+    if(rq->heap[i]->key <= rq->heap[c]->key)
+      break;
+    heapswap(rq, i, c);
+    i = c;
+  }
+}
+
+// Recompute the key of every process on rq and rebuild its heap,
+// for when keys change while processes wait (HRRN ageing or a
+// policy switch).
+// Caller must hold rq->lock and ptable.lock.
+static void
+rqrekey(struct runq *rq)
+{
+  int i;
+
+  for(i = 0; i < rq->nready; i++)
+    rq->heap[i]->key = rqkey(rq->heap[i]);
+  for(i = rq->nready/2 - 1; i >= 0; i--)
+    heapfix(rq, i);
+}
+
+// Append p to the tail of run queue rq.
+// Caller must hold rq->lock.
+static void
+rqpush(struct runq *rq, struct proc *p)
+{
+  p->rqnext = 0;
+  p->rqprev = rq->tail;
+  if(rq->tail)
+    rq->tail->rqnext = p;
+  else
+    rq->head = p;
+  rq->tail = p;
+  p->key = rqkey(p);
+  p->heapidx = rq->nready;
+  rq->heap[rq->nready++] = p;
+  heapfix(rq, p->heapidx);
+}
+
+// Unlink p from run queue rq.
+// Caller must hold rq->lock.
+static void
+rqremove(struct runq *rq, struct proc *p)
+{
+  int i;
+
+  i = p->heapidx;
+  if(i >= rq->nready || rq->heap[i] != p)
+    panic("rqremove");
+  if(p->rqprev)
+    p->rqprev->rqnext = p->rqnext;
+  else
+    rq->head = p->rqnext;
+  if(p->rqnext)
+    p->rqnext->rqprev = p->rqprev;
+  else
+    rq->tail = p->rqprev;
+  p->rqnext = p->rqprev = 0;
+  if(i != --rq->nready){
+    heapswap(rq, i, rq->nready);
+    heapfix(rq, i);
+  }
+}
 
-    // hlt();
+// Number of processes a CPU is running or has queued.
+// Stable while ptable.lock is held; only a hint otherwise.
+static int
+cpuload(struct cpu *c)
+{
+  return c->rq.nready + (c->proc != 0);
+}
+
+// Find the CPU other than c with queued work and the highest load.
+// Returns 0 if no other CPU has anything queued.
+static struct cpu*
+busiestcpu(struct cpu *c)
+{
+  struct cpu *o, *busiest;
+
+  busiest = 0;
+  for(o = cpus; o < cpus+ncpu; o++){
+    if(o == c || o->rq.nready == 0)
+      continue;
+    if(busiest == 0 || cpuload(o) > cpuload(busiest))
+      busiest = o;
+  }
+  return busiest;
+}
+
+// Move a process from from's run queue onto c's run queue: the
+// most recently queued one, which would wait longest there, or
+// under a keyed policy the one from would run next, so that the
+// best job anywhere is not stuck behind a busy CPU.
+// Returns the process moved, or 0 if from had nothing queued.
+// Caller must hold ptable.lock.
+static struct proc*
+steal(struct cpu *c, struct cpu *from)
+{
+  struct proc *p;
+
+  acquire(&from->rq.lock);
+  p = keyed() ? from->rq.heap[0] : from->rq.tail;
+  if(from->rq.nready == 0)
+    p = 0;
+  if(p != 0)
+    rqremove(&from->rq, p);
+  release(&from->rq.lock);
+  if(p == 0)
+    return 0;
+  p->cpu = c - cpus;
+  acquire(&c->rq.lock);
+  rqpush(&c->rq, p);
+  release(&c->rq.lock);
+  return p;
+}
+
+// Choose a CPU for a process that is becoming runnable:
+// the least loaded running CPU, with ties going to the CPU
+// the process was last queued on so its cache stays warm.
+// Caller must hold ptable.lock.
+static struct cpu*
+pickcpu(struct proc *p)
+{
+  struct cpu *c, *best;
+
+  best = (p->cpu >= 0) ? &cpus[p->cpu] : mycpu();
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(!c->started)
+      continue;
+    if(cpuload(c) < cpuload(best))
+      best = c;
   }
+  return best;
+}
+
+// Mark p RUNNABLE and put it on a run queue.  A process preempted
+// or yielding on this CPU is requeued here; a new or woken process
+// goes wherever pickcpu() finds room.
+// Caller must hold ptable.lock.
+static void
+setrunnable(struct proc *p)
+{
+  struct cpu *c;
+
+  if(p->state == RUNNING){
+    c = mycpu();
+  }else{
+    mycpu()->nrun++;
+    c = pickcpu(p);
+  }
+  p->state = RUNNABLE;
+  p->cpu = c - cpus;
+  acquire(&c->rq.lock);
+  rqpush(&c->rq, p);
+  release(&c->rq.lock);
+
+  // A halted CPU would otherwise not look at its queue until
+  // its next timer tick.
+  if(c != mycpu() && c->idling)
+    lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// Set the length of p's next time slice as it leaves the CPU.
+// MLFQ gives each level down twice the slice of the one above.
+// Otherwise a process that ran its whole slice is CPU-bound and
+// gets a slice twice as long next time, up to SLICEMAX quanta,
+// while one that blocked or yielded early drops back to a single
+// quantum so it stays responsive.
+// Caller must hold ptable.lock.
+static void
+setslice(struct proc *p)
+{
+  if(sparam.policy == SCHED_MLFQ)
+    p->slice = sparam.quantum << p->level;
+  else if(p->sliceticks < p->slice)
+    p->slice = sparam.quantum;
+  else if(p->slice < sparam.quantum*SLICEMAX)
+    p->slice *= 2;
+  if(p->slice > sparam.quantum*SLICEMAX)
+    p->slice = sparam.quantum*SLICEMAX;
 }
 
 // The process scheduler.
@@ -402,7 +735,7 @@ idle(void)
 // places where a lock is held but there's no process.)
 //
 // When invoked, does the following:
-//  - choose a process to run
+//  - choose a process to run from this CPU's run queue
 //  - swtch to start running that process (or idle, if none)
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
@@ -414,6 +747,7 @@ sched(void)
   struct proc *p;
   struct context **oldcontext;
   struct cpu *c = mycpu();
+  struct cpu *victim;
   
   if(!holding(&ptable.lock))
     panic("sched ptable.lock");
@@ -422,23 +756,12 @@ sched(void)
   if(readeflags()&FL_IF)
     panic("sched interruptible");
 
-  // set reset runnables to 0 and count how many processes are competing for CPU / in RUNNABLE
-  runnables=0;
-  for(int i=0; i<NPROC; i++){
-    if(ptable.proc[i].state==RUNNABLE||ptable.proc[i].state==RUNNING){
-      runnables++;
-    }
-  }
-  // loadavg=0.9992328f*loadavg;
-  // loadavg=loadavg+0.0007672f*runnables;
-  loadavg=(9992328*loadavg)/10000000; // get 4 decimal digit ==> value ABCD=0.ABCD
-  loadavg=loadavg+(7672*runnables*10000)/10000000; // get 4 decimal digit ==> value ABCD=0.ABCD
-// float x = 25.83f*3;
-// int y = (int)(x + 0.5f);
-// cprintf(" this is y %d", y); // this works
-// int loadavgint=(int)(loadavg*10000);
-// cprintf("this is loadavgint %d", loadavgint); // this doesnt
-// y=y; loadavgint=loadavgint;
+  // A process going to sleep or exiting stops competing for a CPU.
+  // One that was preempted has already been requeued by setrunnable().
+  if(c->proc && c->proc->state != RUNNABLE)
+    c->nrun--;
+  if(c->proc)
+    setslice(c->proc);
 
   // Determine the current context, which is what we are switching from.
   if(c->proc) {
@@ -477,15 +800,27 @@ sched(void)
   //     mycpu()->intena = intena;  // We might return on a different CPU.
   //   }
   // }else {
-    // Choose next process to run.
-    if((p = policy[POLICY]()) != 0) {
+    // Nothing queued here: take work from the busiest peer
+    // instead of idling while it has a backlog.
+    if(c->rq.nready == 0 && (victim = busiestcpu(c)) != 0)
+      steal(c, victim);
+
+    // Choose next process to run from this CPU's queue.
+    acquire(&c->rq.lock);
+    if((p = policy[sparam.policy](c)) != 0)
+      rqremove(&c->rq, p);
+    release(&c->rq.lock);
+    if(p != 0) {
       // Switch to chosen process.  It is the process's job
       // to release ptable.lock and then reacquire it
       // before jumping back to us.
       p->state = RUNNING;
+      p->sliceticks = 0;
+      c->idling = 0;  // we may be leaving idle() from a timer tick
       switchuvm(p);
       if(c->proc != p) {
         c->proc = p;
+        c->nswtch++;
         intena = c->intena;
         swtch(oldcontext, p->context);
         mycpu()->intena = intena;  // We might return on a different CPU.
@@ -495,6 +830,7 @@ sched(void)
       switchkvm();
       if(oldcontext != &(c->scheduler)) {
         c->proc = 0;
+        c->nswtch++;
         intena = c->intena;
         swtch(oldcontext, c->scheduler);
         mycpu()->intena = intena;
@@ -503,137 +839,67 @@ sched(void)
   // }
 }
 
-// Round-robin scheduler.
-// The same variable is used by all CPUs to determine the starting index.
-// It is protected by the process table lock, so no additional lock is
-// required.
-static int rrindex;
+// Scheduling policies.
+// Each is called by sched() with ptable.lock and c->rq.lock held
+// and only picks from c's run queue; sched() dequeues the pick.
 
+// Round-robin scheduler.
+// The run queue is kept in FIFO order, so the next process to
+// run is always the one at its head.
 static struct proc *
-roundrobin()
+roundrobin(struct cpu *c)
 {
   // cprintf("applying RR\n");
-  // Loop over process table looking for process to run.
-  for(int i = 0; i < NPROC; i++) {
-    struct proc *p = &ptable.proc[(i + rrindex + 1) % NPROC];
-    if(p->state != RUNNABLE)
-      continue;
-    rrindex = p - ptable.proc;
-    adjustallpticks(rrindex); // hw 3 step 2|6 : adjust ticks
-    return p;
-  }
-  adjustallpticks(rrindex); // hw 3 step 2|6 : adjust ticks
-  return 0;
+  return c->rq.head;
 }
 
-static struct proc *shortestprocessnext(){
+// Shortest process next, by predict_cpu() estimate (see rqkey).
+static struct proc *shortestprocessnext(struct cpu *c){
   // cprintf("applying SPN\n"); works more/less, some ticks missed
-  static struct proc *running[NCPU]={0};
-  static int openind=-1;
-  // pick a previous processes already ran
-  for(int i=0; i<NCPU; i++){
-    if(running[i]!=0 && running[i]->state==RUNNABLE){
-      adjustallpticks(running[i]-ptable.proc);
-      return running[i];
-    }
-    openind=i; // state of the process isn't an active one, then it's free
-  }
-  int num=-1; // num now used to keep track of index for lowest proc
-  for(int i=0; i<NPROC; i++){
-    if((ptable.proc[i].state != RUNNABLE) || (ptable.proc[i].kernelmode==1)){
-      continue;
-    }
-    if(ptable.proc[i].eticks<0){ // give first priority to neg predict_cpu()
-      num=i;
-      break;
-    }
-    if(num<0){ // first proc availible edge case
-      num=i;
-      continue;
-    }else if(ptable.proc[i].eticks<=ptable.proc[num].eticks){
-      num=i;
-    }
+  // keep the process this CPU picked before, it was only preempted
+  if(c->proc!=0 && c->proc->state==RUNNABLE){
+    return c->proc;
   }
-  if(num>-1){
-    // save chosen proc into open spot
-    running[openind]=&ptable.proc[num];
-    adjustallpticks(num); // hw 3 step 2|6 : adjust ticks
-    return &ptable.proc[num];
-  }
-  adjustallpticks(num); // hw 3 step 2|6 : adjust ticks
-  return 0;
+  return c->rq.nready ? c->rq.heap[0] : 0;
 }
 
-static struct proc *shortestremainingtime(){
+// Shortest remaining time: the preempted process competes again
+// with its remaining estimate, so a shorter job can take over.
+static struct proc *shortestremainingtime(struct cpu *c){
   // cprintf("applying SRT\n");
-  int num=-1; // num now used to keep track of index
-  // Loop over process table looking for shortest process to run.
-  for(int i = 0; i < NPROC; i++){
-    if((ptable.proc[i].state != RUNNABLE) || (ptable.proc[i].kernelmode==1)){
-      continue;
-    }
-    if(ptable.proc[i].eticks<0){ // give first priority to neg predict_cpu()
-      num=i;
-      break;
-    }
-    if(num<0){ // first proc availible edge case
-      num=i;
-      continue;
-    }
-    int comp=ptable.proc[i].eticks-ptable.proc[i].tick.pt_cpu;
-    int org=ptable.proc[num].eticks-ptable.proc[num].tick.pt_cpu;
-    if(comp<org){
-      num=i;
-    }
-  }
-  if(num>-1){
-    adjustallpticks(num); // hw 3 step 2|6 : adjust ticks
-    return &ptable.proc[num];
-  }
-  adjustallpticks(num); // hw 3 step 2|6 : adjust ticks
-  return 0;
+  return c->rq.nready ? c->rq.heap[0] : 0;
 }
 
-static struct proc *highestresponseratio(){
+// Highest response ratio next; the ratios live in the heap keys
+// (see rqkey), which schedtick() refreshes as waiting time grows.
+static struct proc *highestresponseratio(struct cpu *c){
   // cprintf("applying HRRN\n");
-  static struct proc *running[NCPU]={0};
-  static int openind=-1;
-  // pick a processes that had already ran
-  for(int i=0; i<NCPU; i++){
-    if(running[i]!=0 && running[i]->state==RUNNABLE){
-      adjustallpticks(running[i]-ptable.proc);
-      return running[i];
-    }
-    openind=i; // state of the process isn't an active one, then it's free
+  // keep the process this CPU picked before, it was only preempted
+  if(c->proc!=0 && c->proc->state==RUNNABLE){
+    return c->proc;
   }
-  int num=-1; // num now used to keep track of index
-  for(int i = 0; i < NPROC; i++){
-    if((ptable.proc[i].state != RUNNABLE) || (ptable.proc[i].kernelmode==1)){
-      continue;
-    }
-    if(ptable.proc[i].eticks<0){ // give first priority to neg predict_cpu()
-      num=i;
-      break;
-    }else if(num<0){ // first proc availible edge case
-      num=i;
-    }else{
-      float org=(ptable.proc[num].tick.pt_wait+(ptable.proc[num].eticks-ptable.proc[num].tick.pt_cpu)) /
-                (ptable.proc[num].eticks-ptable.proc[num].tick.pt_cpu);
-      float comp=(ptable.proc[i].tick.pt_wait+(ptable.proc[i].eticks-ptable.proc[i].tick.pt_cpu)) /
-                (ptable.proc[i].eticks-ptable.proc[i].tick.pt_cpu);
-      if(comp>org){
-        num=i;
-      }
+  return c->rq.nready ? c->rq.heap[0] : 0;
+}
+
+// Multi-level feedback queue.
+// Every process starts at level 0 and sinks a level each time it
+// uses up its CPU allotment there (see adjustallpticks), so CPU-bound
+// work drifts down while processes that mostly sleep stay on top.
+// Picks the first queued process at the best level, which keeps FIFO
+// order within a level.  No predict_cpu() hints are needed.
+static struct proc *
+mlfq(struct cpu *c)
+{
+  struct proc *p, *best=0;
+
+  for(p=c->rq.head; p; p=p->rqnext){
+    if(best==0 || p->level<best->level){
+      best=p;
+      if(best->level==0)
+        break;
     }
   }
-  if(num>-1){
-    // save chosen proc into open spot
-    running[openind]=&ptable.proc[num];
-    adjustallpticks(num); // hw 3 step 2|6 : adjust ticks
-    return &ptable.proc[num];
-  }
-  adjustallpticks(num); // hw 3 step 2|6 : adjust ticks
-  return 0;
+  return best;
 }
 
 // Called from timer interrupt to reschedule the CPU.
@@ -642,22 +908,22 @@ reschedule(void)
 {
   struct cpu *c = mycpu();
 
+  // Let the running process use up its time slice first.
+  if(c->proc && ++c->proc->sliceticks < c->proc->slice)
+    return;
+
   acquire(&ptable.lock); // nlci+1
   if(c->proc) {
     if(c->proc->state != RUNNING)
       panic("current process not in running state");
-    c->proc->state = RUNNABLE;
+    setrunnable(c->proc);
   }
   sched();
-  // NOTE: there is a race here.  We need to release the process
-  // table lock before idling the CPU, but as soon as we do, it
-  // is possible that an an event on another CPU could cause a process
-  // to become ready to run.  The undesirable (but non-catastrophic)
-  // consequence of such an occurrence is that this CPU will idle until
-  // the next timer interrupt, when in fact it could have been doing
-  // useful work.  To do better than this, we would need to arrange
-  // for a CPU releasing the process table lock to interrupt all other
-  // CPUs if there could be any runnable processes.
+  // Once we release the process table lock and go idle, an event on
+  // another CPU may make a process runnable.  setrunnable() queues it
+  // here only if we are the least loaded CPU, and then sends an
+  // IRQ_RESCHED IPI if idle() has already advertised c->idling, so
+  // this CPU does not sit halted until the next timer interrupt.
   release(&ptable.lock);
 }
 
@@ -666,11 +932,191 @@ void
 yield(void)
 {
   acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  setrunnable(myproc());
   sched();
   release(&ptable.lock);
 }
 
+// Periodic load balancing, called from every CPU's timer interrupt.
+// Every BALANCETICKS ticks a CPU pulls queued processes from the
+// busiest peer until the two loads are within one of each other.
+void
+balance(void)
+{
+  struct cpu *c = mycpu();
+  struct cpu *busiest;
+
+  if(++c->balticks < BALANCETICKS)
+    return;
+  c->balticks = 0;
+
+  // Unlocked peek first, so a balanced machine never takes ptable.lock.
+  if((busiest = busiestcpu(c)) == 0 || cpuload(busiest) - cpuload(c) < 2)
+    return;
+  acquire(&ptable.lock);
+  while((busiest = busiestcpu(c)) != 0 && cpuload(busiest) - cpuload(c) >= 2)
+    steal(c, busiest);
+  release(&ptable.lock);
+}
+
+// Get and optionally change the scheduling policy and tunables.
+// Negative fields of *sp are left alone; on return *sp holds the
+// settings now in effect.  Returns -1 if a setting is out of range.
+int
+schedctl(struct schedparam *sp)
+{
+  struct schedparam sq=*sp;
+
+  if(sq.policy>=NSCHED || sq.quantum==0 || sq.quantum>QUANTUMMAX ||
+     sq.aging==0 || sq.aging>AGINGMAX){
+    return -1;
+  }
+  acquire(&ptable.lock);
+  if(sq.policy>=0){
+    sparam.policy=sq.policy;
+  }
+  if(sq.quantum>0){
+    sparam.quantum=sq.quantum;
+  }
+  if(sq.aging>0){
+    sparam.aging=sq.aging;
+  }
+  sq=sparam;
+  rekeyall();
+  release(&ptable.lock);
+  *sp=sq; // may fault on a shared user page, so not under the lock
+  return 0;
+}
+
+// Recompute the heap keys on every run queue.
+// Caller must hold ptable.lock.
+static void
+rekeyall(void)
+{
+  struct cpu *c;
+
+  for(c = cpus; c < cpus+ncpu; c++){
+    acquire(&c->rq.lock);
+    rqrekey(&c->rq);
+    release(&c->rq.lock);
+  }
+}
+
+// Number of page table pages in pgdir: the directory itself and
+// the page tables of its user half.  The kernel half is kpgdir's.
+static uint
+pgtabpages(pde_t *pgdir)
+{
+  uint i, n;
+
+  n = 1;
+  for(i = 0; i < PDX(KERNBASE); i++)
+    if(pgdir[i] & PTE_P)
+      n++;
+  return n;
+}
+
+// Fill in *ms with the system-wide page counts and those of process
+// pid (the caller if pid is 0).
+// Returns -1 if there is no such process.
+int
+memstat(int pid, struct memstat *ms)
+{
+  struct memstat m;
+  struct proc *p, *found;
+  pte_t *pte;
+  uint a, n;
+
+  if(pid == 0)
+    pid = myproc()->pid;
+  kmemstat(&m);
+  m.pgtab = m.resident = m.pshared = m.ppgtab = 0;
+  found = 0;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state == UNUSED || p->state == EMBRYO || p->pgdir == 0)
+      continue;
+    m.pgtab += pgtabpages(p->pgdir);
+    if(p->pid != pid)
+      continue;
+    found = p;
+    m.ppgtab = pgtabpages(p->pgdir);
+    for(a = 0; a < p->sz; a += PGSIZE){
+      if((pte = walkpgdir(p->pgdir, (void*)a, 0)) == 0){
+        a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+        continue;
+      }
+      if(!(*pte & PTE_P)) // not paged in yet
+        continue;
+      m.resident++;
+      // Mapped elsewhere too, not counting the page cache's reference
+      n = getpgrefc(P2V(PTE_ADDR(*pte)));
+      if(n > 1 && n - pcacheheld(P2V(PTE_ADDR(*pte))) > 1)
+        m.pshared++;
+    }
+  }
+  release(&ptable.lock);
+  if(found == 0)
+    return -1;
+  *ms = m; // may fault on a shared user page, so not under the lock
+  return 0;
+}
+
+// Total context switches made by all CPUs since boot.
+int
+nswtch(void)
+{
+  struct cpu *c;
+  uint n;
+
+  n = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    n += c->nswtch;
+  return n;
+}
+
+// Fold the current number of RUNNABLE+RUNNING procs into the
+// load averages.  Each cpu only ever changes its own nrun, so the
+// sum is read without locks.  It may be off (even negative) by a
+// transition in flight; the averaging smooths that out.
+static void
+loadtick(void)
+{
+  struct cpu *c;
+  uint n;
+  int i, nrun;
+
+  nrun = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    nrun += c->nrun;
+  if(nrun < 0)
+    nrun = 0;
+  n = nrun << FSHIFT;
+  for(i = 0; i < 3; i++){
+    if(n >= loadavg[i])
+      loadavg[i] += ((n - loadavg[i]) * loadk[i]) >> FSHIFT;
+    else
+      loadavg[i] -= ((loadavg[i] - n) * loadk[i]) >> FSHIFT;
+  }
+}
+
+// Called once per tick from the timer interrupt on cpu 0 to
+// charge the elapsed tick to every process's ptimes and update
+// the load averages.
+void
+schedtick(void)
+{
+  acquire(&ptable.lock);
+  adjustallpticks();
+  // Waiting raised every HRRN ratio; catch up every HRRNTICKS.
+  // SPN and SRT keys only move with pt_cpu, which queued
+  // processes don't accumulate.
+  if(sparam.policy == SCHED_HRRN && ticks % HRRNTICKS == 0)
+    rekeyall();
+  release(&ptable.lock);
+  loadtick();
+}
+
 // A fork child's very first scheduling by scheduler()
 // will swtch here.  "Return" to user space.
 void
@@ -695,6 +1141,37 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// Append p to the wait queue for p->chan, keeping each queue in
+// FIFO order for wakeup_one().
+// Caller must hold ptable.lock.
+static void
+sleepqpush(struct proc *p)
+{
+  struct proc **pp;
+
+  p->sleepnext = 0;
+  for(pp = &ptable.sleepq[SLEEPHASH(p->chan)]; *pp; pp = &(*pp)->sleepnext)
+    ;
+  *pp = p;
+}
+
+// Unlink p from the wait queue for p->chan.
+// Caller must hold ptable.lock.
+static void
+sleepqremove(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &ptable.sleepq[SLEEPHASH(p->chan)]; *pp; pp = &(*pp)->sleepnext){
+    if(*pp == p){
+      *pp = p->sleepnext;
+      p->sleepnext = 0;
+      return;
+    }
+  }
+  panic("sleepqremove");
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
@@ -721,6 +1198,7 @@ sleep(void *chan, struct spinlock *lk)
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  sleepqpush(p);
 
   sched();
 
@@ -735,16 +1213,26 @@ sleep(void *chan, struct spinlock *lk)
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
+// Wake up processes sleeping on chan, or only the one that has
+// waited longest if one is set.  Only chan's wait queue is searched.
 // The ptable lock must be held.
 static void
-wakeup1(void *chan)
+wakeup1(void *chan, int one)
 {
-  struct proc *p;
+  struct proc **pp, *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  pp = &ptable.sleepq[SLEEPHASH(chan)];
+  while((p = *pp) != 0){
+    if(p->chan != chan){
+      pp = &p->sleepnext;
+      continue;
+    }
+    *pp = p->sleepnext;
+    p->sleepnext = 0;
+    setrunnable(p);
+    if(one)
+      return;
+  }
 }
 
 // Wake up all processes sleeping on chan.
@@ -752,7 +1240,18 @@ void
 wakeup(void *chan)
 {
   acquire(&ptable.lock);
-  wakeup1(chan);
+  wakeup1(chan, 0);
+  release(&ptable.lock);
+}
+
+// Wake up at most one process sleeping on chan.  For channels where
+// one event can satisfy only one sleeper (a released sleeplock, a
+// semaphore unit), so the others are not woken just to sleep again.
+void
+wakeup_one(void *chan)
+{
+  acquire(&ptable.lock);
+  wakeup1(chan, 1);
   release(&ptable.lock);
 }
 
@@ -769,8 +1268,10 @@ kill(int pid)
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+      if(p->state == SLEEPING){
+        sleepqremove(p);
+        setrunnable(p);
+      }
       release(&ptable.lock);
       return 0;
     }
@@ -801,7 +1302,7 @@ procdump(void)
 
   // For proc paging info
   cprintf("Tot. Mem. Pages (only ptes are noted in coremap/array):\n %d, Pte entries used: %d, Pages free: %d\n",
-      PHYSTOP>>12, allocpages, (PHYSTOP>>12)-kallocpages);
+      PHYSTOP>>12, allocpages, (PHYSTOP>>12)-kallocpages());
 
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->state == UNUSED)
@@ -829,12 +1330,13 @@ procdump(void)
     uint sum=0; // total # of Pt for proc
     uint shared=0; // total shared # Pt for proc
     for(i=0; i<p->sz; i+=PGSIZE){
-      if((pte=walkpgdir(p->pgdir, (void*)i, 0))==0){
-        panic("procdump: pte should exists");
-      }
+      pte=walkpgdir(p->pgdir, (void*)i, 0);
       ptes[i>>12]=pte;
+      if(pte==0 || !(*pte&PTE_P)){ // not paged in yet
+        continue;
+      }
       uint pa=PTE_ADDR(*pte);
-      uchar count=getpgrefc(P2V(pa));
+      uint count=getpgrefc(P2V(pa));
       if(count>1){
         shared++;
         sum++;
@@ -848,6 +1350,9 @@ procdump(void)
         p->pid, state, p->name, sum, shared);
     uint pa;
     for(i=0; i<p->sz; i+=PGSIZE){
+      if(ptes[i>>12]==0 || !(*ptes[i>>12]&PTE_P)){
+        continue;
+      }
       pa=PTE_ADDR(*(ptes[i>>12]));
       cprintf("\n0x%x", P2V(pa));
       pa=getpgrefc(P2V(pa));
@@ -912,7 +1417,7 @@ void kfork(void (*func)(void)){
 
   // set process to runnable
   acquire(&(ptable.lock));
-  p->state=RUNNABLE;
+  setrunnable(p);
   release(&(ptable.lock));
   p->kernelmode=1; // hw 3 step 6 ; is a kernel thread
 }
@@ -958,6 +1463,10 @@ int sigsethandler(int sig, void (*hand)(int sig)){
 }
 
 void sigreturn(void){
+  if(pagein(myproc()->tf->esp, 8+sizeof(struct trapframe), 0)<0){
+    myproc()->killed=1; // not a signal stack frame
+    return;
+  }
   // clear signal-related stack frame
   // 2) get signalnum from user stack and remove from mask
   myproc()->tf->esp+=4; // +4 to skip trampoline address
@@ -1025,34 +1534,47 @@ int getpt_sleep(struct proc *p){
   return p->tick.pt_sleep;
 }
 
-int getloadavg(){
-  return loadavg;
+// fill avg with the 1, 5 and 15 second load averages, in hundredths.
+void getloadavg(int *avg){
+  int i;
+  for(i=0; i<3; i++)
+    avg[i]=(loadavg[i]*100+FIXED_1/2)>>FSHIFT;
 }
 
+// The caller is RUNNING and so not on a run queue; its heap key
+// picks up the new estimate when it is next queued.
 void predict_cpu(int ticks){
   myproc()->eticks=ticks;
 }
 
 // Adjust all valid processes' ticks accordingly
-// Given argument is the index of chosen process in ptable
-static void adjustallpticks(int ind){
+// Runs once per tick (see schedtick), so RUNNING processes
+// are charged here rather than by each CPU's scheduler.
+// MLFQ levels follow the same accounting.
+static void adjustallpticks(void){
   for(int i=0; i<NPROC; i++){
     struct proc *p=&ptable.proc[i];
     enum procstate ps=p->state;
     if(ps==SLEEPING){
       p->tick.pt_sleep++;
-    }else if(i==ind){
-      // must be compared before ps==RUNNABLE
-      // b/c chosen proc is still RUNNABLE state
-      // processes in RUNNING state will be 
-      // adjusted by the respective CPU
+    }else if(ps==RUNNING){
       p->tick.pt_cpu++;
+      // MLFQ: demote once the allotment at this level is used up
+      if(p->level<NMLFQ-1 && p->tick.pt_cpu-p->levelcpu>=(MLFQALLOT<<p->level)){
+        p->level++;
+        p->levelcpu=p->tick.pt_cpu;
+      }
     }else if(ps==RUNNABLE){
       p->tick.pt_wait++;
     }
     if(ps!=UNUSED){ // increment all valid processes
       p->tick.pt_real++;
     }
+    // MLFQ: periodic boost so demoted processes can't starve
+    if(ticks%sparam.aging==0){
+      p->level=0;
+      p->levelcpu=p->tick.pt_cpu;
+    }
   }
 }
 
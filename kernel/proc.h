@@ -1,3 +1,16 @@
+// Per-CPU run queue of RUNNABLE processes, doubly linked through
+// proc->rqnext/rqprev in FIFO order and also kept in a binary min-heap
+// on proc->key for the policies that pick by priority.
+// Processes are only queued or dequeued while holding both
+// ptable.lock and the queue's own lock.
+struct runq {
+  struct spinlock lock;
+  struct proc *head;           // Next process in FIFO order
+  struct proc *tail;           // Last process in FIFO order
+  int nready;                  // Number of processes on the queue
+  struct proc *heap[NPROC];    // Min-heap on key; heap[0] is the best
+};
+
 // Per-CPU state
 struct cpu {
   uchar apicid;                // Local APIC ID
@@ -8,6 +21,11 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  struct runq rq;              // Processes waiting to run on this cpu
+  uint balticks;               // Timer ticks since the last load balance
+  volatile uint idling;        // In idle(); needs an IPI to notice new work
+  uint nswtch;                 // Context switches made by this cpu
+  int nrun;                    // Net procs this cpu made RUNNABLE/RUNNING
 };
 
 extern struct cpu cpus[NCPU];
@@ -41,6 +59,14 @@ struct ptimes {
   int pt_sleep;  // Ticks spent sleeping
 };
 
+// An ELF segment that exec() left to be paged in on first touch.
+struct execseg {
+  uint va;                     // First user address, page aligned
+  uint memsz;                  // Bytes of memory it occupies
+  uint off;                    // Offset of its contents in the executable
+  uint filesz;                 // Bytes read from there; the rest is zero
+};
+
 // Per-process state
 struct proc {
   uint sz;                     // Size of process memory (bytes)
@@ -65,6 +91,19 @@ struct proc {
   struct ptimes tick;          // tick data tracker
   int eticks;                  // the estimated ticks; step 4 hw 3
   int kernelmode;              // my flag for kernel mode step 4 hw 3
+  int level;                   // MLFQ priority level, 0 is highest
+  int levelcpu;                // tick.pt_cpu when it entered that level
+  int slice;                   // Length of its time slice, in ticks
+  int sliceticks;              // Timer ticks used of the current slice
+  struct proc *rqnext;         // Next process on the same run queue
+  struct proc *rqprev;         // Previous process on the same run queue
+  int key;                     // Run queue heap key, lower runs first
+  int heapidx;                 // Index in its run queue's heap
+  struct proc *sleepnext;      // Next process on the same wait queue
+  int cpu;                     // Index of the cpu whose queue it last joined
+  struct inode *exe;           // Executable demand paged from, or null
+  struct execseg seg[NEXECSEG]; // exe's segments not loaded up front
+  int nseg;                    // Number of entries in seg
 };
 
 // Process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,20 @@
+// Scheduler policies and tunables.
+// Both the kernel and user programs use this header file.
+
+#define SCHED_RR    0  // round robin
+#define SCHED_SPN   1  // shortest process next
+#define SCHED_SRT   2  // shortest remaining time
+#define SCHED_HRRN  3  // highest response ratio next
+#define SCHED_MLFQ  4  // multi-level feedback queue
+#define NSCHED      5
+
+#define QUANTUMMAX  125  // longest quantum; SLICEMAX quanta stay within 1000 ticks
+#define AGINGMAX 100000  // longest MLFQ boost interval
+
+// Argument to schedctl().  A negative field leaves that
+// setting unchanged; on return every field is current.
+struct schedparam {
+  int policy;   // SCHED_* policy used by sched()
+  int quantum;  // timer ticks a process runs before preemption
+  int aging;    // ticks between MLFQ boosts back to level 0
+};
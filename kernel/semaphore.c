@@ -10,7 +10,7 @@ void sem_init(struct semaphore *sp, int val){
 
 void sem_P(struct semaphore *sp){
     acquire(&(sp->chan));
-    if(sp->value==0){
+    while(sp->value==0){ // recheck, a V's unit may be taken first
         sleep(&(sp->chan),&(sp->chan));
     }
     sp->value--;
@@ -21,5 +21,5 @@ void sem_V(struct semaphore *sp){
     acquire(&(sp->chan));
     sp->value++;
     release(&(sp->chan));
-    wakeup(&(sp->chan));
+    wakeup_one(&(sp->chan)); // one unit, one sleeper
 }
\ No newline at end of file
@@ -23,6 +23,8 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
+  if(pagein(addr, 4, 0) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -41,6 +43,9 @@ fetchstr(uint addr, char **pp)
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    // Page in each page of the string before looking at it.
+    if((s == *pp || (uint)s % PGSIZE == 0) && pagein((uint)s, 1, 0) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -67,10 +72,23 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
     return -1;
+  if(pagein(i, size, 0) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Like argptr, for a buffer the kernel is going to write: also
+// gives the process its own copy of any copy-on-write page in it,
+// so that writing it can't fault.
+int
+argout(int n, char **pp, int size)
+{
+  if(argptr(n, pp, size) < 0 || pagein((uint)*pp, size, 1) < 0)
+    return -1;
+  return 0;
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -114,6 +132,11 @@ extern int sys_sigsetmask(void);
 extern int sys_sigpause(void);
 extern int sys_predict_cpu(void);
 extern int sys_sleeptick(void);
+extern int sys_schedctl(void);
+extern int sys_nswtch(void);
+extern int sys_getloadavg(void);
+extern int sys_memstat(void);
+extern int sys_iostat(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]          sys_fork,
@@ -145,7 +168,12 @@ static int (*syscalls[])(void) = {
 [SYS_sigsetmask]    sys_sigsetmask,
 [SYS_sigpause]      sys_sigpause,
 [SYS_predict_cpu]   sys_predict_cpu,
-[SYS_sleeptick]     sys_sleeptick
+[SYS_sleeptick]     sys_sleeptick,
+[SYS_schedctl]      sys_schedctl,
+[SYS_nswtch]        sys_nswtch,
+[SYS_getloadavg]    sys_getloadavg,
+[SYS_memstat]       sys_memstat,
+[SYS_iostat]        sys_iostat
 };
 
 void
@@ -28,4 +28,9 @@
 #define SYS_sigsetmask      27      
 #define SYS_sigpause        28
 #define SYS_predict_cpu     29
-#define SYS_sleeptick       30 // step 5 hw3 (sleep(int) alrdy exists?)
\ No newline at end of file
+#define SYS_sleeptick       30 // step 5 hw3 (sleep(int) alrdy exists?)
+#define SYS_schedctl        31
+#define SYS_nswtch          32
+#define SYS_getloadavg      33
+#define SYS_memstat         34
+#define SYS_iostat          35
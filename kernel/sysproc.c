@@ -8,6 +8,9 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "proc.h"
+#include "sched.h"
+#include "memstat.h"
+#include "iostat.h"
 
 int
 sys_fork(void)
@@ -26,7 +29,7 @@ int
 sys_wait(void)
 {
   struct ptimes *times;
-  if(argptr(0, (void*)&times, sizeof(struct ptimes))<0){
+  if(argout(0, (void*)&times, sizeof(struct ptimes))<0){
     return -2;
   }
   return wait(times);
@@ -123,7 +126,8 @@ int sys_siggetmask(){
 
 int sys_sigsetmask(){
   int *maskp;
-  argptr(0, (char**)&(maskp), sizeof(*maskp));
+  if(argout(0, (char**)&(maskp), sizeof(*maskp))<0)
+    return -1;
   return sigsetmask(maskp);
 }
 
@@ -142,4 +146,52 @@ int sys_sleeptick(){ // step 5 hw3 (sleep(int) alrdy exists?)
   // int sleeptick;
   // argint(0, &sleeptick);
   return sys_sleep();
-}
\ No newline at end of file
+}
+
+int sys_schedctl(){
+  struct schedparam *sp;
+  if(argout(0, (char**)&sp, sizeof(*sp))<0){
+    return -1;
+  }
+  return schedctl(sp);
+}
+
+// return how many context switches all CPUs have made since boot.
+int sys_nswtch(){
+  return nswtch();
+}
+
+// copy the 1, 5 and 15 second load averages, in hundredths, to avg[3].
+int sys_getloadavg(){
+  int *avg;
+  if(argout(0, (char**)&avg, 3*sizeof(int))<0)
+    return -1;
+  getloadavg(avg);
+  return 0;
+}
+
+// report physical memory use, system wide and of process pid (0 for self).
+int sys_memstat(){
+  int pid;
+  struct memstat *ms;
+  if(argint(0, &pid)<0 || argout(1, (char**)&ms, sizeof(*ms))<0){
+    return -1;
+  }
+  return memstat(pid, ms);
+}
+
+// report the request queue statistics of the IDE channel disk dev is on.
+int sys_iostat(){
+  int dev;
+  struct iostat *st;
+  if(argint(0, &dev)<0 || argout(1, (char**)&st, sizeof(*st))<0){
+    return -1;
+  }
+  if(dev<0 || dev>=4)
+    return -1;
+  if(dev<2)
+    idestat(st);
+  else
+    ide2stat(st);
+  return 0;
+}
@@ -57,6 +57,10 @@ trap(struct trapframe *tf)
             continue;
           }else{
             // create signal stackframe on user stack
+            if(pagein(myproc()->tf->esp-sizeof(struct trapframe)-8, sizeof(struct trapframe)+8, 1)<0){
+              myproc()->killed=1; // no room for it
+              break;
+            }
             // 1) save current trapframe on user stack
             struct trapframe currtf=*(myproc()->tf);
             myproc()->tf->esp-=sizeof(struct trapframe);
@@ -90,17 +94,15 @@ trap(struct trapframe *tf)
     return;
   }
   switch(tf->trapno){
-    case T_PGFLT:
-      pgfaultintr();
-      lapiceoi();
-      break;
     case T_IRQ0 + IRQ_TIMER:
       if(cpuid() == 0){
         acquire(&tickslock);
         ticks++;
         wakeup(&ticks);
         release(&tickslock);
+        schedtick();
       }
+      balance();
       lapiceoi();
       break;
     case T_IRQ0 + IRQ_IDE:
@@ -113,6 +115,11 @@ trap(struct trapframe *tf)
       ide2intr();
       lapiceoi();
       break;
+    case T_IRQ0 + IRQ_RESCHED:
+      // Another CPU queued work for us while we were halted in
+      // idle(); returning to the idle loop is enough to run it.
+      lapiceoi();
+      break;
     case T_IRQ0 + IRQ_KBD:
       kbdintr();
       lapiceoi();
@@ -134,6 +141,18 @@ trap(struct trapframe *tf)
       break;
 
     //PAGEBREAK: 13
+    case T_PGFLT:
+      if(pgfaultintr(tf) == 0)
+        break;
+      if((tf->cs&3) == 0){
+        // The kernel pages in user memory before touching it
+        // (see pagein), so this is a kernel bug.
+        cprintf("kernel page fault cpu %d eip %x (cr2=0x%x)\n",
+                cpuid(), tf->eip, rcr2());
+        panic("trap: page fault");
+      }
+      // Not a copy-on-write fault: a real one.
+      // fall through
     default:
       if(myproc() == 0 || (tf->cs&3) == 0){
         // In kernel, it must be our mistake.
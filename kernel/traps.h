@@ -36,6 +36,7 @@
 #define IRQ_IDE         14
 #define IRQ_IDE2        15  // hw 4 exer 1
 #define IRQ_ERROR       19
+#define IRQ_RESCHED     20  // IPI: work was queued for an idle CPU
 #define IRQ_SPURIOUS    31  // Was in original xv6, not observed
 #define IRQ_SPURIOUS1   87  // Bochs produces this on first pushf
 
@@ -12,8 +12,6 @@
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
 
-extern unsigned int pgrefcounter[];
-extern struct spinlock pgreflock;
 extern uint allocpages;
 
 // Set up CPU's kernel segment descriptors.
@@ -55,14 +53,13 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde)); // pgtab points to base/start of fresh Ptable
   } else { // Pdirectory entry is not present
     // Allocates a Ptable
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0){
+    // Comes zeroed, so all those PTE_P bits are zero.
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0){
       // !alloc is just to set mode where if we should be allocating or not
       // alloc=0 means do not allocate
       return 0;
     }
-    // Make sure all those PTE_P bits are zero.
     // pgtab is pointer to the new Ptable
-    memset(pgtab, 0, PGSIZE); // Set all values of fresh Ptable to 0
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -137,7 +134,37 @@ static struct kmap {
 };
 // *virt,           phys_start,    phys_end,  perm
 
+// Map kmap[] region k into pgdir, using a 4MB page (PTE_PS) for
+// every 4MB-aligned stretch of it and 4KB pages for the rest.
+static int
+mapkregion(pde_t *pgdir, struct kmap *k)
+{
+  uint va, pa, size;
+
+  va = (uint)k->virt;
+  pa = k->phys_start;
+  size = k->phys_end - k->phys_start; // DEVSPACE wraps, still right
+  while(size > 0){
+    if(va % LPGSIZE == 0 && pa % LPGSIZE == 0 && size >= LPGSIZE){
+      pgdir[PDX(va)] = pa | k->perm | PTE_P | PTE_PS;
+      va += LPGSIZE;
+      pa += LPGSIZE;
+      size -= LPGSIZE;
+    }else{
+      if(mappages(pgdir, (void*)va, PGSIZE, pa, k->perm) < 0)
+        return -1;
+      va += PGSIZE;
+      pa += PGSIZE;
+      size -= PGSIZE;
+    }
+  }
+  return 0;
+}
+
 // Set up kernel part of a page table.
+// kpgdir is built from kmap[] once, at boot; every other page
+// table just copies its kernel page directory entries, so all of
+// them share the kernel's page table and 4MB pages (see freevm).
 pde_t*
 setupkvm(void)
 {
@@ -145,17 +172,21 @@ setupkvm(void)
   struct kmap *k;
 
   // Attempt to allocate 4KB; meant to be start of Pd
-  if((pgdir = (pde_t*)kalloc()) == 0){
+  // Comes with all Pt entries set to 0
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0){
     return 0;
   }
-  memset(pgdir, 0, PGSIZE); // Set all Pt entries to 0
   if (P2V(PHYSTOP) > (void*)DEVSPACE){
     panic("PHYSTOP too high");
   }
+  if(kpgdir){
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+            (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+    return pgdir;
+  }
   // For each obj in kmap[], attempt to map in all instance
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
+    if(mapkregion(pgdir, k) < 0) {
       freevm(pgdir);
       return 0;
     }
@@ -218,6 +249,9 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   memset(mem, 0, PGSIZE); // Zero out page
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U); // mem VA to PA
   memmove(mem, init, sz);
+  // Counted like any other user page, since fork() shares it
+  chgpgrefc(mem, 1);
+  allocpages++;
 }
 
 // Load a program segment into pgdir.  addr must be page-aligned
@@ -259,7 +293,7 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     // cprintf("allocuvm: increment allocp\n");
     allocpages++;
     if(mem == 0){
@@ -267,7 +301,6 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -301,34 +334,20 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
     }
     else if((*pte & PTE_P) != 0){
-      char originkern=0;
-      // Ptentry exists and is not present for this Pd
-      if(getpgrefc(P2V((void*)(*pte)))){
-        // Decrement if its still >0
-        // Else it will be removed 
-        // (edge case for when refcount already 0)
-        chgpgrefc(P2V((void*)(*pte)), -1);
-      }else{
-        // somehow pgref is already 0 but we're here
-        // must be case it was creating for initboot or 
-        // kernel bootup use(??) do not decre allocpages
-        // when case comes to show
-        originkern=1;
+      pa = PTE_ADDR(*pte); // get pa (PPN) of Pte
+      if(pa == 0){
+        panic("kfree");
       }
-      if(getpgrefc(P2V((void*)(*pte)))==0){
-        pa = PTE_ADDR(*pte); // get pa (PPN) of Pte
-        // cprintf("deallocuvm: deallocing pte ppn %d\n", pa>>12);
-        if(pa == 0){
-          panic("kfree");
-        }
-        char *v = P2V(pa); // Convert pa PPN into va for kern
-        kfree(v); // Free that 4KB pointed by PPN
-        if(!originkern){
-          allocpages--;
-          // cprintf("deallocuvm: decrement allocp\n");
-        }
-        *pte = 0;
+      char *v = P2V(pa); // Convert pa PPN into va for kern
+      // Free the 4KB once the last page table mapping it lets go;
+      // an uncounted page was never shared (kernel bootup use)
+      if(getpgrefc(v)==0){
+        kfree(v);
+      }else if(chgpgrefc(v, -1)==0){
+        kfree(v);
+        allocpages--;
       }
+      *pte = 0;
     }
   }
   return newsz;
@@ -345,8 +364,9 @@ freevm(pde_t *pgdir)
     panic("freevm: no pgdir");
   }
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
-    // For every Pd entry, free the contents (the whole Pt)
+  // The kernel half belongs to kpgdir (see setupkvm)
+  for(i = 0; i < PDX(KERNBASE); i++){
+    // For every user Pd entry, free the contents (the whole Pt)
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -398,7 +418,7 @@ copyuvm(pde_t *pgdir, uint sz, char deep)
       }
       // pte is virtual, accessing pte is the physical address
       pa = PTE_ADDR(*pte); // physical address, PPN of Ptentry
-      flags = PTE_FLAGS(*pte) | PTE_W; // perms of entry
+      flags = (PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW; // perms of entry
       if((mem = kalloc()) == 0){
         // Attempt to allocate 4KB of memory for pointed data
         // that's being pointed by pa (Ptable's PPN)
@@ -428,20 +448,33 @@ copyuvm(pde_t *pgdir, uint sz, char deep)
       // }
     }
   }else{
-    // Reference copy
-    d=pgdir;
-    for(int i=0; i<sz; i+=PGSIZE){
+    // Copy-on-write: the child gets its own page tables mapping
+    // the parent's pages, and writable user pages turn read-only
+    // in both until one side writes (see pgfaultintr).
+    if((d = setupkvm()) == 0)
+      return 0;
+    for(i = 0; i < sz; i += PGSIZE){
+      // Pages not paged in yet will be paged in by the child too
       if((pte=walkpgdir(pgdir, (void*)i, 0))==0){
-        panic("copyuvm: lite, pte should exist");
+        i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+        continue;
       }
       if(!(*pte&PTE_P)){
-        panic("copuvm: lite page not present");
+        continue;
+      }
+      if((*pte&(PTE_W|PTE_U))==(PTE_W|PTE_U)){
+        *pte=(*pte&~PTE_W)|PTE_COW;
       }
       pa=PTE_ADDR(*pte);
-      *pte&=~PTE_W;
-      chgpgrefc(P2V(pa), 1);
+      if(mappages(d, (void*)i, PGSIZE, pa, PTE_FLAGS(*pte)) < 0){
+        goto bad;
+      }
+      if(chgpgrefc(P2V(pa), 1)==1){ // wasn't counted, count both users
+        chgpgrefc(P2V(pa), 1);
+        allocpages++;
+      }
     }
-    lcr3(V2P(pgdir));
+    lcr3(V2P(pgdir)); // flush the parent's now read-only TLB entries
   }
   return d;
 
@@ -491,20 +524,145 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
-void pgfaultintr(){
-  // cprintf("pgfault start\n");
+// Page in the page at user address a of p.  If it lies in one of
+// p->seg, read it in from p->exe, sharing whole pages of the file
+// through the page cache; otherwise it is heap that sbrk()
+// handed out without allocating, and starts out zero.
+// Returns -1 if out of memory or the executable can't be read.
+static int
+loadpage(struct proc *p, uint a)
+{
+  struct execseg *s;
+  char *mem;
+  uint n;
+
+  for(s = p->seg; s < &p->seg[p->nseg]; s++)
+    if(a >= s->va && a < s->va + s->memsz)
+      break;
+  n = 0;
+  if(s < &p->seg[p->nseg] && a - s->va < s->filesz)
+    n = s->filesz - (a - s->va);
+  if(n > PGSIZE)
+    n = PGSIZE;
+  if(n == PGSIZE){
+    // A whole page of the file: share the page cache's frame,
+    // copy-on-write in case the segment is writable.
+    ilock(p->exe);
+    mem = pcacheget(p->exe, s->off + (a - s->va));
+    iunlock(p->exe);
+    if(mem == 0)
+      return -1;
+    if(mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_U|PTE_COW) < 0){
+      if(chgpgrefc(mem, -1) == 0){
+        kfree(mem);
+        allocpages--;
+      }
+      return -1;
+    }
+    return 0;
+  }
+  if((mem = kalloc_zeroed()) == 0)
+    return -1;
+  if(n > 0){
+    ilock(p->exe);
+    if(readi(p->exe, mem, s->off + (a - s->va), n) != n){
+      iunlock(p->exe);
+      kfree(mem);
+      return -1;
+    }
+    iunlock(p->exe);
+  }
+  if(mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  chgpgrefc(mem, 1);
+  allocpages++;
+  return 0;
+}
+
+// Give p its own writable copy of the copy-on-write page pte
+// maps, or the page itself if nobody else maps it any more.
+// Returns -1 if out of memory.
+static int
+cowpage(struct proc *p, pte_t *pte)
+{
+  uint pa;
+  char *mem;
+
+  pa=PTE_ADDR(*pte);
+  if(getpgrefc(P2V(pa))>1){
+    if((mem=kalloc())==0){
+      cprintf("cowpage: out of memory\n");
+      return -1;
+    }
+    memmove(mem, P2V(pa), PGSIZE);
+    chgpgrefc(mem, 1);
+    allocpages++;
+    *pte=V2P(mem)|PTE_FLAGS(*pte);
+    // The other sharers may have let go since the check above
+    if(chgpgrefc(P2V(pa), -1)==0){
+      kfree(P2V(pa));
+      allocpages--;
+    }
+  }
+  *pte=(*pte|PTE_W)&~PTE_COW;
+  lcr3(V2P(p->pgdir));
+  return 0;
+}
+
+// Make sure user addresses [va, va+n) of the current process are
+// paged in, and if write is set, not copy-on-write.  The kernel
+// calls it (see argptr, argout, fetchint) before every access to
+// user memory, so that it never takes a fault there: one that
+// failed would have nowhere to go, and paging in can't sleep
+// under a spinlock.
+// Returns -1 if the range isn't the process's or some page can't
+// be paged in.
+int
+pagein(uint va, uint n, int write)
+{
   struct proc *p=myproc();
-  if(p==0){
-    panic("pgfaultintr no proc on cpu");
+  pte_t *pte;
+  uint a;
+
+  if(va >= p->sz || va+n > p->sz || va+n < va)
+    return -1;
+  for(a = PGROUNDDOWN(va); a < va + n; a += PGSIZE){
+    pte = walkpgdir(p->pgdir, (void*)a, 0);
+    if((pte == 0 || !(*pte&PTE_P)) && loadpage(p, a) < 0)
+      return -1;
+    if(write && (pte = walkpgdir(p->pgdir, (void*)a, 0)) != 0 &&
+       (*pte&PTE_COW) && cowpage(p, pte) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Handle a page fault on a user page that exec() or sbrk() left to
+// demand paging, or on a copy-on-write page by giving the faulting process
+// its own copy of just that page, or the page itself if nobody else
+// maps it any more.
+// Returns -1 if the fault was neither, or can't be handled.
+int
+pgfaultintr(struct trapframe *tf)
+{
+  struct proc *p=myproc();
+  pte_t *pte;
+  uint va;
+
+  va=rcr2();
+  if(p==0 || va>=p->sz){
+    return -1;
+  }
+  pte=walkpgdir(p->pgdir, (void*)va, 0);
+  if(pte==0 || !(*pte&PTE_P)){
+    return loadpage(p, PGROUNDDOWN(va));
   }
-  // Only purpose of pgfault is to mem clone entire pgdir
-  pde_t *oldpgdir=p->pgdir;
-  if((p->pgdir=copyuvm(p->pgdir, p->sz, 1))==0){
-    p->pgdir=oldpgdir;
-    cprintf("failed to mem clone pgdir");
+  if(!(tf->err&FEC_WR) || !(*pte&PTE_COW)){
+    return -1;
   }
-  deallocuvm(oldpgdir, KERNBASE, 0);
-  // cprintf("pgfault end\n");
+  return cowpage(p, pte);
 }
 
 //PAGEBREAK!
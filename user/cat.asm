@@ -0,0 +1,1211 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n;
+  printf(1, "debug: starting to cat read\n");
+   8:	83 ec 08             	sub    $0x8,%esp
+   b:	68 7c 07 00 00       	push   $0x77c
+  10:	6a 01                	push   $0x1
+  12:	e8 6d 04 00 00       	call   484 <printf>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  17:	83 c4 10             	add    $0x10,%esp
+  1a:	83 ec 04             	sub    $0x4,%esp
+  1d:	68 00 02 00 00       	push   $0x200
+  22:	68 00 0b 00 00       	push   $0xb00
+  27:	56                   	push   %esi
+  28:	e8 c7 02 00 00       	call   2f4 <read>
+  2d:	89 c3                	mov    %eax,%ebx
+  2f:	83 c4 10             	add    $0x10,%esp
+  32:	85 c0                	test   %eax,%eax
+  34:	7e 3a                	jle    70 <cat+0x70>
+    // keep reading until EOF
+    printf(1, "debug: cat reading\n");
+  36:	83 ec 08             	sub    $0x8,%esp
+  39:	68 99 07 00 00       	push   $0x799
+  3e:	6a 01                	push   $0x1
+  40:	e8 3f 04 00 00       	call   484 <printf>
+    if (write(1, buf, n) != n) {
+  45:	83 c4 0c             	add    $0xc,%esp
+  48:	53                   	push   %ebx
+  49:	68 00 0b 00 00       	push   $0xb00
+  4e:	6a 01                	push   $0x1
+  50:	e8 a7 02 00 00       	call   2fc <write>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	39 d8                	cmp    %ebx,%eax
+  5a:	74 be                	je     1a <cat+0x1a>
+      printf(1, "cat: write error\n");
+  5c:	83 ec 08             	sub    $0x8,%esp
+  5f:	68 ad 07 00 00       	push   $0x7ad
+  64:	6a 01                	push   $0x1
+  66:	e8 19 04 00 00       	call   484 <printf>
+      exit();
+  6b:	e8 6c 02 00 00       	call   2dc <exit>
+    }
+  }
+  if(n < 0){
+  70:	78 07                	js     79 <cat+0x79>
+    printf(1, "cat: read error\n");
+    exit();
+  }
+}
+  72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  75:	5b                   	pop    %ebx
+  76:	5e                   	pop    %esi
+  77:	5d                   	pop    %ebp
+  78:	c3                   	ret
+    printf(1, "cat: read error\n");
+  79:	83 ec 08             	sub    $0x8,%esp
+  7c:	68 bf 07 00 00       	push   $0x7bf
+  81:	6a 01                	push   $0x1
+  83:	e8 fc 03 00 00       	call   484 <printf>
+    exit();
+  88:	e8 4f 02 00 00       	call   2dc <exit>
+
+0000008d <main>:
+
+int
+main(int argc, char *argv[])
+{
+  8d:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  91:	83 e4 f0             	and    $0xfffffff0,%esp
+  94:	ff 71 fc             	push   -0x4(%ecx)
+  97:	55                   	push   %ebp
+  98:	89 e5                	mov    %esp,%ebp
+  9a:	57                   	push   %edi
+  9b:	56                   	push   %esi
+  9c:	53                   	push   %ebx
+  9d:	51                   	push   %ecx
+  9e:	83 ec 18             	sub    $0x18,%esp
+  a1:	8b 01                	mov    (%ecx),%eax
+  a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  a6:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, i;
+
+  if(argc <= 1){
+  a9:	83 c6 04             	add    $0x4,%esi
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  ac:	bf 01 00 00 00       	mov    $0x1,%edi
+  if(argc <= 1){
+  b1:	83 f8 01             	cmp    $0x1,%eax
+  b4:	7e 39                	jle    ef <main+0x62>
+    if((fd = open(argv[i], 0)) < 0){
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	6a 00                	push   $0x0
+  bb:	ff 36                	push   (%esi)
+  bd:	e8 5a 02 00 00       	call   31c <open>
+  c2:	89 c3                	mov    %eax,%ebx
+  c4:	83 c4 10             	add    $0x10,%esp
+  c7:	85 c0                	test   %eax,%eax
+  c9:	78 33                	js     fe <main+0x71>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  cb:	83 ec 0c             	sub    $0xc,%esp
+  ce:	50                   	push   %eax
+  cf:	e8 2c ff ff ff       	call   0 <cat>
+    close(fd);
+  d4:	89 1c 24             	mov    %ebx,(%esp)
+  d7:	e8 28 02 00 00       	call   304 <close>
+  for(i = 1; i < argc; i++){
+  dc:	83 c7 01             	add    $0x1,%edi
+  df:	83 c6 04             	add    $0x4,%esi
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  e8:	75 cc                	jne    b6 <main+0x29>
+  }
+  exit();
+  ea:	e8 ed 01 00 00       	call   2dc <exit>
+    cat(0);
+  ef:	83 ec 0c             	sub    $0xc,%esp
+  f2:	6a 00                	push   $0x0
+  f4:	e8 07 ff ff ff       	call   0 <cat>
+    exit();
+  f9:	e8 de 01 00 00       	call   2dc <exit>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  fe:	83 ec 04             	sub    $0x4,%esp
+ 101:	ff 36                	push   (%esi)
+ 103:	68 d0 07 00 00       	push   $0x7d0
+ 108:	6a 01                	push   $0x1
+ 10a:	e8 75 03 00 00       	call   484 <printf>
+      exit();
+ 10f:	e8 c8 01 00 00       	call   2dc <exit>
+
+00000114 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 114:	55                   	push   %ebp
+ 115:	89 e5                	mov    %esp,%ebp
+ 117:	53                   	push   %ebx
+ 118:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 11b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 11e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 123:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 127:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 12a:	83 c0 01             	add    $0x1,%eax
+ 12d:	84 d2                	test   %dl,%dl
+ 12f:	75 f2                	jne    123 <strcpy+0xf>
+    ;
+  return os;
+}
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 136:	c9                   	leave
+ 137:	c3                   	ret
+
+00000138 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 138:	55                   	push   %ebp
+ 139:	89 e5                	mov    %esp,%ebp
+ 13b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 141:	0f b6 01             	movzbl (%ecx),%eax
+ 144:	84 c0                	test   %al,%al
+ 146:	74 11                	je     159 <strcmp+0x21>
+ 148:	38 02                	cmp    %al,(%edx)
+ 14a:	75 0d                	jne    159 <strcmp+0x21>
+    p++, q++;
+ 14c:	83 c1 01             	add    $0x1,%ecx
+ 14f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 152:	0f b6 01             	movzbl (%ecx),%eax
+ 155:	84 c0                	test   %al,%al
+ 157:	75 ef                	jne    148 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 159:	0f b6 c0             	movzbl %al,%eax
+ 15c:	0f b6 12             	movzbl (%edx),%edx
+ 15f:	29 d0                	sub    %edx,%eax
+}
+ 161:	5d                   	pop    %ebp
+ 162:	c3                   	ret
+
+00000163 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 163:	55                   	push   %ebp
+ 164:	89 e5                	mov    %esp,%ebp
+ 166:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 169:	80 3a 00             	cmpb   $0x0,(%edx)
+ 16c:	74 14                	je     182 <strlen+0x1f>
+ 16e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 173:	83 c0 01             	add    $0x1,%eax
+ 176:	89 c1                	mov    %eax,%ecx
+ 178:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 17c:	75 f5                	jne    173 <strlen+0x10>
+    ;
+  return n;
+}
+ 17e:	89 c8                	mov    %ecx,%eax
+ 180:	5d                   	pop    %ebp
+ 181:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 182:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 187:	eb f5                	jmp    17e <strlen+0x1b>
+
+00000189 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 189:	55                   	push   %ebp
+ 18a:	89 e5                	mov    %esp,%ebp
+ 18c:	57                   	push   %edi
+ 18d:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 190:	89 d7                	mov    %edx,%edi
+ 192:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 195:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 198:	fc                   	cld
+ 199:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 19b:	89 d0                	mov    %edx,%eax
+ 19d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1a0:	c9                   	leave
+ 1a1:	c3                   	ret
+
+000001a2 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a2:	55                   	push   %ebp
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ac:	0f b6 10             	movzbl (%eax),%edx
+ 1af:	84 d2                	test   %dl,%dl
+ 1b1:	74 15                	je     1c8 <strchr+0x26>
+    if(*s == c)
+ 1b3:	38 d1                	cmp    %dl,%cl
+ 1b5:	74 0f                	je     1c6 <strchr+0x24>
+  for(; *s; s++)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	0f b6 10             	movzbl (%eax),%edx
+ 1bd:	84 d2                	test   %dl,%dl
+ 1bf:	75 f2                	jne    1b3 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1c6:	5d                   	pop    %ebp
+ 1c7:	c3                   	ret
+  return 0;
+ 1c8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1cd:	eb f7                	jmp    1c6 <strchr+0x24>
+
+000001cf <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	57                   	push   %edi
+ 1d3:	56                   	push   %esi
+ 1d4:	53                   	push   %ebx
+ 1d5:	83 ec 2c             	sub    $0x2c,%esp
+ 1d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1db:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1e0:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1e3:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1e6:	83 c3 01             	add    $0x1,%ebx
+ 1e9:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ec:	7d 27                	jge    215 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1ee:	83 ec 04             	sub    $0x4,%esp
+ 1f1:	6a 01                	push   $0x1
+ 1f3:	57                   	push   %edi
+ 1f4:	6a 00                	push   $0x0
+ 1f6:	e8 f9 00 00 00       	call   2f4 <read>
+    if(cc < 1)
+ 1fb:	83 c4 10             	add    $0x10,%esp
+ 1fe:	85 c0                	test   %eax,%eax
+ 200:	7e 13                	jle    215 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 202:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 206:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20a:	3c 0a                	cmp    $0xa,%al
+ 20c:	74 04                	je     212 <gets+0x43>
+ 20e:	3c 0d                	cmp    $0xd,%al
+ 210:	75 d1                	jne    1e3 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 212:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 215:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 218:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 21c:	89 f0                	mov    %esi,%eax
+ 21e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 221:	5b                   	pop    %ebx
+ 222:	5e                   	pop    %esi
+ 223:	5f                   	pop    %edi
+ 224:	5d                   	pop    %ebp
+ 225:	c3                   	ret
+
+00000226 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 226:	55                   	push   %ebp
+ 227:	89 e5                	mov    %esp,%ebp
+ 229:	56                   	push   %esi
+ 22a:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 22b:	83 ec 08             	sub    $0x8,%esp
+ 22e:	6a 00                	push   $0x0
+ 230:	ff 75 08             	push   0x8(%ebp)
+ 233:	e8 e4 00 00 00       	call   31c <open>
+  if(fd < 0)
+ 238:	83 c4 10             	add    $0x10,%esp
+ 23b:	85 c0                	test   %eax,%eax
+ 23d:	78 24                	js     263 <stat+0x3d>
+ 23f:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 241:	83 ec 08             	sub    $0x8,%esp
+ 244:	ff 75 0c             	push   0xc(%ebp)
+ 247:	50                   	push   %eax
+ 248:	e8 e7 00 00 00       	call   334 <fstat>
+ 24d:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 24f:	89 1c 24             	mov    %ebx,(%esp)
+ 252:	e8 ad 00 00 00       	call   304 <close>
+  return r;
+ 257:	83 c4 10             	add    $0x10,%esp
+}
+ 25a:	89 f0                	mov    %esi,%eax
+ 25c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 25f:	5b                   	pop    %ebx
+ 260:	5e                   	pop    %esi
+ 261:	5d                   	pop    %ebp
+ 262:	c3                   	ret
+    return -1;
+ 263:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 268:	eb f0                	jmp    25a <stat+0x34>
+
+0000026a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 26a:	55                   	push   %ebp
+ 26b:	89 e5                	mov    %esp,%ebp
+ 26d:	53                   	push   %ebx
+ 26e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 271:	0f b6 02             	movzbl (%edx),%eax
+ 274:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 277:	80 f9 09             	cmp    $0x9,%cl
+ 27a:	77 24                	ja     2a0 <atoi+0x36>
+  n = 0;
+ 27c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 281:	83 c2 01             	add    $0x1,%edx
+ 284:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 287:	0f be c0             	movsbl %al,%eax
+ 28a:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 28e:	0f b6 02             	movzbl (%edx),%eax
+ 291:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 294:	80 fb 09             	cmp    $0x9,%bl
+ 297:	76 e8                	jbe    281 <atoi+0x17>
+  return n;
+}
+ 299:	89 c8                	mov    %ecx,%eax
+ 29b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29e:	c9                   	leave
+ 29f:	c3                   	ret
+  n = 0;
+ 2a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2a5:	eb f2                	jmp    299 <atoi+0x2f>
+
+000002a7 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2a7:	55                   	push   %ebp
+ 2a8:	89 e5                	mov    %esp,%ebp
+ 2aa:	56                   	push   %esi
+ 2ab:	53                   	push   %ebx
+ 2ac:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2af:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2b5:	85 db                	test   %ebx,%ebx
+ 2b7:	7e 15                	jle    2ce <memmove+0x27>
+ 2b9:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2bb:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2bd:	83 c2 01             	add    $0x1,%edx
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2c7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2ca:	39 c3                	cmp    %eax,%ebx
+ 2cc:	75 ef                	jne    2bd <memmove+0x16>
+  return vdst;
+}
+ 2ce:	89 f0                	mov    %esi,%eax
+ 2d0:	5b                   	pop    %ebx
+ 2d1:	5e                   	pop    %esi
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+
+000002d4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2d4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <exit>:
+SYSCALL(exit)
+ 2dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <wait>:
+SYSCALL(wait)
+ 2e4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <pipe>:
+SYSCALL(pipe)
+ 2ec:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <read>:
+SYSCALL(read)
+ 2f4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <write>:
+SYSCALL(write)
+ 2fc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <close>:
+SYSCALL(close)
+ 304:	b8 15 00 00 00       	mov    $0x15,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <kill>:
+SYSCALL(kill)
+ 30c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <exec>:
+SYSCALL(exec)
+ 314:	b8 07 00 00 00       	mov    $0x7,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <open>:
+SYSCALL(open)
+ 31c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <mknod>:
+SYSCALL(mknod)
+ 324:	b8 11 00 00 00       	mov    $0x11,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <unlink>:
+SYSCALL(unlink)
+ 32c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <fstat>:
+SYSCALL(fstat)
+ 334:	b8 08 00 00 00       	mov    $0x8,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <link>:
+SYSCALL(link)
+ 33c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <mkdir>:
+SYSCALL(mkdir)
+ 344:	b8 14 00 00 00       	mov    $0x14,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <chdir>:
+SYSCALL(chdir)
+ 34c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <dup>:
+SYSCALL(dup)
+ 354:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <getpid>:
+SYSCALL(getpid)
+ 35c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <sbrk>:
+SYSCALL(sbrk)
+ 364:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <sleep>:
+SYSCALL(sleep)
+ 36c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <uptime>:
+SYSCALL(uptime)
+ 374:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <readmouse>:
+SYSCALL(readmouse)
+ 37c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <sigsend>:
+SYSCALL(sigsend)
+ 384:	b8 17 00 00 00       	mov    $0x17,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <sigsethandler>:
+SYSCALL(sigsethandler)
+ 38c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <sigreturn>:
+SYSCALL(sigreturn)
+ 394:	b8 19 00 00 00       	mov    $0x19,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <siggetmask>:
+SYSCALL(siggetmask)
+ 39c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 3a4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <sigpause>:
+SYSCALL(sigpause)
+ 3ac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 3b4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <sleeptick>:
+SYSCALL(sleeptick)
+ 3bc:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <schedctl>:
+SYSCALL(schedctl)
+ 3c4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <nswtch>:
+SYSCALL(nswtch)
+ 3cc:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <getloadavg>:
+SYSCALL(getloadavg)
+ 3d4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <memstat>:
+SYSCALL(memstat)
+ 3dc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <iostat>:
+SYSCALL(iostat)
+ 3e4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3ec:	55                   	push   %ebp
+ 3ed:	89 e5                	mov    %esp,%ebp
+ 3ef:	57                   	push   %edi
+ 3f0:	56                   	push   %esi
+ 3f1:	53                   	push   %ebx
+ 3f2:	83 ec 3c             	sub    $0x3c,%esp
+ 3f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3f8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3fa:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3fe:	74 79                	je     479 <printint+0x8d>
+ 400:	85 d2                	test   %edx,%edx
+ 402:	79 75                	jns    479 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 404:	89 d1                	mov    %edx,%ecx
+ 406:	f7 d9                	neg    %ecx
+    neg = 1;
+ 408:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 40f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 414:	89 df                	mov    %ebx,%edi
+ 416:	83 c3 01             	add    $0x1,%ebx
+ 419:	89 c8                	mov    %ecx,%eax
+ 41b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 420:	f7 f6                	div    %esi
+ 422:	0f b6 92 44 08 00 00 	movzbl 0x844(%edx),%edx
+ 429:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 42d:	89 ca                	mov    %ecx,%edx
+ 42f:	89 c1                	mov    %eax,%ecx
+ 431:	39 f2                	cmp    %esi,%edx
+ 433:	73 df                	jae    414 <printint+0x28>
+  if(neg)
+ 435:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 439:	74 08                	je     443 <printint+0x57>
+    buf[i++] = '-';
+ 43b:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 440:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 443:	85 db                	test   %ebx,%ebx
+ 445:	7e 2a                	jle    471 <printint+0x85>
+ 447:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 44a:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 44e:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 451:	0f b6 03             	movzbl (%ebx),%eax
+ 454:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 457:	83 ec 04             	sub    $0x4,%esp
+ 45a:	6a 01                	push   $0x1
+ 45c:	57                   	push   %edi
+ 45d:	ff 75 c4             	push   -0x3c(%ebp)
+ 460:	e8 97 fe ff ff       	call   2fc <write>
+  while(--i >= 0)
+ 465:	89 d8                	mov    %ebx,%eax
+ 467:	83 eb 01             	sub    $0x1,%ebx
+ 46a:	83 c4 10             	add    $0x10,%esp
+ 46d:	39 f0                	cmp    %esi,%eax
+ 46f:	75 e0                	jne    451 <printint+0x65>
+}
+ 471:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 474:	5b                   	pop    %ebx
+ 475:	5e                   	pop    %esi
+ 476:	5f                   	pop    %edi
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+    x = xx;
+ 479:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 47b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 482:	eb 8b                	jmp    40f <printint+0x23>
+
+00000484 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 484:	55                   	push   %ebp
+ 485:	89 e5                	mov    %esp,%ebp
+ 487:	57                   	push   %edi
+ 488:	56                   	push   %esi
+ 489:	53                   	push   %ebx
+ 48a:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 48d:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 490:	0f b6 1e             	movzbl (%esi),%ebx
+ 493:	84 db                	test   %bl,%bl
+ 495:	0f 84 9e 01 00 00    	je     639 <printf+0x1b5>
+ 49b:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 49e:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4a4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4a9:	eb 2d                	jmp    4d8 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4ae:	83 ec 04             	sub    $0x4,%esp
+ 4b1:	6a 01                	push   $0x1
+ 4b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4b6:	50                   	push   %eax
+ 4b7:	ff 75 08             	push   0x8(%ebp)
+ 4ba:	e8 3d fe ff ff       	call   2fc <write>
+        putc(fd, c);
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	eb 05                	jmp    4c9 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4c4:	83 ff 25             	cmp    $0x25,%edi
+ 4c7:	74 1f                	je     4e8 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4c9:	83 c6 01             	add    $0x1,%esi
+ 4cc:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4d0:	84 db                	test   %bl,%bl
+ 4d2:	0f 84 61 01 00 00    	je     639 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4d8:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4db:	85 ff                	test   %edi,%edi
+ 4dd:	75 e5                	jne    4c4 <printf+0x40>
+      if(c == '%'){
+ 4df:	83 f8 25             	cmp    $0x25,%eax
+ 4e2:	75 c7                	jne    4ab <printf+0x27>
+        state = '%';
+ 4e4:	89 c7                	mov    %eax,%edi
+ 4e6:	eb e1                	jmp    4c9 <printf+0x45>
+      if(c == 'd'){
+ 4e8:	83 f8 25             	cmp    $0x25,%eax
+ 4eb:	0f 84 f4 00 00 00    	je     5e5 <printf+0x161>
+ 4f1:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4f4:	83 fa 15             	cmp    $0x15,%edx
+ 4f7:	0f 87 09 01 00 00    	ja     606 <printf+0x182>
+ 4fd:	0f 87 03 01 00 00    	ja     606 <printf+0x182>
+ 503:	ff 24 95 ec 07 00 00 	jmp    *0x7ec(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 50a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 50d:	8b 17                	mov    (%edi),%edx
+ 50f:	83 ec 0c             	sub    $0xc,%esp
+ 512:	6a 01                	push   $0x1
+ 514:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 519:	8b 45 08             	mov    0x8(%ebp),%eax
+ 51c:	e8 cb fe ff ff       	call   3ec <printint>
+        ap++;
+ 521:	83 c7 04             	add    $0x4,%edi
+ 524:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 527:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 52a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 52f:	eb 98                	jmp    4c9 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 531:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 534:	8b 17                	mov    (%edi),%edx
+ 536:	83 ec 0c             	sub    $0xc,%esp
+ 539:	6a 00                	push   $0x0
+ 53b:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 540:	8b 45 08             	mov    0x8(%ebp),%eax
+ 543:	e8 a4 fe ff ff       	call   3ec <printint>
+        ap++;
+ 548:	83 c7 04             	add    $0x4,%edi
+ 54b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 54e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 551:	bf 00 00 00 00       	mov    $0x0,%edi
+ 556:	e9 6e ff ff ff       	jmp    4c9 <printf+0x45>
+        s = (char*)*ap;
+ 55b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 55e:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 560:	83 c1 04             	add    $0x4,%ecx
+ 563:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 566:	85 c0                	test   %eax,%eax
+ 568:	74 13                	je     57d <printf+0xf9>
+        s = (char*)*ap;
+ 56a:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 56c:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 56f:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 574:	84 c0                	test   %al,%al
+ 576:	75 0f                	jne    587 <printf+0x103>
+ 578:	e9 4c ff ff ff       	jmp    4c9 <printf+0x45>
+          s = "(null)";
+ 57d:	bb e5 07 00 00       	mov    $0x7e5,%ebx
+        while(*s != 0){
+ 582:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 587:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 58a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 58d:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 590:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 593:	83 ec 04             	sub    $0x4,%esp
+ 596:	6a 01                	push   $0x1
+ 598:	57                   	push   %edi
+ 599:	56                   	push   %esi
+ 59a:	e8 5d fd ff ff       	call   2fc <write>
+          s++;
+ 59f:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5a2:	0f b6 03             	movzbl (%ebx),%eax
+ 5a5:	83 c4 10             	add    $0x10,%esp
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	75 e4                	jne    590 <printf+0x10c>
+      state = 0;
+ 5ac:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5af:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5b4:	e9 10 ff ff ff       	jmp    4c9 <printf+0x45>
+        putc(fd, *ap);
+ 5b9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5bc:	8b 07                	mov    (%edi),%eax
+ 5be:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5c1:	83 ec 04             	sub    $0x4,%esp
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5c9:	50                   	push   %eax
+ 5ca:	ff 75 08             	push   0x8(%ebp)
+ 5cd:	e8 2a fd ff ff       	call   2fc <write>
+        ap++;
+ 5d2:	83 c7 04             	add    $0x4,%edi
+ 5d5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5db:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e0:	e9 e4 fe ff ff       	jmp    4c9 <printf+0x45>
+        putc(fd, c);
+ 5e5:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e8:	83 ec 04             	sub    $0x4,%esp
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5f0:	50                   	push   %eax
+ 5f1:	ff 75 08             	push   0x8(%ebp)
+ 5f4:	e8 03 fd ff ff       	call   2fc <write>
+ 5f9:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5fc:	bf 00 00 00 00       	mov    $0x0,%edi
+ 601:	e9 c3 fe ff ff       	jmp    4c9 <printf+0x45>
+        putc(fd, '%');
+ 606:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 60a:	83 ec 04             	sub    $0x4,%esp
+ 60d:	6a 01                	push   $0x1
+ 60f:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 612:	57                   	push   %edi
+ 613:	ff 75 08             	push   0x8(%ebp)
+ 616:	e8 e1 fc ff ff       	call   2fc <write>
+        putc(fd, c);
+ 61b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 61e:	83 c4 0c             	add    $0xc,%esp
+ 621:	6a 01                	push   $0x1
+ 623:	57                   	push   %edi
+ 624:	ff 75 08             	push   0x8(%ebp)
+ 627:	e8 d0 fc ff ff       	call   2fc <write>
+        putc(fd, c);
+ 62c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 62f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 634:	e9 90 fe ff ff       	jmp    4c9 <printf+0x45>
+    }
+  }
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+
+00000641 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 641:	55                   	push   %ebp
+ 642:	89 e5                	mov    %esp,%ebp
+ 644:	57                   	push   %edi
+ 645:	56                   	push   %esi
+ 646:	53                   	push   %ebx
+ 647:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 64a:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 64d:	a1 00 0d 00 00       	mov    0xd00,%eax
+ 652:	eb 0c                	jmp    660 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 654:	8b 10                	mov    (%eax),%edx
+ 656:	39 d0                	cmp    %edx,%eax
+ 658:	72 04                	jb     65e <free+0x1d>
+ 65a:	39 d1                	cmp    %edx,%ecx
+ 65c:	72 10                	jb     66e <free+0x2d>
+{
+ 65e:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 660:	39 c8                	cmp    %ecx,%eax
+ 662:	73 f0                	jae    654 <free+0x13>
+ 664:	8b 10                	mov    (%eax),%edx
+ 666:	39 d1                	cmp    %edx,%ecx
+ 668:	72 04                	jb     66e <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 66a:	39 d0                	cmp    %edx,%eax
+ 66c:	72 f0                	jb     65e <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 66e:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 671:	8b 10                	mov    (%eax),%edx
+ 673:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 676:	39 fa                	cmp    %edi,%edx
+ 678:	74 19                	je     693 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 67a:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 67d:	8b 50 04             	mov    0x4(%eax),%edx
+ 680:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 683:	39 f1                	cmp    %esi,%ecx
+ 685:	74 18                	je     69f <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 687:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 689:	a3 00 0d 00 00       	mov    %eax,0xd00
+}
+ 68e:	5b                   	pop    %ebx
+ 68f:	5e                   	pop    %esi
+ 690:	5f                   	pop    %edi
+ 691:	5d                   	pop    %ebp
+ 692:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 693:	03 72 04             	add    0x4(%edx),%esi
+ 696:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 699:	8b 10                	mov    (%eax),%edx
+ 69b:	8b 12                	mov    (%edx),%edx
+ 69d:	eb db                	jmp    67a <free+0x39>
+    p->s.size += bp->s.size;
+ 69f:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6a2:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6a5:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6a8:	eb dd                	jmp    687 <free+0x46>
+
+000006aa <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6aa:	55                   	push   %ebp
+ 6ab:	89 e5                	mov    %esp,%ebp
+ 6ad:	57                   	push   %edi
+ 6ae:	56                   	push   %esi
+ 6af:	53                   	push   %ebx
+ 6b0:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b6:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6b9:	c1 eb 03             	shr    $0x3,%ebx
+ 6bc:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6bf:	8b 15 00 0d 00 00    	mov    0xd00,%edx
+ 6c5:	85 d2                	test   %edx,%edx
+ 6c7:	74 1c                	je     6e5 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c9:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6cb:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6ce:	39 d9                	cmp    %ebx,%ecx
+ 6d0:	73 38                	jae    70a <malloc+0x60>
+  if(nu < 4096)
+ 6d2:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6d7:	39 f3                	cmp    %esi,%ebx
+ 6d9:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6dc:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6e3:	eb 72                	jmp    757 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6e5:	c7 05 00 0d 00 00 04 	movl   $0xd04,0xd00
+ 6ec:	0d 00 00 
+ 6ef:	c7 05 04 0d 00 00 04 	movl   $0xd04,0xd04
+ 6f6:	0d 00 00 
+    base.s.size = 0;
+ 6f9:	c7 05 08 0d 00 00 00 	movl   $0x0,0xd08
+ 700:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 703:	b8 04 0d 00 00       	mov    $0xd04,%eax
+    if(p->s.size >= nunits){
+ 708:	eb c8                	jmp    6d2 <malloc+0x28>
+      if(p->s.size == nunits)
+ 70a:	39 cb                	cmp    %ecx,%ebx
+ 70c:	74 1e                	je     72c <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 70e:	29 d9                	sub    %ebx,%ecx
+ 710:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 713:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 716:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 719:	89 15 00 0d 00 00    	mov    %edx,0xd00
+      return (void*)(p + 1);
+ 71f:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 722:	89 d0                	mov    %edx,%eax
+ 724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 727:	5b                   	pop    %ebx
+ 728:	5e                   	pop    %esi
+ 729:	5f                   	pop    %edi
+ 72a:	5d                   	pop    %ebp
+ 72b:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 72c:	8b 08                	mov    (%eax),%ecx
+ 72e:	89 0a                	mov    %ecx,(%edx)
+ 730:	eb e7                	jmp    719 <malloc+0x6f>
+  hp->s.size = nu;
+ 732:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 735:	83 ec 0c             	sub    $0xc,%esp
+ 738:	83 c0 08             	add    $0x8,%eax
+ 73b:	50                   	push   %eax
+ 73c:	e8 00 ff ff ff       	call   641 <free>
+  return freep;
+ 741:	8b 15 00 0d 00 00    	mov    0xd00,%edx
+      if((p = morecore(nunits)) == 0)
+ 747:	83 c4 10             	add    $0x10,%esp
+ 74a:	85 d2                	test   %edx,%edx
+ 74c:	74 d4                	je     722 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 74e:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 750:	8b 48 04             	mov    0x4(%eax),%ecx
+ 753:	39 d9                	cmp    %ebx,%ecx
+ 755:	73 b3                	jae    70a <malloc+0x60>
+    if(p == freep)
+ 757:	89 c2                	mov    %eax,%edx
+ 759:	39 05 00 0d 00 00    	cmp    %eax,0xd00
+ 75f:	75 ed                	jne    74e <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 761:	83 ec 0c             	sub    $0xc,%esp
+ 764:	57                   	push   %edi
+ 765:	e8 fa fb ff ff       	call   364 <sbrk>
+  if(p == (char*)-1)
+ 76a:	83 c4 10             	add    $0x10,%esp
+ 76d:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 770:	75 c0                	jne    732 <malloc+0x88>
+        return 0;
+ 772:	ba 00 00 00 00       	mov    $0x0,%edx
+ 777:	eb a9                	jmp    722 <malloc+0x78>
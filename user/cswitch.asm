@@ -0,0 +1,1232 @@
+
+_cswitch:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define NSPIN 4
+#define TICKS 500
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i, n, t, pid[NSPIN], start, elapsed, sw;
+
+  n = NSPIN;
+  t = TICKS;
+  19:	c7 45 d4 f4 01 00 00 	movl   $0x1f4,-0x2c(%ebp)
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(argc > 2)
+    t = atoi(argv[2]);
+  if(n > NSPIN)
+  20:	bb 04 00 00 00       	mov    $0x4,%ebx
+  if(argc > 1)
+  25:	83 fe 01             	cmp    $0x1,%esi
+  28:	7f 21                	jg     4b <main+0x4b>
+  if(n > NSPIN)
+  2a:	be 00 00 00 00       	mov    $0x0,%esi
+    n = NSPIN;
+
+  for(i = 0; i < n; i++){
+    pid[i] = fork();
+  2f:	e8 d5 02 00 00       	call   309 <fork>
+  34:	89 44 b5 d8          	mov    %eax,-0x28(%ebp,%esi,4)
+    if(pid[i] < 0){
+  38:	85 c0                	test   %eax,%eax
+  3a:	78 52                	js     8e <main+0x8e>
+      printf(2, "cswitch: fork failed\n");
+      n = i;
+      break;
+    }
+    if(pid[i] == 0)
+  3c:	0f 84 ea 00 00 00    	je     12c <main+0x12c>
+  for(i = 0; i < n; i++){
+  42:	83 c6 01             	add    $0x1,%esi
+  45:	39 de                	cmp    %ebx,%esi
+  47:	7c e6                	jl     2f <main+0x2f>
+  49:	eb 57                	jmp    a2 <main+0xa2>
+    n = atoi(argv[1]);
+  4b:	83 ec 0c             	sub    $0xc,%esp
+  4e:	ff 77 04             	push   0x4(%edi)
+  51:	e8 49 02 00 00       	call   29f <atoi>
+  56:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(argc > 2)
+  59:	83 c4 10             	add    $0x10,%esp
+  t = TICKS;
+  5c:	c7 45 d4 f4 01 00 00 	movl   $0x1f4,-0x2c(%ebp)
+  if(argc > 2)
+  63:	83 fe 02             	cmp    $0x2,%esi
+  66:	7f 13                	jg     7b <main+0x7b>
+  if(n > NSPIN)
+  68:	bb 04 00 00 00       	mov    $0x4,%ebx
+  6d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  70:	39 d8                	cmp    %ebx,%eax
+  72:	0f 4e d8             	cmovle %eax,%ebx
+  for(i = 0; i < n; i++){
+  75:	85 c0                	test   %eax,%eax
+  77:	7f b1                	jg     2a <main+0x2a>
+  79:	eb 27                	jmp    a2 <main+0xa2>
+    t = atoi(argv[2]);
+  7b:	83 ec 0c             	sub    $0xc,%esp
+  7e:	ff 77 08             	push   0x8(%edi)
+  81:	e8 19 02 00 00       	call   29f <atoi>
+  86:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	eb da                	jmp    68 <main+0x68>
+      printf(2, "cswitch: fork failed\n");
+  8e:	83 ec 08             	sub    $0x8,%esp
+  91:	68 b0 07 00 00       	push   $0x7b0
+  96:	6a 02                	push   $0x2
+  98:	e8 1c 04 00 00       	call   4b9 <printf>
+      break;
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 f3                	mov    %esi,%ebx
+      for(;;)
+        ;
+  }
+
+  sw = nswtch();
+  a2:	e8 5a 03 00 00       	call   401 <nswtch>
+  a7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  start = uptime();
+  aa:	e8 fa 02 00 00       	call   3a9 <uptime>
+  af:	89 c6                	mov    %eax,%esi
+  sleep(t);
+  b1:	83 ec 0c             	sub    $0xc,%esp
+  b4:	ff 75 d4             	push   -0x2c(%ebp)
+  b7:	e8 e5 02 00 00       	call   3a1 <sleep>
+  elapsed = uptime() - start;
+  bc:	e8 e8 02 00 00       	call   3a9 <uptime>
+  c1:	89 c7                	mov    %eax,%edi
+  c3:	29 f7                	sub    %esi,%edi
+  sw = nswtch() - sw;
+  c5:	e8 37 03 00 00       	call   401 <nswtch>
+  ca:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cd:	29 d0                	sub    %edx,%eax
+  cf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+  for(i = 0; i < n; i++){
+  d2:	83 c4 10             	add    $0x10,%esp
+  d5:	85 db                	test   %ebx,%ebx
+  d7:	7e 27                	jle    100 <main+0x100>
+  d9:	be 00 00 00 00       	mov    $0x0,%esi
+    kill(pid[i]);
+  de:	83 ec 0c             	sub    $0xc,%esp
+  e1:	ff 74 b5 d8          	push   -0x28(%ebp,%esi,4)
+  e5:	e8 57 02 00 00       	call   341 <kill>
+    wait(0);
+  ea:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  f1:	e8 23 02 00 00       	call   319 <wait>
+  for(i = 0; i < n; i++){
+  f6:	83 c6 01             	add    $0x1,%esi
+  f9:	83 c4 10             	add    $0x10,%esp
+  fc:	39 f3                	cmp    %esi,%ebx
+  fe:	75 de                	jne    de <main+0xde>
+  }
+
+  printf(1, "cswitch: %d switches in %d ticks", sw, elapsed);
+ 100:	57                   	push   %edi
+ 101:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+ 104:	53                   	push   %ebx
+ 105:	68 dc 07 00 00       	push   $0x7dc
+ 10a:	6a 01                	push   $0x1
+ 10c:	e8 a8 03 00 00       	call   4b9 <printf>
+  if(elapsed > 0)
+ 111:	83 c4 10             	add    $0x10,%esp
+ 114:	85 ff                	test   %edi,%edi
+ 116:	7f 16                	jg     12e <main+0x12e>
+    printf(1, " (%d per 100 ticks)", sw * 100 / elapsed);
+  printf(1, "\n");
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	68 c4 07 00 00       	push   $0x7c4
+ 120:	6a 01                	push   $0x1
+ 122:	e8 92 03 00 00       	call   4b9 <printf>
+  exit();
+ 127:	e8 e5 01 00 00       	call   311 <exit>
+      for(;;)
+ 12c:	eb fe                	jmp    12c <main+0x12c>
+    printf(1, " (%d per 100 ticks)", sw * 100 / elapsed);
+ 12e:	83 ec 04             	sub    $0x4,%esp
+ 131:	6b c3 64             	imul   $0x64,%ebx,%eax
+ 134:	99                   	cltd
+ 135:	f7 ff                	idiv   %edi
+ 137:	50                   	push   %eax
+ 138:	68 c6 07 00 00       	push   $0x7c6
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 75 03 00 00       	call   4b9 <printf>
+ 144:	83 c4 10             	add    $0x10,%esp
+ 147:	eb cf                	jmp    118 <main+0x118>
+
+00000149 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 149:	55                   	push   %ebp
+ 14a:	89 e5                	mov    %esp,%ebp
+ 14c:	53                   	push   %ebx
+ 14d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 150:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 153:	b8 00 00 00 00       	mov    $0x0,%eax
+ 158:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 15c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 15f:	83 c0 01             	add    $0x1,%eax
+ 162:	84 d2                	test   %dl,%dl
+ 164:	75 f2                	jne    158 <strcpy+0xf>
+    ;
+  return os;
+}
+ 166:	89 c8                	mov    %ecx,%eax
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+
+0000016d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 16d:	55                   	push   %ebp
+ 16e:	89 e5                	mov    %esp,%ebp
+ 170:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 173:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 176:	0f b6 01             	movzbl (%ecx),%eax
+ 179:	84 c0                	test   %al,%al
+ 17b:	74 11                	je     18e <strcmp+0x21>
+ 17d:	38 02                	cmp    %al,(%edx)
+ 17f:	75 0d                	jne    18e <strcmp+0x21>
+    p++, q++;
+ 181:	83 c1 01             	add    $0x1,%ecx
+ 184:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 187:	0f b6 01             	movzbl (%ecx),%eax
+ 18a:	84 c0                	test   %al,%al
+ 18c:	75 ef                	jne    17d <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 18e:	0f b6 c0             	movzbl %al,%eax
+ 191:	0f b6 12             	movzbl (%edx),%edx
+ 194:	29 d0                	sub    %edx,%eax
+}
+ 196:	5d                   	pop    %ebp
+ 197:	c3                   	ret
+
+00000198 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 198:	55                   	push   %ebp
+ 199:	89 e5                	mov    %esp,%ebp
+ 19b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 19e:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a1:	74 14                	je     1b7 <strlen+0x1f>
+ 1a3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1a8:	83 c0 01             	add    $0x1,%eax
+ 1ab:	89 c1                	mov    %eax,%ecx
+ 1ad:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b1:	75 f5                	jne    1a8 <strlen+0x10>
+    ;
+  return n;
+}
+ 1b3:	89 c8                	mov    %ecx,%eax
+ 1b5:	5d                   	pop    %ebp
+ 1b6:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 1b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1bc:	eb f5                	jmp    1b3 <strlen+0x1b>
+
+000001be <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1be:	55                   	push   %ebp
+ 1bf:	89 e5                	mov    %esp,%ebp
+ 1c1:	57                   	push   %edi
+ 1c2:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1c5:	89 d7                	mov    %edx,%edi
+ 1c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cd:	fc                   	cld
+ 1ce:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1d0:	89 d0                	mov    %edx,%eax
+ 1d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1d5:	c9                   	leave
+ 1d6:	c3                   	ret
+
+000001d7 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+ 1da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1dd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1e1:	0f b6 10             	movzbl (%eax),%edx
+ 1e4:	84 d2                	test   %dl,%dl
+ 1e6:	74 15                	je     1fd <strchr+0x26>
+    if(*s == c)
+ 1e8:	38 d1                	cmp    %dl,%cl
+ 1ea:	74 0f                	je     1fb <strchr+0x24>
+  for(; *s; s++)
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	0f b6 10             	movzbl (%eax),%edx
+ 1f2:	84 d2                	test   %dl,%dl
+ 1f4:	75 f2                	jne    1e8 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1fb:	5d                   	pop    %ebp
+ 1fc:	c3                   	ret
+  return 0;
+ 1fd:	b8 00 00 00 00       	mov    $0x0,%eax
+ 202:	eb f7                	jmp    1fb <strchr+0x24>
+
+00000204 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 204:	55                   	push   %ebp
+ 205:	89 e5                	mov    %esp,%ebp
+ 207:	57                   	push   %edi
+ 208:	56                   	push   %esi
+ 209:	53                   	push   %ebx
+ 20a:	83 ec 2c             	sub    $0x2c,%esp
+ 20d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 210:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 215:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 218:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 21b:	83 c3 01             	add    $0x1,%ebx
+ 21e:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 221:	7d 27                	jge    24a <gets+0x46>
+    cc = read(0, &c, 1);
+ 223:	83 ec 04             	sub    $0x4,%esp
+ 226:	6a 01                	push   $0x1
+ 228:	57                   	push   %edi
+ 229:	6a 00                	push   $0x0
+ 22b:	e8 f9 00 00 00       	call   329 <read>
+    if(cc < 1)
+ 230:	83 c4 10             	add    $0x10,%esp
+ 233:	85 c0                	test   %eax,%eax
+ 235:	7e 13                	jle    24a <gets+0x46>
+      break;
+    buf[i++] = c;
+ 237:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 23b:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 04                	je     247 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	75 d1                	jne    218 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 247:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 24a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 24d:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 251:	89 f0                	mov    %esi,%eax
+ 253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 256:	5b                   	pop    %ebx
+ 257:	5e                   	pop    %esi
+ 258:	5f                   	pop    %edi
+ 259:	5d                   	pop    %ebp
+ 25a:	c3                   	ret
+
+0000025b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	56                   	push   %esi
+ 25f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	6a 00                	push   $0x0
+ 265:	ff 75 08             	push   0x8(%ebp)
+ 268:	e8 e4 00 00 00       	call   351 <open>
+  if(fd < 0)
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	85 c0                	test   %eax,%eax
+ 272:	78 24                	js     298 <stat+0x3d>
+ 274:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 276:	83 ec 08             	sub    $0x8,%esp
+ 279:	ff 75 0c             	push   0xc(%ebp)
+ 27c:	50                   	push   %eax
+ 27d:	e8 e7 00 00 00       	call   369 <fstat>
+ 282:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 284:	89 1c 24             	mov    %ebx,(%esp)
+ 287:	e8 ad 00 00 00       	call   339 <close>
+  return r;
+ 28c:	83 c4 10             	add    $0x10,%esp
+}
+ 28f:	89 f0                	mov    %esi,%eax
+ 291:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 294:	5b                   	pop    %ebx
+ 295:	5e                   	pop    %esi
+ 296:	5d                   	pop    %ebp
+ 297:	c3                   	ret
+    return -1;
+ 298:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 29d:	eb f0                	jmp    28f <stat+0x34>
+
+0000029f <atoi>:
+
+int
+atoi(const char *s)
+{
+ 29f:	55                   	push   %ebp
+ 2a0:	89 e5                	mov    %esp,%ebp
+ 2a2:	53                   	push   %ebx
+ 2a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2a6:	0f b6 02             	movzbl (%edx),%eax
+ 2a9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ac:	80 f9 09             	cmp    $0x9,%cl
+ 2af:	77 24                	ja     2d5 <atoi+0x36>
+  n = 0;
+ 2b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 2b6:	83 c2 01             	add    $0x1,%edx
+ 2b9:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2bc:	0f be c0             	movsbl %al,%eax
+ 2bf:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2c3:	0f b6 02             	movzbl (%edx),%eax
+ 2c6:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c9:	80 fb 09             	cmp    $0x9,%bl
+ 2cc:	76 e8                	jbe    2b6 <atoi+0x17>
+  return n;
+}
+ 2ce:	89 c8                	mov    %ecx,%eax
+ 2d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d3:	c9                   	leave
+ 2d4:	c3                   	ret
+  n = 0;
+ 2d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2da:	eb f2                	jmp    2ce <atoi+0x2f>
+
+000002dc <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2dc:	55                   	push   %ebp
+ 2dd:	89 e5                	mov    %esp,%ebp
+ 2df:	56                   	push   %esi
+ 2e0:	53                   	push   %ebx
+ 2e1:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ea:	85 db                	test   %ebx,%ebx
+ 2ec:	7e 15                	jle    303 <memmove+0x27>
+ 2ee:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2f0:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2f2:	83 c2 01             	add    $0x1,%edx
+ 2f5:	83 c0 01             	add    $0x1,%eax
+ 2f8:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2fc:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2ff:	39 c3                	cmp    %eax,%ebx
+ 301:	75 ef                	jne    2f2 <memmove+0x16>
+  return vdst;
+}
+ 303:	89 f0                	mov    %esi,%eax
+ 305:	5b                   	pop    %ebx
+ 306:	5e                   	pop    %esi
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+
+00000309 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 309:	b8 01 00 00 00       	mov    $0x1,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <exit>:
+SYSCALL(exit)
+ 311:	b8 02 00 00 00       	mov    $0x2,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <wait>:
+SYSCALL(wait)
+ 319:	b8 03 00 00 00       	mov    $0x3,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <pipe>:
+SYSCALL(pipe)
+ 321:	b8 04 00 00 00       	mov    $0x4,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <read>:
+SYSCALL(read)
+ 329:	b8 05 00 00 00       	mov    $0x5,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <write>:
+SYSCALL(write)
+ 331:	b8 10 00 00 00       	mov    $0x10,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <close>:
+SYSCALL(close)
+ 339:	b8 15 00 00 00       	mov    $0x15,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <kill>:
+SYSCALL(kill)
+ 341:	b8 06 00 00 00       	mov    $0x6,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <exec>:
+SYSCALL(exec)
+ 349:	b8 07 00 00 00       	mov    $0x7,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <open>:
+SYSCALL(open)
+ 351:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <mknod>:
+SYSCALL(mknod)
+ 359:	b8 11 00 00 00       	mov    $0x11,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <unlink>:
+SYSCALL(unlink)
+ 361:	b8 12 00 00 00       	mov    $0x12,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <fstat>:
+SYSCALL(fstat)
+ 369:	b8 08 00 00 00       	mov    $0x8,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <link>:
+SYSCALL(link)
+ 371:	b8 13 00 00 00       	mov    $0x13,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <mkdir>:
+SYSCALL(mkdir)
+ 379:	b8 14 00 00 00       	mov    $0x14,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <chdir>:
+SYSCALL(chdir)
+ 381:	b8 09 00 00 00       	mov    $0x9,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <dup>:
+SYSCALL(dup)
+ 389:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <getpid>:
+SYSCALL(getpid)
+ 391:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <sbrk>:
+SYSCALL(sbrk)
+ 399:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <sleep>:
+SYSCALL(sleep)
+ 3a1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <uptime>:
+SYSCALL(uptime)
+ 3a9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <readmouse>:
+SYSCALL(readmouse)
+ 3b1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <sigsend>:
+SYSCALL(sigsend)
+ 3b9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 3c1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <sigreturn>:
+SYSCALL(sigreturn)
+ 3c9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <siggetmask>:
+SYSCALL(siggetmask)
+ 3d1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 3d9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <sigpause>:
+SYSCALL(sigpause)
+ 3e1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 3e9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <sleeptick>:
+SYSCALL(sleeptick)
+ 3f1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <schedctl>:
+SYSCALL(schedctl)
+ 3f9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <nswtch>:
+SYSCALL(nswtch)
+ 401:	b8 20 00 00 00       	mov    $0x20,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <getloadavg>:
+SYSCALL(getloadavg)
+ 409:	b8 21 00 00 00       	mov    $0x21,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <memstat>:
+SYSCALL(memstat)
+ 411:	b8 22 00 00 00       	mov    $0x22,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <iostat>:
+SYSCALL(iostat)
+ 419:	b8 23 00 00 00       	mov    $0x23,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 421:	55                   	push   %ebp
+ 422:	89 e5                	mov    %esp,%ebp
+ 424:	57                   	push   %edi
+ 425:	56                   	push   %esi
+ 426:	53                   	push   %ebx
+ 427:	83 ec 3c             	sub    $0x3c,%esp
+ 42a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 42d:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 42f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 433:	74 79                	je     4ae <printint+0x8d>
+ 435:	85 d2                	test   %edx,%edx
+ 437:	79 75                	jns    4ae <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 439:	89 d1                	mov    %edx,%ecx
+ 43b:	f7 d9                	neg    %ecx
+    neg = 1;
+ 43d:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 444:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 449:	89 df                	mov    %ebx,%edi
+ 44b:	83 c3 01             	add    $0x1,%ebx
+ 44e:	89 c8                	mov    %ecx,%eax
+ 450:	ba 00 00 00 00       	mov    $0x0,%edx
+ 455:	f7 f6                	div    %esi
+ 457:	0f b6 92 5c 08 00 00 	movzbl 0x85c(%edx),%edx
+ 45e:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 462:	89 ca                	mov    %ecx,%edx
+ 464:	89 c1                	mov    %eax,%ecx
+ 466:	39 f2                	cmp    %esi,%edx
+ 468:	73 df                	jae    449 <printint+0x28>
+  if(neg)
+ 46a:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 46e:	74 08                	je     478 <printint+0x57>
+    buf[i++] = '-';
+ 470:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 475:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 478:	85 db                	test   %ebx,%ebx
+ 47a:	7e 2a                	jle    4a6 <printint+0x85>
+ 47c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 47f:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 483:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 486:	0f b6 03             	movzbl (%ebx),%eax
+ 489:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 48c:	83 ec 04             	sub    $0x4,%esp
+ 48f:	6a 01                	push   $0x1
+ 491:	57                   	push   %edi
+ 492:	ff 75 c4             	push   -0x3c(%ebp)
+ 495:	e8 97 fe ff ff       	call   331 <write>
+  while(--i >= 0)
+ 49a:	89 d8                	mov    %ebx,%eax
+ 49c:	83 eb 01             	sub    $0x1,%ebx
+ 49f:	83 c4 10             	add    $0x10,%esp
+ 4a2:	39 f0                	cmp    %esi,%eax
+ 4a4:	75 e0                	jne    486 <printint+0x65>
+}
+ 4a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4a9:	5b                   	pop    %ebx
+ 4aa:	5e                   	pop    %esi
+ 4ab:	5f                   	pop    %edi
+ 4ac:	5d                   	pop    %ebp
+ 4ad:	c3                   	ret
+    x = xx;
+ 4ae:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 4b0:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 4b7:	eb 8b                	jmp    444 <printint+0x23>
+
+000004b9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4b9:	55                   	push   %ebp
+ 4ba:	89 e5                	mov    %esp,%ebp
+ 4bc:	57                   	push   %edi
+ 4bd:	56                   	push   %esi
+ 4be:	53                   	push   %ebx
+ 4bf:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4c2:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4c5:	0f b6 1e             	movzbl (%esi),%ebx
+ 4c8:	84 db                	test   %bl,%bl
+ 4ca:	0f 84 9e 01 00 00    	je     66e <printf+0x1b5>
+ 4d0:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4d3:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4d6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4d9:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4de:	eb 2d                	jmp    50d <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4e0:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4e3:	83 ec 04             	sub    $0x4,%esp
+ 4e6:	6a 01                	push   $0x1
+ 4e8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4eb:	50                   	push   %eax
+ 4ec:	ff 75 08             	push   0x8(%ebp)
+ 4ef:	e8 3d fe ff ff       	call   331 <write>
+        putc(fd, c);
+ 4f4:	83 c4 10             	add    $0x10,%esp
+ 4f7:	eb 05                	jmp    4fe <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4f9:	83 ff 25             	cmp    $0x25,%edi
+ 4fc:	74 1f                	je     51d <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4fe:	83 c6 01             	add    $0x1,%esi
+ 501:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 505:	84 db                	test   %bl,%bl
+ 507:	0f 84 61 01 00 00    	je     66e <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 50d:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 510:	85 ff                	test   %edi,%edi
+ 512:	75 e5                	jne    4f9 <printf+0x40>
+      if(c == '%'){
+ 514:	83 f8 25             	cmp    $0x25,%eax
+ 517:	75 c7                	jne    4e0 <printf+0x27>
+        state = '%';
+ 519:	89 c7                	mov    %eax,%edi
+ 51b:	eb e1                	jmp    4fe <printf+0x45>
+      if(c == 'd'){
+ 51d:	83 f8 25             	cmp    $0x25,%eax
+ 520:	0f 84 f4 00 00 00    	je     61a <printf+0x161>
+ 526:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 529:	83 fa 15             	cmp    $0x15,%edx
+ 52c:	0f 87 09 01 00 00    	ja     63b <printf+0x182>
+ 532:	0f 87 03 01 00 00    	ja     63b <printf+0x182>
+ 538:	ff 24 95 04 08 00 00 	jmp    *0x804(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 53f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 542:	8b 17                	mov    (%edi),%edx
+ 544:	83 ec 0c             	sub    $0xc,%esp
+ 547:	6a 01                	push   $0x1
+ 549:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 54e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 551:	e8 cb fe ff ff       	call   421 <printint>
+        ap++;
+ 556:	83 c7 04             	add    $0x4,%edi
+ 559:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 55c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 55f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 564:	eb 98                	jmp    4fe <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 566:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 569:	8b 17                	mov    (%edi),%edx
+ 56b:	83 ec 0c             	sub    $0xc,%esp
+ 56e:	6a 00                	push   $0x0
+ 570:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 575:	8b 45 08             	mov    0x8(%ebp),%eax
+ 578:	e8 a4 fe ff ff       	call   421 <printint>
+        ap++;
+ 57d:	83 c7 04             	add    $0x4,%edi
+ 580:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 583:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 586:	bf 00 00 00 00       	mov    $0x0,%edi
+ 58b:	e9 6e ff ff ff       	jmp    4fe <printf+0x45>
+        s = (char*)*ap;
+ 590:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 593:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 595:	83 c1 04             	add    $0x4,%ecx
+ 598:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 59b:	85 c0                	test   %eax,%eax
+ 59d:	74 13                	je     5b2 <printf+0xf9>
+        s = (char*)*ap;
+ 59f:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 5a1:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 5a4:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 5a9:	84 c0                	test   %al,%al
+ 5ab:	75 0f                	jne    5bc <printf+0x103>
+ 5ad:	e9 4c ff ff ff       	jmp    4fe <printf+0x45>
+          s = "(null)";
+ 5b2:	bb fd 07 00 00       	mov    $0x7fd,%ebx
+        while(*s != 0){
+ 5b7:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 5bc:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5bf:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5c2:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 5c5:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5c8:	83 ec 04             	sub    $0x4,%esp
+ 5cb:	6a 01                	push   $0x1
+ 5cd:	57                   	push   %edi
+ 5ce:	56                   	push   %esi
+ 5cf:	e8 5d fd ff ff       	call   331 <write>
+          s++;
+ 5d4:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5d7:	0f b6 03             	movzbl (%ebx),%eax
+ 5da:	83 c4 10             	add    $0x10,%esp
+ 5dd:	84 c0                	test   %al,%al
+ 5df:	75 e4                	jne    5c5 <printf+0x10c>
+      state = 0;
+ 5e1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5e4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e9:	e9 10 ff ff ff       	jmp    4fe <printf+0x45>
+        putc(fd, *ap);
+ 5ee:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5f1:	8b 07                	mov    (%edi),%eax
+ 5f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f6:	83 ec 04             	sub    $0x4,%esp
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fe:	50                   	push   %eax
+ 5ff:	ff 75 08             	push   0x8(%ebp)
+ 602:	e8 2a fd ff ff       	call   331 <write>
+        ap++;
+ 607:	83 c7 04             	add    $0x4,%edi
+ 60a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 60d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 610:	bf 00 00 00 00       	mov    $0x0,%edi
+ 615:	e9 e4 fe ff ff       	jmp    4fe <printf+0x45>
+        putc(fd, c);
+ 61a:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 61d:	83 ec 04             	sub    $0x4,%esp
+ 620:	6a 01                	push   $0x1
+ 622:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 625:	50                   	push   %eax
+ 626:	ff 75 08             	push   0x8(%ebp)
+ 629:	e8 03 fd ff ff       	call   331 <write>
+ 62e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 631:	bf 00 00 00 00       	mov    $0x0,%edi
+ 636:	e9 c3 fe ff ff       	jmp    4fe <printf+0x45>
+        putc(fd, '%');
+ 63b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 63f:	83 ec 04             	sub    $0x4,%esp
+ 642:	6a 01                	push   $0x1
+ 644:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 647:	57                   	push   %edi
+ 648:	ff 75 08             	push   0x8(%ebp)
+ 64b:	e8 e1 fc ff ff       	call   331 <write>
+        putc(fd, c);
+ 650:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 653:	83 c4 0c             	add    $0xc,%esp
+ 656:	6a 01                	push   $0x1
+ 658:	57                   	push   %edi
+ 659:	ff 75 08             	push   0x8(%ebp)
+ 65c:	e8 d0 fc ff ff       	call   331 <write>
+        putc(fd, c);
+ 661:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 664:	bf 00 00 00 00       	mov    $0x0,%edi
+ 669:	e9 90 fe ff ff       	jmp    4fe <printf+0x45>
+    }
+  }
+}
+ 66e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 671:	5b                   	pop    %ebx
+ 672:	5e                   	pop    %esi
+ 673:	5f                   	pop    %edi
+ 674:	5d                   	pop    %ebp
+ 675:	c3                   	ret
+
+00000676 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 676:	55                   	push   %ebp
+ 677:	89 e5                	mov    %esp,%ebp
+ 679:	57                   	push   %edi
+ 67a:	56                   	push   %esi
+ 67b:	53                   	push   %ebx
+ 67c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 67f:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 682:	a1 d0 0a 00 00       	mov    0xad0,%eax
+ 687:	eb 0c                	jmp    695 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 689:	8b 10                	mov    (%eax),%edx
+ 68b:	39 d0                	cmp    %edx,%eax
+ 68d:	72 04                	jb     693 <free+0x1d>
+ 68f:	39 d1                	cmp    %edx,%ecx
+ 691:	72 10                	jb     6a3 <free+0x2d>
+{
+ 693:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 695:	39 c8                	cmp    %ecx,%eax
+ 697:	73 f0                	jae    689 <free+0x13>
+ 699:	8b 10                	mov    (%eax),%edx
+ 69b:	39 d1                	cmp    %edx,%ecx
+ 69d:	72 04                	jb     6a3 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 69f:	39 d0                	cmp    %edx,%eax
+ 6a1:	72 f0                	jb     693 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6a3:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6a6:	8b 10                	mov    (%eax),%edx
+ 6a8:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6ab:	39 fa                	cmp    %edi,%edx
+ 6ad:	74 19                	je     6c8 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6af:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6b2:	8b 50 04             	mov    0x4(%eax),%edx
+ 6b5:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6b8:	39 f1                	cmp    %esi,%ecx
+ 6ba:	74 18                	je     6d4 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6bc:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 6be:	a3 d0 0a 00 00       	mov    %eax,0xad0
+}
+ 6c3:	5b                   	pop    %ebx
+ 6c4:	5e                   	pop    %esi
+ 6c5:	5f                   	pop    %edi
+ 6c6:	5d                   	pop    %ebp
+ 6c7:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6c8:	03 72 04             	add    0x4(%edx),%esi
+ 6cb:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6ce:	8b 10                	mov    (%eax),%edx
+ 6d0:	8b 12                	mov    (%edx),%edx
+ 6d2:	eb db                	jmp    6af <free+0x39>
+    p->s.size += bp->s.size;
+ 6d4:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6d7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6da:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6dd:	eb dd                	jmp    6bc <free+0x46>
+
+000006df <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6df:	55                   	push   %ebp
+ 6e0:	89 e5                	mov    %esp,%ebp
+ 6e2:	57                   	push   %edi
+ 6e3:	56                   	push   %esi
+ 6e4:	53                   	push   %ebx
+ 6e5:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6eb:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6ee:	c1 eb 03             	shr    $0x3,%ebx
+ 6f1:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6f4:	8b 15 d0 0a 00 00    	mov    0xad0,%edx
+ 6fa:	85 d2                	test   %edx,%edx
+ 6fc:	74 1c                	je     71a <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6fe:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 700:	8b 48 04             	mov    0x4(%eax),%ecx
+ 703:	39 d9                	cmp    %ebx,%ecx
+ 705:	73 38                	jae    73f <malloc+0x60>
+  if(nu < 4096)
+ 707:	be 00 10 00 00       	mov    $0x1000,%esi
+ 70c:	39 f3                	cmp    %esi,%ebx
+ 70e:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 711:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 718:	eb 72                	jmp    78c <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 71a:	c7 05 d0 0a 00 00 d4 	movl   $0xad4,0xad0
+ 721:	0a 00 00 
+ 724:	c7 05 d4 0a 00 00 d4 	movl   $0xad4,0xad4
+ 72b:	0a 00 00 
+    base.s.size = 0;
+ 72e:	c7 05 d8 0a 00 00 00 	movl   $0x0,0xad8
+ 735:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 738:	b8 d4 0a 00 00       	mov    $0xad4,%eax
+    if(p->s.size >= nunits){
+ 73d:	eb c8                	jmp    707 <malloc+0x28>
+      if(p->s.size == nunits)
+ 73f:	39 cb                	cmp    %ecx,%ebx
+ 741:	74 1e                	je     761 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 743:	29 d9                	sub    %ebx,%ecx
+ 745:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 748:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 74b:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 74e:	89 15 d0 0a 00 00    	mov    %edx,0xad0
+      return (void*)(p + 1);
+ 754:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 757:	89 d0                	mov    %edx,%eax
+ 759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75c:	5b                   	pop    %ebx
+ 75d:	5e                   	pop    %esi
+ 75e:	5f                   	pop    %edi
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 761:	8b 08                	mov    (%eax),%ecx
+ 763:	89 0a                	mov    %ecx,(%edx)
+ 765:	eb e7                	jmp    74e <malloc+0x6f>
+  hp->s.size = nu;
+ 767:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 76a:	83 ec 0c             	sub    $0xc,%esp
+ 76d:	83 c0 08             	add    $0x8,%eax
+ 770:	50                   	push   %eax
+ 771:	e8 00 ff ff ff       	call   676 <free>
+  return freep;
+ 776:	8b 15 d0 0a 00 00    	mov    0xad0,%edx
+      if((p = morecore(nunits)) == 0)
+ 77c:	83 c4 10             	add    $0x10,%esp
+ 77f:	85 d2                	test   %edx,%edx
+ 781:	74 d4                	je     757 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 783:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 785:	8b 48 04             	mov    0x4(%eax),%ecx
+ 788:	39 d9                	cmp    %ebx,%ecx
+ 78a:	73 b3                	jae    73f <malloc+0x60>
+    if(p == freep)
+ 78c:	89 c2                	mov    %eax,%edx
+ 78e:	39 05 d0 0a 00 00    	cmp    %eax,0xad0
+ 794:	75 ed                	jne    783 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 796:	83 ec 0c             	sub    $0xc,%esp
+ 799:	57                   	push   %edi
+ 79a:	e8 fa fb ff ff       	call   399 <sbrk>
+  if(p == (char*)-1)
+ 79f:	83 c4 10             	add    $0x10,%esp
+ 7a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7a5:	75 c0                	jne    767 <malloc+0x88>
+        return 0;
+ 7a7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7ac:	eb a9                	jmp    757 <malloc+0x78>
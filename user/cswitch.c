@@ -0,0 +1,56 @@
+// Count context switches while CPU-bound processes compete.
+// Starts NSPIN processes that spin forever, samples nswtch()
+// across a sleep, then kills them.  With adaptive time slices
+// the spinners settle on long slices and the switch rate drops
+// compared to switching on every timer tick.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user.h"
+
+#define NSPIN 4
+#define TICKS 500
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, t, pid[NSPIN], start, elapsed, sw;
+
+  n = NSPIN;
+  t = TICKS;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(argc > 2)
+    t = atoi(argv[2]);
+  if(n > NSPIN)
+    n = NSPIN;
+
+  for(i = 0; i < n; i++){
+    pid[i] = fork();
+    if(pid[i] < 0){
+      printf(2, "cswitch: fork failed\n");
+      n = i;
+      break;
+    }
+    if(pid[i] == 0)
+      for(;;)
+        ;
+  }
+
+  sw = nswtch();
+  start = uptime();
+  sleep(t);
+  elapsed = uptime() - start;
+  sw = nswtch() - sw;
+
+  for(i = 0; i < n; i++){
+    kill(pid[i]);
+    wait(0);
+  }
+
+  printf(1, "cswitch: %d switches in %d ticks", sw, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d per 100 ticks)", sw * 100 / elapsed);
+  printf(1, "\n");
+  exit();
+}
@@ -0,0 +1,1113 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 3f                	jle    5d <main+0x5d>
+  1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  23:	eb 1a                	jmp    3f <main+0x3f>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  25:	68 c8 06 00 00       	push   $0x6c8
+  2a:	ff 74 9f fc          	push   -0x4(%edi,%ebx,4)
+  2e:	68 ca 06 00 00       	push   $0x6ca
+  33:	6a 01                	push   $0x1
+  35:	e8 98 03 00 00       	call   3d2 <printf>
+  3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  3d:	89 d8                	mov    %ebx,%eax
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  3f:	8d 58 01             	lea    0x1(%eax),%ebx
+  42:	39 f3                	cmp    %esi,%ebx
+  44:	75 df                	jne    25 <main+0x25>
+  46:	68 cf 06 00 00       	push   $0x6cf
+  4b:	ff 34 87             	push   (%edi,%eax,4)
+  4e:	68 ca 06 00 00       	push   $0x6ca
+  53:	6a 01                	push   $0x1
+  55:	e8 78 03 00 00       	call   3d2 <printf>
+  5a:	83 c4 10             	add    $0x10,%esp
+  exit();
+  5d:	e8 c8 01 00 00       	call   22a <exit>
+
+00000062 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  62:	55                   	push   %ebp
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  71:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  75:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  78:	83 c0 01             	add    $0x1,%eax
+  7b:	84 d2                	test   %dl,%dl
+  7d:	75 f2                	jne    71 <strcpy+0xf>
+    ;
+  return os;
+}
+  7f:	89 c8                	mov    %ecx,%eax
+  81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  84:	c9                   	leave
+  85:	c3                   	ret
+
+00000086 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  86:	55                   	push   %ebp
+  87:	89 e5                	mov    %esp,%ebp
+  89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  8f:	0f b6 01             	movzbl (%ecx),%eax
+  92:	84 c0                	test   %al,%al
+  94:	74 11                	je     a7 <strcmp+0x21>
+  96:	38 02                	cmp    %al,(%edx)
+  98:	75 0d                	jne    a7 <strcmp+0x21>
+    p++, q++;
+  9a:	83 c1 01             	add    $0x1,%ecx
+  9d:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  a0:	0f b6 01             	movzbl (%ecx),%eax
+  a3:	84 c0                	test   %al,%al
+  a5:	75 ef                	jne    96 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  a7:	0f b6 c0             	movzbl %al,%eax
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	29 d0                	sub    %edx,%eax
+}
+  af:	5d                   	pop    %ebp
+  b0:	c3                   	ret
+
+000000b1 <strlen>:
+
+uint
+strlen(char *s)
+{
+  b1:	55                   	push   %ebp
+  b2:	89 e5                	mov    %esp,%ebp
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  b7:	80 3a 00             	cmpb   $0x0,(%edx)
+  ba:	74 14                	je     d0 <strlen+0x1f>
+  bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  c1:	83 c0 01             	add    $0x1,%eax
+  c4:	89 c1                	mov    %eax,%ecx
+  c6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  ca:	75 f5                	jne    c1 <strlen+0x10>
+    ;
+  return n;
+}
+  cc:	89 c8                	mov    %ecx,%eax
+  ce:	5d                   	pop    %ebp
+  cf:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  d5:	eb f5                	jmp    cc <strlen+0x1b>
+
+000000d7 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d7:	55                   	push   %ebp
+  d8:	89 e5                	mov    %esp,%ebp
+  da:	57                   	push   %edi
+  db:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  de:	89 d7                	mov    %edx,%edi
+  e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e6:	fc                   	cld
+  e7:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e9:	89 d0                	mov    %edx,%eax
+  eb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  ee:	c9                   	leave
+  ef:	c3                   	ret
+
+000000f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  fa:	0f b6 10             	movzbl (%eax),%edx
+  fd:	84 d2                	test   %dl,%dl
+  ff:	74 15                	je     116 <strchr+0x26>
+    if(*s == c)
+ 101:	38 d1                	cmp    %dl,%cl
+ 103:	74 0f                	je     114 <strchr+0x24>
+  for(; *s; s++)
+ 105:	83 c0 01             	add    $0x1,%eax
+ 108:	0f b6 10             	movzbl (%eax),%edx
+ 10b:	84 d2                	test   %dl,%dl
+ 10d:	75 f2                	jne    101 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 10f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 114:	5d                   	pop    %ebp
+ 115:	c3                   	ret
+  return 0;
+ 116:	b8 00 00 00 00       	mov    $0x0,%eax
+ 11b:	eb f7                	jmp    114 <strchr+0x24>
+
+0000011d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 11d:	55                   	push   %ebp
+ 11e:	89 e5                	mov    %esp,%ebp
+ 120:	57                   	push   %edi
+ 121:	56                   	push   %esi
+ 122:	53                   	push   %ebx
+ 123:	83 ec 2c             	sub    $0x2c,%esp
+ 126:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 129:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 12e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 131:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 134:	83 c3 01             	add    $0x1,%ebx
+ 137:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 13a:	7d 27                	jge    163 <gets+0x46>
+    cc = read(0, &c, 1);
+ 13c:	83 ec 04             	sub    $0x4,%esp
+ 13f:	6a 01                	push   $0x1
+ 141:	57                   	push   %edi
+ 142:	6a 00                	push   $0x0
+ 144:	e8 f9 00 00 00       	call   242 <read>
+    if(cc < 1)
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	85 c0                	test   %eax,%eax
+ 14e:	7e 13                	jle    163 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 150:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 154:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 158:	3c 0a                	cmp    $0xa,%al
+ 15a:	74 04                	je     160 <gets+0x43>
+ 15c:	3c 0d                	cmp    $0xd,%al
+ 15e:	75 d1                	jne    131 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 160:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 163:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 166:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 16a:	89 f0                	mov    %esi,%eax
+ 16c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 16f:	5b                   	pop    %ebx
+ 170:	5e                   	pop    %esi
+ 171:	5f                   	pop    %edi
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+
+00000174 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	56                   	push   %esi
+ 178:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 179:	83 ec 08             	sub    $0x8,%esp
+ 17c:	6a 00                	push   $0x0
+ 17e:	ff 75 08             	push   0x8(%ebp)
+ 181:	e8 e4 00 00 00       	call   26a <open>
+  if(fd < 0)
+ 186:	83 c4 10             	add    $0x10,%esp
+ 189:	85 c0                	test   %eax,%eax
+ 18b:	78 24                	js     1b1 <stat+0x3d>
+ 18d:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 18f:	83 ec 08             	sub    $0x8,%esp
+ 192:	ff 75 0c             	push   0xc(%ebp)
+ 195:	50                   	push   %eax
+ 196:	e8 e7 00 00 00       	call   282 <fstat>
+ 19b:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 19d:	89 1c 24             	mov    %ebx,(%esp)
+ 1a0:	e8 ad 00 00 00       	call   252 <close>
+  return r;
+ 1a5:	83 c4 10             	add    $0x10,%esp
+}
+ 1a8:	89 f0                	mov    %esi,%eax
+ 1aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ad:	5b                   	pop    %ebx
+ 1ae:	5e                   	pop    %esi
+ 1af:	5d                   	pop    %ebp
+ 1b0:	c3                   	ret
+    return -1;
+ 1b1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1b6:	eb f0                	jmp    1a8 <stat+0x34>
+
+000001b8 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1b8:	55                   	push   %ebp
+ 1b9:	89 e5                	mov    %esp,%ebp
+ 1bb:	53                   	push   %ebx
+ 1bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 1bf:	0f b6 02             	movzbl (%edx),%eax
+ 1c2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1c5:	80 f9 09             	cmp    $0x9,%cl
+ 1c8:	77 24                	ja     1ee <atoi+0x36>
+  n = 0;
+ 1ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 1cf:	83 c2 01             	add    $0x1,%edx
+ 1d2:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 1d5:	0f be c0             	movsbl %al,%eax
+ 1d8:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 1dc:	0f b6 02             	movzbl (%edx),%eax
+ 1df:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 1e2:	80 fb 09             	cmp    $0x9,%bl
+ 1e5:	76 e8                	jbe    1cf <atoi+0x17>
+  return n;
+}
+ 1e7:	89 c8                	mov    %ecx,%eax
+ 1e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1ec:	c9                   	leave
+ 1ed:	c3                   	ret
+  n = 0;
+ 1ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1f3:	eb f2                	jmp    1e7 <atoi+0x2f>
+
+000001f5 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	56                   	push   %esi
+ 1f9:	53                   	push   %ebx
+ 1fa:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 200:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 203:	85 db                	test   %ebx,%ebx
+ 205:	7e 15                	jle    21c <memmove+0x27>
+ 207:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 209:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 20b:	83 c2 01             	add    $0x1,%edx
+ 20e:	83 c0 01             	add    $0x1,%eax
+ 211:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 215:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 218:	39 c3                	cmp    %eax,%ebx
+ 21a:	75 ef                	jne    20b <memmove+0x16>
+  return vdst;
+}
+ 21c:	89 f0                	mov    %esi,%eax
+ 21e:	5b                   	pop    %ebx
+ 21f:	5e                   	pop    %esi
+ 220:	5d                   	pop    %ebp
+ 221:	c3                   	ret
+
+00000222 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 222:	b8 01 00 00 00       	mov    $0x1,%eax
+ 227:	cd 40                	int    $0x40
+ 229:	c3                   	ret
+
+0000022a <exit>:
+SYSCALL(exit)
+ 22a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 22f:	cd 40                	int    $0x40
+ 231:	c3                   	ret
+
+00000232 <wait>:
+SYSCALL(wait)
+ 232:	b8 03 00 00 00       	mov    $0x3,%eax
+ 237:	cd 40                	int    $0x40
+ 239:	c3                   	ret
+
+0000023a <pipe>:
+SYSCALL(pipe)
+ 23a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 23f:	cd 40                	int    $0x40
+ 241:	c3                   	ret
+
+00000242 <read>:
+SYSCALL(read)
+ 242:	b8 05 00 00 00       	mov    $0x5,%eax
+ 247:	cd 40                	int    $0x40
+ 249:	c3                   	ret
+
+0000024a <write>:
+SYSCALL(write)
+ 24a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 24f:	cd 40                	int    $0x40
+ 251:	c3                   	ret
+
+00000252 <close>:
+SYSCALL(close)
+ 252:	b8 15 00 00 00       	mov    $0x15,%eax
+ 257:	cd 40                	int    $0x40
+ 259:	c3                   	ret
+
+0000025a <kill>:
+SYSCALL(kill)
+ 25a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 25f:	cd 40                	int    $0x40
+ 261:	c3                   	ret
+
+00000262 <exec>:
+SYSCALL(exec)
+ 262:	b8 07 00 00 00       	mov    $0x7,%eax
+ 267:	cd 40                	int    $0x40
+ 269:	c3                   	ret
+
+0000026a <open>:
+SYSCALL(open)
+ 26a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 26f:	cd 40                	int    $0x40
+ 271:	c3                   	ret
+
+00000272 <mknod>:
+SYSCALL(mknod)
+ 272:	b8 11 00 00 00       	mov    $0x11,%eax
+ 277:	cd 40                	int    $0x40
+ 279:	c3                   	ret
+
+0000027a <unlink>:
+SYSCALL(unlink)
+ 27a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 27f:	cd 40                	int    $0x40
+ 281:	c3                   	ret
+
+00000282 <fstat>:
+SYSCALL(fstat)
+ 282:	b8 08 00 00 00       	mov    $0x8,%eax
+ 287:	cd 40                	int    $0x40
+ 289:	c3                   	ret
+
+0000028a <link>:
+SYSCALL(link)
+ 28a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+00000292 <mkdir>:
+SYSCALL(mkdir)
+ 292:	b8 14 00 00 00       	mov    $0x14,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+0000029a <chdir>:
+SYSCALL(chdir)
+ 29a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+000002a2 <dup>:
+SYSCALL(dup)
+ 2a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2a7:	cd 40                	int    $0x40
+ 2a9:	c3                   	ret
+
+000002aa <getpid>:
+SYSCALL(getpid)
+ 2aa:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+000002b2 <sbrk>:
+SYSCALL(sbrk)
+ 2b2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+000002ba <sleep>:
+SYSCALL(sleep)
+ 2ba:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+000002c2 <uptime>:
+SYSCALL(uptime)
+ 2c2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+000002ca <readmouse>:
+SYSCALL(readmouse)
+ 2ca:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+000002d2 <sigsend>:
+SYSCALL(sigsend)
+ 2d2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+000002da <sigsethandler>:
+SYSCALL(sigsethandler)
+ 2da:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+000002e2 <sigreturn>:
+SYSCALL(sigreturn)
+ 2e2:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+000002ea <siggetmask>:
+SYSCALL(siggetmask)
+ 2ea:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+000002f2 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 2f2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <sigpause>:
+SYSCALL(sigpause)
+ 2fa:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 302:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <sleeptick>:
+SYSCALL(sleeptick)
+ 30a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <schedctl>:
+SYSCALL(schedctl)
+ 312:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <nswtch>:
+SYSCALL(nswtch)
+ 31a:	b8 20 00 00 00       	mov    $0x20,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <getloadavg>:
+SYSCALL(getloadavg)
+ 322:	b8 21 00 00 00       	mov    $0x21,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <memstat>:
+SYSCALL(memstat)
+ 32a:	b8 22 00 00 00       	mov    $0x22,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <iostat>:
+SYSCALL(iostat)
+ 332:	b8 23 00 00 00       	mov    $0x23,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 33a:	55                   	push   %ebp
+ 33b:	89 e5                	mov    %esp,%ebp
+ 33d:	57                   	push   %edi
+ 33e:	56                   	push   %esi
+ 33f:	53                   	push   %ebx
+ 340:	83 ec 3c             	sub    $0x3c,%esp
+ 343:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 346:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 348:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 34c:	74 79                	je     3c7 <printint+0x8d>
+ 34e:	85 d2                	test   %edx,%edx
+ 350:	79 75                	jns    3c7 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 352:	89 d1                	mov    %edx,%ecx
+ 354:	f7 d9                	neg    %ecx
+    neg = 1;
+ 356:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 35d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 362:	89 df                	mov    %ebx,%edi
+ 364:	83 c3 01             	add    $0x1,%ebx
+ 367:	89 c8                	mov    %ecx,%eax
+ 369:	ba 00 00 00 00       	mov    $0x0,%edx
+ 36e:	f7 f6                	div    %esi
+ 370:	0f b6 92 30 07 00 00 	movzbl 0x730(%edx),%edx
+ 377:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 37b:	89 ca                	mov    %ecx,%edx
+ 37d:	89 c1                	mov    %eax,%ecx
+ 37f:	39 f2                	cmp    %esi,%edx
+ 381:	73 df                	jae    362 <printint+0x28>
+  if(neg)
+ 383:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 387:	74 08                	je     391 <printint+0x57>
+    buf[i++] = '-';
+ 389:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 38e:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 391:	85 db                	test   %ebx,%ebx
+ 393:	7e 2a                	jle    3bf <printint+0x85>
+ 395:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 398:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 39c:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 39f:	0f b6 03             	movzbl (%ebx),%eax
+ 3a2:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 3a5:	83 ec 04             	sub    $0x4,%esp
+ 3a8:	6a 01                	push   $0x1
+ 3aa:	57                   	push   %edi
+ 3ab:	ff 75 c4             	push   -0x3c(%ebp)
+ 3ae:	e8 97 fe ff ff       	call   24a <write>
+  while(--i >= 0)
+ 3b3:	89 d8                	mov    %ebx,%eax
+ 3b5:	83 eb 01             	sub    $0x1,%ebx
+ 3b8:	83 c4 10             	add    $0x10,%esp
+ 3bb:	39 f0                	cmp    %esi,%eax
+ 3bd:	75 e0                	jne    39f <printint+0x65>
+}
+ 3bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3c2:	5b                   	pop    %ebx
+ 3c3:	5e                   	pop    %esi
+ 3c4:	5f                   	pop    %edi
+ 3c5:	5d                   	pop    %ebp
+ 3c6:	c3                   	ret
+    x = xx;
+ 3c7:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 3c9:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 3d0:	eb 8b                	jmp    35d <printint+0x23>
+
+000003d2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 3d2:	55                   	push   %ebp
+ 3d3:	89 e5                	mov    %esp,%ebp
+ 3d5:	57                   	push   %edi
+ 3d6:	56                   	push   %esi
+ 3d7:	53                   	push   %ebx
+ 3d8:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3de:	0f b6 1e             	movzbl (%esi),%ebx
+ 3e1:	84 db                	test   %bl,%bl
+ 3e3:	0f 84 9e 01 00 00    	je     587 <printf+0x1b5>
+ 3e9:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 3ec:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3ef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 3f2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 3f7:	eb 2d                	jmp    426 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 3f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 3fc:	83 ec 04             	sub    $0x4,%esp
+ 3ff:	6a 01                	push   $0x1
+ 401:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 404:	50                   	push   %eax
+ 405:	ff 75 08             	push   0x8(%ebp)
+ 408:	e8 3d fe ff ff       	call   24a <write>
+        putc(fd, c);
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	eb 05                	jmp    417 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 412:	83 ff 25             	cmp    $0x25,%edi
+ 415:	74 1f                	je     436 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 417:	83 c6 01             	add    $0x1,%esi
+ 41a:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 41e:	84 db                	test   %bl,%bl
+ 420:	0f 84 61 01 00 00    	je     587 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 426:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 429:	85 ff                	test   %edi,%edi
+ 42b:	75 e5                	jne    412 <printf+0x40>
+      if(c == '%'){
+ 42d:	83 f8 25             	cmp    $0x25,%eax
+ 430:	75 c7                	jne    3f9 <printf+0x27>
+        state = '%';
+ 432:	89 c7                	mov    %eax,%edi
+ 434:	eb e1                	jmp    417 <printf+0x45>
+      if(c == 'd'){
+ 436:	83 f8 25             	cmp    $0x25,%eax
+ 439:	0f 84 f4 00 00 00    	je     533 <printf+0x161>
+ 43f:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 442:	83 fa 15             	cmp    $0x15,%edx
+ 445:	0f 87 09 01 00 00    	ja     554 <printf+0x182>
+ 44b:	0f 87 03 01 00 00    	ja     554 <printf+0x182>
+ 451:	ff 24 95 d8 06 00 00 	jmp    *0x6d8(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 458:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 45b:	8b 17                	mov    (%edi),%edx
+ 45d:	83 ec 0c             	sub    $0xc,%esp
+ 460:	6a 01                	push   $0x1
+ 462:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 467:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46a:	e8 cb fe ff ff       	call   33a <printint>
+        ap++;
+ 46f:	83 c7 04             	add    $0x4,%edi
+ 472:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 475:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 478:	bf 00 00 00 00       	mov    $0x0,%edi
+ 47d:	eb 98                	jmp    417 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 47f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 482:	8b 17                	mov    (%edi),%edx
+ 484:	83 ec 0c             	sub    $0xc,%esp
+ 487:	6a 00                	push   $0x0
+ 489:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 48e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 491:	e8 a4 fe ff ff       	call   33a <printint>
+        ap++;
+ 496:	83 c7 04             	add    $0x4,%edi
+ 499:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 49c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 49f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4a4:	e9 6e ff ff ff       	jmp    417 <printf+0x45>
+        s = (char*)*ap;
+ 4a9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 4ac:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 4ae:	83 c1 04             	add    $0x4,%ecx
+ 4b1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 4b4:	85 c0                	test   %eax,%eax
+ 4b6:	74 13                	je     4cb <printf+0xf9>
+        s = (char*)*ap;
+ 4b8:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 4ba:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 4bd:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 4c2:	84 c0                	test   %al,%al
+ 4c4:	75 0f                	jne    4d5 <printf+0x103>
+ 4c6:	e9 4c ff ff ff       	jmp    417 <printf+0x45>
+          s = "(null)";
+ 4cb:	bb d1 06 00 00       	mov    $0x6d1,%ebx
+        while(*s != 0){
+ 4d0:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 4d5:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 4d8:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 4db:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 4de:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4e1:	83 ec 04             	sub    $0x4,%esp
+ 4e4:	6a 01                	push   $0x1
+ 4e6:	57                   	push   %edi
+ 4e7:	56                   	push   %esi
+ 4e8:	e8 5d fd ff ff       	call   24a <write>
+          s++;
+ 4ed:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 4f0:	0f b6 03             	movzbl (%ebx),%eax
+ 4f3:	83 c4 10             	add    $0x10,%esp
+ 4f6:	84 c0                	test   %al,%al
+ 4f8:	75 e4                	jne    4de <printf+0x10c>
+      state = 0;
+ 4fa:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4fd:	bf 00 00 00 00       	mov    $0x0,%edi
+ 502:	e9 10 ff ff ff       	jmp    417 <printf+0x45>
+        putc(fd, *ap);
+ 507:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 50a:	8b 07                	mov    (%edi),%eax
+ 50c:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 50f:	83 ec 04             	sub    $0x4,%esp
+ 512:	6a 01                	push   $0x1
+ 514:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 517:	50                   	push   %eax
+ 518:	ff 75 08             	push   0x8(%ebp)
+ 51b:	e8 2a fd ff ff       	call   24a <write>
+        ap++;
+ 520:	83 c7 04             	add    $0x4,%edi
+ 523:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 526:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 529:	bf 00 00 00 00       	mov    $0x0,%edi
+ 52e:	e9 e4 fe ff ff       	jmp    417 <printf+0x45>
+        putc(fd, c);
+ 533:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 536:	83 ec 04             	sub    $0x4,%esp
+ 539:	6a 01                	push   $0x1
+ 53b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 53e:	50                   	push   %eax
+ 53f:	ff 75 08             	push   0x8(%ebp)
+ 542:	e8 03 fd ff ff       	call   24a <write>
+ 547:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 54a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 54f:	e9 c3 fe ff ff       	jmp    417 <printf+0x45>
+        putc(fd, '%');
+ 554:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 558:	83 ec 04             	sub    $0x4,%esp
+ 55b:	6a 01                	push   $0x1
+ 55d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 560:	57                   	push   %edi
+ 561:	ff 75 08             	push   0x8(%ebp)
+ 564:	e8 e1 fc ff ff       	call   24a <write>
+        putc(fd, c);
+ 569:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 56c:	83 c4 0c             	add    $0xc,%esp
+ 56f:	6a 01                	push   $0x1
+ 571:	57                   	push   %edi
+ 572:	ff 75 08             	push   0x8(%ebp)
+ 575:	e8 d0 fc ff ff       	call   24a <write>
+        putc(fd, c);
+ 57a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 57d:	bf 00 00 00 00       	mov    $0x0,%edi
+ 582:	e9 90 fe ff ff       	jmp    417 <printf+0x45>
+    }
+  }
+}
+ 587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 58a:	5b                   	pop    %ebx
+ 58b:	5e                   	pop    %esi
+ 58c:	5f                   	pop    %edi
+ 58d:	5d                   	pop    %ebp
+ 58e:	c3                   	ret
+
+0000058f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 58f:	55                   	push   %ebp
+ 590:	89 e5                	mov    %esp,%ebp
+ 592:	57                   	push   %edi
+ 593:	56                   	push   %esi
+ 594:	53                   	push   %ebx
+ 595:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 598:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 59b:	a1 a4 09 00 00       	mov    0x9a4,%eax
+ 5a0:	eb 0c                	jmp    5ae <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5a2:	8b 10                	mov    (%eax),%edx
+ 5a4:	39 d0                	cmp    %edx,%eax
+ 5a6:	72 04                	jb     5ac <free+0x1d>
+ 5a8:	39 d1                	cmp    %edx,%ecx
+ 5aa:	72 10                	jb     5bc <free+0x2d>
+{
+ 5ac:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5ae:	39 c8                	cmp    %ecx,%eax
+ 5b0:	73 f0                	jae    5a2 <free+0x13>
+ 5b2:	8b 10                	mov    (%eax),%edx
+ 5b4:	39 d1                	cmp    %edx,%ecx
+ 5b6:	72 04                	jb     5bc <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5b8:	39 d0                	cmp    %edx,%eax
+ 5ba:	72 f0                	jb     5ac <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5bc:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5bf:	8b 10                	mov    (%eax),%edx
+ 5c1:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5c4:	39 fa                	cmp    %edi,%edx
+ 5c6:	74 19                	je     5e1 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5c8:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 5cb:	8b 50 04             	mov    0x4(%eax),%edx
+ 5ce:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5d1:	39 f1                	cmp    %esi,%ecx
+ 5d3:	74 18                	je     5ed <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 5d5:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 5d7:	a3 a4 09 00 00       	mov    %eax,0x9a4
+}
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5e1:	03 72 04             	add    0x4(%edx),%esi
+ 5e4:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5e7:	8b 10                	mov    (%eax),%edx
+ 5e9:	8b 12                	mov    (%edx),%edx
+ 5eb:	eb db                	jmp    5c8 <free+0x39>
+    p->s.size += bp->s.size;
+ 5ed:	03 53 fc             	add    -0x4(%ebx),%edx
+ 5f0:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 5f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 5f6:	eb dd                	jmp    5d5 <free+0x46>
+
+000005f8 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 5f8:	55                   	push   %ebp
+ 5f9:	89 e5                	mov    %esp,%ebp
+ 5fb:	57                   	push   %edi
+ 5fc:	56                   	push   %esi
+ 5fd:	53                   	push   %ebx
+ 5fe:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 601:	8b 45 08             	mov    0x8(%ebp),%eax
+ 604:	8d 58 07             	lea    0x7(%eax),%ebx
+ 607:	c1 eb 03             	shr    $0x3,%ebx
+ 60a:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 60d:	8b 15 a4 09 00 00    	mov    0x9a4,%edx
+ 613:	85 d2                	test   %edx,%edx
+ 615:	74 1c                	je     633 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 617:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 619:	8b 48 04             	mov    0x4(%eax),%ecx
+ 61c:	39 d9                	cmp    %ebx,%ecx
+ 61e:	73 38                	jae    658 <malloc+0x60>
+  if(nu < 4096)
+ 620:	be 00 10 00 00       	mov    $0x1000,%esi
+ 625:	39 f3                	cmp    %esi,%ebx
+ 627:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 62a:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 631:	eb 72                	jmp    6a5 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 633:	c7 05 a4 09 00 00 a8 	movl   $0x9a8,0x9a4
+ 63a:	09 00 00 
+ 63d:	c7 05 a8 09 00 00 a8 	movl   $0x9a8,0x9a8
+ 644:	09 00 00 
+    base.s.size = 0;
+ 647:	c7 05 ac 09 00 00 00 	movl   $0x0,0x9ac
+ 64e:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 651:	b8 a8 09 00 00       	mov    $0x9a8,%eax
+    if(p->s.size >= nunits){
+ 656:	eb c8                	jmp    620 <malloc+0x28>
+      if(p->s.size == nunits)
+ 658:	39 cb                	cmp    %ecx,%ebx
+ 65a:	74 1e                	je     67a <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 65c:	29 d9                	sub    %ebx,%ecx
+ 65e:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 661:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 664:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 667:	89 15 a4 09 00 00    	mov    %edx,0x9a4
+      return (void*)(p + 1);
+ 66d:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 670:	89 d0                	mov    %edx,%eax
+ 672:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 675:	5b                   	pop    %ebx
+ 676:	5e                   	pop    %esi
+ 677:	5f                   	pop    %edi
+ 678:	5d                   	pop    %ebp
+ 679:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 67a:	8b 08                	mov    (%eax),%ecx
+ 67c:	89 0a                	mov    %ecx,(%edx)
+ 67e:	eb e7                	jmp    667 <malloc+0x6f>
+  hp->s.size = nu;
+ 680:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	83 c0 08             	add    $0x8,%eax
+ 689:	50                   	push   %eax
+ 68a:	e8 00 ff ff ff       	call   58f <free>
+  return freep;
+ 68f:	8b 15 a4 09 00 00    	mov    0x9a4,%edx
+      if((p = morecore(nunits)) == 0)
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	85 d2                	test   %edx,%edx
+ 69a:	74 d4                	je     670 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 69c:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 69e:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6a1:	39 d9                	cmp    %ebx,%ecx
+ 6a3:	73 b3                	jae    658 <malloc+0x60>
+    if(p == freep)
+ 6a5:	89 c2                	mov    %eax,%edx
+ 6a7:	39 05 a4 09 00 00    	cmp    %eax,0x9a4
+ 6ad:	75 ed                	jne    69c <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 6af:	83 ec 0c             	sub    $0xc,%esp
+ 6b2:	57                   	push   %edi
+ 6b3:	e8 fa fb ff ff       	call   2b2 <sbrk>
+  if(p == (char*)-1)
+ 6b8:	83 c4 10             	add    $0x10,%esp
+ 6bb:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6be:	75 c0                	jne    680 <malloc+0x88>
+        return 0;
+ 6c0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6c5:	eb a9                	jmp    670 <malloc+0x78>
@@ -0,0 +1,694 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 10             	sub    $0x10,%esp
+   7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+   a:	53                   	push   %ebx
+   b:	e8 36 01 00 00       	call   146 <strlen>
+  10:	83 c4 0c             	add    $0xc,%esp
+  13:	50                   	push   %eax
+  14:	53                   	push   %ebx
+  15:	ff 75 08             	push   0x8(%ebp)
+  18:	e8 c2 02 00 00       	call   2df <write>
+}
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  23:	c9                   	leave
+  24:	c3                   	ret
+
+00000025 <forktest>:
+
+void
+forktest(void)
+{
+  25:	55                   	push   %ebp
+  26:	89 e5                	mov    %esp,%ebp
+  28:	53                   	push   %ebx
+  29:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2c:	68 d0 03 00 00       	push   $0x3d0
+  31:	6a 01                	push   $0x1
+  33:	e8 c8 ff ff ff       	call   0 <printf>
+  38:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<N; n++){
+  3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    pid = fork();
+  40:	e8 72 02 00 00       	call   2b7 <fork>
+    if(pid < 0)
+  45:	85 c0                	test   %eax,%eax
+  47:	78 2b                	js     74 <forktest+0x4f>
+      break;
+    if(pid == 0)
+  49:	74 24                	je     6f <forktest+0x4a>
+  for(n=0; n<N; n++){
+  4b:	83 c3 01             	add    $0x1,%ebx
+  4e:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  54:	75 ea                	jne    40 <forktest+0x1b>
+      exit();
+  }
+
+  if(n == N){
+    printf(1, "fork claimed to work N times!\n", N);
+  56:	83 ec 04             	sub    $0x4,%esp
+  59:	68 e8 03 00 00       	push   $0x3e8
+  5e:	68 10 04 00 00       	push   $0x410
+  63:	6a 01                	push   $0x1
+  65:	e8 96 ff ff ff       	call   0 <printf>
+    exit();
+  6a:	e8 50 02 00 00       	call   2bf <exit>
+      exit();
+  6f:	e8 4b 02 00 00       	call   2bf <exit>
+  if(n == N){
+  74:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7a:	74 da                	je     56 <forktest+0x31>
+  }
+
+  for(; n > 0; n--){
+  7c:	85 db                	test   %ebx,%ebx
+  7e:	7e 16                	jle    96 <forktest+0x71>
+    if(wait(0) < 0){
+  80:	83 ec 0c             	sub    $0xc,%esp
+  83:	6a 00                	push   $0x0
+  85:	e8 3d 02 00 00       	call   2c7 <wait>
+  8a:	83 c4 10             	add    $0x10,%esp
+  8d:	85 c0                	test   %eax,%eax
+  8f:	78 2e                	js     bf <forktest+0x9a>
+  for(; n > 0; n--){
+  91:	83 eb 01             	sub    $0x1,%ebx
+  94:	75 ea                	jne    80 <forktest+0x5b>
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+
+  if(wait(0) != -1){
+  96:	83 ec 0c             	sub    $0xc,%esp
+  99:	6a 00                	push   $0x0
+  9b:	e8 27 02 00 00       	call   2c7 <wait>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 2b                	jne    d3 <forktest+0xae>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+  a8:	83 ec 08             	sub    $0x8,%esp
+  ab:	68 02 04 00 00       	push   $0x402
+  b0:	6a 01                	push   $0x1
+  b2:	e8 49 ff ff ff       	call   0 <printf>
+}
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  bd:	c9                   	leave
+  be:	c3                   	ret
+      printf(1, "wait stopped early\n");
+  bf:	83 ec 08             	sub    $0x8,%esp
+  c2:	68 db 03 00 00       	push   $0x3db
+  c7:	6a 01                	push   $0x1
+  c9:	e8 32 ff ff ff       	call   0 <printf>
+      exit();
+  ce:	e8 ec 01 00 00       	call   2bf <exit>
+    printf(1, "wait got too many\n");
+  d3:	83 ec 08             	sub    $0x8,%esp
+  d6:	68 ef 03 00 00       	push   $0x3ef
+  db:	6a 01                	push   $0x1
+  dd:	e8 1e ff ff ff       	call   0 <printf>
+    exit();
+  e2:	e8 d8 01 00 00       	call   2bf <exit>
+
+000000e7 <main>:
+
+int
+main(void)
+{
+  e7:	55                   	push   %ebp
+  e8:	89 e5                	mov    %esp,%ebp
+  ea:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  ed:	e8 33 ff ff ff       	call   25 <forktest>
+  exit();
+  f2:	e8 c8 01 00 00       	call   2bf <exit>
+
+000000f7 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  f7:	55                   	push   %ebp
+  f8:	89 e5                	mov    %esp,%ebp
+  fa:	53                   	push   %ebx
+  fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 101:	b8 00 00 00 00       	mov    $0x0,%eax
+ 106:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 10a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 10d:	83 c0 01             	add    $0x1,%eax
+ 110:	84 d2                	test   %dl,%dl
+ 112:	75 f2                	jne    106 <strcpy+0xf>
+    ;
+  return os;
+}
+ 114:	89 c8                	mov    %ecx,%eax
+ 116:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 119:	c9                   	leave
+ 11a:	c3                   	ret
+
+0000011b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 11b:	55                   	push   %ebp
+ 11c:	89 e5                	mov    %esp,%ebp
+ 11e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 121:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 124:	0f b6 01             	movzbl (%ecx),%eax
+ 127:	84 c0                	test   %al,%al
+ 129:	74 11                	je     13c <strcmp+0x21>
+ 12b:	38 02                	cmp    %al,(%edx)
+ 12d:	75 0d                	jne    13c <strcmp+0x21>
+    p++, q++;
+ 12f:	83 c1 01             	add    $0x1,%ecx
+ 132:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 135:	0f b6 01             	movzbl (%ecx),%eax
+ 138:	84 c0                	test   %al,%al
+ 13a:	75 ef                	jne    12b <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 13c:	0f b6 c0             	movzbl %al,%eax
+ 13f:	0f b6 12             	movzbl (%edx),%edx
+ 142:	29 d0                	sub    %edx,%eax
+}
+ 144:	5d                   	pop    %ebp
+ 145:	c3                   	ret
+
+00000146 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 146:	55                   	push   %ebp
+ 147:	89 e5                	mov    %esp,%ebp
+ 149:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 14c:	80 3a 00             	cmpb   $0x0,(%edx)
+ 14f:	74 14                	je     165 <strlen+0x1f>
+ 151:	b8 00 00 00 00       	mov    $0x0,%eax
+ 156:	83 c0 01             	add    $0x1,%eax
+ 159:	89 c1                	mov    %eax,%ecx
+ 15b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 15f:	75 f5                	jne    156 <strlen+0x10>
+    ;
+  return n;
+}
+ 161:	89 c8                	mov    %ecx,%eax
+ 163:	5d                   	pop    %ebp
+ 164:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 165:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 16a:	eb f5                	jmp    161 <strlen+0x1b>
+
+0000016c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 16c:	55                   	push   %ebp
+ 16d:	89 e5                	mov    %esp,%ebp
+ 16f:	57                   	push   %edi
+ 170:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 173:	89 d7                	mov    %edx,%edi
+ 175:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 178:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17b:	fc                   	cld
+ 17c:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 17e:	89 d0                	mov    %edx,%eax
+ 180:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 183:	c9                   	leave
+ 184:	c3                   	ret
+
+00000185 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 185:	55                   	push   %ebp
+ 186:	89 e5                	mov    %esp,%ebp
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 18f:	0f b6 10             	movzbl (%eax),%edx
+ 192:	84 d2                	test   %dl,%dl
+ 194:	74 15                	je     1ab <strchr+0x26>
+    if(*s == c)
+ 196:	38 d1                	cmp    %dl,%cl
+ 198:	74 0f                	je     1a9 <strchr+0x24>
+  for(; *s; s++)
+ 19a:	83 c0 01             	add    $0x1,%eax
+ 19d:	0f b6 10             	movzbl (%eax),%edx
+ 1a0:	84 d2                	test   %dl,%dl
+ 1a2:	75 f2                	jne    196 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1a9:	5d                   	pop    %ebp
+ 1aa:	c3                   	ret
+  return 0;
+ 1ab:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1b0:	eb f7                	jmp    1a9 <strchr+0x24>
+
+000001b2 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1b2:	55                   	push   %ebp
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	57                   	push   %edi
+ 1b6:	56                   	push   %esi
+ 1b7:	53                   	push   %ebx
+ 1b8:	83 ec 2c             	sub    $0x2c,%esp
+ 1bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1be:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1c3:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1c6:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7d 27                	jge    1f8 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1d1:	83 ec 04             	sub    $0x4,%esp
+ 1d4:	6a 01                	push   $0x1
+ 1d6:	57                   	push   %edi
+ 1d7:	6a 00                	push   $0x0
+ 1d9:	e8 f9 00 00 00       	call   2d7 <read>
+    if(cc < 1)
+ 1de:	83 c4 10             	add    $0x10,%esp
+ 1e1:	85 c0                	test   %eax,%eax
+ 1e3:	7e 13                	jle    1f8 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1e5:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1e9:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ed:	3c 0a                	cmp    $0xa,%al
+ 1ef:	74 04                	je     1f5 <gets+0x43>
+ 1f1:	3c 0d                	cmp    $0xd,%al
+ 1f3:	75 d1                	jne    1c6 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1f5:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 1f8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1fb:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1ff:	89 f0                	mov    %esi,%eax
+ 201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 204:	5b                   	pop    %ebx
+ 205:	5e                   	pop    %esi
+ 206:	5f                   	pop    %edi
+ 207:	5d                   	pop    %ebp
+ 208:	c3                   	ret
+
+00000209 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 209:	55                   	push   %ebp
+ 20a:	89 e5                	mov    %esp,%ebp
+ 20c:	56                   	push   %esi
+ 20d:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 e4 00 00 00       	call   2ff <open>
+  if(fd < 0)
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	85 c0                	test   %eax,%eax
+ 220:	78 24                	js     246 <stat+0x3d>
+ 222:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 224:	83 ec 08             	sub    $0x8,%esp
+ 227:	ff 75 0c             	push   0xc(%ebp)
+ 22a:	50                   	push   %eax
+ 22b:	e8 e7 00 00 00       	call   317 <fstat>
+ 230:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 232:	89 1c 24             	mov    %ebx,(%esp)
+ 235:	e8 ad 00 00 00       	call   2e7 <close>
+  return r;
+ 23a:	83 c4 10             	add    $0x10,%esp
+}
+ 23d:	89 f0                	mov    %esi,%eax
+ 23f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 242:	5b                   	pop    %ebx
+ 243:	5e                   	pop    %esi
+ 244:	5d                   	pop    %ebp
+ 245:	c3                   	ret
+    return -1;
+ 246:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 24b:	eb f0                	jmp    23d <stat+0x34>
+
+0000024d <atoi>:
+
+int
+atoi(const char *s)
+{
+ 24d:	55                   	push   %ebp
+ 24e:	89 e5                	mov    %esp,%ebp
+ 250:	53                   	push   %ebx
+ 251:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 254:	0f b6 02             	movzbl (%edx),%eax
+ 257:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25a:	80 f9 09             	cmp    $0x9,%cl
+ 25d:	77 24                	ja     283 <atoi+0x36>
+  n = 0;
+ 25f:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 264:	83 c2 01             	add    $0x1,%edx
+ 267:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 26a:	0f be c0             	movsbl %al,%eax
+ 26d:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 271:	0f b6 02             	movzbl (%edx),%eax
+ 274:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 277:	80 fb 09             	cmp    $0x9,%bl
+ 27a:	76 e8                	jbe    264 <atoi+0x17>
+  return n;
+}
+ 27c:	89 c8                	mov    %ecx,%eax
+ 27e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 281:	c9                   	leave
+ 282:	c3                   	ret
+  n = 0;
+ 283:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 288:	eb f2                	jmp    27c <atoi+0x2f>
+
+0000028a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 28a:	55                   	push   %ebp
+ 28b:	89 e5                	mov    %esp,%ebp
+ 28d:	56                   	push   %esi
+ 28e:	53                   	push   %ebx
+ 28f:	8b 75 08             	mov    0x8(%ebp),%esi
+ 292:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 295:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 298:	85 db                	test   %ebx,%ebx
+ 29a:	7e 15                	jle    2b1 <memmove+0x27>
+ 29c:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 29e:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2a0:	83 c2 01             	add    $0x1,%edx
+ 2a3:	83 c0 01             	add    $0x1,%eax
+ 2a6:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2aa:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2ad:	39 c3                	cmp    %eax,%ebx
+ 2af:	75 ef                	jne    2a0 <memmove+0x16>
+  return vdst;
+}
+ 2b1:	89 f0                	mov    %esi,%eax
+ 2b3:	5b                   	pop    %ebx
+ 2b4:	5e                   	pop    %esi
+ 2b5:	5d                   	pop    %ebp
+ 2b6:	c3                   	ret
+
+000002b7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2b7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2bc:	cd 40                	int    $0x40
+ 2be:	c3                   	ret
+
+000002bf <exit>:
+SYSCALL(exit)
+ 2bf:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c4:	cd 40                	int    $0x40
+ 2c6:	c3                   	ret
+
+000002c7 <wait>:
+SYSCALL(wait)
+ 2c7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2cc:	cd 40                	int    $0x40
+ 2ce:	c3                   	ret
+
+000002cf <pipe>:
+SYSCALL(pipe)
+ 2cf:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d4:	cd 40                	int    $0x40
+ 2d6:	c3                   	ret
+
+000002d7 <read>:
+SYSCALL(read)
+ 2d7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2dc:	cd 40                	int    $0x40
+ 2de:	c3                   	ret
+
+000002df <write>:
+SYSCALL(write)
+ 2df:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <close>:
+SYSCALL(close)
+ 2e7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <kill>:
+SYSCALL(kill)
+ 2ef:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <exec>:
+SYSCALL(exec)
+ 2f7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <open>:
+SYSCALL(open)
+ 2ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <mknod>:
+SYSCALL(mknod)
+ 307:	b8 11 00 00 00       	mov    $0x11,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <unlink>:
+SYSCALL(unlink)
+ 30f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <fstat>:
+SYSCALL(fstat)
+ 317:	b8 08 00 00 00       	mov    $0x8,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <link>:
+SYSCALL(link)
+ 31f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <mkdir>:
+SYSCALL(mkdir)
+ 327:	b8 14 00 00 00       	mov    $0x14,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <chdir>:
+SYSCALL(chdir)
+ 32f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <dup>:
+SYSCALL(dup)
+ 337:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <getpid>:
+SYSCALL(getpid)
+ 33f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <sbrk>:
+SYSCALL(sbrk)
+ 347:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <sleep>:
+SYSCALL(sleep)
+ 34f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <uptime>:
+SYSCALL(uptime)
+ 357:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <readmouse>:
+SYSCALL(readmouse)
+ 35f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <sigsend>:
+SYSCALL(sigsend)
+ 367:	b8 17 00 00 00       	mov    $0x17,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <sigsethandler>:
+SYSCALL(sigsethandler)
+ 36f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <sigreturn>:
+SYSCALL(sigreturn)
+ 377:	b8 19 00 00 00       	mov    $0x19,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <siggetmask>:
+SYSCALL(siggetmask)
+ 37f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 387:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <sigpause>:
+SYSCALL(sigpause)
+ 38f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 397:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <sleeptick>:
+SYSCALL(sleeptick)
+ 39f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <schedctl>:
+SYSCALL(schedctl)
+ 3a7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <nswtch>:
+SYSCALL(nswtch)
+ 3af:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <getloadavg>:
+SYSCALL(getloadavg)
+ 3b7:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <memstat>:
+SYSCALL(memstat)
+ 3bf:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <iostat>:
+SYSCALL(iostat)
+ 3c7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
@@ -0,0 +1,1393 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <matchstar>:
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	8b 75 08             	mov    0x8(%ebp),%esi
+   c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+   f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+  12:	83 ec 08             	sub    $0x8,%esp
+  15:	53                   	push   %ebx
+  16:	57                   	push   %edi
+  17:	e8 2c 00 00 00       	call   48 <matchhere>
+  1c:	83 c4 10             	add    $0x10,%esp
+  1f:	85 c0                	test   %eax,%eax
+  21:	75 18                	jne    3b <matchstar+0x3b>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+  23:	0f b6 13             	movzbl (%ebx),%edx
+  26:	84 d2                	test   %dl,%dl
+  28:	74 16                	je     40 <matchstar+0x40>
+  2a:	83 c3 01             	add    $0x1,%ebx
+  2d:	83 fe 2e             	cmp    $0x2e,%esi
+  30:	74 e0                	je     12 <matchstar+0x12>
+  32:	0f be d2             	movsbl %dl,%edx
+  35:	39 f2                	cmp    %esi,%edx
+  37:	74 d9                	je     12 <matchstar+0x12>
+  39:	eb 05                	jmp    40 <matchstar+0x40>
+      return 1;
+  3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  return 0;
+}
+  40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  43:	5b                   	pop    %ebx
+  44:	5e                   	pop    %esi
+  45:	5f                   	pop    %edi
+  46:	5d                   	pop    %ebp
+  47:	c3                   	ret
+
+00000048 <matchhere>:
+{
+  48:	55                   	push   %ebp
+  49:	89 e5                	mov    %esp,%ebp
+  4b:	53                   	push   %ebx
+  4c:	83 ec 04             	sub    $0x4,%esp
+  4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  if(re[0] == '\0')
+  52:	0f b6 0a             	movzbl (%edx),%ecx
+    return 1;
+  55:	b8 01 00 00 00       	mov    $0x1,%eax
+  if(re[0] == '\0')
+  5a:	84 c9                	test   %cl,%cl
+  5c:	74 29                	je     87 <matchhere+0x3f>
+  if(re[1] == '*')
+  5e:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+  62:	3c 2a                	cmp    $0x2a,%al
+  64:	74 26                	je     8c <matchhere+0x44>
+  if(re[0] == '$' && re[1] == '\0')
+  66:	84 c0                	test   %al,%al
+  68:	75 05                	jne    6f <matchhere+0x27>
+  6a:	80 f9 24             	cmp    $0x24,%cl
+  6d:	74 35                	je     a4 <matchhere+0x5c>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  72:	0f b6 18             	movzbl (%eax),%ebx
+  return 0;
+  75:	b8 00 00 00 00       	mov    $0x0,%eax
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  7a:	84 db                	test   %bl,%bl
+  7c:	74 09                	je     87 <matchhere+0x3f>
+  7e:	38 d9                	cmp    %bl,%cl
+  80:	74 30                	je     b2 <matchhere+0x6a>
+  82:	80 f9 2e             	cmp    $0x2e,%cl
+  85:	74 2b                	je     b2 <matchhere+0x6a>
+}
+  87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8a:	c9                   	leave
+  8b:	c3                   	ret
+    return matchstar(re[0], re+2, text);
+  8c:	83 ec 04             	sub    $0x4,%esp
+  8f:	ff 75 0c             	push   0xc(%ebp)
+  92:	83 c2 02             	add    $0x2,%edx
+  95:	52                   	push   %edx
+  96:	0f be c9             	movsbl %cl,%ecx
+  99:	51                   	push   %ecx
+  9a:	e8 61 ff ff ff       	call   0 <matchstar>
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	eb e3                	jmp    87 <matchhere+0x3f>
+    return *text == '\0';
+  a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a7:	80 38 00             	cmpb   $0x0,(%eax)
+  aa:	0f 94 c0             	sete   %al
+  ad:	0f b6 c0             	movzbl %al,%eax
+  b0:	eb d5                	jmp    87 <matchhere+0x3f>
+    return matchhere(re+1, text+1);
+  b2:	83 ec 08             	sub    $0x8,%esp
+  b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b8:	83 c0 01             	add    $0x1,%eax
+  bb:	50                   	push   %eax
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	52                   	push   %edx
+  c0:	e8 83 ff ff ff       	call   48 <matchhere>
+  c5:	83 c4 10             	add    $0x10,%esp
+  c8:	eb bd                	jmp    87 <matchhere+0x3f>
+
+000000ca <match>:
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+  cd:	56                   	push   %esi
+  ce:	53                   	push   %ebx
+  cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '^')
+  d5:	80 3e 5e             	cmpb   $0x5e,(%esi)
+  d8:	74 1c                	je     f6 <match+0x2c>
+    if(matchhere(re, text))
+  da:	83 ec 08             	sub    $0x8,%esp
+  dd:	53                   	push   %ebx
+  de:	56                   	push   %esi
+  df:	e8 64 ff ff ff       	call   48 <matchhere>
+  e4:	83 c4 10             	add    $0x10,%esp
+  e7:	85 c0                	test   %eax,%eax
+  e9:	75 1d                	jne    108 <match+0x3e>
+  }while(*text++ != '\0');
+  eb:	83 c3 01             	add    $0x1,%ebx
+  ee:	80 7b ff 00          	cmpb   $0x0,-0x1(%ebx)
+  f2:	75 e6                	jne    da <match+0x10>
+  f4:	eb 17                	jmp    10d <match+0x43>
+    return matchhere(re+1, text);
+  f6:	83 ec 08             	sub    $0x8,%esp
+  f9:	53                   	push   %ebx
+  fa:	83 c6 01             	add    $0x1,%esi
+  fd:	56                   	push   %esi
+  fe:	e8 45 ff ff ff       	call   48 <matchhere>
+ 103:	83 c4 10             	add    $0x10,%esp
+ 106:	eb 05                	jmp    10d <match+0x43>
+      return 1;
+ 108:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 10d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 110:	5b                   	pop    %ebx
+ 111:	5e                   	pop    %esi
+ 112:	5d                   	pop    %ebp
+ 113:	c3                   	ret
+
+00000114 <grep>:
+{
+ 114:	55                   	push   %ebp
+ 115:	89 e5                	mov    %esp,%ebp
+ 117:	57                   	push   %edi
+ 118:	56                   	push   %esi
+ 119:	53                   	push   %ebx
+ 11a:	83 ec 1c             	sub    $0x1c,%esp
+ 11d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  m = 0;
+ 120:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 125:	eb 53                	jmp    17a <grep+0x66>
+      p = q+1;
+ 127:	8d 73 01             	lea    0x1(%ebx),%esi
+    while((q = strchr(p, '\n')) != 0){
+ 12a:	83 ec 08             	sub    $0x8,%esp
+ 12d:	6a 0a                	push   $0xa
+ 12f:	56                   	push   %esi
+ 130:	e8 e1 01 00 00       	call   316 <strchr>
+ 135:	89 c3                	mov    %eax,%ebx
+ 137:	83 c4 10             	add    $0x10,%esp
+ 13a:	85 c0                	test   %eax,%eax
+ 13c:	74 2d                	je     16b <grep+0x57>
+      *q = 0;
+ 13e:	c6 03 00             	movb   $0x0,(%ebx)
+      if(match(pattern, p)){
+ 141:	83 ec 08             	sub    $0x8,%esp
+ 144:	56                   	push   %esi
+ 145:	57                   	push   %edi
+ 146:	e8 7f ff ff ff       	call   ca <match>
+ 14b:	83 c4 10             	add    $0x10,%esp
+ 14e:	85 c0                	test   %eax,%eax
+ 150:	74 d5                	je     127 <grep+0x13>
+        *q = '\n';
+ 152:	c6 03 0a             	movb   $0xa,(%ebx)
+        write(1, p, q+1 - p);
+ 155:	83 ec 04             	sub    $0x4,%esp
+ 158:	8d 43 01             	lea    0x1(%ebx),%eax
+ 15b:	29 f0                	sub    %esi,%eax
+ 15d:	50                   	push   %eax
+ 15e:	56                   	push   %esi
+ 15f:	6a 01                	push   $0x1
+ 161:	e8 0a 03 00 00       	call   470 <write>
+ 166:	83 c4 10             	add    $0x10,%esp
+ 169:	eb bc                	jmp    127 <grep+0x13>
+    if(p == buf)
+ 16b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+ 16e:	81 fe c0 0c 00 00    	cmp    $0xcc0,%esi
+ 174:	74 3b                	je     1b1 <grep+0x9d>
+    if(m > 0){
+ 176:	85 db                	test   %ebx,%ebx
+ 178:	7f 3e                	jg     1b8 <grep+0xa4>
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 17a:	83 ec 04             	sub    $0x4,%esp
+ 17d:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 182:	29 d8                	sub    %ebx,%eax
+ 184:	50                   	push   %eax
+ 185:	8d 83 c0 0c 00 00    	lea    0xcc0(%ebx),%eax
+ 18b:	50                   	push   %eax
+ 18c:	ff 75 0c             	push   0xc(%ebp)
+ 18f:	e8 d4 02 00 00       	call   468 <read>
+ 194:	83 c4 10             	add    $0x10,%esp
+ 197:	85 c0                	test   %eax,%eax
+ 199:	7e 3a                	jle    1d5 <grep+0xc1>
+    m += n;
+ 19b:	01 c3                	add    %eax,%ebx
+    buf[m] = '\0';
+ 19d:	c6 83 c0 0c 00 00 00 	movb   $0x0,0xcc0(%ebx)
+    p = buf;
+ 1a4:	be c0 0c 00 00       	mov    $0xcc0,%esi
+ 1a9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+ 1ac:	e9 79 ff ff ff       	jmp    12a <grep+0x16>
+      m = 0;
+ 1b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1b6:	eb c2                	jmp    17a <grep+0x66>
+      m -= p - buf;
+ 1b8:	89 f0                	mov    %esi,%eax
+ 1ba:	2d c0 0c 00 00       	sub    $0xcc0,%eax
+ 1bf:	29 c3                	sub    %eax,%ebx
+      memmove(buf, p, m);
+ 1c1:	83 ec 04             	sub    $0x4,%esp
+ 1c4:	53                   	push   %ebx
+ 1c5:	56                   	push   %esi
+ 1c6:	68 c0 0c 00 00       	push   $0xcc0
+ 1cb:	e8 4b 02 00 00       	call   41b <memmove>
+ 1d0:	83 c4 10             	add    $0x10,%esp
+ 1d3:	eb a5                	jmp    17a <grep+0x66>
+}
+ 1d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1d8:	5b                   	pop    %ebx
+ 1d9:	5e                   	pop    %esi
+ 1da:	5f                   	pop    %edi
+ 1db:	5d                   	pop    %ebp
+ 1dc:	c3                   	ret
+
+000001dd <main>:
+{
+ 1dd:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1e1:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1e4:	ff 71 fc             	push   -0x4(%ecx)
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	57                   	push   %edi
+ 1eb:	56                   	push   %esi
+ 1ec:	53                   	push   %ebx
+ 1ed:	51                   	push   %ecx
+ 1ee:	83 ec 18             	sub    $0x18,%esp
+ 1f1:	8b 01                	mov    (%ecx),%eax
+ 1f3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 1f6:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc <= 1){
+ 1f9:	83 f8 01             	cmp    $0x1,%eax
+ 1fc:	7e 50                	jle    24e <main+0x71>
+  pattern = argv[1];
+ 1fe:	8b 46 04             	mov    0x4(%esi),%eax
+ 201:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+ 204:	83 c6 08             	add    $0x8,%esi
+  for(i = 2; i < argc; i++){
+ 207:	bf 02 00 00 00       	mov    $0x2,%edi
+  if(argc <= 2){
+ 20c:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+ 210:	7e 50                	jle    262 <main+0x85>
+    if((fd = open(argv[i], 0)) < 0){
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	6a 00                	push   $0x0
+ 217:	ff 36                	push   (%esi)
+ 219:	e8 72 02 00 00       	call   490 <open>
+ 21e:	89 c3                	mov    %eax,%ebx
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	85 c0                	test   %eax,%eax
+ 225:	78 4b                	js     272 <main+0x95>
+    grep(pattern, fd);
+ 227:	83 ec 08             	sub    $0x8,%esp
+ 22a:	50                   	push   %eax
+ 22b:	ff 75 e0             	push   -0x20(%ebp)
+ 22e:	e8 e1 fe ff ff       	call   114 <grep>
+    close(fd);
+ 233:	89 1c 24             	mov    %ebx,(%esp)
+ 236:	e8 3d 02 00 00       	call   478 <close>
+  for(i = 2; i < argc; i++){
+ 23b:	83 c7 01             	add    $0x1,%edi
+ 23e:	83 c6 04             	add    $0x4,%esi
+ 241:	83 c4 10             	add    $0x10,%esp
+ 244:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 247:	75 c9                	jne    212 <main+0x35>
+  exit();
+ 249:	e8 02 02 00 00       	call   450 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 24e:	83 ec 08             	sub    $0x8,%esp
+ 251:	68 f0 08 00 00       	push   $0x8f0
+ 256:	6a 02                	push   $0x2
+ 258:	e8 9b 03 00 00       	call   5f8 <printf>
+    exit();
+ 25d:	e8 ee 01 00 00       	call   450 <exit>
+    grep(pattern, 0);
+ 262:	83 ec 08             	sub    $0x8,%esp
+ 265:	6a 00                	push   $0x0
+ 267:	50                   	push   %eax
+ 268:	e8 a7 fe ff ff       	call   114 <grep>
+    exit();
+ 26d:	e8 de 01 00 00       	call   450 <exit>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 272:	83 ec 04             	sub    $0x4,%esp
+ 275:	ff 36                	push   (%esi)
+ 277:	68 10 09 00 00       	push   $0x910
+ 27c:	6a 01                	push   $0x1
+ 27e:	e8 75 03 00 00       	call   5f8 <printf>
+      exit();
+ 283:	e8 c8 01 00 00       	call   450 <exit>
+
+00000288 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 288:	55                   	push   %ebp
+ 289:	89 e5                	mov    %esp,%ebp
+ 28b:	53                   	push   %ebx
+ 28c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 28f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 292:	b8 00 00 00 00       	mov    $0x0,%eax
+ 297:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 29b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 29e:	83 c0 01             	add    $0x1,%eax
+ 2a1:	84 d2                	test   %dl,%dl
+ 2a3:	75 f2                	jne    297 <strcpy+0xf>
+    ;
+  return os;
+}
+ 2a5:	89 c8                	mov    %ecx,%eax
+ 2a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2aa:	c9                   	leave
+ 2ab:	c3                   	ret
+
+000002ac <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2ac:	55                   	push   %ebp
+ 2ad:	89 e5                	mov    %esp,%ebp
+ 2af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 2b5:	0f b6 01             	movzbl (%ecx),%eax
+ 2b8:	84 c0                	test   %al,%al
+ 2ba:	74 11                	je     2cd <strcmp+0x21>
+ 2bc:	38 02                	cmp    %al,(%edx)
+ 2be:	75 0d                	jne    2cd <strcmp+0x21>
+    p++, q++;
+ 2c0:	83 c1 01             	add    $0x1,%ecx
+ 2c3:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 2c6:	0f b6 01             	movzbl (%ecx),%eax
+ 2c9:	84 c0                	test   %al,%al
+ 2cb:	75 ef                	jne    2bc <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 c0             	movzbl %al,%eax
+ 2d0:	0f b6 12             	movzbl (%edx),%edx
+ 2d3:	29 d0                	sub    %edx,%eax
+}
+ 2d5:	5d                   	pop    %ebp
+ 2d6:	c3                   	ret
+
+000002d7 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2d7:	55                   	push   %ebp
+ 2d8:	89 e5                	mov    %esp,%ebp
+ 2da:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2dd:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e0:	74 14                	je     2f6 <strlen+0x1f>
+ 2e2:	b8 00 00 00 00       	mov    $0x0,%eax
+ 2e7:	83 c0 01             	add    $0x1,%eax
+ 2ea:	89 c1                	mov    %eax,%ecx
+ 2ec:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f0:	75 f5                	jne    2e7 <strlen+0x10>
+    ;
+  return n;
+}
+ 2f2:	89 c8                	mov    %ecx,%eax
+ 2f4:	5d                   	pop    %ebp
+ 2f5:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 2f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2fb:	eb f5                	jmp    2f2 <strlen+0x1b>
+
+000002fd <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2fd:	55                   	push   %ebp
+ 2fe:	89 e5                	mov    %esp,%ebp
+ 300:	57                   	push   %edi
+ 301:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 309:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 30c:	fc                   	cld
+ 30d:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 30f:	89 d0                	mov    %edx,%eax
+ 311:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 314:	c9                   	leave
+ 315:	c3                   	ret
+
+00000316 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 316:	55                   	push   %ebp
+ 317:	89 e5                	mov    %esp,%ebp
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 320:	0f b6 10             	movzbl (%eax),%edx
+ 323:	84 d2                	test   %dl,%dl
+ 325:	74 15                	je     33c <strchr+0x26>
+    if(*s == c)
+ 327:	38 d1                	cmp    %dl,%cl
+ 329:	74 0f                	je     33a <strchr+0x24>
+  for(; *s; s++)
+ 32b:	83 c0 01             	add    $0x1,%eax
+ 32e:	0f b6 10             	movzbl (%eax),%edx
+ 331:	84 d2                	test   %dl,%dl
+ 333:	75 f2                	jne    327 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 335:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 33a:	5d                   	pop    %ebp
+ 33b:	c3                   	ret
+  return 0;
+ 33c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 341:	eb f7                	jmp    33a <strchr+0x24>
+
+00000343 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 343:	55                   	push   %ebp
+ 344:	89 e5                	mov    %esp,%ebp
+ 346:	57                   	push   %edi
+ 347:	56                   	push   %esi
+ 348:	53                   	push   %ebx
+ 349:	83 ec 2c             	sub    $0x2c,%esp
+ 34c:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 34f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 354:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 357:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 35a:	83 c3 01             	add    $0x1,%ebx
+ 35d:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 360:	7d 27                	jge    389 <gets+0x46>
+    cc = read(0, &c, 1);
+ 362:	83 ec 04             	sub    $0x4,%esp
+ 365:	6a 01                	push   $0x1
+ 367:	57                   	push   %edi
+ 368:	6a 00                	push   $0x0
+ 36a:	e8 f9 00 00 00       	call   468 <read>
+    if(cc < 1)
+ 36f:	83 c4 10             	add    $0x10,%esp
+ 372:	85 c0                	test   %eax,%eax
+ 374:	7e 13                	jle    389 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 376:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 37a:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37e:	3c 0a                	cmp    $0xa,%al
+ 380:	74 04                	je     386 <gets+0x43>
+ 382:	3c 0d                	cmp    $0xd,%al
+ 384:	75 d1                	jne    357 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 386:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 389:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 38c:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 390:	89 f0                	mov    %esi,%eax
+ 392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 395:	5b                   	pop    %ebx
+ 396:	5e                   	pop    %esi
+ 397:	5f                   	pop    %edi
+ 398:	5d                   	pop    %ebp
+ 399:	c3                   	ret
+
+0000039a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+ 39d:	56                   	push   %esi
+ 39e:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 39f:	83 ec 08             	sub    $0x8,%esp
+ 3a2:	6a 00                	push   $0x0
+ 3a4:	ff 75 08             	push   0x8(%ebp)
+ 3a7:	e8 e4 00 00 00       	call   490 <open>
+  if(fd < 0)
+ 3ac:	83 c4 10             	add    $0x10,%esp
+ 3af:	85 c0                	test   %eax,%eax
+ 3b1:	78 24                	js     3d7 <stat+0x3d>
+ 3b3:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	ff 75 0c             	push   0xc(%ebp)
+ 3bb:	50                   	push   %eax
+ 3bc:	e8 e7 00 00 00       	call   4a8 <fstat>
+ 3c1:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3c3:	89 1c 24             	mov    %ebx,(%esp)
+ 3c6:	e8 ad 00 00 00       	call   478 <close>
+  return r;
+ 3cb:	83 c4 10             	add    $0x10,%esp
+}
+ 3ce:	89 f0                	mov    %esi,%eax
+ 3d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d3:	5b                   	pop    %ebx
+ 3d4:	5e                   	pop    %esi
+ 3d5:	5d                   	pop    %ebp
+ 3d6:	c3                   	ret
+    return -1;
+ 3d7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3dc:	eb f0                	jmp    3ce <stat+0x34>
+
+000003de <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3de:	55                   	push   %ebp
+ 3df:	89 e5                	mov    %esp,%ebp
+ 3e1:	53                   	push   %ebx
+ 3e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3e5:	0f b6 02             	movzbl (%edx),%eax
+ 3e8:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3eb:	80 f9 09             	cmp    $0x9,%cl
+ 3ee:	77 24                	ja     414 <atoi+0x36>
+  n = 0;
+ 3f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 3f5:	83 c2 01             	add    $0x1,%edx
+ 3f8:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3fb:	0f be c0             	movsbl %al,%eax
+ 3fe:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 402:	0f b6 02             	movzbl (%edx),%eax
+ 405:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 408:	80 fb 09             	cmp    $0x9,%bl
+ 40b:	76 e8                	jbe    3f5 <atoi+0x17>
+  return n;
+}
+ 40d:	89 c8                	mov    %ecx,%eax
+ 40f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 412:	c9                   	leave
+ 413:	c3                   	ret
+  n = 0;
+ 414:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 419:	eb f2                	jmp    40d <atoi+0x2f>
+
+0000041b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 41b:	55                   	push   %ebp
+ 41c:	89 e5                	mov    %esp,%ebp
+ 41e:	56                   	push   %esi
+ 41f:	53                   	push   %ebx
+ 420:	8b 75 08             	mov    0x8(%ebp),%esi
+ 423:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 426:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 429:	85 db                	test   %ebx,%ebx
+ 42b:	7e 15                	jle    442 <memmove+0x27>
+ 42d:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 42f:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 431:	83 c2 01             	add    $0x1,%edx
+ 434:	83 c0 01             	add    $0x1,%eax
+ 437:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 43b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 43e:	39 c3                	cmp    %eax,%ebx
+ 440:	75 ef                	jne    431 <memmove+0x16>
+  return vdst;
+}
+ 442:	89 f0                	mov    %esi,%eax
+ 444:	5b                   	pop    %ebx
+ 445:	5e                   	pop    %esi
+ 446:	5d                   	pop    %ebp
+ 447:	c3                   	ret
+
+00000448 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 448:	b8 01 00 00 00       	mov    $0x1,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <exit>:
+SYSCALL(exit)
+ 450:	b8 02 00 00 00       	mov    $0x2,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <wait>:
+SYSCALL(wait)
+ 458:	b8 03 00 00 00       	mov    $0x3,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <pipe>:
+SYSCALL(pipe)
+ 460:	b8 04 00 00 00       	mov    $0x4,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <read>:
+SYSCALL(read)
+ 468:	b8 05 00 00 00       	mov    $0x5,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <write>:
+SYSCALL(write)
+ 470:	b8 10 00 00 00       	mov    $0x10,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <close>:
+SYSCALL(close)
+ 478:	b8 15 00 00 00       	mov    $0x15,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <kill>:
+SYSCALL(kill)
+ 480:	b8 06 00 00 00       	mov    $0x6,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <exec>:
+SYSCALL(exec)
+ 488:	b8 07 00 00 00       	mov    $0x7,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <open>:
+SYSCALL(open)
+ 490:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <mknod>:
+SYSCALL(mknod)
+ 498:	b8 11 00 00 00       	mov    $0x11,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <unlink>:
+SYSCALL(unlink)
+ 4a0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <fstat>:
+SYSCALL(fstat)
+ 4a8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <link>:
+SYSCALL(link)
+ 4b0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <mkdir>:
+SYSCALL(mkdir)
+ 4b8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <chdir>:
+SYSCALL(chdir)
+ 4c0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <dup>:
+SYSCALL(dup)
+ 4c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <getpid>:
+SYSCALL(getpid)
+ 4d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <sbrk>:
+SYSCALL(sbrk)
+ 4d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <sleep>:
+SYSCALL(sleep)
+ 4e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <uptime>:
+SYSCALL(uptime)
+ 4e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <readmouse>:
+SYSCALL(readmouse)
+ 4f0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <sigsend>:
+SYSCALL(sigsend)
+ 4f8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 500:	b8 18 00 00 00       	mov    $0x18,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <sigreturn>:
+SYSCALL(sigreturn)
+ 508:	b8 19 00 00 00       	mov    $0x19,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <siggetmask>:
+SYSCALL(siggetmask)
+ 510:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 518:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <sigpause>:
+SYSCALL(sigpause)
+ 520:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 528:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <sleeptick>:
+SYSCALL(sleeptick)
+ 530:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <schedctl>:
+SYSCALL(schedctl)
+ 538:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <nswtch>:
+SYSCALL(nswtch)
+ 540:	b8 20 00 00 00       	mov    $0x20,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <getloadavg>:
+SYSCALL(getloadavg)
+ 548:	b8 21 00 00 00       	mov    $0x21,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <memstat>:
+SYSCALL(memstat)
+ 550:	b8 22 00 00 00       	mov    $0x22,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <iostat>:
+SYSCALL(iostat)
+ 558:	b8 23 00 00 00       	mov    $0x23,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	83 ec 3c             	sub    $0x3c,%esp
+ 569:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 56c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 56e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 572:	74 79                	je     5ed <printint+0x8d>
+ 574:	85 d2                	test   %edx,%edx
+ 576:	79 75                	jns    5ed <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 578:	89 d1                	mov    %edx,%ecx
+ 57a:	f7 d9                	neg    %ecx
+    neg = 1;
+ 57c:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 583:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 588:	89 df                	mov    %ebx,%edi
+ 58a:	83 c3 01             	add    $0x1,%ebx
+ 58d:	89 c8                	mov    %ecx,%eax
+ 58f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 594:	f7 f6                	div    %esi
+ 596:	0f b6 92 88 09 00 00 	movzbl 0x988(%edx),%edx
+ 59d:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 5a1:	89 ca                	mov    %ecx,%edx
+ 5a3:	89 c1                	mov    %eax,%ecx
+ 5a5:	39 f2                	cmp    %esi,%edx
+ 5a7:	73 df                	jae    588 <printint+0x28>
+  if(neg)
+ 5a9:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 5ad:	74 08                	je     5b7 <printint+0x57>
+    buf[i++] = '-';
+ 5af:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 5b4:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 5b7:	85 db                	test   %ebx,%ebx
+ 5b9:	7e 2a                	jle    5e5 <printint+0x85>
+ 5bb:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 5be:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 5c2:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 5c5:	0f b6 03             	movzbl (%ebx),%eax
+ 5c8:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	6a 01                	push   $0x1
+ 5d0:	57                   	push   %edi
+ 5d1:	ff 75 c4             	push   -0x3c(%ebp)
+ 5d4:	e8 97 fe ff ff       	call   470 <write>
+  while(--i >= 0)
+ 5d9:	89 d8                	mov    %ebx,%eax
+ 5db:	83 eb 01             	sub    $0x1,%ebx
+ 5de:	83 c4 10             	add    $0x10,%esp
+ 5e1:	39 f0                	cmp    %esi,%eax
+ 5e3:	75 e0                	jne    5c5 <printint+0x65>
+}
+ 5e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5e8:	5b                   	pop    %ebx
+ 5e9:	5e                   	pop    %esi
+ 5ea:	5f                   	pop    %edi
+ 5eb:	5d                   	pop    %ebp
+ 5ec:	c3                   	ret
+    x = xx;
+ 5ed:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 5ef:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 5f6:	eb 8b                	jmp    583 <printint+0x23>
+
+000005f8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5f8:	55                   	push   %ebp
+ 5f9:	89 e5                	mov    %esp,%ebp
+ 5fb:	57                   	push   %edi
+ 5fc:	56                   	push   %esi
+ 5fd:	53                   	push   %ebx
+ 5fe:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 601:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 604:	0f b6 1e             	movzbl (%esi),%ebx
+ 607:	84 db                	test   %bl,%bl
+ 609:	0f 84 9e 01 00 00    	je     7ad <printf+0x1b5>
+ 60f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 612:	8d 45 10             	lea    0x10(%ebp),%eax
+ 615:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 618:	bf 00 00 00 00       	mov    $0x0,%edi
+ 61d:	eb 2d                	jmp    64c <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 61f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 622:	83 ec 04             	sub    $0x4,%esp
+ 625:	6a 01                	push   $0x1
+ 627:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62a:	50                   	push   %eax
+ 62b:	ff 75 08             	push   0x8(%ebp)
+ 62e:	e8 3d fe ff ff       	call   470 <write>
+        putc(fd, c);
+ 633:	83 c4 10             	add    $0x10,%esp
+ 636:	eb 05                	jmp    63d <printf+0x45>
+      }
+    } else if(state == '%'){
+ 638:	83 ff 25             	cmp    $0x25,%edi
+ 63b:	74 1f                	je     65c <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 63d:	83 c6 01             	add    $0x1,%esi
+ 640:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 644:	84 db                	test   %bl,%bl
+ 646:	0f 84 61 01 00 00    	je     7ad <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 64c:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64f:	85 ff                	test   %edi,%edi
+ 651:	75 e5                	jne    638 <printf+0x40>
+      if(c == '%'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	75 c7                	jne    61f <printf+0x27>
+        state = '%';
+ 658:	89 c7                	mov    %eax,%edi
+ 65a:	eb e1                	jmp    63d <printf+0x45>
+      if(c == 'd'){
+ 65c:	83 f8 25             	cmp    $0x25,%eax
+ 65f:	0f 84 f4 00 00 00    	je     759 <printf+0x161>
+ 665:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 668:	83 fa 15             	cmp    $0x15,%edx
+ 66b:	0f 87 09 01 00 00    	ja     77a <printf+0x182>
+ 671:	0f 87 03 01 00 00    	ja     77a <printf+0x182>
+ 677:	ff 24 95 30 09 00 00 	jmp    *0x930(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 67e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 681:	8b 17                	mov    (%edi),%edx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	6a 01                	push   $0x1
+ 688:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	e8 cb fe ff ff       	call   560 <printint>
+        ap++;
+ 695:	83 c7 04             	add    $0x4,%edi
+ 698:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 69b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 69e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6a3:	eb 98                	jmp    63d <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 6a5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 6a8:	8b 17                	mov    (%edi),%edx
+ 6aa:	83 ec 0c             	sub    $0xc,%esp
+ 6ad:	6a 00                	push   $0x0
+ 6af:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b7:	e8 a4 fe ff ff       	call   560 <printint>
+        ap++;
+ 6bc:	83 c7 04             	add    $0x4,%edi
+ 6bf:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 6c2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6c5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6ca:	e9 6e ff ff ff       	jmp    63d <printf+0x45>
+        s = (char*)*ap;
+ 6cf:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 6d2:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 6d4:	83 c1 04             	add    $0x4,%ecx
+ 6d7:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 6da:	85 c0                	test   %eax,%eax
+ 6dc:	74 13                	je     6f1 <printf+0xf9>
+        s = (char*)*ap;
+ 6de:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 6e0:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 6e3:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	75 0f                	jne    6fb <printf+0x103>
+ 6ec:	e9 4c ff ff ff       	jmp    63d <printf+0x45>
+          s = "(null)";
+ 6f1:	bb 26 09 00 00       	mov    $0x926,%ebx
+        while(*s != 0){
+ 6f6:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 6fb:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6fe:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 701:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 704:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 707:	83 ec 04             	sub    $0x4,%esp
+ 70a:	6a 01                	push   $0x1
+ 70c:	57                   	push   %edi
+ 70d:	56                   	push   %esi
+ 70e:	e8 5d fd ff ff       	call   470 <write>
+          s++;
+ 713:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 716:	0f b6 03             	movzbl (%ebx),%eax
+ 719:	83 c4 10             	add    $0x10,%esp
+ 71c:	84 c0                	test   %al,%al
+ 71e:	75 e4                	jne    704 <printf+0x10c>
+      state = 0;
+ 720:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 723:	bf 00 00 00 00       	mov    $0x0,%edi
+ 728:	e9 10 ff ff ff       	jmp    63d <printf+0x45>
+        putc(fd, *ap);
+ 72d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 730:	8b 07                	mov    (%edi),%eax
+ 732:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 735:	83 ec 04             	sub    $0x4,%esp
+ 738:	6a 01                	push   $0x1
+ 73a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 73d:	50                   	push   %eax
+ 73e:	ff 75 08             	push   0x8(%ebp)
+ 741:	e8 2a fd ff ff       	call   470 <write>
+        ap++;
+ 746:	83 c7 04             	add    $0x4,%edi
+ 749:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 74c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 754:	e9 e4 fe ff ff       	jmp    63d <printf+0x45>
+        putc(fd, c);
+ 759:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 75c:	83 ec 04             	sub    $0x4,%esp
+ 75f:	6a 01                	push   $0x1
+ 761:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 764:	50                   	push   %eax
+ 765:	ff 75 08             	push   0x8(%ebp)
+ 768:	e8 03 fd ff ff       	call   470 <write>
+ 76d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 770:	bf 00 00 00 00       	mov    $0x0,%edi
+ 775:	e9 c3 fe ff ff       	jmp    63d <printf+0x45>
+        putc(fd, '%');
+ 77a:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 77e:	83 ec 04             	sub    $0x4,%esp
+ 781:	6a 01                	push   $0x1
+ 783:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 786:	57                   	push   %edi
+ 787:	ff 75 08             	push   0x8(%ebp)
+ 78a:	e8 e1 fc ff ff       	call   470 <write>
+        putc(fd, c);
+ 78f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 792:	83 c4 0c             	add    $0xc,%esp
+ 795:	6a 01                	push   $0x1
+ 797:	57                   	push   %edi
+ 798:	ff 75 08             	push   0x8(%ebp)
+ 79b:	e8 d0 fc ff ff       	call   470 <write>
+        putc(fd, c);
+ 7a0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7a3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 7a8:	e9 90 fe ff ff       	jmp    63d <printf+0x45>
+    }
+  }
+}
+ 7ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b0:	5b                   	pop    %ebx
+ 7b1:	5e                   	pop    %esi
+ 7b2:	5f                   	pop    %edi
+ 7b3:	5d                   	pop    %ebp
+ 7b4:	c3                   	ret
+
+000007b5 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7b5:	55                   	push   %ebp
+ 7b6:	89 e5                	mov    %esp,%ebp
+ 7b8:	57                   	push   %edi
+ 7b9:	56                   	push   %esi
+ 7ba:	53                   	push   %ebx
+ 7bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 7be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c1:	a1 c0 10 00 00       	mov    0x10c0,%eax
+ 7c6:	eb 0c                	jmp    7d4 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c8:	8b 10                	mov    (%eax),%edx
+ 7ca:	39 d0                	cmp    %edx,%eax
+ 7cc:	72 04                	jb     7d2 <free+0x1d>
+ 7ce:	39 d1                	cmp    %edx,%ecx
+ 7d0:	72 10                	jb     7e2 <free+0x2d>
+{
+ 7d2:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d4:	39 c8                	cmp    %ecx,%eax
+ 7d6:	73 f0                	jae    7c8 <free+0x13>
+ 7d8:	8b 10                	mov    (%eax),%edx
+ 7da:	39 d1                	cmp    %edx,%ecx
+ 7dc:	72 04                	jb     7e2 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7de:	39 d0                	cmp    %edx,%eax
+ 7e0:	72 f0                	jb     7d2 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7e2:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7e5:	8b 10                	mov    (%eax),%edx
+ 7e7:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ea:	39 fa                	cmp    %edi,%edx
+ 7ec:	74 19                	je     807 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7ee:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7f1:	8b 50 04             	mov    0x4(%eax),%edx
+ 7f4:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 7f7:	39 f1                	cmp    %esi,%ecx
+ 7f9:	74 18                	je     813 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7fb:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 7fd:	a3 c0 10 00 00       	mov    %eax,0x10c0
+}
+ 802:	5b                   	pop    %ebx
+ 803:	5e                   	pop    %esi
+ 804:	5f                   	pop    %edi
+ 805:	5d                   	pop    %ebp
+ 806:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 807:	03 72 04             	add    0x4(%edx),%esi
+ 80a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 80d:	8b 10                	mov    (%eax),%edx
+ 80f:	8b 12                	mov    (%edx),%edx
+ 811:	eb db                	jmp    7ee <free+0x39>
+    p->s.size += bp->s.size;
+ 813:	03 53 fc             	add    -0x4(%ebx),%edx
+ 816:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 819:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 81c:	eb dd                	jmp    7fb <free+0x46>
+
+0000081e <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 81e:	55                   	push   %ebp
+ 81f:	89 e5                	mov    %esp,%ebp
+ 821:	57                   	push   %edi
+ 822:	56                   	push   %esi
+ 823:	53                   	push   %ebx
+ 824:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 827:	8b 45 08             	mov    0x8(%ebp),%eax
+ 82a:	8d 58 07             	lea    0x7(%eax),%ebx
+ 82d:	c1 eb 03             	shr    $0x3,%ebx
+ 830:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 833:	8b 15 c0 10 00 00    	mov    0x10c0,%edx
+ 839:	85 d2                	test   %edx,%edx
+ 83b:	74 1c                	je     859 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 83d:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 83f:	8b 48 04             	mov    0x4(%eax),%ecx
+ 842:	39 d9                	cmp    %ebx,%ecx
+ 844:	73 38                	jae    87e <malloc+0x60>
+  if(nu < 4096)
+ 846:	be 00 10 00 00       	mov    $0x1000,%esi
+ 84b:	39 f3                	cmp    %esi,%ebx
+ 84d:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 850:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 857:	eb 72                	jmp    8cb <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 859:	c7 05 c0 10 00 00 c4 	movl   $0x10c4,0x10c0
+ 860:	10 00 00 
+ 863:	c7 05 c4 10 00 00 c4 	movl   $0x10c4,0x10c4
+ 86a:	10 00 00 
+    base.s.size = 0;
+ 86d:	c7 05 c8 10 00 00 00 	movl   $0x0,0x10c8
+ 874:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 877:	b8 c4 10 00 00       	mov    $0x10c4,%eax
+    if(p->s.size >= nunits){
+ 87c:	eb c8                	jmp    846 <malloc+0x28>
+      if(p->s.size == nunits)
+ 87e:	39 cb                	cmp    %ecx,%ebx
+ 880:	74 1e                	je     8a0 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 882:	29 d9                	sub    %ebx,%ecx
+ 884:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 887:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 88a:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 88d:	89 15 c0 10 00 00    	mov    %edx,0x10c0
+      return (void*)(p + 1);
+ 893:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 896:	89 d0                	mov    %edx,%eax
+ 898:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 89b:	5b                   	pop    %ebx
+ 89c:	5e                   	pop    %esi
+ 89d:	5f                   	pop    %edi
+ 89e:	5d                   	pop    %ebp
+ 89f:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 8a0:	8b 08                	mov    (%eax),%ecx
+ 8a2:	89 0a                	mov    %ecx,(%edx)
+ 8a4:	eb e7                	jmp    88d <malloc+0x6f>
+  hp->s.size = nu;
+ 8a6:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 8a9:	83 ec 0c             	sub    $0xc,%esp
+ 8ac:	83 c0 08             	add    $0x8,%eax
+ 8af:	50                   	push   %eax
+ 8b0:	e8 00 ff ff ff       	call   7b5 <free>
+  return freep;
+ 8b5:	8b 15 c0 10 00 00    	mov    0x10c0,%edx
+      if((p = morecore(nunits)) == 0)
+ 8bb:	83 c4 10             	add    $0x10,%esp
+ 8be:	85 d2                	test   %edx,%edx
+ 8c0:	74 d4                	je     896 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c2:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c4:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c7:	39 d9                	cmp    %ebx,%ecx
+ 8c9:	73 b3                	jae    87e <malloc+0x60>
+    if(p == freep)
+ 8cb:	89 c2                	mov    %eax,%edx
+ 8cd:	39 05 c0 10 00 00    	cmp    %eax,0x10c0
+ 8d3:	75 ed                	jne    8c2 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 8d5:	83 ec 0c             	sub    $0xc,%esp
+ 8d8:	57                   	push   %edi
+ 8d9:	e8 fa fb ff ff       	call   4d8 <sbrk>
+  if(p == (char*)-1)
+ 8de:	83 c4 10             	add    $0x10,%esp
+ 8e1:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8e4:	75 c0                	jne    8a6 <malloc+0x88>
+        return 0;
+ 8e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8eb:	eb a9                	jmp    896 <malloc+0x78>
@@ -0,0 +1,1172 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 50 07 00 00       	push   $0x750
+  19:	e8 d2 02 00 00       	call   2f0 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	78 61                	js     86 <main+0x86>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	6a 00                	push   $0x0
+  2a:	e8 f9 02 00 00       	call   328 <dup>
+  dup(0);  // stderr
+  2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  36:	e8 ed 02 00 00       	call   328 <dup>
+  3b:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  3e:	83 ec 08             	sub    $0x8,%esp
+  41:	68 58 07 00 00       	push   $0x758
+  46:	6a 01                	push   $0x1
+  48:	e8 0b 04 00 00       	call   458 <printf>
+    pid = fork();
+  4d:	e8 56 02 00 00       	call   2a8 <fork>
+  52:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  54:	83 c4 10             	add    $0x10,%esp
+  57:	85 c0                	test   %eax,%eax
+  59:	78 53                	js     ae <main+0xae>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  5b:	74 65                	je     c2 <main+0xc2>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait(0)) >= 0 && wpid != pid)
+  5d:	83 ec 0c             	sub    $0xc,%esp
+  60:	6a 00                	push   $0x0
+  62:	e8 51 02 00 00       	call   2b8 <wait>
+  67:	83 c4 10             	add    $0x10,%esp
+  6a:	39 c3                	cmp    %eax,%ebx
+  6c:	74 d0                	je     3e <main+0x3e>
+  6e:	85 c0                	test   %eax,%eax
+  70:	78 cc                	js     3e <main+0x3e>
+      printf(1, "zombie!\n");
+  72:	83 ec 08             	sub    $0x8,%esp
+  75:	68 97 07 00 00       	push   $0x797
+  7a:	6a 01                	push   $0x1
+  7c:	e8 d7 03 00 00       	call   458 <printf>
+  81:	83 c4 10             	add    $0x10,%esp
+  84:	eb d7                	jmp    5d <main+0x5d>
+    mknod("console", 1, 1);
+  86:	83 ec 04             	sub    $0x4,%esp
+  89:	6a 01                	push   $0x1
+  8b:	6a 01                	push   $0x1
+  8d:	68 50 07 00 00       	push   $0x750
+  92:	e8 61 02 00 00       	call   2f8 <mknod>
+    open("console", O_RDWR);
+  97:	83 c4 08             	add    $0x8,%esp
+  9a:	6a 02                	push   $0x2
+  9c:	68 50 07 00 00       	push   $0x750
+  a1:	e8 4a 02 00 00       	call   2f0 <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	e9 77 ff ff ff       	jmp    25 <main+0x25>
+      printf(1, "init: fork failed\n");
+  ae:	83 ec 08             	sub    $0x8,%esp
+  b1:	68 6b 07 00 00       	push   $0x76b
+  b6:	6a 01                	push   $0x1
+  b8:	e8 9b 03 00 00       	call   458 <printf>
+      exit();
+  bd:	e8 ee 01 00 00       	call   2b0 <exit>
+      exec("sh", argv);
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	68 6c 0a 00 00       	push   $0xa6c
+  ca:	68 7e 07 00 00       	push   $0x77e
+  cf:	e8 14 02 00 00       	call   2e8 <exec>
+      printf(1, "init: exec sh failed\n");
+  d4:	83 c4 08             	add    $0x8,%esp
+  d7:	68 81 07 00 00       	push   $0x781
+  dc:	6a 01                	push   $0x1
+  de:	e8 75 03 00 00       	call   458 <printf>
+      exit();
+  e3:	e8 c8 01 00 00       	call   2b0 <exit>
+
+000000e8 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+  eb:	53                   	push   %ebx
+  ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  f7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  fb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  fe:	83 c0 01             	add    $0x1,%eax
+ 101:	84 d2                	test   %dl,%dl
+ 103:	75 f2                	jne    f7 <strcpy+0xf>
+    ;
+  return os;
+}
+ 105:	89 c8                	mov    %ecx,%eax
+ 107:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 10a:	c9                   	leave
+ 10b:	c3                   	ret
+
+0000010c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 10c:	55                   	push   %ebp
+ 10d:	89 e5                	mov    %esp,%ebp
+ 10f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 112:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 115:	0f b6 01             	movzbl (%ecx),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	74 11                	je     12d <strcmp+0x21>
+ 11c:	38 02                	cmp    %al,(%edx)
+ 11e:	75 0d                	jne    12d <strcmp+0x21>
+    p++, q++;
+ 120:	83 c1 01             	add    $0x1,%ecx
+ 123:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 126:	0f b6 01             	movzbl (%ecx),%eax
+ 129:	84 c0                	test   %al,%al
+ 12b:	75 ef                	jne    11c <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 12d:	0f b6 c0             	movzbl %al,%eax
+ 130:	0f b6 12             	movzbl (%edx),%edx
+ 133:	29 d0                	sub    %edx,%eax
+}
+ 135:	5d                   	pop    %ebp
+ 136:	c3                   	ret
+
+00000137 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 137:	55                   	push   %ebp
+ 138:	89 e5                	mov    %esp,%ebp
+ 13a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 13d:	80 3a 00             	cmpb   $0x0,(%edx)
+ 140:	74 14                	je     156 <strlen+0x1f>
+ 142:	b8 00 00 00 00       	mov    $0x0,%eax
+ 147:	83 c0 01             	add    $0x1,%eax
+ 14a:	89 c1                	mov    %eax,%ecx
+ 14c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 150:	75 f5                	jne    147 <strlen+0x10>
+    ;
+  return n;
+}
+ 152:	89 c8                	mov    %ecx,%eax
+ 154:	5d                   	pop    %ebp
+ 155:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 156:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 15b:	eb f5                	jmp    152 <strlen+0x1b>
+
+0000015d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 15d:	55                   	push   %ebp
+ 15e:	89 e5                	mov    %esp,%ebp
+ 160:	57                   	push   %edi
+ 161:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 164:	89 d7                	mov    %edx,%edi
+ 166:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 169:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16c:	fc                   	cld
+ 16d:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 16f:	89 d0                	mov    %edx,%eax
+ 171:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+
+00000176 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 176:	55                   	push   %ebp
+ 177:	89 e5                	mov    %esp,%ebp
+ 179:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 180:	0f b6 10             	movzbl (%eax),%edx
+ 183:	84 d2                	test   %dl,%dl
+ 185:	74 15                	je     19c <strchr+0x26>
+    if(*s == c)
+ 187:	38 d1                	cmp    %dl,%cl
+ 189:	74 0f                	je     19a <strchr+0x24>
+  for(; *s; s++)
+ 18b:	83 c0 01             	add    $0x1,%eax
+ 18e:	0f b6 10             	movzbl (%eax),%edx
+ 191:	84 d2                	test   %dl,%dl
+ 193:	75 f2                	jne    187 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 195:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 19a:	5d                   	pop    %ebp
+ 19b:	c3                   	ret
+  return 0;
+ 19c:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1a1:	eb f7                	jmp    19a <strchr+0x24>
+
+000001a3 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a3:	55                   	push   %ebp
+ 1a4:	89 e5                	mov    %esp,%ebp
+ 1a6:	57                   	push   %edi
+ 1a7:	56                   	push   %esi
+ 1a8:	53                   	push   %ebx
+ 1a9:	83 ec 2c             	sub    $0x2c,%esp
+ 1ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1af:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1b4:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1b7:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1ba:	83 c3 01             	add    $0x1,%ebx
+ 1bd:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1c0:	7d 27                	jge    1e9 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1c2:	83 ec 04             	sub    $0x4,%esp
+ 1c5:	6a 01                	push   $0x1
+ 1c7:	57                   	push   %edi
+ 1c8:	6a 00                	push   $0x0
+ 1ca:	e8 f9 00 00 00       	call   2c8 <read>
+    if(cc < 1)
+ 1cf:	83 c4 10             	add    $0x10,%esp
+ 1d2:	85 c0                	test   %eax,%eax
+ 1d4:	7e 13                	jle    1e9 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1d6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1da:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 04                	je     1e6 <gets+0x43>
+ 1e2:	3c 0d                	cmp    $0xd,%al
+ 1e4:	75 d1                	jne    1b7 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1e6:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 1e9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1ec:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1f0:	89 f0                	mov    %esi,%eax
+ 1f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1f5:	5b                   	pop    %ebx
+ 1f6:	5e                   	pop    %esi
+ 1f7:	5f                   	pop    %edi
+ 1f8:	5d                   	pop    %ebp
+ 1f9:	c3                   	ret
+
+000001fa <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1fa:	55                   	push   %ebp
+ 1fb:	89 e5                	mov    %esp,%ebp
+ 1fd:	56                   	push   %esi
+ 1fe:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1ff:	83 ec 08             	sub    $0x8,%esp
+ 202:	6a 00                	push   $0x0
+ 204:	ff 75 08             	push   0x8(%ebp)
+ 207:	e8 e4 00 00 00       	call   2f0 <open>
+  if(fd < 0)
+ 20c:	83 c4 10             	add    $0x10,%esp
+ 20f:	85 c0                	test   %eax,%eax
+ 211:	78 24                	js     237 <stat+0x3d>
+ 213:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 215:	83 ec 08             	sub    $0x8,%esp
+ 218:	ff 75 0c             	push   0xc(%ebp)
+ 21b:	50                   	push   %eax
+ 21c:	e8 e7 00 00 00       	call   308 <fstat>
+ 221:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 223:	89 1c 24             	mov    %ebx,(%esp)
+ 226:	e8 ad 00 00 00       	call   2d8 <close>
+  return r;
+ 22b:	83 c4 10             	add    $0x10,%esp
+}
+ 22e:	89 f0                	mov    %esi,%eax
+ 230:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 233:	5b                   	pop    %ebx
+ 234:	5e                   	pop    %esi
+ 235:	5d                   	pop    %ebp
+ 236:	c3                   	ret
+    return -1;
+ 237:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 23c:	eb f0                	jmp    22e <stat+0x34>
+
+0000023e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	53                   	push   %ebx
+ 242:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 245:	0f b6 02             	movzbl (%edx),%eax
+ 248:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24b:	80 f9 09             	cmp    $0x9,%cl
+ 24e:	77 24                	ja     274 <atoi+0x36>
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 255:	83 c2 01             	add    $0x1,%edx
+ 258:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 25b:	0f be c0             	movsbl %al,%eax
+ 25e:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 262:	0f b6 02             	movzbl (%edx),%eax
+ 265:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 268:	80 fb 09             	cmp    $0x9,%bl
+ 26b:	76 e8                	jbe    255 <atoi+0x17>
+  return n;
+}
+ 26d:	89 c8                	mov    %ecx,%eax
+ 26f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 272:	c9                   	leave
+ 273:	c3                   	ret
+  n = 0;
+ 274:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 279:	eb f2                	jmp    26d <atoi+0x2f>
+
+0000027b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 27b:	55                   	push   %ebp
+ 27c:	89 e5                	mov    %esp,%ebp
+ 27e:	56                   	push   %esi
+ 27f:	53                   	push   %ebx
+ 280:	8b 75 08             	mov    0x8(%ebp),%esi
+ 283:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 286:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 289:	85 db                	test   %ebx,%ebx
+ 28b:	7e 15                	jle    2a2 <memmove+0x27>
+ 28d:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 28f:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 291:	83 c2 01             	add    $0x1,%edx
+ 294:	83 c0 01             	add    $0x1,%eax
+ 297:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 29b:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 29e:	39 c3                	cmp    %eax,%ebx
+ 2a0:	75 ef                	jne    291 <memmove+0x16>
+  return vdst;
+}
+ 2a2:	89 f0                	mov    %esi,%eax
+ 2a4:	5b                   	pop    %ebx
+ 2a5:	5e                   	pop    %esi
+ 2a6:	5d                   	pop    %ebp
+ 2a7:	c3                   	ret
+
+000002a8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2a8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2ad:	cd 40                	int    $0x40
+ 2af:	c3                   	ret
+
+000002b0 <exit>:
+SYSCALL(exit)
+ 2b0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2b5:	cd 40                	int    $0x40
+ 2b7:	c3                   	ret
+
+000002b8 <wait>:
+SYSCALL(wait)
+ 2b8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2bd:	cd 40                	int    $0x40
+ 2bf:	c3                   	ret
+
+000002c0 <pipe>:
+SYSCALL(pipe)
+ 2c0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2c5:	cd 40                	int    $0x40
+ 2c7:	c3                   	ret
+
+000002c8 <read>:
+SYSCALL(read)
+ 2c8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2cd:	cd 40                	int    $0x40
+ 2cf:	c3                   	ret
+
+000002d0 <write>:
+SYSCALL(write)
+ 2d0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2d5:	cd 40                	int    $0x40
+ 2d7:	c3                   	ret
+
+000002d8 <close>:
+SYSCALL(close)
+ 2d8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2dd:	cd 40                	int    $0x40
+ 2df:	c3                   	ret
+
+000002e0 <kill>:
+SYSCALL(kill)
+ 2e0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2e5:	cd 40                	int    $0x40
+ 2e7:	c3                   	ret
+
+000002e8 <exec>:
+SYSCALL(exec)
+ 2e8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2ed:	cd 40                	int    $0x40
+ 2ef:	c3                   	ret
+
+000002f0 <open>:
+SYSCALL(open)
+ 2f0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2f5:	cd 40                	int    $0x40
+ 2f7:	c3                   	ret
+
+000002f8 <mknod>:
+SYSCALL(mknod)
+ 2f8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2fd:	cd 40                	int    $0x40
+ 2ff:	c3                   	ret
+
+00000300 <unlink>:
+SYSCALL(unlink)
+ 300:	b8 12 00 00 00       	mov    $0x12,%eax
+ 305:	cd 40                	int    $0x40
+ 307:	c3                   	ret
+
+00000308 <fstat>:
+SYSCALL(fstat)
+ 308:	b8 08 00 00 00       	mov    $0x8,%eax
+ 30d:	cd 40                	int    $0x40
+ 30f:	c3                   	ret
+
+00000310 <link>:
+SYSCALL(link)
+ 310:	b8 13 00 00 00       	mov    $0x13,%eax
+ 315:	cd 40                	int    $0x40
+ 317:	c3                   	ret
+
+00000318 <mkdir>:
+SYSCALL(mkdir)
+ 318:	b8 14 00 00 00       	mov    $0x14,%eax
+ 31d:	cd 40                	int    $0x40
+ 31f:	c3                   	ret
+
+00000320 <chdir>:
+SYSCALL(chdir)
+ 320:	b8 09 00 00 00       	mov    $0x9,%eax
+ 325:	cd 40                	int    $0x40
+ 327:	c3                   	ret
+
+00000328 <dup>:
+SYSCALL(dup)
+ 328:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <getpid>:
+SYSCALL(getpid)
+ 330:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <sbrk>:
+SYSCALL(sbrk)
+ 338:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <sleep>:
+SYSCALL(sleep)
+ 340:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <uptime>:
+SYSCALL(uptime)
+ 348:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <readmouse>:
+SYSCALL(readmouse)
+ 350:	b8 16 00 00 00       	mov    $0x16,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <sigsend>:
+SYSCALL(sigsend)
+ 358:	b8 17 00 00 00       	mov    $0x17,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 360:	b8 18 00 00 00       	mov    $0x18,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <sigreturn>:
+SYSCALL(sigreturn)
+ 368:	b8 19 00 00 00       	mov    $0x19,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <siggetmask>:
+SYSCALL(siggetmask)
+ 370:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 378:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <sigpause>:
+SYSCALL(sigpause)
+ 380:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 388:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <sleeptick>:
+SYSCALL(sleeptick)
+ 390:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <schedctl>:
+SYSCALL(schedctl)
+ 398:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <nswtch>:
+SYSCALL(nswtch)
+ 3a0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <getloadavg>:
+SYSCALL(getloadavg)
+ 3a8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <memstat>:
+SYSCALL(memstat)
+ 3b0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <iostat>:
+SYSCALL(iostat)
+ 3b8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	53                   	push   %ebx
+ 3c6:	83 ec 3c             	sub    $0x3c,%esp
+ 3c9:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3cc:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3ce:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3d2:	74 79                	je     44d <printint+0x8d>
+ 3d4:	85 d2                	test   %edx,%edx
+ 3d6:	79 75                	jns    44d <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 3d8:	89 d1                	mov    %edx,%ecx
+ 3da:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3dc:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3e8:	89 df                	mov    %ebx,%edi
+ 3ea:	83 c3 01             	add    $0x1,%ebx
+ 3ed:	89 c8                	mov    %ecx,%eax
+ 3ef:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3f4:	f7 f6                	div    %esi
+ 3f6:	0f b6 92 00 08 00 00 	movzbl 0x800(%edx),%edx
+ 3fd:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 401:	89 ca                	mov    %ecx,%edx
+ 403:	89 c1                	mov    %eax,%ecx
+ 405:	39 f2                	cmp    %esi,%edx
+ 407:	73 df                	jae    3e8 <printint+0x28>
+  if(neg)
+ 409:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 40d:	74 08                	je     417 <printint+0x57>
+    buf[i++] = '-';
+ 40f:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 414:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 417:	85 db                	test   %ebx,%ebx
+ 419:	7e 2a                	jle    445 <printint+0x85>
+ 41b:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 41e:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 422:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 425:	0f b6 03             	movzbl (%ebx),%eax
+ 428:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 42b:	83 ec 04             	sub    $0x4,%esp
+ 42e:	6a 01                	push   $0x1
+ 430:	57                   	push   %edi
+ 431:	ff 75 c4             	push   -0x3c(%ebp)
+ 434:	e8 97 fe ff ff       	call   2d0 <write>
+  while(--i >= 0)
+ 439:	89 d8                	mov    %ebx,%eax
+ 43b:	83 eb 01             	sub    $0x1,%ebx
+ 43e:	83 c4 10             	add    $0x10,%esp
+ 441:	39 f0                	cmp    %esi,%eax
+ 443:	75 e0                	jne    425 <printint+0x65>
+}
+ 445:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 448:	5b                   	pop    %ebx
+ 449:	5e                   	pop    %esi
+ 44a:	5f                   	pop    %edi
+ 44b:	5d                   	pop    %ebp
+ 44c:	c3                   	ret
+    x = xx;
+ 44d:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 44f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 456:	eb 8b                	jmp    3e3 <printint+0x23>
+
+00000458 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 458:	55                   	push   %ebp
+ 459:	89 e5                	mov    %esp,%ebp
+ 45b:	57                   	push   %edi
+ 45c:	56                   	push   %esi
+ 45d:	53                   	push   %ebx
+ 45e:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 461:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 464:	0f b6 1e             	movzbl (%esi),%ebx
+ 467:	84 db                	test   %bl,%bl
+ 469:	0f 84 9e 01 00 00    	je     60d <printf+0x1b5>
+ 46f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 472:	8d 45 10             	lea    0x10(%ebp),%eax
+ 475:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 478:	bf 00 00 00 00       	mov    $0x0,%edi
+ 47d:	eb 2d                	jmp    4ac <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 47f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 482:	83 ec 04             	sub    $0x4,%esp
+ 485:	6a 01                	push   $0x1
+ 487:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 48a:	50                   	push   %eax
+ 48b:	ff 75 08             	push   0x8(%ebp)
+ 48e:	e8 3d fe ff ff       	call   2d0 <write>
+        putc(fd, c);
+ 493:	83 c4 10             	add    $0x10,%esp
+ 496:	eb 05                	jmp    49d <printf+0x45>
+      }
+    } else if(state == '%'){
+ 498:	83 ff 25             	cmp    $0x25,%edi
+ 49b:	74 1f                	je     4bc <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 49d:	83 c6 01             	add    $0x1,%esi
+ 4a0:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4a4:	84 db                	test   %bl,%bl
+ 4a6:	0f 84 61 01 00 00    	je     60d <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4ac:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4af:	85 ff                	test   %edi,%edi
+ 4b1:	75 e5                	jne    498 <printf+0x40>
+      if(c == '%'){
+ 4b3:	83 f8 25             	cmp    $0x25,%eax
+ 4b6:	75 c7                	jne    47f <printf+0x27>
+        state = '%';
+ 4b8:	89 c7                	mov    %eax,%edi
+ 4ba:	eb e1                	jmp    49d <printf+0x45>
+      if(c == 'd'){
+ 4bc:	83 f8 25             	cmp    $0x25,%eax
+ 4bf:	0f 84 f4 00 00 00    	je     5b9 <printf+0x161>
+ 4c5:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4c8:	83 fa 15             	cmp    $0x15,%edx
+ 4cb:	0f 87 09 01 00 00    	ja     5da <printf+0x182>
+ 4d1:	0f 87 03 01 00 00    	ja     5da <printf+0x182>
+ 4d7:	ff 24 95 a8 07 00 00 	jmp    *0x7a8(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 4de:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4e1:	8b 17                	mov    (%edi),%edx
+ 4e3:	83 ec 0c             	sub    $0xc,%esp
+ 4e6:	6a 01                	push   $0x1
+ 4e8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f0:	e8 cb fe ff ff       	call   3c0 <printint>
+        ap++;
+ 4f5:	83 c7 04             	add    $0x4,%edi
+ 4f8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4fb:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4fe:	bf 00 00 00 00       	mov    $0x0,%edi
+ 503:	eb 98                	jmp    49d <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 505:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 508:	8b 17                	mov    (%edi),%edx
+ 50a:	83 ec 0c             	sub    $0xc,%esp
+ 50d:	6a 00                	push   $0x0
+ 50f:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 514:	8b 45 08             	mov    0x8(%ebp),%eax
+ 517:	e8 a4 fe ff ff       	call   3c0 <printint>
+        ap++;
+ 51c:	83 c7 04             	add    $0x4,%edi
+ 51f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 522:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 525:	bf 00 00 00 00       	mov    $0x0,%edi
+ 52a:	e9 6e ff ff ff       	jmp    49d <printf+0x45>
+        s = (char*)*ap;
+ 52f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 532:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 534:	83 c1 04             	add    $0x4,%ecx
+ 537:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 53a:	85 c0                	test   %eax,%eax
+ 53c:	74 13                	je     551 <printf+0xf9>
+        s = (char*)*ap;
+ 53e:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 540:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 543:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 548:	84 c0                	test   %al,%al
+ 54a:	75 0f                	jne    55b <printf+0x103>
+ 54c:	e9 4c ff ff ff       	jmp    49d <printf+0x45>
+          s = "(null)";
+ 551:	bb a0 07 00 00       	mov    $0x7a0,%ebx
+        while(*s != 0){
+ 556:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 55b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 55e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 561:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 564:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 567:	83 ec 04             	sub    $0x4,%esp
+ 56a:	6a 01                	push   $0x1
+ 56c:	57                   	push   %edi
+ 56d:	56                   	push   %esi
+ 56e:	e8 5d fd ff ff       	call   2d0 <write>
+          s++;
+ 573:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 576:	0f b6 03             	movzbl (%ebx),%eax
+ 579:	83 c4 10             	add    $0x10,%esp
+ 57c:	84 c0                	test   %al,%al
+ 57e:	75 e4                	jne    564 <printf+0x10c>
+      state = 0;
+ 580:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 583:	bf 00 00 00 00       	mov    $0x0,%edi
+ 588:	e9 10 ff ff ff       	jmp    49d <printf+0x45>
+        putc(fd, *ap);
+ 58d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 590:	8b 07                	mov    (%edi),%eax
+ 592:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 595:	83 ec 04             	sub    $0x4,%esp
+ 598:	6a 01                	push   $0x1
+ 59a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 59d:	50                   	push   %eax
+ 59e:	ff 75 08             	push   0x8(%ebp)
+ 5a1:	e8 2a fd ff ff       	call   2d0 <write>
+        ap++;
+ 5a6:	83 c7 04             	add    $0x4,%edi
+ 5a9:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5af:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5b4:	e9 e4 fe ff ff       	jmp    49d <printf+0x45>
+        putc(fd, c);
+ 5b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5bc:	83 ec 04             	sub    $0x4,%esp
+ 5bf:	6a 01                	push   $0x1
+ 5c1:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5c4:	50                   	push   %eax
+ 5c5:	ff 75 08             	push   0x8(%ebp)
+ 5c8:	e8 03 fd ff ff       	call   2d0 <write>
+ 5cd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5d0:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5d5:	e9 c3 fe ff ff       	jmp    49d <printf+0x45>
+        putc(fd, '%');
+ 5da:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5de:	83 ec 04             	sub    $0x4,%esp
+ 5e1:	6a 01                	push   $0x1
+ 5e3:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5e6:	57                   	push   %edi
+ 5e7:	ff 75 08             	push   0x8(%ebp)
+ 5ea:	e8 e1 fc ff ff       	call   2d0 <write>
+        putc(fd, c);
+ 5ef:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f2:	83 c4 0c             	add    $0xc,%esp
+ 5f5:	6a 01                	push   $0x1
+ 5f7:	57                   	push   %edi
+ 5f8:	ff 75 08             	push   0x8(%ebp)
+ 5fb:	e8 d0 fc ff ff       	call   2d0 <write>
+        putc(fd, c);
+ 600:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 603:	bf 00 00 00 00       	mov    $0x0,%edi
+ 608:	e9 90 fe ff ff       	jmp    49d <printf+0x45>
+    }
+  }
+}
+ 60d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 610:	5b                   	pop    %ebx
+ 611:	5e                   	pop    %esi
+ 612:	5f                   	pop    %edi
+ 613:	5d                   	pop    %ebp
+ 614:	c3                   	ret
+
+00000615 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 615:	55                   	push   %ebp
+ 616:	89 e5                	mov    %esp,%ebp
+ 618:	57                   	push   %edi
+ 619:	56                   	push   %esi
+ 61a:	53                   	push   %ebx
+ 61b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 61e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 621:	a1 74 0a 00 00       	mov    0xa74,%eax
+ 626:	eb 0c                	jmp    634 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 628:	8b 10                	mov    (%eax),%edx
+ 62a:	39 d0                	cmp    %edx,%eax
+ 62c:	72 04                	jb     632 <free+0x1d>
+ 62e:	39 d1                	cmp    %edx,%ecx
+ 630:	72 10                	jb     642 <free+0x2d>
+{
+ 632:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 634:	39 c8                	cmp    %ecx,%eax
+ 636:	73 f0                	jae    628 <free+0x13>
+ 638:	8b 10                	mov    (%eax),%edx
+ 63a:	39 d1                	cmp    %edx,%ecx
+ 63c:	72 04                	jb     642 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 63e:	39 d0                	cmp    %edx,%eax
+ 640:	72 f0                	jb     632 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 642:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 645:	8b 10                	mov    (%eax),%edx
+ 647:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 64a:	39 fa                	cmp    %edi,%edx
+ 64c:	74 19                	je     667 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 64e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 651:	8b 50 04             	mov    0x4(%eax),%edx
+ 654:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 657:	39 f1                	cmp    %esi,%ecx
+ 659:	74 18                	je     673 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 65b:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 65d:	a3 74 0a 00 00       	mov    %eax,0xa74
+}
+ 662:	5b                   	pop    %ebx
+ 663:	5e                   	pop    %esi
+ 664:	5f                   	pop    %edi
+ 665:	5d                   	pop    %ebp
+ 666:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 667:	03 72 04             	add    0x4(%edx),%esi
+ 66a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 66d:	8b 10                	mov    (%eax),%edx
+ 66f:	8b 12                	mov    (%edx),%edx
+ 671:	eb db                	jmp    64e <free+0x39>
+    p->s.size += bp->s.size;
+ 673:	03 53 fc             	add    -0x4(%ebx),%edx
+ 676:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 679:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 67c:	eb dd                	jmp    65b <free+0x46>
+
+0000067e <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 67e:	55                   	push   %ebp
+ 67f:	89 e5                	mov    %esp,%ebp
+ 681:	57                   	push   %edi
+ 682:	56                   	push   %esi
+ 683:	53                   	push   %ebx
+ 684:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 687:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68a:	8d 58 07             	lea    0x7(%eax),%ebx
+ 68d:	c1 eb 03             	shr    $0x3,%ebx
+ 690:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 693:	8b 15 74 0a 00 00    	mov    0xa74,%edx
+ 699:	85 d2                	test   %edx,%edx
+ 69b:	74 1c                	je     6b9 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 69d:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 69f:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6a2:	39 d9                	cmp    %ebx,%ecx
+ 6a4:	73 38                	jae    6de <malloc+0x60>
+  if(nu < 4096)
+ 6a6:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6ab:	39 f3                	cmp    %esi,%ebx
+ 6ad:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6b0:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6b7:	eb 72                	jmp    72b <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6b9:	c7 05 74 0a 00 00 78 	movl   $0xa78,0xa74
+ 6c0:	0a 00 00 
+ 6c3:	c7 05 78 0a 00 00 78 	movl   $0xa78,0xa78
+ 6ca:	0a 00 00 
+    base.s.size = 0;
+ 6cd:	c7 05 7c 0a 00 00 00 	movl   $0x0,0xa7c
+ 6d4:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d7:	b8 78 0a 00 00       	mov    $0xa78,%eax
+    if(p->s.size >= nunits){
+ 6dc:	eb c8                	jmp    6a6 <malloc+0x28>
+      if(p->s.size == nunits)
+ 6de:	39 cb                	cmp    %ecx,%ebx
+ 6e0:	74 1e                	je     700 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6e2:	29 d9                	sub    %ebx,%ecx
+ 6e4:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 6e7:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 6ea:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6ed:	89 15 74 0a 00 00    	mov    %edx,0xa74
+      return (void*)(p + 1);
+ 6f3:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6f6:	89 d0                	mov    %edx,%eax
+ 6f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fb:	5b                   	pop    %ebx
+ 6fc:	5e                   	pop    %esi
+ 6fd:	5f                   	pop    %edi
+ 6fe:	5d                   	pop    %ebp
+ 6ff:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 700:	8b 08                	mov    (%eax),%ecx
+ 702:	89 0a                	mov    %ecx,(%edx)
+ 704:	eb e7                	jmp    6ed <malloc+0x6f>
+  hp->s.size = nu;
+ 706:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 709:	83 ec 0c             	sub    $0xc,%esp
+ 70c:	83 c0 08             	add    $0x8,%eax
+ 70f:	50                   	push   %eax
+ 710:	e8 00 ff ff ff       	call   615 <free>
+  return freep;
+ 715:	8b 15 74 0a 00 00    	mov    0xa74,%edx
+      if((p = morecore(nunits)) == 0)
+ 71b:	83 c4 10             	add    $0x10,%esp
+ 71e:	85 d2                	test   %edx,%edx
+ 720:	74 d4                	je     6f6 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 722:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 724:	8b 48 04             	mov    0x4(%eax),%ecx
+ 727:	39 d9                	cmp    %ebx,%ecx
+ 729:	73 b3                	jae    6de <malloc+0x60>
+    if(p == freep)
+ 72b:	89 c2                	mov    %eax,%edx
+ 72d:	39 05 74 0a 00 00    	cmp    %eax,0xa74
+ 733:	75 ed                	jne    722 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 735:	83 ec 0c             	sub    $0xc,%esp
+ 738:	57                   	push   %edi
+ 739:	e8 fa fb ff ff       	call   338 <sbrk>
+  if(p == (char*)-1)
+ 73e:	83 c4 10             	add    $0x10,%esp
+ 741:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 744:	75 c0                	jne    706 <malloc+0x88>
+        return 0;
+ 746:	ba 00 00 00 00       	mov    $0x0,%edx
+ 74b:	eb a9                	jmp    6f6 <malloc+0x78>
@@ -0,0 +1,1210 @@
+
+_iostat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <show>:
+#include "kernel/iostat.h"
+#include "user.h"
+
+static void
+show(int dev)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 2c             	sub    $0x2c,%esp
+   7:	89 c3                	mov    %eax,%ebx
+  struct iostat st;
+
+  if(iostat(dev, &st) < 0){
+   9:	8d 45 dc             	lea    -0x24(%ebp),%eax
+   c:	50                   	push   %eax
+   d:	53                   	push   %ebx
+   e:	e8 de 03 00 00       	call   3f1 <iostat>
+  13:	83 c4 10             	add    $0x10,%esp
+  16:	85 c0                	test   %eax,%eax
+  18:	78 4d                	js     67 <show+0x67>
+    printf(2, "iostat: iostat failed\n");
+    exit();
+  }
+  printf(1, "ide%d: depth %d max %d reqs %d cmds %d sects %d",
+  1a:	ff 75 ec             	push   -0x14(%ebp)
+  1d:	ff 75 e8             	push   -0x18(%ebp)
+  20:	ff 75 e4             	push   -0x1c(%ebp)
+  23:	ff 75 e0             	push   -0x20(%ebp)
+  26:	ff 75 dc             	push   -0x24(%ebp)
+  29:	89 d8                	mov    %ebx,%eax
+  2b:	c1 e8 1f             	shr    $0x1f,%eax
+  2e:	01 d8                	add    %ebx,%eax
+  30:	d1 f8                	sar    %eax
+  32:	50                   	push   %eax
+  33:	68 bc 07 00 00       	push   $0x7bc
+  38:	6a 01                	push   $0x1
+  3a:	e8 52 04 00 00       	call   491 <printf>
+         dev / 2, st.depth, st.maxdepth, st.nreq, st.ncmd, st.nsect);
+  if(st.nreq > 0)
+  3f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  42:	83 c4 20             	add    $0x20,%esp
+  45:	85 c9                	test   %ecx,%ecx
+  47:	75 32                	jne    7b <show+0x7b>
+    printf(1, " wait/req %d", st.wait / st.nreq);
+  if(st.ncmd > 0)
+  49:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+  4c:	85 c9                	test   %ecx,%ecx
+  4e:	75 4a                	jne    9a <show+0x9a>
+    printf(1, " service/cmd %d", st.service / st.ncmd);
+  printf(1, "\n");
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	68 9d 07 00 00       	push   $0x79d
+  58:	6a 01                	push   $0x1
+  5a:	e8 32 04 00 00       	call   491 <printf>
+}
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  65:	c9                   	leave
+  66:	c3                   	ret
+    printf(2, "iostat: iostat failed\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 88 07 00 00       	push   $0x788
+  6f:	6a 02                	push   $0x2
+  71:	e8 1b 04 00 00       	call   491 <printf>
+    exit();
+  76:	e8 6e 02 00 00       	call   2e9 <exit>
+    printf(1, " wait/req %d", st.wait / st.nreq);
+  7b:	83 ec 04             	sub    $0x4,%esp
+  7e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  81:	ba 00 00 00 00       	mov    $0x0,%edx
+  86:	f7 f1                	div    %ecx
+  88:	50                   	push   %eax
+  89:	68 9f 07 00 00       	push   $0x79f
+  8e:	6a 01                	push   $0x1
+  90:	e8 fc 03 00 00       	call   491 <printf>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	eb af                	jmp    49 <show+0x49>
+    printf(1, " service/cmd %d", st.service / st.ncmd);
+  9a:	83 ec 04             	sub    $0x4,%esp
+  9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  a5:	f7 f1                	div    %ecx
+  a7:	50                   	push   %eax
+  a8:	68 ac 07 00 00       	push   $0x7ac
+  ad:	6a 01                	push   $0x1
+  af:	e8 dd 03 00 00       	call   491 <printf>
+  b4:	83 c4 10             	add    $0x10,%esp
+  b7:	eb 97                	jmp    50 <show+0x50>
+
+000000b9 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  b9:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  bd:	83 e4 f0             	and    $0xfffffff0,%esp
+  c0:	ff 71 fc             	push   -0x4(%ecx)
+  c3:	55                   	push   %ebp
+  c4:	89 e5                	mov    %esp,%ebp
+  c6:	53                   	push   %ebx
+  c7:	51                   	push   %ecx
+  c8:	8b 41 04             	mov    0x4(%ecx),%eax
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 0;
+  cb:	83 39 01             	cmpl   $0x1,(%ecx)
+  ce:	7f 19                	jg     e9 <main+0x30>
+  for(;;){
+    show(0);
+  d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  d5:	e8 26 ff ff ff       	call   0 <show>
+    show(2);
+  da:	b8 02 00 00 00       	mov    $0x2,%eax
+  df:	e8 1c ff ff ff       	call   0 <show>
+    if(n <= 0)
+      break;
+    sleep(n);
+  }
+  exit();
+  e4:	e8 00 02 00 00       	call   2e9 <exit>
+  n = argc > 1 ? atoi(argv[1]) : 0;
+  e9:	83 ec 0c             	sub    $0xc,%esp
+  ec:	ff 70 04             	push   0x4(%eax)
+  ef:	e8 83 01 00 00       	call   277 <atoi>
+  f4:	89 c3                	mov    %eax,%ebx
+  f6:	83 c4 10             	add    $0x10,%esp
+  f9:	eb 0c                	jmp    107 <main+0x4e>
+    sleep(n);
+  fb:	83 ec 0c             	sub    $0xc,%esp
+  fe:	53                   	push   %ebx
+  ff:	e8 75 02 00 00       	call   379 <sleep>
+    show(0);
+ 104:	83 c4 10             	add    $0x10,%esp
+ 107:	b8 00 00 00 00       	mov    $0x0,%eax
+ 10c:	e8 ef fe ff ff       	call   0 <show>
+    show(2);
+ 111:	b8 02 00 00 00       	mov    $0x2,%eax
+ 116:	e8 e5 fe ff ff       	call   0 <show>
+    if(n <= 0)
+ 11b:	85 db                	test   %ebx,%ebx
+ 11d:	7f dc                	jg     fb <main+0x42>
+ 11f:	eb c3                	jmp    e4 <main+0x2b>
+
+00000121 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+ 124:	53                   	push   %ebx
+ 125:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 128:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 12b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0xf>
+    ;
+  return os;
+}
+ 13e:	89 c8                	mov    %ecx,%eax
+ 140:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+
+00000145 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 145:	55                   	push   %ebp
+ 146:	89 e5                	mov    %esp,%ebp
+ 148:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 14b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 14e:	0f b6 01             	movzbl (%ecx),%eax
+ 151:	84 c0                	test   %al,%al
+ 153:	74 11                	je     166 <strcmp+0x21>
+ 155:	38 02                	cmp    %al,(%edx)
+ 157:	75 0d                	jne    166 <strcmp+0x21>
+    p++, q++;
+ 159:	83 c1 01             	add    $0x1,%ecx
+ 15c:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 15f:	0f b6 01             	movzbl (%ecx),%eax
+ 162:	84 c0                	test   %al,%al
+ 164:	75 ef                	jne    155 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 166:	0f b6 c0             	movzbl %al,%eax
+ 169:	0f b6 12             	movzbl (%edx),%edx
+ 16c:	29 d0                	sub    %edx,%eax
+}
+ 16e:	5d                   	pop    %ebp
+ 16f:	c3                   	ret
+
+00000170 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 176:	80 3a 00             	cmpb   $0x0,(%edx)
+ 179:	74 14                	je     18f <strlen+0x1f>
+ 17b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	89 c1                	mov    %eax,%ecx
+ 185:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 18f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 194:	eb f5                	jmp    18b <strlen+0x1b>
+
+00000196 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	57                   	push   %edi
+ 19a:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 19d:	89 d7                	mov    %edx,%edi
+ 19f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a5:	fc                   	cld
+ 1a6:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1a8:	89 d0                	mov    %edx,%eax
+ 1aa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1ad:	c9                   	leave
+ 1ae:	c3                   	ret
+
+000001af <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1af:	55                   	push   %ebp
+ 1b0:	89 e5                	mov    %esp,%ebp
+ 1b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1b9:	0f b6 10             	movzbl (%eax),%edx
+ 1bc:	84 d2                	test   %dl,%dl
+ 1be:	74 15                	je     1d5 <strchr+0x26>
+    if(*s == c)
+ 1c0:	38 d1                	cmp    %dl,%cl
+ 1c2:	74 0f                	je     1d3 <strchr+0x24>
+  for(; *s; s++)
+ 1c4:	83 c0 01             	add    $0x1,%eax
+ 1c7:	0f b6 10             	movzbl (%eax),%edx
+ 1ca:	84 d2                	test   %dl,%dl
+ 1cc:	75 f2                	jne    1c0 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1d3:	5d                   	pop    %ebp
+ 1d4:	c3                   	ret
+  return 0;
+ 1d5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1da:	eb f7                	jmp    1d3 <strchr+0x24>
+
+000001dc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1dc:	55                   	push   %ebp
+ 1dd:	89 e5                	mov    %esp,%ebp
+ 1df:	57                   	push   %edi
+ 1e0:	56                   	push   %esi
+ 1e1:	53                   	push   %ebx
+ 1e2:	83 ec 2c             	sub    $0x2c,%esp
+ 1e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1ed:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1f0:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1f3:	83 c3 01             	add    $0x1,%ebx
+ 1f6:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1f9:	7d 27                	jge    222 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1fb:	83 ec 04             	sub    $0x4,%esp
+ 1fe:	6a 01                	push   $0x1
+ 200:	57                   	push   %edi
+ 201:	6a 00                	push   $0x0
+ 203:	e8 f9 00 00 00       	call   301 <read>
+    if(cc < 1)
+ 208:	83 c4 10             	add    $0x10,%esp
+ 20b:	85 c0                	test   %eax,%eax
+ 20d:	7e 13                	jle    222 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 20f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 213:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 217:	3c 0a                	cmp    $0xa,%al
+ 219:	74 04                	je     21f <gets+0x43>
+ 21b:	3c 0d                	cmp    $0xd,%al
+ 21d:	75 d1                	jne    1f0 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 21f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 222:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 225:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 229:	89 f0                	mov    %esi,%eax
+ 22b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22e:	5b                   	pop    %ebx
+ 22f:	5e                   	pop    %esi
+ 230:	5f                   	pop    %edi
+ 231:	5d                   	pop    %ebp
+ 232:	c3                   	ret
+
+00000233 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 233:	55                   	push   %ebp
+ 234:	89 e5                	mov    %esp,%ebp
+ 236:	56                   	push   %esi
+ 237:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 238:	83 ec 08             	sub    $0x8,%esp
+ 23b:	6a 00                	push   $0x0
+ 23d:	ff 75 08             	push   0x8(%ebp)
+ 240:	e8 e4 00 00 00       	call   329 <open>
+  if(fd < 0)
+ 245:	83 c4 10             	add    $0x10,%esp
+ 248:	85 c0                	test   %eax,%eax
+ 24a:	78 24                	js     270 <stat+0x3d>
+ 24c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 24e:	83 ec 08             	sub    $0x8,%esp
+ 251:	ff 75 0c             	push   0xc(%ebp)
+ 254:	50                   	push   %eax
+ 255:	e8 e7 00 00 00       	call   341 <fstat>
+ 25a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 25c:	89 1c 24             	mov    %ebx,(%esp)
+ 25f:	e8 ad 00 00 00       	call   311 <close>
+  return r;
+ 264:	83 c4 10             	add    $0x10,%esp
+}
+ 267:	89 f0                	mov    %esi,%eax
+ 269:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 26c:	5b                   	pop    %ebx
+ 26d:	5e                   	pop    %esi
+ 26e:	5d                   	pop    %ebp
+ 26f:	c3                   	ret
+    return -1;
+ 270:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 275:	eb f0                	jmp    267 <stat+0x34>
+
+00000277 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	53                   	push   %ebx
+ 27b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 27e:	0f b6 02             	movzbl (%edx),%eax
+ 281:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 284:	80 f9 09             	cmp    $0x9,%cl
+ 287:	77 24                	ja     2ad <atoi+0x36>
+  n = 0;
+ 289:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 28e:	83 c2 01             	add    $0x1,%edx
+ 291:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 294:	0f be c0             	movsbl %al,%eax
+ 297:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 29b:	0f b6 02             	movzbl (%edx),%eax
+ 29e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2a1:	80 fb 09             	cmp    $0x9,%bl
+ 2a4:	76 e8                	jbe    28e <atoi+0x17>
+  return n;
+}
+ 2a6:	89 c8                	mov    %ecx,%eax
+ 2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+  n = 0;
+ 2ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2b2:	eb f2                	jmp    2a6 <atoi+0x2f>
+
+000002b4 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2b4:	55                   	push   %ebp
+ 2b5:	89 e5                	mov    %esp,%ebp
+ 2b7:	56                   	push   %esi
+ 2b8:	53                   	push   %ebx
+ 2b9:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2c2:	85 db                	test   %ebx,%ebx
+ 2c4:	7e 15                	jle    2db <memmove+0x27>
+ 2c6:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2c8:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2ca:	83 c2 01             	add    $0x1,%edx
+ 2cd:	83 c0 01             	add    $0x1,%eax
+ 2d0:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2d4:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2d7:	39 c3                	cmp    %eax,%ebx
+ 2d9:	75 ef                	jne    2ca <memmove+0x16>
+  return vdst;
+}
+ 2db:	89 f0                	mov    %esi,%eax
+ 2dd:	5b                   	pop    %ebx
+ 2de:	5e                   	pop    %esi
+ 2df:	5d                   	pop    %ebp
+ 2e0:	c3                   	ret
+
+000002e1 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2e1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <exit>:
+SYSCALL(exit)
+ 2e9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <wait>:
+SYSCALL(wait)
+ 2f1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <pipe>:
+SYSCALL(pipe)
+ 2f9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <read>:
+SYSCALL(read)
+ 301:	b8 05 00 00 00       	mov    $0x5,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <write>:
+SYSCALL(write)
+ 309:	b8 10 00 00 00       	mov    $0x10,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <close>:
+SYSCALL(close)
+ 311:	b8 15 00 00 00       	mov    $0x15,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <kill>:
+SYSCALL(kill)
+ 319:	b8 06 00 00 00       	mov    $0x6,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <exec>:
+SYSCALL(exec)
+ 321:	b8 07 00 00 00       	mov    $0x7,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <open>:
+SYSCALL(open)
+ 329:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <mknod>:
+SYSCALL(mknod)
+ 331:	b8 11 00 00 00       	mov    $0x11,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <unlink>:
+SYSCALL(unlink)
+ 339:	b8 12 00 00 00       	mov    $0x12,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <fstat>:
+SYSCALL(fstat)
+ 341:	b8 08 00 00 00       	mov    $0x8,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <link>:
+SYSCALL(link)
+ 349:	b8 13 00 00 00       	mov    $0x13,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <mkdir>:
+SYSCALL(mkdir)
+ 351:	b8 14 00 00 00       	mov    $0x14,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <chdir>:
+SYSCALL(chdir)
+ 359:	b8 09 00 00 00       	mov    $0x9,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <dup>:
+SYSCALL(dup)
+ 361:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <getpid>:
+SYSCALL(getpid)
+ 369:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <sbrk>:
+SYSCALL(sbrk)
+ 371:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <sleep>:
+SYSCALL(sleep)
+ 379:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <uptime>:
+SYSCALL(uptime)
+ 381:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <readmouse>:
+SYSCALL(readmouse)
+ 389:	b8 16 00 00 00       	mov    $0x16,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <sigsend>:
+SYSCALL(sigsend)
+ 391:	b8 17 00 00 00       	mov    $0x17,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 399:	b8 18 00 00 00       	mov    $0x18,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <sigreturn>:
+SYSCALL(sigreturn)
+ 3a1:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <siggetmask>:
+SYSCALL(siggetmask)
+ 3a9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 3b1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <sigpause>:
+SYSCALL(sigpause)
+ 3b9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 3c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <sleeptick>:
+SYSCALL(sleeptick)
+ 3c9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <schedctl>:
+SYSCALL(schedctl)
+ 3d1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <nswtch>:
+SYSCALL(nswtch)
+ 3d9:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <getloadavg>:
+SYSCALL(getloadavg)
+ 3e1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <memstat>:
+SYSCALL(memstat)
+ 3e9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <iostat>:
+SYSCALL(iostat)
+ 3f1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3f9:	55                   	push   %ebp
+ 3fa:	89 e5                	mov    %esp,%ebp
+ 3fc:	57                   	push   %edi
+ 3fd:	56                   	push   %esi
+ 3fe:	53                   	push   %ebx
+ 3ff:	83 ec 3c             	sub    $0x3c,%esp
+ 402:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 405:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 407:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 40b:	74 79                	je     486 <printint+0x8d>
+ 40d:	85 d2                	test   %edx,%edx
+ 40f:	79 75                	jns    486 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 411:	89 d1                	mov    %edx,%ecx
+ 413:	f7 d9                	neg    %ecx
+    neg = 1;
+ 415:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 41c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 421:	89 df                	mov    %ebx,%edi
+ 423:	83 c3 01             	add    $0x1,%ebx
+ 426:	89 c8                	mov    %ecx,%eax
+ 428:	ba 00 00 00 00       	mov    $0x0,%edx
+ 42d:	f7 f6                	div    %esi
+ 42f:	0f b6 92 4c 08 00 00 	movzbl 0x84c(%edx),%edx
+ 436:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 43a:	89 ca                	mov    %ecx,%edx
+ 43c:	89 c1                	mov    %eax,%ecx
+ 43e:	39 f2                	cmp    %esi,%edx
+ 440:	73 df                	jae    421 <printint+0x28>
+  if(neg)
+ 442:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 446:	74 08                	je     450 <printint+0x57>
+    buf[i++] = '-';
+ 448:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 44d:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 450:	85 db                	test   %ebx,%ebx
+ 452:	7e 2a                	jle    47e <printint+0x85>
+ 454:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 457:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 45b:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 45e:	0f b6 03             	movzbl (%ebx),%eax
+ 461:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 464:	83 ec 04             	sub    $0x4,%esp
+ 467:	6a 01                	push   $0x1
+ 469:	57                   	push   %edi
+ 46a:	ff 75 c4             	push   -0x3c(%ebp)
+ 46d:	e8 97 fe ff ff       	call   309 <write>
+  while(--i >= 0)
+ 472:	89 d8                	mov    %ebx,%eax
+ 474:	83 eb 01             	sub    $0x1,%ebx
+ 477:	83 c4 10             	add    $0x10,%esp
+ 47a:	39 f0                	cmp    %esi,%eax
+ 47c:	75 e0                	jne    45e <printint+0x65>
+}
+ 47e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 481:	5b                   	pop    %ebx
+ 482:	5e                   	pop    %esi
+ 483:	5f                   	pop    %edi
+ 484:	5d                   	pop    %ebp
+ 485:	c3                   	ret
+    x = xx;
+ 486:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 488:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 48f:	eb 8b                	jmp    41c <printint+0x23>
+
+00000491 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 491:	55                   	push   %ebp
+ 492:	89 e5                	mov    %esp,%ebp
+ 494:	57                   	push   %edi
+ 495:	56                   	push   %esi
+ 496:	53                   	push   %ebx
+ 497:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 49a:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 49d:	0f b6 1e             	movzbl (%esi),%ebx
+ 4a0:	84 db                	test   %bl,%bl
+ 4a2:	0f 84 9e 01 00 00    	je     646 <printf+0x1b5>
+ 4a8:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4ab:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4b1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4b6:	eb 2d                	jmp    4e5 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4b8:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4bb:	83 ec 04             	sub    $0x4,%esp
+ 4be:	6a 01                	push   $0x1
+ 4c0:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4c3:	50                   	push   %eax
+ 4c4:	ff 75 08             	push   0x8(%ebp)
+ 4c7:	e8 3d fe ff ff       	call   309 <write>
+        putc(fd, c);
+ 4cc:	83 c4 10             	add    $0x10,%esp
+ 4cf:	eb 05                	jmp    4d6 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4d1:	83 ff 25             	cmp    $0x25,%edi
+ 4d4:	74 1f                	je     4f5 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4d6:	83 c6 01             	add    $0x1,%esi
+ 4d9:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4dd:	84 db                	test   %bl,%bl
+ 4df:	0f 84 61 01 00 00    	je     646 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4e5:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4e8:	85 ff                	test   %edi,%edi
+ 4ea:	75 e5                	jne    4d1 <printf+0x40>
+      if(c == '%'){
+ 4ec:	83 f8 25             	cmp    $0x25,%eax
+ 4ef:	75 c7                	jne    4b8 <printf+0x27>
+        state = '%';
+ 4f1:	89 c7                	mov    %eax,%edi
+ 4f3:	eb e1                	jmp    4d6 <printf+0x45>
+      if(c == 'd'){
+ 4f5:	83 f8 25             	cmp    $0x25,%eax
+ 4f8:	0f 84 f4 00 00 00    	je     5f2 <printf+0x161>
+ 4fe:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 501:	83 fa 15             	cmp    $0x15,%edx
+ 504:	0f 87 09 01 00 00    	ja     613 <printf+0x182>
+ 50a:	0f 87 03 01 00 00    	ja     613 <printf+0x182>
+ 510:	ff 24 95 f4 07 00 00 	jmp    *0x7f4(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 517:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 51a:	8b 17                	mov    (%edi),%edx
+ 51c:	83 ec 0c             	sub    $0xc,%esp
+ 51f:	6a 01                	push   $0x1
+ 521:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+ 529:	e8 cb fe ff ff       	call   3f9 <printint>
+        ap++;
+ 52e:	83 c7 04             	add    $0x4,%edi
+ 531:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 534:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 537:	bf 00 00 00 00       	mov    $0x0,%edi
+ 53c:	eb 98                	jmp    4d6 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 53e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 541:	8b 17                	mov    (%edi),%edx
+ 543:	83 ec 0c             	sub    $0xc,%esp
+ 546:	6a 00                	push   $0x0
+ 548:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 54d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 550:	e8 a4 fe ff ff       	call   3f9 <printint>
+        ap++;
+ 555:	83 c7 04             	add    $0x4,%edi
+ 558:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 55b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 563:	e9 6e ff ff ff       	jmp    4d6 <printf+0x45>
+        s = (char*)*ap;
+ 568:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 56b:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 56d:	83 c1 04             	add    $0x4,%ecx
+ 570:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 573:	85 c0                	test   %eax,%eax
+ 575:	74 13                	je     58a <printf+0xf9>
+        s = (char*)*ap;
+ 577:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 579:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 57c:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 581:	84 c0                	test   %al,%al
+ 583:	75 0f                	jne    594 <printf+0x103>
+ 585:	e9 4c ff ff ff       	jmp    4d6 <printf+0x45>
+          s = "(null)";
+ 58a:	bb ec 07 00 00       	mov    $0x7ec,%ebx
+        while(*s != 0){
+ 58f:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 594:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 597:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 59a:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 59d:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a0:	83 ec 04             	sub    $0x4,%esp
+ 5a3:	6a 01                	push   $0x1
+ 5a5:	57                   	push   %edi
+ 5a6:	56                   	push   %esi
+ 5a7:	e8 5d fd ff ff       	call   309 <write>
+          s++;
+ 5ac:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5af:	0f b6 03             	movzbl (%ebx),%eax
+ 5b2:	83 c4 10             	add    $0x10,%esp
+ 5b5:	84 c0                	test   %al,%al
+ 5b7:	75 e4                	jne    59d <printf+0x10c>
+      state = 0;
+ 5b9:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5bc:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c1:	e9 10 ff ff ff       	jmp    4d6 <printf+0x45>
+        putc(fd, *ap);
+ 5c6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5c9:	8b 07                	mov    (%edi),%eax
+ 5cb:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ce:	83 ec 04             	sub    $0x4,%esp
+ 5d1:	6a 01                	push   $0x1
+ 5d3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5d6:	50                   	push   %eax
+ 5d7:	ff 75 08             	push   0x8(%ebp)
+ 5da:	e8 2a fd ff ff       	call   309 <write>
+        ap++;
+ 5df:	83 c7 04             	add    $0x4,%edi
+ 5e2:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e8:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5ed:	e9 e4 fe ff ff       	jmp    4d6 <printf+0x45>
+        putc(fd, c);
+ 5f2:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f5:	83 ec 04             	sub    $0x4,%esp
+ 5f8:	6a 01                	push   $0x1
+ 5fa:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fd:	50                   	push   %eax
+ 5fe:	ff 75 08             	push   0x8(%ebp)
+ 601:	e8 03 fd ff ff       	call   309 <write>
+ 606:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 609:	bf 00 00 00 00       	mov    $0x0,%edi
+ 60e:	e9 c3 fe ff ff       	jmp    4d6 <printf+0x45>
+        putc(fd, '%');
+ 613:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 617:	83 ec 04             	sub    $0x4,%esp
+ 61a:	6a 01                	push   $0x1
+ 61c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 61f:	57                   	push   %edi
+ 620:	ff 75 08             	push   0x8(%ebp)
+ 623:	e8 e1 fc ff ff       	call   309 <write>
+        putc(fd, c);
+ 628:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 62b:	83 c4 0c             	add    $0xc,%esp
+ 62e:	6a 01                	push   $0x1
+ 630:	57                   	push   %edi
+ 631:	ff 75 08             	push   0x8(%ebp)
+ 634:	e8 d0 fc ff ff       	call   309 <write>
+        putc(fd, c);
+ 639:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 641:	e9 90 fe ff ff       	jmp    4d6 <printf+0x45>
+    }
+  }
+}
+ 646:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 649:	5b                   	pop    %ebx
+ 64a:	5e                   	pop    %esi
+ 64b:	5f                   	pop    %edi
+ 64c:	5d                   	pop    %ebp
+ 64d:	c3                   	ret
+
+0000064e <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 64e:	55                   	push   %ebp
+ 64f:	89 e5                	mov    %esp,%ebp
+ 651:	57                   	push   %edi
+ 652:	56                   	push   %esi
+ 653:	53                   	push   %ebx
+ 654:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 657:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 65a:	a1 e0 0a 00 00       	mov    0xae0,%eax
+ 65f:	eb 0c                	jmp    66d <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 661:	8b 10                	mov    (%eax),%edx
+ 663:	39 d0                	cmp    %edx,%eax
+ 665:	72 04                	jb     66b <free+0x1d>
+ 667:	39 d1                	cmp    %edx,%ecx
+ 669:	72 10                	jb     67b <free+0x2d>
+{
+ 66b:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 66d:	39 c8                	cmp    %ecx,%eax
+ 66f:	73 f0                	jae    661 <free+0x13>
+ 671:	8b 10                	mov    (%eax),%edx
+ 673:	39 d1                	cmp    %edx,%ecx
+ 675:	72 04                	jb     67b <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 677:	39 d0                	cmp    %edx,%eax
+ 679:	72 f0                	jb     66b <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 67b:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 67e:	8b 10                	mov    (%eax),%edx
+ 680:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 683:	39 fa                	cmp    %edi,%edx
+ 685:	74 19                	je     6a0 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 687:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 68a:	8b 50 04             	mov    0x4(%eax),%edx
+ 68d:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 690:	39 f1                	cmp    %esi,%ecx
+ 692:	74 18                	je     6ac <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 694:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 696:	a3 e0 0a 00 00       	mov    %eax,0xae0
+}
+ 69b:	5b                   	pop    %ebx
+ 69c:	5e                   	pop    %esi
+ 69d:	5f                   	pop    %edi
+ 69e:	5d                   	pop    %ebp
+ 69f:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6a0:	03 72 04             	add    0x4(%edx),%esi
+ 6a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6a6:	8b 10                	mov    (%eax),%edx
+ 6a8:	8b 12                	mov    (%edx),%edx
+ 6aa:	eb db                	jmp    687 <free+0x39>
+    p->s.size += bp->s.size;
+ 6ac:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6af:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6b2:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6b5:	eb dd                	jmp    694 <free+0x46>
+
+000006b7 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6b7:	55                   	push   %ebp
+ 6b8:	89 e5                	mov    %esp,%ebp
+ 6ba:	57                   	push   %edi
+ 6bb:	56                   	push   %esi
+ 6bc:	53                   	push   %ebx
+ 6bd:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c3:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6c6:	c1 eb 03             	shr    $0x3,%ebx
+ 6c9:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6cc:	8b 15 e0 0a 00 00    	mov    0xae0,%edx
+ 6d2:	85 d2                	test   %edx,%edx
+ 6d4:	74 1c                	je     6f2 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d6:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6d8:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6db:	39 d9                	cmp    %ebx,%ecx
+ 6dd:	73 38                	jae    717 <malloc+0x60>
+  if(nu < 4096)
+ 6df:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6e4:	39 f3                	cmp    %esi,%ebx
+ 6e6:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6e9:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6f0:	eb 72                	jmp    764 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6f2:	c7 05 e0 0a 00 00 e4 	movl   $0xae4,0xae0
+ 6f9:	0a 00 00 
+ 6fc:	c7 05 e4 0a 00 00 e4 	movl   $0xae4,0xae4
+ 703:	0a 00 00 
+    base.s.size = 0;
+ 706:	c7 05 e8 0a 00 00 00 	movl   $0x0,0xae8
+ 70d:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 710:	b8 e4 0a 00 00       	mov    $0xae4,%eax
+    if(p->s.size >= nunits){
+ 715:	eb c8                	jmp    6df <malloc+0x28>
+      if(p->s.size == nunits)
+ 717:	39 cb                	cmp    %ecx,%ebx
+ 719:	74 1e                	je     739 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 71b:	29 d9                	sub    %ebx,%ecx
+ 71d:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 720:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 723:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 726:	89 15 e0 0a 00 00    	mov    %edx,0xae0
+      return (void*)(p + 1);
+ 72c:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 72f:	89 d0                	mov    %edx,%eax
+ 731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 734:	5b                   	pop    %ebx
+ 735:	5e                   	pop    %esi
+ 736:	5f                   	pop    %edi
+ 737:	5d                   	pop    %ebp
+ 738:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 739:	8b 08                	mov    (%eax),%ecx
+ 73b:	89 0a                	mov    %ecx,(%edx)
+ 73d:	eb e7                	jmp    726 <malloc+0x6f>
+  hp->s.size = nu;
+ 73f:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 742:	83 ec 0c             	sub    $0xc,%esp
+ 745:	83 c0 08             	add    $0x8,%eax
+ 748:	50                   	push   %eax
+ 749:	e8 00 ff ff ff       	call   64e <free>
+  return freep;
+ 74e:	8b 15 e0 0a 00 00    	mov    0xae0,%edx
+      if((p = morecore(nunits)) == 0)
+ 754:	83 c4 10             	add    $0x10,%esp
+ 757:	85 d2                	test   %edx,%edx
+ 759:	74 d4                	je     72f <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 75b:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 75d:	8b 48 04             	mov    0x4(%eax),%ecx
+ 760:	39 d9                	cmp    %ebx,%ecx
+ 762:	73 b3                	jae    717 <malloc+0x60>
+    if(p == freep)
+ 764:	89 c2                	mov    %eax,%edx
+ 766:	39 05 e0 0a 00 00    	cmp    %eax,0xae0
+ 76c:	75 ed                	jne    75b <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 76e:	83 ec 0c             	sub    $0xc,%esp
+ 771:	57                   	push   %edi
+ 772:	e8 fa fb ff ff       	call   371 <sbrk>
+  if(p == (char*)-1)
+ 777:	83 c4 10             	add    $0x10,%esp
+ 77a:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 77d:	75 c0                	jne    73f <malloc+0x88>
+        return 0;
+ 77f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 784:	eb a9                	jmp    72f <malloc+0x78>
@@ -0,0 +1,42 @@
+// Print the request queue statistics of both IDE channels.
+//   iostat           once
+//   iostat n         every n ticks, until killed
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/iostat.h"
+#include "user.h"
+
+static void
+show(int dev)
+{
+  struct iostat st;
+
+  if(iostat(dev, &st) < 0){
+    printf(2, "iostat: iostat failed\n");
+    exit();
+  }
+  printf(1, "ide%d: depth %d max %d reqs %d cmds %d sects %d",
+         dev / 2, st.depth, st.maxdepth, st.nreq, st.ncmd, st.nsect);
+  if(st.nreq > 0)
+    printf(1, " wait/req %d", st.wait / st.nreq);
+  if(st.ncmd > 0)
+    printf(1, " service/cmd %d", st.service / st.ncmd);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n;
+
+  n = argc > 1 ? atoi(argv[1]) : 0;
+  for(;;){
+    show(0);
+    show(2);
+    if(n <= 0)
+      break;
+    sleep(n);
+  }
+  exit();
+}
@@ -0,0 +1,1115 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+
+  if(argc < 2){
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+  19:	bb 01 00 00 00       	mov    $0x1,%ebx
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 22                	jle    45 <main+0x45>
+    kill(atoi(argv[i]));
+  23:	83 ec 0c             	sub    $0xc,%esp
+  26:	ff 34 9f             	push   (%edi,%ebx,4)
+  29:	e8 81 01 00 00       	call   1af <atoi>
+  2e:	89 04 24             	mov    %eax,(%esp)
+  31:	e8 1b 02 00 00       	call   251 <kill>
+  for(i=1; i<argc; i++)
+  36:	83 c3 01             	add    $0x1,%ebx
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	39 de                	cmp    %ebx,%esi
+  3e:	75 e3                	jne    23 <main+0x23>
+  exit();
+  40:	e8 dc 01 00 00       	call   221 <exit>
+    printf(2, "usage: kill pid...\n");
+  45:	83 ec 08             	sub    $0x8,%esp
+  48:	68 c0 06 00 00       	push   $0x6c0
+  4d:	6a 02                	push   $0x2
+  4f:	e8 75 03 00 00       	call   3c9 <printf>
+    exit();
+  54:	e8 c8 01 00 00       	call   221 <exit>
+
+00000059 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  59:	55                   	push   %ebp
+  5a:	89 e5                	mov    %esp,%ebp
+  5c:	53                   	push   %ebx
+  5d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  63:	b8 00 00 00 00       	mov    $0x0,%eax
+  68:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  6c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  6f:	83 c0 01             	add    $0x1,%eax
+  72:	84 d2                	test   %dl,%dl
+  74:	75 f2                	jne    68 <strcpy+0xf>
+    ;
+  return os;
+}
+  76:	89 c8                	mov    %ecx,%eax
+  78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  7b:	c9                   	leave
+  7c:	c3                   	ret
+
+0000007d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  7d:	55                   	push   %ebp
+  7e:	89 e5                	mov    %esp,%ebp
+  80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  83:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  86:	0f b6 01             	movzbl (%ecx),%eax
+  89:	84 c0                	test   %al,%al
+  8b:	74 11                	je     9e <strcmp+0x21>
+  8d:	38 02                	cmp    %al,(%edx)
+  8f:	75 0d                	jne    9e <strcmp+0x21>
+    p++, q++;
+  91:	83 c1 01             	add    $0x1,%ecx
+  94:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  97:	0f b6 01             	movzbl (%ecx),%eax
+  9a:	84 c0                	test   %al,%al
+  9c:	75 ef                	jne    8d <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  9e:	0f b6 c0             	movzbl %al,%eax
+  a1:	0f b6 12             	movzbl (%edx),%edx
+  a4:	29 d0                	sub    %edx,%eax
+}
+  a6:	5d                   	pop    %ebp
+  a7:	c3                   	ret
+
+000000a8 <strlen>:
+
+uint
+strlen(char *s)
+{
+  a8:	55                   	push   %ebp
+  a9:	89 e5                	mov    %esp,%ebp
+  ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  ae:	80 3a 00             	cmpb   $0x0,(%edx)
+  b1:	74 14                	je     c7 <strlen+0x1f>
+  b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  b8:	83 c0 01             	add    $0x1,%eax
+  bb:	89 c1                	mov    %eax,%ecx
+  bd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  c1:	75 f5                	jne    b8 <strlen+0x10>
+    ;
+  return n;
+}
+  c3:	89 c8                	mov    %ecx,%eax
+  c5:	5d                   	pop    %ebp
+  c6:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  cc:	eb f5                	jmp    c3 <strlen+0x1b>
+
+000000ce <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  ce:	55                   	push   %ebp
+  cf:	89 e5                	mov    %esp,%ebp
+  d1:	57                   	push   %edi
+  d2:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  d5:	89 d7                	mov    %edx,%edi
+  d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  dd:	fc                   	cld
+  de:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e0:	89 d0                	mov    %edx,%eax
+  e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  e5:	c9                   	leave
+  e6:	c3                   	ret
+
+000000e7 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  e7:	55                   	push   %ebp
+  e8:	89 e5                	mov    %esp,%ebp
+  ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  ed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  f1:	0f b6 10             	movzbl (%eax),%edx
+  f4:	84 d2                	test   %dl,%dl
+  f6:	74 15                	je     10d <strchr+0x26>
+    if(*s == c)
+  f8:	38 d1                	cmp    %dl,%cl
+  fa:	74 0f                	je     10b <strchr+0x24>
+  for(; *s; s++)
+  fc:	83 c0 01             	add    $0x1,%eax
+  ff:	0f b6 10             	movzbl (%eax),%edx
+ 102:	84 d2                	test   %dl,%dl
+ 104:	75 f2                	jne    f8 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 106:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 10b:	5d                   	pop    %ebp
+ 10c:	c3                   	ret
+  return 0;
+ 10d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 112:	eb f7                	jmp    10b <strchr+0x24>
+
+00000114 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 114:	55                   	push   %ebp
+ 115:	89 e5                	mov    %esp,%ebp
+ 117:	57                   	push   %edi
+ 118:	56                   	push   %esi
+ 119:	53                   	push   %ebx
+ 11a:	83 ec 2c             	sub    $0x2c,%esp
+ 11d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 120:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 125:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 128:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 12b:	83 c3 01             	add    $0x1,%ebx
+ 12e:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 131:	7d 27                	jge    15a <gets+0x46>
+    cc = read(0, &c, 1);
+ 133:	83 ec 04             	sub    $0x4,%esp
+ 136:	6a 01                	push   $0x1
+ 138:	57                   	push   %edi
+ 139:	6a 00                	push   $0x0
+ 13b:	e8 f9 00 00 00       	call   239 <read>
+    if(cc < 1)
+ 140:	83 c4 10             	add    $0x10,%esp
+ 143:	85 c0                	test   %eax,%eax
+ 145:	7e 13                	jle    15a <gets+0x46>
+      break;
+    buf[i++] = c;
+ 147:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 14b:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 14f:	3c 0a                	cmp    $0xa,%al
+ 151:	74 04                	je     157 <gets+0x43>
+ 153:	3c 0d                	cmp    $0xd,%al
+ 155:	75 d1                	jne    128 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 157:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 15a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 15d:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 161:	89 f0                	mov    %esi,%eax
+ 163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 166:	5b                   	pop    %ebx
+ 167:	5e                   	pop    %esi
+ 168:	5f                   	pop    %edi
+ 169:	5d                   	pop    %ebp
+ 16a:	c3                   	ret
+
+0000016b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 16b:	55                   	push   %ebp
+ 16c:	89 e5                	mov    %esp,%ebp
+ 16e:	56                   	push   %esi
+ 16f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	6a 00                	push   $0x0
+ 175:	ff 75 08             	push   0x8(%ebp)
+ 178:	e8 e4 00 00 00       	call   261 <open>
+  if(fd < 0)
+ 17d:	83 c4 10             	add    $0x10,%esp
+ 180:	85 c0                	test   %eax,%eax
+ 182:	78 24                	js     1a8 <stat+0x3d>
+ 184:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 186:	83 ec 08             	sub    $0x8,%esp
+ 189:	ff 75 0c             	push   0xc(%ebp)
+ 18c:	50                   	push   %eax
+ 18d:	e8 e7 00 00 00       	call   279 <fstat>
+ 192:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 194:	89 1c 24             	mov    %ebx,(%esp)
+ 197:	e8 ad 00 00 00       	call   249 <close>
+  return r;
+ 19c:	83 c4 10             	add    $0x10,%esp
+}
+ 19f:	89 f0                	mov    %esi,%eax
+ 1a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1a4:	5b                   	pop    %ebx
+ 1a5:	5e                   	pop    %esi
+ 1a6:	5d                   	pop    %ebp
+ 1a7:	c3                   	ret
+    return -1;
+ 1a8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1ad:	eb f0                	jmp    19f <stat+0x34>
+
+000001af <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1af:	55                   	push   %ebp
+ 1b0:	89 e5                	mov    %esp,%ebp
+ 1b2:	53                   	push   %ebx
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 1b6:	0f b6 02             	movzbl (%edx),%eax
+ 1b9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1bc:	80 f9 09             	cmp    $0x9,%cl
+ 1bf:	77 24                	ja     1e5 <atoi+0x36>
+  n = 0;
+ 1c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 1c6:	83 c2 01             	add    $0x1,%edx
+ 1c9:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 1cc:	0f be c0             	movsbl %al,%eax
+ 1cf:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 1d3:	0f b6 02             	movzbl (%edx),%eax
+ 1d6:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 1d9:	80 fb 09             	cmp    $0x9,%bl
+ 1dc:	76 e8                	jbe    1c6 <atoi+0x17>
+  return n;
+}
+ 1de:	89 c8                	mov    %ecx,%eax
+ 1e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+  n = 0;
+ 1e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1ea:	eb f2                	jmp    1de <atoi+0x2f>
+
+000001ec <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1ec:	55                   	push   %ebp
+ 1ed:	89 e5                	mov    %esp,%ebp
+ 1ef:	56                   	push   %esi
+ 1f0:	53                   	push   %ebx
+ 1f1:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1fa:	85 db                	test   %ebx,%ebx
+ 1fc:	7e 15                	jle    213 <memmove+0x27>
+ 1fe:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 200:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 202:	83 c2 01             	add    $0x1,%edx
+ 205:	83 c0 01             	add    $0x1,%eax
+ 208:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 20c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 20f:	39 c3                	cmp    %eax,%ebx
+ 211:	75 ef                	jne    202 <memmove+0x16>
+  return vdst;
+}
+ 213:	89 f0                	mov    %esi,%eax
+ 215:	5b                   	pop    %ebx
+ 216:	5e                   	pop    %esi
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+
+00000219 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 219:	b8 01 00 00 00       	mov    $0x1,%eax
+ 21e:	cd 40                	int    $0x40
+ 220:	c3                   	ret
+
+00000221 <exit>:
+SYSCALL(exit)
+ 221:	b8 02 00 00 00       	mov    $0x2,%eax
+ 226:	cd 40                	int    $0x40
+ 228:	c3                   	ret
+
+00000229 <wait>:
+SYSCALL(wait)
+ 229:	b8 03 00 00 00       	mov    $0x3,%eax
+ 22e:	cd 40                	int    $0x40
+ 230:	c3                   	ret
+
+00000231 <pipe>:
+SYSCALL(pipe)
+ 231:	b8 04 00 00 00       	mov    $0x4,%eax
+ 236:	cd 40                	int    $0x40
+ 238:	c3                   	ret
+
+00000239 <read>:
+SYSCALL(read)
+ 239:	b8 05 00 00 00       	mov    $0x5,%eax
+ 23e:	cd 40                	int    $0x40
+ 240:	c3                   	ret
+
+00000241 <write>:
+SYSCALL(write)
+ 241:	b8 10 00 00 00       	mov    $0x10,%eax
+ 246:	cd 40                	int    $0x40
+ 248:	c3                   	ret
+
+00000249 <close>:
+SYSCALL(close)
+ 249:	b8 15 00 00 00       	mov    $0x15,%eax
+ 24e:	cd 40                	int    $0x40
+ 250:	c3                   	ret
+
+00000251 <kill>:
+SYSCALL(kill)
+ 251:	b8 06 00 00 00       	mov    $0x6,%eax
+ 256:	cd 40                	int    $0x40
+ 258:	c3                   	ret
+
+00000259 <exec>:
+SYSCALL(exec)
+ 259:	b8 07 00 00 00       	mov    $0x7,%eax
+ 25e:	cd 40                	int    $0x40
+ 260:	c3                   	ret
+
+00000261 <open>:
+SYSCALL(open)
+ 261:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 266:	cd 40                	int    $0x40
+ 268:	c3                   	ret
+
+00000269 <mknod>:
+SYSCALL(mknod)
+ 269:	b8 11 00 00 00       	mov    $0x11,%eax
+ 26e:	cd 40                	int    $0x40
+ 270:	c3                   	ret
+
+00000271 <unlink>:
+SYSCALL(unlink)
+ 271:	b8 12 00 00 00       	mov    $0x12,%eax
+ 276:	cd 40                	int    $0x40
+ 278:	c3                   	ret
+
+00000279 <fstat>:
+SYSCALL(fstat)
+ 279:	b8 08 00 00 00       	mov    $0x8,%eax
+ 27e:	cd 40                	int    $0x40
+ 280:	c3                   	ret
+
+00000281 <link>:
+SYSCALL(link)
+ 281:	b8 13 00 00 00       	mov    $0x13,%eax
+ 286:	cd 40                	int    $0x40
+ 288:	c3                   	ret
+
+00000289 <mkdir>:
+SYSCALL(mkdir)
+ 289:	b8 14 00 00 00       	mov    $0x14,%eax
+ 28e:	cd 40                	int    $0x40
+ 290:	c3                   	ret
+
+00000291 <chdir>:
+SYSCALL(chdir)
+ 291:	b8 09 00 00 00       	mov    $0x9,%eax
+ 296:	cd 40                	int    $0x40
+ 298:	c3                   	ret
+
+00000299 <dup>:
+SYSCALL(dup)
+ 299:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 29e:	cd 40                	int    $0x40
+ 2a0:	c3                   	ret
+
+000002a1 <getpid>:
+SYSCALL(getpid)
+ 2a1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2a6:	cd 40                	int    $0x40
+ 2a8:	c3                   	ret
+
+000002a9 <sbrk>:
+SYSCALL(sbrk)
+ 2a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2ae:	cd 40                	int    $0x40
+ 2b0:	c3                   	ret
+
+000002b1 <sleep>:
+SYSCALL(sleep)
+ 2b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2b6:	cd 40                	int    $0x40
+ 2b8:	c3                   	ret
+
+000002b9 <uptime>:
+SYSCALL(uptime)
+ 2b9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2be:	cd 40                	int    $0x40
+ 2c0:	c3                   	ret
+
+000002c1 <readmouse>:
+SYSCALL(readmouse)
+ 2c1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2c6:	cd 40                	int    $0x40
+ 2c8:	c3                   	ret
+
+000002c9 <sigsend>:
+SYSCALL(sigsend)
+ 2c9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2ce:	cd 40                	int    $0x40
+ 2d0:	c3                   	ret
+
+000002d1 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 2d1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2d6:	cd 40                	int    $0x40
+ 2d8:	c3                   	ret
+
+000002d9 <sigreturn>:
+SYSCALL(sigreturn)
+ 2d9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2de:	cd 40                	int    $0x40
+ 2e0:	c3                   	ret
+
+000002e1 <siggetmask>:
+SYSCALL(siggetmask)
+ 2e1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 2e9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <sigpause>:
+SYSCALL(sigpause)
+ 2f1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 2f9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <sleeptick>:
+SYSCALL(sleeptick)
+ 301:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <schedctl>:
+SYSCALL(schedctl)
+ 309:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <nswtch>:
+SYSCALL(nswtch)
+ 311:	b8 20 00 00 00       	mov    $0x20,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <getloadavg>:
+SYSCALL(getloadavg)
+ 319:	b8 21 00 00 00       	mov    $0x21,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <memstat>:
+SYSCALL(memstat)
+ 321:	b8 22 00 00 00       	mov    $0x22,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <iostat>:
+SYSCALL(iostat)
+ 329:	b8 23 00 00 00       	mov    $0x23,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 331:	55                   	push   %ebp
+ 332:	89 e5                	mov    %esp,%ebp
+ 334:	57                   	push   %edi
+ 335:	56                   	push   %esi
+ 336:	53                   	push   %ebx
+ 337:	83 ec 3c             	sub    $0x3c,%esp
+ 33a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 33d:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 33f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 343:	74 79                	je     3be <printint+0x8d>
+ 345:	85 d2                	test   %edx,%edx
+ 347:	79 75                	jns    3be <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 349:	89 d1                	mov    %edx,%ecx
+ 34b:	f7 d9                	neg    %ecx
+    neg = 1;
+ 34d:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 354:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 359:	89 df                	mov    %ebx,%edi
+ 35b:	83 c3 01             	add    $0x1,%ebx
+ 35e:	89 c8                	mov    %ecx,%eax
+ 360:	ba 00 00 00 00       	mov    $0x0,%edx
+ 365:	f7 f6                	div    %esi
+ 367:	0f b6 92 34 07 00 00 	movzbl 0x734(%edx),%edx
+ 36e:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 372:	89 ca                	mov    %ecx,%edx
+ 374:	89 c1                	mov    %eax,%ecx
+ 376:	39 f2                	cmp    %esi,%edx
+ 378:	73 df                	jae    359 <printint+0x28>
+  if(neg)
+ 37a:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 37e:	74 08                	je     388 <printint+0x57>
+    buf[i++] = '-';
+ 380:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 385:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 388:	85 db                	test   %ebx,%ebx
+ 38a:	7e 2a                	jle    3b6 <printint+0x85>
+ 38c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 38f:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 393:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 396:	0f b6 03             	movzbl (%ebx),%eax
+ 399:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 39c:	83 ec 04             	sub    $0x4,%esp
+ 39f:	6a 01                	push   $0x1
+ 3a1:	57                   	push   %edi
+ 3a2:	ff 75 c4             	push   -0x3c(%ebp)
+ 3a5:	e8 97 fe ff ff       	call   241 <write>
+  while(--i >= 0)
+ 3aa:	89 d8                	mov    %ebx,%eax
+ 3ac:	83 eb 01             	sub    $0x1,%ebx
+ 3af:	83 c4 10             	add    $0x10,%esp
+ 3b2:	39 f0                	cmp    %esi,%eax
+ 3b4:	75 e0                	jne    396 <printint+0x65>
+}
+ 3b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5f                   	pop    %edi
+ 3bc:	5d                   	pop    %ebp
+ 3bd:	c3                   	ret
+    x = xx;
+ 3be:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 3c0:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 3c7:	eb 8b                	jmp    354 <printint+0x23>
+
+000003c9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 3c9:	55                   	push   %ebp
+ 3ca:	89 e5                	mov    %esp,%ebp
+ 3cc:	57                   	push   %edi
+ 3cd:	56                   	push   %esi
+ 3ce:	53                   	push   %ebx
+ 3cf:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 3d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3d5:	0f b6 1e             	movzbl (%esi),%ebx
+ 3d8:	84 db                	test   %bl,%bl
+ 3da:	0f 84 9e 01 00 00    	je     57e <printf+0x1b5>
+ 3e0:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 3e3:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3e6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 3e9:	bf 00 00 00 00       	mov    $0x0,%edi
+ 3ee:	eb 2d                	jmp    41d <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 3f0:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 3f3:	83 ec 04             	sub    $0x4,%esp
+ 3f6:	6a 01                	push   $0x1
+ 3f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 3fb:	50                   	push   %eax
+ 3fc:	ff 75 08             	push   0x8(%ebp)
+ 3ff:	e8 3d fe ff ff       	call   241 <write>
+        putc(fd, c);
+ 404:	83 c4 10             	add    $0x10,%esp
+ 407:	eb 05                	jmp    40e <printf+0x45>
+      }
+    } else if(state == '%'){
+ 409:	83 ff 25             	cmp    $0x25,%edi
+ 40c:	74 1f                	je     42d <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 40e:	83 c6 01             	add    $0x1,%esi
+ 411:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 415:	84 db                	test   %bl,%bl
+ 417:	0f 84 61 01 00 00    	je     57e <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 41d:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 420:	85 ff                	test   %edi,%edi
+ 422:	75 e5                	jne    409 <printf+0x40>
+      if(c == '%'){
+ 424:	83 f8 25             	cmp    $0x25,%eax
+ 427:	75 c7                	jne    3f0 <printf+0x27>
+        state = '%';
+ 429:	89 c7                	mov    %eax,%edi
+ 42b:	eb e1                	jmp    40e <printf+0x45>
+      if(c == 'd'){
+ 42d:	83 f8 25             	cmp    $0x25,%eax
+ 430:	0f 84 f4 00 00 00    	je     52a <printf+0x161>
+ 436:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 439:	83 fa 15             	cmp    $0x15,%edx
+ 43c:	0f 87 09 01 00 00    	ja     54b <printf+0x182>
+ 442:	0f 87 03 01 00 00    	ja     54b <printf+0x182>
+ 448:	ff 24 95 dc 06 00 00 	jmp    *0x6dc(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 44f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 452:	8b 17                	mov    (%edi),%edx
+ 454:	83 ec 0c             	sub    $0xc,%esp
+ 457:	6a 01                	push   $0x1
+ 459:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 45e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 461:	e8 cb fe ff ff       	call   331 <printint>
+        ap++;
+ 466:	83 c7 04             	add    $0x4,%edi
+ 469:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 46c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 46f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 474:	eb 98                	jmp    40e <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 476:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 479:	8b 17                	mov    (%edi),%edx
+ 47b:	83 ec 0c             	sub    $0xc,%esp
+ 47e:	6a 00                	push   $0x0
+ 480:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 485:	8b 45 08             	mov    0x8(%ebp),%eax
+ 488:	e8 a4 fe ff ff       	call   331 <printint>
+        ap++;
+ 48d:	83 c7 04             	add    $0x4,%edi
+ 490:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 493:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 496:	bf 00 00 00 00       	mov    $0x0,%edi
+ 49b:	e9 6e ff ff ff       	jmp    40e <printf+0x45>
+        s = (char*)*ap;
+ 4a0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 4a3:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 4a5:	83 c1 04             	add    $0x4,%ecx
+ 4a8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 4ab:	85 c0                	test   %eax,%eax
+ 4ad:	74 13                	je     4c2 <printf+0xf9>
+        s = (char*)*ap;
+ 4af:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 4b1:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 4b4:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 4b9:	84 c0                	test   %al,%al
+ 4bb:	75 0f                	jne    4cc <printf+0x103>
+ 4bd:	e9 4c ff ff ff       	jmp    40e <printf+0x45>
+          s = "(null)";
+ 4c2:	bb d4 06 00 00       	mov    $0x6d4,%ebx
+        while(*s != 0){
+ 4c7:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 4cc:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 4cf:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 4d2:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 4d5:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4d8:	83 ec 04             	sub    $0x4,%esp
+ 4db:	6a 01                	push   $0x1
+ 4dd:	57                   	push   %edi
+ 4de:	56                   	push   %esi
+ 4df:	e8 5d fd ff ff       	call   241 <write>
+          s++;
+ 4e4:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 4e7:	0f b6 03             	movzbl (%ebx),%eax
+ 4ea:	83 c4 10             	add    $0x10,%esp
+ 4ed:	84 c0                	test   %al,%al
+ 4ef:	75 e4                	jne    4d5 <printf+0x10c>
+      state = 0;
+ 4f1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4f4:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4f9:	e9 10 ff ff ff       	jmp    40e <printf+0x45>
+        putc(fd, *ap);
+ 4fe:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 501:	8b 07                	mov    (%edi),%eax
+ 503:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 506:	83 ec 04             	sub    $0x4,%esp
+ 509:	6a 01                	push   $0x1
+ 50b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 50e:	50                   	push   %eax
+ 50f:	ff 75 08             	push   0x8(%ebp)
+ 512:	e8 2a fd ff ff       	call   241 <write>
+        ap++;
+ 517:	83 c7 04             	add    $0x4,%edi
+ 51a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 51d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 520:	bf 00 00 00 00       	mov    $0x0,%edi
+ 525:	e9 e4 fe ff ff       	jmp    40e <printf+0x45>
+        putc(fd, c);
+ 52a:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 52d:	83 ec 04             	sub    $0x4,%esp
+ 530:	6a 01                	push   $0x1
+ 532:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 535:	50                   	push   %eax
+ 536:	ff 75 08             	push   0x8(%ebp)
+ 539:	e8 03 fd ff ff       	call   241 <write>
+ 53e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 541:	bf 00 00 00 00       	mov    $0x0,%edi
+ 546:	e9 c3 fe ff ff       	jmp    40e <printf+0x45>
+        putc(fd, '%');
+ 54b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 54f:	83 ec 04             	sub    $0x4,%esp
+ 552:	6a 01                	push   $0x1
+ 554:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 557:	57                   	push   %edi
+ 558:	ff 75 08             	push   0x8(%ebp)
+ 55b:	e8 e1 fc ff ff       	call   241 <write>
+        putc(fd, c);
+ 560:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 563:	83 c4 0c             	add    $0xc,%esp
+ 566:	6a 01                	push   $0x1
+ 568:	57                   	push   %edi
+ 569:	ff 75 08             	push   0x8(%ebp)
+ 56c:	e8 d0 fc ff ff       	call   241 <write>
+        putc(fd, c);
+ 571:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 574:	bf 00 00 00 00       	mov    $0x0,%edi
+ 579:	e9 90 fe ff ff       	jmp    40e <printf+0x45>
+    }
+  }
+}
+ 57e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 581:	5b                   	pop    %ebx
+ 582:	5e                   	pop    %esi
+ 583:	5f                   	pop    %edi
+ 584:	5d                   	pop    %ebp
+ 585:	c3                   	ret
+
+00000586 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 586:	55                   	push   %ebp
+ 587:	89 e5                	mov    %esp,%ebp
+ 589:	57                   	push   %edi
+ 58a:	56                   	push   %esi
+ 58b:	53                   	push   %ebx
+ 58c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 58f:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 592:	a1 a8 09 00 00       	mov    0x9a8,%eax
+ 597:	eb 0c                	jmp    5a5 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 599:	8b 10                	mov    (%eax),%edx
+ 59b:	39 d0                	cmp    %edx,%eax
+ 59d:	72 04                	jb     5a3 <free+0x1d>
+ 59f:	39 d1                	cmp    %edx,%ecx
+ 5a1:	72 10                	jb     5b3 <free+0x2d>
+{
+ 5a3:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5a5:	39 c8                	cmp    %ecx,%eax
+ 5a7:	73 f0                	jae    599 <free+0x13>
+ 5a9:	8b 10                	mov    (%eax),%edx
+ 5ab:	39 d1                	cmp    %edx,%ecx
+ 5ad:	72 04                	jb     5b3 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5af:	39 d0                	cmp    %edx,%eax
+ 5b1:	72 f0                	jb     5a3 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5b3:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5b6:	8b 10                	mov    (%eax),%edx
+ 5b8:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5bb:	39 fa                	cmp    %edi,%edx
+ 5bd:	74 19                	je     5d8 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5bf:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 5c2:	8b 50 04             	mov    0x4(%eax),%edx
+ 5c5:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5c8:	39 f1                	cmp    %esi,%ecx
+ 5ca:	74 18                	je     5e4 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 5cc:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 5ce:	a3 a8 09 00 00       	mov    %eax,0x9a8
+}
+ 5d3:	5b                   	pop    %ebx
+ 5d4:	5e                   	pop    %esi
+ 5d5:	5f                   	pop    %edi
+ 5d6:	5d                   	pop    %ebp
+ 5d7:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5d8:	03 72 04             	add    0x4(%edx),%esi
+ 5db:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5de:	8b 10                	mov    (%eax),%edx
+ 5e0:	8b 12                	mov    (%edx),%edx
+ 5e2:	eb db                	jmp    5bf <free+0x39>
+    p->s.size += bp->s.size;
+ 5e4:	03 53 fc             	add    -0x4(%ebx),%edx
+ 5e7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 5ea:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 5ed:	eb dd                	jmp    5cc <free+0x46>
+
+000005ef <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 5ef:	55                   	push   %ebp
+ 5f0:	89 e5                	mov    %esp,%ebp
+ 5f2:	57                   	push   %edi
+ 5f3:	56                   	push   %esi
+ 5f4:	53                   	push   %ebx
+ 5f5:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fb:	8d 58 07             	lea    0x7(%eax),%ebx
+ 5fe:	c1 eb 03             	shr    $0x3,%ebx
+ 601:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 604:	8b 15 a8 09 00 00    	mov    0x9a8,%edx
+ 60a:	85 d2                	test   %edx,%edx
+ 60c:	74 1c                	je     62a <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 60e:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 610:	8b 48 04             	mov    0x4(%eax),%ecx
+ 613:	39 d9                	cmp    %ebx,%ecx
+ 615:	73 38                	jae    64f <malloc+0x60>
+  if(nu < 4096)
+ 617:	be 00 10 00 00       	mov    $0x1000,%esi
+ 61c:	39 f3                	cmp    %esi,%ebx
+ 61e:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 621:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 628:	eb 72                	jmp    69c <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 62a:	c7 05 a8 09 00 00 ac 	movl   $0x9ac,0x9a8
+ 631:	09 00 00 
+ 634:	c7 05 ac 09 00 00 ac 	movl   $0x9ac,0x9ac
+ 63b:	09 00 00 
+    base.s.size = 0;
+ 63e:	c7 05 b0 09 00 00 00 	movl   $0x0,0x9b0
+ 645:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 648:	b8 ac 09 00 00       	mov    $0x9ac,%eax
+    if(p->s.size >= nunits){
+ 64d:	eb c8                	jmp    617 <malloc+0x28>
+      if(p->s.size == nunits)
+ 64f:	39 cb                	cmp    %ecx,%ebx
+ 651:	74 1e                	je     671 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 653:	29 d9                	sub    %ebx,%ecx
+ 655:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 658:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 65b:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 65e:	89 15 a8 09 00 00    	mov    %edx,0x9a8
+      return (void*)(p + 1);
+ 664:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 667:	89 d0                	mov    %edx,%eax
+ 669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 66c:	5b                   	pop    %ebx
+ 66d:	5e                   	pop    %esi
+ 66e:	5f                   	pop    %edi
+ 66f:	5d                   	pop    %ebp
+ 670:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 671:	8b 08                	mov    (%eax),%ecx
+ 673:	89 0a                	mov    %ecx,(%edx)
+ 675:	eb e7                	jmp    65e <malloc+0x6f>
+  hp->s.size = nu;
+ 677:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 67a:	83 ec 0c             	sub    $0xc,%esp
+ 67d:	83 c0 08             	add    $0x8,%eax
+ 680:	50                   	push   %eax
+ 681:	e8 00 ff ff ff       	call   586 <free>
+  return freep;
+ 686:	8b 15 a8 09 00 00    	mov    0x9a8,%edx
+      if((p = morecore(nunits)) == 0)
+ 68c:	83 c4 10             	add    $0x10,%esp
+ 68f:	85 d2                	test   %edx,%edx
+ 691:	74 d4                	je     667 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 693:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 695:	8b 48 04             	mov    0x4(%eax),%ecx
+ 698:	39 d9                	cmp    %ebx,%ecx
+ 69a:	73 b3                	jae    64f <malloc+0x60>
+    if(p == freep)
+ 69c:	89 c2                	mov    %eax,%edx
+ 69e:	39 05 a8 09 00 00    	cmp    %eax,0x9a8
+ 6a4:	75 ed                	jne    693 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 6a6:	83 ec 0c             	sub    $0xc,%esp
+ 6a9:	57                   	push   %edi
+ 6aa:	e8 fa fb ff ff       	call   2a9 <sbrk>
+  if(p == (char*)-1)
+ 6af:	83 c4 10             	add    $0x10,%esp
+ 6b2:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6b5:	75 c0                	jne    677 <malloc+0x88>
+        return 0;
+ 6b7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6bc:	eb a9                	jmp    667 <malloc+0x78>
@@ -0,0 +1,1111 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  12:	83 39 03             	cmpl   $0x3,(%ecx)
+  15:	74 14                	je     2b <main+0x2b>
+    printf(2, "Usage: ln old new\n");
+  17:	83 ec 08             	sub    $0x8,%esp
+  1a:	68 c4 06 00 00       	push   $0x6c4
+  1f:	6a 02                	push   $0x2
+  21:	e8 a6 03 00 00       	call   3cc <printf>
+    exit();
+  26:	e8 f9 01 00 00       	call   224 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2b:	83 ec 08             	sub    $0x8,%esp
+  2e:	ff 73 08             	push   0x8(%ebx)
+  31:	ff 73 04             	push   0x4(%ebx)
+  34:	e8 4b 02 00 00       	call   284 <link>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	85 c0                	test   %eax,%eax
+  3e:	78 05                	js     45 <main+0x45>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  40:	e8 df 01 00 00       	call   224 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  45:	ff 73 08             	push   0x8(%ebx)
+  48:	ff 73 04             	push   0x4(%ebx)
+  4b:	68 d7 06 00 00       	push   $0x6d7
+  50:	6a 02                	push   $0x2
+  52:	e8 75 03 00 00       	call   3cc <printf>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	eb e4                	jmp    40 <main+0x40>
+
+0000005c <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  5c:	55                   	push   %ebp
+  5d:	89 e5                	mov    %esp,%ebp
+  5f:	53                   	push   %ebx
+  60:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  63:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  66:	b8 00 00 00 00       	mov    $0x0,%eax
+  6b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  6f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  72:	83 c0 01             	add    $0x1,%eax
+  75:	84 d2                	test   %dl,%dl
+  77:	75 f2                	jne    6b <strcpy+0xf>
+    ;
+  return os;
+}
+  79:	89 c8                	mov    %ecx,%eax
+  7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  7e:	c9                   	leave
+  7f:	c3                   	ret
+
+00000080 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  89:	0f b6 01             	movzbl (%ecx),%eax
+  8c:	84 c0                	test   %al,%al
+  8e:	74 11                	je     a1 <strcmp+0x21>
+  90:	38 02                	cmp    %al,(%edx)
+  92:	75 0d                	jne    a1 <strcmp+0x21>
+    p++, q++;
+  94:	83 c1 01             	add    $0x1,%ecx
+  97:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  9a:	0f b6 01             	movzbl (%ecx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 ef                	jne    90 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  a1:	0f b6 c0             	movzbl %al,%eax
+  a4:	0f b6 12             	movzbl (%edx),%edx
+  a7:	29 d0                	sub    %edx,%eax
+}
+  a9:	5d                   	pop    %ebp
+  aa:	c3                   	ret
+
+000000ab <strlen>:
+
+uint
+strlen(char *s)
+{
+  ab:	55                   	push   %ebp
+  ac:	89 e5                	mov    %esp,%ebp
+  ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  b1:	80 3a 00             	cmpb   $0x0,(%edx)
+  b4:	74 14                	je     ca <strlen+0x1f>
+  b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  bb:	83 c0 01             	add    $0x1,%eax
+  be:	89 c1                	mov    %eax,%ecx
+  c0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  c4:	75 f5                	jne    bb <strlen+0x10>
+    ;
+  return n;
+}
+  c6:	89 c8                	mov    %ecx,%eax
+  c8:	5d                   	pop    %ebp
+  c9:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  cf:	eb f5                	jmp    c6 <strlen+0x1b>
+
+000000d1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  d1:	55                   	push   %ebp
+  d2:	89 e5                	mov    %esp,%ebp
+  d4:	57                   	push   %edi
+  d5:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  d8:	89 d7                	mov    %edx,%edi
+  da:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e0:	fc                   	cld
+  e1:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  e3:	89 d0                	mov    %edx,%eax
+  e5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  e8:	c9                   	leave
+  e9:	c3                   	ret
+
+000000ea <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  ea:	55                   	push   %ebp
+  eb:	89 e5                	mov    %esp,%ebp
+  ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  f0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  f4:	0f b6 10             	movzbl (%eax),%edx
+  f7:	84 d2                	test   %dl,%dl
+  f9:	74 15                	je     110 <strchr+0x26>
+    if(*s == c)
+  fb:	38 d1                	cmp    %dl,%cl
+  fd:	74 0f                	je     10e <strchr+0x24>
+  for(; *s; s++)
+  ff:	83 c0 01             	add    $0x1,%eax
+ 102:	0f b6 10             	movzbl (%eax),%edx
+ 105:	84 d2                	test   %dl,%dl
+ 107:	75 f2                	jne    fb <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 109:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 10e:	5d                   	pop    %ebp
+ 10f:	c3                   	ret
+  return 0;
+ 110:	b8 00 00 00 00       	mov    $0x0,%eax
+ 115:	eb f7                	jmp    10e <strchr+0x24>
+
+00000117 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 117:	55                   	push   %ebp
+ 118:	89 e5                	mov    %esp,%ebp
+ 11a:	57                   	push   %edi
+ 11b:	56                   	push   %esi
+ 11c:	53                   	push   %ebx
+ 11d:	83 ec 2c             	sub    $0x2c,%esp
+ 120:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 123:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 128:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 12b:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 12e:	83 c3 01             	add    $0x1,%ebx
+ 131:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 134:	7d 27                	jge    15d <gets+0x46>
+    cc = read(0, &c, 1);
+ 136:	83 ec 04             	sub    $0x4,%esp
+ 139:	6a 01                	push   $0x1
+ 13b:	57                   	push   %edi
+ 13c:	6a 00                	push   $0x0
+ 13e:	e8 f9 00 00 00       	call   23c <read>
+    if(cc < 1)
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	85 c0                	test   %eax,%eax
+ 148:	7e 13                	jle    15d <gets+0x46>
+      break;
+    buf[i++] = c;
+ 14a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 14e:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 152:	3c 0a                	cmp    $0xa,%al
+ 154:	74 04                	je     15a <gets+0x43>
+ 156:	3c 0d                	cmp    $0xd,%al
+ 158:	75 d1                	jne    12b <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 15a:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 15d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 160:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 164:	89 f0                	mov    %esi,%eax
+ 166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+
+0000016e <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	56                   	push   %esi
+ 172:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 173:	83 ec 08             	sub    $0x8,%esp
+ 176:	6a 00                	push   $0x0
+ 178:	ff 75 08             	push   0x8(%ebp)
+ 17b:	e8 e4 00 00 00       	call   264 <open>
+  if(fd < 0)
+ 180:	83 c4 10             	add    $0x10,%esp
+ 183:	85 c0                	test   %eax,%eax
+ 185:	78 24                	js     1ab <stat+0x3d>
+ 187:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 189:	83 ec 08             	sub    $0x8,%esp
+ 18c:	ff 75 0c             	push   0xc(%ebp)
+ 18f:	50                   	push   %eax
+ 190:	e8 e7 00 00 00       	call   27c <fstat>
+ 195:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 197:	89 1c 24             	mov    %ebx,(%esp)
+ 19a:	e8 ad 00 00 00       	call   24c <close>
+  return r;
+ 19f:	83 c4 10             	add    $0x10,%esp
+}
+ 1a2:	89 f0                	mov    %esi,%eax
+ 1a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1a7:	5b                   	pop    %ebx
+ 1a8:	5e                   	pop    %esi
+ 1a9:	5d                   	pop    %ebp
+ 1aa:	c3                   	ret
+    return -1;
+ 1ab:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1b0:	eb f0                	jmp    1a2 <stat+0x34>
+
+000001b2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1b2:	55                   	push   %ebp
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	53                   	push   %ebx
+ 1b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 1b9:	0f b6 02             	movzbl (%edx),%eax
+ 1bc:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1bf:	80 f9 09             	cmp    $0x9,%cl
+ 1c2:	77 24                	ja     1e8 <atoi+0x36>
+  n = 0;
+ 1c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 1c9:	83 c2 01             	add    $0x1,%edx
+ 1cc:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 1cf:	0f be c0             	movsbl %al,%eax
+ 1d2:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 1d6:	0f b6 02             	movzbl (%edx),%eax
+ 1d9:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 1dc:	80 fb 09             	cmp    $0x9,%bl
+ 1df:	76 e8                	jbe    1c9 <atoi+0x17>
+  return n;
+}
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e6:	c9                   	leave
+ 1e7:	c3                   	ret
+  n = 0;
+ 1e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1ed:	eb f2                	jmp    1e1 <atoi+0x2f>
+
+000001ef <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1ef:	55                   	push   %ebp
+ 1f0:	89 e5                	mov    %esp,%ebp
+ 1f2:	56                   	push   %esi
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1fd:	85 db                	test   %ebx,%ebx
+ 1ff:	7e 15                	jle    216 <memmove+0x27>
+ 201:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 203:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 205:	83 c2 01             	add    $0x1,%edx
+ 208:	83 c0 01             	add    $0x1,%eax
+ 20b:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 20f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 212:	39 c3                	cmp    %eax,%ebx
+ 214:	75 ef                	jne    205 <memmove+0x16>
+  return vdst;
+}
+ 216:	89 f0                	mov    %esi,%eax
+ 218:	5b                   	pop    %ebx
+ 219:	5e                   	pop    %esi
+ 21a:	5d                   	pop    %ebp
+ 21b:	c3                   	ret
+
+0000021c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 21c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 221:	cd 40                	int    $0x40
+ 223:	c3                   	ret
+
+00000224 <exit>:
+SYSCALL(exit)
+ 224:	b8 02 00 00 00       	mov    $0x2,%eax
+ 229:	cd 40                	int    $0x40
+ 22b:	c3                   	ret
+
+0000022c <wait>:
+SYSCALL(wait)
+ 22c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 231:	cd 40                	int    $0x40
+ 233:	c3                   	ret
+
+00000234 <pipe>:
+SYSCALL(pipe)
+ 234:	b8 04 00 00 00       	mov    $0x4,%eax
+ 239:	cd 40                	int    $0x40
+ 23b:	c3                   	ret
+
+0000023c <read>:
+SYSCALL(read)
+ 23c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 241:	cd 40                	int    $0x40
+ 243:	c3                   	ret
+
+00000244 <write>:
+SYSCALL(write)
+ 244:	b8 10 00 00 00       	mov    $0x10,%eax
+ 249:	cd 40                	int    $0x40
+ 24b:	c3                   	ret
+
+0000024c <close>:
+SYSCALL(close)
+ 24c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 251:	cd 40                	int    $0x40
+ 253:	c3                   	ret
+
+00000254 <kill>:
+SYSCALL(kill)
+ 254:	b8 06 00 00 00       	mov    $0x6,%eax
+ 259:	cd 40                	int    $0x40
+ 25b:	c3                   	ret
+
+0000025c <exec>:
+SYSCALL(exec)
+ 25c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 261:	cd 40                	int    $0x40
+ 263:	c3                   	ret
+
+00000264 <open>:
+SYSCALL(open)
+ 264:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 269:	cd 40                	int    $0x40
+ 26b:	c3                   	ret
+
+0000026c <mknod>:
+SYSCALL(mknod)
+ 26c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 271:	cd 40                	int    $0x40
+ 273:	c3                   	ret
+
+00000274 <unlink>:
+SYSCALL(unlink)
+ 274:	b8 12 00 00 00       	mov    $0x12,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+0000027c <fstat>:
+SYSCALL(fstat)
+ 27c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+00000284 <link>:
+SYSCALL(link)
+ 284:	b8 13 00 00 00       	mov    $0x13,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+0000028c <mkdir>:
+SYSCALL(mkdir)
+ 28c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+00000294 <chdir>:
+SYSCALL(chdir)
+ 294:	b8 09 00 00 00       	mov    $0x9,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <dup>:
+SYSCALL(dup)
+ 29c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <getpid>:
+SYSCALL(getpid)
+ 2a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <sbrk>:
+SYSCALL(sbrk)
+ 2ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <sleep>:
+SYSCALL(sleep)
+ 2b4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <uptime>:
+SYSCALL(uptime)
+ 2bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <readmouse>:
+SYSCALL(readmouse)
+ 2c4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <sigsend>:
+SYSCALL(sigsend)
+ 2cc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 2d4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <sigreturn>:
+SYSCALL(sigreturn)
+ 2dc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <siggetmask>:
+SYSCALL(siggetmask)
+ 2e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <sigsetmask>:
+SYSCALL(sigsetmask)
+ 2ec:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <sigpause>:
+SYSCALL(sigpause)
+ 2f4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <predict_cpu>:
+SYSCALL(predict_cpu)
+ 2fc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <sleeptick>:
+SYSCALL(sleeptick)
+ 304:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <schedctl>:
+SYSCALL(schedctl)
+ 30c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <nswtch>:
+SYSCALL(nswtch)
+ 314:	b8 20 00 00 00       	mov    $0x20,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <getloadavg>:
+SYSCALL(getloadavg)
+ 31c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <memstat>:
+SYSCALL(memstat)
+ 324:	b8 22 00 00 00       	mov    $0x22,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <iostat>:
+SYSCALL(iostat)
+ 32c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 334:	55                   	push   %ebp
+ 335:	89 e5                	mov    %esp,%ebp
+ 337:	57                   	push   %edi
+ 338:	56                   	push   %esi
+ 339:	53                   	push   %ebx
+ 33a:	83 ec 3c             	sub    $0x3c,%esp
+ 33d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 340:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 342:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 346:	74 79                	je     3c1 <printint+0x8d>
+ 348:	85 d2                	test   %edx,%edx
+ 34a:	79 75                	jns    3c1 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 34c:	89 d1                	mov    %edx,%ecx
+ 34e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 350:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 357:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 35c:	89 df                	mov    %ebx,%edi
+ 35e:	83 c3 01             	add    $0x1,%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	ba 00 00 00 00       	mov    $0x0,%edx
+ 368:	f7 f6                	div    %esi
+ 36a:	0f b6 92 4c 07 00 00 	movzbl 0x74c(%edx),%edx
+ 371:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 375:	89 ca                	mov    %ecx,%edx
+ 377:	89 c1                	mov    %eax,%ecx
+ 379:	39 f2                	cmp    %esi,%edx
+ 37b:	73 df                	jae    35c <printint+0x28>
+  if(neg)
+ 37d:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 381:	74 08                	je     38b <printint+0x57>
+    buf[i++] = '-';
+ 383:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 388:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 38b:	85 db                	test   %ebx,%ebx
+ 38d:	7e 2a                	jle    3b9 <printint+0x85>
+ 38f:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 392:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 396:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 399:	0f b6 03             	movzbl (%ebx),%eax
+ 39c:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 39f:	83 ec 04             	sub    $0x4,%esp
+ 3a2:	6a 01                	push   $0x1
+ 3a4:	57                   	push   %edi
+ 3a5:	ff 75 c4             	push   -0x3c(%ebp)
+ 3a8:	e8 97 fe ff ff       	call   244 <write>
+  while(--i >= 0)
+ 3ad:	89 d8                	mov    %ebx,%eax
+ 3af:	83 eb 01             	sub    $0x1,%ebx
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	39 f0                	cmp    %esi,%eax
+ 3b7:	75 e0                	jne    399 <printint+0x65>
+}
+ 3b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	5e                   	pop    %esi
+ 3be:	5f                   	pop    %edi
+ 3bf:	5d                   	pop    %ebp
+ 3c0:	c3                   	ret
+    x = xx;
+ 3c1:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 3c3:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 3ca:	eb 8b                	jmp    357 <printint+0x23>
+
+000003cc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 3cc:	55                   	push   %ebp
+ 3cd:	89 e5                	mov    %esp,%ebp
+ 3cf:	57                   	push   %edi
+ 3d0:	56                   	push   %esi
+ 3d1:	53                   	push   %ebx
+ 3d2:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 3d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3d8:	0f b6 1e             	movzbl (%esi),%ebx
+ 3db:	84 db                	test   %bl,%bl
+ 3dd:	0f 84 9e 01 00 00    	je     581 <printf+0x1b5>
+ 3e3:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 3e6:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 3ec:	bf 00 00 00 00       	mov    $0x0,%edi
+ 3f1:	eb 2d                	jmp    420 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 3f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 3f6:	83 ec 04             	sub    $0x4,%esp
+ 3f9:	6a 01                	push   $0x1
+ 3fb:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 3fe:	50                   	push   %eax
+ 3ff:	ff 75 08             	push   0x8(%ebp)
+ 402:	e8 3d fe ff ff       	call   244 <write>
+        putc(fd, c);
+ 407:	83 c4 10             	add    $0x10,%esp
+ 40a:	eb 05                	jmp    411 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 40c:	83 ff 25             	cmp    $0x25,%edi
+ 40f:	74 1f                	je     430 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 411:	83 c6 01             	add    $0x1,%esi
+ 414:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 418:	84 db                	test   %bl,%bl
+ 41a:	0f 84 61 01 00 00    	je     581 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 420:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 423:	85 ff                	test   %edi,%edi
+ 425:	75 e5                	jne    40c <printf+0x40>
+      if(c == '%'){
+ 427:	83 f8 25             	cmp    $0x25,%eax
+ 42a:	75 c7                	jne    3f3 <printf+0x27>
+        state = '%';
+ 42c:	89 c7                	mov    %eax,%edi
+ 42e:	eb e1                	jmp    411 <printf+0x45>
+      if(c == 'd'){
+ 430:	83 f8 25             	cmp    $0x25,%eax
+ 433:	0f 84 f4 00 00 00    	je     52d <printf+0x161>
+ 439:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 43c:	83 fa 15             	cmp    $0x15,%edx
+ 43f:	0f 87 09 01 00 00    	ja     54e <printf+0x182>
+ 445:	0f 87 03 01 00 00    	ja     54e <printf+0x182>
+ 44b:	ff 24 95 f4 06 00 00 	jmp    *0x6f4(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 452:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 455:	8b 17                	mov    (%edi),%edx
+ 457:	83 ec 0c             	sub    $0xc,%esp
+ 45a:	6a 01                	push   $0x1
+ 45c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 461:	8b 45 08             	mov    0x8(%ebp),%eax
+ 464:	e8 cb fe ff ff       	call   334 <printint>
+        ap++;
+ 469:	83 c7 04             	add    $0x4,%edi
+ 46c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 46f:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 472:	bf 00 00 00 00       	mov    $0x0,%edi
+ 477:	eb 98                	jmp    411 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 479:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 47c:	8b 17                	mov    (%edi),%edx
+ 47e:	83 ec 0c             	sub    $0xc,%esp
+ 481:	6a 00                	push   $0x0
+ 483:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 488:	8b 45 08             	mov    0x8(%ebp),%eax
+ 48b:	e8 a4 fe ff ff       	call   334 <printint>
+        ap++;
+ 490:	83 c7 04             	add    $0x4,%edi
+ 493:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 496:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 499:	bf 00 00 00 00       	mov    $0x0,%edi
+ 49e:	e9 6e ff ff ff       	jmp    411 <printf+0x45>
+        s = (char*)*ap;
+ 4a3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 4a6:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 4a8:	83 c1 04             	add    $0x4,%ecx
+ 4ab:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 4ae:	85 c0                	test   %eax,%eax
+ 4b0:	74 13                	je     4c5 <printf+0xf9>
+        s = (char*)*ap;
+ 4b2:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 4b4:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 4b7:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 4bc:	84 c0                	test   %al,%al
+ 4be:	75 0f                	jne    4cf <printf+0x103>
+ 4c0:	e9 4c ff ff ff       	jmp    411 <printf+0x45>
+          s = "(null)";
+ 4c5:	bb eb 06 00 00       	mov    $0x6eb,%ebx
+        while(*s != 0){
+ 4ca:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 4cf:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 4d2:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 4d5:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 4d8:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4db:	83 ec 04             	sub    $0x4,%esp
+ 4de:	6a 01                	push   $0x1
+ 4e0:	57                   	push   %edi
+ 4e1:	56                   	push   %esi
+ 4e2:	e8 5d fd ff ff       	call   244 <write>
+          s++;
+ 4e7:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 4ea:	0f b6 03             	movzbl (%ebx),%eax
+ 4ed:	83 c4 10             	add    $0x10,%esp
+ 4f0:	84 c0                	test   %al,%al
+ 4f2:	75 e4                	jne    4d8 <printf+0x10c>
+      state = 0;
+ 4f4:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4f7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4fc:	e9 10 ff ff ff       	jmp    411 <printf+0x45>
+        putc(fd, *ap);
+ 501:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 504:	8b 07                	mov    (%edi),%eax
+ 506:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 509:	83 ec 04             	sub    $0x4,%esp
+ 50c:	6a 01                	push   $0x1
+ 50e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 511:	50                   	push   %eax
+ 512:	ff 75 08             	push   0x8(%ebp)
+ 515:	e8 2a fd ff ff       	call   244 <write>
+        ap++;
+ 51a:	83 c7 04             	add    $0x4,%edi
+ 51d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 520:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 523:	bf 00 00 00 00       	mov    $0x0,%edi
+ 528:	e9 e4 fe ff ff       	jmp    411 <printf+0x45>
+        putc(fd, c);
+ 52d:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	6a 01                	push   $0x1
+ 535:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 538:	50                   	push   %eax
+ 539:	ff 75 08             	push   0x8(%ebp)
+ 53c:	e8 03 fd ff ff       	call   244 <write>
+ 541:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 544:	bf 00 00 00 00       	mov    $0x0,%edi
+ 549:	e9 c3 fe ff ff       	jmp    411 <printf+0x45>
+        putc(fd, '%');
+ 54e:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 552:	83 ec 04             	sub    $0x4,%esp
+ 555:	6a 01                	push   $0x1
+ 557:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 55a:	57                   	push   %edi
+ 55b:	ff 75 08             	push   0x8(%ebp)
+ 55e:	e8 e1 fc ff ff       	call   244 <write>
+        putc(fd, c);
+ 563:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 566:	83 c4 0c             	add    $0xc,%esp
+ 569:	6a 01                	push   $0x1
+ 56b:	57                   	push   %edi
+ 56c:	ff 75 08             	push   0x8(%ebp)
+ 56f:	e8 d0 fc ff ff       	call   244 <write>
+        putc(fd, c);
+ 574:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 577:	bf 00 00 00 00       	mov    $0x0,%edi
+ 57c:	e9 90 fe ff ff       	jmp    411 <printf+0x45>
+    }
+  }
+}
+ 581:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 584:	5b                   	pop    %ebx
+ 585:	5e                   	pop    %esi
+ 586:	5f                   	pop    %edi
+ 587:	5d                   	pop    %ebp
+ 588:	c3                   	ret
+
+00000589 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 589:	55                   	push   %ebp
+ 58a:	89 e5                	mov    %esp,%ebp
+ 58c:	57                   	push   %edi
+ 58d:	56                   	push   %esi
+ 58e:	53                   	push   %ebx
+ 58f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 592:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 595:	a1 b8 09 00 00       	mov    0x9b8,%eax
+ 59a:	eb 0c                	jmp    5a8 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 59c:	8b 10                	mov    (%eax),%edx
+ 59e:	39 d0                	cmp    %edx,%eax
+ 5a0:	72 04                	jb     5a6 <free+0x1d>
+ 5a2:	39 d1                	cmp    %edx,%ecx
+ 5a4:	72 10                	jb     5b6 <free+0x2d>
+{
+ 5a6:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5a8:	39 c8                	cmp    %ecx,%eax
+ 5aa:	73 f0                	jae    59c <free+0x13>
+ 5ac:	8b 10                	mov    (%eax),%edx
+ 5ae:	39 d1                	cmp    %edx,%ecx
+ 5b0:	72 04                	jb     5b6 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5b2:	39 d0                	cmp    %edx,%eax
+ 5b4:	72 f0                	jb     5a6 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5b6:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5b9:	8b 10                	mov    (%eax),%edx
+ 5bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5be:	39 fa                	cmp    %edi,%edx
+ 5c0:	74 19                	je     5db <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5c2:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 5c5:	8b 50 04             	mov    0x4(%eax),%edx
+ 5c8:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5cb:	39 f1                	cmp    %esi,%ecx
+ 5cd:	74 18                	je     5e7 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 5cf:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 5d1:	a3 b8 09 00 00       	mov    %eax,0x9b8
+}
+ 5d6:	5b                   	pop    %ebx
+ 5d7:	5e                   	pop    %esi
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5db:	03 72 04             	add    0x4(%edx),%esi
+ 5de:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5e1:	8b 10                	mov    (%eax),%edx
+ 5e3:	8b 12                	mov    (%edx),%edx
+ 5e5:	eb db                	jmp    5c2 <free+0x39>
+    p->s.size += bp->s.size;
+ 5e7:	03 53 fc             	add    -0x4(%ebx),%edx
+ 5ea:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 5ed:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 5f0:	eb dd                	jmp    5cf <free+0x46>
+
+000005f2 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 5f2:	55                   	push   %ebp
+ 5f3:	89 e5                	mov    %esp,%ebp
+ 5f5:	57                   	push   %edi
+ 5f6:	56                   	push   %esi
+ 5f7:	53                   	push   %ebx
+ 5f8:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fe:	8d 58 07             	lea    0x7(%eax),%ebx
+ 601:	c1 eb 03             	shr    $0x3,%ebx
+ 604:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 607:	8b 15 b8 09 00 00    	mov    0x9b8,%edx
+ 60d:	85 d2                	test   %edx,%edx
+ 60f:	74 1c                	je     62d <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 611:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 613:	8b 48 04             	mov    0x4(%eax),%ecx
+ 616:	39 d9                	cmp    %ebx,%ecx
+ 618:	73 38                	jae    652 <malloc+0x60>
+  if(nu < 4096)
+ 61a:	be 00 10 00 00       	mov    $0x1000,%esi
+ 61f:	39 f3                	cmp    %esi,%ebx
+ 621:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 624:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 62b:	eb 72                	jmp    69f <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 62d:	c7 05 b8 09 00 00 bc 	movl   $0x9bc,0x9b8
+ 634:	09 00 00 
+ 637:	c7 05 bc 09 00 00 bc 	movl   $0x9bc,0x9bc
+ 63e:	09 00 00 
+    base.s.size = 0;
+ 641:	c7 05 c0 09 00 00 00 	movl   $0x0,0x9c0
+ 648:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 64b:	b8 bc 09 00 00       	mov    $0x9bc,%eax
+    if(p->s.size >= nunits){
+ 650:	eb c8                	jmp    61a <malloc+0x28>
+      if(p->s.size == nunits)
+ 652:	39 cb                	cmp    %ecx,%ebx
+ 654:	74 1e                	je     674 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 656:	29 d9                	sub    %ebx,%ecx
+ 658:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 65b:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 65e:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 661:	89 15 b8 09 00 00    	mov    %edx,0x9b8
+      return (void*)(p + 1);
+ 667:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 66a:	89 d0                	mov    %edx,%eax
+ 66c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 66f:	5b                   	pop    %ebx
+ 670:	5e                   	pop    %esi
+ 671:	5f                   	pop    %edi
+ 672:	5d                   	pop    %ebp
+ 673:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 674:	8b 08                	mov    (%eax),%ecx
+ 676:	89 0a                	mov    %ecx,(%edx)
+ 678:	eb e7                	jmp    661 <malloc+0x6f>
+  hp->s.size = nu;
+ 67a:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 67d:	83 ec 0c             	sub    $0xc,%esp
+ 680:	83 c0 08             	add    $0x8,%eax
+ 683:	50                   	push   %eax
+ 684:	e8 00 ff ff ff       	call   589 <free>
+  return freep;
+ 689:	8b 15 b8 09 00 00    	mov    0x9b8,%edx
+      if((p = morecore(nunits)) == 0)
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	85 d2                	test   %edx,%edx
+ 694:	74 d4                	je     66a <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 696:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 698:	8b 48 04             	mov    0x4(%eax),%ecx
+ 69b:	39 d9                	cmp    %ebx,%ecx
+ 69d:	73 b3                	jae    652 <malloc+0x60>
+    if(p == freep)
+ 69f:	89 c2                	mov    %eax,%edx
+ 6a1:	39 05 b8 09 00 00    	cmp    %eax,0x9b8
+ 6a7:	75 ed                	jne    696 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 6a9:	83 ec 0c             	sub    $0xc,%esp
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 fa fb ff ff       	call   2ac <sbrk>
+  if(p == (char*)-1)
+ 6b2:	83 c4 10             	add    $0x10,%esp
+ 6b5:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6b8:	75 c0                	jne    67a <malloc+0x88>
+        return 0;
+ 6ba:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6bf:	eb a9                	jmp    66a <malloc+0x78>
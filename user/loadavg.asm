@@ -0,0 +1,1173 @@
+
+_loadavg:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <put>:
+#include "kernel/stat.h"
+#include "user.h"
+
+static void
+put(int v)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 18             	sub    $0x18,%esp
+   9:	89 c1                	mov    %eax,%ecx
+  printf(1, " %d.%d%d", v / 100, v / 10 % 10, v % 10);
+   b:	bf 67 66 66 66       	mov    $0x66666667,%edi
+  10:	f7 ef                	imul   %edi
+  12:	c1 fa 02             	sar    $0x2,%edx
+  15:	89 cb                	mov    %ecx,%ebx
+  17:	c1 fb 1f             	sar    $0x1f,%ebx
+  1a:	89 d6                	mov    %edx,%esi
+  1c:	29 de                	sub    %ebx,%esi
+  1e:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+  21:	01 c0                	add    %eax,%eax
+  23:	89 ca                	mov    %ecx,%edx
+  25:	29 c2                	sub    %eax,%edx
+  27:	52                   	push   %edx
+  28:	89 f0                	mov    %esi,%eax
+  2a:	f7 ef                	imul   %edi
+  2c:	c1 fa 02             	sar    $0x2,%edx
+  2f:	89 f0                	mov    %esi,%eax
+  31:	c1 f8 1f             	sar    $0x1f,%eax
+  34:	29 c2                	sub    %eax,%edx
+  36:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  39:	01 c0                	add    %eax,%eax
+  3b:	29 c6                	sub    %eax,%esi
+  3d:	56                   	push   %esi
+  3e:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  43:	89 c8                	mov    %ecx,%eax
+  45:	f7 ea                	imul   %edx
+  47:	c1 fa 05             	sar    $0x5,%edx
+  4a:	29 da                	sub    %ebx,%edx
+  4c:	52                   	push   %edx
+  4d:	68 3c 07 00 00       	push   $0x73c
+  52:	6a 01                	push   $0x1
+  54:	e8 eb 03 00 00       	call   444 <printf>
+}
+  59:	83 c4 20             	add    $0x20,%esp
+  5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  5f:	5b                   	pop    %ebx
+  60:	5e                   	pop    %esi
+  61:	5f                   	pop    %edi
+  62:	5d                   	pop    %ebp
+  63:	c3                   	ret
+
+00000064 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  64:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  68:	83 e4 f0             	and    $0xfffffff0,%esp
+  6b:	ff 71 fc             	push   -0x4(%ecx)
+  6e:	55                   	push   %ebp
+  6f:	89 e5                	mov    %esp,%ebp
+  71:	51                   	push   %ecx
+  72:	83 ec 20             	sub    $0x20,%esp
+  int avg[3];
+
+  if(getloadavg(avg) < 0){
+  75:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  78:	50                   	push   %eax
+  79:	e8 16 03 00 00       	call   394 <getloadavg>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	85 c0                	test   %eax,%eax
+  83:	78 3b                	js     c0 <main+0x5c>
+    printf(2, "loadavg: getloadavg failed\n");
+    exit();
+  }
+  printf(1, "load average:");
+  85:	83 ec 08             	sub    $0x8,%esp
+  88:	68 61 07 00 00       	push   $0x761
+  8d:	6a 01                	push   $0x1
+  8f:	e8 b0 03 00 00       	call   444 <printf>
+  put(avg[0]);
+  94:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  97:	e8 64 ff ff ff       	call   0 <put>
+  put(avg[1]);
+  9c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  9f:	e8 5c ff ff ff       	call   0 <put>
+  put(avg[2]);
+  a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  a7:	e8 54 ff ff ff       	call   0 <put>
+  printf(1, "\n");
+  ac:	83 c4 08             	add    $0x8,%esp
+  af:	68 5f 07 00 00       	push   $0x75f
+  b4:	6a 01                	push   $0x1
+  b6:	e8 89 03 00 00       	call   444 <printf>
+  exit();
+  bb:	e8 dc 01 00 00       	call   29c <exit>
+    printf(2, "loadavg: getloadavg failed\n");
+  c0:	83 ec 08             	sub    $0x8,%esp
+  c3:	68 45 07 00 00       	push   $0x745
+  c8:	6a 02                	push   $0x2
+  ca:	e8 75 03 00 00       	call   444 <printf>
+    exit();
+  cf:	e8 c8 01 00 00       	call   29c <exit>
+
+000000d4 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  d4:	55                   	push   %ebp
+  d5:	89 e5                	mov    %esp,%ebp
+  d7:	53                   	push   %ebx
+  d8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  de:	b8 00 00 00 00       	mov    $0x0,%eax
+  e3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  e7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  ea:	83 c0 01             	add    $0x1,%eax
+  ed:	84 d2                	test   %dl,%dl
+  ef:	75 f2                	jne    e3 <strcpy+0xf>
+    ;
+  return os;
+}
+  f1:	89 c8                	mov    %ecx,%eax
+  f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  f6:	c9                   	leave
+  f7:	c3                   	ret
+
+000000f8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 101:	0f b6 01             	movzbl (%ecx),%eax
+ 104:	84 c0                	test   %al,%al
+ 106:	74 11                	je     119 <strcmp+0x21>
+ 108:	38 02                	cmp    %al,(%edx)
+ 10a:	75 0d                	jne    119 <strcmp+0x21>
+    p++, q++;
+ 10c:	83 c1 01             	add    $0x1,%ecx
+ 10f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 112:	0f b6 01             	movzbl (%ecx),%eax
+ 115:	84 c0                	test   %al,%al
+ 117:	75 ef                	jne    108 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 119:	0f b6 c0             	movzbl %al,%eax
+ 11c:	0f b6 12             	movzbl (%edx),%edx
+ 11f:	29 d0                	sub    %edx,%eax
+}
+ 121:	5d                   	pop    %ebp
+ 122:	c3                   	ret
+
+00000123 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 123:	55                   	push   %ebp
+ 124:	89 e5                	mov    %esp,%ebp
+ 126:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 129:	80 3a 00             	cmpb   $0x0,(%edx)
+ 12c:	74 14                	je     142 <strlen+0x1f>
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 133:	83 c0 01             	add    $0x1,%eax
+ 136:	89 c1                	mov    %eax,%ecx
+ 138:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 13c:	75 f5                	jne    133 <strlen+0x10>
+    ;
+  return n;
+}
+ 13e:	89 c8                	mov    %ecx,%eax
+ 140:	5d                   	pop    %ebp
+ 141:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 142:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 147:	eb f5                	jmp    13e <strlen+0x1b>
+
+00000149 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 149:	55                   	push   %ebp
+ 14a:	89 e5                	mov    %esp,%ebp
+ 14c:	57                   	push   %edi
+ 14d:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 150:	89 d7                	mov    %edx,%edi
+ 152:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 155:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 158:	fc                   	cld
+ 159:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 15b:	89 d0                	mov    %edx,%eax
+ 15d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 160:	c9                   	leave
+ 161:	c3                   	ret
+
+00000162 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 162:	55                   	push   %ebp
+ 163:	89 e5                	mov    %esp,%ebp
+ 165:	8b 45 08             	mov    0x8(%ebp),%eax
+ 168:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16c:	0f b6 10             	movzbl (%eax),%edx
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 15                	je     188 <strchr+0x26>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	74 0f                	je     186 <strchr+0x24>
+  for(; *s; s++)
+ 177:	83 c0 01             	add    $0x1,%eax
+ 17a:	0f b6 10             	movzbl (%eax),%edx
+ 17d:	84 d2                	test   %dl,%dl
+ 17f:	75 f2                	jne    173 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 186:	5d                   	pop    %ebp
+ 187:	c3                   	ret
+  return 0;
+ 188:	b8 00 00 00 00       	mov    $0x0,%eax
+ 18d:	eb f7                	jmp    186 <strchr+0x24>
+
+0000018f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 18f:	55                   	push   %ebp
+ 190:	89 e5                	mov    %esp,%ebp
+ 192:	57                   	push   %edi
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	83 ec 2c             	sub    $0x2c,%esp
+ 198:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 19b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1a0:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1a3:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1a6:	83 c3 01             	add    $0x1,%ebx
+ 1a9:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ac:	7d 27                	jge    1d5 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1ae:	83 ec 04             	sub    $0x4,%esp
+ 1b1:	6a 01                	push   $0x1
+ 1b3:	57                   	push   %edi
+ 1b4:	6a 00                	push   $0x0
+ 1b6:	e8 f9 00 00 00       	call   2b4 <read>
+    if(cc < 1)
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	7e 13                	jle    1d5 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1c2:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c6:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ca:	3c 0a                	cmp    $0xa,%al
+ 1cc:	74 04                	je     1d2 <gets+0x43>
+ 1ce:	3c 0d                	cmp    $0xd,%al
+ 1d0:	75 d1                	jne    1a3 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1d2:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 1d5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1d8:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1dc:	89 f0                	mov    %esi,%eax
+ 1de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1e1:	5b                   	pop    %ebx
+ 1e2:	5e                   	pop    %esi
+ 1e3:	5f                   	pop    %edi
+ 1e4:	5d                   	pop    %ebp
+ 1e5:	c3                   	ret
+
+000001e6 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1e6:	55                   	push   %ebp
+ 1e7:	89 e5                	mov    %esp,%ebp
+ 1e9:	56                   	push   %esi
+ 1ea:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1eb:	83 ec 08             	sub    $0x8,%esp
+ 1ee:	6a 00                	push   $0x0
+ 1f0:	ff 75 08             	push   0x8(%ebp)
+ 1f3:	e8 e4 00 00 00       	call   2dc <open>
+  if(fd < 0)
+ 1f8:	83 c4 10             	add    $0x10,%esp
+ 1fb:	85 c0                	test   %eax,%eax
+ 1fd:	78 24                	js     223 <stat+0x3d>
+ 1ff:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 201:	83 ec 08             	sub    $0x8,%esp
+ 204:	ff 75 0c             	push   0xc(%ebp)
+ 207:	50                   	push   %eax
+ 208:	e8 e7 00 00 00       	call   2f4 <fstat>
+ 20d:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20f:	89 1c 24             	mov    %ebx,(%esp)
+ 212:	e8 ad 00 00 00       	call   2c4 <close>
+  return r;
+ 217:	83 c4 10             	add    $0x10,%esp
+}
+ 21a:	89 f0                	mov    %esi,%eax
+ 21c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 21f:	5b                   	pop    %ebx
+ 220:	5e                   	pop    %esi
+ 221:	5d                   	pop    %ebp
+ 222:	c3                   	ret
+    return -1;
+ 223:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 228:	eb f0                	jmp    21a <stat+0x34>
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	53                   	push   %ebx
+ 22e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 231:	0f b6 02             	movzbl (%edx),%eax
+ 234:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 237:	80 f9 09             	cmp    $0x9,%cl
+ 23a:	77 24                	ja     260 <atoi+0x36>
+  n = 0;
+ 23c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 241:	83 c2 01             	add    $0x1,%edx
+ 244:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 247:	0f be c0             	movsbl %al,%eax
+ 24a:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 24e:	0f b6 02             	movzbl (%edx),%eax
+ 251:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 254:	80 fb 09             	cmp    $0x9,%bl
+ 257:	76 e8                	jbe    241 <atoi+0x17>
+  return n;
+}
+ 259:	89 c8                	mov    %ecx,%eax
+ 25b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 25e:	c9                   	leave
+ 25f:	c3                   	ret
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 265:	eb f2                	jmp    259 <atoi+0x2f>
+
+00000267 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 267:	55                   	push   %ebp
+ 268:	89 e5                	mov    %esp,%ebp
+ 26a:	56                   	push   %esi
+ 26b:	53                   	push   %ebx
+ 26c:	8b 75 08             	mov    0x8(%ebp),%esi
+ 26f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 272:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 275:	85 db                	test   %ebx,%ebx
+ 277:	7e 15                	jle    28e <memmove+0x27>
+ 279:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 27b:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 27d:	83 c2 01             	add    $0x1,%edx
+ 280:	83 c0 01             	add    $0x1,%eax
+ 283:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 287:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 28a:	39 c3                	cmp    %eax,%ebx
+ 28c:	75 ef                	jne    27d <memmove+0x16>
+  return vdst;
+}
+ 28e:	89 f0                	mov    %esi,%eax
+ 290:	5b                   	pop    %ebx
+ 291:	5e                   	pop    %esi
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+
+00000294 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 294:	b8 01 00 00 00       	mov    $0x1,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <exit>:
+SYSCALL(exit)
+ 29c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <wait>:
+SYSCALL(wait)
+ 2a4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <pipe>:
+SYSCALL(pipe)
+ 2ac:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <read>:
+SYSCALL(read)
+ 2b4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <write>:
+SYSCALL(write)
+ 2bc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <close>:
+SYSCALL(close)
+ 2c4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <kill>:
+SYSCALL(kill)
+ 2cc:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <exec>:
+SYSCALL(exec)
+ 2d4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <open>:
+SYSCALL(open)
+ 2dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <mknod>:
+SYSCALL(mknod)
+ 2e4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <unlink>:
+SYSCALL(unlink)
+ 2ec:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <fstat>:
+SYSCALL(fstat)
+ 2f4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <link>:
+SYSCALL(link)
+ 2fc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <mkdir>:
+SYSCALL(mkdir)
+ 304:	b8 14 00 00 00       	mov    $0x14,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <chdir>:
+SYSCALL(chdir)
+ 30c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <dup>:
+SYSCALL(dup)
+ 314:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <getpid>:
+SYSCALL(getpid)
+ 31c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <sbrk>:
+SYSCALL(sbrk)
+ 324:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <sleep>:
+SYSCALL(sleep)
+ 32c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <uptime>:
+SYSCALL(uptime)
+ 334:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <readmouse>:
+SYSCALL(readmouse)
+ 33c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <sigsend>:
+SYSCALL(sigsend)
+ 344:	b8 17 00 00 00       	mov    $0x17,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <sigsethandler>:
+SYSCALL(sigsethandler)
+ 34c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <sigreturn>:
+SYSCALL(sigreturn)
+ 354:	b8 19 00 00 00       	mov    $0x19,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <siggetmask>:
+SYSCALL(siggetmask)
+ 35c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 364:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <sigpause>:
+SYSCALL(sigpause)
+ 36c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 374:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 379:	cd 40                	int    $0x40
+ 37b:	c3                   	ret
+
+0000037c <sleeptick>:
+SYSCALL(sleeptick)
+ 37c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 381:	cd 40                	int    $0x40
+ 383:	c3                   	ret
+
+00000384 <schedctl>:
+SYSCALL(schedctl)
+ 384:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 389:	cd 40                	int    $0x40
+ 38b:	c3                   	ret
+
+0000038c <nswtch>:
+SYSCALL(nswtch)
+ 38c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 391:	cd 40                	int    $0x40
+ 393:	c3                   	ret
+
+00000394 <getloadavg>:
+SYSCALL(getloadavg)
+ 394:	b8 21 00 00 00       	mov    $0x21,%eax
+ 399:	cd 40                	int    $0x40
+ 39b:	c3                   	ret
+
+0000039c <memstat>:
+SYSCALL(memstat)
+ 39c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <iostat>:
+SYSCALL(iostat)
+ 3a4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3ac:	55                   	push   %ebp
+ 3ad:	89 e5                	mov    %esp,%ebp
+ 3af:	57                   	push   %edi
+ 3b0:	56                   	push   %esi
+ 3b1:	53                   	push   %ebx
+ 3b2:	83 ec 3c             	sub    $0x3c,%esp
+ 3b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3b8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3ba:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3be:	74 79                	je     439 <printint+0x8d>
+ 3c0:	85 d2                	test   %edx,%edx
+ 3c2:	79 75                	jns    439 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 3c4:	89 d1                	mov    %edx,%ecx
+ 3c6:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3c8:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3d4:	89 df                	mov    %ebx,%edi
+ 3d6:	83 c3 01             	add    $0x1,%ebx
+ 3d9:	89 c8                	mov    %ecx,%eax
+ 3db:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3e0:	f7 f6                	div    %esi
+ 3e2:	0f b6 92 d0 07 00 00 	movzbl 0x7d0(%edx),%edx
+ 3e9:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 3ed:	89 ca                	mov    %ecx,%edx
+ 3ef:	89 c1                	mov    %eax,%ecx
+ 3f1:	39 f2                	cmp    %esi,%edx
+ 3f3:	73 df                	jae    3d4 <printint+0x28>
+  if(neg)
+ 3f5:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 3f9:	74 08                	je     403 <printint+0x57>
+    buf[i++] = '-';
+ 3fb:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 400:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 403:	85 db                	test   %ebx,%ebx
+ 405:	7e 2a                	jle    431 <printint+0x85>
+ 407:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 40a:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 40e:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 411:	0f b6 03             	movzbl (%ebx),%eax
+ 414:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 417:	83 ec 04             	sub    $0x4,%esp
+ 41a:	6a 01                	push   $0x1
+ 41c:	57                   	push   %edi
+ 41d:	ff 75 c4             	push   -0x3c(%ebp)
+ 420:	e8 97 fe ff ff       	call   2bc <write>
+  while(--i >= 0)
+ 425:	89 d8                	mov    %ebx,%eax
+ 427:	83 eb 01             	sub    $0x1,%ebx
+ 42a:	83 c4 10             	add    $0x10,%esp
+ 42d:	39 f0                	cmp    %esi,%eax
+ 42f:	75 e0                	jne    411 <printint+0x65>
+}
+ 431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 434:	5b                   	pop    %ebx
+ 435:	5e                   	pop    %esi
+ 436:	5f                   	pop    %edi
+ 437:	5d                   	pop    %ebp
+ 438:	c3                   	ret
+    x = xx;
+ 439:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 43b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 442:	eb 8b                	jmp    3cf <printint+0x23>
+
+00000444 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 444:	55                   	push   %ebp
+ 445:	89 e5                	mov    %esp,%ebp
+ 447:	57                   	push   %edi
+ 448:	56                   	push   %esi
+ 449:	53                   	push   %ebx
+ 44a:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 44d:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 450:	0f b6 1e             	movzbl (%esi),%ebx
+ 453:	84 db                	test   %bl,%bl
+ 455:	0f 84 9e 01 00 00    	je     5f9 <printf+0x1b5>
+ 45b:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 45e:	8d 45 10             	lea    0x10(%ebp),%eax
+ 461:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 464:	bf 00 00 00 00       	mov    $0x0,%edi
+ 469:	eb 2d                	jmp    498 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 46b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 46e:	83 ec 04             	sub    $0x4,%esp
+ 471:	6a 01                	push   $0x1
+ 473:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 476:	50                   	push   %eax
+ 477:	ff 75 08             	push   0x8(%ebp)
+ 47a:	e8 3d fe ff ff       	call   2bc <write>
+        putc(fd, c);
+ 47f:	83 c4 10             	add    $0x10,%esp
+ 482:	eb 05                	jmp    489 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 484:	83 ff 25             	cmp    $0x25,%edi
+ 487:	74 1f                	je     4a8 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 489:	83 c6 01             	add    $0x1,%esi
+ 48c:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 490:	84 db                	test   %bl,%bl
+ 492:	0f 84 61 01 00 00    	je     5f9 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 498:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 49b:	85 ff                	test   %edi,%edi
+ 49d:	75 e5                	jne    484 <printf+0x40>
+      if(c == '%'){
+ 49f:	83 f8 25             	cmp    $0x25,%eax
+ 4a2:	75 c7                	jne    46b <printf+0x27>
+        state = '%';
+ 4a4:	89 c7                	mov    %eax,%edi
+ 4a6:	eb e1                	jmp    489 <printf+0x45>
+      if(c == 'd'){
+ 4a8:	83 f8 25             	cmp    $0x25,%eax
+ 4ab:	0f 84 f4 00 00 00    	je     5a5 <printf+0x161>
+ 4b1:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4b4:	83 fa 15             	cmp    $0x15,%edx
+ 4b7:	0f 87 09 01 00 00    	ja     5c6 <printf+0x182>
+ 4bd:	0f 87 03 01 00 00    	ja     5c6 <printf+0x182>
+ 4c3:	ff 24 95 78 07 00 00 	jmp    *0x778(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 4ca:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4cd:	8b 17                	mov    (%edi),%edx
+ 4cf:	83 ec 0c             	sub    $0xc,%esp
+ 4d2:	6a 01                	push   $0x1
+ 4d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4dc:	e8 cb fe ff ff       	call   3ac <printint>
+        ap++;
+ 4e1:	83 c7 04             	add    $0x4,%edi
+ 4e4:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4e7:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4ea:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4ef:	eb 98                	jmp    489 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 4f1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4f4:	8b 17                	mov    (%edi),%edx
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+ 4f9:	6a 00                	push   $0x0
+ 4fb:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 500:	8b 45 08             	mov    0x8(%ebp),%eax
+ 503:	e8 a4 fe ff ff       	call   3ac <printint>
+        ap++;
+ 508:	83 c7 04             	add    $0x4,%edi
+ 50b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 50e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 511:	bf 00 00 00 00       	mov    $0x0,%edi
+ 516:	e9 6e ff ff ff       	jmp    489 <printf+0x45>
+        s = (char*)*ap;
+ 51b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 51e:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 520:	83 c1 04             	add    $0x4,%ecx
+ 523:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 526:	85 c0                	test   %eax,%eax
+ 528:	74 13                	je     53d <printf+0xf9>
+        s = (char*)*ap;
+ 52a:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 52c:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 52f:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 534:	84 c0                	test   %al,%al
+ 536:	75 0f                	jne    547 <printf+0x103>
+ 538:	e9 4c ff ff ff       	jmp    489 <printf+0x45>
+          s = "(null)";
+ 53d:	bb 6f 07 00 00       	mov    $0x76f,%ebx
+        while(*s != 0){
+ 542:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 547:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 54a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 54d:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 550:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 553:	83 ec 04             	sub    $0x4,%esp
+ 556:	6a 01                	push   $0x1
+ 558:	57                   	push   %edi
+ 559:	56                   	push   %esi
+ 55a:	e8 5d fd ff ff       	call   2bc <write>
+          s++;
+ 55f:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 562:	0f b6 03             	movzbl (%ebx),%eax
+ 565:	83 c4 10             	add    $0x10,%esp
+ 568:	84 c0                	test   %al,%al
+ 56a:	75 e4                	jne    550 <printf+0x10c>
+      state = 0;
+ 56c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 56f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 574:	e9 10 ff ff ff       	jmp    489 <printf+0x45>
+        putc(fd, *ap);
+ 579:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 57c:	8b 07                	mov    (%edi),%eax
+ 57e:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 581:	83 ec 04             	sub    $0x4,%esp
+ 584:	6a 01                	push   $0x1
+ 586:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 589:	50                   	push   %eax
+ 58a:	ff 75 08             	push   0x8(%ebp)
+ 58d:	e8 2a fd ff ff       	call   2bc <write>
+        ap++;
+ 592:	83 c7 04             	add    $0x4,%edi
+ 595:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 598:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 59b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5a0:	e9 e4 fe ff ff       	jmp    489 <printf+0x45>
+        putc(fd, c);
+ 5a5:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a8:	83 ec 04             	sub    $0x4,%esp
+ 5ab:	6a 01                	push   $0x1
+ 5ad:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5b0:	50                   	push   %eax
+ 5b1:	ff 75 08             	push   0x8(%ebp)
+ 5b4:	e8 03 fd ff ff       	call   2bc <write>
+ 5b9:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5bc:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5c1:	e9 c3 fe ff ff       	jmp    489 <printf+0x45>
+        putc(fd, '%');
+ 5c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ca:	83 ec 04             	sub    $0x4,%esp
+ 5cd:	6a 01                	push   $0x1
+ 5cf:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5d2:	57                   	push   %edi
+ 5d3:	ff 75 08             	push   0x8(%ebp)
+ 5d6:	e8 e1 fc ff ff       	call   2bc <write>
+        putc(fd, c);
+ 5db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5de:	83 c4 0c             	add    $0xc,%esp
+ 5e1:	6a 01                	push   $0x1
+ 5e3:	57                   	push   %edi
+ 5e4:	ff 75 08             	push   0x8(%ebp)
+ 5e7:	e8 d0 fc ff ff       	call   2bc <write>
+        putc(fd, c);
+ 5ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ef:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5f4:	e9 90 fe ff ff       	jmp    489 <printf+0x45>
+    }
+  }
+}
+ 5f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fc:	5b                   	pop    %ebx
+ 5fd:	5e                   	pop    %esi
+ 5fe:	5f                   	pop    %edi
+ 5ff:	5d                   	pop    %ebp
+ 600:	c3                   	ret
+
+00000601 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 601:	55                   	push   %ebp
+ 602:	89 e5                	mov    %esp,%ebp
+ 604:	57                   	push   %edi
+ 605:	56                   	push   %esi
+ 606:	53                   	push   %ebx
+ 607:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 60a:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 60d:	a1 64 0a 00 00       	mov    0xa64,%eax
+ 612:	eb 0c                	jmp    620 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 614:	8b 10                	mov    (%eax),%edx
+ 616:	39 d0                	cmp    %edx,%eax
+ 618:	72 04                	jb     61e <free+0x1d>
+ 61a:	39 d1                	cmp    %edx,%ecx
+ 61c:	72 10                	jb     62e <free+0x2d>
+{
+ 61e:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 620:	39 c8                	cmp    %ecx,%eax
+ 622:	73 f0                	jae    614 <free+0x13>
+ 624:	8b 10                	mov    (%eax),%edx
+ 626:	39 d1                	cmp    %edx,%ecx
+ 628:	72 04                	jb     62e <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 62a:	39 d0                	cmp    %edx,%eax
+ 62c:	72 f0                	jb     61e <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 62e:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 631:	8b 10                	mov    (%eax),%edx
+ 633:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 636:	39 fa                	cmp    %edi,%edx
+ 638:	74 19                	je     653 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 63a:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 63d:	8b 50 04             	mov    0x4(%eax),%edx
+ 640:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 643:	39 f1                	cmp    %esi,%ecx
+ 645:	74 18                	je     65f <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 647:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 649:	a3 64 0a 00 00       	mov    %eax,0xa64
+}
+ 64e:	5b                   	pop    %ebx
+ 64f:	5e                   	pop    %esi
+ 650:	5f                   	pop    %edi
+ 651:	5d                   	pop    %ebp
+ 652:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 653:	03 72 04             	add    0x4(%edx),%esi
+ 656:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 659:	8b 10                	mov    (%eax),%edx
+ 65b:	8b 12                	mov    (%edx),%edx
+ 65d:	eb db                	jmp    63a <free+0x39>
+    p->s.size += bp->s.size;
+ 65f:	03 53 fc             	add    -0x4(%ebx),%edx
+ 662:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 665:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 668:	eb dd                	jmp    647 <free+0x46>
+
+0000066a <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 66a:	55                   	push   %ebp
+ 66b:	89 e5                	mov    %esp,%ebp
+ 66d:	57                   	push   %edi
+ 66e:	56                   	push   %esi
+ 66f:	53                   	push   %ebx
+ 670:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 673:	8b 45 08             	mov    0x8(%ebp),%eax
+ 676:	8d 58 07             	lea    0x7(%eax),%ebx
+ 679:	c1 eb 03             	shr    $0x3,%ebx
+ 67c:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 67f:	8b 15 64 0a 00 00    	mov    0xa64,%edx
+ 685:	85 d2                	test   %edx,%edx
+ 687:	74 1c                	je     6a5 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 689:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 68b:	8b 48 04             	mov    0x4(%eax),%ecx
+ 68e:	39 d9                	cmp    %ebx,%ecx
+ 690:	73 38                	jae    6ca <malloc+0x60>
+  if(nu < 4096)
+ 692:	be 00 10 00 00       	mov    $0x1000,%esi
+ 697:	39 f3                	cmp    %esi,%ebx
+ 699:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 69c:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6a3:	eb 72                	jmp    717 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6a5:	c7 05 64 0a 00 00 68 	movl   $0xa68,0xa64
+ 6ac:	0a 00 00 
+ 6af:	c7 05 68 0a 00 00 68 	movl   $0xa68,0xa68
+ 6b6:	0a 00 00 
+    base.s.size = 0;
+ 6b9:	c7 05 6c 0a 00 00 00 	movl   $0x0,0xa6c
+ 6c0:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6c3:	b8 68 0a 00 00       	mov    $0xa68,%eax
+    if(p->s.size >= nunits){
+ 6c8:	eb c8                	jmp    692 <malloc+0x28>
+      if(p->s.size == nunits)
+ 6ca:	39 cb                	cmp    %ecx,%ebx
+ 6cc:	74 1e                	je     6ec <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6ce:	29 d9                	sub    %ebx,%ecx
+ 6d0:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 6d3:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 6d6:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6d9:	89 15 64 0a 00 00    	mov    %edx,0xa64
+      return (void*)(p + 1);
+ 6df:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6e2:	89 d0                	mov    %edx,%eax
+ 6e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e7:	5b                   	pop    %ebx
+ 6e8:	5e                   	pop    %esi
+ 6e9:	5f                   	pop    %edi
+ 6ea:	5d                   	pop    %ebp
+ 6eb:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6ec:	8b 08                	mov    (%eax),%ecx
+ 6ee:	89 0a                	mov    %ecx,(%edx)
+ 6f0:	eb e7                	jmp    6d9 <malloc+0x6f>
+  hp->s.size = nu;
+ 6f2:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 6f5:	83 ec 0c             	sub    $0xc,%esp
+ 6f8:	83 c0 08             	add    $0x8,%eax
+ 6fb:	50                   	push   %eax
+ 6fc:	e8 00 ff ff ff       	call   601 <free>
+  return freep;
+ 701:	8b 15 64 0a 00 00    	mov    0xa64,%edx
+      if((p = morecore(nunits)) == 0)
+ 707:	83 c4 10             	add    $0x10,%esp
+ 70a:	85 d2                	test   %edx,%edx
+ 70c:	74 d4                	je     6e2 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 70e:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 710:	8b 48 04             	mov    0x4(%eax),%ecx
+ 713:	39 d9                	cmp    %ebx,%ecx
+ 715:	73 b3                	jae    6ca <malloc+0x60>
+    if(p == freep)
+ 717:	89 c2                	mov    %eax,%edx
+ 719:	39 05 64 0a 00 00    	cmp    %eax,0xa64
+ 71f:	75 ed                	jne    70e <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 721:	83 ec 0c             	sub    $0xc,%esp
+ 724:	57                   	push   %edi
+ 725:	e8 fa fb ff ff       	call   324 <sbrk>
+  if(p == (char*)-1)
+ 72a:	83 c4 10             	add    $0x10,%esp
+ 72d:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 730:	75 c0                	jne    6f2 <malloc+0x88>
+        return 0;
+ 732:	ba 00 00 00 00       	mov    $0x0,%edx
+ 737:	eb a9                	jmp    6e2 <malloc+0x78>
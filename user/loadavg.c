@@ -0,0 +1,28 @@
+// Print the 1, 5 and 15 second load averages.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user.h"
+
+static void
+put(int v)
+{
+  printf(1, " %d.%d%d", v / 100, v / 10 % 10, v % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int avg[3];
+
+  if(getloadavg(avg) < 0){
+    printf(2, "loadavg: getloadavg failed\n");
+    exit();
+  }
+  printf(1, "load average:");
+  put(avg[0]);
+  put(avg[1]);
+  put(avg[2]);
+  printf(1, "\n");
+  exit();
+}
@@ -0,0 +1,1531 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "kernel/ufs.h"
+#include "user.h"
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	56                   	push   %esi
+   4:	53                   	push   %ebx
+   5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   8:	83 ec 0c             	sub    $0xc,%esp
+   b:	53                   	push   %ebx
+   c:	e8 c2 04 00 00       	call   4d3 <strlen>
+  11:	83 c4 10             	add    $0x10,%esp
+  14:	01 d8                	add    %ebx,%eax
+  16:	72 0c                	jb     24 <fmtname+0x24>
+  18:	80 38 2f             	cmpb   $0x2f,(%eax)
+  1b:	74 07                	je     24 <fmtname+0x24>
+  1d:	83 e8 01             	sub    $0x1,%eax
+  20:	39 d8                	cmp    %ebx,%eax
+  22:	73 f4                	jae    18 <fmtname+0x18>
+    ;
+  p++;
+  24:	8d 58 01             	lea    0x1(%eax),%ebx
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  27:	83 ec 0c             	sub    $0xc,%esp
+  2a:	53                   	push   %ebx
+  2b:	e8 a3 04 00 00       	call   4d3 <strlen>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	83 f8 0d             	cmp    $0xd,%eax
+  36:	76 09                	jbe    41 <fmtname+0x41>
+    return p;
+  memmove(buf, p, strlen(p));
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  return buf;
+}
+  38:	89 d8                	mov    %ebx,%eax
+  3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  3d:	5b                   	pop    %ebx
+  3e:	5e                   	pop    %esi
+  3f:	5d                   	pop    %ebp
+  40:	c3                   	ret
+  memmove(buf, p, strlen(p));
+  41:	83 ec 0c             	sub    $0xc,%esp
+  44:	53                   	push   %ebx
+  45:	e8 89 04 00 00       	call   4d3 <strlen>
+  4a:	83 c4 0c             	add    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	53                   	push   %ebx
+  4f:	68 88 0e 00 00       	push   $0xe88
+  54:	e8 be 05 00 00       	call   617 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  59:	89 1c 24             	mov    %ebx,(%esp)
+  5c:	e8 72 04 00 00       	call   4d3 <strlen>
+  61:	89 c6                	mov    %eax,%esi
+  63:	89 1c 24             	mov    %ebx,(%esp)
+  66:	e8 68 04 00 00       	call   4d3 <strlen>
+  6b:	83 c4 0c             	add    $0xc,%esp
+  6e:	ba 0e 00 00 00       	mov    $0xe,%edx
+  73:	29 f2                	sub    %esi,%edx
+  75:	52                   	push   %edx
+  76:	6a 20                	push   $0x20
+  78:	05 88 0e 00 00       	add    $0xe88,%eax
+  7d:	50                   	push   %eax
+  7e:	e8 76 04 00 00       	call   4f9 <memset>
+  return buf;
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	bb 88 0e 00 00       	mov    $0xe88,%ebx
+  8b:	eb ab                	jmp    38 <fmtname+0x38>
+
+0000008d <ls>:
+
+void
+ls(char *path)
+{
+  8d:	55                   	push   %ebp
+  8e:	89 e5                	mov    %esp,%ebp
+  90:	57                   	push   %edi
+  91:	56                   	push   %esi
+  92:	53                   	push   %ebx
+  93:	81 ec 64 02 00 00    	sub    $0x264,%esp
+  99:	8b 75 08             	mov    0x8(%ebp),%esi
+  int fd;
+  struct dirent de;
+  struct stat st;
+
+// printf(1, "opened\n");
+  if((fd = open(path, 0)) < 0){
+  9c:	6a 00                	push   $0x0
+  9e:	56                   	push   %esi
+  9f:	e8 e8 05 00 00       	call   68c <open>
+  a4:	83 c4 10             	add    $0x10,%esp
+  a7:	85 c0                	test   %eax,%eax
+  a9:	0f 88 b9 00 00 00    	js     168 <ls+0xdb>
+  af:	89 c7                	mov    %eax,%edi
+    printf(2, "ls: cannot open %s\n", path);
+    return;
+  }
+// printf(1, "fstated 1\n");
+  if(fstat(fd, &st) < 0){
+  b1:	83 ec 08             	sub    $0x8,%esp
+  b4:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+  ba:	50                   	push   %eax
+  bb:	57                   	push   %edi
+  bc:	e8 e3 05 00 00       	call   6a4 <fstat>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	85 c0                	test   %eax,%eax
+  c6:	0f 88 b4 00 00 00    	js     180 <ls+0xf3>
+    printf(2, "ls: cannot stat %s\n", path);
+    close(fd);
+    return;
+  }
+
+  switch(st.type){
+  cc:	0f b7 85 c4 fd ff ff 	movzwl -0x23c(%ebp),%eax
+  d3:	66 83 f8 01          	cmp    $0x1,%ax
+  d7:	0f 84 c3 00 00 00    	je     1a0 <ls+0x113>
+  dd:	66 83 f8 02          	cmp    $0x2,%ax
+  e1:	75 37                	jne    11a <ls+0x8d>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+  e3:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+  e9:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+  ef:	8b 9d cc fd ff ff    	mov    -0x234(%ebp),%ebx
+  f5:	83 ec 0c             	sub    $0xc,%esp
+  f8:	56                   	push   %esi
+  f9:	e8 02 ff ff ff       	call   0 <fmtname>
+  fe:	83 c4 08             	add    $0x8,%esp
+ 101:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 107:	53                   	push   %ebx
+ 108:	6a 02                	push   $0x2
+ 10a:	50                   	push   %eax
+ 10b:	68 14 0b 00 00       	push   $0xb14
+ 110:	6a 01                	push   $0x1
+ 112:	e8 dd 06 00 00       	call   7f4 <printf>
+    break;
+ 117:	83 c4 20             	add    $0x20,%esp
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+    }
+    break;
+  }
+  // Top part is for xv6, this is for Uv5
+  if(st.dev>1){
+ 11a:	83 bd c8 fd ff ff 01 	cmpl   $0x1,-0x238(%ebp)
+ 121:	0f 8e fa 02 00 00    	jle    421 <ls+0x394>
+    if((st.type&IFDIR)==IFDIR){
+ 127:	0f b7 9d c4 fd ff ff 	movzwl -0x23c(%ebp),%ebx
+ 12e:	f6 c7 40             	test   $0x40,%bh
+ 131:	0f 84 a6 02 00 00    	je     3dd <ls+0x350>
+      if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 137:	83 ec 0c             	sub    $0xc,%esp
+ 13a:	56                   	push   %esi
+ 13b:	e8 93 03 00 00       	call   4d3 <strlen>
+ 140:	83 c0 10             	add    $0x10,%eax
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 14b:	0f 86 8a 01 00 00    	jbe    2db <ls+0x24e>
+        printf(1, "ls: path too long\n");
+ 151:	83 ec 08             	sub    $0x8,%esp
+ 154:	68 21 0b 00 00       	push   $0xb21
+ 159:	6a 01                	push   $0x1
+ 15b:	e8 94 06 00 00       	call   7f4 <printf>
+ 160:	83 c4 10             	add    $0x10,%esp
+ 163:	e9 b9 02 00 00       	jmp    421 <ls+0x394>
+    printf(2, "ls: cannot open %s\n", path);
+ 168:	83 ec 04             	sub    $0x4,%esp
+ 16b:	56                   	push   %esi
+ 16c:	68 ec 0a 00 00       	push   $0xaec
+ 171:	6a 02                	push   $0x2
+ 173:	e8 7c 06 00 00       	call   7f4 <printf>
+    return;
+ 178:	83 c4 10             	add    $0x10,%esp
+ 17b:	e9 ad 02 00 00       	jmp    42d <ls+0x3a0>
+    printf(2, "ls: cannot stat %s\n", path);
+ 180:	83 ec 04             	sub    $0x4,%esp
+ 183:	56                   	push   %esi
+ 184:	68 00 0b 00 00       	push   $0xb00
+ 189:	6a 02                	push   $0x2
+ 18b:	e8 64 06 00 00       	call   7f4 <printf>
+    close(fd);
+ 190:	89 3c 24             	mov    %edi,(%esp)
+ 193:	e8 dc 04 00 00       	call   674 <close>
+    return;
+ 198:	83 c4 10             	add    $0x10,%esp
+ 19b:	e9 8d 02 00 00       	jmp    42d <ls+0x3a0>
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1a0:	83 ec 0c             	sub    $0xc,%esp
+ 1a3:	56                   	push   %esi
+ 1a4:	e8 2a 03 00 00       	call   4d3 <strlen>
+ 1a9:	83 c0 10             	add    $0x10,%eax
+ 1ac:	83 c4 10             	add    $0x10,%esp
+ 1af:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1b4:	76 17                	jbe    1cd <ls+0x140>
+      printf(1, "ls: path too long\n");
+ 1b6:	83 ec 08             	sub    $0x8,%esp
+ 1b9:	68 21 0b 00 00       	push   $0xb21
+ 1be:	6a 01                	push   $0x1
+ 1c0:	e8 2f 06 00 00       	call   7f4 <printf>
+      break;
+ 1c5:	83 c4 10             	add    $0x10,%esp
+ 1c8:	e9 4d ff ff ff       	jmp    11a <ls+0x8d>
+    strcpy(buf, path);
+ 1cd:	83 ec 08             	sub    $0x8,%esp
+ 1d0:	56                   	push   %esi
+ 1d1:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+ 1d7:	53                   	push   %ebx
+ 1d8:	e8 a7 02 00 00       	call   484 <strcpy>
+    p = buf+strlen(buf);
+ 1dd:	89 1c 24             	mov    %ebx,(%esp)
+ 1e0:	e8 ee 02 00 00       	call   4d3 <strlen>
+ 1e5:	01 d8                	add    %ebx,%eax
+ 1e7:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1ed:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	83 c4 10             	add    $0x10,%esp
+ 1fc:	8d 9d d8 fd ff ff    	lea    -0x228(%ebp),%ebx
+ 202:	eb 19                	jmp    21d <ls+0x190>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 204:	83 ec 04             	sub    $0x4,%esp
+ 207:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 20d:	50                   	push   %eax
+ 20e:	68 00 0b 00 00       	push   $0xb00
+ 213:	6a 01                	push   $0x1
+ 215:	e8 da 05 00 00       	call   7f4 <printf>
+        continue;
+ 21a:	83 c4 10             	add    $0x10,%esp
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 21d:	83 ec 04             	sub    $0x4,%esp
+ 220:	6a 10                	push   $0x10
+ 222:	53                   	push   %ebx
+ 223:	57                   	push   %edi
+ 224:	e8 3b 04 00 00       	call   664 <read>
+ 229:	83 c4 10             	add    $0x10,%esp
+ 22c:	83 f8 10             	cmp    $0x10,%eax
+ 22f:	0f 85 e5 fe ff ff    	jne    11a <ls+0x8d>
+      if(de.inum == 0)
+ 235:	66 83 bd d8 fd ff ff 	cmpw   $0x0,-0x228(%ebp)
+ 23c:	00 
+ 23d:	74 de                	je     21d <ls+0x190>
+      memmove(p, de.name, DIRSIZ);
+ 23f:	83 ec 04             	sub    $0x4,%esp
+ 242:	6a 0e                	push   $0xe
+ 244:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+ 24a:	50                   	push   %eax
+ 24b:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 251:	e8 c1 03 00 00       	call   617 <memmove>
+      p[DIRSIZ] = 0;
+ 256:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 25c:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){ // calls fstat
+ 260:	83 c4 08             	add    $0x8,%esp
+ 263:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 269:	50                   	push   %eax
+ 26a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 270:	50                   	push   %eax
+ 271:	e8 20 03 00 00       	call   596 <stat>
+ 276:	83 c4 10             	add    $0x10,%esp
+ 279:	85 c0                	test   %eax,%eax
+ 27b:	78 87                	js     204 <ls+0x177>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 27d:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 283:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 289:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+ 28f:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 295:	0f bf 8d c4 fd ff ff 	movswl -0x23c(%ebp),%ecx
+ 29c:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 2a2:	83 ec 0c             	sub    $0xc,%esp
+ 2a5:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 2ab:	50                   	push   %eax
+ 2ac:	e8 4f fd ff ff       	call   0 <fmtname>
+ 2b1:	83 c4 08             	add    $0x8,%esp
+ 2b4:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2ba:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+ 2c0:	ff b5 ac fd ff ff    	push   -0x254(%ebp)
+ 2c6:	50                   	push   %eax
+ 2c7:	68 14 0b 00 00       	push   $0xb14
+ 2cc:	6a 01                	push   $0x1
+ 2ce:	e8 21 05 00 00       	call   7f4 <printf>
+ 2d3:	83 c4 20             	add    $0x20,%esp
+ 2d6:	e9 42 ff ff ff       	jmp    21d <ls+0x190>
+      }else{
+        strcpy(buf, path);
+ 2db:	83 ec 08             	sub    $0x8,%esp
+ 2de:	56                   	push   %esi
+ 2df:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+ 2e5:	56                   	push   %esi
+ 2e6:	e8 99 01 00 00       	call   484 <strcpy>
+        p = buf+strlen(buf); // put '/' at end
+ 2eb:	89 34 24             	mov    %esi,(%esp)
+ 2ee:	e8 e0 01 00 00       	call   4d3 <strlen>
+ 2f3:	01 c6                	add    %eax,%esi
+        *p++ = '/';
+ 2f5:	8d 46 01             	lea    0x1(%esi),%eax
+ 2f8:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+ 2fe:	c6 06 2f             	movb   $0x2f,(%esi)
+// printf(1, "buf name %s\n", buf);
+// printf(1, "path name %s\n", buf);
+// printf(1, "readin uv5\n");
+        while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 301:	83 c4 10             	add    $0x10,%esp
+ 304:	8d 9d d8 fd ff ff    	lea    -0x228(%ebp),%ebx
+ 30a:	eb 19                	jmp    325 <ls+0x298>
+            continue;
+          memmove(p, de.name, DIRSIZ);
+          p[DIRSIZ] = 0;
+// printf(1, "stat->fstated 2\n");
+          if(stat(buf, &st) < 0){
+            printf(1, "ls: cannot stat %s\n", buf);
+ 30c:	83 ec 04             	sub    $0x4,%esp
+ 30f:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 315:	50                   	push   %eax
+ 316:	68 00 0b 00 00       	push   $0xb00
+ 31b:	6a 01                	push   $0x1
+ 31d:	e8 d2 04 00 00       	call   7f4 <printf>
+            continue;
+ 322:	83 c4 10             	add    $0x10,%esp
+        while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 325:	83 ec 04             	sub    $0x4,%esp
+ 328:	6a 10                	push   $0x10
+ 32a:	53                   	push   %ebx
+ 32b:	57                   	push   %edi
+ 32c:	e8 33 03 00 00       	call   664 <read>
+ 331:	83 c4 10             	add    $0x10,%esp
+ 334:	83 f8 10             	cmp    $0x10,%eax
+ 337:	0f 85 e4 00 00 00    	jne    421 <ls+0x394>
+          if(de.inum == 0)
+ 33d:	66 83 bd d8 fd ff ff 	cmpw   $0x0,-0x228(%ebp)
+ 344:	00 
+ 345:	74 de                	je     325 <ls+0x298>
+          memmove(p, de.name, DIRSIZ);
+ 347:	83 ec 04             	sub    $0x4,%esp
+ 34a:	6a 0e                	push   $0xe
+ 34c:	8d 85 da fd ff ff    	lea    -0x226(%ebp),%eax
+ 352:	50                   	push   %eax
+ 353:	ff b5 a8 fd ff ff    	push   -0x258(%ebp)
+ 359:	e8 b9 02 00 00       	call   617 <memmove>
+          p[DIRSIZ] = 0;
+ 35e:	c6 46 0f 00          	movb   $0x0,0xf(%esi)
+          if(stat(buf, &st) < 0){
+ 362:	83 c4 08             	add    $0x8,%esp
+ 365:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 36b:	50                   	push   %eax
+ 36c:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 372:	50                   	push   %eax
+ 373:	e8 1e 02 00 00       	call   596 <stat>
+ 378:	83 c4 10             	add    $0x10,%esp
+ 37b:	85 c0                	test   %eax,%eax
+ 37d:	78 8d                	js     30c <ls+0x27f>
+          }
+          // Extract permission from Uv5 i_mode
+          printf(1, "%s i_mode:%d inode:%d size:%d\n", fmtname(buf), (unsigned short)st.type, st.ino, st.size);
+ 37f:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 385:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 38b:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+ 391:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 397:	0f b7 8d c4 fd ff ff 	movzwl -0x23c(%ebp),%ecx
+ 39e:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 3a4:	83 ec 0c             	sub    $0xc,%esp
+ 3a7:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+ 3ad:	50                   	push   %eax
+ 3ae:	e8 4d fc ff ff       	call   0 <fmtname>
+ 3b3:	83 c4 08             	add    $0x8,%esp
+ 3b6:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 3bc:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+ 3c2:	ff b5 ac fd ff ff    	push   -0x254(%ebp)
+ 3c8:	50                   	push   %eax
+ 3c9:	68 38 0b 00 00       	push   $0xb38
+ 3ce:	6a 01                	push   $0x1
+ 3d0:	e8 1f 04 00 00       	call   7f4 <printf>
+ 3d5:	83 c4 20             	add    $0x20,%esp
+ 3d8:	e9 48 ff ff ff       	jmp    325 <ls+0x298>
+        }
+      }
+    }else{
+      printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 3dd:	8b 85 d4 fd ff ff    	mov    -0x22c(%ebp),%eax
+ 3e3:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 3e9:	8b 95 cc fd ff ff    	mov    -0x234(%ebp),%edx
+ 3ef:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 3f5:	83 ec 0c             	sub    $0xc,%esp
+ 3f8:	56                   	push   %esi
+ 3f9:	e8 02 fc ff ff       	call   0 <fmtname>
+ 3fe:	83 c4 08             	add    $0x8,%esp
+ 401:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 407:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+    if((st.type&IFDIR)==IFDIR){
+ 40d:	0f bf db             	movswl %bx,%ebx
+      printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 410:	53                   	push   %ebx
+ 411:	50                   	push   %eax
+ 412:	68 14 0b 00 00       	push   $0xb14
+ 417:	6a 01                	push   $0x1
+ 419:	e8 d6 03 00 00       	call   7f4 <printf>
+ 41e:	83 c4 20             	add    $0x20,%esp
+    }
+  }
+  close(fd);
+ 421:	83 ec 0c             	sub    $0xc,%esp
+ 424:	57                   	push   %edi
+ 425:	e8 4a 02 00 00       	call   674 <close>
+ 42a:	83 c4 10             	add    $0x10,%esp
+}
+ 42d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 430:	5b                   	pop    %ebx
+ 431:	5e                   	pop    %esi
+ 432:	5f                   	pop    %edi
+ 433:	5d                   	pop    %ebp
+ 434:	c3                   	ret
+
+00000435 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 435:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 439:	83 e4 f0             	and    $0xfffffff0,%esp
+ 43c:	ff 71 fc             	push   -0x4(%ecx)
+ 43f:	55                   	push   %ebp
+ 440:	89 e5                	mov    %esp,%ebp
+ 442:	57                   	push   %edi
+ 443:	56                   	push   %esi
+ 444:	53                   	push   %ebx
+ 445:	51                   	push   %ecx
+ 446:	83 ec 08             	sub    $0x8,%esp
+ 449:	8b 31                	mov    (%ecx),%esi
+ 44b:	8b 79 04             	mov    0x4(%ecx),%edi
+
+  if(argc < 2){
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+ 44e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  if(argc < 2){
+ 453:	83 fe 01             	cmp    $0x1,%esi
+ 456:	7e 1a                	jle    472 <main+0x3d>
+    ls(argv[i]);
+ 458:	83 ec 0c             	sub    $0xc,%esp
+ 45b:	ff 34 9f             	push   (%edi,%ebx,4)
+ 45e:	e8 2a fc ff ff       	call   8d <ls>
+  for(i=1; i<argc; i++)
+ 463:	83 c3 01             	add    $0x1,%ebx
+ 466:	83 c4 10             	add    $0x10,%esp
+ 469:	39 de                	cmp    %ebx,%esi
+ 46b:	75 eb                	jne    458 <main+0x23>
+  exit();
+ 46d:	e8 da 01 00 00       	call   64c <exit>
+    ls(".");
+ 472:	83 ec 0c             	sub    $0xc,%esp
+ 475:	68 34 0b 00 00       	push   $0xb34
+ 47a:	e8 0e fc ff ff       	call   8d <ls>
+    exit();
+ 47f:	e8 c8 01 00 00       	call   64c <exit>
+
+00000484 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 484:	55                   	push   %ebp
+ 485:	89 e5                	mov    %esp,%ebp
+ 487:	53                   	push   %ebx
+ 488:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 48b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 48e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 493:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 497:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 49a:	83 c0 01             	add    $0x1,%eax
+ 49d:	84 d2                	test   %dl,%dl
+ 49f:	75 f2                	jne    493 <strcpy+0xf>
+    ;
+  return os;
+}
+ 4a1:	89 c8                	mov    %ecx,%eax
+ 4a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a6:	c9                   	leave
+ 4a7:	c3                   	ret
+
+000004a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4a8:	55                   	push   %ebp
+ 4a9:	89 e5                	mov    %esp,%ebp
+ 4ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 4b1:	0f b6 01             	movzbl (%ecx),%eax
+ 4b4:	84 c0                	test   %al,%al
+ 4b6:	74 11                	je     4c9 <strcmp+0x21>
+ 4b8:	38 02                	cmp    %al,(%edx)
+ 4ba:	75 0d                	jne    4c9 <strcmp+0x21>
+    p++, q++;
+ 4bc:	83 c1 01             	add    $0x1,%ecx
+ 4bf:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 4c2:	0f b6 01             	movzbl (%ecx),%eax
+ 4c5:	84 c0                	test   %al,%al
+ 4c7:	75 ef                	jne    4b8 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 4c9:	0f b6 c0             	movzbl %al,%eax
+ 4cc:	0f b6 12             	movzbl (%edx),%edx
+ 4cf:	29 d0                	sub    %edx,%eax
+}
+ 4d1:	5d                   	pop    %ebp
+ 4d2:	c3                   	ret
+
+000004d3 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 4d3:	55                   	push   %ebp
+ 4d4:	89 e5                	mov    %esp,%ebp
+ 4d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4d9:	80 3a 00             	cmpb   $0x0,(%edx)
+ 4dc:	74 14                	je     4f2 <strlen+0x1f>
+ 4de:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4e3:	83 c0 01             	add    $0x1,%eax
+ 4e6:	89 c1                	mov    %eax,%ecx
+ 4e8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 4ec:	75 f5                	jne    4e3 <strlen+0x10>
+    ;
+  return n;
+}
+ 4ee:	89 c8                	mov    %ecx,%eax
+ 4f0:	5d                   	pop    %ebp
+ 4f1:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 4f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 4f7:	eb f5                	jmp    4ee <strlen+0x1b>
+
+000004f9 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4f9:	55                   	push   %ebp
+ 4fa:	89 e5                	mov    %esp,%ebp
+ 4fc:	57                   	push   %edi
+ 4fd:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 500:	89 d7                	mov    %edx,%edi
+ 502:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 505:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 508:	fc                   	cld
+ 509:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 50b:	89 d0                	mov    %edx,%eax
+ 50d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 510:	c9                   	leave
+ 511:	c3                   	ret
+
+00000512 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 512:	55                   	push   %ebp
+ 513:	89 e5                	mov    %esp,%ebp
+ 515:	8b 45 08             	mov    0x8(%ebp),%eax
+ 518:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 51c:	0f b6 10             	movzbl (%eax),%edx
+ 51f:	84 d2                	test   %dl,%dl
+ 521:	74 15                	je     538 <strchr+0x26>
+    if(*s == c)
+ 523:	38 d1                	cmp    %dl,%cl
+ 525:	74 0f                	je     536 <strchr+0x24>
+  for(; *s; s++)
+ 527:	83 c0 01             	add    $0x1,%eax
+ 52a:	0f b6 10             	movzbl (%eax),%edx
+ 52d:	84 d2                	test   %dl,%dl
+ 52f:	75 f2                	jne    523 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 531:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 536:	5d                   	pop    %ebp
+ 537:	c3                   	ret
+  return 0;
+ 538:	b8 00 00 00 00       	mov    $0x0,%eax
+ 53d:	eb f7                	jmp    536 <strchr+0x24>
+
+0000053f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 53f:	55                   	push   %ebp
+ 540:	89 e5                	mov    %esp,%ebp
+ 542:	57                   	push   %edi
+ 543:	56                   	push   %esi
+ 544:	53                   	push   %ebx
+ 545:	83 ec 2c             	sub    $0x2c,%esp
+ 548:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 54b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 550:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 553:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 556:	83 c3 01             	add    $0x1,%ebx
+ 559:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 55c:	7d 27                	jge    585 <gets+0x46>
+    cc = read(0, &c, 1);
+ 55e:	83 ec 04             	sub    $0x4,%esp
+ 561:	6a 01                	push   $0x1
+ 563:	57                   	push   %edi
+ 564:	6a 00                	push   $0x0
+ 566:	e8 f9 00 00 00       	call   664 <read>
+    if(cc < 1)
+ 56b:	83 c4 10             	add    $0x10,%esp
+ 56e:	85 c0                	test   %eax,%eax
+ 570:	7e 13                	jle    585 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 572:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 576:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 57a:	3c 0a                	cmp    $0xa,%al
+ 57c:	74 04                	je     582 <gets+0x43>
+ 57e:	3c 0d                	cmp    $0xd,%al
+ 580:	75 d1                	jne    553 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 582:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 585:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 588:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 58c:	89 f0                	mov    %esi,%eax
+ 58e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 591:	5b                   	pop    %ebx
+ 592:	5e                   	pop    %esi
+ 593:	5f                   	pop    %edi
+ 594:	5d                   	pop    %ebp
+ 595:	c3                   	ret
+
+00000596 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 596:	55                   	push   %ebp
+ 597:	89 e5                	mov    %esp,%ebp
+ 599:	56                   	push   %esi
+ 59a:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 59b:	83 ec 08             	sub    $0x8,%esp
+ 59e:	6a 00                	push   $0x0
+ 5a0:	ff 75 08             	push   0x8(%ebp)
+ 5a3:	e8 e4 00 00 00       	call   68c <open>
+  if(fd < 0)
+ 5a8:	83 c4 10             	add    $0x10,%esp
+ 5ab:	85 c0                	test   %eax,%eax
+ 5ad:	78 24                	js     5d3 <stat+0x3d>
+ 5af:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 5b1:	83 ec 08             	sub    $0x8,%esp
+ 5b4:	ff 75 0c             	push   0xc(%ebp)
+ 5b7:	50                   	push   %eax
+ 5b8:	e8 e7 00 00 00       	call   6a4 <fstat>
+ 5bd:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 5bf:	89 1c 24             	mov    %ebx,(%esp)
+ 5c2:	e8 ad 00 00 00       	call   674 <close>
+  return r;
+ 5c7:	83 c4 10             	add    $0x10,%esp
+}
+ 5ca:	89 f0                	mov    %esi,%eax
+ 5cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5cf:	5b                   	pop    %ebx
+ 5d0:	5e                   	pop    %esi
+ 5d1:	5d                   	pop    %ebp
+ 5d2:	c3                   	ret
+    return -1;
+ 5d3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5d8:	eb f0                	jmp    5ca <stat+0x34>
+
+000005da <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5da:	55                   	push   %ebp
+ 5db:	89 e5                	mov    %esp,%ebp
+ 5dd:	53                   	push   %ebx
+ 5de:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5e1:	0f b6 02             	movzbl (%edx),%eax
+ 5e4:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5e7:	80 f9 09             	cmp    $0x9,%cl
+ 5ea:	77 24                	ja     610 <atoi+0x36>
+  n = 0;
+ 5ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 5f1:	83 c2 01             	add    $0x1,%edx
+ 5f4:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5f7:	0f be c0             	movsbl %al,%eax
+ 5fa:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5fe:	0f b6 02             	movzbl (%edx),%eax
+ 601:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 604:	80 fb 09             	cmp    $0x9,%bl
+ 607:	76 e8                	jbe    5f1 <atoi+0x17>
+  return n;
+}
+ 609:	89 c8                	mov    %ecx,%eax
+ 60b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 60e:	c9                   	leave
+ 60f:	c3                   	ret
+  n = 0;
+ 610:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 615:	eb f2                	jmp    609 <atoi+0x2f>
+
+00000617 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 617:	55                   	push   %ebp
+ 618:	89 e5                	mov    %esp,%ebp
+ 61a:	56                   	push   %esi
+ 61b:	53                   	push   %ebx
+ 61c:	8b 75 08             	mov    0x8(%ebp),%esi
+ 61f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 622:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 625:	85 db                	test   %ebx,%ebx
+ 627:	7e 15                	jle    63e <memmove+0x27>
+ 629:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 62b:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 62d:	83 c2 01             	add    $0x1,%edx
+ 630:	83 c0 01             	add    $0x1,%eax
+ 633:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 637:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 63a:	39 c3                	cmp    %eax,%ebx
+ 63c:	75 ef                	jne    62d <memmove+0x16>
+  return vdst;
+}
+ 63e:	89 f0                	mov    %esi,%eax
+ 640:	5b                   	pop    %ebx
+ 641:	5e                   	pop    %esi
+ 642:	5d                   	pop    %ebp
+ 643:	c3                   	ret
+
+00000644 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 644:	b8 01 00 00 00       	mov    $0x1,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <exit>:
+SYSCALL(exit)
+ 64c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <wait>:
+SYSCALL(wait)
+ 654:	b8 03 00 00 00       	mov    $0x3,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <pipe>:
+SYSCALL(pipe)
+ 65c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <read>:
+SYSCALL(read)
+ 664:	b8 05 00 00 00       	mov    $0x5,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <write>:
+SYSCALL(write)
+ 66c:	b8 10 00 00 00       	mov    $0x10,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <close>:
+SYSCALL(close)
+ 674:	b8 15 00 00 00       	mov    $0x15,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <kill>:
+SYSCALL(kill)
+ 67c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <exec>:
+SYSCALL(exec)
+ 684:	b8 07 00 00 00       	mov    $0x7,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <open>:
+SYSCALL(open)
+ 68c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <mknod>:
+SYSCALL(mknod)
+ 694:	b8 11 00 00 00       	mov    $0x11,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <unlink>:
+SYSCALL(unlink)
+ 69c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <fstat>:
+SYSCALL(fstat)
+ 6a4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <link>:
+SYSCALL(link)
+ 6ac:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <mkdir>:
+SYSCALL(mkdir)
+ 6b4:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <chdir>:
+SYSCALL(chdir)
+ 6bc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <dup>:
+SYSCALL(dup)
+ 6c4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <getpid>:
+SYSCALL(getpid)
+ 6cc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <sbrk>:
+SYSCALL(sbrk)
+ 6d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <sleep>:
+SYSCALL(sleep)
+ 6dc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <uptime>:
+SYSCALL(uptime)
+ 6e4:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <readmouse>:
+SYSCALL(readmouse)
+ 6ec:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <sigsend>:
+SYSCALL(sigsend)
+ 6f4:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <sigsethandler>:
+SYSCALL(sigsethandler)
+ 6fc:	b8 18 00 00 00       	mov    $0x18,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <sigreturn>:
+SYSCALL(sigreturn)
+ 704:	b8 19 00 00 00       	mov    $0x19,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <siggetmask>:
+SYSCALL(siggetmask)
+ 70c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 714:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <sigpause>:
+SYSCALL(sigpause)
+ 71c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 724:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <sleeptick>:
+SYSCALL(sleeptick)
+ 72c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <schedctl>:
+SYSCALL(schedctl)
+ 734:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <nswtch>:
+SYSCALL(nswtch)
+ 73c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <getloadavg>:
+SYSCALL(getloadavg)
+ 744:	b8 21 00 00 00       	mov    $0x21,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <memstat>:
+SYSCALL(memstat)
+ 74c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <iostat>:
+SYSCALL(iostat)
+ 754:	b8 23 00 00 00       	mov    $0x23,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 75c:	55                   	push   %ebp
+ 75d:	89 e5                	mov    %esp,%ebp
+ 75f:	57                   	push   %edi
+ 760:	56                   	push   %esi
+ 761:	53                   	push   %ebx
+ 762:	83 ec 3c             	sub    $0x3c,%esp
+ 765:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 768:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 76a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 76e:	74 79                	je     7e9 <printint+0x8d>
+ 770:	85 d2                	test   %edx,%edx
+ 772:	79 75                	jns    7e9 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 774:	89 d1                	mov    %edx,%ecx
+ 776:	f7 d9                	neg    %ecx
+    neg = 1;
+ 778:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 77f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 784:	89 df                	mov    %ebx,%edi
+ 786:	83 c3 01             	add    $0x1,%ebx
+ 789:	89 c8                	mov    %ecx,%eax
+ 78b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 790:	f7 f6                	div    %esi
+ 792:	0f b6 92 b8 0b 00 00 	movzbl 0xbb8(%edx),%edx
+ 799:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 79d:	89 ca                	mov    %ecx,%edx
+ 79f:	89 c1                	mov    %eax,%ecx
+ 7a1:	39 f2                	cmp    %esi,%edx
+ 7a3:	73 df                	jae    784 <printint+0x28>
+  if(neg)
+ 7a5:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 7a9:	74 08                	je     7b3 <printint+0x57>
+    buf[i++] = '-';
+ 7ab:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 7b0:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 7b3:	85 db                	test   %ebx,%ebx
+ 7b5:	7e 2a                	jle    7e1 <printint+0x85>
+ 7b7:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 7ba:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 7be:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 7c1:	0f b6 03             	movzbl (%ebx),%eax
+ 7c4:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 7c7:	83 ec 04             	sub    $0x4,%esp
+ 7ca:	6a 01                	push   $0x1
+ 7cc:	57                   	push   %edi
+ 7cd:	ff 75 c4             	push   -0x3c(%ebp)
+ 7d0:	e8 97 fe ff ff       	call   66c <write>
+  while(--i >= 0)
+ 7d5:	89 d8                	mov    %ebx,%eax
+ 7d7:	83 eb 01             	sub    $0x1,%ebx
+ 7da:	83 c4 10             	add    $0x10,%esp
+ 7dd:	39 f0                	cmp    %esi,%eax
+ 7df:	75 e0                	jne    7c1 <printint+0x65>
+}
+ 7e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7e4:	5b                   	pop    %ebx
+ 7e5:	5e                   	pop    %esi
+ 7e6:	5f                   	pop    %edi
+ 7e7:	5d                   	pop    %ebp
+ 7e8:	c3                   	ret
+    x = xx;
+ 7e9:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 7eb:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 7f2:	eb 8b                	jmp    77f <printint+0x23>
+
+000007f4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7f4:	55                   	push   %ebp
+ 7f5:	89 e5                	mov    %esp,%ebp
+ 7f7:	57                   	push   %edi
+ 7f8:	56                   	push   %esi
+ 7f9:	53                   	push   %ebx
+ 7fa:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 800:	0f b6 1e             	movzbl (%esi),%ebx
+ 803:	84 db                	test   %bl,%bl
+ 805:	0f 84 9e 01 00 00    	je     9a9 <printf+0x1b5>
+ 80b:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 80e:	8d 45 10             	lea    0x10(%ebp),%eax
+ 811:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 814:	bf 00 00 00 00       	mov    $0x0,%edi
+ 819:	eb 2d                	jmp    848 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 81b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 81e:	83 ec 04             	sub    $0x4,%esp
+ 821:	6a 01                	push   $0x1
+ 823:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 826:	50                   	push   %eax
+ 827:	ff 75 08             	push   0x8(%ebp)
+ 82a:	e8 3d fe ff ff       	call   66c <write>
+        putc(fd, c);
+ 82f:	83 c4 10             	add    $0x10,%esp
+ 832:	eb 05                	jmp    839 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 834:	83 ff 25             	cmp    $0x25,%edi
+ 837:	74 1f                	je     858 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 839:	83 c6 01             	add    $0x1,%esi
+ 83c:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 840:	84 db                	test   %bl,%bl
+ 842:	0f 84 61 01 00 00    	je     9a9 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 848:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 84b:	85 ff                	test   %edi,%edi
+ 84d:	75 e5                	jne    834 <printf+0x40>
+      if(c == '%'){
+ 84f:	83 f8 25             	cmp    $0x25,%eax
+ 852:	75 c7                	jne    81b <printf+0x27>
+        state = '%';
+ 854:	89 c7                	mov    %eax,%edi
+ 856:	eb e1                	jmp    839 <printf+0x45>
+      if(c == 'd'){
+ 858:	83 f8 25             	cmp    $0x25,%eax
+ 85b:	0f 84 f4 00 00 00    	je     955 <printf+0x161>
+ 861:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 864:	83 fa 15             	cmp    $0x15,%edx
+ 867:	0f 87 09 01 00 00    	ja     976 <printf+0x182>
+ 86d:	0f 87 03 01 00 00    	ja     976 <printf+0x182>
+ 873:	ff 24 95 60 0b 00 00 	jmp    *0xb60(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 87a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 87d:	8b 17                	mov    (%edi),%edx
+ 87f:	83 ec 0c             	sub    $0xc,%esp
+ 882:	6a 01                	push   $0x1
+ 884:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 889:	8b 45 08             	mov    0x8(%ebp),%eax
+ 88c:	e8 cb fe ff ff       	call   75c <printint>
+        ap++;
+ 891:	83 c7 04             	add    $0x4,%edi
+ 894:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 897:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 89a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 89f:	eb 98                	jmp    839 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 8a1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 8a4:	8b 17                	mov    (%edi),%edx
+ 8a6:	83 ec 0c             	sub    $0xc,%esp
+ 8a9:	6a 00                	push   $0x0
+ 8ab:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b3:	e8 a4 fe ff ff       	call   75c <printint>
+        ap++;
+ 8b8:	83 c7 04             	add    $0x4,%edi
+ 8bb:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 8be:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8c1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 8c6:	e9 6e ff ff ff       	jmp    839 <printf+0x45>
+        s = (char*)*ap;
+ 8cb:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 8ce:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 8d0:	83 c1 04             	add    $0x4,%ecx
+ 8d3:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 8d6:	85 c0                	test   %eax,%eax
+ 8d8:	74 13                	je     8ed <printf+0xf9>
+        s = (char*)*ap;
+ 8da:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 8dc:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 8df:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 8e4:	84 c0                	test   %al,%al
+ 8e6:	75 0f                	jne    8f7 <printf+0x103>
+ 8e8:	e9 4c ff ff ff       	jmp    839 <printf+0x45>
+          s = "(null)";
+ 8ed:	bb 57 0b 00 00       	mov    $0xb57,%ebx
+        while(*s != 0){
+ 8f2:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 8f7:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 8fa:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 8fd:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 900:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 903:	83 ec 04             	sub    $0x4,%esp
+ 906:	6a 01                	push   $0x1
+ 908:	57                   	push   %edi
+ 909:	56                   	push   %esi
+ 90a:	e8 5d fd ff ff       	call   66c <write>
+          s++;
+ 90f:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 912:	0f b6 03             	movzbl (%ebx),%eax
+ 915:	83 c4 10             	add    $0x10,%esp
+ 918:	84 c0                	test   %al,%al
+ 91a:	75 e4                	jne    900 <printf+0x10c>
+      state = 0;
+ 91c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 91f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 924:	e9 10 ff ff ff       	jmp    839 <printf+0x45>
+        putc(fd, *ap);
+ 929:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 92c:	8b 07                	mov    (%edi),%eax
+ 92e:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 931:	83 ec 04             	sub    $0x4,%esp
+ 934:	6a 01                	push   $0x1
+ 936:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 939:	50                   	push   %eax
+ 93a:	ff 75 08             	push   0x8(%ebp)
+ 93d:	e8 2a fd ff ff       	call   66c <write>
+        ap++;
+ 942:	83 c7 04             	add    $0x4,%edi
+ 945:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 948:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 94b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 950:	e9 e4 fe ff ff       	jmp    839 <printf+0x45>
+        putc(fd, c);
+ 955:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 958:	83 ec 04             	sub    $0x4,%esp
+ 95b:	6a 01                	push   $0x1
+ 95d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 960:	50                   	push   %eax
+ 961:	ff 75 08             	push   0x8(%ebp)
+ 964:	e8 03 fd ff ff       	call   66c <write>
+ 969:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 96c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 971:	e9 c3 fe ff ff       	jmp    839 <printf+0x45>
+        putc(fd, '%');
+ 976:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 97a:	83 ec 04             	sub    $0x4,%esp
+ 97d:	6a 01                	push   $0x1
+ 97f:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 982:	57                   	push   %edi
+ 983:	ff 75 08             	push   0x8(%ebp)
+ 986:	e8 e1 fc ff ff       	call   66c <write>
+        putc(fd, c);
+ 98b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 98e:	83 c4 0c             	add    $0xc,%esp
+ 991:	6a 01                	push   $0x1
+ 993:	57                   	push   %edi
+ 994:	ff 75 08             	push   0x8(%ebp)
+ 997:	e8 d0 fc ff ff       	call   66c <write>
+        putc(fd, c);
+ 99c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 99f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 9a4:	e9 90 fe ff ff       	jmp    839 <printf+0x45>
+    }
+  }
+}
+ 9a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9ac:	5b                   	pop    %ebx
+ 9ad:	5e                   	pop    %esi
+ 9ae:	5f                   	pop    %edi
+ 9af:	5d                   	pop    %ebp
+ 9b0:	c3                   	ret
+
+000009b1 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9b1:	55                   	push   %ebp
+ 9b2:	89 e5                	mov    %esp,%ebp
+ 9b4:	57                   	push   %edi
+ 9b5:	56                   	push   %esi
+ 9b6:	53                   	push   %ebx
+ 9b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9ba:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9bd:	a1 98 0e 00 00       	mov    0xe98,%eax
+ 9c2:	eb 0c                	jmp    9d0 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9c4:	8b 10                	mov    (%eax),%edx
+ 9c6:	39 d0                	cmp    %edx,%eax
+ 9c8:	72 04                	jb     9ce <free+0x1d>
+ 9ca:	39 d1                	cmp    %edx,%ecx
+ 9cc:	72 10                	jb     9de <free+0x2d>
+{
+ 9ce:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d0:	39 c8                	cmp    %ecx,%eax
+ 9d2:	73 f0                	jae    9c4 <free+0x13>
+ 9d4:	8b 10                	mov    (%eax),%edx
+ 9d6:	39 d1                	cmp    %edx,%ecx
+ 9d8:	72 04                	jb     9de <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9da:	39 d0                	cmp    %edx,%eax
+ 9dc:	72 f0                	jb     9ce <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9de:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9e1:	8b 10                	mov    (%eax),%edx
+ 9e3:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9e6:	39 fa                	cmp    %edi,%edx
+ 9e8:	74 19                	je     a03 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9ea:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9ed:	8b 50 04             	mov    0x4(%eax),%edx
+ 9f0:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 9f3:	39 f1                	cmp    %esi,%ecx
+ 9f5:	74 18                	je     a0f <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9f7:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 9f9:	a3 98 0e 00 00       	mov    %eax,0xe98
+}
+ 9fe:	5b                   	pop    %ebx
+ 9ff:	5e                   	pop    %esi
+ a00:	5f                   	pop    %edi
+ a01:	5d                   	pop    %ebp
+ a02:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ a03:	03 72 04             	add    0x4(%edx),%esi
+ a06:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a09:	8b 10                	mov    (%eax),%edx
+ a0b:	8b 12                	mov    (%edx),%edx
+ a0d:	eb db                	jmp    9ea <free+0x39>
+    p->s.size += bp->s.size;
+ a0f:	03 53 fc             	add    -0x4(%ebx),%edx
+ a12:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a15:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a18:	eb dd                	jmp    9f7 <free+0x46>
+
+00000a1a <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a1a:	55                   	push   %ebp
+ a1b:	89 e5                	mov    %esp,%ebp
+ a1d:	57                   	push   %edi
+ a1e:	56                   	push   %esi
+ a1f:	53                   	push   %ebx
+ a20:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a23:	8b 45 08             	mov    0x8(%ebp),%eax
+ a26:	8d 58 07             	lea    0x7(%eax),%ebx
+ a29:	c1 eb 03             	shr    $0x3,%ebx
+ a2c:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ a2f:	8b 15 98 0e 00 00    	mov    0xe98,%edx
+ a35:	85 d2                	test   %edx,%edx
+ a37:	74 1c                	je     a55 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a39:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a3b:	8b 48 04             	mov    0x4(%eax),%ecx
+ a3e:	39 d9                	cmp    %ebx,%ecx
+ a40:	73 38                	jae    a7a <malloc+0x60>
+  if(nu < 4096)
+ a42:	be 00 10 00 00       	mov    $0x1000,%esi
+ a47:	39 f3                	cmp    %esi,%ebx
+ a49:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ a4c:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ a53:	eb 72                	jmp    ac7 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ a55:	c7 05 98 0e 00 00 9c 	movl   $0xe9c,0xe98
+ a5c:	0e 00 00 
+ a5f:	c7 05 9c 0e 00 00 9c 	movl   $0xe9c,0xe9c
+ a66:	0e 00 00 
+    base.s.size = 0;
+ a69:	c7 05 a0 0e 00 00 00 	movl   $0x0,0xea0
+ a70:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a73:	b8 9c 0e 00 00       	mov    $0xe9c,%eax
+    if(p->s.size >= nunits){
+ a78:	eb c8                	jmp    a42 <malloc+0x28>
+      if(p->s.size == nunits)
+ a7a:	39 cb                	cmp    %ecx,%ebx
+ a7c:	74 1e                	je     a9c <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ a7e:	29 d9                	sub    %ebx,%ecx
+ a80:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a83:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a86:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ a89:	89 15 98 0e 00 00    	mov    %edx,0xe98
+      return (void*)(p + 1);
+ a8f:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ a92:	89 d0                	mov    %edx,%eax
+ a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a97:	5b                   	pop    %ebx
+ a98:	5e                   	pop    %esi
+ a99:	5f                   	pop    %edi
+ a9a:	5d                   	pop    %ebp
+ a9b:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ a9c:	8b 08                	mov    (%eax),%ecx
+ a9e:	89 0a                	mov    %ecx,(%edx)
+ aa0:	eb e7                	jmp    a89 <malloc+0x6f>
+  hp->s.size = nu;
+ aa2:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ aa5:	83 ec 0c             	sub    $0xc,%esp
+ aa8:	83 c0 08             	add    $0x8,%eax
+ aab:	50                   	push   %eax
+ aac:	e8 00 ff ff ff       	call   9b1 <free>
+  return freep;
+ ab1:	8b 15 98 0e 00 00    	mov    0xe98,%edx
+      if((p = morecore(nunits)) == 0)
+ ab7:	83 c4 10             	add    $0x10,%esp
+ aba:	85 d2                	test   %edx,%edx
+ abc:	74 d4                	je     a92 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ abe:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ac0:	8b 48 04             	mov    0x4(%eax),%ecx
+ ac3:	39 d9                	cmp    %ebx,%ecx
+ ac5:	73 b3                	jae    a7a <malloc+0x60>
+    if(p == freep)
+ ac7:	89 c2                	mov    %eax,%edx
+ ac9:	39 05 98 0e 00 00    	cmp    %eax,0xe98
+ acf:	75 ed                	jne    abe <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ ad1:	83 ec 0c             	sub    $0xc,%esp
+ ad4:	57                   	push   %edi
+ ad5:	e8 fa fb ff ff       	call   6d4 <sbrk>
+  if(p == (char*)-1)
+ ada:	83 c4 10             	add    $0x10,%esp
+ add:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ae0:	75 c0                	jne    aa2 <malloc+0x88>
+        return 0;
+ ae2:	ba 00 00 00 00       	mov    $0x0,%edx
+ ae7:	eb a9                	jmp    a92 <malloc+0x78>
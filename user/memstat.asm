@@ -0,0 +1,1203 @@
+
+_memstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <show>:
+#include "kernel/memstat.h"
+#include "user.h"
+
+static void
+show(int pid)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 44             	sub    $0x44,%esp
+   9:	89 c3                	mov    %eax,%ebx
+  struct memstat ms;
+
+  if(memstat(pid, &ms) < 0){
+   b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+   e:	50                   	push   %eax
+   f:	53                   	push   %ebx
+  10:	e8 b2 03 00 00       	call   3c7 <memstat>
+  15:	83 c4 10             	add    $0x10,%esp
+  18:	85 c0                	test   %eax,%eax
+  1a:	78 30                	js     4c <show+0x4c>
+    printf(2, "memstat: no process %d\n", pid);
+    return;
+  }
+  printf(1, "pid %d: resident %d shared %d pgtab %d\n",
+  1c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  1f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  22:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  28:	85 db                	test   %ebx,%ebx
+  2a:	74 35                	je     61 <show+0x61>
+  2c:	83 ec 08             	sub    $0x8,%esp
+  2f:	57                   	push   %edi
+  30:	56                   	push   %esi
+  31:	ff 75 c4             	push   -0x3c(%ebp)
+  34:	53                   	push   %ebx
+  35:	68 98 07 00 00       	push   $0x798
+  3a:	6a 01                	push   $0x1
+  3c:	e8 2e 04 00 00       	call   46f <printf>
+  41:	83 c4 20             	add    $0x20,%esp
+         pid ? pid : getpid(), ms.resident, ms.pshared, ms.ppgtab);
+}
+  44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  47:	5b                   	pop    %ebx
+  48:	5e                   	pop    %esi
+  49:	5f                   	pop    %edi
+  4a:	5d                   	pop    %ebp
+  4b:	c3                   	ret
+    printf(2, "memstat: no process %d\n", pid);
+  4c:	83 ec 04             	sub    $0x4,%esp
+  4f:	53                   	push   %ebx
+  50:	68 64 07 00 00       	push   $0x764
+  55:	6a 02                	push   $0x2
+  57:	e8 13 04 00 00       	call   46f <printf>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	eb e3                	jmp    44 <show+0x44>
+         pid ? pid : getpid(), ms.resident, ms.pshared, ms.ppgtab);
+  61:	e8 e1 02 00 00       	call   347 <getpid>
+  66:	89 c3                	mov    %eax,%ebx
+  68:	eb c2                	jmp    2c <show+0x2c>
+
+0000006a <main>:
+
+int
+main(int argc, char *argv[])
+{
+  6a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  6e:	83 e4 f0             	and    $0xfffffff0,%esp
+  71:	ff 71 fc             	push   -0x4(%ecx)
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	56                   	push   %esi
+  79:	53                   	push   %ebx
+  7a:	51                   	push   %ecx
+  7b:	83 ec 30             	sub    $0x30,%esp
+  7e:	8b 31                	mov    (%ecx),%esi
+  80:	8b 79 04             	mov    0x4(%ecx),%edi
+  struct memstat ms;
+  int i;
+
+  if(memstat(0, &ms) < 0){
+  83:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  86:	50                   	push   %eax
+  87:	6a 00                	push   $0x0
+  89:	e8 39 03 00 00       	call   3c7 <memstat>
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	85 c0                	test   %eax,%eax
+  93:	78 4a                	js     df <main+0x75>
+    printf(2, "memstat: memstat failed\n");
+    exit();
+  }
+  printf(1, "total %d free %d used %d shared %d pgtab %d\n",
+  95:	83 ec 04             	sub    $0x4,%esp
+  98:	ff 75 d8             	push   -0x28(%ebp)
+  9b:	ff 75 d4             	push   -0x2c(%ebp)
+  9e:	ff 75 d0             	push   -0x30(%ebp)
+  a1:	ff 75 cc             	push   -0x34(%ebp)
+  a4:	ff 75 c8             	push   -0x38(%ebp)
+  a7:	68 c0 07 00 00       	push   $0x7c0
+  ac:	6a 01                	push   $0x1
+  ae:	e8 bc 03 00 00       	call   46f <printf>
+         ms.total, ms.free, ms.used, ms.shared, ms.pgtab);
+  if(argc < 2)
+  b3:	83 c4 20             	add    $0x20,%esp
+  b6:	bb 01 00 00 00       	mov    $0x1,%ebx
+  bb:	83 fe 01             	cmp    $0x1,%esi
+  be:	7e 33                	jle    f3 <main+0x89>
+    show(0);
+  for(i = 1; i < argc; i++)
+    show(atoi(argv[i]));
+  c0:	83 ec 0c             	sub    $0xc,%esp
+  c3:	ff 34 9f             	push   (%edi,%ebx,4)
+  c6:	e8 8a 01 00 00       	call   255 <atoi>
+  cb:	e8 30 ff ff ff       	call   0 <show>
+  for(i = 1; i < argc; i++)
+  d0:	83 c3 01             	add    $0x1,%ebx
+  d3:	83 c4 10             	add    $0x10,%esp
+  d6:	39 de                	cmp    %ebx,%esi
+  d8:	75 e6                	jne    c0 <main+0x56>
+  exit();
+  da:	e8 e8 01 00 00       	call   2c7 <exit>
+    printf(2, "memstat: memstat failed\n");
+  df:	83 ec 08             	sub    $0x8,%esp
+  e2:	68 7c 07 00 00       	push   $0x77c
+  e7:	6a 02                	push   $0x2
+  e9:	e8 81 03 00 00       	call   46f <printf>
+    exit();
+  ee:	e8 d4 01 00 00       	call   2c7 <exit>
+    show(0);
+  f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  f8:	e8 03 ff ff ff       	call   0 <show>
+  for(i = 1; i < argc; i++)
+  fd:	eb db                	jmp    da <main+0x70>
+
+000000ff <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  ff:	55                   	push   %ebp
+ 100:	89 e5                	mov    %esp,%ebp
+ 102:	53                   	push   %ebx
+ 103:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 106:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 109:	b8 00 00 00 00       	mov    $0x0,%eax
+ 10e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 112:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 115:	83 c0 01             	add    $0x1,%eax
+ 118:	84 d2                	test   %dl,%dl
+ 11a:	75 f2                	jne    10e <strcpy+0xf>
+    ;
+  return os;
+}
+ 11c:	89 c8                	mov    %ecx,%eax
+ 11e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 121:	c9                   	leave
+ 122:	c3                   	ret
+
+00000123 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 123:	55                   	push   %ebp
+ 124:	89 e5                	mov    %esp,%ebp
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 12c:	0f b6 01             	movzbl (%ecx),%eax
+ 12f:	84 c0                	test   %al,%al
+ 131:	74 11                	je     144 <strcmp+0x21>
+ 133:	38 02                	cmp    %al,(%edx)
+ 135:	75 0d                	jne    144 <strcmp+0x21>
+    p++, q++;
+ 137:	83 c1 01             	add    $0x1,%ecx
+ 13a:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 13d:	0f b6 01             	movzbl (%ecx),%eax
+ 140:	84 c0                	test   %al,%al
+ 142:	75 ef                	jne    133 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 144:	0f b6 c0             	movzbl %al,%eax
+ 147:	0f b6 12             	movzbl (%edx),%edx
+ 14a:	29 d0                	sub    %edx,%eax
+}
+ 14c:	5d                   	pop    %ebp
+ 14d:	c3                   	ret
+
+0000014e <strlen>:
+
+uint
+strlen(char *s)
+{
+ 14e:	55                   	push   %ebp
+ 14f:	89 e5                	mov    %esp,%ebp
+ 151:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 154:	80 3a 00             	cmpb   $0x0,(%edx)
+ 157:	74 14                	je     16d <strlen+0x1f>
+ 159:	b8 00 00 00 00       	mov    $0x0,%eax
+ 15e:	83 c0 01             	add    $0x1,%eax
+ 161:	89 c1                	mov    %eax,%ecx
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	75 f5                	jne    15e <strlen+0x10>
+    ;
+  return n;
+}
+ 169:	89 c8                	mov    %ecx,%eax
+ 16b:	5d                   	pop    %ebp
+ 16c:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 16d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 172:	eb f5                	jmp    169 <strlen+0x1b>
+
+00000174 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+ 177:	57                   	push   %edi
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 17b:	89 d7                	mov    %edx,%edi
+ 17d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 180:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 183:	fc                   	cld
+ 184:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 186:	89 d0                	mov    %edx,%eax
+ 188:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+
+0000018d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 18d:	55                   	push   %ebp
+ 18e:	89 e5                	mov    %esp,%ebp
+ 190:	8b 45 08             	mov    0x8(%ebp),%eax
+ 193:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 197:	0f b6 10             	movzbl (%eax),%edx
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	74 15                	je     1b3 <strchr+0x26>
+    if(*s == c)
+ 19e:	38 d1                	cmp    %dl,%cl
+ 1a0:	74 0f                	je     1b1 <strchr+0x24>
+  for(; *s; s++)
+ 1a2:	83 c0 01             	add    $0x1,%eax
+ 1a5:	0f b6 10             	movzbl (%eax),%edx
+ 1a8:	84 d2                	test   %dl,%dl
+ 1aa:	75 f2                	jne    19e <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1b1:	5d                   	pop    %ebp
+ 1b2:	c3                   	ret
+  return 0;
+ 1b3:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1b8:	eb f7                	jmp    1b1 <strchr+0x24>
+
+000001ba <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1ba:	55                   	push   %ebp
+ 1bb:	89 e5                	mov    %esp,%ebp
+ 1bd:	57                   	push   %edi
+ 1be:	56                   	push   %esi
+ 1bf:	53                   	push   %ebx
+ 1c0:	83 ec 2c             	sub    $0x2c,%esp
+ 1c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1cb:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1ce:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1d1:	83 c3 01             	add    $0x1,%ebx
+ 1d4:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1d7:	7d 27                	jge    200 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1d9:	83 ec 04             	sub    $0x4,%esp
+ 1dc:	6a 01                	push   $0x1
+ 1de:	57                   	push   %edi
+ 1df:	6a 00                	push   $0x0
+ 1e1:	e8 f9 00 00 00       	call   2df <read>
+    if(cc < 1)
+ 1e6:	83 c4 10             	add    $0x10,%esp
+ 1e9:	85 c0                	test   %eax,%eax
+ 1eb:	7e 13                	jle    200 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 1ed:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1f1:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1f5:	3c 0a                	cmp    $0xa,%al
+ 1f7:	74 04                	je     1fd <gets+0x43>
+ 1f9:	3c 0d                	cmp    $0xd,%al
+ 1fb:	75 d1                	jne    1ce <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 1fd:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 200:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 203:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 207:	89 f0                	mov    %esi,%eax
+ 209:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20c:	5b                   	pop    %ebx
+ 20d:	5e                   	pop    %esi
+ 20e:	5f                   	pop    %edi
+ 20f:	5d                   	pop    %ebp
+ 210:	c3                   	ret
+
+00000211 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 211:	55                   	push   %ebp
+ 212:	89 e5                	mov    %esp,%ebp
+ 214:	56                   	push   %esi
+ 215:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 216:	83 ec 08             	sub    $0x8,%esp
+ 219:	6a 00                	push   $0x0
+ 21b:	ff 75 08             	push   0x8(%ebp)
+ 21e:	e8 e4 00 00 00       	call   307 <open>
+  if(fd < 0)
+ 223:	83 c4 10             	add    $0x10,%esp
+ 226:	85 c0                	test   %eax,%eax
+ 228:	78 24                	js     24e <stat+0x3d>
+ 22a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 22c:	83 ec 08             	sub    $0x8,%esp
+ 22f:	ff 75 0c             	push   0xc(%ebp)
+ 232:	50                   	push   %eax
+ 233:	e8 e7 00 00 00       	call   31f <fstat>
+ 238:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 23a:	89 1c 24             	mov    %ebx,(%esp)
+ 23d:	e8 ad 00 00 00       	call   2ef <close>
+  return r;
+ 242:	83 c4 10             	add    $0x10,%esp
+}
+ 245:	89 f0                	mov    %esi,%eax
+ 247:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 24a:	5b                   	pop    %ebx
+ 24b:	5e                   	pop    %esi
+ 24c:	5d                   	pop    %ebp
+ 24d:	c3                   	ret
+    return -1;
+ 24e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 253:	eb f0                	jmp    245 <stat+0x34>
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	53                   	push   %ebx
+ 259:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 25c:	0f b6 02             	movzbl (%edx),%eax
+ 25f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 262:	80 f9 09             	cmp    $0x9,%cl
+ 265:	77 24                	ja     28b <atoi+0x36>
+  n = 0;
+ 267:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 26c:	83 c2 01             	add    $0x1,%edx
+ 26f:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 272:	0f be c0             	movsbl %al,%eax
+ 275:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 279:	0f b6 02             	movzbl (%edx),%eax
+ 27c:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 27f:	80 fb 09             	cmp    $0x9,%bl
+ 282:	76 e8                	jbe    26c <atoi+0x17>
+  return n;
+}
+ 284:	89 c8                	mov    %ecx,%eax
+ 286:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 289:	c9                   	leave
+ 28a:	c3                   	ret
+  n = 0;
+ 28b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 290:	eb f2                	jmp    284 <atoi+0x2f>
+
+00000292 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 292:	55                   	push   %ebp
+ 293:	89 e5                	mov    %esp,%ebp
+ 295:	56                   	push   %esi
+ 296:	53                   	push   %ebx
+ 297:	8b 75 08             	mov    0x8(%ebp),%esi
+ 29a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 29d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2a0:	85 db                	test   %ebx,%ebx
+ 2a2:	7e 15                	jle    2b9 <memmove+0x27>
+ 2a4:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2a6:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2a8:	83 c2 01             	add    $0x1,%edx
+ 2ab:	83 c0 01             	add    $0x1,%eax
+ 2ae:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2b2:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2b5:	39 c3                	cmp    %eax,%ebx
+ 2b7:	75 ef                	jne    2a8 <memmove+0x16>
+  return vdst;
+}
+ 2b9:	89 f0                	mov    %esi,%eax
+ 2bb:	5b                   	pop    %ebx
+ 2bc:	5e                   	pop    %esi
+ 2bd:	5d                   	pop    %ebp
+ 2be:	c3                   	ret
+
+000002bf <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2bf:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2c4:	cd 40                	int    $0x40
+ 2c6:	c3                   	ret
+
+000002c7 <exit>:
+SYSCALL(exit)
+ 2c7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2cc:	cd 40                	int    $0x40
+ 2ce:	c3                   	ret
+
+000002cf <wait>:
+SYSCALL(wait)
+ 2cf:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2d4:	cd 40                	int    $0x40
+ 2d6:	c3                   	ret
+
+000002d7 <pipe>:
+SYSCALL(pipe)
+ 2d7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2dc:	cd 40                	int    $0x40
+ 2de:	c3                   	ret
+
+000002df <read>:
+SYSCALL(read)
+ 2df:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2e4:	cd 40                	int    $0x40
+ 2e6:	c3                   	ret
+
+000002e7 <write>:
+SYSCALL(write)
+ 2e7:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2ec:	cd 40                	int    $0x40
+ 2ee:	c3                   	ret
+
+000002ef <close>:
+SYSCALL(close)
+ 2ef:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2f4:	cd 40                	int    $0x40
+ 2f6:	c3                   	ret
+
+000002f7 <kill>:
+SYSCALL(kill)
+ 2f7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2fc:	cd 40                	int    $0x40
+ 2fe:	c3                   	ret
+
+000002ff <exec>:
+SYSCALL(exec)
+ 2ff:	b8 07 00 00 00       	mov    $0x7,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <open>:
+SYSCALL(open)
+ 307:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <mknod>:
+SYSCALL(mknod)
+ 30f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <unlink>:
+SYSCALL(unlink)
+ 317:	b8 12 00 00 00       	mov    $0x12,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <fstat>:
+SYSCALL(fstat)
+ 31f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <link>:
+SYSCALL(link)
+ 327:	b8 13 00 00 00       	mov    $0x13,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <mkdir>:
+SYSCALL(mkdir)
+ 32f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <chdir>:
+SYSCALL(chdir)
+ 337:	b8 09 00 00 00       	mov    $0x9,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <dup>:
+SYSCALL(dup)
+ 33f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <getpid>:
+SYSCALL(getpid)
+ 347:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <sbrk>:
+SYSCALL(sbrk)
+ 34f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <sleep>:
+SYSCALL(sleep)
+ 357:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <uptime>:
+SYSCALL(uptime)
+ 35f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <readmouse>:
+SYSCALL(readmouse)
+ 367:	b8 16 00 00 00       	mov    $0x16,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <sigsend>:
+SYSCALL(sigsend)
+ 36f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 377:	b8 18 00 00 00       	mov    $0x18,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <sigreturn>:
+SYSCALL(sigreturn)
+ 37f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <siggetmask>:
+SYSCALL(siggetmask)
+ 387:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <sigsetmask>:
+SYSCALL(sigsetmask)
+ 38f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <sigpause>:
+SYSCALL(sigpause)
+ 397:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <predict_cpu>:
+SYSCALL(predict_cpu)
+ 39f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <sleeptick>:
+SYSCALL(sleeptick)
+ 3a7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <schedctl>:
+SYSCALL(schedctl)
+ 3af:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <nswtch>:
+SYSCALL(nswtch)
+ 3b7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <getloadavg>:
+SYSCALL(getloadavg)
+ 3bf:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <memstat>:
+SYSCALL(memstat)
+ 3c7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
+
+000003cf <iostat>:
+SYSCALL(iostat)
+ 3cf:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3d7:	55                   	push   %ebp
+ 3d8:	89 e5                	mov    %esp,%ebp
+ 3da:	57                   	push   %edi
+ 3db:	56                   	push   %esi
+ 3dc:	53                   	push   %ebx
+ 3dd:	83 ec 3c             	sub    $0x3c,%esp
+ 3e0:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3e3:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3e5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 3e9:	74 79                	je     464 <printint+0x8d>
+ 3eb:	85 d2                	test   %edx,%edx
+ 3ed:	79 75                	jns    464 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 3ef:	89 d1                	mov    %edx,%ecx
+ 3f1:	f7 d9                	neg    %ecx
+    neg = 1;
+ 3f3:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 3fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 3ff:	89 df                	mov    %ebx,%edi
+ 401:	83 c3 01             	add    $0x1,%ebx
+ 404:	89 c8                	mov    %ecx,%eax
+ 406:	ba 00 00 00 00       	mov    $0x0,%edx
+ 40b:	f7 f6                	div    %esi
+ 40d:	0f b6 92 4c 08 00 00 	movzbl 0x84c(%edx),%edx
+ 414:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 418:	89 ca                	mov    %ecx,%edx
+ 41a:	89 c1                	mov    %eax,%ecx
+ 41c:	39 f2                	cmp    %esi,%edx
+ 41e:	73 df                	jae    3ff <printint+0x28>
+  if(neg)
+ 420:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 424:	74 08                	je     42e <printint+0x57>
+    buf[i++] = '-';
+ 426:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 42b:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 42e:	85 db                	test   %ebx,%ebx
+ 430:	7e 2a                	jle    45c <printint+0x85>
+ 432:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 435:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 439:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 43c:	0f b6 03             	movzbl (%ebx),%eax
+ 43f:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 442:	83 ec 04             	sub    $0x4,%esp
+ 445:	6a 01                	push   $0x1
+ 447:	57                   	push   %edi
+ 448:	ff 75 c4             	push   -0x3c(%ebp)
+ 44b:	e8 97 fe ff ff       	call   2e7 <write>
+  while(--i >= 0)
+ 450:	89 d8                	mov    %ebx,%eax
+ 452:	83 eb 01             	sub    $0x1,%ebx
+ 455:	83 c4 10             	add    $0x10,%esp
+ 458:	39 f0                	cmp    %esi,%eax
+ 45a:	75 e0                	jne    43c <printint+0x65>
+}
+ 45c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45f:	5b                   	pop    %ebx
+ 460:	5e                   	pop    %esi
+ 461:	5f                   	pop    %edi
+ 462:	5d                   	pop    %ebp
+ 463:	c3                   	ret
+    x = xx;
+ 464:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 466:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 46d:	eb 8b                	jmp    3fa <printint+0x23>
+
+0000046f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 46f:	55                   	push   %ebp
+ 470:	89 e5                	mov    %esp,%ebp
+ 472:	57                   	push   %edi
+ 473:	56                   	push   %esi
+ 474:	53                   	push   %ebx
+ 475:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 478:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 47b:	0f b6 1e             	movzbl (%esi),%ebx
+ 47e:	84 db                	test   %bl,%bl
+ 480:	0f 84 9e 01 00 00    	je     624 <printf+0x1b5>
+ 486:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 489:	8d 45 10             	lea    0x10(%ebp),%eax
+ 48c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 48f:	bf 00 00 00 00       	mov    $0x0,%edi
+ 494:	eb 2d                	jmp    4c3 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 496:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 499:	83 ec 04             	sub    $0x4,%esp
+ 49c:	6a 01                	push   $0x1
+ 49e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4a1:	50                   	push   %eax
+ 4a2:	ff 75 08             	push   0x8(%ebp)
+ 4a5:	e8 3d fe ff ff       	call   2e7 <write>
+        putc(fd, c);
+ 4aa:	83 c4 10             	add    $0x10,%esp
+ 4ad:	eb 05                	jmp    4b4 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4af:	83 ff 25             	cmp    $0x25,%edi
+ 4b2:	74 1f                	je     4d3 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4b4:	83 c6 01             	add    $0x1,%esi
+ 4b7:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4bb:	84 db                	test   %bl,%bl
+ 4bd:	0f 84 61 01 00 00    	je     624 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4c3:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4c6:	85 ff                	test   %edi,%edi
+ 4c8:	75 e5                	jne    4af <printf+0x40>
+      if(c == '%'){
+ 4ca:	83 f8 25             	cmp    $0x25,%eax
+ 4cd:	75 c7                	jne    496 <printf+0x27>
+        state = '%';
+ 4cf:	89 c7                	mov    %eax,%edi
+ 4d1:	eb e1                	jmp    4b4 <printf+0x45>
+      if(c == 'd'){
+ 4d3:	83 f8 25             	cmp    $0x25,%eax
+ 4d6:	0f 84 f4 00 00 00    	je     5d0 <printf+0x161>
+ 4dc:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4df:	83 fa 15             	cmp    $0x15,%edx
+ 4e2:	0f 87 09 01 00 00    	ja     5f1 <printf+0x182>
+ 4e8:	0f 87 03 01 00 00    	ja     5f1 <printf+0x182>
+ 4ee:	ff 24 95 f4 07 00 00 	jmp    *0x7f4(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 4f5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4f8:	8b 17                	mov    (%edi),%edx
+ 4fa:	83 ec 0c             	sub    $0xc,%esp
+ 4fd:	6a 01                	push   $0x1
+ 4ff:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 504:	8b 45 08             	mov    0x8(%ebp),%eax
+ 507:	e8 cb fe ff ff       	call   3d7 <printint>
+        ap++;
+ 50c:	83 c7 04             	add    $0x4,%edi
+ 50f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 512:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 515:	bf 00 00 00 00       	mov    $0x0,%edi
+ 51a:	eb 98                	jmp    4b4 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 51c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 51f:	8b 17                	mov    (%edi),%edx
+ 521:	83 ec 0c             	sub    $0xc,%esp
+ 524:	6a 00                	push   $0x0
+ 526:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 52b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52e:	e8 a4 fe ff ff       	call   3d7 <printint>
+        ap++;
+ 533:	83 c7 04             	add    $0x4,%edi
+ 536:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 539:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 53c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 541:	e9 6e ff ff ff       	jmp    4b4 <printf+0x45>
+        s = (char*)*ap;
+ 546:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 549:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 54b:	83 c1 04             	add    $0x4,%ecx
+ 54e:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 551:	85 c0                	test   %eax,%eax
+ 553:	74 13                	je     568 <printf+0xf9>
+        s = (char*)*ap;
+ 555:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 557:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 55a:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 55f:	84 c0                	test   %al,%al
+ 561:	75 0f                	jne    572 <printf+0x103>
+ 563:	e9 4c ff ff ff       	jmp    4b4 <printf+0x45>
+          s = "(null)";
+ 568:	bb ed 07 00 00       	mov    $0x7ed,%ebx
+        while(*s != 0){
+ 56d:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 572:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 575:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 578:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 57b:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 57e:	83 ec 04             	sub    $0x4,%esp
+ 581:	6a 01                	push   $0x1
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	e8 5d fd ff ff       	call   2e7 <write>
+          s++;
+ 58a:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 58d:	0f b6 03             	movzbl (%ebx),%eax
+ 590:	83 c4 10             	add    $0x10,%esp
+ 593:	84 c0                	test   %al,%al
+ 595:	75 e4                	jne    57b <printf+0x10c>
+      state = 0;
+ 597:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 59a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 59f:	e9 10 ff ff ff       	jmp    4b4 <printf+0x45>
+        putc(fd, *ap);
+ 5a4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5a7:	8b 07                	mov    (%edi),%eax
+ 5a9:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ac:	83 ec 04             	sub    $0x4,%esp
+ 5af:	6a 01                	push   $0x1
+ 5b1:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5b4:	50                   	push   %eax
+ 5b5:	ff 75 08             	push   0x8(%ebp)
+ 5b8:	e8 2a fd ff ff       	call   2e7 <write>
+        ap++;
+ 5bd:	83 c7 04             	add    $0x4,%edi
+ 5c0:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5c3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5c6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5cb:	e9 e4 fe ff ff       	jmp    4b4 <printf+0x45>
+        putc(fd, c);
+ 5d0:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5d3:	83 ec 04             	sub    $0x4,%esp
+ 5d6:	6a 01                	push   $0x1
+ 5d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5db:	50                   	push   %eax
+ 5dc:	ff 75 08             	push   0x8(%ebp)
+ 5df:	e8 03 fd ff ff       	call   2e7 <write>
+ 5e4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5e7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5ec:	e9 c3 fe ff ff       	jmp    4b4 <printf+0x45>
+        putc(fd, '%');
+ 5f1:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5f5:	83 ec 04             	sub    $0x4,%esp
+ 5f8:	6a 01                	push   $0x1
+ 5fa:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5fd:	57                   	push   %edi
+ 5fe:	ff 75 08             	push   0x8(%ebp)
+ 601:	e8 e1 fc ff ff       	call   2e7 <write>
+        putc(fd, c);
+ 606:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 609:	83 c4 0c             	add    $0xc,%esp
+ 60c:	6a 01                	push   $0x1
+ 60e:	57                   	push   %edi
+ 60f:	ff 75 08             	push   0x8(%ebp)
+ 612:	e8 d0 fc ff ff       	call   2e7 <write>
+        putc(fd, c);
+ 617:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 61f:	e9 90 fe ff ff       	jmp    4b4 <printf+0x45>
+    }
+  }
+}
+ 624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 627:	5b                   	pop    %ebx
+ 628:	5e                   	pop    %esi
+ 629:	5f                   	pop    %edi
+ 62a:	5d                   	pop    %ebp
+ 62b:	c3                   	ret
+
+0000062c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 62c:	55                   	push   %ebp
+ 62d:	89 e5                	mov    %esp,%ebp
+ 62f:	57                   	push   %edi
+ 630:	56                   	push   %esi
+ 631:	53                   	push   %ebx
+ 632:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 635:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 638:	a1 f0 0a 00 00       	mov    0xaf0,%eax
+ 63d:	eb 0c                	jmp    64b <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 63f:	8b 10                	mov    (%eax),%edx
+ 641:	39 d0                	cmp    %edx,%eax
+ 643:	72 04                	jb     649 <free+0x1d>
+ 645:	39 d1                	cmp    %edx,%ecx
+ 647:	72 10                	jb     659 <free+0x2d>
+{
+ 649:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 64b:	39 c8                	cmp    %ecx,%eax
+ 64d:	73 f0                	jae    63f <free+0x13>
+ 64f:	8b 10                	mov    (%eax),%edx
+ 651:	39 d1                	cmp    %edx,%ecx
+ 653:	72 04                	jb     659 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 655:	39 d0                	cmp    %edx,%eax
+ 657:	72 f0                	jb     649 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 659:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 65c:	8b 10                	mov    (%eax),%edx
+ 65e:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 661:	39 fa                	cmp    %edi,%edx
+ 663:	74 19                	je     67e <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 665:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 668:	8b 50 04             	mov    0x4(%eax),%edx
+ 66b:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 66e:	39 f1                	cmp    %esi,%ecx
+ 670:	74 18                	je     68a <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 672:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 674:	a3 f0 0a 00 00       	mov    %eax,0xaf0
+}
+ 679:	5b                   	pop    %ebx
+ 67a:	5e                   	pop    %esi
+ 67b:	5f                   	pop    %edi
+ 67c:	5d                   	pop    %ebp
+ 67d:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 67e:	03 72 04             	add    0x4(%edx),%esi
+ 681:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 684:	8b 10                	mov    (%eax),%edx
+ 686:	8b 12                	mov    (%edx),%edx
+ 688:	eb db                	jmp    665 <free+0x39>
+    p->s.size += bp->s.size;
+ 68a:	03 53 fc             	add    -0x4(%ebx),%edx
+ 68d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 690:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 693:	eb dd                	jmp    672 <free+0x46>
+
+00000695 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 695:	55                   	push   %ebp
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	57                   	push   %edi
+ 699:	56                   	push   %esi
+ 69a:	53                   	push   %ebx
+ 69b:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 69e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a1:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6a4:	c1 eb 03             	shr    $0x3,%ebx
+ 6a7:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6aa:	8b 15 f0 0a 00 00    	mov    0xaf0,%edx
+ 6b0:	85 d2                	test   %edx,%edx
+ 6b2:	74 1c                	je     6d0 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6b4:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6b6:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6b9:	39 d9                	cmp    %ebx,%ecx
+ 6bb:	73 38                	jae    6f5 <malloc+0x60>
+  if(nu < 4096)
+ 6bd:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6c2:	39 f3                	cmp    %esi,%ebx
+ 6c4:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6c7:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6ce:	eb 72                	jmp    742 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6d0:	c7 05 f0 0a 00 00 f4 	movl   $0xaf4,0xaf0
+ 6d7:	0a 00 00 
+ 6da:	c7 05 f4 0a 00 00 f4 	movl   $0xaf4,0xaf4
+ 6e1:	0a 00 00 
+    base.s.size = 0;
+ 6e4:	c7 05 f8 0a 00 00 00 	movl   $0x0,0xaf8
+ 6eb:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6ee:	b8 f4 0a 00 00       	mov    $0xaf4,%eax
+    if(p->s.size >= nunits){
+ 6f3:	eb c8                	jmp    6bd <malloc+0x28>
+      if(p->s.size == nunits)
+ 6f5:	39 cb                	cmp    %ecx,%ebx
+ 6f7:	74 1e                	je     717 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 6f9:	29 d9                	sub    %ebx,%ecx
+ 6fb:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 6fe:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 701:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 704:	89 15 f0 0a 00 00    	mov    %edx,0xaf0
+      return (void*)(p + 1);
+ 70a:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 70d:	89 d0                	mov    %edx,%eax
+ 70f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 712:	5b                   	pop    %ebx
+ 713:	5e                   	pop    %esi
+ 714:	5f                   	pop    %edi
+ 715:	5d                   	pop    %ebp
+ 716:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 717:	8b 08                	mov    (%eax),%ecx
+ 719:	89 0a                	mov    %ecx,(%edx)
+ 71b:	eb e7                	jmp    704 <malloc+0x6f>
+  hp->s.size = nu;
+ 71d:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 720:	83 ec 0c             	sub    $0xc,%esp
+ 723:	83 c0 08             	add    $0x8,%eax
+ 726:	50                   	push   %eax
+ 727:	e8 00 ff ff ff       	call   62c <free>
+  return freep;
+ 72c:	8b 15 f0 0a 00 00    	mov    0xaf0,%edx
+      if((p = morecore(nunits)) == 0)
+ 732:	83 c4 10             	add    $0x10,%esp
+ 735:	85 d2                	test   %edx,%edx
+ 737:	74 d4                	je     70d <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 739:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 73b:	8b 48 04             	mov    0x4(%eax),%ecx
+ 73e:	39 d9                	cmp    %ebx,%ecx
+ 740:	73 b3                	jae    6f5 <malloc+0x60>
+    if(p == freep)
+ 742:	89 c2                	mov    %eax,%edx
+ 744:	39 05 f0 0a 00 00    	cmp    %eax,0xaf0
+ 74a:	75 ed                	jne    739 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 74c:	83 ec 0c             	sub    $0xc,%esp
+ 74f:	57                   	push   %edi
+ 750:	e8 fa fb ff ff       	call   34f <sbrk>
+  if(p == (char*)-1)
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 75b:	75 c0                	jne    71d <malloc+0x88>
+        return 0;
+ 75d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 762:	eb a9                	jmp    70d <malloc+0x78>
@@ -0,0 +1,40 @@
+// Print physical memory use, in pages.
+//   memstat          system wide, and this process
+//   memstat pid...   system wide, and each listed process
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/memstat.h"
+#include "user.h"
+
+static void
+show(int pid)
+{
+  struct memstat ms;
+
+  if(memstat(pid, &ms) < 0){
+    printf(2, "memstat: no process %d\n", pid);
+    return;
+  }
+  printf(1, "pid %d: resident %d shared %d pgtab %d\n",
+         pid ? pid : getpid(), ms.resident, ms.pshared, ms.ppgtab);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct memstat ms;
+  int i;
+
+  if(memstat(0, &ms) < 0){
+    printf(2, "memstat: memstat failed\n");
+    exit();
+  }
+  printf(1, "total %d free %d used %d shared %d pgtab %d\n",
+         ms.total, ms.free, ms.used, ms.shared, ms.pgtab);
+  if(argc < 2)
+    show(0);
+  for(i = 1; i < argc; i++)
+    show(atoi(argv[i]));
+  exit();
+}
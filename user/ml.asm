@@ -0,0 +1,1243 @@
+
+_ml:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define STDIN  (0)
+#define STDOUT (1)
+#define STDERR (2)
+
+int main(int argc, char const *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 24             	sub    $0x24,%esp
+  mpkt_t pkt;
+  mflags_t *f = (mflags_t *)&pkt.flags;
+  printf(STDOUT, "Hello Mouse!\n");
+  13:	68 08 08 00 00       	push   $0x808
+  18:	6a 01                	push   $0x1
+  1a:	e8 f2 04 00 00       	call   511 <printf>
+  1f:	83 c4 10             	add    $0x10,%esp
+  while (1)
+  {
+    if (readmouse((char *)&pkt) == -1)  // System call
+  22:	8d 5d e5             	lea    -0x1b(%ebp),%ebx
+  25:	e9 8e 00 00 00       	jmp    b8 <main+0xb8>
+      return -1;
+    }
+    printf(STDOUT, "%x %x %x = ", pkt.flags, pkt.x_movement, pkt.y_movement);
+    printf(STDOUT, "%d%d %d%d %d %d%d%d -- %d %d ==> ", f->y_overflow, f->x_overflow, f->y_sign, f->x_sign, f->always1, f->middle_btn, f->right_btn, f->left_btn, pkt.x_movement, pkt.y_movement);
+    if (f->left_btn)
+      printf(STDOUT, "Left clicked, ");
+  2a:	83 ec 08             	sub    $0x8,%esp
+  2d:	68 29 08 00 00       	push   $0x829
+  32:	6a 01                	push   $0x1
+  34:	e8 d8 04 00 00       	call   511 <printf>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	e9 16 01 00 00       	jmp    157 <main+0x157>
+    if (f->middle_btn)
+      printf(STDOUT, "Middle clicked, ");
+  41:	83 ec 08             	sub    $0x8,%esp
+  44:	68 38 08 00 00       	push   $0x838
+  49:	6a 01                	push   $0x1
+  4b:	e8 c1 04 00 00       	call   511 <printf>
+  50:	83 c4 10             	add    $0x10,%esp
+  53:	e9 09 01 00 00       	jmp    161 <main+0x161>
+    if (f->right_btn)
+      printf(STDOUT, "Right clicked, ");
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 49 08 00 00       	push   $0x849
+  60:	6a 01                	push   $0x1
+  62:	e8 aa 04 00 00       	call   511 <printf>
+  67:	83 c4 10             	add    $0x10,%esp
+  6a:	e9 fc 00 00 00       	jmp    16b <main+0x16b>
+    if (pkt.x_movement || pkt.y_movement)
+    {
+      int x = f->x_sign ? (0xFFFFFF00 | pkt.x_movement) : (pkt.x_movement);
+  6f:	0f b6 4d e5          	movzbl -0x1b(%ebp),%ecx
+  73:	89 d6                	mov    %edx,%esi
+  75:	81 ce 00 ff ff ff    	or     $0xffffff00,%esi
+  7b:	0f b6 d2             	movzbl %dl,%edx
+  7e:	f6 c1 10             	test   $0x10,%cl
+  81:	0f 45 d6             	cmovne %esi,%edx
+      int y = f->y_sign ? (0xFFFFFF00 | pkt.y_movement) : (pkt.y_movement);
+  84:	89 c6                	mov    %eax,%esi
+  86:	81 ce 00 ff ff ff    	or     $0xffffff00,%esi
+  8c:	0f b6 c0             	movzbl %al,%eax
+  8f:	f6 c1 20             	test   $0x20,%cl
+  92:	0f 45 c6             	cmovne %esi,%eax
+      printf(STDOUT, "Move (%d, %d)", x, y);
+  95:	50                   	push   %eax
+  96:	52                   	push   %edx
+  97:	68 59 08 00 00       	push   $0x859
+  9c:	6a 01                	push   $0x1
+  9e:	e8 6e 04 00 00       	call   511 <printf>
+  a3:	83 c4 10             	add    $0x10,%esp
+    }
+    printf(STDOUT, "\n");
+  a6:	83 ec 08             	sub    $0x8,%esp
+  a9:	68 14 08 00 00       	push   $0x814
+  ae:	6a 01                	push   $0x1
+  b0:	e8 5c 04 00 00       	call   511 <printf>
+    if (readmouse((char *)&pkt) == -1)  // System call
+  b5:	83 c4 10             	add    $0x10,%esp
+  b8:	83 ec 0c             	sub    $0xc,%esp
+  bb:	53                   	push   %ebx
+  bc:	e8 48 03 00 00       	call   409 <readmouse>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  c7:	0f 84 b5 00 00 00    	je     182 <main+0x182>
+    printf(STDOUT, "%x %x %x = ", pkt.flags, pkt.x_movement, pkt.y_movement);
+  cd:	83 ec 0c             	sub    $0xc,%esp
+  d0:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+  d4:	50                   	push   %eax
+  d5:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  d9:	50                   	push   %eax
+  da:	0f b6 45 e5          	movzbl -0x1b(%ebp),%eax
+  de:	50                   	push   %eax
+  df:	68 1d 08 00 00       	push   $0x81d
+  e4:	6a 01                	push   $0x1
+  e6:	e8 26 04 00 00       	call   511 <printf>
+    printf(STDOUT, "%d%d %d%d %d %d%d%d -- %d %d ==> ", f->y_overflow, f->x_overflow, f->y_sign, f->x_sign, f->always1, f->middle_btn, f->right_btn, f->left_btn, pkt.x_movement, pkt.y_movement);
+  eb:	83 c4 20             	add    $0x20,%esp
+  ee:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+  f2:	50                   	push   %eax
+  f3:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  f7:	50                   	push   %eax
+  f8:	0f b6 45 e5          	movzbl -0x1b(%ebp),%eax
+  fc:	89 c2                	mov    %eax,%edx
+  fe:	83 e2 01             	and    $0x1,%edx
+ 101:	52                   	push   %edx
+ 102:	89 c2                	mov    %eax,%edx
+ 104:	d0 ea                	shr    %dl
+ 106:	83 e2 01             	and    $0x1,%edx
+ 109:	52                   	push   %edx
+ 10a:	89 c2                	mov    %eax,%edx
+ 10c:	c0 ea 02             	shr    $0x2,%dl
+ 10f:	83 e2 01             	and    $0x1,%edx
+ 112:	52                   	push   %edx
+ 113:	89 c2                	mov    %eax,%edx
+ 115:	c0 ea 03             	shr    $0x3,%dl
+ 118:	83 e2 01             	and    $0x1,%edx
+ 11b:	52                   	push   %edx
+ 11c:	89 c2                	mov    %eax,%edx
+ 11e:	c0 ea 04             	shr    $0x4,%dl
+ 121:	83 e2 01             	and    $0x1,%edx
+ 124:	52                   	push   %edx
+ 125:	89 c2                	mov    %eax,%edx
+ 127:	c0 ea 05             	shr    $0x5,%dl
+ 12a:	83 e2 01             	and    $0x1,%edx
+ 12d:	52                   	push   %edx
+ 12e:	89 c2                	mov    %eax,%edx
+ 130:	c0 ea 06             	shr    $0x6,%dl
+ 133:	83 e2 01             	and    $0x1,%edx
+ 136:	52                   	push   %edx
+ 137:	c0 e8 07             	shr    $0x7,%al
+ 13a:	0f b6 c0             	movzbl %al,%eax
+ 13d:	50                   	push   %eax
+ 13e:	68 68 08 00 00       	push   $0x868
+ 143:	6a 01                	push   $0x1
+ 145:	e8 c7 03 00 00       	call   511 <printf>
+    if (f->left_btn)
+ 14a:	83 c4 30             	add    $0x30,%esp
+ 14d:	f6 45 e5 01          	testb  $0x1,-0x1b(%ebp)
+ 151:	0f 85 d3 fe ff ff    	jne    2a <main+0x2a>
+    if (f->middle_btn)
+ 157:	f6 45 e5 04          	testb  $0x4,-0x1b(%ebp)
+ 15b:	0f 85 e0 fe ff ff    	jne    41 <main+0x41>
+    if (f->right_btn)
+ 161:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+ 165:	0f 85 ed fe ff ff    	jne    58 <main+0x58>
+    if (pkt.x_movement || pkt.y_movement)
+ 16b:	0f b6 55 e6          	movzbl -0x1a(%ebp),%edx
+ 16f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 173:	89 d1                	mov    %edx,%ecx
+ 175:	08 c1                	or     %al,%cl
+ 177:	0f 84 29 ff ff ff    	je     a6 <main+0xa6>
+ 17d:	e9 ed fe ff ff       	jmp    6f <main+0x6f>
+      printf(STDOUT, "ERROR\n");
+ 182:	83 ec 08             	sub    $0x8,%esp
+ 185:	68 16 08 00 00       	push   $0x816
+ 18a:	6a 01                	push   $0x1
+ 18c:	e8 80 03 00 00       	call   511 <printf>
+  }
+
+  return 0;
+}
+ 191:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 196:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 199:	59                   	pop    %ecx
+ 19a:	5b                   	pop    %ebx
+ 19b:	5e                   	pop    %esi
+ 19c:	5d                   	pop    %ebp
+ 19d:	8d 61 fc             	lea    -0x4(%ecx),%esp
+ 1a0:	c3                   	ret
+
+000001a1 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1a1:	55                   	push   %ebp
+ 1a2:	89 e5                	mov    %esp,%ebp
+ 1a4:	53                   	push   %ebx
+ 1a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1ab:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strcpy+0xf>
+    ;
+  return os;
+}
+ 1be:	89 c8                	mov    %ecx,%eax
+ 1c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c3:	c9                   	leave
+ 1c4:	c3                   	ret
+
+000001c5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1c5:	55                   	push   %ebp
+ 1c6:	89 e5                	mov    %esp,%ebp
+ 1c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 1ce:	0f b6 01             	movzbl (%ecx),%eax
+ 1d1:	84 c0                	test   %al,%al
+ 1d3:	74 11                	je     1e6 <strcmp+0x21>
+ 1d5:	38 02                	cmp    %al,(%edx)
+ 1d7:	75 0d                	jne    1e6 <strcmp+0x21>
+    p++, q++;
+ 1d9:	83 c1 01             	add    $0x1,%ecx
+ 1dc:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 1df:	0f b6 01             	movzbl (%ecx),%eax
+ 1e2:	84 c0                	test   %al,%al
+ 1e4:	75 ef                	jne    1d5 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 1e6:	0f b6 c0             	movzbl %al,%eax
+ 1e9:	0f b6 12             	movzbl (%edx),%edx
+ 1ec:	29 d0                	sub    %edx,%eax
+}
+ 1ee:	5d                   	pop    %ebp
+ 1ef:	c3                   	ret
+
+000001f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1f9:	74 14                	je     20f <strlen+0x1f>
+ 1fb:	b8 00 00 00 00       	mov    $0x0,%eax
+ 200:	83 c0 01             	add    $0x1,%eax
+ 203:	89 c1                	mov    %eax,%ecx
+ 205:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 209:	75 f5                	jne    200 <strlen+0x10>
+    ;
+  return n;
+}
+ 20b:	89 c8                	mov    %ecx,%eax
+ 20d:	5d                   	pop    %ebp
+ 20e:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 20f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 214:	eb f5                	jmp    20b <strlen+0x1b>
+
+00000216 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 216:	55                   	push   %ebp
+ 217:	89 e5                	mov    %esp,%ebp
+ 219:	57                   	push   %edi
+ 21a:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 222:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 225:	fc                   	cld
+ 226:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 228:	89 d0                	mov    %edx,%eax
+ 22a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 22d:	c9                   	leave
+ 22e:	c3                   	ret
+
+0000022f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 22f:	55                   	push   %ebp
+ 230:	89 e5                	mov    %esp,%ebp
+ 232:	8b 45 08             	mov    0x8(%ebp),%eax
+ 235:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 239:	0f b6 10             	movzbl (%eax),%edx
+ 23c:	84 d2                	test   %dl,%dl
+ 23e:	74 15                	je     255 <strchr+0x26>
+    if(*s == c)
+ 240:	38 d1                	cmp    %dl,%cl
+ 242:	74 0f                	je     253 <strchr+0x24>
+  for(; *s; s++)
+ 244:	83 c0 01             	add    $0x1,%eax
+ 247:	0f b6 10             	movzbl (%eax),%edx
+ 24a:	84 d2                	test   %dl,%dl
+ 24c:	75 f2                	jne    240 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 24e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 253:	5d                   	pop    %ebp
+ 254:	c3                   	ret
+  return 0;
+ 255:	b8 00 00 00 00       	mov    $0x0,%eax
+ 25a:	eb f7                	jmp    253 <strchr+0x24>
+
+0000025c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 25c:	55                   	push   %ebp
+ 25d:	89 e5                	mov    %esp,%ebp
+ 25f:	57                   	push   %edi
+ 260:	56                   	push   %esi
+ 261:	53                   	push   %ebx
+ 262:	83 ec 2c             	sub    $0x2c,%esp
+ 265:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 268:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 26d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 270:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 273:	83 c3 01             	add    $0x1,%ebx
+ 276:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 279:	7d 27                	jge    2a2 <gets+0x46>
+    cc = read(0, &c, 1);
+ 27b:	83 ec 04             	sub    $0x4,%esp
+ 27e:	6a 01                	push   $0x1
+ 280:	57                   	push   %edi
+ 281:	6a 00                	push   $0x0
+ 283:	e8 f9 00 00 00       	call   381 <read>
+    if(cc < 1)
+ 288:	83 c4 10             	add    $0x10,%esp
+ 28b:	85 c0                	test   %eax,%eax
+ 28d:	7e 13                	jle    2a2 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 28f:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 293:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 297:	3c 0a                	cmp    $0xa,%al
+ 299:	74 04                	je     29f <gets+0x43>
+ 29b:	3c 0d                	cmp    $0xd,%al
+ 29d:	75 d1                	jne    270 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 29f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 2a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2a5:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 2a9:	89 f0                	mov    %esi,%eax
+ 2ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ae:	5b                   	pop    %ebx
+ 2af:	5e                   	pop    %esi
+ 2b0:	5f                   	pop    %edi
+ 2b1:	5d                   	pop    %ebp
+ 2b2:	c3                   	ret
+
+000002b3 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2b3:	55                   	push   %ebp
+ 2b4:	89 e5                	mov    %esp,%ebp
+ 2b6:	56                   	push   %esi
+ 2b7:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2b8:	83 ec 08             	sub    $0x8,%esp
+ 2bb:	6a 00                	push   $0x0
+ 2bd:	ff 75 08             	push   0x8(%ebp)
+ 2c0:	e8 e4 00 00 00       	call   3a9 <open>
+  if(fd < 0)
+ 2c5:	83 c4 10             	add    $0x10,%esp
+ 2c8:	85 c0                	test   %eax,%eax
+ 2ca:	78 24                	js     2f0 <stat+0x3d>
+ 2cc:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2ce:	83 ec 08             	sub    $0x8,%esp
+ 2d1:	ff 75 0c             	push   0xc(%ebp)
+ 2d4:	50                   	push   %eax
+ 2d5:	e8 e7 00 00 00       	call   3c1 <fstat>
+ 2da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2dc:	89 1c 24             	mov    %ebx,(%esp)
+ 2df:	e8 ad 00 00 00       	call   391 <close>
+  return r;
+ 2e4:	83 c4 10             	add    $0x10,%esp
+}
+ 2e7:	89 f0                	mov    %esi,%eax
+ 2e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2ec:	5b                   	pop    %ebx
+ 2ed:	5e                   	pop    %esi
+ 2ee:	5d                   	pop    %ebp
+ 2ef:	c3                   	ret
+    return -1;
+ 2f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2f5:	eb f0                	jmp    2e7 <stat+0x34>
+
+000002f7 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f7:	55                   	push   %ebp
+ 2f8:	89 e5                	mov    %esp,%ebp
+ 2fa:	53                   	push   %ebx
+ 2fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2fe:	0f b6 02             	movzbl (%edx),%eax
+ 301:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 304:	80 f9 09             	cmp    $0x9,%cl
+ 307:	77 24                	ja     32d <atoi+0x36>
+  n = 0;
+ 309:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 30e:	83 c2 01             	add    $0x1,%edx
+ 311:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 314:	0f be c0             	movsbl %al,%eax
+ 317:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31b:	0f b6 02             	movzbl (%edx),%eax
+ 31e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 321:	80 fb 09             	cmp    $0x9,%bl
+ 324:	76 e8                	jbe    30e <atoi+0x17>
+  return n;
+}
+ 326:	89 c8                	mov    %ecx,%eax
+ 328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 32b:	c9                   	leave
+ 32c:	c3                   	ret
+  n = 0;
+ 32d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 332:	eb f2                	jmp    326 <atoi+0x2f>
+
+00000334 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 334:	55                   	push   %ebp
+ 335:	89 e5                	mov    %esp,%ebp
+ 337:	56                   	push   %esi
+ 338:	53                   	push   %ebx
+ 339:	8b 75 08             	mov    0x8(%ebp),%esi
+ 33c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 33f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 342:	85 db                	test   %ebx,%ebx
+ 344:	7e 15                	jle    35b <memmove+0x27>
+ 346:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 348:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 34a:	83 c2 01             	add    $0x1,%edx
+ 34d:	83 c0 01             	add    $0x1,%eax
+ 350:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 354:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 357:	39 c3                	cmp    %eax,%ebx
+ 359:	75 ef                	jne    34a <memmove+0x16>
+  return vdst;
+}
+ 35b:	89 f0                	mov    %esi,%eax
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5d                   	pop    %ebp
+ 360:	c3                   	ret
+
+00000361 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 361:	b8 01 00 00 00       	mov    $0x1,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <exit>:
+SYSCALL(exit)
+ 369:	b8 02 00 00 00       	mov    $0x2,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <wait>:
+SYSCALL(wait)
+ 371:	b8 03 00 00 00       	mov    $0x3,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <pipe>:
+SYSCALL(pipe)
+ 379:	b8 04 00 00 00       	mov    $0x4,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <read>:
+SYSCALL(read)
+ 381:	b8 05 00 00 00       	mov    $0x5,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <write>:
+SYSCALL(write)
+ 389:	b8 10 00 00 00       	mov    $0x10,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <close>:
+SYSCALL(close)
+ 391:	b8 15 00 00 00       	mov    $0x15,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <kill>:
+SYSCALL(kill)
+ 399:	b8 06 00 00 00       	mov    $0x6,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <exec>:
+SYSCALL(exec)
+ 3a1:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <open>:
+SYSCALL(open)
+ 3a9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <mknod>:
+SYSCALL(mknod)
+ 3b1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <unlink>:
+SYSCALL(unlink)
+ 3b9:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <fstat>:
+SYSCALL(fstat)
+ 3c1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <link>:
+SYSCALL(link)
+ 3c9:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <mkdir>:
+SYSCALL(mkdir)
+ 3d1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <chdir>:
+SYSCALL(chdir)
+ 3d9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <dup>:
+SYSCALL(dup)
+ 3e1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <getpid>:
+SYSCALL(getpid)
+ 3e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <sbrk>:
+SYSCALL(sbrk)
+ 3f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <sleep>:
+SYSCALL(sleep)
+ 3f9:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <uptime>:
+SYSCALL(uptime)
+ 401:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <readmouse>:
+SYSCALL(readmouse)
+ 409:	b8 16 00 00 00       	mov    $0x16,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <sigsend>:
+SYSCALL(sigsend)
+ 411:	b8 17 00 00 00       	mov    $0x17,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 419:	b8 18 00 00 00       	mov    $0x18,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <sigreturn>:
+SYSCALL(sigreturn)
+ 421:	b8 19 00 00 00       	mov    $0x19,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <siggetmask>:
+SYSCALL(siggetmask)
+ 429:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 431:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <sigpause>:
+SYSCALL(sigpause)
+ 439:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 441:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <sleeptick>:
+SYSCALL(sleeptick)
+ 449:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <schedctl>:
+SYSCALL(schedctl)
+ 451:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <nswtch>:
+SYSCALL(nswtch)
+ 459:	b8 20 00 00 00       	mov    $0x20,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <getloadavg>:
+SYSCALL(getloadavg)
+ 461:	b8 21 00 00 00       	mov    $0x21,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <memstat>:
+SYSCALL(memstat)
+ 469:	b8 22 00 00 00       	mov    $0x22,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <iostat>:
+SYSCALL(iostat)
+ 471:	b8 23 00 00 00       	mov    $0x23,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 479:	55                   	push   %ebp
+ 47a:	89 e5                	mov    %esp,%ebp
+ 47c:	57                   	push   %edi
+ 47d:	56                   	push   %esi
+ 47e:	53                   	push   %ebx
+ 47f:	83 ec 3c             	sub    $0x3c,%esp
+ 482:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 485:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 487:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 48b:	74 79                	je     506 <printint+0x8d>
+ 48d:	85 d2                	test   %edx,%edx
+ 48f:	79 75                	jns    506 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 491:	89 d1                	mov    %edx,%ecx
+ 493:	f7 d9                	neg    %ecx
+    neg = 1;
+ 495:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 49c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4a1:	89 df                	mov    %ebx,%edi
+ 4a3:	83 c3 01             	add    $0x1,%ebx
+ 4a6:	89 c8                	mov    %ecx,%eax
+ 4a8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4ad:	f7 f6                	div    %esi
+ 4af:	0f b6 92 ec 08 00 00 	movzbl 0x8ec(%edx),%edx
+ 4b6:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 4ba:	89 ca                	mov    %ecx,%edx
+ 4bc:	89 c1                	mov    %eax,%ecx
+ 4be:	39 f2                	cmp    %esi,%edx
+ 4c0:	73 df                	jae    4a1 <printint+0x28>
+  if(neg)
+ 4c2:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 4c6:	74 08                	je     4d0 <printint+0x57>
+    buf[i++] = '-';
+ 4c8:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4cd:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 4d0:	85 db                	test   %ebx,%ebx
+ 4d2:	7e 2a                	jle    4fe <printint+0x85>
+ 4d4:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 4d7:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 4db:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 4de:	0f b6 03             	movzbl (%ebx),%eax
+ 4e1:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 4e4:	83 ec 04             	sub    $0x4,%esp
+ 4e7:	6a 01                	push   $0x1
+ 4e9:	57                   	push   %edi
+ 4ea:	ff 75 c4             	push   -0x3c(%ebp)
+ 4ed:	e8 97 fe ff ff       	call   389 <write>
+  while(--i >= 0)
+ 4f2:	89 d8                	mov    %ebx,%eax
+ 4f4:	83 eb 01             	sub    $0x1,%ebx
+ 4f7:	83 c4 10             	add    $0x10,%esp
+ 4fa:	39 f0                	cmp    %esi,%eax
+ 4fc:	75 e0                	jne    4de <printint+0x65>
+}
+ 4fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 501:	5b                   	pop    %ebx
+ 502:	5e                   	pop    %esi
+ 503:	5f                   	pop    %edi
+ 504:	5d                   	pop    %ebp
+ 505:	c3                   	ret
+    x = xx;
+ 506:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 508:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 50f:	eb 8b                	jmp    49c <printint+0x23>
+
+00000511 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 511:	55                   	push   %ebp
+ 512:	89 e5                	mov    %esp,%ebp
+ 514:	57                   	push   %edi
+ 515:	56                   	push   %esi
+ 516:	53                   	push   %ebx
+ 517:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 51a:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 51d:	0f b6 1e             	movzbl (%esi),%ebx
+ 520:	84 db                	test   %bl,%bl
+ 522:	0f 84 9e 01 00 00    	je     6c6 <printf+0x1b5>
+ 528:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 52b:	8d 45 10             	lea    0x10(%ebp),%eax
+ 52e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 531:	bf 00 00 00 00       	mov    $0x0,%edi
+ 536:	eb 2d                	jmp    565 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 538:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 53b:	83 ec 04             	sub    $0x4,%esp
+ 53e:	6a 01                	push   $0x1
+ 540:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 543:	50                   	push   %eax
+ 544:	ff 75 08             	push   0x8(%ebp)
+ 547:	e8 3d fe ff ff       	call   389 <write>
+        putc(fd, c);
+ 54c:	83 c4 10             	add    $0x10,%esp
+ 54f:	eb 05                	jmp    556 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 551:	83 ff 25             	cmp    $0x25,%edi
+ 554:	74 1f                	je     575 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 556:	83 c6 01             	add    $0x1,%esi
+ 559:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 55d:	84 db                	test   %bl,%bl
+ 55f:	0f 84 61 01 00 00    	je     6c6 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 565:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 568:	85 ff                	test   %edi,%edi
+ 56a:	75 e5                	jne    551 <printf+0x40>
+      if(c == '%'){
+ 56c:	83 f8 25             	cmp    $0x25,%eax
+ 56f:	75 c7                	jne    538 <printf+0x27>
+        state = '%';
+ 571:	89 c7                	mov    %eax,%edi
+ 573:	eb e1                	jmp    556 <printf+0x45>
+      if(c == 'd'){
+ 575:	83 f8 25             	cmp    $0x25,%eax
+ 578:	0f 84 f4 00 00 00    	je     672 <printf+0x161>
+ 57e:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 581:	83 fa 15             	cmp    $0x15,%edx
+ 584:	0f 87 09 01 00 00    	ja     693 <printf+0x182>
+ 58a:	0f 87 03 01 00 00    	ja     693 <printf+0x182>
+ 590:	ff 24 95 94 08 00 00 	jmp    *0x894(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 597:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 59a:	8b 17                	mov    (%edi),%edx
+ 59c:	83 ec 0c             	sub    $0xc,%esp
+ 59f:	6a 01                	push   $0x1
+ 5a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a9:	e8 cb fe ff ff       	call   479 <printint>
+        ap++;
+ 5ae:	83 c7 04             	add    $0x4,%edi
+ 5b1:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5b4:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5b7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5bc:	eb 98                	jmp    556 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 5be:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5c1:	8b 17                	mov    (%edi),%edx
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	6a 00                	push   $0x0
+ 5c8:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d0:	e8 a4 fe ff ff       	call   479 <printint>
+        ap++;
+ 5d5:	83 c7 04             	add    $0x4,%edi
+ 5d8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5db:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5de:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e3:	e9 6e ff ff ff       	jmp    556 <printf+0x45>
+        s = (char*)*ap;
+ 5e8:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 5eb:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 5ed:	83 c1 04             	add    $0x4,%ecx
+ 5f0:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 5f3:	85 c0                	test   %eax,%eax
+ 5f5:	74 13                	je     60a <printf+0xf9>
+        s = (char*)*ap;
+ 5f7:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 5f9:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 5fc:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 601:	84 c0                	test   %al,%al
+ 603:	75 0f                	jne    614 <printf+0x103>
+ 605:	e9 4c ff ff ff       	jmp    556 <printf+0x45>
+          s = "(null)";
+ 60a:	bb 8a 08 00 00       	mov    $0x88a,%ebx
+        while(*s != 0){
+ 60f:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 614:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 617:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 61a:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 61d:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	6a 01                	push   $0x1
+ 625:	57                   	push   %edi
+ 626:	56                   	push   %esi
+ 627:	e8 5d fd ff ff       	call   389 <write>
+          s++;
+ 62c:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 62f:	0f b6 03             	movzbl (%ebx),%eax
+ 632:	83 c4 10             	add    $0x10,%esp
+ 635:	84 c0                	test   %al,%al
+ 637:	75 e4                	jne    61d <printf+0x10c>
+      state = 0;
+ 639:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 63c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 641:	e9 10 ff ff ff       	jmp    556 <printf+0x45>
+        putc(fd, *ap);
+ 646:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 649:	8b 07                	mov    (%edi),%eax
+ 64b:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 64e:	83 ec 04             	sub    $0x4,%esp
+ 651:	6a 01                	push   $0x1
+ 653:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 656:	50                   	push   %eax
+ 657:	ff 75 08             	push   0x8(%ebp)
+ 65a:	e8 2a fd ff ff       	call   389 <write>
+        ap++;
+ 65f:	83 c7 04             	add    $0x4,%edi
+ 662:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 665:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 668:	bf 00 00 00 00       	mov    $0x0,%edi
+ 66d:	e9 e4 fe ff ff       	jmp    556 <printf+0x45>
+        putc(fd, c);
+ 672:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 675:	83 ec 04             	sub    $0x4,%esp
+ 678:	6a 01                	push   $0x1
+ 67a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 67d:	50                   	push   %eax
+ 67e:	ff 75 08             	push   0x8(%ebp)
+ 681:	e8 03 fd ff ff       	call   389 <write>
+ 686:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 689:	bf 00 00 00 00       	mov    $0x0,%edi
+ 68e:	e9 c3 fe ff ff       	jmp    556 <printf+0x45>
+        putc(fd, '%');
+ 693:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 697:	83 ec 04             	sub    $0x4,%esp
+ 69a:	6a 01                	push   $0x1
+ 69c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 69f:	57                   	push   %edi
+ 6a0:	ff 75 08             	push   0x8(%ebp)
+ 6a3:	e8 e1 fc ff ff       	call   389 <write>
+        putc(fd, c);
+ 6a8:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6ab:	83 c4 0c             	add    $0xc,%esp
+ 6ae:	6a 01                	push   $0x1
+ 6b0:	57                   	push   %edi
+ 6b1:	ff 75 08             	push   0x8(%ebp)
+ 6b4:	e8 d0 fc ff ff       	call   389 <write>
+        putc(fd, c);
+ 6b9:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bc:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6c1:	e9 90 fe ff ff       	jmp    556 <printf+0x45>
+    }
+  }
+}
+ 6c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6c9:	5b                   	pop    %ebx
+ 6ca:	5e                   	pop    %esi
+ 6cb:	5f                   	pop    %edi
+ 6cc:	5d                   	pop    %ebp
+ 6cd:	c3                   	ret
+
+000006ce <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6ce:	55                   	push   %ebp
+ 6cf:	89 e5                	mov    %esp,%ebp
+ 6d1:	57                   	push   %edi
+ 6d2:	56                   	push   %esi
+ 6d3:	53                   	push   %ebx
+ 6d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6d7:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6da:	a1 6c 0b 00 00       	mov    0xb6c,%eax
+ 6df:	eb 0c                	jmp    6ed <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e1:	8b 10                	mov    (%eax),%edx
+ 6e3:	39 d0                	cmp    %edx,%eax
+ 6e5:	72 04                	jb     6eb <free+0x1d>
+ 6e7:	39 d1                	cmp    %edx,%ecx
+ 6e9:	72 10                	jb     6fb <free+0x2d>
+{
+ 6eb:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ed:	39 c8                	cmp    %ecx,%eax
+ 6ef:	73 f0                	jae    6e1 <free+0x13>
+ 6f1:	8b 10                	mov    (%eax),%edx
+ 6f3:	39 d1                	cmp    %edx,%ecx
+ 6f5:	72 04                	jb     6fb <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f7:	39 d0                	cmp    %edx,%eax
+ 6f9:	72 f0                	jb     6eb <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6fb:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6fe:	8b 10                	mov    (%eax),%edx
+ 700:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 703:	39 fa                	cmp    %edi,%edx
+ 705:	74 19                	je     720 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 707:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 70a:	8b 50 04             	mov    0x4(%eax),%edx
+ 70d:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 710:	39 f1                	cmp    %esi,%ecx
+ 712:	74 18                	je     72c <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 714:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 716:	a3 6c 0b 00 00       	mov    %eax,0xb6c
+}
+ 71b:	5b                   	pop    %ebx
+ 71c:	5e                   	pop    %esi
+ 71d:	5f                   	pop    %edi
+ 71e:	5d                   	pop    %ebp
+ 71f:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 720:	03 72 04             	add    0x4(%edx),%esi
+ 723:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 726:	8b 10                	mov    (%eax),%edx
+ 728:	8b 12                	mov    (%edx),%edx
+ 72a:	eb db                	jmp    707 <free+0x39>
+    p->s.size += bp->s.size;
+ 72c:	03 53 fc             	add    -0x4(%ebx),%edx
+ 72f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 732:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 735:	eb dd                	jmp    714 <free+0x46>
+
+00000737 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 737:	55                   	push   %ebp
+ 738:	89 e5                	mov    %esp,%ebp
+ 73a:	57                   	push   %edi
+ 73b:	56                   	push   %esi
+ 73c:	53                   	push   %ebx
+ 73d:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 740:	8b 45 08             	mov    0x8(%ebp),%eax
+ 743:	8d 58 07             	lea    0x7(%eax),%ebx
+ 746:	c1 eb 03             	shr    $0x3,%ebx
+ 749:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 74c:	8b 15 6c 0b 00 00    	mov    0xb6c,%edx
+ 752:	85 d2                	test   %edx,%edx
+ 754:	74 1c                	je     772 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 756:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 758:	8b 48 04             	mov    0x4(%eax),%ecx
+ 75b:	39 d9                	cmp    %ebx,%ecx
+ 75d:	73 38                	jae    797 <malloc+0x60>
+  if(nu < 4096)
+ 75f:	be 00 10 00 00       	mov    $0x1000,%esi
+ 764:	39 f3                	cmp    %esi,%ebx
+ 766:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 769:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 770:	eb 72                	jmp    7e4 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 772:	c7 05 6c 0b 00 00 70 	movl   $0xb70,0xb6c
+ 779:	0b 00 00 
+ 77c:	c7 05 70 0b 00 00 70 	movl   $0xb70,0xb70
+ 783:	0b 00 00 
+    base.s.size = 0;
+ 786:	c7 05 74 0b 00 00 00 	movl   $0x0,0xb74
+ 78d:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 790:	b8 70 0b 00 00       	mov    $0xb70,%eax
+    if(p->s.size >= nunits){
+ 795:	eb c8                	jmp    75f <malloc+0x28>
+      if(p->s.size == nunits)
+ 797:	39 cb                	cmp    %ecx,%ebx
+ 799:	74 1e                	je     7b9 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 79b:	29 d9                	sub    %ebx,%ecx
+ 79d:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7a0:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7a3:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7a6:	89 15 6c 0b 00 00    	mov    %edx,0xb6c
+      return (void*)(p + 1);
+ 7ac:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7af:	89 d0                	mov    %edx,%eax
+ 7b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7b4:	5b                   	pop    %ebx
+ 7b5:	5e                   	pop    %esi
+ 7b6:	5f                   	pop    %edi
+ 7b7:	5d                   	pop    %ebp
+ 7b8:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7b9:	8b 08                	mov    (%eax),%ecx
+ 7bb:	89 0a                	mov    %ecx,(%edx)
+ 7bd:	eb e7                	jmp    7a6 <malloc+0x6f>
+  hp->s.size = nu;
+ 7bf:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 7c2:	83 ec 0c             	sub    $0xc,%esp
+ 7c5:	83 c0 08             	add    $0x8,%eax
+ 7c8:	50                   	push   %eax
+ 7c9:	e8 00 ff ff ff       	call   6ce <free>
+  return freep;
+ 7ce:	8b 15 6c 0b 00 00    	mov    0xb6c,%edx
+      if((p = morecore(nunits)) == 0)
+ 7d4:	83 c4 10             	add    $0x10,%esp
+ 7d7:	85 d2                	test   %edx,%edx
+ 7d9:	74 d4                	je     7af <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7db:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7dd:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7e0:	39 d9                	cmp    %ebx,%ecx
+ 7e2:	73 b3                	jae    797 <malloc+0x60>
+    if(p == freep)
+ 7e4:	89 c2                	mov    %eax,%edx
+ 7e6:	39 05 6c 0b 00 00    	cmp    %eax,0xb6c
+ 7ec:	75 ed                	jne    7db <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 7ee:	83 ec 0c             	sub    $0xc,%esp
+ 7f1:	57                   	push   %edi
+ 7f2:	e8 fa fb ff ff       	call   3f1 <sbrk>
+  if(p == (char*)-1)
+ 7f7:	83 c4 10             	add    $0x10,%esp
+ 7fa:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7fd:	75 c0                	jne    7bf <malloc+0x88>
+        return 0;
+ 7ff:	ba 00 00 00 00       	mov    $0x0,%edx
+ 804:	eb a9                	jmp    7af <malloc+0x78>
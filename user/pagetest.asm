@@ -0,0 +1,1140 @@
+
+_pagetest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/stat.h"
+#include "user.h"
+
+#define PROCNUM 50 // Would effectively make 100 children (100 forks)
+
+int main(){
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+    printf(1, "");
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	68 18 07 00 00       	push   $0x718
+  17:	6a 01                	push   $0x1
+  19:	e8 ee 03 00 00       	call   40c <printf>
+    int something[2000]={1};
+    printf(1, "USERPROCsomething%d\n", something[2]);
+  1e:	83 c4 0c             	add    $0xc,%esp
+  21:	6a 00                	push   $0x0
+  23:	68 04 07 00 00       	push   $0x704
+  28:	6a 01                	push   $0x1
+  2a:	e8 dd 03 00 00       	call   40c <printf>
+  2f:	83 c4 10             	add    $0x10,%esp
+  32:	bb 32 00 00 00       	mov    $0x32,%ebx
+    for(int i=0; i<PROCNUM; i++){
+        if((fork())==0){
+  37:	e8 20 02 00 00       	call   25c <fork>
+  3c:	85 c0                	test   %eax,%eax
+  3e:	74 38                	je     78 <main+0x78>
+            something[2]=3;
+            sleep(2000);
+            exit();
+        }
+        sleep(2000);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  43:	68 d0 07 00 00       	push   $0x7d0
+  48:	e8 a7 02 00 00       	call   2f4 <sleep>
+        if((fork())==0){
+  4d:	e8 0a 02 00 00       	call   25c <fork>
+  52:	83 c4 10             	add    $0x10,%esp
+  55:	85 c0                	test   %eax,%eax
+  57:	74 31                	je     8a <main+0x8a>
+            sleep(2000);
+            exit();
+        }
+        sleep(2000);
+  59:	83 ec 0c             	sub    $0xc,%esp
+  5c:	68 d0 07 00 00       	push   $0x7d0
+  61:	e8 8e 02 00 00       	call   2f4 <sleep>
+    for(int i=0; i<PROCNUM; i++){
+  66:	83 c4 10             	add    $0x10,%esp
+  69:	83 eb 01             	sub    $0x1,%ebx
+  6c:	75 c9                	jne    37 <main+0x37>
+    }
+    fork();
+  6e:	e8 e9 01 00 00       	call   25c <fork>
+    exit();
+  73:	e8 ec 01 00 00       	call   264 <exit>
+            sleep(2000);
+  78:	83 ec 0c             	sub    $0xc,%esp
+  7b:	68 d0 07 00 00       	push   $0x7d0
+  80:	e8 6f 02 00 00       	call   2f4 <sleep>
+            exit();
+  85:	e8 da 01 00 00       	call   264 <exit>
+            sleep(2000);
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	68 d0 07 00 00       	push   $0x7d0
+  92:	e8 5d 02 00 00       	call   2f4 <sleep>
+            exit();
+  97:	e8 c8 01 00 00       	call   264 <exit>
+
+0000009c <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  9c:	55                   	push   %ebp
+  9d:	89 e5                	mov    %esp,%ebp
+  9f:	53                   	push   %ebx
+  a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  ab:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  af:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  b2:	83 c0 01             	add    $0x1,%eax
+  b5:	84 d2                	test   %dl,%dl
+  b7:	75 f2                	jne    ab <strcpy+0xf>
+    ;
+  return os;
+}
+  b9:	89 c8                	mov    %ecx,%eax
+  bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  be:	c9                   	leave
+  bf:	c3                   	ret
+
+000000c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  c9:	0f b6 01             	movzbl (%ecx),%eax
+  cc:	84 c0                	test   %al,%al
+  ce:	74 11                	je     e1 <strcmp+0x21>
+  d0:	38 02                	cmp    %al,(%edx)
+  d2:	75 0d                	jne    e1 <strcmp+0x21>
+    p++, q++;
+  d4:	83 c1 01             	add    $0x1,%ecx
+  d7:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  da:	0f b6 01             	movzbl (%ecx),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 ef                	jne    d0 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  e1:	0f b6 c0             	movzbl %al,%eax
+  e4:	0f b6 12             	movzbl (%edx),%edx
+  e7:	29 d0                	sub    %edx,%eax
+}
+  e9:	5d                   	pop    %ebp
+  ea:	c3                   	ret
+
+000000eb <strlen>:
+
+uint
+strlen(char *s)
+{
+  eb:	55                   	push   %ebp
+  ec:	89 e5                	mov    %esp,%ebp
+  ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f1:	80 3a 00             	cmpb   $0x0,(%edx)
+  f4:	74 14                	je     10a <strlen+0x1f>
+  f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  fb:	83 c0 01             	add    $0x1,%eax
+  fe:	89 c1                	mov    %eax,%ecx
+ 100:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 104:	75 f5                	jne    fb <strlen+0x10>
+    ;
+  return n;
+}
+ 106:	89 c8                	mov    %ecx,%eax
+ 108:	5d                   	pop    %ebp
+ 109:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 10a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 10f:	eb f5                	jmp    106 <strlen+0x1b>
+
+00000111 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 111:	55                   	push   %ebp
+ 112:	89 e5                	mov    %esp,%ebp
+ 114:	57                   	push   %edi
+ 115:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 118:	89 d7                	mov    %edx,%edi
+ 11a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 11d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 120:	fc                   	cld
+ 121:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 123:	89 d0                	mov    %edx,%eax
+ 125:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 128:	c9                   	leave
+ 129:	c3                   	ret
+
+0000012a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 12a:	55                   	push   %ebp
+ 12b:	89 e5                	mov    %esp,%ebp
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 134:	0f b6 10             	movzbl (%eax),%edx
+ 137:	84 d2                	test   %dl,%dl
+ 139:	74 15                	je     150 <strchr+0x26>
+    if(*s == c)
+ 13b:	38 d1                	cmp    %dl,%cl
+ 13d:	74 0f                	je     14e <strchr+0x24>
+  for(; *s; s++)
+ 13f:	83 c0 01             	add    $0x1,%eax
+ 142:	0f b6 10             	movzbl (%eax),%edx
+ 145:	84 d2                	test   %dl,%dl
+ 147:	75 f2                	jne    13b <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 149:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 14e:	5d                   	pop    %ebp
+ 14f:	c3                   	ret
+  return 0;
+ 150:	b8 00 00 00 00       	mov    $0x0,%eax
+ 155:	eb f7                	jmp    14e <strchr+0x24>
+
+00000157 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 157:	55                   	push   %ebp
+ 158:	89 e5                	mov    %esp,%ebp
+ 15a:	57                   	push   %edi
+ 15b:	56                   	push   %esi
+ 15c:	53                   	push   %ebx
+ 15d:	83 ec 2c             	sub    $0x2c,%esp
+ 160:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 163:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 168:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 16b:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 16e:	83 c3 01             	add    $0x1,%ebx
+ 171:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 174:	7d 27                	jge    19d <gets+0x46>
+    cc = read(0, &c, 1);
+ 176:	83 ec 04             	sub    $0x4,%esp
+ 179:	6a 01                	push   $0x1
+ 17b:	57                   	push   %edi
+ 17c:	6a 00                	push   $0x0
+ 17e:	e8 f9 00 00 00       	call   27c <read>
+    if(cc < 1)
+ 183:	83 c4 10             	add    $0x10,%esp
+ 186:	85 c0                	test   %eax,%eax
+ 188:	7e 13                	jle    19d <gets+0x46>
+      break;
+    buf[i++] = c;
+ 18a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 18e:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 192:	3c 0a                	cmp    $0xa,%al
+ 194:	74 04                	je     19a <gets+0x43>
+ 196:	3c 0d                	cmp    $0xd,%al
+ 198:	75 d1                	jne    16b <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 19a:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 19d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1a0:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1a4:	89 f0                	mov    %esi,%eax
+ 1a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1a9:	5b                   	pop    %ebx
+ 1aa:	5e                   	pop    %esi
+ 1ab:	5f                   	pop    %edi
+ 1ac:	5d                   	pop    %ebp
+ 1ad:	c3                   	ret
+
+000001ae <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	56                   	push   %esi
+ 1b2:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b3:	83 ec 08             	sub    $0x8,%esp
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	ff 75 08             	push   0x8(%ebp)
+ 1bb:	e8 e4 00 00 00       	call   2a4 <open>
+  if(fd < 0)
+ 1c0:	83 c4 10             	add    $0x10,%esp
+ 1c3:	85 c0                	test   %eax,%eax
+ 1c5:	78 24                	js     1eb <stat+0x3d>
+ 1c7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	50                   	push   %eax
+ 1d0:	e8 e7 00 00 00       	call   2bc <fstat>
+ 1d5:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+ 1da:	e8 ad 00 00 00       	call   28c <close>
+  return r;
+ 1df:	83 c4 10             	add    $0x10,%esp
+}
+ 1e2:	89 f0                	mov    %esi,%eax
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	5b                   	pop    %ebx
+ 1e8:	5e                   	pop    %esi
+ 1e9:	5d                   	pop    %ebp
+ 1ea:	c3                   	ret
+    return -1;
+ 1eb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f0:	eb f0                	jmp    1e2 <stat+0x34>
+
+000001f2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f2:	55                   	push   %ebp
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 1f9:	0f b6 02             	movzbl (%edx),%eax
+ 1fc:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1ff:	80 f9 09             	cmp    $0x9,%cl
+ 202:	77 24                	ja     228 <atoi+0x36>
+  n = 0;
+ 204:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 209:	83 c2 01             	add    $0x1,%edx
+ 20c:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 20f:	0f be c0             	movsbl %al,%eax
+ 212:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 216:	0f b6 02             	movzbl (%edx),%eax
+ 219:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 21c:	80 fb 09             	cmp    $0x9,%bl
+ 21f:	76 e8                	jbe    209 <atoi+0x17>
+  return n;
+}
+ 221:	89 c8                	mov    %ecx,%eax
+ 223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+  n = 0;
+ 228:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 22d:	eb f2                	jmp    221 <atoi+0x2f>
+
+0000022f <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 22f:	55                   	push   %ebp
+ 230:	89 e5                	mov    %esp,%ebp
+ 232:	56                   	push   %esi
+ 233:	53                   	push   %ebx
+ 234:	8b 75 08             	mov    0x8(%ebp),%esi
+ 237:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 23a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 23d:	85 db                	test   %ebx,%ebx
+ 23f:	7e 15                	jle    256 <memmove+0x27>
+ 241:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 243:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 245:	83 c2 01             	add    $0x1,%edx
+ 248:	83 c0 01             	add    $0x1,%eax
+ 24b:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 24f:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 252:	39 c3                	cmp    %eax,%ebx
+ 254:	75 ef                	jne    245 <memmove+0x16>
+  return vdst;
+}
+ 256:	89 f0                	mov    %esi,%eax
+ 258:	5b                   	pop    %ebx
+ 259:	5e                   	pop    %esi
+ 25a:	5d                   	pop    %ebp
+ 25b:	c3                   	ret
+
+0000025c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 25c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 261:	cd 40                	int    $0x40
+ 263:	c3                   	ret
+
+00000264 <exit>:
+SYSCALL(exit)
+ 264:	b8 02 00 00 00       	mov    $0x2,%eax
+ 269:	cd 40                	int    $0x40
+ 26b:	c3                   	ret
+
+0000026c <wait>:
+SYSCALL(wait)
+ 26c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 271:	cd 40                	int    $0x40
+ 273:	c3                   	ret
+
+00000274 <pipe>:
+SYSCALL(pipe)
+ 274:	b8 04 00 00 00       	mov    $0x4,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+0000027c <read>:
+SYSCALL(read)
+ 27c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+00000284 <write>:
+SYSCALL(write)
+ 284:	b8 10 00 00 00       	mov    $0x10,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+0000028c <close>:
+SYSCALL(close)
+ 28c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+00000294 <kill>:
+SYSCALL(kill)
+ 294:	b8 06 00 00 00       	mov    $0x6,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+0000029c <exec>:
+SYSCALL(exec)
+ 29c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+000002a4 <open>:
+SYSCALL(open)
+ 2a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+000002ac <mknod>:
+SYSCALL(mknod)
+ 2ac:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+000002b4 <unlink>:
+SYSCALL(unlink)
+ 2b4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
+
+000002bc <fstat>:
+SYSCALL(fstat)
+ 2bc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2c1:	cd 40                	int    $0x40
+ 2c3:	c3                   	ret
+
+000002c4 <link>:
+SYSCALL(link)
+ 2c4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2c9:	cd 40                	int    $0x40
+ 2cb:	c3                   	ret
+
+000002cc <mkdir>:
+SYSCALL(mkdir)
+ 2cc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2d1:	cd 40                	int    $0x40
+ 2d3:	c3                   	ret
+
+000002d4 <chdir>:
+SYSCALL(chdir)
+ 2d4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2d9:	cd 40                	int    $0x40
+ 2db:	c3                   	ret
+
+000002dc <dup>:
+SYSCALL(dup)
+ 2dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2e1:	cd 40                	int    $0x40
+ 2e3:	c3                   	ret
+
+000002e4 <getpid>:
+SYSCALL(getpid)
+ 2e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2e9:	cd 40                	int    $0x40
+ 2eb:	c3                   	ret
+
+000002ec <sbrk>:
+SYSCALL(sbrk)
+ 2ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2f1:	cd 40                	int    $0x40
+ 2f3:	c3                   	ret
+
+000002f4 <sleep>:
+SYSCALL(sleep)
+ 2f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2f9:	cd 40                	int    $0x40
+ 2fb:	c3                   	ret
+
+000002fc <uptime>:
+SYSCALL(uptime)
+ 2fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 301:	cd 40                	int    $0x40
+ 303:	c3                   	ret
+
+00000304 <readmouse>:
+SYSCALL(readmouse)
+ 304:	b8 16 00 00 00       	mov    $0x16,%eax
+ 309:	cd 40                	int    $0x40
+ 30b:	c3                   	ret
+
+0000030c <sigsend>:
+SYSCALL(sigsend)
+ 30c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 311:	cd 40                	int    $0x40
+ 313:	c3                   	ret
+
+00000314 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 314:	b8 18 00 00 00       	mov    $0x18,%eax
+ 319:	cd 40                	int    $0x40
+ 31b:	c3                   	ret
+
+0000031c <sigreturn>:
+SYSCALL(sigreturn)
+ 31c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 321:	cd 40                	int    $0x40
+ 323:	c3                   	ret
+
+00000324 <siggetmask>:
+SYSCALL(siggetmask)
+ 324:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 329:	cd 40                	int    $0x40
+ 32b:	c3                   	ret
+
+0000032c <sigsetmask>:
+SYSCALL(sigsetmask)
+ 32c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 331:	cd 40                	int    $0x40
+ 333:	c3                   	ret
+
+00000334 <sigpause>:
+SYSCALL(sigpause)
+ 334:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 339:	cd 40                	int    $0x40
+ 33b:	c3                   	ret
+
+0000033c <predict_cpu>:
+SYSCALL(predict_cpu)
+ 33c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 341:	cd 40                	int    $0x40
+ 343:	c3                   	ret
+
+00000344 <sleeptick>:
+SYSCALL(sleeptick)
+ 344:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 349:	cd 40                	int    $0x40
+ 34b:	c3                   	ret
+
+0000034c <schedctl>:
+SYSCALL(schedctl)
+ 34c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 351:	cd 40                	int    $0x40
+ 353:	c3                   	ret
+
+00000354 <nswtch>:
+SYSCALL(nswtch)
+ 354:	b8 20 00 00 00       	mov    $0x20,%eax
+ 359:	cd 40                	int    $0x40
+ 35b:	c3                   	ret
+
+0000035c <getloadavg>:
+SYSCALL(getloadavg)
+ 35c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 361:	cd 40                	int    $0x40
+ 363:	c3                   	ret
+
+00000364 <memstat>:
+SYSCALL(memstat)
+ 364:	b8 22 00 00 00       	mov    $0x22,%eax
+ 369:	cd 40                	int    $0x40
+ 36b:	c3                   	ret
+
+0000036c <iostat>:
+SYSCALL(iostat)
+ 36c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 371:	cd 40                	int    $0x40
+ 373:	c3                   	ret
+
+00000374 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 374:	55                   	push   %ebp
+ 375:	89 e5                	mov    %esp,%ebp
+ 377:	57                   	push   %edi
+ 378:	56                   	push   %esi
+ 379:	53                   	push   %ebx
+ 37a:	83 ec 3c             	sub    $0x3c,%esp
+ 37d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 380:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 382:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 386:	74 79                	je     401 <printint+0x8d>
+ 388:	85 d2                	test   %edx,%edx
+ 38a:	79 75                	jns    401 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 38c:	89 d1                	mov    %edx,%ecx
+ 38e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 390:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 397:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 39c:	89 df                	mov    %ebx,%edi
+ 39e:	83 c3 01             	add    $0x1,%ebx
+ 3a1:	89 c8                	mov    %ecx,%eax
+ 3a3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3a8:	f7 f6                	div    %esi
+ 3aa:	0f b6 92 78 07 00 00 	movzbl 0x778(%edx),%edx
+ 3b1:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 3b5:	89 ca                	mov    %ecx,%edx
+ 3b7:	89 c1                	mov    %eax,%ecx
+ 3b9:	39 f2                	cmp    %esi,%edx
+ 3bb:	73 df                	jae    39c <printint+0x28>
+  if(neg)
+ 3bd:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 3c1:	74 08                	je     3cb <printint+0x57>
+    buf[i++] = '-';
+ 3c3:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 3c8:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 3cb:	85 db                	test   %ebx,%ebx
+ 3cd:	7e 2a                	jle    3f9 <printint+0x85>
+ 3cf:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 3d2:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 3d6:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 3d9:	0f b6 03             	movzbl (%ebx),%eax
+ 3dc:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 3df:	83 ec 04             	sub    $0x4,%esp
+ 3e2:	6a 01                	push   $0x1
+ 3e4:	57                   	push   %edi
+ 3e5:	ff 75 c4             	push   -0x3c(%ebp)
+ 3e8:	e8 97 fe ff ff       	call   284 <write>
+  while(--i >= 0)
+ 3ed:	89 d8                	mov    %ebx,%eax
+ 3ef:	83 eb 01             	sub    $0x1,%ebx
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	39 f0                	cmp    %esi,%eax
+ 3f7:	75 e0                	jne    3d9 <printint+0x65>
+}
+ 3f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fc:	5b                   	pop    %ebx
+ 3fd:	5e                   	pop    %esi
+ 3fe:	5f                   	pop    %edi
+ 3ff:	5d                   	pop    %ebp
+ 400:	c3                   	ret
+    x = xx;
+ 401:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 403:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 40a:	eb 8b                	jmp    397 <printint+0x23>
+
+0000040c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 40c:	55                   	push   %ebp
+ 40d:	89 e5                	mov    %esp,%ebp
+ 40f:	57                   	push   %edi
+ 410:	56                   	push   %esi
+ 411:	53                   	push   %ebx
+ 412:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 415:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 418:	0f b6 1e             	movzbl (%esi),%ebx
+ 41b:	84 db                	test   %bl,%bl
+ 41d:	0f 84 9e 01 00 00    	je     5c1 <printf+0x1b5>
+ 423:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 426:	8d 45 10             	lea    0x10(%ebp),%eax
+ 429:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 42c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 431:	eb 2d                	jmp    460 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 433:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 436:	83 ec 04             	sub    $0x4,%esp
+ 439:	6a 01                	push   $0x1
+ 43b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 43e:	50                   	push   %eax
+ 43f:	ff 75 08             	push   0x8(%ebp)
+ 442:	e8 3d fe ff ff       	call   284 <write>
+        putc(fd, c);
+ 447:	83 c4 10             	add    $0x10,%esp
+ 44a:	eb 05                	jmp    451 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 44c:	83 ff 25             	cmp    $0x25,%edi
+ 44f:	74 1f                	je     470 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 451:	83 c6 01             	add    $0x1,%esi
+ 454:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 458:	84 db                	test   %bl,%bl
+ 45a:	0f 84 61 01 00 00    	je     5c1 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 460:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 463:	85 ff                	test   %edi,%edi
+ 465:	75 e5                	jne    44c <printf+0x40>
+      if(c == '%'){
+ 467:	83 f8 25             	cmp    $0x25,%eax
+ 46a:	75 c7                	jne    433 <printf+0x27>
+        state = '%';
+ 46c:	89 c7                	mov    %eax,%edi
+ 46e:	eb e1                	jmp    451 <printf+0x45>
+      if(c == 'd'){
+ 470:	83 f8 25             	cmp    $0x25,%eax
+ 473:	0f 84 f4 00 00 00    	je     56d <printf+0x161>
+ 479:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 47c:	83 fa 15             	cmp    $0x15,%edx
+ 47f:	0f 87 09 01 00 00    	ja     58e <printf+0x182>
+ 485:	0f 87 03 01 00 00    	ja     58e <printf+0x182>
+ 48b:	ff 24 95 20 07 00 00 	jmp    *0x720(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 492:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 495:	8b 17                	mov    (%edi),%edx
+ 497:	83 ec 0c             	sub    $0xc,%esp
+ 49a:	6a 01                	push   $0x1
+ 49c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 4a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a4:	e8 cb fe ff ff       	call   374 <printint>
+        ap++;
+ 4a9:	83 c7 04             	add    $0x4,%edi
+ 4ac:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4af:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4b2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4b7:	eb 98                	jmp    451 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 4b9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4bc:	8b 17                	mov    (%edi),%edx
+ 4be:	83 ec 0c             	sub    $0xc,%esp
+ 4c1:	6a 00                	push   $0x0
+ 4c3:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 4c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cb:	e8 a4 fe ff ff       	call   374 <printint>
+        ap++;
+ 4d0:	83 c7 04             	add    $0x4,%edi
+ 4d3:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4d6:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4d9:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4de:	e9 6e ff ff ff       	jmp    451 <printf+0x45>
+        s = (char*)*ap;
+ 4e3:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 4e6:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 4e8:	83 c1 04             	add    $0x4,%ecx
+ 4eb:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	74 13                	je     505 <printf+0xf9>
+        s = (char*)*ap;
+ 4f2:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 4f4:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 4f7:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 4fc:	84 c0                	test   %al,%al
+ 4fe:	75 0f                	jne    50f <printf+0x103>
+ 500:	e9 4c ff ff ff       	jmp    451 <printf+0x45>
+          s = "(null)";
+ 505:	bb 19 07 00 00       	mov    $0x719,%ebx
+        while(*s != 0){
+ 50a:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 50f:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 512:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 515:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 518:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 51b:	83 ec 04             	sub    $0x4,%esp
+ 51e:	6a 01                	push   $0x1
+ 520:	57                   	push   %edi
+ 521:	56                   	push   %esi
+ 522:	e8 5d fd ff ff       	call   284 <write>
+          s++;
+ 527:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 52a:	0f b6 03             	movzbl (%ebx),%eax
+ 52d:	83 c4 10             	add    $0x10,%esp
+ 530:	84 c0                	test   %al,%al
+ 532:	75 e4                	jne    518 <printf+0x10c>
+      state = 0;
+ 534:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 537:	bf 00 00 00 00       	mov    $0x0,%edi
+ 53c:	e9 10 ff ff ff       	jmp    451 <printf+0x45>
+        putc(fd, *ap);
+ 541:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 544:	8b 07                	mov    (%edi),%eax
+ 546:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 549:	83 ec 04             	sub    $0x4,%esp
+ 54c:	6a 01                	push   $0x1
+ 54e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 551:	50                   	push   %eax
+ 552:	ff 75 08             	push   0x8(%ebp)
+ 555:	e8 2a fd ff ff       	call   284 <write>
+        ap++;
+ 55a:	83 c7 04             	add    $0x4,%edi
+ 55d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 560:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 563:	bf 00 00 00 00       	mov    $0x0,%edi
+ 568:	e9 e4 fe ff ff       	jmp    451 <printf+0x45>
+        putc(fd, c);
+ 56d:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	6a 01                	push   $0x1
+ 575:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 578:	50                   	push   %eax
+ 579:	ff 75 08             	push   0x8(%ebp)
+ 57c:	e8 03 fd ff ff       	call   284 <write>
+ 581:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 584:	bf 00 00 00 00       	mov    $0x0,%edi
+ 589:	e9 c3 fe ff ff       	jmp    451 <printf+0x45>
+        putc(fd, '%');
+ 58e:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 592:	83 ec 04             	sub    $0x4,%esp
+ 595:	6a 01                	push   $0x1
+ 597:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 59a:	57                   	push   %edi
+ 59b:	ff 75 08             	push   0x8(%ebp)
+ 59e:	e8 e1 fc ff ff       	call   284 <write>
+        putc(fd, c);
+ 5a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a6:	83 c4 0c             	add    $0xc,%esp
+ 5a9:	6a 01                	push   $0x1
+ 5ab:	57                   	push   %edi
+ 5ac:	ff 75 08             	push   0x8(%ebp)
+ 5af:	e8 d0 fc ff ff       	call   284 <write>
+        putc(fd, c);
+ 5b4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5b7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5bc:	e9 90 fe ff ff       	jmp    451 <printf+0x45>
+    }
+  }
+}
+ 5c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c4:	5b                   	pop    %ebx
+ 5c5:	5e                   	pop    %esi
+ 5c6:	5f                   	pop    %edi
+ 5c7:	5d                   	pop    %ebp
+ 5c8:	c3                   	ret
+
+000005c9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5c9:	55                   	push   %ebp
+ 5ca:	89 e5                	mov    %esp,%ebp
+ 5cc:	57                   	push   %edi
+ 5cd:	56                   	push   %esi
+ 5ce:	53                   	push   %ebx
+ 5cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5d2:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d5:	a1 e4 09 00 00       	mov    0x9e4,%eax
+ 5da:	eb 0c                	jmp    5e8 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5dc:	8b 10                	mov    (%eax),%edx
+ 5de:	39 d0                	cmp    %edx,%eax
+ 5e0:	72 04                	jb     5e6 <free+0x1d>
+ 5e2:	39 d1                	cmp    %edx,%ecx
+ 5e4:	72 10                	jb     5f6 <free+0x2d>
+{
+ 5e6:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5e8:	39 c8                	cmp    %ecx,%eax
+ 5ea:	73 f0                	jae    5dc <free+0x13>
+ 5ec:	8b 10                	mov    (%eax),%edx
+ 5ee:	39 d1                	cmp    %edx,%ecx
+ 5f0:	72 04                	jb     5f6 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5f2:	39 d0                	cmp    %edx,%eax
+ 5f4:	72 f0                	jb     5e6 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5f6:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5f9:	8b 10                	mov    (%eax),%edx
+ 5fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5fe:	39 fa                	cmp    %edi,%edx
+ 600:	74 19                	je     61b <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 602:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 605:	8b 50 04             	mov    0x4(%eax),%edx
+ 608:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 60b:	39 f1                	cmp    %esi,%ecx
+ 60d:	74 18                	je     627 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 60f:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 611:	a3 e4 09 00 00       	mov    %eax,0x9e4
+}
+ 616:	5b                   	pop    %ebx
+ 617:	5e                   	pop    %esi
+ 618:	5f                   	pop    %edi
+ 619:	5d                   	pop    %ebp
+ 61a:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 61b:	03 72 04             	add    0x4(%edx),%esi
+ 61e:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 621:	8b 10                	mov    (%eax),%edx
+ 623:	8b 12                	mov    (%edx),%edx
+ 625:	eb db                	jmp    602 <free+0x39>
+    p->s.size += bp->s.size;
+ 627:	03 53 fc             	add    -0x4(%ebx),%edx
+ 62a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 62d:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 630:	eb dd                	jmp    60f <free+0x46>
+
+00000632 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 632:	55                   	push   %ebp
+ 633:	89 e5                	mov    %esp,%ebp
+ 635:	57                   	push   %edi
+ 636:	56                   	push   %esi
+ 637:	53                   	push   %ebx
+ 638:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 63b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63e:	8d 58 07             	lea    0x7(%eax),%ebx
+ 641:	c1 eb 03             	shr    $0x3,%ebx
+ 644:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 647:	8b 15 e4 09 00 00    	mov    0x9e4,%edx
+ 64d:	85 d2                	test   %edx,%edx
+ 64f:	74 1c                	je     66d <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 651:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 653:	8b 48 04             	mov    0x4(%eax),%ecx
+ 656:	39 d9                	cmp    %ebx,%ecx
+ 658:	73 38                	jae    692 <malloc+0x60>
+  if(nu < 4096)
+ 65a:	be 00 10 00 00       	mov    $0x1000,%esi
+ 65f:	39 f3                	cmp    %esi,%ebx
+ 661:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 664:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 66b:	eb 72                	jmp    6df <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 66d:	c7 05 e4 09 00 00 e8 	movl   $0x9e8,0x9e4
+ 674:	09 00 00 
+ 677:	c7 05 e8 09 00 00 e8 	movl   $0x9e8,0x9e8
+ 67e:	09 00 00 
+    base.s.size = 0;
+ 681:	c7 05 ec 09 00 00 00 	movl   $0x0,0x9ec
+ 688:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 68b:	b8 e8 09 00 00       	mov    $0x9e8,%eax
+    if(p->s.size >= nunits){
+ 690:	eb c8                	jmp    65a <malloc+0x28>
+      if(p->s.size == nunits)
+ 692:	39 cb                	cmp    %ecx,%ebx
+ 694:	74 1e                	je     6b4 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 696:	29 d9                	sub    %ebx,%ecx
+ 698:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 69b:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 69e:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 6a1:	89 15 e4 09 00 00    	mov    %edx,0x9e4
+      return (void*)(p + 1);
+ 6a7:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6aa:	89 d0                	mov    %edx,%eax
+ 6ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6af:	5b                   	pop    %ebx
+ 6b0:	5e                   	pop    %esi
+ 6b1:	5f                   	pop    %edi
+ 6b2:	5d                   	pop    %ebp
+ 6b3:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6b4:	8b 08                	mov    (%eax),%ecx
+ 6b6:	89 0a                	mov    %ecx,(%edx)
+ 6b8:	eb e7                	jmp    6a1 <malloc+0x6f>
+  hp->s.size = nu;
+ 6ba:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 6bd:	83 ec 0c             	sub    $0xc,%esp
+ 6c0:	83 c0 08             	add    $0x8,%eax
+ 6c3:	50                   	push   %eax
+ 6c4:	e8 00 ff ff ff       	call   5c9 <free>
+  return freep;
+ 6c9:	8b 15 e4 09 00 00    	mov    0x9e4,%edx
+      if((p = morecore(nunits)) == 0)
+ 6cf:	83 c4 10             	add    $0x10,%esp
+ 6d2:	85 d2                	test   %edx,%edx
+ 6d4:	74 d4                	je     6aa <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d6:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6d8:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6db:	39 d9                	cmp    %ebx,%ecx
+ 6dd:	73 b3                	jae    692 <malloc+0x60>
+    if(p == freep)
+ 6df:	89 c2                	mov    %eax,%edx
+ 6e1:	39 05 e4 09 00 00    	cmp    %eax,0x9e4
+ 6e7:	75 ed                	jne    6d6 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 6e9:	83 ec 0c             	sub    $0xc,%esp
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 fa fb ff ff       	call   2ec <sbrk>
+  if(p == (char*)-1)
+ 6f2:	83 c4 10             	add    $0x10,%esp
+ 6f5:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6f8:	75 c0                	jne    6ba <malloc+0x88>
+        return 0;
+ 6fa:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6ff:	eb a9                	jmp    6aa <malloc+0x78>
@@ -0,0 +1,1271 @@
+
+_pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define ROUNDS 2000
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 38             	sub    $0x38,%esp
+  14:	8b 41 04             	mov    0x4(%ecx),%eax
+  int i, n, pid, start, elapsed;
+  int ping[2], pong[2];
+  char c;
+
+  n = ROUNDS;
+  17:	bb d0 07 00 00       	mov    $0x7d0,%ebx
+  if(argc > 1)
+  1c:	83 39 01             	cmpl   $0x1,(%ecx)
+  1f:	7f 3a                	jg     5b <main+0x5b>
+    n = atoi(argv[1]);
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  27:	50                   	push   %eax
+  28:	e8 65 03 00 00       	call   392 <pipe>
+  2d:	83 c4 10             	add    $0x10,%esp
+  30:	85 c0                	test   %eax,%eax
+  32:	78 13                	js     47 <main+0x47>
+  34:	83 ec 0c             	sub    $0xc,%esp
+  37:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  3a:	50                   	push   %eax
+  3b:	e8 52 03 00 00       	call   392 <pipe>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	79 26                	jns    6d <main+0x6d>
+    printf(2, "pingpong: pipe failed\n");
+  47:	83 ec 08             	sub    $0x8,%esp
+  4a:	68 20 08 00 00       	push   $0x820
+  4f:	6a 02                	push   $0x2
+  51:	e8 d4 04 00 00       	call   52a <printf>
+    exit();
+  56:	e8 27 03 00 00       	call   382 <exit>
+    n = atoi(argv[1]);
+  5b:	83 ec 0c             	sub    $0xc,%esp
+  5e:	ff 70 04             	push   0x4(%eax)
+  61:	e8 aa 02 00 00       	call   310 <atoi>
+  66:	89 c3                	mov    %eax,%ebx
+  68:	83 c4 10             	add    $0x10,%esp
+  6b:	eb b4                	jmp    21 <main+0x21>
+  }
+
+  pid = fork();
+  6d:	e8 08 03 00 00       	call   37a <fork>
+  if(pid < 0){
+  72:	85 c0                	test   %eax,%eax
+  74:	78 20                	js     96 <main+0x96>
+    printf(2, "pingpong: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+  76:	75 5e                	jne    d6 <main+0xd6>
+    // Echo every byte back until the parent closes its end.
+    close(ping[1]);
+  78:	83 ec 0c             	sub    $0xc,%esp
+  7b:	ff 75 e4             	push   -0x1c(%ebp)
+  7e:	e8 27 03 00 00       	call   3aa <close>
+    close(pong[0]);
+  83:	83 c4 04             	add    $0x4,%esp
+  86:	ff 75 d8             	push   -0x28(%ebp)
+  89:	e8 1c 03 00 00       	call   3aa <close>
+    while(read(ping[0], &c, 1) == 1)
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+  94:	eb 25                	jmp    bb <main+0xbb>
+    printf(2, "pingpong: fork failed\n");
+  96:	83 ec 08             	sub    $0x8,%esp
+  99:	68 37 08 00 00       	push   $0x837
+  9e:	6a 02                	push   $0x2
+  a0:	e8 85 04 00 00       	call   52a <printf>
+    exit();
+  a5:	e8 d8 02 00 00       	call   382 <exit>
+      write(pong[1], &c, 1);
+  aa:	83 ec 04             	sub    $0x4,%esp
+  ad:	6a 01                	push   $0x1
+  af:	53                   	push   %ebx
+  b0:	ff 75 dc             	push   -0x24(%ebp)
+  b3:	e8 ea 02 00 00       	call   3a2 <write>
+  b8:	83 c4 10             	add    $0x10,%esp
+    while(read(ping[0], &c, 1) == 1)
+  bb:	83 ec 04             	sub    $0x4,%esp
+  be:	6a 01                	push   $0x1
+  c0:	53                   	push   %ebx
+  c1:	ff 75 e0             	push   -0x20(%ebp)
+  c4:	e8 d1 02 00 00       	call   39a <read>
+  c9:	83 c4 10             	add    $0x10,%esp
+  cc:	83 f8 01             	cmp    $0x1,%eax
+  cf:	74 d9                	je     aa <main+0xaa>
+    exit();
+  d1:	e8 ac 02 00 00       	call   382 <exit>
+  }
+  close(ping[0]);
+  d6:	83 ec 0c             	sub    $0xc,%esp
+  d9:	ff 75 e0             	push   -0x20(%ebp)
+  dc:	e8 c9 02 00 00       	call   3aa <close>
+  close(pong[1]);
+  e1:	83 c4 04             	add    $0x4,%esp
+  e4:	ff 75 dc             	push   -0x24(%ebp)
+  e7:	e8 be 02 00 00       	call   3aa <close>
+
+  c = 'x';
+  ec:	c6 45 d7 78          	movb   $0x78,-0x29(%ebp)
+  start = uptime();
+  f0:	e8 25 03 00 00       	call   41a <uptime>
+  f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for(i = 0; i < n; i++){
+  f8:	83 c4 10             	add    $0x10,%esp
+  fb:	85 db                	test   %ebx,%ebx
+  fd:	0f 8e 96 00 00 00    	jle    199 <main+0x199>
+ 103:	be 00 00 00 00       	mov    $0x0,%esi
+    write(ping[1], &c, 1);
+ 108:	8d 7d d7             	lea    -0x29(%ebp),%edi
+ 10b:	83 ec 04             	sub    $0x4,%esp
+ 10e:	6a 01                	push   $0x1
+ 110:	57                   	push   %edi
+ 111:	ff 75 e4             	push   -0x1c(%ebp)
+ 114:	e8 89 02 00 00       	call   3a2 <write>
+    if(read(pong[0], &c, 1) != 1){
+ 119:	83 c4 0c             	add    $0xc,%esp
+ 11c:	6a 01                	push   $0x1
+ 11e:	57                   	push   %edi
+ 11f:	ff 75 d8             	push   -0x28(%ebp)
+ 122:	e8 73 02 00 00       	call   39a <read>
+ 127:	83 c4 10             	add    $0x10,%esp
+ 12a:	83 f8 01             	cmp    $0x1,%eax
+ 12d:	75 09                	jne    138 <main+0x138>
+  for(i = 0; i < n; i++){
+ 12f:	83 c6 01             	add    $0x1,%esi
+ 132:	39 f3                	cmp    %esi,%ebx
+ 134:	75 d5                	jne    10b <main+0x10b>
+ 136:	eb 15                	jmp    14d <main+0x14d>
+      printf(2, "pingpong: short read after %d round trips\n", i);
+ 138:	83 ec 04             	sub    $0x4,%esp
+ 13b:	56                   	push   %esi
+ 13c:	68 60 08 00 00       	push   $0x860
+ 141:	6a 02                	push   $0x2
+ 143:	e8 e2 03 00 00       	call   52a <printf>
+      break;
+ 148:	83 c4 10             	add    $0x10,%esp
+ 14b:	89 f3                	mov    %esi,%ebx
+    }
+  }
+  elapsed = uptime() - start;
+ 14d:	e8 c8 02 00 00       	call   41a <uptime>
+ 152:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 155:	29 d0                	sub    %edx,%eax
+ 157:	89 c6                	mov    %eax,%esi
+  close(ping[1]);
+ 159:	83 ec 0c             	sub    $0xc,%esp
+ 15c:	ff 75 e4             	push   -0x1c(%ebp)
+ 15f:	e8 46 02 00 00       	call   3aa <close>
+  wait(0);
+ 164:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 16b:	e8 1a 02 00 00       	call   38a <wait>
+
+  printf(1, "pingpong: %d round trips in %d ticks", i, elapsed);
+ 170:	56                   	push   %esi
+ 171:	53                   	push   %ebx
+ 172:	68 8c 08 00 00       	push   $0x88c
+ 177:	6a 01                	push   $0x1
+ 179:	e8 ac 03 00 00       	call   52a <printf>
+  if(elapsed > 0)
+ 17e:	83 c4 20             	add    $0x20,%esp
+ 181:	85 f6                	test   %esi,%esi
+ 183:	7f 1b                	jg     1a0 <main+0x1a0>
+    printf(1, " (%d per tick)", i / elapsed);
+  printf(1, "\n");
+ 185:	83 ec 08             	sub    $0x8,%esp
+ 188:	68 35 08 00 00       	push   $0x835
+ 18d:	6a 01                	push   $0x1
+ 18f:	e8 96 03 00 00       	call   52a <printf>
+  exit();
+ 194:	e8 e9 01 00 00       	call   382 <exit>
+  for(i = 0; i < n; i++){
+ 199:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 19e:	eb ad                	jmp    14d <main+0x14d>
+    printf(1, " (%d per tick)", i / elapsed);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	89 d8                	mov    %ebx,%eax
+ 1a5:	99                   	cltd
+ 1a6:	f7 fe                	idiv   %esi
+ 1a8:	50                   	push   %eax
+ 1a9:	68 4e 08 00 00       	push   $0x84e
+ 1ae:	6a 01                	push   $0x1
+ 1b0:	e8 75 03 00 00       	call   52a <printf>
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	eb cb                	jmp    185 <main+0x185>
+
+000001ba <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1ba:	55                   	push   %ebp
+ 1bb:	89 e5                	mov    %esp,%ebp
+ 1bd:	53                   	push   %ebx
+ 1be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c4:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1c9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1cd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d0:	83 c0 01             	add    $0x1,%eax
+ 1d3:	84 d2                	test   %dl,%dl
+ 1d5:	75 f2                	jne    1c9 <strcpy+0xf>
+    ;
+  return os;
+}
+ 1d7:	89 c8                	mov    %ecx,%eax
+ 1d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1dc:	c9                   	leave
+ 1dd:	c3                   	ret
+
+000001de <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1de:	55                   	push   %ebp
+ 1df:	89 e5                	mov    %esp,%ebp
+ 1e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 1e7:	0f b6 01             	movzbl (%ecx),%eax
+ 1ea:	84 c0                	test   %al,%al
+ 1ec:	74 11                	je     1ff <strcmp+0x21>
+ 1ee:	38 02                	cmp    %al,(%edx)
+ 1f0:	75 0d                	jne    1ff <strcmp+0x21>
+    p++, q++;
+ 1f2:	83 c1 01             	add    $0x1,%ecx
+ 1f5:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 1f8:	0f b6 01             	movzbl (%ecx),%eax
+ 1fb:	84 c0                	test   %al,%al
+ 1fd:	75 ef                	jne    1ee <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	0f b6 c0             	movzbl %al,%eax
+ 202:	0f b6 12             	movzbl (%edx),%edx
+ 205:	29 d0                	sub    %edx,%eax
+}
+ 207:	5d                   	pop    %ebp
+ 208:	c3                   	ret
+
+00000209 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 209:	55                   	push   %ebp
+ 20a:	89 e5                	mov    %esp,%ebp
+ 20c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 20f:	80 3a 00             	cmpb   $0x0,(%edx)
+ 212:	74 14                	je     228 <strlen+0x1f>
+ 214:	b8 00 00 00 00       	mov    $0x0,%eax
+ 219:	83 c0 01             	add    $0x1,%eax
+ 21c:	89 c1                	mov    %eax,%ecx
+ 21e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 222:	75 f5                	jne    219 <strlen+0x10>
+    ;
+  return n;
+}
+ 224:	89 c8                	mov    %ecx,%eax
+ 226:	5d                   	pop    %ebp
+ 227:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 228:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 22d:	eb f5                	jmp    224 <strlen+0x1b>
+
+0000022f <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 22f:	55                   	push   %ebp
+ 230:	89 e5                	mov    %esp,%ebp
+ 232:	57                   	push   %edi
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 236:	89 d7                	mov    %edx,%edi
+ 238:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 23b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23e:	fc                   	cld
+ 23f:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 241:	89 d0                	mov    %edx,%eax
+ 243:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 246:	c9                   	leave
+ 247:	c3                   	ret
+
+00000248 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 248:	55                   	push   %ebp
+ 249:	89 e5                	mov    %esp,%ebp
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 252:	0f b6 10             	movzbl (%eax),%edx
+ 255:	84 d2                	test   %dl,%dl
+ 257:	74 15                	je     26e <strchr+0x26>
+    if(*s == c)
+ 259:	38 d1                	cmp    %dl,%cl
+ 25b:	74 0f                	je     26c <strchr+0x24>
+  for(; *s; s++)
+ 25d:	83 c0 01             	add    $0x1,%eax
+ 260:	0f b6 10             	movzbl (%eax),%edx
+ 263:	84 d2                	test   %dl,%dl
+ 265:	75 f2                	jne    259 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 267:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 26c:	5d                   	pop    %ebp
+ 26d:	c3                   	ret
+  return 0;
+ 26e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 273:	eb f7                	jmp    26c <strchr+0x24>
+
+00000275 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 275:	55                   	push   %ebp
+ 276:	89 e5                	mov    %esp,%ebp
+ 278:	57                   	push   %edi
+ 279:	56                   	push   %esi
+ 27a:	53                   	push   %ebx
+ 27b:	83 ec 2c             	sub    $0x2c,%esp
+ 27e:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 281:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 286:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 289:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 28c:	83 c3 01             	add    $0x1,%ebx
+ 28f:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 292:	7d 27                	jge    2bb <gets+0x46>
+    cc = read(0, &c, 1);
+ 294:	83 ec 04             	sub    $0x4,%esp
+ 297:	6a 01                	push   $0x1
+ 299:	57                   	push   %edi
+ 29a:	6a 00                	push   $0x0
+ 29c:	e8 f9 00 00 00       	call   39a <read>
+    if(cc < 1)
+ 2a1:	83 c4 10             	add    $0x10,%esp
+ 2a4:	85 c0                	test   %eax,%eax
+ 2a6:	7e 13                	jle    2bb <gets+0x46>
+      break;
+    buf[i++] = c;
+ 2a8:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2ac:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2b0:	3c 0a                	cmp    $0xa,%al
+ 2b2:	74 04                	je     2b8 <gets+0x43>
+ 2b4:	3c 0d                	cmp    $0xd,%al
+ 2b6:	75 d1                	jne    289 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 2b8:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 2bb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2be:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 2c2:	89 f0                	mov    %esi,%eax
+ 2c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2c7:	5b                   	pop    %ebx
+ 2c8:	5e                   	pop    %esi
+ 2c9:	5f                   	pop    %edi
+ 2ca:	5d                   	pop    %ebp
+ 2cb:	c3                   	ret
+
+000002cc <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2cc:	55                   	push   %ebp
+ 2cd:	89 e5                	mov    %esp,%ebp
+ 2cf:	56                   	push   %esi
+ 2d0:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d1:	83 ec 08             	sub    $0x8,%esp
+ 2d4:	6a 00                	push   $0x0
+ 2d6:	ff 75 08             	push   0x8(%ebp)
+ 2d9:	e8 e4 00 00 00       	call   3c2 <open>
+  if(fd < 0)
+ 2de:	83 c4 10             	add    $0x10,%esp
+ 2e1:	85 c0                	test   %eax,%eax
+ 2e3:	78 24                	js     309 <stat+0x3d>
+ 2e5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2e7:	83 ec 08             	sub    $0x8,%esp
+ 2ea:	ff 75 0c             	push   0xc(%ebp)
+ 2ed:	50                   	push   %eax
+ 2ee:	e8 e7 00 00 00       	call   3da <fstat>
+ 2f3:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2f5:	89 1c 24             	mov    %ebx,(%esp)
+ 2f8:	e8 ad 00 00 00       	call   3aa <close>
+  return r;
+ 2fd:	83 c4 10             	add    $0x10,%esp
+}
+ 300:	89 f0                	mov    %esi,%eax
+ 302:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 305:	5b                   	pop    %ebx
+ 306:	5e                   	pop    %esi
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+    return -1;
+ 309:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 30e:	eb f0                	jmp    300 <stat+0x34>
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 317:	0f b6 02             	movzbl (%edx),%eax
+ 31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 31d:	80 f9 09             	cmp    $0x9,%cl
+ 320:	77 24                	ja     346 <atoi+0x36>
+  n = 0;
+ 322:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 327:	83 c2 01             	add    $0x1,%edx
+ 32a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 32d:	0f be c0             	movsbl %al,%eax
+ 330:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 334:	0f b6 02             	movzbl (%edx),%eax
+ 337:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 33a:	80 fb 09             	cmp    $0x9,%bl
+ 33d:	76 e8                	jbe    327 <atoi+0x17>
+  return n;
+}
+ 33f:	89 c8                	mov    %ecx,%eax
+ 341:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 344:	c9                   	leave
+ 345:	c3                   	ret
+  n = 0;
+ 346:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 34b:	eb f2                	jmp    33f <atoi+0x2f>
+
+0000034d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 34d:	55                   	push   %ebp
+ 34e:	89 e5                	mov    %esp,%ebp
+ 350:	56                   	push   %esi
+ 351:	53                   	push   %ebx
+ 352:	8b 75 08             	mov    0x8(%ebp),%esi
+ 355:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 358:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 35b:	85 db                	test   %ebx,%ebx
+ 35d:	7e 15                	jle    374 <memmove+0x27>
+ 35f:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 361:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 363:	83 c2 01             	add    $0x1,%edx
+ 366:	83 c0 01             	add    $0x1,%eax
+ 369:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 36d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 370:	39 c3                	cmp    %eax,%ebx
+ 372:	75 ef                	jne    363 <memmove+0x16>
+  return vdst;
+}
+ 374:	89 f0                	mov    %esi,%eax
+ 376:	5b                   	pop    %ebx
+ 377:	5e                   	pop    %esi
+ 378:	5d                   	pop    %ebp
+ 379:	c3                   	ret
+
+0000037a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 37a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <exit>:
+SYSCALL(exit)
+ 382:	b8 02 00 00 00       	mov    $0x2,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <wait>:
+SYSCALL(wait)
+ 38a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <pipe>:
+SYSCALL(pipe)
+ 392:	b8 04 00 00 00       	mov    $0x4,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+0000039a <read>:
+SYSCALL(read)
+ 39a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <write>:
+SYSCALL(write)
+ 3a2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <close>:
+SYSCALL(close)
+ 3aa:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <kill>:
+SYSCALL(kill)
+ 3b2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <exec>:
+SYSCALL(exec)
+ 3ba:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <open>:
+SYSCALL(open)
+ 3c2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <mknod>:
+SYSCALL(mknod)
+ 3ca:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <unlink>:
+SYSCALL(unlink)
+ 3d2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <fstat>:
+SYSCALL(fstat)
+ 3da:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <link>:
+SYSCALL(link)
+ 3e2:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <mkdir>:
+SYSCALL(mkdir)
+ 3ea:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <chdir>:
+SYSCALL(chdir)
+ 3f2:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <dup>:
+SYSCALL(dup)
+ 3fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <getpid>:
+SYSCALL(getpid)
+ 402:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <sbrk>:
+SYSCALL(sbrk)
+ 40a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <sleep>:
+SYSCALL(sleep)
+ 412:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <uptime>:
+SYSCALL(uptime)
+ 41a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <readmouse>:
+SYSCALL(readmouse)
+ 422:	b8 16 00 00 00       	mov    $0x16,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <sigsend>:
+SYSCALL(sigsend)
+ 42a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 432:	b8 18 00 00 00       	mov    $0x18,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <sigreturn>:
+SYSCALL(sigreturn)
+ 43a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <siggetmask>:
+SYSCALL(siggetmask)
+ 442:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <sigsetmask>:
+SYSCALL(sigsetmask)
+ 44a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <sigpause>:
+SYSCALL(sigpause)
+ 452:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <predict_cpu>:
+SYSCALL(predict_cpu)
+ 45a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <sleeptick>:
+SYSCALL(sleeptick)
+ 462:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <schedctl>:
+SYSCALL(schedctl)
+ 46a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <nswtch>:
+SYSCALL(nswtch)
+ 472:	b8 20 00 00 00       	mov    $0x20,%eax
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <getloadavg>:
+SYSCALL(getloadavg)
+ 47a:	b8 21 00 00 00       	mov    $0x21,%eax
+ 47f:	cd 40                	int    $0x40
+ 481:	c3                   	ret
+
+00000482 <memstat>:
+SYSCALL(memstat)
+ 482:	b8 22 00 00 00       	mov    $0x22,%eax
+ 487:	cd 40                	int    $0x40
+ 489:	c3                   	ret
+
+0000048a <iostat>:
+SYSCALL(iostat)
+ 48a:	b8 23 00 00 00       	mov    $0x23,%eax
+ 48f:	cd 40                	int    $0x40
+ 491:	c3                   	ret
+
+00000492 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 492:	55                   	push   %ebp
+ 493:	89 e5                	mov    %esp,%ebp
+ 495:	57                   	push   %edi
+ 496:	56                   	push   %esi
+ 497:	53                   	push   %ebx
+ 498:	83 ec 3c             	sub    $0x3c,%esp
+ 49b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 49e:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4a0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4a4:	74 79                	je     51f <printint+0x8d>
+ 4a6:	85 d2                	test   %edx,%edx
+ 4a8:	79 75                	jns    51f <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 4aa:	89 d1                	mov    %edx,%ecx
+ 4ac:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4ae:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4ba:	89 df                	mov    %ebx,%edi
+ 4bc:	83 c3 01             	add    $0x1,%ebx
+ 4bf:	89 c8                	mov    %ecx,%eax
+ 4c1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4c6:	f7 f6                	div    %esi
+ 4c8:	0f b6 92 10 09 00 00 	movzbl 0x910(%edx),%edx
+ 4cf:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 4d3:	89 ca                	mov    %ecx,%edx
+ 4d5:	89 c1                	mov    %eax,%ecx
+ 4d7:	39 f2                	cmp    %esi,%edx
+ 4d9:	73 df                	jae    4ba <printint+0x28>
+  if(neg)
+ 4db:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 4df:	74 08                	je     4e9 <printint+0x57>
+    buf[i++] = '-';
+ 4e1:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4e6:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 4e9:	85 db                	test   %ebx,%ebx
+ 4eb:	7e 2a                	jle    517 <printint+0x85>
+ 4ed:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 4f0:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 4f4:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 4f7:	0f b6 03             	movzbl (%ebx),%eax
+ 4fa:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 4fd:	83 ec 04             	sub    $0x4,%esp
+ 500:	6a 01                	push   $0x1
+ 502:	57                   	push   %edi
+ 503:	ff 75 c4             	push   -0x3c(%ebp)
+ 506:	e8 97 fe ff ff       	call   3a2 <write>
+  while(--i >= 0)
+ 50b:	89 d8                	mov    %ebx,%eax
+ 50d:	83 eb 01             	sub    $0x1,%ebx
+ 510:	83 c4 10             	add    $0x10,%esp
+ 513:	39 f0                	cmp    %esi,%eax
+ 515:	75 e0                	jne    4f7 <printint+0x65>
+}
+ 517:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51a:	5b                   	pop    %ebx
+ 51b:	5e                   	pop    %esi
+ 51c:	5f                   	pop    %edi
+ 51d:	5d                   	pop    %ebp
+ 51e:	c3                   	ret
+    x = xx;
+ 51f:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 521:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 528:	eb 8b                	jmp    4b5 <printint+0x23>
+
+0000052a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 52a:	55                   	push   %ebp
+ 52b:	89 e5                	mov    %esp,%ebp
+ 52d:	57                   	push   %edi
+ 52e:	56                   	push   %esi
+ 52f:	53                   	push   %ebx
+ 530:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 533:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 536:	0f b6 1e             	movzbl (%esi),%ebx
+ 539:	84 db                	test   %bl,%bl
+ 53b:	0f 84 9e 01 00 00    	je     6df <printf+0x1b5>
+ 541:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 544:	8d 45 10             	lea    0x10(%ebp),%eax
+ 547:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 54a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 54f:	eb 2d                	jmp    57e <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 551:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 554:	83 ec 04             	sub    $0x4,%esp
+ 557:	6a 01                	push   $0x1
+ 559:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 55c:	50                   	push   %eax
+ 55d:	ff 75 08             	push   0x8(%ebp)
+ 560:	e8 3d fe ff ff       	call   3a2 <write>
+        putc(fd, c);
+ 565:	83 c4 10             	add    $0x10,%esp
+ 568:	eb 05                	jmp    56f <printf+0x45>
+      }
+    } else if(state == '%'){
+ 56a:	83 ff 25             	cmp    $0x25,%edi
+ 56d:	74 1f                	je     58e <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 56f:	83 c6 01             	add    $0x1,%esi
+ 572:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 576:	84 db                	test   %bl,%bl
+ 578:	0f 84 61 01 00 00    	je     6df <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 57e:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 581:	85 ff                	test   %edi,%edi
+ 583:	75 e5                	jne    56a <printf+0x40>
+      if(c == '%'){
+ 585:	83 f8 25             	cmp    $0x25,%eax
+ 588:	75 c7                	jne    551 <printf+0x27>
+        state = '%';
+ 58a:	89 c7                	mov    %eax,%edi
+ 58c:	eb e1                	jmp    56f <printf+0x45>
+      if(c == 'd'){
+ 58e:	83 f8 25             	cmp    $0x25,%eax
+ 591:	0f 84 f4 00 00 00    	je     68b <printf+0x161>
+ 597:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 59a:	83 fa 15             	cmp    $0x15,%edx
+ 59d:	0f 87 09 01 00 00    	ja     6ac <printf+0x182>
+ 5a3:	0f 87 03 01 00 00    	ja     6ac <printf+0x182>
+ 5a9:	ff 24 95 b8 08 00 00 	jmp    *0x8b8(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 5b0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5b3:	8b 17                	mov    (%edi),%edx
+ 5b5:	83 ec 0c             	sub    $0xc,%esp
+ 5b8:	6a 01                	push   $0x1
+ 5ba:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c2:	e8 cb fe ff ff       	call   492 <printint>
+        ap++;
+ 5c7:	83 c7 04             	add    $0x4,%edi
+ 5ca:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5cd:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5d0:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5d5:	eb 98                	jmp    56f <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 5d7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5da:	8b 17                	mov    (%edi),%edx
+ 5dc:	83 ec 0c             	sub    $0xc,%esp
+ 5df:	6a 00                	push   $0x0
+ 5e1:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e9:	e8 a4 fe ff ff       	call   492 <printint>
+        ap++;
+ 5ee:	83 c7 04             	add    $0x4,%edi
+ 5f1:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5f4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5f7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5fc:	e9 6e ff ff ff       	jmp    56f <printf+0x45>
+        s = (char*)*ap;
+ 601:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 604:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 606:	83 c1 04             	add    $0x4,%ecx
+ 609:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 60c:	85 c0                	test   %eax,%eax
+ 60e:	74 13                	je     623 <printf+0xf9>
+        s = (char*)*ap;
+ 610:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 612:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 615:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 61a:	84 c0                	test   %al,%al
+ 61c:	75 0f                	jne    62d <printf+0x103>
+ 61e:	e9 4c ff ff ff       	jmp    56f <printf+0x45>
+          s = "(null)";
+ 623:	bb b1 08 00 00       	mov    $0x8b1,%ebx
+        while(*s != 0){
+ 628:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 62d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 630:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 633:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 636:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 639:	83 ec 04             	sub    $0x4,%esp
+ 63c:	6a 01                	push   $0x1
+ 63e:	57                   	push   %edi
+ 63f:	56                   	push   %esi
+ 640:	e8 5d fd ff ff       	call   3a2 <write>
+          s++;
+ 645:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 648:	0f b6 03             	movzbl (%ebx),%eax
+ 64b:	83 c4 10             	add    $0x10,%esp
+ 64e:	84 c0                	test   %al,%al
+ 650:	75 e4                	jne    636 <printf+0x10c>
+      state = 0;
+ 652:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 655:	bf 00 00 00 00       	mov    $0x0,%edi
+ 65a:	e9 10 ff ff ff       	jmp    56f <printf+0x45>
+        putc(fd, *ap);
+ 65f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 662:	8b 07                	mov    (%edi),%eax
+ 664:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 667:	83 ec 04             	sub    $0x4,%esp
+ 66a:	6a 01                	push   $0x1
+ 66c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 66f:	50                   	push   %eax
+ 670:	ff 75 08             	push   0x8(%ebp)
+ 673:	e8 2a fd ff ff       	call   3a2 <write>
+        ap++;
+ 678:	83 c7 04             	add    $0x4,%edi
+ 67b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 67e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 681:	bf 00 00 00 00       	mov    $0x0,%edi
+ 686:	e9 e4 fe ff ff       	jmp    56f <printf+0x45>
+        putc(fd, c);
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 68e:	83 ec 04             	sub    $0x4,%esp
+ 691:	6a 01                	push   $0x1
+ 693:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 696:	50                   	push   %eax
+ 697:	ff 75 08             	push   0x8(%ebp)
+ 69a:	e8 03 fd ff ff       	call   3a2 <write>
+ 69f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6a2:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6a7:	e9 c3 fe ff ff       	jmp    56f <printf+0x45>
+        putc(fd, '%');
+ 6ac:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	6a 01                	push   $0x1
+ 6b5:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6b8:	57                   	push   %edi
+ 6b9:	ff 75 08             	push   0x8(%ebp)
+ 6bc:	e8 e1 fc ff ff       	call   3a2 <write>
+        putc(fd, c);
+ 6c1:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c4:	83 c4 0c             	add    $0xc,%esp
+ 6c7:	6a 01                	push   $0x1
+ 6c9:	57                   	push   %edi
+ 6ca:	ff 75 08             	push   0x8(%ebp)
+ 6cd:	e8 d0 fc ff ff       	call   3a2 <write>
+        putc(fd, c);
+ 6d2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6d5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6da:	e9 90 fe ff ff       	jmp    56f <printf+0x45>
+    }
+  }
+}
+ 6df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e2:	5b                   	pop    %ebx
+ 6e3:	5e                   	pop    %esi
+ 6e4:	5f                   	pop    %edi
+ 6e5:	5d                   	pop    %ebp
+ 6e6:	c3                   	ret
+
+000006e7 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e7:	55                   	push   %ebp
+ 6e8:	89 e5                	mov    %esp,%ebp
+ 6ea:	57                   	push   %edi
+ 6eb:	56                   	push   %esi
+ 6ec:	53                   	push   %ebx
+ 6ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6f0:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f3:	a1 84 0b 00 00       	mov    0xb84,%eax
+ 6f8:	eb 0c                	jmp    706 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fa:	8b 10                	mov    (%eax),%edx
+ 6fc:	39 d0                	cmp    %edx,%eax
+ 6fe:	72 04                	jb     704 <free+0x1d>
+ 700:	39 d1                	cmp    %edx,%ecx
+ 702:	72 10                	jb     714 <free+0x2d>
+{
+ 704:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 706:	39 c8                	cmp    %ecx,%eax
+ 708:	73 f0                	jae    6fa <free+0x13>
+ 70a:	8b 10                	mov    (%eax),%edx
+ 70c:	39 d1                	cmp    %edx,%ecx
+ 70e:	72 04                	jb     714 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 710:	39 d0                	cmp    %edx,%eax
+ 712:	72 f0                	jb     704 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 714:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 717:	8b 10                	mov    (%eax),%edx
+ 719:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 71c:	39 fa                	cmp    %edi,%edx
+ 71e:	74 19                	je     739 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 720:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 723:	8b 50 04             	mov    0x4(%eax),%edx
+ 726:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 729:	39 f1                	cmp    %esi,%ecx
+ 72b:	74 18                	je     745 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 72d:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 72f:	a3 84 0b 00 00       	mov    %eax,0xb84
+}
+ 734:	5b                   	pop    %ebx
+ 735:	5e                   	pop    %esi
+ 736:	5f                   	pop    %edi
+ 737:	5d                   	pop    %ebp
+ 738:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 739:	03 72 04             	add    0x4(%edx),%esi
+ 73c:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 73f:	8b 10                	mov    (%eax),%edx
+ 741:	8b 12                	mov    (%edx),%edx
+ 743:	eb db                	jmp    720 <free+0x39>
+    p->s.size += bp->s.size;
+ 745:	03 53 fc             	add    -0x4(%ebx),%edx
+ 748:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 74b:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 74e:	eb dd                	jmp    72d <free+0x46>
+
+00000750 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 759:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75c:	8d 58 07             	lea    0x7(%eax),%ebx
+ 75f:	c1 eb 03             	shr    $0x3,%ebx
+ 762:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 765:	8b 15 84 0b 00 00    	mov    0xb84,%edx
+ 76b:	85 d2                	test   %edx,%edx
+ 76d:	74 1c                	je     78b <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 76f:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 771:	8b 48 04             	mov    0x4(%eax),%ecx
+ 774:	39 d9                	cmp    %ebx,%ecx
+ 776:	73 38                	jae    7b0 <malloc+0x60>
+  if(nu < 4096)
+ 778:	be 00 10 00 00       	mov    $0x1000,%esi
+ 77d:	39 f3                	cmp    %esi,%ebx
+ 77f:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 782:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 789:	eb 72                	jmp    7fd <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 78b:	c7 05 84 0b 00 00 88 	movl   $0xb88,0xb84
+ 792:	0b 00 00 
+ 795:	c7 05 88 0b 00 00 88 	movl   $0xb88,0xb88
+ 79c:	0b 00 00 
+    base.s.size = 0;
+ 79f:	c7 05 8c 0b 00 00 00 	movl   $0x0,0xb8c
+ 7a6:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a9:	b8 88 0b 00 00       	mov    $0xb88,%eax
+    if(p->s.size >= nunits){
+ 7ae:	eb c8                	jmp    778 <malloc+0x28>
+      if(p->s.size == nunits)
+ 7b0:	39 cb                	cmp    %ecx,%ebx
+ 7b2:	74 1e                	je     7d2 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7b4:	29 d9                	sub    %ebx,%ecx
+ 7b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7bc:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7bf:	89 15 84 0b 00 00    	mov    %edx,0xb84
+      return (void*)(p + 1);
+ 7c5:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7c8:	89 d0                	mov    %edx,%eax
+ 7ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7cd:	5b                   	pop    %ebx
+ 7ce:	5e                   	pop    %esi
+ 7cf:	5f                   	pop    %edi
+ 7d0:	5d                   	pop    %ebp
+ 7d1:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7d2:	8b 08                	mov    (%eax),%ecx
+ 7d4:	89 0a                	mov    %ecx,(%edx)
+ 7d6:	eb e7                	jmp    7bf <malloc+0x6f>
+  hp->s.size = nu;
+ 7d8:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 7db:	83 ec 0c             	sub    $0xc,%esp
+ 7de:	83 c0 08             	add    $0x8,%eax
+ 7e1:	50                   	push   %eax
+ 7e2:	e8 00 ff ff ff       	call   6e7 <free>
+  return freep;
+ 7e7:	8b 15 84 0b 00 00    	mov    0xb84,%edx
+      if((p = morecore(nunits)) == 0)
+ 7ed:	83 c4 10             	add    $0x10,%esp
+ 7f0:	85 d2                	test   %edx,%edx
+ 7f2:	74 d4                	je     7c8 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f4:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7f6:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7f9:	39 d9                	cmp    %ebx,%ecx
+ 7fb:	73 b3                	jae    7b0 <malloc+0x60>
+    if(p == freep)
+ 7fd:	89 c2                	mov    %eax,%edx
+ 7ff:	39 05 84 0b 00 00    	cmp    %eax,0xb84
+ 805:	75 ed                	jne    7f4 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 807:	83 ec 0c             	sub    $0xc,%esp
+ 80a:	57                   	push   %edi
+ 80b:	e8 fa fb ff ff       	call   40a <sbrk>
+  if(p == (char*)-1)
+ 810:	83 c4 10             	add    $0x10,%esp
+ 813:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 816:	75 c0                	jne    7d8 <malloc+0x88>
+        return 0;
+ 818:	ba 00 00 00 00       	mov    $0x0,%edx
+ 81d:	eb a9                	jmp    7c8 <malloc+0x78>
@@ -0,0 +1,63 @@
+// Measure pipe ping-pong latency between two processes.
+// Each round trip blocks one side in read() until the other side
+// writes, so the time per trip is dominated by how long it takes
+// a wakeup to get the sleeping process running again.
+// Run it on kernels with and without IPI wakeups to compare.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user.h"
+
+#define ROUNDS 2000
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, pid, start, elapsed;
+  int ping[2], pong[2];
+  char c;
+
+  n = ROUNDS;
+  if(argc > 1)
+    n = atoi(argv[1]);
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "pingpong: pipe failed\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(2, "pingpong: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // Echo every byte back until the parent closes its end.
+    close(ping[1]);
+    close(pong[0]);
+    while(read(ping[0], &c, 1) == 1)
+      write(pong[1], &c, 1);
+    exit();
+  }
+  close(ping[0]);
+  close(pong[1]);
+
+  c = 'x';
+  start = uptime();
+  for(i = 0; i < n; i++){
+    write(ping[1], &c, 1);
+    if(read(pong[0], &c, 1) != 1){
+      printf(2, "pingpong: short read after %d round trips\n", i);
+      break;
+    }
+  }
+  elapsed = uptime() - start;
+  close(ping[1]);
+  wait(0);
+
+  printf(1, "pingpong: %d round trips in %d ticks", i, elapsed);
+  if(elapsed > 0)
+    printf(1, " (%d per tick)", i / elapsed);
+  printf(1, "\n");
+  exit();
+}
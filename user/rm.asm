@@ -0,0 +1,1131 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int i;
+
+  if(argc < 2){
+  19:	83 c3 04             	add    $0x4,%ebx
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  1c:	be 01 00 00 00       	mov    $0x1,%esi
+  if(argc < 2){
+  21:	83 ff 01             	cmp    $0x1,%edi
+  24:	7e 1d                	jle    43 <main+0x43>
+    if(unlink(argv[i]) < 0){
+  26:	83 ec 0c             	sub    $0xc,%esp
+  29:	ff 33                	push   (%ebx)
+  2b:	e8 58 02 00 00       	call   288 <unlink>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	85 c0                	test   %eax,%eax
+  35:	78 20                	js     57 <main+0x57>
+  for(i = 1; i < argc; i++){
+  37:	83 c6 01             	add    $0x1,%esi
+  3a:	83 c3 04             	add    $0x4,%ebx
+  3d:	39 f7                	cmp    %esi,%edi
+  3f:	75 e5                	jne    26 <main+0x26>
+  41:	eb 28                	jmp    6b <main+0x6b>
+    printf(2, "Usage: rm files...\n");
+  43:	83 ec 08             	sub    $0x8,%esp
+  46:	68 d8 06 00 00       	push   $0x6d8
+  4b:	6a 02                	push   $0x2
+  4d:	e8 8e 03 00 00       	call   3e0 <printf>
+    exit();
+  52:	e8 e1 01 00 00       	call   238 <exit>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  57:	83 ec 04             	sub    $0x4,%esp
+  5a:	ff 33                	push   (%ebx)
+  5c:	68 ec 06 00 00       	push   $0x6ec
+  61:	6a 02                	push   $0x2
+  63:	e8 78 03 00 00       	call   3e0 <printf>
+      break;
+  68:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  6b:	e8 c8 01 00 00       	call   238 <exit>
+
+00000070 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	53                   	push   %ebx
+  74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  7f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  83:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  86:	83 c0 01             	add    $0x1,%eax
+  89:	84 d2                	test   %dl,%dl
+  8b:	75 f2                	jne    7f <strcpy+0xf>
+    ;
+  return os;
+}
+  8d:	89 c8                	mov    %ecx,%eax
+  8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  92:	c9                   	leave
+  93:	c3                   	ret
+
+00000094 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  94:	55                   	push   %ebp
+  95:	89 e5                	mov    %esp,%ebp
+  97:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  9d:	0f b6 01             	movzbl (%ecx),%eax
+  a0:	84 c0                	test   %al,%al
+  a2:	74 11                	je     b5 <strcmp+0x21>
+  a4:	38 02                	cmp    %al,(%edx)
+  a6:	75 0d                	jne    b5 <strcmp+0x21>
+    p++, q++;
+  a8:	83 c1 01             	add    $0x1,%ecx
+  ab:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  ae:	0f b6 01             	movzbl (%ecx),%eax
+  b1:	84 c0                	test   %al,%al
+  b3:	75 ef                	jne    a4 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  b5:	0f b6 c0             	movzbl %al,%eax
+  b8:	0f b6 12             	movzbl (%edx),%edx
+  bb:	29 d0                	sub    %edx,%eax
+}
+  bd:	5d                   	pop    %ebp
+  be:	c3                   	ret
+
+000000bf <strlen>:
+
+uint
+strlen(char *s)
+{
+  bf:	55                   	push   %ebp
+  c0:	89 e5                	mov    %esp,%ebp
+  c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c5:	80 3a 00             	cmpb   $0x0,(%edx)
+  c8:	74 14                	je     de <strlen+0x1f>
+  ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  cf:	83 c0 01             	add    $0x1,%eax
+  d2:	89 c1                	mov    %eax,%ecx
+  d4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d8:	75 f5                	jne    cf <strlen+0x10>
+    ;
+  return n;
+}
+  da:	89 c8                	mov    %ecx,%eax
+  dc:	5d                   	pop    %ebp
+  dd:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  e3:	eb f5                	jmp    da <strlen+0x1b>
+
+000000e5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  e5:	55                   	push   %ebp
+  e6:	89 e5                	mov    %esp,%ebp
+  e8:	57                   	push   %edi
+  e9:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  ec:	89 d7                	mov    %edx,%edi
+  ee:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  f4:	fc                   	cld
+  f5:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  f7:	89 d0                	mov    %edx,%eax
+  f9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  fc:	c9                   	leave
+  fd:	c3                   	ret
+
+000000fe <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  fe:	55                   	push   %ebp
+  ff:	89 e5                	mov    %esp,%ebp
+ 101:	8b 45 08             	mov    0x8(%ebp),%eax
+ 104:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 108:	0f b6 10             	movzbl (%eax),%edx
+ 10b:	84 d2                	test   %dl,%dl
+ 10d:	74 15                	je     124 <strchr+0x26>
+    if(*s == c)
+ 10f:	38 d1                	cmp    %dl,%cl
+ 111:	74 0f                	je     122 <strchr+0x24>
+  for(; *s; s++)
+ 113:	83 c0 01             	add    $0x1,%eax
+ 116:	0f b6 10             	movzbl (%eax),%edx
+ 119:	84 d2                	test   %dl,%dl
+ 11b:	75 f2                	jne    10f <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 11d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 122:	5d                   	pop    %ebp
+ 123:	c3                   	ret
+  return 0;
+ 124:	b8 00 00 00 00       	mov    $0x0,%eax
+ 129:	eb f7                	jmp    122 <strchr+0x24>
+
+0000012b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 12b:	55                   	push   %ebp
+ 12c:	89 e5                	mov    %esp,%ebp
+ 12e:	57                   	push   %edi
+ 12f:	56                   	push   %esi
+ 130:	53                   	push   %ebx
+ 131:	83 ec 2c             	sub    $0x2c,%esp
+ 134:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 137:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 13c:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 13f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 142:	83 c3 01             	add    $0x1,%ebx
+ 145:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 148:	7d 27                	jge    171 <gets+0x46>
+    cc = read(0, &c, 1);
+ 14a:	83 ec 04             	sub    $0x4,%esp
+ 14d:	6a 01                	push   $0x1
+ 14f:	57                   	push   %edi
+ 150:	6a 00                	push   $0x0
+ 152:	e8 f9 00 00 00       	call   250 <read>
+    if(cc < 1)
+ 157:	83 c4 10             	add    $0x10,%esp
+ 15a:	85 c0                	test   %eax,%eax
+ 15c:	7e 13                	jle    171 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 15e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 162:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 166:	3c 0a                	cmp    $0xa,%al
+ 168:	74 04                	je     16e <gets+0x43>
+ 16a:	3c 0d                	cmp    $0xd,%al
+ 16c:	75 d1                	jne    13f <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 16e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 171:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 174:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 178:	89 f0                	mov    %esi,%eax
+ 17a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 17d:	5b                   	pop    %ebx
+ 17e:	5e                   	pop    %esi
+ 17f:	5f                   	pop    %edi
+ 180:	5d                   	pop    %ebp
+ 181:	c3                   	ret
+
+00000182 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 182:	55                   	push   %ebp
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	56                   	push   %esi
+ 186:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 187:	83 ec 08             	sub    $0x8,%esp
+ 18a:	6a 00                	push   $0x0
+ 18c:	ff 75 08             	push   0x8(%ebp)
+ 18f:	e8 e4 00 00 00       	call   278 <open>
+  if(fd < 0)
+ 194:	83 c4 10             	add    $0x10,%esp
+ 197:	85 c0                	test   %eax,%eax
+ 199:	78 24                	js     1bf <stat+0x3d>
+ 19b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 19d:	83 ec 08             	sub    $0x8,%esp
+ 1a0:	ff 75 0c             	push   0xc(%ebp)
+ 1a3:	50                   	push   %eax
+ 1a4:	e8 e7 00 00 00       	call   290 <fstat>
+ 1a9:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1ab:	89 1c 24             	mov    %ebx,(%esp)
+ 1ae:	e8 ad 00 00 00       	call   260 <close>
+  return r;
+ 1b3:	83 c4 10             	add    $0x10,%esp
+}
+ 1b6:	89 f0                	mov    %esi,%eax
+ 1b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1bb:	5b                   	pop    %ebx
+ 1bc:	5e                   	pop    %esi
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+    return -1;
+ 1bf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1c4:	eb f0                	jmp    1b6 <stat+0x34>
+
+000001c6 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1c6:	55                   	push   %ebp
+ 1c7:	89 e5                	mov    %esp,%ebp
+ 1c9:	53                   	push   %ebx
+ 1ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 1cd:	0f b6 02             	movzbl (%edx),%eax
+ 1d0:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1d3:	80 f9 09             	cmp    $0x9,%cl
+ 1d6:	77 24                	ja     1fc <atoi+0x36>
+  n = 0;
+ 1d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 1dd:	83 c2 01             	add    $0x1,%edx
+ 1e0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 1e3:	0f be c0             	movsbl %al,%eax
+ 1e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 1ea:	0f b6 02             	movzbl (%edx),%eax
+ 1ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 1f0:	80 fb 09             	cmp    $0x9,%bl
+ 1f3:	76 e8                	jbe    1dd <atoi+0x17>
+  return n;
+}
+ 1f5:	89 c8                	mov    %ecx,%eax
+ 1f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fa:	c9                   	leave
+ 1fb:	c3                   	ret
+  n = 0;
+ 1fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 201:	eb f2                	jmp    1f5 <atoi+0x2f>
+
+00000203 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 203:	55                   	push   %ebp
+ 204:	89 e5                	mov    %esp,%ebp
+ 206:	56                   	push   %esi
+ 207:	53                   	push   %ebx
+ 208:	8b 75 08             	mov    0x8(%ebp),%esi
+ 20b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 20e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 211:	85 db                	test   %ebx,%ebx
+ 213:	7e 15                	jle    22a <memmove+0x27>
+ 215:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 217:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 219:	83 c2 01             	add    $0x1,%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 223:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 226:	39 c3                	cmp    %eax,%ebx
+ 228:	75 ef                	jne    219 <memmove+0x16>
+  return vdst;
+}
+ 22a:	89 f0                	mov    %esi,%eax
+ 22c:	5b                   	pop    %ebx
+ 22d:	5e                   	pop    %esi
+ 22e:	5d                   	pop    %ebp
+ 22f:	c3                   	ret
+
+00000230 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 230:	b8 01 00 00 00       	mov    $0x1,%eax
+ 235:	cd 40                	int    $0x40
+ 237:	c3                   	ret
+
+00000238 <exit>:
+SYSCALL(exit)
+ 238:	b8 02 00 00 00       	mov    $0x2,%eax
+ 23d:	cd 40                	int    $0x40
+ 23f:	c3                   	ret
+
+00000240 <wait>:
+SYSCALL(wait)
+ 240:	b8 03 00 00 00       	mov    $0x3,%eax
+ 245:	cd 40                	int    $0x40
+ 247:	c3                   	ret
+
+00000248 <pipe>:
+SYSCALL(pipe)
+ 248:	b8 04 00 00 00       	mov    $0x4,%eax
+ 24d:	cd 40                	int    $0x40
+ 24f:	c3                   	ret
+
+00000250 <read>:
+SYSCALL(read)
+ 250:	b8 05 00 00 00       	mov    $0x5,%eax
+ 255:	cd 40                	int    $0x40
+ 257:	c3                   	ret
+
+00000258 <write>:
+SYSCALL(write)
+ 258:	b8 10 00 00 00       	mov    $0x10,%eax
+ 25d:	cd 40                	int    $0x40
+ 25f:	c3                   	ret
+
+00000260 <close>:
+SYSCALL(close)
+ 260:	b8 15 00 00 00       	mov    $0x15,%eax
+ 265:	cd 40                	int    $0x40
+ 267:	c3                   	ret
+
+00000268 <kill>:
+SYSCALL(kill)
+ 268:	b8 06 00 00 00       	mov    $0x6,%eax
+ 26d:	cd 40                	int    $0x40
+ 26f:	c3                   	ret
+
+00000270 <exec>:
+SYSCALL(exec)
+ 270:	b8 07 00 00 00       	mov    $0x7,%eax
+ 275:	cd 40                	int    $0x40
+ 277:	c3                   	ret
+
+00000278 <open>:
+SYSCALL(open)
+ 278:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 27d:	cd 40                	int    $0x40
+ 27f:	c3                   	ret
+
+00000280 <mknod>:
+SYSCALL(mknod)
+ 280:	b8 11 00 00 00       	mov    $0x11,%eax
+ 285:	cd 40                	int    $0x40
+ 287:	c3                   	ret
+
+00000288 <unlink>:
+SYSCALL(unlink)
+ 288:	b8 12 00 00 00       	mov    $0x12,%eax
+ 28d:	cd 40                	int    $0x40
+ 28f:	c3                   	ret
+
+00000290 <fstat>:
+SYSCALL(fstat)
+ 290:	b8 08 00 00 00       	mov    $0x8,%eax
+ 295:	cd 40                	int    $0x40
+ 297:	c3                   	ret
+
+00000298 <link>:
+SYSCALL(link)
+ 298:	b8 13 00 00 00       	mov    $0x13,%eax
+ 29d:	cd 40                	int    $0x40
+ 29f:	c3                   	ret
+
+000002a0 <mkdir>:
+SYSCALL(mkdir)
+ 2a0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2a5:	cd 40                	int    $0x40
+ 2a7:	c3                   	ret
+
+000002a8 <chdir>:
+SYSCALL(chdir)
+ 2a8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2ad:	cd 40                	int    $0x40
+ 2af:	c3                   	ret
+
+000002b0 <dup>:
+SYSCALL(dup)
+ 2b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2b5:	cd 40                	int    $0x40
+ 2b7:	c3                   	ret
+
+000002b8 <getpid>:
+SYSCALL(getpid)
+ 2b8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2bd:	cd 40                	int    $0x40
+ 2bf:	c3                   	ret
+
+000002c0 <sbrk>:
+SYSCALL(sbrk)
+ 2c0:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2c5:	cd 40                	int    $0x40
+ 2c7:	c3                   	ret
+
+000002c8 <sleep>:
+SYSCALL(sleep)
+ 2c8:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2cd:	cd 40                	int    $0x40
+ 2cf:	c3                   	ret
+
+000002d0 <uptime>:
+SYSCALL(uptime)
+ 2d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2d5:	cd 40                	int    $0x40
+ 2d7:	c3                   	ret
+
+000002d8 <readmouse>:
+SYSCALL(readmouse)
+ 2d8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2dd:	cd 40                	int    $0x40
+ 2df:	c3                   	ret
+
+000002e0 <sigsend>:
+SYSCALL(sigsend)
+ 2e0:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2e5:	cd 40                	int    $0x40
+ 2e7:	c3                   	ret
+
+000002e8 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 2e8:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2ed:	cd 40                	int    $0x40
+ 2ef:	c3                   	ret
+
+000002f0 <sigreturn>:
+SYSCALL(sigreturn)
+ 2f0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2f5:	cd 40                	int    $0x40
+ 2f7:	c3                   	ret
+
+000002f8 <siggetmask>:
+SYSCALL(siggetmask)
+ 2f8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2fd:	cd 40                	int    $0x40
+ 2ff:	c3                   	ret
+
+00000300 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 300:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 305:	cd 40                	int    $0x40
+ 307:	c3                   	ret
+
+00000308 <sigpause>:
+SYSCALL(sigpause)
+ 308:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 30d:	cd 40                	int    $0x40
+ 30f:	c3                   	ret
+
+00000310 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 310:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 315:	cd 40                	int    $0x40
+ 317:	c3                   	ret
+
+00000318 <sleeptick>:
+SYSCALL(sleeptick)
+ 318:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 31d:	cd 40                	int    $0x40
+ 31f:	c3                   	ret
+
+00000320 <schedctl>:
+SYSCALL(schedctl)
+ 320:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 325:	cd 40                	int    $0x40
+ 327:	c3                   	ret
+
+00000328 <nswtch>:
+SYSCALL(nswtch)
+ 328:	b8 20 00 00 00       	mov    $0x20,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <getloadavg>:
+SYSCALL(getloadavg)
+ 330:	b8 21 00 00 00       	mov    $0x21,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <memstat>:
+SYSCALL(memstat)
+ 338:	b8 22 00 00 00       	mov    $0x22,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <iostat>:
+SYSCALL(iostat)
+ 340:	b8 23 00 00 00       	mov    $0x23,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 348:	55                   	push   %ebp
+ 349:	89 e5                	mov    %esp,%ebp
+ 34b:	57                   	push   %edi
+ 34c:	56                   	push   %esi
+ 34d:	53                   	push   %ebx
+ 34e:	83 ec 3c             	sub    $0x3c,%esp
+ 351:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 354:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 356:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 35a:	74 79                	je     3d5 <printint+0x8d>
+ 35c:	85 d2                	test   %edx,%edx
+ 35e:	79 75                	jns    3d5 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 360:	89 d1                	mov    %edx,%ecx
+ 362:	f7 d9                	neg    %ecx
+    neg = 1;
+ 364:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 36b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 370:	89 df                	mov    %ebx,%edi
+ 372:	83 c3 01             	add    $0x1,%ebx
+ 375:	89 c8                	mov    %ecx,%eax
+ 377:	ba 00 00 00 00       	mov    $0x0,%edx
+ 37c:	f7 f6                	div    %esi
+ 37e:	0f b6 92 64 07 00 00 	movzbl 0x764(%edx),%edx
+ 385:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 389:	89 ca                	mov    %ecx,%edx
+ 38b:	89 c1                	mov    %eax,%ecx
+ 38d:	39 f2                	cmp    %esi,%edx
+ 38f:	73 df                	jae    370 <printint+0x28>
+  if(neg)
+ 391:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 395:	74 08                	je     39f <printint+0x57>
+    buf[i++] = '-';
+ 397:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 39c:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 39f:	85 db                	test   %ebx,%ebx
+ 3a1:	7e 2a                	jle    3cd <printint+0x85>
+ 3a3:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 3a6:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 3aa:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 3ad:	0f b6 03             	movzbl (%ebx),%eax
+ 3b0:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 3b3:	83 ec 04             	sub    $0x4,%esp
+ 3b6:	6a 01                	push   $0x1
+ 3b8:	57                   	push   %edi
+ 3b9:	ff 75 c4             	push   -0x3c(%ebp)
+ 3bc:	e8 97 fe ff ff       	call   258 <write>
+  while(--i >= 0)
+ 3c1:	89 d8                	mov    %ebx,%eax
+ 3c3:	83 eb 01             	sub    $0x1,%ebx
+ 3c6:	83 c4 10             	add    $0x10,%esp
+ 3c9:	39 f0                	cmp    %esi,%eax
+ 3cb:	75 e0                	jne    3ad <printint+0x65>
+}
+ 3cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3d0:	5b                   	pop    %ebx
+ 3d1:	5e                   	pop    %esi
+ 3d2:	5f                   	pop    %edi
+ 3d3:	5d                   	pop    %ebp
+ 3d4:	c3                   	ret
+    x = xx;
+ 3d5:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 3d7:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 3de:	eb 8b                	jmp    36b <printint+0x23>
+
+000003e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	53                   	push   %ebx
+ 3e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 3e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3ec:	0f b6 1e             	movzbl (%esi),%ebx
+ 3ef:	84 db                	test   %bl,%bl
+ 3f1:	0f 84 9e 01 00 00    	je     595 <printf+0x1b5>
+ 3f7:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 3fa:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 400:	bf 00 00 00 00       	mov    $0x0,%edi
+ 405:	eb 2d                	jmp    434 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 407:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 40a:	83 ec 04             	sub    $0x4,%esp
+ 40d:	6a 01                	push   $0x1
+ 40f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 412:	50                   	push   %eax
+ 413:	ff 75 08             	push   0x8(%ebp)
+ 416:	e8 3d fe ff ff       	call   258 <write>
+        putc(fd, c);
+ 41b:	83 c4 10             	add    $0x10,%esp
+ 41e:	eb 05                	jmp    425 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 420:	83 ff 25             	cmp    $0x25,%edi
+ 423:	74 1f                	je     444 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 425:	83 c6 01             	add    $0x1,%esi
+ 428:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 42c:	84 db                	test   %bl,%bl
+ 42e:	0f 84 61 01 00 00    	je     595 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 434:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 437:	85 ff                	test   %edi,%edi
+ 439:	75 e5                	jne    420 <printf+0x40>
+      if(c == '%'){
+ 43b:	83 f8 25             	cmp    $0x25,%eax
+ 43e:	75 c7                	jne    407 <printf+0x27>
+        state = '%';
+ 440:	89 c7                	mov    %eax,%edi
+ 442:	eb e1                	jmp    425 <printf+0x45>
+      if(c == 'd'){
+ 444:	83 f8 25             	cmp    $0x25,%eax
+ 447:	0f 84 f4 00 00 00    	je     541 <printf+0x161>
+ 44d:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 450:	83 fa 15             	cmp    $0x15,%edx
+ 453:	0f 87 09 01 00 00    	ja     562 <printf+0x182>
+ 459:	0f 87 03 01 00 00    	ja     562 <printf+0x182>
+ 45f:	ff 24 95 0c 07 00 00 	jmp    *0x70c(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 466:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 469:	8b 17                	mov    (%edi),%edx
+ 46b:	83 ec 0c             	sub    $0xc,%esp
+ 46e:	6a 01                	push   $0x1
+ 470:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 475:	8b 45 08             	mov    0x8(%ebp),%eax
+ 478:	e8 cb fe ff ff       	call   348 <printint>
+        ap++;
+ 47d:	83 c7 04             	add    $0x4,%edi
+ 480:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 483:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 486:	bf 00 00 00 00       	mov    $0x0,%edi
+ 48b:	eb 98                	jmp    425 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 48d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 490:	8b 17                	mov    (%edi),%edx
+ 492:	83 ec 0c             	sub    $0xc,%esp
+ 495:	6a 00                	push   $0x0
+ 497:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 49c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49f:	e8 a4 fe ff ff       	call   348 <printint>
+        ap++;
+ 4a4:	83 c7 04             	add    $0x4,%edi
+ 4a7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4aa:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4ad:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4b2:	e9 6e ff ff ff       	jmp    425 <printf+0x45>
+        s = (char*)*ap;
+ 4b7:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 4ba:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 4bc:	83 c1 04             	add    $0x4,%ecx
+ 4bf:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 4c2:	85 c0                	test   %eax,%eax
+ 4c4:	74 13                	je     4d9 <printf+0xf9>
+        s = (char*)*ap;
+ 4c6:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 4c8:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 4cb:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 4d0:	84 c0                	test   %al,%al
+ 4d2:	75 0f                	jne    4e3 <printf+0x103>
+ 4d4:	e9 4c ff ff ff       	jmp    425 <printf+0x45>
+          s = "(null)";
+ 4d9:	bb 05 07 00 00       	mov    $0x705,%ebx
+        while(*s != 0){
+ 4de:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 4e3:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 4e6:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 4e9:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 4ec:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4ef:	83 ec 04             	sub    $0x4,%esp
+ 4f2:	6a 01                	push   $0x1
+ 4f4:	57                   	push   %edi
+ 4f5:	56                   	push   %esi
+ 4f6:	e8 5d fd ff ff       	call   258 <write>
+          s++;
+ 4fb:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 4fe:	0f b6 03             	movzbl (%ebx),%eax
+ 501:	83 c4 10             	add    $0x10,%esp
+ 504:	84 c0                	test   %al,%al
+ 506:	75 e4                	jne    4ec <printf+0x10c>
+      state = 0;
+ 508:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 50b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 510:	e9 10 ff ff ff       	jmp    425 <printf+0x45>
+        putc(fd, *ap);
+ 515:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 518:	8b 07                	mov    (%edi),%eax
+ 51a:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 51d:	83 ec 04             	sub    $0x4,%esp
+ 520:	6a 01                	push   $0x1
+ 522:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 525:	50                   	push   %eax
+ 526:	ff 75 08             	push   0x8(%ebp)
+ 529:	e8 2a fd ff ff       	call   258 <write>
+        ap++;
+ 52e:	83 c7 04             	add    $0x4,%edi
+ 531:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 534:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 537:	bf 00 00 00 00       	mov    $0x0,%edi
+ 53c:	e9 e4 fe ff ff       	jmp    425 <printf+0x45>
+        putc(fd, c);
+ 541:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 544:	83 ec 04             	sub    $0x4,%esp
+ 547:	6a 01                	push   $0x1
+ 549:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 54c:	50                   	push   %eax
+ 54d:	ff 75 08             	push   0x8(%ebp)
+ 550:	e8 03 fd ff ff       	call   258 <write>
+ 555:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 558:	bf 00 00 00 00       	mov    $0x0,%edi
+ 55d:	e9 c3 fe ff ff       	jmp    425 <printf+0x45>
+        putc(fd, '%');
+ 562:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 566:	83 ec 04             	sub    $0x4,%esp
+ 569:	6a 01                	push   $0x1
+ 56b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 56e:	57                   	push   %edi
+ 56f:	ff 75 08             	push   0x8(%ebp)
+ 572:	e8 e1 fc ff ff       	call   258 <write>
+        putc(fd, c);
+ 577:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 57a:	83 c4 0c             	add    $0xc,%esp
+ 57d:	6a 01                	push   $0x1
+ 57f:	57                   	push   %edi
+ 580:	ff 75 08             	push   0x8(%ebp)
+ 583:	e8 d0 fc ff ff       	call   258 <write>
+        putc(fd, c);
+ 588:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 590:	e9 90 fe ff ff       	jmp    425 <printf+0x45>
+    }
+  }
+}
+ 595:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 598:	5b                   	pop    %ebx
+ 599:	5e                   	pop    %esi
+ 59a:	5f                   	pop    %edi
+ 59b:	5d                   	pop    %ebp
+ 59c:	c3                   	ret
+
+0000059d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 59d:	55                   	push   %ebp
+ 59e:	89 e5                	mov    %esp,%ebp
+ 5a0:	57                   	push   %edi
+ 5a1:	56                   	push   %esi
+ 5a2:	53                   	push   %ebx
+ 5a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5a6:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5a9:	a1 d8 09 00 00       	mov    0x9d8,%eax
+ 5ae:	eb 0c                	jmp    5bc <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5b0:	8b 10                	mov    (%eax),%edx
+ 5b2:	39 d0                	cmp    %edx,%eax
+ 5b4:	72 04                	jb     5ba <free+0x1d>
+ 5b6:	39 d1                	cmp    %edx,%ecx
+ 5b8:	72 10                	jb     5ca <free+0x2d>
+{
+ 5ba:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5bc:	39 c8                	cmp    %ecx,%eax
+ 5be:	73 f0                	jae    5b0 <free+0x13>
+ 5c0:	8b 10                	mov    (%eax),%edx
+ 5c2:	39 d1                	cmp    %edx,%ecx
+ 5c4:	72 04                	jb     5ca <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5c6:	39 d0                	cmp    %edx,%eax
+ 5c8:	72 f0                	jb     5ba <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5ca:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5cd:	8b 10                	mov    (%eax),%edx
+ 5cf:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5d2:	39 fa                	cmp    %edi,%edx
+ 5d4:	74 19                	je     5ef <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5d6:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 5d9:	8b 50 04             	mov    0x4(%eax),%edx
+ 5dc:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 5df:	39 f1                	cmp    %esi,%ecx
+ 5e1:	74 18                	je     5fb <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 5e3:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 5e5:	a3 d8 09 00 00       	mov    %eax,0x9d8
+}
+ 5ea:	5b                   	pop    %ebx
+ 5eb:	5e                   	pop    %esi
+ 5ec:	5f                   	pop    %edi
+ 5ed:	5d                   	pop    %ebp
+ 5ee:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5ef:	03 72 04             	add    0x4(%edx),%esi
+ 5f2:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5f5:	8b 10                	mov    (%eax),%edx
+ 5f7:	8b 12                	mov    (%edx),%edx
+ 5f9:	eb db                	jmp    5d6 <free+0x39>
+    p->s.size += bp->s.size;
+ 5fb:	03 53 fc             	add    -0x4(%ebx),%edx
+ 5fe:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 601:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 604:	eb dd                	jmp    5e3 <free+0x46>
+
+00000606 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 606:	55                   	push   %ebp
+ 607:	89 e5                	mov    %esp,%ebp
+ 609:	57                   	push   %edi
+ 60a:	56                   	push   %esi
+ 60b:	53                   	push   %ebx
+ 60c:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 60f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 612:	8d 58 07             	lea    0x7(%eax),%ebx
+ 615:	c1 eb 03             	shr    $0x3,%ebx
+ 618:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 61b:	8b 15 d8 09 00 00    	mov    0x9d8,%edx
+ 621:	85 d2                	test   %edx,%edx
+ 623:	74 1c                	je     641 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 625:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 627:	8b 48 04             	mov    0x4(%eax),%ecx
+ 62a:	39 d9                	cmp    %ebx,%ecx
+ 62c:	73 38                	jae    666 <malloc+0x60>
+  if(nu < 4096)
+ 62e:	be 00 10 00 00       	mov    $0x1000,%esi
+ 633:	39 f3                	cmp    %esi,%ebx
+ 635:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 638:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 63f:	eb 72                	jmp    6b3 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 641:	c7 05 d8 09 00 00 dc 	movl   $0x9dc,0x9d8
+ 648:	09 00 00 
+ 64b:	c7 05 dc 09 00 00 dc 	movl   $0x9dc,0x9dc
+ 652:	09 00 00 
+    base.s.size = 0;
+ 655:	c7 05 e0 09 00 00 00 	movl   $0x0,0x9e0
+ 65c:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 65f:	b8 dc 09 00 00       	mov    $0x9dc,%eax
+    if(p->s.size >= nunits){
+ 664:	eb c8                	jmp    62e <malloc+0x28>
+      if(p->s.size == nunits)
+ 666:	39 cb                	cmp    %ecx,%ebx
+ 668:	74 1e                	je     688 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 66a:	29 d9                	sub    %ebx,%ecx
+ 66c:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 66f:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 672:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 675:	89 15 d8 09 00 00    	mov    %edx,0x9d8
+      return (void*)(p + 1);
+ 67b:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 67e:	89 d0                	mov    %edx,%eax
+ 680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 683:	5b                   	pop    %ebx
+ 684:	5e                   	pop    %esi
+ 685:	5f                   	pop    %edi
+ 686:	5d                   	pop    %ebp
+ 687:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 688:	8b 08                	mov    (%eax),%ecx
+ 68a:	89 0a                	mov    %ecx,(%edx)
+ 68c:	eb e7                	jmp    675 <malloc+0x6f>
+  hp->s.size = nu;
+ 68e:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 691:	83 ec 0c             	sub    $0xc,%esp
+ 694:	83 c0 08             	add    $0x8,%eax
+ 697:	50                   	push   %eax
+ 698:	e8 00 ff ff ff       	call   59d <free>
+  return freep;
+ 69d:	8b 15 d8 09 00 00    	mov    0x9d8,%edx
+      if((p = morecore(nunits)) == 0)
+ 6a3:	83 c4 10             	add    $0x10,%esp
+ 6a6:	85 d2                	test   %edx,%edx
+ 6a8:	74 d4                	je     67e <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6aa:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6ac:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6af:	39 d9                	cmp    %ebx,%ecx
+ 6b1:	73 b3                	jae    666 <malloc+0x60>
+    if(p == freep)
+ 6b3:	89 c2                	mov    %eax,%edx
+ 6b5:	39 05 d8 09 00 00    	cmp    %eax,0x9d8
+ 6bb:	75 ed                	jne    6aa <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 6bd:	83 ec 0c             	sub    $0xc,%esp
+ 6c0:	57                   	push   %edi
+ 6c1:	e8 fa fb ff ff       	call   2c0 <sbrk>
+  if(p == (char*)-1)
+ 6c6:	83 c4 10             	add    $0x10,%esp
+ 6c9:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6cc:	75 c0                	jne    68e <malloc+0x88>
+        return 0;
+ 6ce:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6d3:	eb a9                	jmp    67e <malloc+0x78>
@@ -0,0 +1,1222 @@
+
+_schedctl:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return atoi(s);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 41 04             	mov    0x4(%ecx),%eax
+  19:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  struct schedparam sp;
+
+  sp.policy = sp.quantum = sp.aging = -1;
+  1c:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+  23:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  2a:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+  if(argc > 1)
+  31:	83 fe 01             	cmp    $0x1,%esi
+  34:	7f 47                	jg     7d <main+0x7d>
+    sp.policy = policynum(argv[1]);
+  if(argc > 2)
+    sp.quantum = tunable(argv[2]);
+  if(argc > 3)
+  36:	83 fe 03             	cmp    $0x3,%esi
+  39:	0f 8f dd 00 00 00    	jg     11c <main+0x11c>
+    sp.aging = tunable(argv[3]);
+
+  if(schedctl(&sp) < 0){
+  3f:	83 ec 0c             	sub    $0xc,%esp
+  42:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  45:	50                   	push   %eax
+  46:	e8 cb 03 00 00       	call   416 <schedctl>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	85 c0                	test   %eax,%eax
+  50:	0f 88 fc 00 00 00    	js     152 <main+0x152>
+    printf(2, "usage: schedctl [rr|spn|srt|hrrn|mlfq|- [quantum|- [aging|-]]]\n");
+    exit();
+  }
+  printf(1, "policy %s quantum %d aging %d\n",
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	ff 75 e4             	push   -0x1c(%ebp)
+  5c:	ff 75 e0             	push   -0x20(%ebp)
+  5f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  62:	ff 34 85 44 08 00 00 	push   0x844(,%eax,4)
+  69:	68 24 08 00 00       	push   $0x824
+  6e:	6a 01                	push   $0x1
+  70:	e8 61 04 00 00       	call   4d6 <printf>
+         names[sp.policy], sp.quantum, sp.aging);
+  exit();
+  75:	83 c4 20             	add    $0x20,%esp
+  78:	e8 b1 02 00 00       	call   32e <exit>
+    sp.policy = policynum(argv[1]);
+  7d:	8b 78 04             	mov    0x4(%eax),%edi
+  if(strcmp(s, "-") == 0)
+  80:	83 ec 08             	sub    $0x8,%esp
+  83:	68 cc 07 00 00       	push   $0x7cc
+  88:	57                   	push   %edi
+  89:	e8 fc 00 00 00       	call   18a <strcmp>
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	85 c0                	test   %eax,%eax
+  93:	74 79                	je     10e <main+0x10e>
+  for(i = 0; i < NSCHED; i++)
+  95:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(strcmp(s, names[i]) == 0)
+  9a:	83 ec 08             	sub    $0x8,%esp
+  9d:	ff 34 9d 44 08 00 00 	push   0x844(,%ebx,4)
+  a4:	57                   	push   %edi
+  a5:	e8 e0 00 00 00       	call   18a <strcmp>
+  aa:	83 c4 10             	add    $0x10,%esp
+  ad:	85 c0                	test   %eax,%eax
+  af:	74 12                	je     c3 <main+0xc3>
+  for(i = 0; i < NSCHED; i++)
+  b1:	83 c3 01             	add    $0x1,%ebx
+  b4:	83 fb 05             	cmp    $0x5,%ebx
+  b7:	75 e1                	jne    9a <main+0x9a>
+  if(*s >= '0' && *s <= '9')
+  b9:	0f b6 07             	movzbl (%edi),%eax
+  bc:	83 e8 30             	sub    $0x30,%eax
+  bf:	3c 09                	cmp    $0x9,%al
+  c1:	76 3b                	jbe    fe <main+0xfe>
+    sp.policy = policynum(argv[1]);
+  c3:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+  if(argc > 2)
+  c6:	83 fe 02             	cmp    $0x2,%esi
+  c9:	0f 8e 70 ff ff ff    	jle    3f <main+0x3f>
+    sp.quantum = tunable(argv[2]);
+  cf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  d2:	8b 58 08             	mov    0x8(%eax),%ebx
+  if(strcmp(s, "-") == 0)
+  d5:	83 ec 08             	sub    $0x8,%esp
+  d8:	68 cc 07 00 00       	push   $0x7cc
+  dd:	53                   	push   %ebx
+  de:	e8 a7 00 00 00       	call   18a <strcmp>
+  e3:	83 c4 10             	add    $0x10,%esp
+  e6:	85 c0                	test   %eax,%eax
+  e8:	74 2b                	je     115 <main+0x115>
+  return atoi(s);
+  ea:	83 ec 0c             	sub    $0xc,%esp
+  ed:	53                   	push   %ebx
+  ee:	e8 c9 01 00 00       	call   2bc <atoi>
+  f3:	83 c4 10             	add    $0x10,%esp
+    sp.quantum = tunable(argv[2]);
+  f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  f9:	e9 38 ff ff ff       	jmp    36 <main+0x36>
+    return atoi(s);
+  fe:	83 ec 0c             	sub    $0xc,%esp
+ 101:	57                   	push   %edi
+ 102:	e8 b5 01 00 00       	call   2bc <atoi>
+ 107:	89 c3                	mov    %eax,%ebx
+ 109:	83 c4 10             	add    $0x10,%esp
+ 10c:	eb b5                	jmp    c3 <main+0xc3>
+    return -1;
+ 10e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ 113:	eb ae                	jmp    c3 <main+0xc3>
+    return -1;
+ 115:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 11a:	eb da                	jmp    f6 <main+0xf6>
+    sp.aging = tunable(argv[3]);
+ 11c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 11f:	8b 58 0c             	mov    0xc(%eax),%ebx
+  if(strcmp(s, "-") == 0)
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	68 cc 07 00 00       	push   $0x7cc
+ 12a:	53                   	push   %ebx
+ 12b:	e8 5a 00 00 00       	call   18a <strcmp>
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	85 c0                	test   %eax,%eax
+ 135:	74 14                	je     14b <main+0x14b>
+  return atoi(s);
+ 137:	83 ec 0c             	sub    $0xc,%esp
+ 13a:	53                   	push   %ebx
+ 13b:	e8 7c 01 00 00       	call   2bc <atoi>
+ 140:	83 c4 10             	add    $0x10,%esp
+    sp.aging = tunable(argv[3]);
+ 143:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 146:	e9 f4 fe ff ff       	jmp    3f <main+0x3f>
+    return -1;
+ 14b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 150:	eb f1                	jmp    143 <main+0x143>
+    printf(2, "usage: schedctl [rr|spn|srt|hrrn|mlfq|- [quantum|- [aging|-]]]\n");
+ 152:	83 ec 08             	sub    $0x8,%esp
+ 155:	68 e4 07 00 00       	push   $0x7e4
+ 15a:	6a 02                	push   $0x2
+ 15c:	e8 75 03 00 00       	call   4d6 <printf>
+    exit();
+ 161:	e8 c8 01 00 00       	call   32e <exit>
+
+00000166 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	53                   	push   %ebx
+ 16a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 16d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 170:	b8 00 00 00 00       	mov    $0x0,%eax
+ 175:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 179:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	75 f2                	jne    175 <strcpy+0xf>
+    ;
+  return os;
+}
+ 183:	89 c8                	mov    %ecx,%eax
+ 185:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 188:	c9                   	leave
+ 189:	c3                   	ret
+
+0000018a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 18a:	55                   	push   %ebp
+ 18b:	89 e5                	mov    %esp,%ebp
+ 18d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 193:	0f b6 01             	movzbl (%ecx),%eax
+ 196:	84 c0                	test   %al,%al
+ 198:	74 11                	je     1ab <strcmp+0x21>
+ 19a:	38 02                	cmp    %al,(%edx)
+ 19c:	75 0d                	jne    1ab <strcmp+0x21>
+    p++, q++;
+ 19e:	83 c1 01             	add    $0x1,%ecx
+ 1a1:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 1a4:	0f b6 01             	movzbl (%ecx),%eax
+ 1a7:	84 c0                	test   %al,%al
+ 1a9:	75 ef                	jne    19a <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 1ab:	0f b6 c0             	movzbl %al,%eax
+ 1ae:	0f b6 12             	movzbl (%edx),%edx
+ 1b1:	29 d0                	sub    %edx,%eax
+}
+ 1b3:	5d                   	pop    %ebp
+ 1b4:	c3                   	ret
+
+000001b5 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1b5:	55                   	push   %ebp
+ 1b6:	89 e5                	mov    %esp,%ebp
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1bb:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1be:	74 14                	je     1d4 <strlen+0x1f>
+ 1c0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1c5:	83 c0 01             	add    $0x1,%eax
+ 1c8:	89 c1                	mov    %eax,%ecx
+ 1ca:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1ce:	75 f5                	jne    1c5 <strlen+0x10>
+    ;
+  return n;
+}
+ 1d0:	89 c8                	mov    %ecx,%eax
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 1d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1d9:	eb f5                	jmp    1d0 <strlen+0x1b>
+
+000001db <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1db:	55                   	push   %ebp
+ 1dc:	89 e5                	mov    %esp,%ebp
+ 1de:	57                   	push   %edi
+ 1df:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e2:	89 d7                	mov    %edx,%edi
+ 1e4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ea:	fc                   	cld
+ 1eb:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1ed:	89 d0                	mov    %edx,%eax
+ 1ef:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f2:	c9                   	leave
+ 1f3:	c3                   	ret
+
+000001f4 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f4:	55                   	push   %ebp
+ 1f5:	89 e5                	mov    %esp,%ebp
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fe:	0f b6 10             	movzbl (%eax),%edx
+ 201:	84 d2                	test   %dl,%dl
+ 203:	74 15                	je     21a <strchr+0x26>
+    if(*s == c)
+ 205:	38 d1                	cmp    %dl,%cl
+ 207:	74 0f                	je     218 <strchr+0x24>
+  for(; *s; s++)
+ 209:	83 c0 01             	add    $0x1,%eax
+ 20c:	0f b6 10             	movzbl (%eax),%edx
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	75 f2                	jne    205 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 213:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 218:	5d                   	pop    %ebp
+ 219:	c3                   	ret
+  return 0;
+ 21a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 21f:	eb f7                	jmp    218 <strchr+0x24>
+
+00000221 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 221:	55                   	push   %ebp
+ 222:	89 e5                	mov    %esp,%ebp
+ 224:	57                   	push   %edi
+ 225:	56                   	push   %esi
+ 226:	53                   	push   %ebx
+ 227:	83 ec 2c             	sub    $0x2c,%esp
+ 22a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 22d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 232:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 235:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 238:	83 c3 01             	add    $0x1,%ebx
+ 23b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23e:	7d 27                	jge    267 <gets+0x46>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	57                   	push   %edi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 f9 00 00 00       	call   346 <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 13                	jle    267 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25c:	3c 0a                	cmp    $0xa,%al
+ 25e:	74 04                	je     264 <gets+0x43>
+ 260:	3c 0d                	cmp    $0xd,%al
+ 262:	75 d1                	jne    235 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 264:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 267:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 26a:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 26e:	89 f0                	mov    %esi,%eax
+ 270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 273:	5b                   	pop    %ebx
+ 274:	5e                   	pop    %esi
+ 275:	5f                   	pop    %edi
+ 276:	5d                   	pop    %ebp
+ 277:	c3                   	ret
+
+00000278 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 278:	55                   	push   %ebp
+ 279:	89 e5                	mov    %esp,%ebp
+ 27b:	56                   	push   %esi
+ 27c:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 27d:	83 ec 08             	sub    $0x8,%esp
+ 280:	6a 00                	push   $0x0
+ 282:	ff 75 08             	push   0x8(%ebp)
+ 285:	e8 e4 00 00 00       	call   36e <open>
+  if(fd < 0)
+ 28a:	83 c4 10             	add    $0x10,%esp
+ 28d:	85 c0                	test   %eax,%eax
+ 28f:	78 24                	js     2b5 <stat+0x3d>
+ 291:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 293:	83 ec 08             	sub    $0x8,%esp
+ 296:	ff 75 0c             	push   0xc(%ebp)
+ 299:	50                   	push   %eax
+ 29a:	e8 e7 00 00 00       	call   386 <fstat>
+ 29f:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2a1:	89 1c 24             	mov    %ebx,(%esp)
+ 2a4:	e8 ad 00 00 00       	call   356 <close>
+  return r;
+ 2a9:	83 c4 10             	add    $0x10,%esp
+}
+ 2ac:	89 f0                	mov    %esi,%eax
+ 2ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2b1:	5b                   	pop    %ebx
+ 2b2:	5e                   	pop    %esi
+ 2b3:	5d                   	pop    %ebp
+ 2b4:	c3                   	ret
+    return -1;
+ 2b5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2ba:	eb f0                	jmp    2ac <stat+0x34>
+
+000002bc <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2bc:	55                   	push   %ebp
+ 2bd:	89 e5                	mov    %esp,%ebp
+ 2bf:	53                   	push   %ebx
+ 2c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2c3:	0f b6 02             	movzbl (%edx),%eax
+ 2c6:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2c9:	80 f9 09             	cmp    $0x9,%cl
+ 2cc:	77 24                	ja     2f2 <atoi+0x36>
+  n = 0;
+ 2ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 2d3:	83 c2 01             	add    $0x1,%edx
+ 2d6:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d9:	0f be c0             	movsbl %al,%eax
+ 2dc:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2e0:	0f b6 02             	movzbl (%edx),%eax
+ 2e3:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2e6:	80 fb 09             	cmp    $0x9,%bl
+ 2e9:	76 e8                	jbe    2d3 <atoi+0x17>
+  return n;
+}
+ 2eb:	89 c8                	mov    %ecx,%eax
+ 2ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f0:	c9                   	leave
+ 2f1:	c3                   	ret
+  n = 0;
+ 2f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2f7:	eb f2                	jmp    2eb <atoi+0x2f>
+
+000002f9 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2f9:	55                   	push   %ebp
+ 2fa:	89 e5                	mov    %esp,%ebp
+ 2fc:	56                   	push   %esi
+ 2fd:	53                   	push   %ebx
+ 2fe:	8b 75 08             	mov    0x8(%ebp),%esi
+ 301:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 304:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 307:	85 db                	test   %ebx,%ebx
+ 309:	7e 15                	jle    320 <memmove+0x27>
+ 30b:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 30d:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 30f:	83 c2 01             	add    $0x1,%edx
+ 312:	83 c0 01             	add    $0x1,%eax
+ 315:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 319:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 31c:	39 c3                	cmp    %eax,%ebx
+ 31e:	75 ef                	jne    30f <memmove+0x16>
+  return vdst;
+}
+ 320:	89 f0                	mov    %esi,%eax
+ 322:	5b                   	pop    %ebx
+ 323:	5e                   	pop    %esi
+ 324:	5d                   	pop    %ebp
+ 325:	c3                   	ret
+
+00000326 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 326:	b8 01 00 00 00       	mov    $0x1,%eax
+ 32b:	cd 40                	int    $0x40
+ 32d:	c3                   	ret
+
+0000032e <exit>:
+SYSCALL(exit)
+ 32e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 333:	cd 40                	int    $0x40
+ 335:	c3                   	ret
+
+00000336 <wait>:
+SYSCALL(wait)
+ 336:	b8 03 00 00 00       	mov    $0x3,%eax
+ 33b:	cd 40                	int    $0x40
+ 33d:	c3                   	ret
+
+0000033e <pipe>:
+SYSCALL(pipe)
+ 33e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <read>:
+SYSCALL(read)
+ 346:	b8 05 00 00 00       	mov    $0x5,%eax
+ 34b:	cd 40                	int    $0x40
+ 34d:	c3                   	ret
+
+0000034e <write>:
+SYSCALL(write)
+ 34e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 353:	cd 40                	int    $0x40
+ 355:	c3                   	ret
+
+00000356 <close>:
+SYSCALL(close)
+ 356:	b8 15 00 00 00       	mov    $0x15,%eax
+ 35b:	cd 40                	int    $0x40
+ 35d:	c3                   	ret
+
+0000035e <kill>:
+SYSCALL(kill)
+ 35e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 363:	cd 40                	int    $0x40
+ 365:	c3                   	ret
+
+00000366 <exec>:
+SYSCALL(exec)
+ 366:	b8 07 00 00 00       	mov    $0x7,%eax
+ 36b:	cd 40                	int    $0x40
+ 36d:	c3                   	ret
+
+0000036e <open>:
+SYSCALL(open)
+ 36e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <mknod>:
+SYSCALL(mknod)
+ 376:	b8 11 00 00 00       	mov    $0x11,%eax
+ 37b:	cd 40                	int    $0x40
+ 37d:	c3                   	ret
+
+0000037e <unlink>:
+SYSCALL(unlink)
+ 37e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <fstat>:
+SYSCALL(fstat)
+ 386:	b8 08 00 00 00       	mov    $0x8,%eax
+ 38b:	cd 40                	int    $0x40
+ 38d:	c3                   	ret
+
+0000038e <link>:
+SYSCALL(link)
+ 38e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <mkdir>:
+SYSCALL(mkdir)
+ 396:	b8 14 00 00 00       	mov    $0x14,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <chdir>:
+SYSCALL(chdir)
+ 39e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <dup>:
+SYSCALL(dup)
+ 3a6:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <getpid>:
+SYSCALL(getpid)
+ 3ae:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <sbrk>:
+SYSCALL(sbrk)
+ 3b6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <sleep>:
+SYSCALL(sleep)
+ 3be:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <uptime>:
+SYSCALL(uptime)
+ 3c6:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <readmouse>:
+SYSCALL(readmouse)
+ 3ce:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <sigsend>:
+SYSCALL(sigsend)
+ 3d6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <sigsethandler>:
+SYSCALL(sigsethandler)
+ 3de:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <sigreturn>:
+SYSCALL(sigreturn)
+ 3e6:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <siggetmask>:
+SYSCALL(siggetmask)
+ 3ee:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 3f6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <sigpause>:
+SYSCALL(sigpause)
+ 3fe:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 406:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <sleeptick>:
+SYSCALL(sleeptick)
+ 40e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <schedctl>:
+SYSCALL(schedctl)
+ 416:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <nswtch>:
+SYSCALL(nswtch)
+ 41e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <getloadavg>:
+SYSCALL(getloadavg)
+ 426:	b8 21 00 00 00       	mov    $0x21,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <memstat>:
+SYSCALL(memstat)
+ 42e:	b8 22 00 00 00       	mov    $0x22,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <iostat>:
+SYSCALL(iostat)
+ 436:	b8 23 00 00 00       	mov    $0x23,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 43e:	55                   	push   %ebp
+ 43f:	89 e5                	mov    %esp,%ebp
+ 441:	57                   	push   %edi
+ 442:	56                   	push   %esi
+ 443:	53                   	push   %ebx
+ 444:	83 ec 3c             	sub    $0x3c,%esp
+ 447:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 44a:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 44c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 450:	74 79                	je     4cb <printint+0x8d>
+ 452:	85 d2                	test   %edx,%edx
+ 454:	79 75                	jns    4cb <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 456:	89 d1                	mov    %edx,%ecx
+ 458:	f7 d9                	neg    %ecx
+    neg = 1;
+ 45a:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 466:	89 df                	mov    %ebx,%edi
+ 468:	83 c3 01             	add    $0x1,%ebx
+ 46b:	89 c8                	mov    %ecx,%eax
+ 46d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 472:	f7 f6                	div    %esi
+ 474:	0f b6 92 b8 08 00 00 	movzbl 0x8b8(%edx),%edx
+ 47b:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 47f:	89 ca                	mov    %ecx,%edx
+ 481:	89 c1                	mov    %eax,%ecx
+ 483:	39 f2                	cmp    %esi,%edx
+ 485:	73 df                	jae    466 <printint+0x28>
+  if(neg)
+ 487:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 48b:	74 08                	je     495 <printint+0x57>
+    buf[i++] = '-';
+ 48d:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 492:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 495:	85 db                	test   %ebx,%ebx
+ 497:	7e 2a                	jle    4c3 <printint+0x85>
+ 499:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 49c:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 4a0:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 4a3:	0f b6 03             	movzbl (%ebx),%eax
+ 4a6:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 4a9:	83 ec 04             	sub    $0x4,%esp
+ 4ac:	6a 01                	push   $0x1
+ 4ae:	57                   	push   %edi
+ 4af:	ff 75 c4             	push   -0x3c(%ebp)
+ 4b2:	e8 97 fe ff ff       	call   34e <write>
+  while(--i >= 0)
+ 4b7:	89 d8                	mov    %ebx,%eax
+ 4b9:	83 eb 01             	sub    $0x1,%ebx
+ 4bc:	83 c4 10             	add    $0x10,%esp
+ 4bf:	39 f0                	cmp    %esi,%eax
+ 4c1:	75 e0                	jne    4a3 <printint+0x65>
+}
+ 4c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4c6:	5b                   	pop    %ebx
+ 4c7:	5e                   	pop    %esi
+ 4c8:	5f                   	pop    %edi
+ 4c9:	5d                   	pop    %ebp
+ 4ca:	c3                   	ret
+    x = xx;
+ 4cb:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 4cd:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 4d4:	eb 8b                	jmp    461 <printint+0x23>
+
+000004d6 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4d6:	55                   	push   %ebp
+ 4d7:	89 e5                	mov    %esp,%ebp
+ 4d9:	57                   	push   %edi
+ 4da:	56                   	push   %esi
+ 4db:	53                   	push   %ebx
+ 4dc:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4df:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4e2:	0f b6 1e             	movzbl (%esi),%ebx
+ 4e5:	84 db                	test   %bl,%bl
+ 4e7:	0f 84 9e 01 00 00    	je     68b <printf+0x1b5>
+ 4ed:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4f0:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4f3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4f6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4fb:	eb 2d                	jmp    52a <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4fd:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 500:	83 ec 04             	sub    $0x4,%esp
+ 503:	6a 01                	push   $0x1
+ 505:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 508:	50                   	push   %eax
+ 509:	ff 75 08             	push   0x8(%ebp)
+ 50c:	e8 3d fe ff ff       	call   34e <write>
+        putc(fd, c);
+ 511:	83 c4 10             	add    $0x10,%esp
+ 514:	eb 05                	jmp    51b <printf+0x45>
+      }
+    } else if(state == '%'){
+ 516:	83 ff 25             	cmp    $0x25,%edi
+ 519:	74 1f                	je     53a <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 51b:	83 c6 01             	add    $0x1,%esi
+ 51e:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 522:	84 db                	test   %bl,%bl
+ 524:	0f 84 61 01 00 00    	je     68b <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 52a:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 52d:	85 ff                	test   %edi,%edi
+ 52f:	75 e5                	jne    516 <printf+0x40>
+      if(c == '%'){
+ 531:	83 f8 25             	cmp    $0x25,%eax
+ 534:	75 c7                	jne    4fd <printf+0x27>
+        state = '%';
+ 536:	89 c7                	mov    %eax,%edi
+ 538:	eb e1                	jmp    51b <printf+0x45>
+      if(c == 'd'){
+ 53a:	83 f8 25             	cmp    $0x25,%eax
+ 53d:	0f 84 f4 00 00 00    	je     637 <printf+0x161>
+ 543:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 546:	83 fa 15             	cmp    $0x15,%edx
+ 549:	0f 87 09 01 00 00    	ja     658 <printf+0x182>
+ 54f:	0f 87 03 01 00 00    	ja     658 <printf+0x182>
+ 555:	ff 24 95 60 08 00 00 	jmp    *0x860(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 55c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 55f:	8b 17                	mov    (%edi),%edx
+ 561:	83 ec 0c             	sub    $0xc,%esp
+ 564:	6a 01                	push   $0x1
+ 566:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 56b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56e:	e8 cb fe ff ff       	call   43e <printint>
+        ap++;
+ 573:	83 c7 04             	add    $0x4,%edi
+ 576:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 579:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 57c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 581:	eb 98                	jmp    51b <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 583:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 586:	8b 17                	mov    (%edi),%edx
+ 588:	83 ec 0c             	sub    $0xc,%esp
+ 58b:	6a 00                	push   $0x0
+ 58d:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 592:	8b 45 08             	mov    0x8(%ebp),%eax
+ 595:	e8 a4 fe ff ff       	call   43e <printint>
+        ap++;
+ 59a:	83 c7 04             	add    $0x4,%edi
+ 59d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5a0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5a3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5a8:	e9 6e ff ff ff       	jmp    51b <printf+0x45>
+        s = (char*)*ap;
+ 5ad:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 5b0:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 5b2:	83 c1 04             	add    $0x4,%ecx
+ 5b5:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 5b8:	85 c0                	test   %eax,%eax
+ 5ba:	74 13                	je     5cf <printf+0xf9>
+        s = (char*)*ap;
+ 5bc:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 5be:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 5c1:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 5c6:	84 c0                	test   %al,%al
+ 5c8:	75 0f                	jne    5d9 <printf+0x103>
+ 5ca:	e9 4c ff ff ff       	jmp    51b <printf+0x45>
+          s = "(null)";
+ 5cf:	bb 58 08 00 00       	mov    $0x858,%ebx
+        while(*s != 0){
+ 5d4:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 5d9:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5dc:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5df:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 5e2:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5e5:	83 ec 04             	sub    $0x4,%esp
+ 5e8:	6a 01                	push   $0x1
+ 5ea:	57                   	push   %edi
+ 5eb:	56                   	push   %esi
+ 5ec:	e8 5d fd ff ff       	call   34e <write>
+          s++;
+ 5f1:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5f4:	0f b6 03             	movzbl (%ebx),%eax
+ 5f7:	83 c4 10             	add    $0x10,%esp
+ 5fa:	84 c0                	test   %al,%al
+ 5fc:	75 e4                	jne    5e2 <printf+0x10c>
+      state = 0;
+ 5fe:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 601:	bf 00 00 00 00       	mov    $0x0,%edi
+ 606:	e9 10 ff ff ff       	jmp    51b <printf+0x45>
+        putc(fd, *ap);
+ 60b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 60e:	8b 07                	mov    (%edi),%eax
+ 610:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 613:	83 ec 04             	sub    $0x4,%esp
+ 616:	6a 01                	push   $0x1
+ 618:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 61b:	50                   	push   %eax
+ 61c:	ff 75 08             	push   0x8(%ebp)
+ 61f:	e8 2a fd ff ff       	call   34e <write>
+        ap++;
+ 624:	83 c7 04             	add    $0x4,%edi
+ 627:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 62a:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 62d:	bf 00 00 00 00       	mov    $0x0,%edi
+ 632:	e9 e4 fe ff ff       	jmp    51b <printf+0x45>
+        putc(fd, c);
+ 637:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 63a:	83 ec 04             	sub    $0x4,%esp
+ 63d:	6a 01                	push   $0x1
+ 63f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 642:	50                   	push   %eax
+ 643:	ff 75 08             	push   0x8(%ebp)
+ 646:	e8 03 fd ff ff       	call   34e <write>
+ 64b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 653:	e9 c3 fe ff ff       	jmp    51b <printf+0x45>
+        putc(fd, '%');
+ 658:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 65c:	83 ec 04             	sub    $0x4,%esp
+ 65f:	6a 01                	push   $0x1
+ 661:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 664:	57                   	push   %edi
+ 665:	ff 75 08             	push   0x8(%ebp)
+ 668:	e8 e1 fc ff ff       	call   34e <write>
+        putc(fd, c);
+ 66d:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 670:	83 c4 0c             	add    $0xc,%esp
+ 673:	6a 01                	push   $0x1
+ 675:	57                   	push   %edi
+ 676:	ff 75 08             	push   0x8(%ebp)
+ 679:	e8 d0 fc ff ff       	call   34e <write>
+        putc(fd, c);
+ 67e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 681:	bf 00 00 00 00       	mov    $0x0,%edi
+ 686:	e9 90 fe ff ff       	jmp    51b <printf+0x45>
+    }
+  }
+}
+ 68b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 68e:	5b                   	pop    %ebx
+ 68f:	5e                   	pop    %esi
+ 690:	5f                   	pop    %edi
+ 691:	5d                   	pop    %ebp
+ 692:	c3                   	ret
+
+00000693 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 693:	55                   	push   %ebp
+ 694:	89 e5                	mov    %esp,%ebp
+ 696:	57                   	push   %edi
+ 697:	56                   	push   %esi
+ 698:	53                   	push   %ebx
+ 699:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 69c:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 69f:	a1 2c 0b 00 00       	mov    0xb2c,%eax
+ 6a4:	eb 0c                	jmp    6b2 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a6:	8b 10                	mov    (%eax),%edx
+ 6a8:	39 d0                	cmp    %edx,%eax
+ 6aa:	72 04                	jb     6b0 <free+0x1d>
+ 6ac:	39 d1                	cmp    %edx,%ecx
+ 6ae:	72 10                	jb     6c0 <free+0x2d>
+{
+ 6b0:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b2:	39 c8                	cmp    %ecx,%eax
+ 6b4:	73 f0                	jae    6a6 <free+0x13>
+ 6b6:	8b 10                	mov    (%eax),%edx
+ 6b8:	39 d1                	cmp    %edx,%ecx
+ 6ba:	72 04                	jb     6c0 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6bc:	39 d0                	cmp    %edx,%eax
+ 6be:	72 f0                	jb     6b0 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6c0:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6c3:	8b 10                	mov    (%eax),%edx
+ 6c5:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6c8:	39 fa                	cmp    %edi,%edx
+ 6ca:	74 19                	je     6e5 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6cc:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6cf:	8b 50 04             	mov    0x4(%eax),%edx
+ 6d2:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6d5:	39 f1                	cmp    %esi,%ecx
+ 6d7:	74 18                	je     6f1 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6d9:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 6db:	a3 2c 0b 00 00       	mov    %eax,0xb2c
+}
+ 6e0:	5b                   	pop    %ebx
+ 6e1:	5e                   	pop    %esi
+ 6e2:	5f                   	pop    %edi
+ 6e3:	5d                   	pop    %ebp
+ 6e4:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6e5:	03 72 04             	add    0x4(%edx),%esi
+ 6e8:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6eb:	8b 10                	mov    (%eax),%edx
+ 6ed:	8b 12                	mov    (%edx),%edx
+ 6ef:	eb db                	jmp    6cc <free+0x39>
+    p->s.size += bp->s.size;
+ 6f1:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6f4:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6f7:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6fa:	eb dd                	jmp    6d9 <free+0x46>
+
+000006fc <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6fc:	55                   	push   %ebp
+ 6fd:	89 e5                	mov    %esp,%ebp
+ 6ff:	57                   	push   %edi
+ 700:	56                   	push   %esi
+ 701:	53                   	push   %ebx
+ 702:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 705:	8b 45 08             	mov    0x8(%ebp),%eax
+ 708:	8d 58 07             	lea    0x7(%eax),%ebx
+ 70b:	c1 eb 03             	shr    $0x3,%ebx
+ 70e:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 711:	8b 15 2c 0b 00 00    	mov    0xb2c,%edx
+ 717:	85 d2                	test   %edx,%edx
+ 719:	74 1c                	je     737 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 71b:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 71d:	8b 48 04             	mov    0x4(%eax),%ecx
+ 720:	39 d9                	cmp    %ebx,%ecx
+ 722:	73 38                	jae    75c <malloc+0x60>
+  if(nu < 4096)
+ 724:	be 00 10 00 00       	mov    $0x1000,%esi
+ 729:	39 f3                	cmp    %esi,%ebx
+ 72b:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 72e:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 735:	eb 72                	jmp    7a9 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 737:	c7 05 2c 0b 00 00 30 	movl   $0xb30,0xb2c
+ 73e:	0b 00 00 
+ 741:	c7 05 30 0b 00 00 30 	movl   $0xb30,0xb30
+ 748:	0b 00 00 
+    base.s.size = 0;
+ 74b:	c7 05 34 0b 00 00 00 	movl   $0x0,0xb34
+ 752:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 755:	b8 30 0b 00 00       	mov    $0xb30,%eax
+    if(p->s.size >= nunits){
+ 75a:	eb c8                	jmp    724 <malloc+0x28>
+      if(p->s.size == nunits)
+ 75c:	39 cb                	cmp    %ecx,%ebx
+ 75e:	74 1e                	je     77e <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 760:	29 d9                	sub    %ebx,%ecx
+ 762:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 765:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 768:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 76b:	89 15 2c 0b 00 00    	mov    %edx,0xb2c
+      return (void*)(p + 1);
+ 771:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 774:	89 d0                	mov    %edx,%eax
+ 776:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 779:	5b                   	pop    %ebx
+ 77a:	5e                   	pop    %esi
+ 77b:	5f                   	pop    %edi
+ 77c:	5d                   	pop    %ebp
+ 77d:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 77e:	8b 08                	mov    (%eax),%ecx
+ 780:	89 0a                	mov    %ecx,(%edx)
+ 782:	eb e7                	jmp    76b <malloc+0x6f>
+  hp->s.size = nu;
+ 784:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 787:	83 ec 0c             	sub    $0xc,%esp
+ 78a:	83 c0 08             	add    $0x8,%eax
+ 78d:	50                   	push   %eax
+ 78e:	e8 00 ff ff ff       	call   693 <free>
+  return freep;
+ 793:	8b 15 2c 0b 00 00    	mov    0xb2c,%edx
+      if((p = morecore(nunits)) == 0)
+ 799:	83 c4 10             	add    $0x10,%esp
+ 79c:	85 d2                	test   %edx,%edx
+ 79e:	74 d4                	je     774 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7a5:	39 d9                	cmp    %ebx,%ecx
+ 7a7:	73 b3                	jae    75c <malloc+0x60>
+    if(p == freep)
+ 7a9:	89 c2                	mov    %eax,%edx
+ 7ab:	39 05 2c 0b 00 00    	cmp    %eax,0xb2c
+ 7b1:	75 ed                	jne    7a0 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	57                   	push   %edi
+ 7b7:	e8 fa fb ff ff       	call   3b6 <sbrk>
+  if(p == (char*)-1)
+ 7bc:	83 c4 10             	add    $0x10,%esp
+ 7bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7c2:	75 c0                	jne    784 <malloc+0x88>
+        return 0;
+ 7c4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7c9:	eb a9                	jmp    774 <malloc+0x78>
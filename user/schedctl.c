@@ -0,0 +1,63 @@
+// Show or change the scheduling policy and its tunables at runtime.
+//   schedctl                          print the current settings
+//   schedctl policy [quantum [aging]] switch policy, optionally
+//                                     also the quantum and MLFQ aging
+// A "-" leaves that setting unchanged.
+
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "kernel/sched.h"
+#include "user.h"
+
+static char *names[NSCHED] = {
+[SCHED_RR]    "rr",
+[SCHED_SPN]   "spn",
+[SCHED_SRT]   "srt",
+[SCHED_HRRN]  "hrrn",
+[SCHED_MLFQ]  "mlfq",
+};
+
+static int
+policynum(char *s)
+{
+  int i;
+
+  if(strcmp(s, "-") == 0)
+    return -1;
+  for(i = 0; i < NSCHED; i++)
+    if(strcmp(s, names[i]) == 0)
+      return i;
+  if(*s >= '0' && *s <= '9')
+    return atoi(s);
+  return NSCHED;
+}
+
+static int
+tunable(char *s)
+{
+  if(strcmp(s, "-") == 0)
+    return -1;
+  return atoi(s);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct schedparam sp;
+
+  sp.policy = sp.quantum = sp.aging = -1;
+  if(argc > 1)
+    sp.policy = policynum(argv[1]);
+  if(argc > 2)
+    sp.quantum = tunable(argv[2]);
+  if(argc > 3)
+    sp.aging = tunable(argv[3]);
+
+  if(schedctl(&sp) < 0){
+    printf(2, "usage: schedctl [rr|spn|srt|hrrn|mlfq|- [quantum|- [aging|-]]]\n");
+    exit();
+  }
+  printf(1, "policy %s quantum %d aging %d\n",
+         names[sp.policy], sp.quantum, sp.aging);
+  exit();
+}
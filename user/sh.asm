@@ -0,0 +1,2397 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <getcmd>:
+  exit();
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+       8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 5c 10 00 00       	push   $0x105c
+      13:	6a 02                	push   $0x2
+      15:	e8 4a 0d 00 00       	call   d64 <printf>
+  memset(buf, 0, nbuf);
+      1a:	83 c4 0c             	add    $0xc,%esp
+      1d:	56                   	push   %esi
+      1e:	6a 00                	push   $0x0
+      20:	53                   	push   %ebx
+      21:	e8 43 0a 00 00       	call   a69 <memset>
+  gets(buf, nbuf);
+      26:	83 c4 08             	add    $0x8,%esp
+      29:	56                   	push   %esi
+      2a:	53                   	push   %ebx
+      2b:	e8 7f 0a 00 00       	call   aaf <gets>
+  if(buf[0] == 0) // EOF
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	80 3b 01             	cmpb   $0x1,(%ebx)
+      36:	19 c0                	sbb    %eax,%eax
+    return -1;
+  return 0;
+}
+      38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      3b:	5b                   	pop    %ebx
+      3c:	5e                   	pop    %esi
+      3d:	5d                   	pop    %ebp
+      3e:	c3                   	ret
+
+0000003f <panic>:
+  exit();
+}
+
+void
+panic(char *s)
+{
+      3f:	55                   	push   %ebp
+      40:	89 e5                	mov    %esp,%ebp
+      42:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+      45:	ff 75 08             	push   0x8(%ebp)
+      48:	68 f9 10 00 00       	push   $0x10f9
+      4d:	6a 02                	push   $0x2
+      4f:	e8 10 0d 00 00       	call   d64 <printf>
+  exit();
+      54:	e8 63 0b 00 00       	call   bbc <exit>
+
+00000059 <fork1>:
+}
+
+int
+fork1(void)
+{
+      59:	55                   	push   %ebp
+      5a:	89 e5                	mov    %esp,%ebp
+      5c:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+      5f:	e8 50 0b 00 00       	call   bb4 <fork>
+  if(pid == -1)
+      64:	83 f8 ff             	cmp    $0xffffffff,%eax
+      67:	74 02                	je     6b <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+      69:	c9                   	leave
+      6a:	c3                   	ret
+    panic("fork");
+      6b:	83 ec 0c             	sub    $0xc,%esp
+      6e:	68 5f 10 00 00       	push   $0x105f
+      73:	e8 c7 ff ff ff       	call   3f <panic>
+
+00000078 <runcmd>:
+{
+      78:	55                   	push   %ebp
+      79:	89 e5                	mov    %esp,%ebp
+      7b:	53                   	push   %ebx
+      7c:	83 ec 14             	sub    $0x14,%esp
+      7f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+      82:	85 db                	test   %ebx,%ebx
+      84:	74 0e                	je     94 <runcmd+0x1c>
+  switch(cmd->type){
+      86:	83 3b 05             	cmpl   $0x5,(%ebx)
+      89:	77 0e                	ja     99 <runcmd+0x21>
+      8b:	8b 03                	mov    (%ebx),%eax
+      8d:	ff 24 85 14 11 00 00 	jmp    *0x1114(,%eax,4)
+    exit();
+      94:	e8 23 0b 00 00       	call   bbc <exit>
+    panic("runcmd");
+      99:	83 ec 0c             	sub    $0xc,%esp
+      9c:	68 64 10 00 00       	push   $0x1064
+      a1:	e8 99 ff ff ff       	call   3f <panic>
+    if(ecmd->argv[0] == 0)
+      a6:	8b 43 04             	mov    0x4(%ebx),%eax
+      a9:	85 c0                	test   %eax,%eax
+      ab:	74 27                	je     d4 <runcmd+0x5c>
+    exec(ecmd->argv[0], ecmd->argv);
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	8d 53 04             	lea    0x4(%ebx),%edx
+      b3:	52                   	push   %edx
+      b4:	50                   	push   %eax
+      b5:	e8 3a 0b 00 00       	call   bf4 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      ba:	83 c4 0c             	add    $0xc,%esp
+      bd:	ff 73 04             	push   0x4(%ebx)
+      c0:	68 6b 10 00 00       	push   $0x106b
+      c5:	6a 02                	push   $0x2
+      c7:	e8 98 0c 00 00       	call   d64 <printf>
+    break;
+      cc:	83 c4 10             	add    $0x10,%esp
+  exit();
+      cf:	e8 e8 0a 00 00       	call   bbc <exit>
+      exit();
+      d4:	e8 e3 0a 00 00       	call   bbc <exit>
+    close(rcmd->fd);
+      d9:	83 ec 0c             	sub    $0xc,%esp
+      dc:	ff 73 14             	push   0x14(%ebx)
+      df:	e8 00 0b 00 00       	call   be4 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+      e4:	83 c4 08             	add    $0x8,%esp
+      e7:	ff 73 10             	push   0x10(%ebx)
+      ea:	ff 73 08             	push   0x8(%ebx)
+      ed:	e8 0a 0b 00 00       	call   bfc <open>
+      f2:	83 c4 10             	add    $0x10,%esp
+      f5:	85 c0                	test   %eax,%eax
+      f7:	78 0b                	js     104 <runcmd+0x8c>
+    runcmd(rcmd->cmd);
+      f9:	83 ec 0c             	sub    $0xc,%esp
+      fc:	ff 73 04             	push   0x4(%ebx)
+      ff:	e8 74 ff ff ff       	call   78 <runcmd>
+      printf(2, "open %s failed\n", rcmd->file);
+     104:	83 ec 04             	sub    $0x4,%esp
+     107:	ff 73 08             	push   0x8(%ebx)
+     10a:	68 7b 10 00 00       	push   $0x107b
+     10f:	6a 02                	push   $0x2
+     111:	e8 4e 0c 00 00       	call   d64 <printf>
+      exit();
+     116:	e8 a1 0a 00 00       	call   bbc <exit>
+    if(fork1() == 0)
+     11b:	e8 39 ff ff ff       	call   59 <fork1>
+     120:	85 c0                	test   %eax,%eax
+     122:	74 15                	je     139 <runcmd+0xc1>
+    wait(0);
+     124:	83 ec 0c             	sub    $0xc,%esp
+     127:	6a 00                	push   $0x0
+     129:	e8 96 0a 00 00       	call   bc4 <wait>
+    runcmd(lcmd->right);
+     12e:	83 c4 04             	add    $0x4,%esp
+     131:	ff 73 08             	push   0x8(%ebx)
+     134:	e8 3f ff ff ff       	call   78 <runcmd>
+      runcmd(lcmd->left);
+     139:	83 ec 0c             	sub    $0xc,%esp
+     13c:	ff 73 04             	push   0x4(%ebx)
+     13f:	e8 34 ff ff ff       	call   78 <runcmd>
+    if(pipe(p) < 0)
+     144:	83 ec 0c             	sub    $0xc,%esp
+     147:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     14a:	50                   	push   %eax
+     14b:	e8 7c 0a 00 00       	call   bcc <pipe>
+     150:	83 c4 10             	add    $0x10,%esp
+     153:	85 c0                	test   %eax,%eax
+     155:	78 48                	js     19f <runcmd+0x127>
+    if(fork1() == 0){
+     157:	e8 fd fe ff ff       	call   59 <fork1>
+     15c:	85 c0                	test   %eax,%eax
+     15e:	74 4c                	je     1ac <runcmd+0x134>
+    if(fork1() == 0){
+     160:	e8 f4 fe ff ff       	call   59 <fork1>
+     165:	85 c0                	test   %eax,%eax
+     167:	74 79                	je     1e2 <runcmd+0x16a>
+    close(p[0]);
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	ff 75 f0             	push   -0x10(%ebp)
+     16f:	e8 70 0a 00 00       	call   be4 <close>
+    close(p[1]);
+     174:	83 c4 04             	add    $0x4,%esp
+     177:	ff 75 f4             	push   -0xc(%ebp)
+     17a:	e8 65 0a 00 00       	call   be4 <close>
+    wait(0);
+     17f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     186:	e8 39 0a 00 00       	call   bc4 <wait>
+    wait(0);
+     18b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     192:	e8 2d 0a 00 00       	call   bc4 <wait>
+    break;
+     197:	83 c4 10             	add    $0x10,%esp
+     19a:	e9 30 ff ff ff       	jmp    cf <runcmd+0x57>
+      panic("pipe");
+     19f:	83 ec 0c             	sub    $0xc,%esp
+     1a2:	68 8b 10 00 00       	push   $0x108b
+     1a7:	e8 93 fe ff ff       	call   3f <panic>
+      close(1);
+     1ac:	83 ec 0c             	sub    $0xc,%esp
+     1af:	6a 01                	push   $0x1
+     1b1:	e8 2e 0a 00 00       	call   be4 <close>
+      dup(p[1]);
+     1b6:	83 c4 04             	add    $0x4,%esp
+     1b9:	ff 75 f4             	push   -0xc(%ebp)
+     1bc:	e8 73 0a 00 00       	call   c34 <dup>
+      close(p[0]);
+     1c1:	83 c4 04             	add    $0x4,%esp
+     1c4:	ff 75 f0             	push   -0x10(%ebp)
+     1c7:	e8 18 0a 00 00       	call   be4 <close>
+      close(p[1]);
+     1cc:	83 c4 04             	add    $0x4,%esp
+     1cf:	ff 75 f4             	push   -0xc(%ebp)
+     1d2:	e8 0d 0a 00 00       	call   be4 <close>
+      runcmd(pcmd->left);
+     1d7:	83 c4 04             	add    $0x4,%esp
+     1da:	ff 73 04             	push   0x4(%ebx)
+     1dd:	e8 96 fe ff ff       	call   78 <runcmd>
+      close(0);
+     1e2:	83 ec 0c             	sub    $0xc,%esp
+     1e5:	6a 00                	push   $0x0
+     1e7:	e8 f8 09 00 00       	call   be4 <close>
+      dup(p[0]);
+     1ec:	83 c4 04             	add    $0x4,%esp
+     1ef:	ff 75 f0             	push   -0x10(%ebp)
+     1f2:	e8 3d 0a 00 00       	call   c34 <dup>
+      close(p[0]);
+     1f7:	83 c4 04             	add    $0x4,%esp
+     1fa:	ff 75 f0             	push   -0x10(%ebp)
+     1fd:	e8 e2 09 00 00       	call   be4 <close>
+      close(p[1]);
+     202:	83 c4 04             	add    $0x4,%esp
+     205:	ff 75 f4             	push   -0xc(%ebp)
+     208:	e8 d7 09 00 00       	call   be4 <close>
+      runcmd(pcmd->right);
+     20d:	83 c4 04             	add    $0x4,%esp
+     210:	ff 73 08             	push   0x8(%ebx)
+     213:	e8 60 fe ff ff       	call   78 <runcmd>
+    if(fork1() == 0)
+     218:	e8 3c fe ff ff       	call   59 <fork1>
+     21d:	85 c0                	test   %eax,%eax
+     21f:	0f 85 aa fe ff ff    	jne    cf <runcmd+0x57>
+      runcmd(bcmd->cmd);
+     225:	83 ec 0c             	sub    $0xc,%esp
+     228:	ff 73 04             	push   0x4(%ebx)
+     22b:	e8 48 fe ff ff       	call   78 <runcmd>
+
+00000230 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	53                   	push   %ebx
+     234:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     237:	6a 54                	push   $0x54
+     239:	e8 4c 0d 00 00       	call   f8a <malloc>
+     23e:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     240:	83 c4 0c             	add    $0xc,%esp
+     243:	6a 54                	push   $0x54
+     245:	6a 00                	push   $0x0
+     247:	50                   	push   %eax
+     248:	e8 1c 08 00 00       	call   a69 <memset>
+  cmd->type = EXEC;
+     24d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     253:	89 d8                	mov    %ebx,%eax
+     255:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     258:	c9                   	leave
+     259:	c3                   	ret
+
+0000025a <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     25a:	55                   	push   %ebp
+     25b:	89 e5                	mov    %esp,%ebp
+     25d:	53                   	push   %ebx
+     25e:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     261:	6a 18                	push   $0x18
+     263:	e8 22 0d 00 00       	call   f8a <malloc>
+     268:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     26a:	83 c4 0c             	add    $0xc,%esp
+     26d:	6a 18                	push   $0x18
+     26f:	6a 00                	push   $0x0
+     271:	50                   	push   %eax
+     272:	e8 f2 07 00 00       	call   a69 <memset>
+  cmd->type = REDIR;
+     277:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     27d:	8b 45 08             	mov    0x8(%ebp),%eax
+     280:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     283:	8b 45 0c             	mov    0xc(%ebp),%eax
+     286:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     289:	8b 45 10             	mov    0x10(%ebp),%eax
+     28c:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     28f:	8b 45 14             	mov    0x14(%ebp),%eax
+     292:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     295:	8b 45 18             	mov    0x18(%ebp),%eax
+     298:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     29b:	89 d8                	mov    %ebx,%eax
+     29d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2a0:	c9                   	leave
+     2a1:	c3                   	ret
+
+000002a2 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     2a2:	55                   	push   %ebp
+     2a3:	89 e5                	mov    %esp,%ebp
+     2a5:	53                   	push   %ebx
+     2a6:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     2a9:	6a 0c                	push   $0xc
+     2ab:	e8 da 0c 00 00       	call   f8a <malloc>
+     2b0:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     2b2:	83 c4 0c             	add    $0xc,%esp
+     2b5:	6a 0c                	push   $0xc
+     2b7:	6a 00                	push   $0x0
+     2b9:	50                   	push   %eax
+     2ba:	e8 aa 07 00 00       	call   a69 <memset>
+  cmd->type = PIPE;
+     2bf:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c8:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     2cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2ce:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     2d1:	89 d8                	mov    %ebx,%eax
+     2d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2d6:	c9                   	leave
+     2d7:	c3                   	ret
+
+000002d8 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     2d8:	55                   	push   %ebp
+     2d9:	89 e5                	mov    %esp,%ebp
+     2db:	53                   	push   %ebx
+     2dc:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     2df:	6a 0c                	push   $0xc
+     2e1:	e8 a4 0c 00 00       	call   f8a <malloc>
+     2e6:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     2e8:	83 c4 0c             	add    $0xc,%esp
+     2eb:	6a 0c                	push   $0xc
+     2ed:	6a 00                	push   $0x0
+     2ef:	50                   	push   %eax
+     2f0:	e8 74 07 00 00       	call   a69 <memset>
+  cmd->type = LIST;
+     2f5:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     2fb:	8b 45 08             	mov    0x8(%ebp),%eax
+     2fe:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     301:	8b 45 0c             	mov    0xc(%ebp),%eax
+     304:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     307:	89 d8                	mov    %ebx,%eax
+     309:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     30c:	c9                   	leave
+     30d:	c3                   	ret
+
+0000030e <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     30e:	55                   	push   %ebp
+     30f:	89 e5                	mov    %esp,%ebp
+     311:	53                   	push   %ebx
+     312:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     315:	6a 08                	push   $0x8
+     317:	e8 6e 0c 00 00       	call   f8a <malloc>
+     31c:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     31e:	83 c4 0c             	add    $0xc,%esp
+     321:	6a 08                	push   $0x8
+     323:	6a 00                	push   $0x0
+     325:	50                   	push   %eax
+     326:	e8 3e 07 00 00       	call   a69 <memset>
+  cmd->type = BACK;
+     32b:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     331:	8b 45 08             	mov    0x8(%ebp),%eax
+     334:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     337:	89 d8                	mov    %ebx,%eax
+     339:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     33c:	c9                   	leave
+     33d:	c3                   	ret
+
+0000033e <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     33e:	55                   	push   %ebp
+     33f:	89 e5                	mov    %esp,%ebp
+     341:	57                   	push   %edi
+     342:	56                   	push   %esi
+     343:	53                   	push   %ebx
+     344:	83 ec 0c             	sub    $0xc,%esp
+     347:	8b 75 0c             	mov    0xc(%ebp),%esi
+     34a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  char *s;
+  int ret;
+
+  s = *ps;
+     34d:	8b 45 08             	mov    0x8(%ebp),%eax
+     350:	8b 18                	mov    (%eax),%ebx
+  while(s < es && strchr(whitespace, *s))
+     352:	39 f3                	cmp    %esi,%ebx
+     354:	73 21                	jae    377 <gettoken+0x39>
+     356:	83 ec 08             	sub    $0x8,%esp
+     359:	0f be 03             	movsbl (%ebx),%eax
+     35c:	50                   	push   %eax
+     35d:	68 ec 16 00 00       	push   $0x16ec
+     362:	e8 1b 07 00 00       	call   a82 <strchr>
+     367:	83 c4 10             	add    $0x10,%esp
+     36a:	85 c0                	test   %eax,%eax
+     36c:	74 09                	je     377 <gettoken+0x39>
+    s++;
+     36e:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     371:	39 de                	cmp    %ebx,%esi
+     373:	75 e1                	jne    356 <gettoken+0x18>
+    s++;
+     375:	89 f3                	mov    %esi,%ebx
+  if(q)
+     377:	85 ff                	test   %edi,%edi
+     379:	74 02                	je     37d <gettoken+0x3f>
+    *q = s;
+     37b:	89 1f                	mov    %ebx,(%edi)
+  ret = *s;
+     37d:	0f b6 03             	movzbl (%ebx),%eax
+     380:	0f be f8             	movsbl %al,%edi
+  switch(*s){
+     383:	3c 3c                	cmp    $0x3c,%al
+     385:	7f 57                	jg     3de <gettoken+0xa0>
+     387:	3c 3a                	cmp    $0x3a,%al
+     389:	7f 11                	jg     39c <gettoken+0x5e>
+     38b:	84 c0                	test   %al,%al
+     38d:	74 10                	je     39f <gettoken+0x61>
+     38f:	78 67                	js     3f8 <gettoken+0xba>
+     391:	3c 26                	cmp    $0x26,%al
+     393:	74 07                	je     39c <gettoken+0x5e>
+     395:	83 e8 28             	sub    $0x28,%eax
+     398:	3c 01                	cmp    $0x1,%al
+     39a:	77 5c                	ja     3f8 <gettoken+0xba>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     39c:	83 c3 01             	add    $0x1,%ebx
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     39f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     3a3:	74 05                	je     3aa <gettoken+0x6c>
+    *eq = s;
+     3a5:	8b 45 14             	mov    0x14(%ebp),%eax
+     3a8:	89 18                	mov    %ebx,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     3aa:	39 f3                	cmp    %esi,%ebx
+     3ac:	73 21                	jae    3cf <gettoken+0x91>
+     3ae:	83 ec 08             	sub    $0x8,%esp
+     3b1:	0f be 03             	movsbl (%ebx),%eax
+     3b4:	50                   	push   %eax
+     3b5:	68 ec 16 00 00       	push   $0x16ec
+     3ba:	e8 c3 06 00 00       	call   a82 <strchr>
+     3bf:	83 c4 10             	add    $0x10,%esp
+     3c2:	85 c0                	test   %eax,%eax
+     3c4:	74 09                	je     3cf <gettoken+0x91>
+    s++;
+     3c6:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     3c9:	39 de                	cmp    %ebx,%esi
+     3cb:	75 e1                	jne    3ae <gettoken+0x70>
+    s++;
+     3cd:	89 f3                	mov    %esi,%ebx
+  *ps = s;
+     3cf:	8b 45 08             	mov    0x8(%ebp),%eax
+     3d2:	89 18                	mov    %ebx,(%eax)
+  return ret;
+}
+     3d4:	89 f8                	mov    %edi,%eax
+     3d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3d9:	5b                   	pop    %ebx
+     3da:	5e                   	pop    %esi
+     3db:	5f                   	pop    %edi
+     3dc:	5d                   	pop    %ebp
+     3dd:	c3                   	ret
+  switch(*s){
+     3de:	3c 3e                	cmp    $0x3e,%al
+     3e0:	75 12                	jne    3f4 <gettoken+0xb6>
+    s++;
+     3e2:	8d 43 01             	lea    0x1(%ebx),%eax
+    if(*s == '>'){
+     3e5:	80 7b 01 3e          	cmpb   $0x3e,0x1(%ebx)
+     3e9:	74 5b                	je     446 <gettoken+0x108>
+    s++;
+     3eb:	89 c3                	mov    %eax,%ebx
+  ret = *s;
+     3ed:	bf 3e 00 00 00       	mov    $0x3e,%edi
+     3f2:	eb ab                	jmp    39f <gettoken+0x61>
+  switch(*s){
+     3f4:	3c 7c                	cmp    $0x7c,%al
+     3f6:	74 a4                	je     39c <gettoken+0x5e>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     3f8:	39 f3                	cmp    %esi,%ebx
+     3fa:	73 6b                	jae    467 <gettoken+0x129>
+     3fc:	83 ec 08             	sub    $0x8,%esp
+     3ff:	0f be 03             	movsbl (%ebx),%eax
+     402:	50                   	push   %eax
+     403:	68 ec 16 00 00       	push   $0x16ec
+     408:	e8 75 06 00 00       	call   a82 <strchr>
+     40d:	83 c4 10             	add    $0x10,%esp
+     410:	85 c0                	test   %eax,%eax
+     412:	75 49                	jne    45d <gettoken+0x11f>
+     414:	83 ec 08             	sub    $0x8,%esp
+     417:	0f be 03             	movsbl (%ebx),%eax
+     41a:	50                   	push   %eax
+     41b:	68 e4 16 00 00       	push   $0x16e4
+     420:	e8 5d 06 00 00       	call   a82 <strchr>
+     425:	83 c4 10             	add    $0x10,%esp
+     428:	85 c0                	test   %eax,%eax
+     42a:	75 27                	jne    453 <gettoken+0x115>
+      s++;
+     42c:	83 c3 01             	add    $0x1,%ebx
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     42f:	39 de                	cmp    %ebx,%esi
+     431:	75 c9                	jne    3fc <gettoken+0xbe>
+      s++;
+     433:	89 f3                	mov    %esi,%ebx
+    ret = 'a';
+     435:	bf 61 00 00 00       	mov    $0x61,%edi
+  if(eq)
+     43a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     43e:	0f 85 61 ff ff ff    	jne    3a5 <gettoken+0x67>
+     444:	eb 89                	jmp    3cf <gettoken+0x91>
+      s++;
+     446:	83 c3 02             	add    $0x2,%ebx
+      ret = '+';
+     449:	bf 2b 00 00 00       	mov    $0x2b,%edi
+     44e:	e9 4c ff ff ff       	jmp    39f <gettoken+0x61>
+    ret = 'a';
+     453:	bf 61 00 00 00       	mov    $0x61,%edi
+     458:	e9 42 ff ff ff       	jmp    39f <gettoken+0x61>
+     45d:	bf 61 00 00 00       	mov    $0x61,%edi
+     462:	e9 38 ff ff ff       	jmp    39f <gettoken+0x61>
+     467:	bf 61 00 00 00       	mov    $0x61,%edi
+  if(eq)
+     46c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     470:	0f 85 2f ff ff ff    	jne    3a5 <gettoken+0x67>
+     476:	e9 54 ff ff ff       	jmp    3cf <gettoken+0x91>
+
+0000047b <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     47b:	55                   	push   %ebp
+     47c:	89 e5                	mov    %esp,%ebp
+     47e:	57                   	push   %edi
+     47f:	56                   	push   %esi
+     480:	53                   	push   %ebx
+     481:	83 ec 0c             	sub    $0xc,%esp
+     484:	8b 7d 08             	mov    0x8(%ebp),%edi
+     487:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     48a:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     48c:	39 f3                	cmp    %esi,%ebx
+     48e:	73 21                	jae    4b1 <peek+0x36>
+     490:	83 ec 08             	sub    $0x8,%esp
+     493:	0f be 03             	movsbl (%ebx),%eax
+     496:	50                   	push   %eax
+     497:	68 ec 16 00 00       	push   $0x16ec
+     49c:	e8 e1 05 00 00       	call   a82 <strchr>
+     4a1:	83 c4 10             	add    $0x10,%esp
+     4a4:	85 c0                	test   %eax,%eax
+     4a6:	74 09                	je     4b1 <peek+0x36>
+    s++;
+     4a8:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     4ab:	39 de                	cmp    %ebx,%esi
+     4ad:	75 e1                	jne    490 <peek+0x15>
+    s++;
+     4af:	89 f3                	mov    %esi,%ebx
+  *ps = s;
+     4b1:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     4b3:	0f b6 03             	movzbl (%ebx),%eax
+     4b6:	ba 00 00 00 00       	mov    $0x0,%edx
+     4bb:	84 c0                	test   %al,%al
+     4bd:	75 0a                	jne    4c9 <peek+0x4e>
+}
+     4bf:	89 d0                	mov    %edx,%eax
+     4c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4c4:	5b                   	pop    %ebx
+     4c5:	5e                   	pop    %esi
+     4c6:	5f                   	pop    %edi
+     4c7:	5d                   	pop    %ebp
+     4c8:	c3                   	ret
+  return *s && strchr(toks, *s);
+     4c9:	83 ec 08             	sub    $0x8,%esp
+     4cc:	0f be c0             	movsbl %al,%eax
+     4cf:	50                   	push   %eax
+     4d0:	ff 75 10             	push   0x10(%ebp)
+     4d3:	e8 aa 05 00 00       	call   a82 <strchr>
+     4d8:	83 c4 10             	add    $0x10,%esp
+     4db:	85 c0                	test   %eax,%eax
+     4dd:	0f 95 c2             	setne  %dl
+     4e0:	0f b6 d2             	movzbl %dl,%edx
+     4e3:	eb da                	jmp    4bf <peek+0x44>
+
+000004e5 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     4e5:	55                   	push   %ebp
+     4e6:	89 e5                	mov    %esp,%ebp
+     4e8:	57                   	push   %edi
+     4e9:	56                   	push   %esi
+     4ea:	53                   	push   %ebx
+     4eb:	83 ec 1c             	sub    $0x1c,%esp
+     4ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+     4f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     4f4:	eb 28                	jmp    51e <parseredirs+0x39>
+    tok = gettoken(ps, es, 0, 0);
+    if(gettoken(ps, es, &q, &eq) != 'a')
+      panic("missing file for redirection");
+     4f6:	83 ec 0c             	sub    $0xc,%esp
+     4f9:	68 90 10 00 00       	push   $0x1090
+     4fe:	e8 3c fb ff ff       	call   3f <panic>
+    switch(tok){
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     503:	83 ec 0c             	sub    $0xc,%esp
+     506:	6a 00                	push   $0x0
+     508:	6a 00                	push   $0x0
+     50a:	ff 75 e0             	push   -0x20(%ebp)
+     50d:	ff 75 e4             	push   -0x1c(%ebp)
+     510:	ff 75 08             	push   0x8(%ebp)
+     513:	e8 42 fd ff ff       	call   25a <redircmd>
+     518:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     51b:	83 c4 20             	add    $0x20,%esp
+  while(peek(ps, es, "<>")){
+     51e:	83 ec 04             	sub    $0x4,%esp
+     521:	68 ad 10 00 00       	push   $0x10ad
+     526:	53                   	push   %ebx
+     527:	56                   	push   %esi
+     528:	e8 4e ff ff ff       	call   47b <peek>
+     52d:	83 c4 10             	add    $0x10,%esp
+     530:	85 c0                	test   %eax,%eax
+     532:	74 76                	je     5aa <parseredirs+0xc5>
+    tok = gettoken(ps, es, 0, 0);
+     534:	6a 00                	push   $0x0
+     536:	6a 00                	push   $0x0
+     538:	53                   	push   %ebx
+     539:	56                   	push   %esi
+     53a:	e8 ff fd ff ff       	call   33e <gettoken>
+     53f:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     541:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     544:	50                   	push   %eax
+     545:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     548:	50                   	push   %eax
+     549:	53                   	push   %ebx
+     54a:	56                   	push   %esi
+     54b:	e8 ee fd ff ff       	call   33e <gettoken>
+     550:	83 c4 20             	add    $0x20,%esp
+     553:	83 f8 61             	cmp    $0x61,%eax
+     556:	75 9e                	jne    4f6 <parseredirs+0x11>
+    switch(tok){
+     558:	83 ff 3c             	cmp    $0x3c,%edi
+     55b:	74 a6                	je     503 <parseredirs+0x1e>
+     55d:	83 ff 3e             	cmp    $0x3e,%edi
+     560:	74 25                	je     587 <parseredirs+0xa2>
+     562:	83 ff 2b             	cmp    $0x2b,%edi
+     565:	75 b7                	jne    51e <parseredirs+0x39>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     567:	83 ec 0c             	sub    $0xc,%esp
+     56a:	6a 01                	push   $0x1
+     56c:	68 01 02 00 00       	push   $0x201
+     571:	ff 75 e0             	push   -0x20(%ebp)
+     574:	ff 75 e4             	push   -0x1c(%ebp)
+     577:	ff 75 08             	push   0x8(%ebp)
+     57a:	e8 db fc ff ff       	call   25a <redircmd>
+     57f:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     582:	83 c4 20             	add    $0x20,%esp
+     585:	eb 97                	jmp    51e <parseredirs+0x39>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     587:	83 ec 0c             	sub    $0xc,%esp
+     58a:	6a 01                	push   $0x1
+     58c:	68 01 02 00 00       	push   $0x201
+     591:	ff 75 e0             	push   -0x20(%ebp)
+     594:	ff 75 e4             	push   -0x1c(%ebp)
+     597:	ff 75 08             	push   0x8(%ebp)
+     59a:	e8 bb fc ff ff       	call   25a <redircmd>
+     59f:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     5a2:	83 c4 20             	add    $0x20,%esp
+     5a5:	e9 74 ff ff ff       	jmp    51e <parseredirs+0x39>
+    }
+  }
+  return cmd;
+}
+     5aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5ad:	89 f8                	mov    %edi,%eax
+     5af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5b2:	5b                   	pop    %ebx
+     5b3:	5e                   	pop    %esi
+     5b4:	5f                   	pop    %edi
+     5b5:	5d                   	pop    %ebp
+     5b6:	c3                   	ret
+
+000005b7 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     5b7:	55                   	push   %ebp
+     5b8:	89 e5                	mov    %esp,%ebp
+     5ba:	57                   	push   %edi
+     5bb:	56                   	push   %esi
+     5bc:	53                   	push   %ebx
+     5bd:	83 ec 30             	sub    $0x30,%esp
+     5c0:	8b 75 08             	mov    0x8(%ebp),%esi
+     5c3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     5c6:	68 b0 10 00 00       	push   $0x10b0
+     5cb:	57                   	push   %edi
+     5cc:	56                   	push   %esi
+     5cd:	e8 a9 fe ff ff       	call   47b <peek>
+     5d2:	83 c4 10             	add    $0x10,%esp
+     5d5:	85 c0                	test   %eax,%eax
+     5d7:	75 1d                	jne    5f6 <parseexec+0x3f>
+     5d9:	89 c3                	mov    %eax,%ebx
+    return parseblock(ps, es);
+
+  ret = execcmd();
+     5db:	e8 50 fc ff ff       	call   230 <execcmd>
+     5e0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     5e3:	83 ec 04             	sub    $0x4,%esp
+     5e6:	57                   	push   %edi
+     5e7:	56                   	push   %esi
+     5e8:	50                   	push   %eax
+     5e9:	e8 f7 fe ff ff       	call   4e5 <parseredirs>
+     5ee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     5f1:	83 c4 10             	add    $0x10,%esp
+     5f4:	eb 3b                	jmp    631 <parseexec+0x7a>
+    return parseblock(ps, es);
+     5f6:	83 ec 08             	sub    $0x8,%esp
+     5f9:	57                   	push   %edi
+     5fa:	56                   	push   %esi
+     5fb:	e8 8f 01 00 00       	call   78f <parseblock>
+     600:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     603:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     606:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     60c:	5b                   	pop    %ebx
+     60d:	5e                   	pop    %esi
+     60e:	5f                   	pop    %edi
+     60f:	5d                   	pop    %ebp
+     610:	c3                   	ret
+      panic("syntax");
+     611:	83 ec 0c             	sub    $0xc,%esp
+     614:	68 b2 10 00 00       	push   $0x10b2
+     619:	e8 21 fa ff ff       	call   3f <panic>
+    ret = parseredirs(ret, ps, es);
+     61e:	83 ec 04             	sub    $0x4,%esp
+     621:	57                   	push   %edi
+     622:	56                   	push   %esi
+     623:	ff 75 d4             	push   -0x2c(%ebp)
+     626:	e8 ba fe ff ff       	call   4e5 <parseredirs>
+     62b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     62e:	83 c4 10             	add    $0x10,%esp
+  while(!peek(ps, es, "|)&;")){
+     631:	83 ec 04             	sub    $0x4,%esp
+     634:	68 c7 10 00 00       	push   $0x10c7
+     639:	57                   	push   %edi
+     63a:	56                   	push   %esi
+     63b:	e8 3b fe ff ff       	call   47b <peek>
+     640:	83 c4 10             	add    $0x10,%esp
+     643:	85 c0                	test   %eax,%eax
+     645:	75 41                	jne    688 <parseexec+0xd1>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     647:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     64a:	50                   	push   %eax
+     64b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     64e:	50                   	push   %eax
+     64f:	57                   	push   %edi
+     650:	56                   	push   %esi
+     651:	e8 e8 fc ff ff       	call   33e <gettoken>
+     656:	83 c4 10             	add    $0x10,%esp
+     659:	85 c0                	test   %eax,%eax
+     65b:	74 2b                	je     688 <parseexec+0xd1>
+    if(tok != 'a')
+     65d:	83 f8 61             	cmp    $0x61,%eax
+     660:	75 af                	jne    611 <parseexec+0x5a>
+    cmd->argv[argc] = q;
+     662:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     665:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     668:	89 44 9a 04          	mov    %eax,0x4(%edx,%ebx,4)
+    cmd->eargv[argc] = eq;
+     66c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     66f:	89 44 9a 2c          	mov    %eax,0x2c(%edx,%ebx,4)
+    argc++;
+     673:	83 c3 01             	add    $0x1,%ebx
+    if(argc >= MAXARGS)
+     676:	83 fb 0a             	cmp    $0xa,%ebx
+     679:	75 a3                	jne    61e <parseexec+0x67>
+      panic("too many args");
+     67b:	83 ec 0c             	sub    $0xc,%esp
+     67e:	68 b9 10 00 00       	push   $0x10b9
+     683:	e8 b7 f9 ff ff       	call   3f <panic>
+  cmd->argv[argc] = 0;
+     688:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     68b:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+     692:	00 
+  cmd->eargv[argc] = 0;
+     693:	c7 44 98 2c 00 00 00 	movl   $0x0,0x2c(%eax,%ebx,4)
+     69a:	00 
+  return ret;
+     69b:	e9 66 ff ff ff       	jmp    606 <parseexec+0x4f>
+
+000006a0 <parsepipe>:
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	57                   	push   %edi
+     6a4:	56                   	push   %esi
+     6a5:	53                   	push   %ebx
+     6a6:	83 ec 14             	sub    $0x14,%esp
+     6a9:	8b 75 08             	mov    0x8(%ebp),%esi
+     6ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     6af:	57                   	push   %edi
+     6b0:	56                   	push   %esi
+     6b1:	e8 01 ff ff ff       	call   5b7 <parseexec>
+     6b6:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     6b8:	83 c4 0c             	add    $0xc,%esp
+     6bb:	68 cc 10 00 00       	push   $0x10cc
+     6c0:	57                   	push   %edi
+     6c1:	56                   	push   %esi
+     6c2:	e8 b4 fd ff ff       	call   47b <peek>
+     6c7:	83 c4 10             	add    $0x10,%esp
+     6ca:	85 c0                	test   %eax,%eax
+     6cc:	75 0a                	jne    6d8 <parsepipe+0x38>
+}
+     6ce:	89 d8                	mov    %ebx,%eax
+     6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6d3:	5b                   	pop    %ebx
+     6d4:	5e                   	pop    %esi
+     6d5:	5f                   	pop    %edi
+     6d6:	5d                   	pop    %ebp
+     6d7:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     6d8:	6a 00                	push   $0x0
+     6da:	6a 00                	push   $0x0
+     6dc:	57                   	push   %edi
+     6dd:	56                   	push   %esi
+     6de:	e8 5b fc ff ff       	call   33e <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     6e3:	83 c4 08             	add    $0x8,%esp
+     6e6:	57                   	push   %edi
+     6e7:	56                   	push   %esi
+     6e8:	e8 b3 ff ff ff       	call   6a0 <parsepipe>
+     6ed:	83 c4 08             	add    $0x8,%esp
+     6f0:	50                   	push   %eax
+     6f1:	53                   	push   %ebx
+     6f2:	e8 ab fb ff ff       	call   2a2 <pipecmd>
+     6f7:	89 c3                	mov    %eax,%ebx
+     6f9:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     6fc:	eb d0                	jmp    6ce <parsepipe+0x2e>
+
+000006fe <parseline>:
+{
+     6fe:	55                   	push   %ebp
+     6ff:	89 e5                	mov    %esp,%ebp
+     701:	57                   	push   %edi
+     702:	56                   	push   %esi
+     703:	53                   	push   %ebx
+     704:	83 ec 14             	sub    $0x14,%esp
+     707:	8b 75 08             	mov    0x8(%ebp),%esi
+     70a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     70d:	57                   	push   %edi
+     70e:	56                   	push   %esi
+     70f:	e8 8c ff ff ff       	call   6a0 <parsepipe>
+     714:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     716:	83 c4 10             	add    $0x10,%esp
+     719:	eb 18                	jmp    733 <parseline+0x35>
+    gettoken(ps, es, 0, 0);
+     71b:	6a 00                	push   $0x0
+     71d:	6a 00                	push   $0x0
+     71f:	57                   	push   %edi
+     720:	56                   	push   %esi
+     721:	e8 18 fc ff ff       	call   33e <gettoken>
+    cmd = backcmd(cmd);
+     726:	89 1c 24             	mov    %ebx,(%esp)
+     729:	e8 e0 fb ff ff       	call   30e <backcmd>
+     72e:	89 c3                	mov    %eax,%ebx
+     730:	83 c4 10             	add    $0x10,%esp
+  while(peek(ps, es, "&")){
+     733:	83 ec 04             	sub    $0x4,%esp
+     736:	68 ce 10 00 00       	push   $0x10ce
+     73b:	57                   	push   %edi
+     73c:	56                   	push   %esi
+     73d:	e8 39 fd ff ff       	call   47b <peek>
+     742:	83 c4 10             	add    $0x10,%esp
+     745:	85 c0                	test   %eax,%eax
+     747:	75 d2                	jne    71b <parseline+0x1d>
+  if(peek(ps, es, ";")){
+     749:	83 ec 04             	sub    $0x4,%esp
+     74c:	68 ca 10 00 00       	push   $0x10ca
+     751:	57                   	push   %edi
+     752:	56                   	push   %esi
+     753:	e8 23 fd ff ff       	call   47b <peek>
+     758:	83 c4 10             	add    $0x10,%esp
+     75b:	85 c0                	test   %eax,%eax
+     75d:	75 0a                	jne    769 <parseline+0x6b>
+}
+     75f:	89 d8                	mov    %ebx,%eax
+     761:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     764:	5b                   	pop    %ebx
+     765:	5e                   	pop    %esi
+     766:	5f                   	pop    %edi
+     767:	5d                   	pop    %ebp
+     768:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     769:	6a 00                	push   $0x0
+     76b:	6a 00                	push   $0x0
+     76d:	57                   	push   %edi
+     76e:	56                   	push   %esi
+     76f:	e8 ca fb ff ff       	call   33e <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     774:	83 c4 08             	add    $0x8,%esp
+     777:	57                   	push   %edi
+     778:	56                   	push   %esi
+     779:	e8 80 ff ff ff       	call   6fe <parseline>
+     77e:	83 c4 08             	add    $0x8,%esp
+     781:	50                   	push   %eax
+     782:	53                   	push   %ebx
+     783:	e8 50 fb ff ff       	call   2d8 <listcmd>
+     788:	89 c3                	mov    %eax,%ebx
+     78a:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     78d:	eb d0                	jmp    75f <parseline+0x61>
+
+0000078f <parseblock>:
+{
+     78f:	55                   	push   %ebp
+     790:	89 e5                	mov    %esp,%ebp
+     792:	57                   	push   %edi
+     793:	56                   	push   %esi
+     794:	53                   	push   %ebx
+     795:	83 ec 10             	sub    $0x10,%esp
+     798:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     79b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     79e:	68 b0 10 00 00       	push   $0x10b0
+     7a3:	56                   	push   %esi
+     7a4:	53                   	push   %ebx
+     7a5:	e8 d1 fc ff ff       	call   47b <peek>
+     7aa:	83 c4 10             	add    $0x10,%esp
+     7ad:	85 c0                	test   %eax,%eax
+     7af:	74 4b                	je     7fc <parseblock+0x6d>
+  gettoken(ps, es, 0, 0);
+     7b1:	6a 00                	push   $0x0
+     7b3:	6a 00                	push   $0x0
+     7b5:	56                   	push   %esi
+     7b6:	53                   	push   %ebx
+     7b7:	e8 82 fb ff ff       	call   33e <gettoken>
+  cmd = parseline(ps, es);
+     7bc:	83 c4 08             	add    $0x8,%esp
+     7bf:	56                   	push   %esi
+     7c0:	53                   	push   %ebx
+     7c1:	e8 38 ff ff ff       	call   6fe <parseline>
+     7c6:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     7c8:	83 c4 0c             	add    $0xc,%esp
+     7cb:	68 ec 10 00 00       	push   $0x10ec
+     7d0:	56                   	push   %esi
+     7d1:	53                   	push   %ebx
+     7d2:	e8 a4 fc ff ff       	call   47b <peek>
+     7d7:	83 c4 10             	add    $0x10,%esp
+     7da:	85 c0                	test   %eax,%eax
+     7dc:	74 2b                	je     809 <parseblock+0x7a>
+  gettoken(ps, es, 0, 0);
+     7de:	6a 00                	push   $0x0
+     7e0:	6a 00                	push   $0x0
+     7e2:	56                   	push   %esi
+     7e3:	53                   	push   %ebx
+     7e4:	e8 55 fb ff ff       	call   33e <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     7e9:	83 c4 0c             	add    $0xc,%esp
+     7ec:	56                   	push   %esi
+     7ed:	53                   	push   %ebx
+     7ee:	57                   	push   %edi
+     7ef:	e8 f1 fc ff ff       	call   4e5 <parseredirs>
+}
+     7f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7f7:	5b                   	pop    %ebx
+     7f8:	5e                   	pop    %esi
+     7f9:	5f                   	pop    %edi
+     7fa:	5d                   	pop    %ebp
+     7fb:	c3                   	ret
+    panic("parseblock");
+     7fc:	83 ec 0c             	sub    $0xc,%esp
+     7ff:	68 d0 10 00 00       	push   $0x10d0
+     804:	e8 36 f8 ff ff       	call   3f <panic>
+    panic("syntax - missing )");
+     809:	83 ec 0c             	sub    $0xc,%esp
+     80c:	68 db 10 00 00       	push   $0x10db
+     811:	e8 29 f8 ff ff       	call   3f <panic>
+
+00000816 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     816:	55                   	push   %ebp
+     817:	89 e5                	mov    %esp,%ebp
+     819:	53                   	push   %ebx
+     81a:	83 ec 04             	sub    $0x4,%esp
+     81d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     820:	85 db                	test   %ebx,%ebx
+     822:	74 3c                	je     860 <nulterminate+0x4a>
+    return 0;
+
+  switch(cmd->type){
+     824:	83 3b 05             	cmpl   $0x5,(%ebx)
+     827:	77 37                	ja     860 <nulterminate+0x4a>
+     829:	8b 03                	mov    (%ebx),%eax
+     82b:	ff 24 85 2c 11 00 00 	jmp    *0x112c(,%eax,4)
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    for(i=0; ecmd->argv[i]; i++)
+     832:	83 7b 04 00          	cmpl   $0x0,0x4(%ebx)
+     836:	74 28                	je     860 <nulterminate+0x4a>
+     838:	8d 43 08             	lea    0x8(%ebx),%eax
+      *ecmd->eargv[i] = 0;
+     83b:	8b 50 24             	mov    0x24(%eax),%edx
+     83e:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     841:	83 c0 04             	add    $0x4,%eax
+     844:	83 78 fc 00          	cmpl   $0x0,-0x4(%eax)
+     848:	75 f1                	jne    83b <nulterminate+0x25>
+     84a:	eb 14                	jmp    860 <nulterminate+0x4a>
+    break;
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    nulterminate(rcmd->cmd);
+     84c:	83 ec 0c             	sub    $0xc,%esp
+     84f:	ff 73 04             	push   0x4(%ebx)
+     852:	e8 bf ff ff ff       	call   816 <nulterminate>
+    *rcmd->efile = 0;
+     857:	8b 43 0c             	mov    0xc(%ebx),%eax
+     85a:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     85d:	83 c4 10             	add    $0x10,%esp
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     860:	89 d8                	mov    %ebx,%eax
+     862:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     865:	c9                   	leave
+     866:	c3                   	ret
+    nulterminate(pcmd->left);
+     867:	83 ec 0c             	sub    $0xc,%esp
+     86a:	ff 73 04             	push   0x4(%ebx)
+     86d:	e8 a4 ff ff ff       	call   816 <nulterminate>
+    nulterminate(pcmd->right);
+     872:	83 c4 04             	add    $0x4,%esp
+     875:	ff 73 08             	push   0x8(%ebx)
+     878:	e8 99 ff ff ff       	call   816 <nulterminate>
+    break;
+     87d:	83 c4 10             	add    $0x10,%esp
+     880:	eb de                	jmp    860 <nulterminate+0x4a>
+    nulterminate(lcmd->left);
+     882:	83 ec 0c             	sub    $0xc,%esp
+     885:	ff 73 04             	push   0x4(%ebx)
+     888:	e8 89 ff ff ff       	call   816 <nulterminate>
+    nulterminate(lcmd->right);
+     88d:	83 c4 04             	add    $0x4,%esp
+     890:	ff 73 08             	push   0x8(%ebx)
+     893:	e8 7e ff ff ff       	call   816 <nulterminate>
+    break;
+     898:	83 c4 10             	add    $0x10,%esp
+     89b:	eb c3                	jmp    860 <nulterminate+0x4a>
+    nulterminate(bcmd->cmd);
+     89d:	83 ec 0c             	sub    $0xc,%esp
+     8a0:	ff 73 04             	push   0x4(%ebx)
+     8a3:	e8 6e ff ff ff       	call   816 <nulterminate>
+    break;
+     8a8:	83 c4 10             	add    $0x10,%esp
+     8ab:	eb b3                	jmp    860 <nulterminate+0x4a>
+
+000008ad <parsecmd>:
+{
+     8ad:	55                   	push   %ebp
+     8ae:	89 e5                	mov    %esp,%ebp
+     8b0:	56                   	push   %esi
+     8b1:	53                   	push   %ebx
+  es = s + strlen(s);
+     8b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8b5:	83 ec 0c             	sub    $0xc,%esp
+     8b8:	53                   	push   %ebx
+     8b9:	e8 85 01 00 00       	call   a43 <strlen>
+     8be:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     8c0:	83 c4 08             	add    $0x8,%esp
+     8c3:	53                   	push   %ebx
+     8c4:	8d 45 08             	lea    0x8(%ebp),%eax
+     8c7:	50                   	push   %eax
+     8c8:	e8 31 fe ff ff       	call   6fe <parseline>
+     8cd:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     8cf:	83 c4 0c             	add    $0xc,%esp
+     8d2:	68 7a 10 00 00       	push   $0x107a
+     8d7:	53                   	push   %ebx
+     8d8:	8d 45 08             	lea    0x8(%ebp),%eax
+     8db:	50                   	push   %eax
+     8dc:	e8 9a fb ff ff       	call   47b <peek>
+  if(s != es){
+     8e1:	8b 45 08             	mov    0x8(%ebp),%eax
+     8e4:	83 c4 10             	add    $0x10,%esp
+     8e7:	39 d8                	cmp    %ebx,%eax
+     8e9:	75 12                	jne    8fd <parsecmd+0x50>
+  nulterminate(cmd);
+     8eb:	83 ec 0c             	sub    $0xc,%esp
+     8ee:	56                   	push   %esi
+     8ef:	e8 22 ff ff ff       	call   816 <nulterminate>
+}
+     8f4:	89 f0                	mov    %esi,%eax
+     8f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8f9:	5b                   	pop    %ebx
+     8fa:	5e                   	pop    %esi
+     8fb:	5d                   	pop    %ebp
+     8fc:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     8fd:	83 ec 04             	sub    $0x4,%esp
+     900:	50                   	push   %eax
+     901:	68 ee 10 00 00       	push   $0x10ee
+     906:	6a 02                	push   $0x2
+     908:	e8 57 04 00 00       	call   d64 <printf>
+    panic("syntax");
+     90d:	c7 04 24 b2 10 00 00 	movl   $0x10b2,(%esp)
+     914:	e8 26 f7 ff ff       	call   3f <panic>
+
+00000919 <main>:
+{
+     919:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     91d:	83 e4 f0             	and    $0xfffffff0,%esp
+     920:	ff 71 fc             	push   -0x4(%ecx)
+     923:	55                   	push   %ebp
+     924:	89 e5                	mov    %esp,%ebp
+     926:	51                   	push   %ecx
+     927:	83 ec 04             	sub    $0x4,%esp
+  while((fd = open("console", O_RDWR)) >= 0){
+     92a:	83 ec 08             	sub    $0x8,%esp
+     92d:	6a 02                	push   $0x2
+     92f:	68 fd 10 00 00       	push   $0x10fd
+     934:	e8 c3 02 00 00       	call   bfc <open>
+     939:	83 c4 10             	add    $0x10,%esp
+     93c:	85 c0                	test   %eax,%eax
+     93e:	78 29                	js     969 <main+0x50>
+    if(fd >= 3){
+     940:	83 f8 02             	cmp    $0x2,%eax
+     943:	7e e5                	jle    92a <main+0x11>
+      close(fd);
+     945:	83 ec 0c             	sub    $0xc,%esp
+     948:	50                   	push   %eax
+     949:	e8 96 02 00 00       	call   be4 <close>
+      break;
+     94e:	83 c4 10             	add    $0x10,%esp
+     951:	eb 16                	jmp    969 <main+0x50>
+    if(fork1() == 0)
+     953:	e8 01 f7 ff ff       	call   59 <fork1>
+     958:	85 c0                	test   %eax,%eax
+     95a:	74 7e                	je     9da <main+0xc1>
+    wait(0);
+     95c:	83 ec 0c             	sub    $0xc,%esp
+     95f:	6a 00                	push   $0x0
+     961:	e8 5e 02 00 00       	call   bc4 <wait>
+     966:	83 c4 10             	add    $0x10,%esp
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     969:	83 ec 08             	sub    $0x8,%esp
+     96c:	6a 64                	push   $0x64
+     96e:	68 00 17 00 00       	push   $0x1700
+     973:	e8 88 f6 ff ff       	call   0 <getcmd>
+     978:	83 c4 10             	add    $0x10,%esp
+     97b:	85 c0                	test   %eax,%eax
+     97d:	78 70                	js     9ef <main+0xd6>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     97f:	80 3d 00 17 00 00 63 	cmpb   $0x63,0x1700
+     986:	75 cb                	jne    953 <main+0x3a>
+     988:	80 3d 01 17 00 00 64 	cmpb   $0x64,0x1701
+     98f:	75 c2                	jne    953 <main+0x3a>
+     991:	80 3d 02 17 00 00 20 	cmpb   $0x20,0x1702
+     998:	75 b9                	jne    953 <main+0x3a>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     99a:	83 ec 0c             	sub    $0xc,%esp
+     99d:	68 00 17 00 00       	push   $0x1700
+     9a2:	e8 9c 00 00 00       	call   a43 <strlen>
+     9a7:	c6 80 ff 16 00 00 00 	movb   $0x0,0x16ff(%eax)
+      if(chdir(buf+3) < 0)
+     9ae:	c7 04 24 03 17 00 00 	movl   $0x1703,(%esp)
+     9b5:	e8 72 02 00 00       	call   c2c <chdir>
+     9ba:	83 c4 10             	add    $0x10,%esp
+     9bd:	85 c0                	test   %eax,%eax
+     9bf:	79 a8                	jns    969 <main+0x50>
+        printf(2, "cannot cd %s\n", buf+3);
+     9c1:	83 ec 04             	sub    $0x4,%esp
+     9c4:	68 03 17 00 00       	push   $0x1703
+     9c9:	68 05 11 00 00       	push   $0x1105
+     9ce:	6a 02                	push   $0x2
+     9d0:	e8 8f 03 00 00       	call   d64 <printf>
+     9d5:	83 c4 10             	add    $0x10,%esp
+     9d8:	eb 8f                	jmp    969 <main+0x50>
+      runcmd(parsecmd(buf));
+     9da:	83 ec 0c             	sub    $0xc,%esp
+     9dd:	68 00 17 00 00       	push   $0x1700
+     9e2:	e8 c6 fe ff ff       	call   8ad <parsecmd>
+     9e7:	89 04 24             	mov    %eax,(%esp)
+     9ea:	e8 89 f6 ff ff       	call   78 <runcmd>
+  exit();
+     9ef:	e8 c8 01 00 00       	call   bbc <exit>
+
+000009f4 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     9f4:	55                   	push   %ebp
+     9f5:	89 e5                	mov    %esp,%ebp
+     9f7:	53                   	push   %ebx
+     9f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     9fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     9fe:	b8 00 00 00 00       	mov    $0x0,%eax
+     a03:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     a07:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     a0a:	83 c0 01             	add    $0x1,%eax
+     a0d:	84 d2                	test   %dl,%dl
+     a0f:	75 f2                	jne    a03 <strcpy+0xf>
+    ;
+  return os;
+}
+     a11:	89 c8                	mov    %ecx,%eax
+     a13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a16:	c9                   	leave
+     a17:	c3                   	ret
+
+00000a18 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     a18:	55                   	push   %ebp
+     a19:	89 e5                	mov    %esp,%ebp
+     a1b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     a1e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     a21:	0f b6 01             	movzbl (%ecx),%eax
+     a24:	84 c0                	test   %al,%al
+     a26:	74 11                	je     a39 <strcmp+0x21>
+     a28:	38 02                	cmp    %al,(%edx)
+     a2a:	75 0d                	jne    a39 <strcmp+0x21>
+    p++, q++;
+     a2c:	83 c1 01             	add    $0x1,%ecx
+     a2f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     a32:	0f b6 01             	movzbl (%ecx),%eax
+     a35:	84 c0                	test   %al,%al
+     a37:	75 ef                	jne    a28 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+     a39:	0f b6 c0             	movzbl %al,%eax
+     a3c:	0f b6 12             	movzbl (%edx),%edx
+     a3f:	29 d0                	sub    %edx,%eax
+}
+     a41:	5d                   	pop    %ebp
+     a42:	c3                   	ret
+
+00000a43 <strlen>:
+
+uint
+strlen(char *s)
+{
+     a43:	55                   	push   %ebp
+     a44:	89 e5                	mov    %esp,%ebp
+     a46:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     a49:	80 3a 00             	cmpb   $0x0,(%edx)
+     a4c:	74 14                	je     a62 <strlen+0x1f>
+     a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+     a53:	83 c0 01             	add    $0x1,%eax
+     a56:	89 c1                	mov    %eax,%ecx
+     a58:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     a5c:	75 f5                	jne    a53 <strlen+0x10>
+    ;
+  return n;
+}
+     a5e:	89 c8                	mov    %ecx,%eax
+     a60:	5d                   	pop    %ebp
+     a61:	c3                   	ret
+  for(n = 0; s[n]; n++)
+     a62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+     a67:	eb f5                	jmp    a5e <strlen+0x1b>
+
+00000a69 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     a69:	55                   	push   %ebp
+     a6a:	89 e5                	mov    %esp,%ebp
+     a6c:	57                   	push   %edi
+     a6d:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     a70:	89 d7                	mov    %edx,%edi
+     a72:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     a75:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a78:	fc                   	cld
+     a79:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     a7b:	89 d0                	mov    %edx,%eax
+     a7d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     a80:	c9                   	leave
+     a81:	c3                   	ret
+
+00000a82 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     a82:	55                   	push   %ebp
+     a83:	89 e5                	mov    %esp,%ebp
+     a85:	8b 45 08             	mov    0x8(%ebp),%eax
+     a88:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     a8c:	0f b6 10             	movzbl (%eax),%edx
+     a8f:	84 d2                	test   %dl,%dl
+     a91:	74 15                	je     aa8 <strchr+0x26>
+    if(*s == c)
+     a93:	38 d1                	cmp    %dl,%cl
+     a95:	74 0f                	je     aa6 <strchr+0x24>
+  for(; *s; s++)
+     a97:	83 c0 01             	add    $0x1,%eax
+     a9a:	0f b6 10             	movzbl (%eax),%edx
+     a9d:	84 d2                	test   %dl,%dl
+     a9f:	75 f2                	jne    a93 <strchr+0x11>
+      return (char*)s;
+  return 0;
+     aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     aa6:	5d                   	pop    %ebp
+     aa7:	c3                   	ret
+  return 0;
+     aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+     aad:	eb f7                	jmp    aa6 <strchr+0x24>
+
+00000aaf <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     aaf:	55                   	push   %ebp
+     ab0:	89 e5                	mov    %esp,%ebp
+     ab2:	57                   	push   %edi
+     ab3:	56                   	push   %esi
+     ab4:	53                   	push   %ebx
+     ab5:	83 ec 2c             	sub    $0x2c,%esp
+     ab8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     abb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+     ac0:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+     ac3:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+     ac6:	83 c3 01             	add    $0x1,%ebx
+     ac9:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     acc:	7d 27                	jge    af5 <gets+0x46>
+    cc = read(0, &c, 1);
+     ace:	83 ec 04             	sub    $0x4,%esp
+     ad1:	6a 01                	push   $0x1
+     ad3:	57                   	push   %edi
+     ad4:	6a 00                	push   $0x0
+     ad6:	e8 f9 00 00 00       	call   bd4 <read>
+    if(cc < 1)
+     adb:	83 c4 10             	add    $0x10,%esp
+     ade:	85 c0                	test   %eax,%eax
+     ae0:	7e 13                	jle    af5 <gets+0x46>
+      break;
+    buf[i++] = c;
+     ae2:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     ae6:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+     aea:	3c 0a                	cmp    $0xa,%al
+     aec:	74 04                	je     af2 <gets+0x43>
+     aee:	3c 0d                	cmp    $0xd,%al
+     af0:	75 d1                	jne    ac3 <gets+0x14>
+  for(i=0; i+1 < max; ){
+     af2:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+     af5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     af8:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+     afc:	89 f0                	mov    %esi,%eax
+     afe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b01:	5b                   	pop    %ebx
+     b02:	5e                   	pop    %esi
+     b03:	5f                   	pop    %edi
+     b04:	5d                   	pop    %ebp
+     b05:	c3                   	ret
+
+00000b06 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     b06:	55                   	push   %ebp
+     b07:	89 e5                	mov    %esp,%ebp
+     b09:	56                   	push   %esi
+     b0a:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     b0b:	83 ec 08             	sub    $0x8,%esp
+     b0e:	6a 00                	push   $0x0
+     b10:	ff 75 08             	push   0x8(%ebp)
+     b13:	e8 e4 00 00 00       	call   bfc <open>
+  if(fd < 0)
+     b18:	83 c4 10             	add    $0x10,%esp
+     b1b:	85 c0                	test   %eax,%eax
+     b1d:	78 24                	js     b43 <stat+0x3d>
+     b1f:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+     b21:	83 ec 08             	sub    $0x8,%esp
+     b24:	ff 75 0c             	push   0xc(%ebp)
+     b27:	50                   	push   %eax
+     b28:	e8 e7 00 00 00       	call   c14 <fstat>
+     b2d:	89 c6                	mov    %eax,%esi
+  close(fd);
+     b2f:	89 1c 24             	mov    %ebx,(%esp)
+     b32:	e8 ad 00 00 00       	call   be4 <close>
+  return r;
+     b37:	83 c4 10             	add    $0x10,%esp
+}
+     b3a:	89 f0                	mov    %esi,%eax
+     b3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b3f:	5b                   	pop    %ebx
+     b40:	5e                   	pop    %esi
+     b41:	5d                   	pop    %ebp
+     b42:	c3                   	ret
+    return -1;
+     b43:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     b48:	eb f0                	jmp    b3a <stat+0x34>
+
+00000b4a <atoi>:
+
+int
+atoi(const char *s)
+{
+     b4a:	55                   	push   %ebp
+     b4b:	89 e5                	mov    %esp,%ebp
+     b4d:	53                   	push   %ebx
+     b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     b51:	0f b6 02             	movzbl (%edx),%eax
+     b54:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     b57:	80 f9 09             	cmp    $0x9,%cl
+     b5a:	77 24                	ja     b80 <atoi+0x36>
+  n = 0;
+     b5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+     b61:	83 c2 01             	add    $0x1,%edx
+     b64:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     b67:	0f be c0             	movsbl %al,%eax
+     b6a:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     b6e:	0f b6 02             	movzbl (%edx),%eax
+     b71:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     b74:	80 fb 09             	cmp    $0x9,%bl
+     b77:	76 e8                	jbe    b61 <atoi+0x17>
+  return n;
+}
+     b79:	89 c8                	mov    %ecx,%eax
+     b7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b7e:	c9                   	leave
+     b7f:	c3                   	ret
+  n = 0;
+     b80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+     b85:	eb f2                	jmp    b79 <atoi+0x2f>
+
+00000b87 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     b87:	55                   	push   %ebp
+     b88:	89 e5                	mov    %esp,%ebp
+     b8a:	56                   	push   %esi
+     b8b:	53                   	push   %ebx
+     b8c:	8b 75 08             	mov    0x8(%ebp),%esi
+     b8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+     b92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     b95:	85 db                	test   %ebx,%ebx
+     b97:	7e 15                	jle    bae <memmove+0x27>
+     b99:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+     b9b:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+     b9d:	83 c2 01             	add    $0x1,%edx
+     ba0:	83 c0 01             	add    $0x1,%eax
+     ba3:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+     ba7:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+     baa:	39 c3                	cmp    %eax,%ebx
+     bac:	75 ef                	jne    b9d <memmove+0x16>
+  return vdst;
+}
+     bae:	89 f0                	mov    %esi,%eax
+     bb0:	5b                   	pop    %ebx
+     bb1:	5e                   	pop    %esi
+     bb2:	5d                   	pop    %ebp
+     bb3:	c3                   	ret
+
+00000bb4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     bb4:	b8 01 00 00 00       	mov    $0x1,%eax
+     bb9:	cd 40                	int    $0x40
+     bbb:	c3                   	ret
+
+00000bbc <exit>:
+SYSCALL(exit)
+     bbc:	b8 02 00 00 00       	mov    $0x2,%eax
+     bc1:	cd 40                	int    $0x40
+     bc3:	c3                   	ret
+
+00000bc4 <wait>:
+SYSCALL(wait)
+     bc4:	b8 03 00 00 00       	mov    $0x3,%eax
+     bc9:	cd 40                	int    $0x40
+     bcb:	c3                   	ret
+
+00000bcc <pipe>:
+SYSCALL(pipe)
+     bcc:	b8 04 00 00 00       	mov    $0x4,%eax
+     bd1:	cd 40                	int    $0x40
+     bd3:	c3                   	ret
+
+00000bd4 <read>:
+SYSCALL(read)
+     bd4:	b8 05 00 00 00       	mov    $0x5,%eax
+     bd9:	cd 40                	int    $0x40
+     bdb:	c3                   	ret
+
+00000bdc <write>:
+SYSCALL(write)
+     bdc:	b8 10 00 00 00       	mov    $0x10,%eax
+     be1:	cd 40                	int    $0x40
+     be3:	c3                   	ret
+
+00000be4 <close>:
+SYSCALL(close)
+     be4:	b8 15 00 00 00       	mov    $0x15,%eax
+     be9:	cd 40                	int    $0x40
+     beb:	c3                   	ret
+
+00000bec <kill>:
+SYSCALL(kill)
+     bec:	b8 06 00 00 00       	mov    $0x6,%eax
+     bf1:	cd 40                	int    $0x40
+     bf3:	c3                   	ret
+
+00000bf4 <exec>:
+SYSCALL(exec)
+     bf4:	b8 07 00 00 00       	mov    $0x7,%eax
+     bf9:	cd 40                	int    $0x40
+     bfb:	c3                   	ret
+
+00000bfc <open>:
+SYSCALL(open)
+     bfc:	b8 0f 00 00 00       	mov    $0xf,%eax
+     c01:	cd 40                	int    $0x40
+     c03:	c3                   	ret
+
+00000c04 <mknod>:
+SYSCALL(mknod)
+     c04:	b8 11 00 00 00       	mov    $0x11,%eax
+     c09:	cd 40                	int    $0x40
+     c0b:	c3                   	ret
+
+00000c0c <unlink>:
+SYSCALL(unlink)
+     c0c:	b8 12 00 00 00       	mov    $0x12,%eax
+     c11:	cd 40                	int    $0x40
+     c13:	c3                   	ret
+
+00000c14 <fstat>:
+SYSCALL(fstat)
+     c14:	b8 08 00 00 00       	mov    $0x8,%eax
+     c19:	cd 40                	int    $0x40
+     c1b:	c3                   	ret
+
+00000c1c <link>:
+SYSCALL(link)
+     c1c:	b8 13 00 00 00       	mov    $0x13,%eax
+     c21:	cd 40                	int    $0x40
+     c23:	c3                   	ret
+
+00000c24 <mkdir>:
+SYSCALL(mkdir)
+     c24:	b8 14 00 00 00       	mov    $0x14,%eax
+     c29:	cd 40                	int    $0x40
+     c2b:	c3                   	ret
+
+00000c2c <chdir>:
+SYSCALL(chdir)
+     c2c:	b8 09 00 00 00       	mov    $0x9,%eax
+     c31:	cd 40                	int    $0x40
+     c33:	c3                   	ret
+
+00000c34 <dup>:
+SYSCALL(dup)
+     c34:	b8 0a 00 00 00       	mov    $0xa,%eax
+     c39:	cd 40                	int    $0x40
+     c3b:	c3                   	ret
+
+00000c3c <getpid>:
+SYSCALL(getpid)
+     c3c:	b8 0b 00 00 00       	mov    $0xb,%eax
+     c41:	cd 40                	int    $0x40
+     c43:	c3                   	ret
+
+00000c44 <sbrk>:
+SYSCALL(sbrk)
+     c44:	b8 0c 00 00 00       	mov    $0xc,%eax
+     c49:	cd 40                	int    $0x40
+     c4b:	c3                   	ret
+
+00000c4c <sleep>:
+SYSCALL(sleep)
+     c4c:	b8 0d 00 00 00       	mov    $0xd,%eax
+     c51:	cd 40                	int    $0x40
+     c53:	c3                   	ret
+
+00000c54 <uptime>:
+SYSCALL(uptime)
+     c54:	b8 0e 00 00 00       	mov    $0xe,%eax
+     c59:	cd 40                	int    $0x40
+     c5b:	c3                   	ret
+
+00000c5c <readmouse>:
+SYSCALL(readmouse)
+     c5c:	b8 16 00 00 00       	mov    $0x16,%eax
+     c61:	cd 40                	int    $0x40
+     c63:	c3                   	ret
+
+00000c64 <sigsend>:
+SYSCALL(sigsend)
+     c64:	b8 17 00 00 00       	mov    $0x17,%eax
+     c69:	cd 40                	int    $0x40
+     c6b:	c3                   	ret
+
+00000c6c <sigsethandler>:
+SYSCALL(sigsethandler)
+     c6c:	b8 18 00 00 00       	mov    $0x18,%eax
+     c71:	cd 40                	int    $0x40
+     c73:	c3                   	ret
+
+00000c74 <sigreturn>:
+SYSCALL(sigreturn)
+     c74:	b8 19 00 00 00       	mov    $0x19,%eax
+     c79:	cd 40                	int    $0x40
+     c7b:	c3                   	ret
+
+00000c7c <siggetmask>:
+SYSCALL(siggetmask)
+     c7c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     c81:	cd 40                	int    $0x40
+     c83:	c3                   	ret
+
+00000c84 <sigsetmask>:
+SYSCALL(sigsetmask)
+     c84:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     c89:	cd 40                	int    $0x40
+     c8b:	c3                   	ret
+
+00000c8c <sigpause>:
+SYSCALL(sigpause)
+     c8c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     c91:	cd 40                	int    $0x40
+     c93:	c3                   	ret
+
+00000c94 <predict_cpu>:
+SYSCALL(predict_cpu)
+     c94:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     c99:	cd 40                	int    $0x40
+     c9b:	c3                   	ret
+
+00000c9c <sleeptick>:
+SYSCALL(sleeptick)
+     c9c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ca1:	cd 40                	int    $0x40
+     ca3:	c3                   	ret
+
+00000ca4 <schedctl>:
+SYSCALL(schedctl)
+     ca4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ca9:	cd 40                	int    $0x40
+     cab:	c3                   	ret
+
+00000cac <nswtch>:
+SYSCALL(nswtch)
+     cac:	b8 20 00 00 00       	mov    $0x20,%eax
+     cb1:	cd 40                	int    $0x40
+     cb3:	c3                   	ret
+
+00000cb4 <getloadavg>:
+SYSCALL(getloadavg)
+     cb4:	b8 21 00 00 00       	mov    $0x21,%eax
+     cb9:	cd 40                	int    $0x40
+     cbb:	c3                   	ret
+
+00000cbc <memstat>:
+SYSCALL(memstat)
+     cbc:	b8 22 00 00 00       	mov    $0x22,%eax
+     cc1:	cd 40                	int    $0x40
+     cc3:	c3                   	ret
+
+00000cc4 <iostat>:
+SYSCALL(iostat)
+     cc4:	b8 23 00 00 00       	mov    $0x23,%eax
+     cc9:	cd 40                	int    $0x40
+     ccb:	c3                   	ret
+
+00000ccc <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     ccc:	55                   	push   %ebp
+     ccd:	89 e5                	mov    %esp,%ebp
+     ccf:	57                   	push   %edi
+     cd0:	56                   	push   %esi
+     cd1:	53                   	push   %ebx
+     cd2:	83 ec 3c             	sub    $0x3c,%esp
+     cd5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     cd8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     cda:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     cde:	74 79                	je     d59 <printint+0x8d>
+     ce0:	85 d2                	test   %edx,%edx
+     ce2:	79 75                	jns    d59 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+     ce4:	89 d1                	mov    %edx,%ecx
+     ce6:	f7 d9                	neg    %ecx
+    neg = 1;
+     ce8:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     cef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     cf4:	89 df                	mov    %ebx,%edi
+     cf6:	83 c3 01             	add    $0x1,%ebx
+     cf9:	89 c8                	mov    %ecx,%eax
+     cfb:	ba 00 00 00 00       	mov    $0x0,%edx
+     d00:	f7 f6                	div    %esi
+     d02:	0f b6 92 a4 11 00 00 	movzbl 0x11a4(%edx),%edx
+     d09:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+     d0d:	89 ca                	mov    %ecx,%edx
+     d0f:	89 c1                	mov    %eax,%ecx
+     d11:	39 f2                	cmp    %esi,%edx
+     d13:	73 df                	jae    cf4 <printint+0x28>
+  if(neg)
+     d15:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+     d19:	74 08                	je     d23 <printint+0x57>
+    buf[i++] = '-';
+     d1b:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     d20:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+     d23:	85 db                	test   %ebx,%ebx
+     d25:	7e 2a                	jle    d51 <printint+0x85>
+     d27:	8d 75 d8             	lea    -0x28(%ebp),%esi
+     d2a:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+     d2e:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+     d31:	0f b6 03             	movzbl (%ebx),%eax
+     d34:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+     d37:	83 ec 04             	sub    $0x4,%esp
+     d3a:	6a 01                	push   $0x1
+     d3c:	57                   	push   %edi
+     d3d:	ff 75 c4             	push   -0x3c(%ebp)
+     d40:	e8 97 fe ff ff       	call   bdc <write>
+  while(--i >= 0)
+     d45:	89 d8                	mov    %ebx,%eax
+     d47:	83 eb 01             	sub    $0x1,%ebx
+     d4a:	83 c4 10             	add    $0x10,%esp
+     d4d:	39 f0                	cmp    %esi,%eax
+     d4f:	75 e0                	jne    d31 <printint+0x65>
+}
+     d51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d54:	5b                   	pop    %ebx
+     d55:	5e                   	pop    %esi
+     d56:	5f                   	pop    %edi
+     d57:	5d                   	pop    %ebp
+     d58:	c3                   	ret
+    x = xx;
+     d59:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+     d5b:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+     d62:	eb 8b                	jmp    cef <printint+0x23>
+
+00000d64 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     d64:	55                   	push   %ebp
+     d65:	89 e5                	mov    %esp,%ebp
+     d67:	57                   	push   %edi
+     d68:	56                   	push   %esi
+     d69:	53                   	push   %ebx
+     d6a:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     d6d:	8b 75 0c             	mov    0xc(%ebp),%esi
+     d70:	0f b6 1e             	movzbl (%esi),%ebx
+     d73:	84 db                	test   %bl,%bl
+     d75:	0f 84 9e 01 00 00    	je     f19 <printf+0x1b5>
+     d7b:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+     d7e:	8d 45 10             	lea    0x10(%ebp),%eax
+     d81:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+     d84:	bf 00 00 00 00       	mov    $0x0,%edi
+     d89:	eb 2d                	jmp    db8 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+     d8b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+     d8e:	83 ec 04             	sub    $0x4,%esp
+     d91:	6a 01                	push   $0x1
+     d93:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     d96:	50                   	push   %eax
+     d97:	ff 75 08             	push   0x8(%ebp)
+     d9a:	e8 3d fe ff ff       	call   bdc <write>
+        putc(fd, c);
+     d9f:	83 c4 10             	add    $0x10,%esp
+     da2:	eb 05                	jmp    da9 <printf+0x45>
+      }
+    } else if(state == '%'){
+     da4:	83 ff 25             	cmp    $0x25,%edi
+     da7:	74 1f                	je     dc8 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+     da9:	83 c6 01             	add    $0x1,%esi
+     dac:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+     db0:	84 db                	test   %bl,%bl
+     db2:	0f 84 61 01 00 00    	je     f19 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+     db8:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     dbb:	85 ff                	test   %edi,%edi
+     dbd:	75 e5                	jne    da4 <printf+0x40>
+      if(c == '%'){
+     dbf:	83 f8 25             	cmp    $0x25,%eax
+     dc2:	75 c7                	jne    d8b <printf+0x27>
+        state = '%';
+     dc4:	89 c7                	mov    %eax,%edi
+     dc6:	eb e1                	jmp    da9 <printf+0x45>
+      if(c == 'd'){
+     dc8:	83 f8 25             	cmp    $0x25,%eax
+     dcb:	0f 84 f4 00 00 00    	je     ec5 <printf+0x161>
+     dd1:	8d 50 9d             	lea    -0x63(%eax),%edx
+     dd4:	83 fa 15             	cmp    $0x15,%edx
+     dd7:	0f 87 09 01 00 00    	ja     ee6 <printf+0x182>
+     ddd:	0f 87 03 01 00 00    	ja     ee6 <printf+0x182>
+     de3:	ff 24 95 4c 11 00 00 	jmp    *0x114c(,%edx,4)
+        printint(fd, *ap, 10, 1);
+     dea:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     ded:	8b 17                	mov    (%edi),%edx
+     def:	83 ec 0c             	sub    $0xc,%esp
+     df2:	6a 01                	push   $0x1
+     df4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     df9:	8b 45 08             	mov    0x8(%ebp),%eax
+     dfc:	e8 cb fe ff ff       	call   ccc <printint>
+        ap++;
+     e01:	83 c7 04             	add    $0x4,%edi
+     e04:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     e07:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+     e0a:	bf 00 00 00 00       	mov    $0x0,%edi
+     e0f:	eb 98                	jmp    da9 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+     e11:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     e14:	8b 17                	mov    (%edi),%edx
+     e16:	83 ec 0c             	sub    $0xc,%esp
+     e19:	6a 00                	push   $0x0
+     e1b:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e20:	8b 45 08             	mov    0x8(%ebp),%eax
+     e23:	e8 a4 fe ff ff       	call   ccc <printint>
+        ap++;
+     e28:	83 c7 04             	add    $0x4,%edi
+     e2b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     e2e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e31:	bf 00 00 00 00       	mov    $0x0,%edi
+     e36:	e9 6e ff ff ff       	jmp    da9 <printf+0x45>
+        s = (char*)*ap;
+     e3b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     e3e:	8b 01                	mov    (%ecx),%eax
+        ap++;
+     e40:	83 c1 04             	add    $0x4,%ecx
+     e43:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+     e46:	85 c0                	test   %eax,%eax
+     e48:	74 13                	je     e5d <printf+0xf9>
+        s = (char*)*ap;
+     e4a:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+     e4c:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+     e4f:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+     e54:	84 c0                	test   %al,%al
+     e56:	75 0f                	jne    e67 <printf+0x103>
+     e58:	e9 4c ff ff ff       	jmp    da9 <printf+0x45>
+          s = "(null)";
+     e5d:	bb 44 11 00 00       	mov    $0x1144,%ebx
+        while(*s != 0){
+     e62:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+     e67:	8d 7d e7             	lea    -0x19(%ebp),%edi
+     e6a:	89 75 d0             	mov    %esi,-0x30(%ebp)
+     e6d:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+     e70:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     e73:	83 ec 04             	sub    $0x4,%esp
+     e76:	6a 01                	push   $0x1
+     e78:	57                   	push   %edi
+     e79:	56                   	push   %esi
+     e7a:	e8 5d fd ff ff       	call   bdc <write>
+          s++;
+     e7f:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+     e82:	0f b6 03             	movzbl (%ebx),%eax
+     e85:	83 c4 10             	add    $0x10,%esp
+     e88:	84 c0                	test   %al,%al
+     e8a:	75 e4                	jne    e70 <printf+0x10c>
+      state = 0;
+     e8c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     e8f:	bf 00 00 00 00       	mov    $0x0,%edi
+     e94:	e9 10 ff ff ff       	jmp    da9 <printf+0x45>
+        putc(fd, *ap);
+     e99:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     e9c:	8b 07                	mov    (%edi),%eax
+     e9e:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     ea1:	83 ec 04             	sub    $0x4,%esp
+     ea4:	6a 01                	push   $0x1
+     ea6:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     ea9:	50                   	push   %eax
+     eaa:	ff 75 08             	push   0x8(%ebp)
+     ead:	e8 2a fd ff ff       	call   bdc <write>
+        ap++;
+     eb2:	83 c7 04             	add    $0x4,%edi
+     eb5:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+     eb8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+     ec0:	e9 e4 fe ff ff       	jmp    da9 <printf+0x45>
+        putc(fd, c);
+     ec5:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+     ec8:	83 ec 04             	sub    $0x4,%esp
+     ecb:	6a 01                	push   $0x1
+     ecd:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     ed0:	50                   	push   %eax
+     ed1:	ff 75 08             	push   0x8(%ebp)
+     ed4:	e8 03 fd ff ff       	call   bdc <write>
+     ed9:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     edc:	bf 00 00 00 00       	mov    $0x0,%edi
+     ee1:	e9 c3 fe ff ff       	jmp    da9 <printf+0x45>
+        putc(fd, '%');
+     ee6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+     eea:	83 ec 04             	sub    $0x4,%esp
+     eed:	6a 01                	push   $0x1
+     eef:	8d 7d e7             	lea    -0x19(%ebp),%edi
+     ef2:	57                   	push   %edi
+     ef3:	ff 75 08             	push   0x8(%ebp)
+     ef6:	e8 e1 fc ff ff       	call   bdc <write>
+        putc(fd, c);
+     efb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+     efe:	83 c4 0c             	add    $0xc,%esp
+     f01:	6a 01                	push   $0x1
+     f03:	57                   	push   %edi
+     f04:	ff 75 08             	push   0x8(%ebp)
+     f07:	e8 d0 fc ff ff       	call   bdc <write>
+        putc(fd, c);
+     f0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f0f:	bf 00 00 00 00       	mov    $0x0,%edi
+     f14:	e9 90 fe ff ff       	jmp    da9 <printf+0x45>
+    }
+  }
+}
+     f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f1c:	5b                   	pop    %ebx
+     f1d:	5e                   	pop    %esi
+     f1e:	5f                   	pop    %edi
+     f1f:	5d                   	pop    %ebp
+     f20:	c3                   	ret
+
+00000f21 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f21:	55                   	push   %ebp
+     f22:	89 e5                	mov    %esp,%ebp
+     f24:	57                   	push   %edi
+     f25:	56                   	push   %esi
+     f26:	53                   	push   %ebx
+     f27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     f2a:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f2d:	a1 64 17 00 00       	mov    0x1764,%eax
+     f32:	eb 0c                	jmp    f40 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f34:	8b 10                	mov    (%eax),%edx
+     f36:	39 d0                	cmp    %edx,%eax
+     f38:	72 04                	jb     f3e <free+0x1d>
+     f3a:	39 d1                	cmp    %edx,%ecx
+     f3c:	72 10                	jb     f4e <free+0x2d>
+{
+     f3e:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f40:	39 c8                	cmp    %ecx,%eax
+     f42:	73 f0                	jae    f34 <free+0x13>
+     f44:	8b 10                	mov    (%eax),%edx
+     f46:	39 d1                	cmp    %edx,%ecx
+     f48:	72 04                	jb     f4e <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f4a:	39 d0                	cmp    %edx,%eax
+     f4c:	72 f0                	jb     f3e <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f4e:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f51:	8b 10                	mov    (%eax),%edx
+     f53:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f56:	39 fa                	cmp    %edi,%edx
+     f58:	74 19                	je     f73 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f5a:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f5d:	8b 50 04             	mov    0x4(%eax),%edx
+     f60:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+     f63:	39 f1                	cmp    %esi,%ecx
+     f65:	74 18                	je     f7f <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f67:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+     f69:	a3 64 17 00 00       	mov    %eax,0x1764
+}
+     f6e:	5b                   	pop    %ebx
+     f6f:	5e                   	pop    %esi
+     f70:	5f                   	pop    %edi
+     f71:	5d                   	pop    %ebp
+     f72:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+     f73:	03 72 04             	add    0x4(%edx),%esi
+     f76:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f79:	8b 10                	mov    (%eax),%edx
+     f7b:	8b 12                	mov    (%edx),%edx
+     f7d:	eb db                	jmp    f5a <free+0x39>
+    p->s.size += bp->s.size;
+     f7f:	03 53 fc             	add    -0x4(%ebx),%edx
+     f82:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     f85:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f88:	eb dd                	jmp    f67 <free+0x46>
+
+00000f8a <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f8a:	55                   	push   %ebp
+     f8b:	89 e5                	mov    %esp,%ebp
+     f8d:	57                   	push   %edi
+     f8e:	56                   	push   %esi
+     f8f:	53                   	push   %ebx
+     f90:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f93:	8b 45 08             	mov    0x8(%ebp),%eax
+     f96:	8d 58 07             	lea    0x7(%eax),%ebx
+     f99:	c1 eb 03             	shr    $0x3,%ebx
+     f9c:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+     f9f:	8b 15 64 17 00 00    	mov    0x1764,%edx
+     fa5:	85 d2                	test   %edx,%edx
+     fa7:	74 1c                	je     fc5 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fa9:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fab:	8b 48 04             	mov    0x4(%eax),%ecx
+     fae:	39 d9                	cmp    %ebx,%ecx
+     fb0:	73 38                	jae    fea <malloc+0x60>
+  if(nu < 4096)
+     fb2:	be 00 10 00 00       	mov    $0x1000,%esi
+     fb7:	39 f3                	cmp    %esi,%ebx
+     fb9:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+     fbc:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+     fc3:	eb 72                	jmp    1037 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+     fc5:	c7 05 64 17 00 00 68 	movl   $0x1768,0x1764
+     fcc:	17 00 00 
+     fcf:	c7 05 68 17 00 00 68 	movl   $0x1768,0x1768
+     fd6:	17 00 00 
+    base.s.size = 0;
+     fd9:	c7 05 6c 17 00 00 00 	movl   $0x0,0x176c
+     fe0:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fe3:	b8 68 17 00 00       	mov    $0x1768,%eax
+    if(p->s.size >= nunits){
+     fe8:	eb c8                	jmp    fb2 <malloc+0x28>
+      if(p->s.size == nunits)
+     fea:	39 cb                	cmp    %ecx,%ebx
+     fec:	74 1e                	je     100c <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+     fee:	29 d9                	sub    %ebx,%ecx
+     ff0:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     ff3:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     ff6:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+     ff9:	89 15 64 17 00 00    	mov    %edx,0x1764
+      return (void*)(p + 1);
+     fff:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    1002:	89 d0                	mov    %edx,%eax
+    1004:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1007:	5b                   	pop    %ebx
+    1008:	5e                   	pop    %esi
+    1009:	5f                   	pop    %edi
+    100a:	5d                   	pop    %ebp
+    100b:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    100c:	8b 08                	mov    (%eax),%ecx
+    100e:	89 0a                	mov    %ecx,(%edx)
+    1010:	eb e7                	jmp    ff9 <malloc+0x6f>
+  hp->s.size = nu;
+    1012:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    1015:	83 ec 0c             	sub    $0xc,%esp
+    1018:	83 c0 08             	add    $0x8,%eax
+    101b:	50                   	push   %eax
+    101c:	e8 00 ff ff ff       	call   f21 <free>
+  return freep;
+    1021:	8b 15 64 17 00 00    	mov    0x1764,%edx
+      if((p = morecore(nunits)) == 0)
+    1027:	83 c4 10             	add    $0x10,%esp
+    102a:	85 d2                	test   %edx,%edx
+    102c:	74 d4                	je     1002 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    102e:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1030:	8b 48 04             	mov    0x4(%eax),%ecx
+    1033:	39 d9                	cmp    %ebx,%ecx
+    1035:	73 b3                	jae    fea <malloc+0x60>
+    if(p == freep)
+    1037:	89 c2                	mov    %eax,%edx
+    1039:	39 05 64 17 00 00    	cmp    %eax,0x1764
+    103f:	75 ed                	jne    102e <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    1041:	83 ec 0c             	sub    $0xc,%esp
+    1044:	57                   	push   %edi
+    1045:	e8 fa fb ff ff       	call   c44 <sbrk>
+  if(p == (char*)-1)
+    104a:	83 c4 10             	add    $0x10,%esp
+    104d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1050:	75 c0                	jne    1012 <malloc+0x88>
+        return 0;
+    1052:	ba 00 00 00 00       	mov    $0x0,%edx
+    1057:	eb a9                	jmp    1002 <malloc+0x78>
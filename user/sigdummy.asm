@@ -0,0 +1,1135 @@
+
+_sigdummy:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <handler>:
+#include "kernel/types.h"
+#include "user.h"
+
+void handler(int sig){
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 0c             	sub    $0xc,%esp
+    printf(1, "i have received sig %d\n", sig);
+   6:	ff 75 08             	push   0x8(%ebp)
+   9:	68 00 07 00 00       	push   $0x700
+   e:	6a 01                	push   $0x1
+  10:	e8 f5 03 00 00       	call   40a <printf>
+}
+  15:	83 c4 10             	add    $0x10,%esp
+  18:	c9                   	leave
+  19:	c3                   	ret
+
+0000001a <main>:
+
+int main(){
+  1a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  1e:	83 e4 f0             	and    $0xfffffff0,%esp
+  21:	ff 71 fc             	push   -0x4(%ecx)
+  24:	55                   	push   %ebp
+  25:	89 e5                	mov    %esp,%ebp
+  27:	53                   	push   %ebx
+  28:	51                   	push   %ecx
+    int currentpid=getpid();
+  29:	e8 b4 02 00 00       	call   2e2 <getpid>
+  2e:	89 c3                	mov    %eax,%ebx
+    handler(2);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  33:	6a 02                	push   $0x2
+  35:	e8 c6 ff ff ff       	call   0 <handler>
+    int addr=(int)&handler;
+    printf(1, "my pid is: %d\n", currentpid);
+  3a:	83 c4 0c             	add    $0xc,%esp
+  3d:	53                   	push   %ebx
+  3e:	68 18 07 00 00       	push   $0x718
+  43:	6a 01                	push   $0x1
+  45:	e8 c0 03 00 00       	call   40a <printf>
+    printf(1, "handler address is %d\n", addr);
+  4a:	83 c4 0c             	add    $0xc,%esp
+  4d:	68 00 00 00 00       	push   $0x0
+  52:	68 27 07 00 00       	push   $0x727
+  57:	6a 01                	push   $0x1
+  59:	e8 ac 03 00 00       	call   40a <printf>
+    sigsethandler(500, handler);
+  5e:	83 c4 08             	add    $0x8,%esp
+  61:	68 00 00 00 00       	push   $0x0
+  66:	68 f4 01 00 00       	push   $0x1f4
+  6b:	e8 a2 02 00 00       	call   312 <sigsethandler>
+    int blockmask=~(0x1);
+    sigpause(blockmask);
+  70:	c7 04 24 fe ff ff ff 	movl   $0xfffffffe,(%esp)
+  77:	e8 b6 02 00 00       	call   332 <sigpause>
+    printf(1, "ending\n");
+  7c:	83 c4 08             	add    $0x8,%esp
+  7f:	68 3e 07 00 00       	push   $0x73e
+  84:	6a 01                	push   $0x1
+  86:	e8 7f 03 00 00       	call   40a <printf>
+  8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  93:	59                   	pop    %ecx
+  94:	5b                   	pop    %ebx
+  95:	5d                   	pop    %ebp
+  96:	8d 61 fc             	lea    -0x4(%ecx),%esp
+  99:	c3                   	ret
+
+0000009a <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	53                   	push   %ebx
+  9e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  a9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  ad:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  b0:	83 c0 01             	add    $0x1,%eax
+  b3:	84 d2                	test   %dl,%dl
+  b5:	75 f2                	jne    a9 <strcpy+0xf>
+    ;
+  return os;
+}
+  b7:	89 c8                	mov    %ecx,%eax
+  b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  bc:	c9                   	leave
+  bd:	c3                   	ret
+
+000000be <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  be:	55                   	push   %ebp
+  bf:	89 e5                	mov    %esp,%ebp
+  c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  c7:	0f b6 01             	movzbl (%ecx),%eax
+  ca:	84 c0                	test   %al,%al
+  cc:	74 11                	je     df <strcmp+0x21>
+  ce:	38 02                	cmp    %al,(%edx)
+  d0:	75 0d                	jne    df <strcmp+0x21>
+    p++, q++;
+  d2:	83 c1 01             	add    $0x1,%ecx
+  d5:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  d8:	0f b6 01             	movzbl (%ecx),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	75 ef                	jne    ce <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  df:	0f b6 c0             	movzbl %al,%eax
+  e2:	0f b6 12             	movzbl (%edx),%edx
+  e5:	29 d0                	sub    %edx,%eax
+}
+  e7:	5d                   	pop    %ebp
+  e8:	c3                   	ret
+
+000000e9 <strlen>:
+
+uint
+strlen(char *s)
+{
+  e9:	55                   	push   %ebp
+  ea:	89 e5                	mov    %esp,%ebp
+  ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  ef:	80 3a 00             	cmpb   $0x0,(%edx)
+  f2:	74 14                	je     108 <strlen+0x1f>
+  f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  f9:	83 c0 01             	add    $0x1,%eax
+  fc:	89 c1                	mov    %eax,%ecx
+  fe:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 102:	75 f5                	jne    f9 <strlen+0x10>
+    ;
+  return n;
+}
+ 104:	89 c8                	mov    %ecx,%eax
+ 106:	5d                   	pop    %ebp
+ 107:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 108:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 10d:	eb f5                	jmp    104 <strlen+0x1b>
+
+0000010f <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 10f:	55                   	push   %ebp
+ 110:	89 e5                	mov    %esp,%ebp
+ 112:	57                   	push   %edi
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 116:	89 d7                	mov    %edx,%edi
+ 118:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 11b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11e:	fc                   	cld
+ 11f:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 121:	89 d0                	mov    %edx,%eax
+ 123:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 126:	c9                   	leave
+ 127:	c3                   	ret
+
+00000128 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 128:	55                   	push   %ebp
+ 129:	89 e5                	mov    %esp,%ebp
+ 12b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 132:	0f b6 10             	movzbl (%eax),%edx
+ 135:	84 d2                	test   %dl,%dl
+ 137:	74 15                	je     14e <strchr+0x26>
+    if(*s == c)
+ 139:	38 d1                	cmp    %dl,%cl
+ 13b:	74 0f                	je     14c <strchr+0x24>
+  for(; *s; s++)
+ 13d:	83 c0 01             	add    $0x1,%eax
+ 140:	0f b6 10             	movzbl (%eax),%edx
+ 143:	84 d2                	test   %dl,%dl
+ 145:	75 f2                	jne    139 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 147:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 14c:	5d                   	pop    %ebp
+ 14d:	c3                   	ret
+  return 0;
+ 14e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 153:	eb f7                	jmp    14c <strchr+0x24>
+
+00000155 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 155:	55                   	push   %ebp
+ 156:	89 e5                	mov    %esp,%ebp
+ 158:	57                   	push   %edi
+ 159:	56                   	push   %esi
+ 15a:	53                   	push   %ebx
+ 15b:	83 ec 2c             	sub    $0x2c,%esp
+ 15e:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 161:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 166:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 169:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 16c:	83 c3 01             	add    $0x1,%ebx
+ 16f:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 172:	7d 27                	jge    19b <gets+0x46>
+    cc = read(0, &c, 1);
+ 174:	83 ec 04             	sub    $0x4,%esp
+ 177:	6a 01                	push   $0x1
+ 179:	57                   	push   %edi
+ 17a:	6a 00                	push   $0x0
+ 17c:	e8 f9 00 00 00       	call   27a <read>
+    if(cc < 1)
+ 181:	83 c4 10             	add    $0x10,%esp
+ 184:	85 c0                	test   %eax,%eax
+ 186:	7e 13                	jle    19b <gets+0x46>
+      break;
+    buf[i++] = c;
+ 188:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 18c:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 190:	3c 0a                	cmp    $0xa,%al
+ 192:	74 04                	je     198 <gets+0x43>
+ 194:	3c 0d                	cmp    $0xd,%al
+ 196:	75 d1                	jne    169 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 198:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 19b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 19e:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 1a2:	89 f0                	mov    %esi,%eax
+ 1a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1a7:	5b                   	pop    %ebx
+ 1a8:	5e                   	pop    %esi
+ 1a9:	5f                   	pop    %edi
+ 1aa:	5d                   	pop    %ebp
+ 1ab:	c3                   	ret
+
+000001ac <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ac:	55                   	push   %ebp
+ 1ad:	89 e5                	mov    %esp,%ebp
+ 1af:	56                   	push   %esi
+ 1b0:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	6a 00                	push   $0x0
+ 1b6:	ff 75 08             	push   0x8(%ebp)
+ 1b9:	e8 e4 00 00 00       	call   2a2 <open>
+  if(fd < 0)
+ 1be:	83 c4 10             	add    $0x10,%esp
+ 1c1:	85 c0                	test   %eax,%eax
+ 1c3:	78 24                	js     1e9 <stat+0x3d>
+ 1c5:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1c7:	83 ec 08             	sub    $0x8,%esp
+ 1ca:	ff 75 0c             	push   0xc(%ebp)
+ 1cd:	50                   	push   %eax
+ 1ce:	e8 e7 00 00 00       	call   2ba <fstat>
+ 1d3:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1d5:	89 1c 24             	mov    %ebx,(%esp)
+ 1d8:	e8 ad 00 00 00       	call   28a <close>
+  return r;
+ 1dd:	83 c4 10             	add    $0x10,%esp
+}
+ 1e0:	89 f0                	mov    %esi,%eax
+ 1e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e5:	5b                   	pop    %ebx
+ 1e6:	5e                   	pop    %esi
+ 1e7:	5d                   	pop    %ebp
+ 1e8:	c3                   	ret
+    return -1;
+ 1e9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1ee:	eb f0                	jmp    1e0 <stat+0x34>
+
+000001f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 1f7:	0f b6 02             	movzbl (%edx),%eax
+ 1fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 1fd:	80 f9 09             	cmp    $0x9,%cl
+ 200:	77 24                	ja     226 <atoi+0x36>
+  n = 0;
+ 202:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 207:	83 c2 01             	add    $0x1,%edx
+ 20a:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 20d:	0f be c0             	movsbl %al,%eax
+ 210:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 214:	0f b6 02             	movzbl (%edx),%eax
+ 217:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 21a:	80 fb 09             	cmp    $0x9,%bl
+ 21d:	76 e8                	jbe    207 <atoi+0x17>
+  return n;
+}
+ 21f:	89 c8                	mov    %ecx,%eax
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+  n = 0;
+ 226:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 22b:	eb f2                	jmp    21f <atoi+0x2f>
+
+0000022d <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 22d:	55                   	push   %ebp
+ 22e:	89 e5                	mov    %esp,%ebp
+ 230:	56                   	push   %esi
+ 231:	53                   	push   %ebx
+ 232:	8b 75 08             	mov    0x8(%ebp),%esi
+ 235:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 23b:	85 db                	test   %ebx,%ebx
+ 23d:	7e 15                	jle    254 <memmove+0x27>
+ 23f:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 241:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 243:	83 c2 01             	add    $0x1,%edx
+ 246:	83 c0 01             	add    $0x1,%eax
+ 249:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 24d:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 250:	39 c3                	cmp    %eax,%ebx
+ 252:	75 ef                	jne    243 <memmove+0x16>
+  return vdst;
+}
+ 254:	89 f0                	mov    %esi,%eax
+ 256:	5b                   	pop    %ebx
+ 257:	5e                   	pop    %esi
+ 258:	5d                   	pop    %ebp
+ 259:	c3                   	ret
+
+0000025a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 25a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 25f:	cd 40                	int    $0x40
+ 261:	c3                   	ret
+
+00000262 <exit>:
+SYSCALL(exit)
+ 262:	b8 02 00 00 00       	mov    $0x2,%eax
+ 267:	cd 40                	int    $0x40
+ 269:	c3                   	ret
+
+0000026a <wait>:
+SYSCALL(wait)
+ 26a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 26f:	cd 40                	int    $0x40
+ 271:	c3                   	ret
+
+00000272 <pipe>:
+SYSCALL(pipe)
+ 272:	b8 04 00 00 00       	mov    $0x4,%eax
+ 277:	cd 40                	int    $0x40
+ 279:	c3                   	ret
+
+0000027a <read>:
+SYSCALL(read)
+ 27a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 27f:	cd 40                	int    $0x40
+ 281:	c3                   	ret
+
+00000282 <write>:
+SYSCALL(write)
+ 282:	b8 10 00 00 00       	mov    $0x10,%eax
+ 287:	cd 40                	int    $0x40
+ 289:	c3                   	ret
+
+0000028a <close>:
+SYSCALL(close)
+ 28a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+00000292 <kill>:
+SYSCALL(kill)
+ 292:	b8 06 00 00 00       	mov    $0x6,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+0000029a <exec>:
+SYSCALL(exec)
+ 29a:	b8 07 00 00 00       	mov    $0x7,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+000002a2 <open>:
+SYSCALL(open)
+ 2a2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2a7:	cd 40                	int    $0x40
+ 2a9:	c3                   	ret
+
+000002aa <mknod>:
+SYSCALL(mknod)
+ 2aa:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+000002b2 <unlink>:
+SYSCALL(unlink)
+ 2b2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+000002ba <fstat>:
+SYSCALL(fstat)
+ 2ba:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+000002c2 <link>:
+SYSCALL(link)
+ 2c2:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+000002ca <mkdir>:
+SYSCALL(mkdir)
+ 2ca:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+000002d2 <chdir>:
+SYSCALL(chdir)
+ 2d2:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+000002da <dup>:
+SYSCALL(dup)
+ 2da:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+000002e2 <getpid>:
+SYSCALL(getpid)
+ 2e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+000002ea <sbrk>:
+SYSCALL(sbrk)
+ 2ea:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+000002f2 <sleep>:
+SYSCALL(sleep)
+ 2f2:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <uptime>:
+SYSCALL(uptime)
+ 2fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <readmouse>:
+SYSCALL(readmouse)
+ 302:	b8 16 00 00 00       	mov    $0x16,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <sigsend>:
+SYSCALL(sigsend)
+ 30a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 312:	b8 18 00 00 00       	mov    $0x18,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <sigreturn>:
+SYSCALL(sigreturn)
+ 31a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <siggetmask>:
+SYSCALL(siggetmask)
+ 322:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <sigsetmask>:
+SYSCALL(sigsetmask)
+ 32a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <sigpause>:
+SYSCALL(sigpause)
+ 332:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <predict_cpu>:
+SYSCALL(predict_cpu)
+ 33a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <sleeptick>:
+SYSCALL(sleeptick)
+ 342:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <schedctl>:
+SYSCALL(schedctl)
+ 34a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <nswtch>:
+SYSCALL(nswtch)
+ 352:	b8 20 00 00 00       	mov    $0x20,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <getloadavg>:
+SYSCALL(getloadavg)
+ 35a:	b8 21 00 00 00       	mov    $0x21,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <memstat>:
+SYSCALL(memstat)
+ 362:	b8 22 00 00 00       	mov    $0x22,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <iostat>:
+SYSCALL(iostat)
+ 36a:	b8 23 00 00 00       	mov    $0x23,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 372:	55                   	push   %ebp
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	57                   	push   %edi
+ 376:	56                   	push   %esi
+ 377:	53                   	push   %ebx
+ 378:	83 ec 3c             	sub    $0x3c,%esp
+ 37b:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 37e:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 380:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 384:	74 79                	je     3ff <printint+0x8d>
+ 386:	85 d2                	test   %edx,%edx
+ 388:	79 75                	jns    3ff <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 38a:	89 d1                	mov    %edx,%ecx
+ 38c:	f7 d9                	neg    %ecx
+    neg = 1;
+ 38e:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 395:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 39a:	89 df                	mov    %ebx,%edi
+ 39c:	83 c3 01             	add    $0x1,%ebx
+ 39f:	89 c8                	mov    %ecx,%eax
+ 3a1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 3a6:	f7 f6                	div    %esi
+ 3a8:	0f b6 92 a8 07 00 00 	movzbl 0x7a8(%edx),%edx
+ 3af:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 3b3:	89 ca                	mov    %ecx,%edx
+ 3b5:	89 c1                	mov    %eax,%ecx
+ 3b7:	39 f2                	cmp    %esi,%edx
+ 3b9:	73 df                	jae    39a <printint+0x28>
+  if(neg)
+ 3bb:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 3bf:	74 08                	je     3c9 <printint+0x57>
+    buf[i++] = '-';
+ 3c1:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 3c6:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 3c9:	85 db                	test   %ebx,%ebx
+ 3cb:	7e 2a                	jle    3f7 <printint+0x85>
+ 3cd:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 3d0:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 3d4:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 3d7:	0f b6 03             	movzbl (%ebx),%eax
+ 3da:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 3dd:	83 ec 04             	sub    $0x4,%esp
+ 3e0:	6a 01                	push   $0x1
+ 3e2:	57                   	push   %edi
+ 3e3:	ff 75 c4             	push   -0x3c(%ebp)
+ 3e6:	e8 97 fe ff ff       	call   282 <write>
+  while(--i >= 0)
+ 3eb:	89 d8                	mov    %ebx,%eax
+ 3ed:	83 eb 01             	sub    $0x1,%ebx
+ 3f0:	83 c4 10             	add    $0x10,%esp
+ 3f3:	39 f0                	cmp    %esi,%eax
+ 3f5:	75 e0                	jne    3d7 <printint+0x65>
+}
+ 3f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fa:	5b                   	pop    %ebx
+ 3fb:	5e                   	pop    %esi
+ 3fc:	5f                   	pop    %edi
+ 3fd:	5d                   	pop    %ebp
+ 3fe:	c3                   	ret
+    x = xx;
+ 3ff:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 401:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 408:	eb 8b                	jmp    395 <printint+0x23>
+
+0000040a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 40a:	55                   	push   %ebp
+ 40b:	89 e5                	mov    %esp,%ebp
+ 40d:	57                   	push   %edi
+ 40e:	56                   	push   %esi
+ 40f:	53                   	push   %ebx
+ 410:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 413:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 416:	0f b6 1e             	movzbl (%esi),%ebx
+ 419:	84 db                	test   %bl,%bl
+ 41b:	0f 84 9e 01 00 00    	je     5bf <printf+0x1b5>
+ 421:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 424:	8d 45 10             	lea    0x10(%ebp),%eax
+ 427:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 42a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 42f:	eb 2d                	jmp    45e <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 431:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 434:	83 ec 04             	sub    $0x4,%esp
+ 437:	6a 01                	push   $0x1
+ 439:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 43c:	50                   	push   %eax
+ 43d:	ff 75 08             	push   0x8(%ebp)
+ 440:	e8 3d fe ff ff       	call   282 <write>
+        putc(fd, c);
+ 445:	83 c4 10             	add    $0x10,%esp
+ 448:	eb 05                	jmp    44f <printf+0x45>
+      }
+    } else if(state == '%'){
+ 44a:	83 ff 25             	cmp    $0x25,%edi
+ 44d:	74 1f                	je     46e <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 44f:	83 c6 01             	add    $0x1,%esi
+ 452:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 456:	84 db                	test   %bl,%bl
+ 458:	0f 84 61 01 00 00    	je     5bf <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 45e:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 461:	85 ff                	test   %edi,%edi
+ 463:	75 e5                	jne    44a <printf+0x40>
+      if(c == '%'){
+ 465:	83 f8 25             	cmp    $0x25,%eax
+ 468:	75 c7                	jne    431 <printf+0x27>
+        state = '%';
+ 46a:	89 c7                	mov    %eax,%edi
+ 46c:	eb e1                	jmp    44f <printf+0x45>
+      if(c == 'd'){
+ 46e:	83 f8 25             	cmp    $0x25,%eax
+ 471:	0f 84 f4 00 00 00    	je     56b <printf+0x161>
+ 477:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 47a:	83 fa 15             	cmp    $0x15,%edx
+ 47d:	0f 87 09 01 00 00    	ja     58c <printf+0x182>
+ 483:	0f 87 03 01 00 00    	ja     58c <printf+0x182>
+ 489:	ff 24 95 50 07 00 00 	jmp    *0x750(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 490:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 493:	8b 17                	mov    (%edi),%edx
+ 495:	83 ec 0c             	sub    $0xc,%esp
+ 498:	6a 01                	push   $0x1
+ 49a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 49f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a2:	e8 cb fe ff ff       	call   372 <printint>
+        ap++;
+ 4a7:	83 c7 04             	add    $0x4,%edi
+ 4aa:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4ad:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 4b0:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4b5:	eb 98                	jmp    44f <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 4b7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4ba:	8b 17                	mov    (%edi),%edx
+ 4bc:	83 ec 0c             	sub    $0xc,%esp
+ 4bf:	6a 00                	push   $0x0
+ 4c1:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 4c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c9:	e8 a4 fe ff ff       	call   372 <printint>
+        ap++;
+ 4ce:	83 c7 04             	add    $0x4,%edi
+ 4d1:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4d4:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4d7:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4dc:	e9 6e ff ff ff       	jmp    44f <printf+0x45>
+        s = (char*)*ap;
+ 4e1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 4e4:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 4e6:	83 c1 04             	add    $0x4,%ecx
+ 4e9:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 4ec:	85 c0                	test   %eax,%eax
+ 4ee:	74 13                	je     503 <printf+0xf9>
+        s = (char*)*ap;
+ 4f0:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 4f2:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 4f5:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 4fa:	84 c0                	test   %al,%al
+ 4fc:	75 0f                	jne    50d <printf+0x103>
+ 4fe:	e9 4c ff ff ff       	jmp    44f <printf+0x45>
+          s = "(null)";
+ 503:	bb 46 07 00 00       	mov    $0x746,%ebx
+        while(*s != 0){
+ 508:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 50d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 510:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 513:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 516:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 519:	83 ec 04             	sub    $0x4,%esp
+ 51c:	6a 01                	push   $0x1
+ 51e:	57                   	push   %edi
+ 51f:	56                   	push   %esi
+ 520:	e8 5d fd ff ff       	call   282 <write>
+          s++;
+ 525:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 528:	0f b6 03             	movzbl (%ebx),%eax
+ 52b:	83 c4 10             	add    $0x10,%esp
+ 52e:	84 c0                	test   %al,%al
+ 530:	75 e4                	jne    516 <printf+0x10c>
+      state = 0;
+ 532:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 535:	bf 00 00 00 00       	mov    $0x0,%edi
+ 53a:	e9 10 ff ff ff       	jmp    44f <printf+0x45>
+        putc(fd, *ap);
+ 53f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 542:	8b 07                	mov    (%edi),%eax
+ 544:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 547:	83 ec 04             	sub    $0x4,%esp
+ 54a:	6a 01                	push   $0x1
+ 54c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 54f:	50                   	push   %eax
+ 550:	ff 75 08             	push   0x8(%ebp)
+ 553:	e8 2a fd ff ff       	call   282 <write>
+        ap++;
+ 558:	83 c7 04             	add    $0x4,%edi
+ 55b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 55e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 561:	bf 00 00 00 00       	mov    $0x0,%edi
+ 566:	e9 e4 fe ff ff       	jmp    44f <printf+0x45>
+        putc(fd, c);
+ 56b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 56e:	83 ec 04             	sub    $0x4,%esp
+ 571:	6a 01                	push   $0x1
+ 573:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 576:	50                   	push   %eax
+ 577:	ff 75 08             	push   0x8(%ebp)
+ 57a:	e8 03 fd ff ff       	call   282 <write>
+ 57f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 582:	bf 00 00 00 00       	mov    $0x0,%edi
+ 587:	e9 c3 fe ff ff       	jmp    44f <printf+0x45>
+        putc(fd, '%');
+ 58c:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	6a 01                	push   $0x1
+ 595:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 598:	57                   	push   %edi
+ 599:	ff 75 08             	push   0x8(%ebp)
+ 59c:	e8 e1 fc ff ff       	call   282 <write>
+        putc(fd, c);
+ 5a1:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5a4:	83 c4 0c             	add    $0xc,%esp
+ 5a7:	6a 01                	push   $0x1
+ 5a9:	57                   	push   %edi
+ 5aa:	ff 75 08             	push   0x8(%ebp)
+ 5ad:	e8 d0 fc ff ff       	call   282 <write>
+        putc(fd, c);
+ 5b2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5b5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5ba:	e9 90 fe ff ff       	jmp    44f <printf+0x45>
+    }
+  }
+}
+ 5bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5c2:	5b                   	pop    %ebx
+ 5c3:	5e                   	pop    %esi
+ 5c4:	5f                   	pop    %edi
+ 5c5:	5d                   	pop    %ebp
+ 5c6:	c3                   	ret
+
+000005c7 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 5c7:	55                   	push   %ebp
+ 5c8:	89 e5                	mov    %esp,%ebp
+ 5ca:	57                   	push   %edi
+ 5cb:	56                   	push   %esi
+ 5cc:	53                   	push   %ebx
+ 5cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 5d0:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5d3:	a1 40 0a 00 00       	mov    0xa40,%eax
+ 5d8:	eb 0c                	jmp    5e6 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5da:	8b 10                	mov    (%eax),%edx
+ 5dc:	39 d0                	cmp    %edx,%eax
+ 5de:	72 04                	jb     5e4 <free+0x1d>
+ 5e0:	39 d1                	cmp    %edx,%ecx
+ 5e2:	72 10                	jb     5f4 <free+0x2d>
+{
+ 5e4:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 5e6:	39 c8                	cmp    %ecx,%eax
+ 5e8:	73 f0                	jae    5da <free+0x13>
+ 5ea:	8b 10                	mov    (%eax),%edx
+ 5ec:	39 d1                	cmp    %edx,%ecx
+ 5ee:	72 04                	jb     5f4 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5f0:	39 d0                	cmp    %edx,%eax
+ 5f2:	72 f0                	jb     5e4 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 5f4:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 5f7:	8b 10                	mov    (%eax),%edx
+ 5f9:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 5fc:	39 fa                	cmp    %edi,%edx
+ 5fe:	74 19                	je     619 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 600:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 603:	8b 50 04             	mov    0x4(%eax),%edx
+ 606:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 609:	39 f1                	cmp    %esi,%ecx
+ 60b:	74 18                	je     625 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 60d:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 60f:	a3 40 0a 00 00       	mov    %eax,0xa40
+}
+ 614:	5b                   	pop    %ebx
+ 615:	5e                   	pop    %esi
+ 616:	5f                   	pop    %edi
+ 617:	5d                   	pop    %ebp
+ 618:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 619:	03 72 04             	add    0x4(%edx),%esi
+ 61c:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 61f:	8b 10                	mov    (%eax),%edx
+ 621:	8b 12                	mov    (%edx),%edx
+ 623:	eb db                	jmp    600 <free+0x39>
+    p->s.size += bp->s.size;
+ 625:	03 53 fc             	add    -0x4(%ebx),%edx
+ 628:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 62b:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 62e:	eb dd                	jmp    60d <free+0x46>
+
+00000630 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 639:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63c:	8d 58 07             	lea    0x7(%eax),%ebx
+ 63f:	c1 eb 03             	shr    $0x3,%ebx
+ 642:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 645:	8b 15 40 0a 00 00    	mov    0xa40,%edx
+ 64b:	85 d2                	test   %edx,%edx
+ 64d:	74 1c                	je     66b <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 64f:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 651:	8b 48 04             	mov    0x4(%eax),%ecx
+ 654:	39 d9                	cmp    %ebx,%ecx
+ 656:	73 38                	jae    690 <malloc+0x60>
+  if(nu < 4096)
+ 658:	be 00 10 00 00       	mov    $0x1000,%esi
+ 65d:	39 f3                	cmp    %esi,%ebx
+ 65f:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 662:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 669:	eb 72                	jmp    6dd <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 66b:	c7 05 40 0a 00 00 44 	movl   $0xa44,0xa40
+ 672:	0a 00 00 
+ 675:	c7 05 44 0a 00 00 44 	movl   $0xa44,0xa44
+ 67c:	0a 00 00 
+    base.s.size = 0;
+ 67f:	c7 05 48 0a 00 00 00 	movl   $0x0,0xa48
+ 686:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 689:	b8 44 0a 00 00       	mov    $0xa44,%eax
+    if(p->s.size >= nunits){
+ 68e:	eb c8                	jmp    658 <malloc+0x28>
+      if(p->s.size == nunits)
+ 690:	39 cb                	cmp    %ecx,%ebx
+ 692:	74 1e                	je     6b2 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 694:	29 d9                	sub    %ebx,%ecx
+ 696:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 699:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 69c:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 69f:	89 15 40 0a 00 00    	mov    %edx,0xa40
+      return (void*)(p + 1);
+ 6a5:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 6a8:	89 d0                	mov    %edx,%eax
+ 6aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ad:	5b                   	pop    %ebx
+ 6ae:	5e                   	pop    %esi
+ 6af:	5f                   	pop    %edi
+ 6b0:	5d                   	pop    %ebp
+ 6b1:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 6b2:	8b 08                	mov    (%eax),%ecx
+ 6b4:	89 0a                	mov    %ecx,(%edx)
+ 6b6:	eb e7                	jmp    69f <malloc+0x6f>
+  hp->s.size = nu;
+ 6b8:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 6bb:	83 ec 0c             	sub    $0xc,%esp
+ 6be:	83 c0 08             	add    $0x8,%eax
+ 6c1:	50                   	push   %eax
+ 6c2:	e8 00 ff ff ff       	call   5c7 <free>
+  return freep;
+ 6c7:	8b 15 40 0a 00 00    	mov    0xa40,%edx
+      if((p = morecore(nunits)) == 0)
+ 6cd:	83 c4 10             	add    $0x10,%esp
+ 6d0:	85 d2                	test   %edx,%edx
+ 6d2:	74 d4                	je     6a8 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6d4:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6d6:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6d9:	39 d9                	cmp    %ebx,%ecx
+ 6db:	73 b3                	jae    690 <malloc+0x60>
+    if(p == freep)
+ 6dd:	89 c2                	mov    %eax,%edx
+ 6df:	39 05 40 0a 00 00    	cmp    %eax,0xa40
+ 6e5:	75 ed                	jne    6d4 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 6e7:	83 ec 0c             	sub    $0xc,%esp
+ 6ea:	57                   	push   %edi
+ 6eb:	e8 fa fb ff ff       	call   2ea <sbrk>
+  if(p == (char*)-1)
+ 6f0:	83 c4 10             	add    $0x10,%esp
+ 6f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 6f6:	75 c0                	jne    6b8 <malloc+0x88>
+        return 0;
+ 6f8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6fd:	eb a9                	jmp    6a8 <malloc+0x78>
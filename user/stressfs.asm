@@ -0,0 +1,1189 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/fcntl.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  17:	c7 45 de 73 74 72 65 	movl   $0x65727473,-0x22(%ebp)
+  1e:	c7 45 e2 73 73 66 73 	movl   $0x73667373,-0x1e(%ebp)
+  25:	66 c7 45 e6 30 00    	movw   $0x30,-0x1a(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  2b:	68 80 07 00 00       	push   $0x780
+  30:	6a 01                	push   $0x1
+  32:	e8 51 04 00 00       	call   488 <printf>
+  memset(data, 'a', sizeof(data));
+  37:	83 c4 0c             	add    $0xc,%esp
+  3a:	68 00 02 00 00       	push   $0x200
+  3f:	6a 61                	push   $0x61
+  41:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  47:	50                   	push   %eax
+  48:	e8 40 01 00 00       	call   18d <memset>
+  4d:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  50:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(fork() > 0)
+  55:	e8 7e 02 00 00       	call   2d8 <fork>
+  5a:	85 c0                	test   %eax,%eax
+  5c:	7f 08                	jg     66 <main+0x66>
+  for(i = 0; i < 4; i++)
+  5e:	83 c3 01             	add    $0x1,%ebx
+  61:	83 fb 04             	cmp    $0x4,%ebx
+  64:	75 ef                	jne    55 <main+0x55>
+      break;
+
+  printf(1, "write %d\n", i);
+  66:	83 ec 04             	sub    $0x4,%esp
+  69:	53                   	push   %ebx
+  6a:	68 93 07 00 00       	push   $0x793
+  6f:	6a 01                	push   $0x1
+  71:	e8 12 04 00 00       	call   488 <printf>
+
+  path[8] += i;
+  76:	00 5d e6             	add    %bl,-0x1a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  79:	83 c4 08             	add    $0x8,%esp
+  7c:	68 02 02 00 00       	push   $0x202
+  81:	8d 45 de             	lea    -0x22(%ebp),%eax
+  84:	50                   	push   %eax
+  85:	e8 96 02 00 00       	call   320 <open>
+  8a:	89 c6                	mov    %eax,%esi
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	bb 14 00 00 00       	mov    $0x14,%ebx
+  for(i = 0; i < 20; i++)
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  94:	8d bd de fd ff ff    	lea    -0x222(%ebp),%edi
+  9a:	83 ec 04             	sub    $0x4,%esp
+  9d:	68 00 02 00 00       	push   $0x200
+  a2:	57                   	push   %edi
+  a3:	56                   	push   %esi
+  a4:	e8 57 02 00 00       	call   300 <write>
+  for(i = 0; i < 20; i++)
+  a9:	83 c4 10             	add    $0x10,%esp
+  ac:	83 eb 01             	sub    $0x1,%ebx
+  af:	75 e9                	jne    9a <main+0x9a>
+  close(fd);
+  b1:	83 ec 0c             	sub    $0xc,%esp
+  b4:	56                   	push   %esi
+  b5:	e8 4e 02 00 00       	call   308 <close>
+
+  printf(1, "read\n");
+  ba:	83 c4 08             	add    $0x8,%esp
+  bd:	68 9d 07 00 00       	push   $0x79d
+  c2:	6a 01                	push   $0x1
+  c4:	e8 bf 03 00 00       	call   488 <printf>
+
+  fd = open(path, O_RDONLY);
+  c9:	83 c4 08             	add    $0x8,%esp
+  cc:	6a 00                	push   $0x0
+  ce:	8d 45 de             	lea    -0x22(%ebp),%eax
+  d1:	50                   	push   %eax
+  d2:	e8 49 02 00 00       	call   320 <open>
+  d7:	89 c6                	mov    %eax,%esi
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	bb 14 00 00 00       	mov    $0x14,%ebx
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  e1:	8d bd de fd ff ff    	lea    -0x222(%ebp),%edi
+  e7:	83 ec 04             	sub    $0x4,%esp
+  ea:	68 00 02 00 00       	push   $0x200
+  ef:	57                   	push   %edi
+  f0:	56                   	push   %esi
+  f1:	e8 02 02 00 00       	call   2f8 <read>
+  for (i = 0; i < 20; i++)
+  f6:	83 c4 10             	add    $0x10,%esp
+  f9:	83 eb 01             	sub    $0x1,%ebx
+  fc:	75 e9                	jne    e7 <main+0xe7>
+  close(fd);
+  fe:	83 ec 0c             	sub    $0xc,%esp
+ 101:	56                   	push   %esi
+ 102:	e8 01 02 00 00       	call   308 <close>
+
+  wait(0);
+ 107:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 10e:	e8 d5 01 00 00       	call   2e8 <wait>
+
+  exit();
+ 113:	e8 c8 01 00 00       	call   2e0 <exit>
+
+00000118 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 118:	55                   	push   %ebp
+ 119:	89 e5                	mov    %esp,%ebp
+ 11b:	53                   	push   %ebx
+ 11c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 11f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 122:	b8 00 00 00 00       	mov    $0x0,%eax
+ 127:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 12b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 12e:	83 c0 01             	add    $0x1,%eax
+ 131:	84 d2                	test   %dl,%dl
+ 133:	75 f2                	jne    127 <strcpy+0xf>
+    ;
+  return os;
+}
+ 135:	89 c8                	mov    %ecx,%eax
+ 137:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 13a:	c9                   	leave
+ 13b:	c3                   	ret
+
+0000013c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 13c:	55                   	push   %ebp
+ 13d:	89 e5                	mov    %esp,%ebp
+ 13f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 142:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 145:	0f b6 01             	movzbl (%ecx),%eax
+ 148:	84 c0                	test   %al,%al
+ 14a:	74 11                	je     15d <strcmp+0x21>
+ 14c:	38 02                	cmp    %al,(%edx)
+ 14e:	75 0d                	jne    15d <strcmp+0x21>
+    p++, q++;
+ 150:	83 c1 01             	add    $0x1,%ecx
+ 153:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 156:	0f b6 01             	movzbl (%ecx),%eax
+ 159:	84 c0                	test   %al,%al
+ 15b:	75 ef                	jne    14c <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 15d:	0f b6 c0             	movzbl %al,%eax
+ 160:	0f b6 12             	movzbl (%edx),%edx
+ 163:	29 d0                	sub    %edx,%eax
+}
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+
+00000167 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 167:	55                   	push   %ebp
+ 168:	89 e5                	mov    %esp,%ebp
+ 16a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 16d:	80 3a 00             	cmpb   $0x0,(%edx)
+ 170:	74 14                	je     186 <strlen+0x1f>
+ 172:	b8 00 00 00 00       	mov    $0x0,%eax
+ 177:	83 c0 01             	add    $0x1,%eax
+ 17a:	89 c1                	mov    %eax,%ecx
+ 17c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 180:	75 f5                	jne    177 <strlen+0x10>
+    ;
+  return n;
+}
+ 182:	89 c8                	mov    %ecx,%eax
+ 184:	5d                   	pop    %ebp
+ 185:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 186:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 18b:	eb f5                	jmp    182 <strlen+0x1b>
+
+0000018d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 18d:	55                   	push   %ebp
+ 18e:	89 e5                	mov    %esp,%ebp
+ 190:	57                   	push   %edi
+ 191:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 194:	89 d7                	mov    %edx,%edi
+ 196:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 199:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 19c:	fc                   	cld
+ 19d:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 19f:	89 d0                	mov    %edx,%eax
+ 1a1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1a4:	c9                   	leave
+ 1a5:	c3                   	ret
+
+000001a6 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a6:	55                   	push   %ebp
+ 1a7:	89 e5                	mov    %esp,%ebp
+ 1a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1b0:	0f b6 10             	movzbl (%eax),%edx
+ 1b3:	84 d2                	test   %dl,%dl
+ 1b5:	74 15                	je     1cc <strchr+0x26>
+    if(*s == c)
+ 1b7:	38 d1                	cmp    %dl,%cl
+ 1b9:	74 0f                	je     1ca <strchr+0x24>
+  for(; *s; s++)
+ 1bb:	83 c0 01             	add    $0x1,%eax
+ 1be:	0f b6 10             	movzbl (%eax),%edx
+ 1c1:	84 d2                	test   %dl,%dl
+ 1c3:	75 f2                	jne    1b7 <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 1c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1ca:	5d                   	pop    %ebp
+ 1cb:	c3                   	ret
+  return 0;
+ 1cc:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1d1:	eb f7                	jmp    1ca <strchr+0x24>
+
+000001d3 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1d3:	55                   	push   %ebp
+ 1d4:	89 e5                	mov    %esp,%ebp
+ 1d6:	57                   	push   %edi
+ 1d7:	56                   	push   %esi
+ 1d8:	53                   	push   %ebx
+ 1d9:	83 ec 2c             	sub    $0x2c,%esp
+ 1dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1df:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 1e4:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 1e7:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 1ea:	83 c3 01             	add    $0x1,%ebx
+ 1ed:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1f0:	7d 27                	jge    219 <gets+0x46>
+    cc = read(0, &c, 1);
+ 1f2:	83 ec 04             	sub    $0x4,%esp
+ 1f5:	6a 01                	push   $0x1
+ 1f7:	57                   	push   %edi
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	e8 f9 00 00 00       	call   2f8 <read>
+    if(cc < 1)
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	85 c0                	test   %eax,%eax
+ 204:	7e 13                	jle    219 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 206:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 20a:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20e:	3c 0a                	cmp    $0xa,%al
+ 210:	74 04                	je     216 <gets+0x43>
+ 212:	3c 0d                	cmp    $0xd,%al
+ 214:	75 d1                	jne    1e7 <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 216:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 219:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 21c:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 220:	89 f0                	mov    %esi,%eax
+ 222:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 225:	5b                   	pop    %ebx
+ 226:	5e                   	pop    %esi
+ 227:	5f                   	pop    %edi
+ 228:	5d                   	pop    %ebp
+ 229:	c3                   	ret
+
+0000022a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	56                   	push   %esi
+ 22e:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 22f:	83 ec 08             	sub    $0x8,%esp
+ 232:	6a 00                	push   $0x0
+ 234:	ff 75 08             	push   0x8(%ebp)
+ 237:	e8 e4 00 00 00       	call   320 <open>
+  if(fd < 0)
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	85 c0                	test   %eax,%eax
+ 241:	78 24                	js     267 <stat+0x3d>
+ 243:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	ff 75 0c             	push   0xc(%ebp)
+ 24b:	50                   	push   %eax
+ 24c:	e8 e7 00 00 00       	call   338 <fstat>
+ 251:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 253:	89 1c 24             	mov    %ebx,(%esp)
+ 256:	e8 ad 00 00 00       	call   308 <close>
+  return r;
+ 25b:	83 c4 10             	add    $0x10,%esp
+}
+ 25e:	89 f0                	mov    %esi,%eax
+ 260:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 263:	5b                   	pop    %ebx
+ 264:	5e                   	pop    %esi
+ 265:	5d                   	pop    %ebp
+ 266:	c3                   	ret
+    return -1;
+ 267:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 26c:	eb f0                	jmp    25e <stat+0x34>
+
+0000026e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 26e:	55                   	push   %ebp
+ 26f:	89 e5                	mov    %esp,%ebp
+ 271:	53                   	push   %ebx
+ 272:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 275:	0f b6 02             	movzbl (%edx),%eax
+ 278:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 27b:	80 f9 09             	cmp    $0x9,%cl
+ 27e:	77 24                	ja     2a4 <atoi+0x36>
+  n = 0;
+ 280:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 285:	83 c2 01             	add    $0x1,%edx
+ 288:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 28b:	0f be c0             	movsbl %al,%eax
+ 28e:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 292:	0f b6 02             	movzbl (%edx),%eax
+ 295:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 298:	80 fb 09             	cmp    $0x9,%bl
+ 29b:	76 e8                	jbe    285 <atoi+0x17>
+  return n;
+}
+ 29d:	89 c8                	mov    %ecx,%eax
+ 29f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a2:	c9                   	leave
+ 2a3:	c3                   	ret
+  n = 0;
+ 2a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2a9:	eb f2                	jmp    29d <atoi+0x2f>
+
+000002ab <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2ab:	55                   	push   %ebp
+ 2ac:	89 e5                	mov    %esp,%ebp
+ 2ae:	56                   	push   %esi
+ 2af:	53                   	push   %ebx
+ 2b0:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2b9:	85 db                	test   %ebx,%ebx
+ 2bb:	7e 15                	jle    2d2 <memmove+0x27>
+ 2bd:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 2bf:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 2c1:	83 c2 01             	add    $0x1,%edx
+ 2c4:	83 c0 01             	add    $0x1,%eax
+ 2c7:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 2cb:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 2ce:	39 c3                	cmp    %eax,%ebx
+ 2d0:	75 ef                	jne    2c1 <memmove+0x16>
+  return vdst;
+}
+ 2d2:	89 f0                	mov    %esi,%eax
+ 2d4:	5b                   	pop    %ebx
+ 2d5:	5e                   	pop    %esi
+ 2d6:	5d                   	pop    %ebp
+ 2d7:	c3                   	ret
+
+000002d8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2d8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2dd:	cd 40                	int    $0x40
+ 2df:	c3                   	ret
+
+000002e0 <exit>:
+SYSCALL(exit)
+ 2e0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e5:	cd 40                	int    $0x40
+ 2e7:	c3                   	ret
+
+000002e8 <wait>:
+SYSCALL(wait)
+ 2e8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2ed:	cd 40                	int    $0x40
+ 2ef:	c3                   	ret
+
+000002f0 <pipe>:
+SYSCALL(pipe)
+ 2f0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2f5:	cd 40                	int    $0x40
+ 2f7:	c3                   	ret
+
+000002f8 <read>:
+SYSCALL(read)
+ 2f8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2fd:	cd 40                	int    $0x40
+ 2ff:	c3                   	ret
+
+00000300 <write>:
+SYSCALL(write)
+ 300:	b8 10 00 00 00       	mov    $0x10,%eax
+ 305:	cd 40                	int    $0x40
+ 307:	c3                   	ret
+
+00000308 <close>:
+SYSCALL(close)
+ 308:	b8 15 00 00 00       	mov    $0x15,%eax
+ 30d:	cd 40                	int    $0x40
+ 30f:	c3                   	ret
+
+00000310 <kill>:
+SYSCALL(kill)
+ 310:	b8 06 00 00 00       	mov    $0x6,%eax
+ 315:	cd 40                	int    $0x40
+ 317:	c3                   	ret
+
+00000318 <exec>:
+SYSCALL(exec)
+ 318:	b8 07 00 00 00       	mov    $0x7,%eax
+ 31d:	cd 40                	int    $0x40
+ 31f:	c3                   	ret
+
+00000320 <open>:
+SYSCALL(open)
+ 320:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 325:	cd 40                	int    $0x40
+ 327:	c3                   	ret
+
+00000328 <mknod>:
+SYSCALL(mknod)
+ 328:	b8 11 00 00 00       	mov    $0x11,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <unlink>:
+SYSCALL(unlink)
+ 330:	b8 12 00 00 00       	mov    $0x12,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <fstat>:
+SYSCALL(fstat)
+ 338:	b8 08 00 00 00       	mov    $0x8,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <link>:
+SYSCALL(link)
+ 340:	b8 13 00 00 00       	mov    $0x13,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <mkdir>:
+SYSCALL(mkdir)
+ 348:	b8 14 00 00 00       	mov    $0x14,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <chdir>:
+SYSCALL(chdir)
+ 350:	b8 09 00 00 00       	mov    $0x9,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <dup>:
+SYSCALL(dup)
+ 358:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <getpid>:
+SYSCALL(getpid)
+ 360:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <sbrk>:
+SYSCALL(sbrk)
+ 368:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <sleep>:
+SYSCALL(sleep)
+ 370:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <uptime>:
+SYSCALL(uptime)
+ 378:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <readmouse>:
+SYSCALL(readmouse)
+ 380:	b8 16 00 00 00       	mov    $0x16,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <sigsend>:
+SYSCALL(sigsend)
+ 388:	b8 17 00 00 00       	mov    $0x17,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 390:	b8 18 00 00 00       	mov    $0x18,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <sigreturn>:
+SYSCALL(sigreturn)
+ 398:	b8 19 00 00 00       	mov    $0x19,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <siggetmask>:
+SYSCALL(siggetmask)
+ 3a0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <sigsetmask>:
+SYSCALL(sigsetmask)
+ 3a8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <sigpause>:
+SYSCALL(sigpause)
+ 3b0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <predict_cpu>:
+SYSCALL(predict_cpu)
+ 3b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <sleeptick>:
+SYSCALL(sleeptick)
+ 3c0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <schedctl>:
+SYSCALL(schedctl)
+ 3c8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <nswtch>:
+SYSCALL(nswtch)
+ 3d0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <getloadavg>:
+SYSCALL(getloadavg)
+ 3d8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <memstat>:
+SYSCALL(memstat)
+ 3e0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <iostat>:
+SYSCALL(iostat)
+ 3e8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	83 ec 3c             	sub    $0x3c,%esp
+ 3f9:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 3fc:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 3fe:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 402:	74 79                	je     47d <printint+0x8d>
+ 404:	85 d2                	test   %edx,%edx
+ 406:	79 75                	jns    47d <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 408:	89 d1                	mov    %edx,%ecx
+ 40a:	f7 d9                	neg    %ecx
+    neg = 1;
+ 40c:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 413:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 418:	89 df                	mov    %ebx,%edi
+ 41a:	83 c3 01             	add    $0x1,%ebx
+ 41d:	89 c8                	mov    %ecx,%eax
+ 41f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 424:	f7 f6                	div    %esi
+ 426:	0f b6 92 04 08 00 00 	movzbl 0x804(%edx),%edx
+ 42d:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 431:	89 ca                	mov    %ecx,%edx
+ 433:	89 c1                	mov    %eax,%ecx
+ 435:	39 f2                	cmp    %esi,%edx
+ 437:	73 df                	jae    418 <printint+0x28>
+  if(neg)
+ 439:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 43d:	74 08                	je     447 <printint+0x57>
+    buf[i++] = '-';
+ 43f:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 444:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 447:	85 db                	test   %ebx,%ebx
+ 449:	7e 2a                	jle    475 <printint+0x85>
+ 44b:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 44e:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 452:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 455:	0f b6 03             	movzbl (%ebx),%eax
+ 458:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 45b:	83 ec 04             	sub    $0x4,%esp
+ 45e:	6a 01                	push   $0x1
+ 460:	57                   	push   %edi
+ 461:	ff 75 c4             	push   -0x3c(%ebp)
+ 464:	e8 97 fe ff ff       	call   300 <write>
+  while(--i >= 0)
+ 469:	89 d8                	mov    %ebx,%eax
+ 46b:	83 eb 01             	sub    $0x1,%ebx
+ 46e:	83 c4 10             	add    $0x10,%esp
+ 471:	39 f0                	cmp    %esi,%eax
+ 473:	75 e0                	jne    455 <printint+0x65>
+}
+ 475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 478:	5b                   	pop    %ebx
+ 479:	5e                   	pop    %esi
+ 47a:	5f                   	pop    %edi
+ 47b:	5d                   	pop    %ebp
+ 47c:	c3                   	ret
+    x = xx;
+ 47d:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 47f:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 486:	eb 8b                	jmp    413 <printint+0x23>
+
+00000488 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 488:	55                   	push   %ebp
+ 489:	89 e5                	mov    %esp,%ebp
+ 48b:	57                   	push   %edi
+ 48c:	56                   	push   %esi
+ 48d:	53                   	push   %ebx
+ 48e:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 491:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 494:	0f b6 1e             	movzbl (%esi),%ebx
+ 497:	84 db                	test   %bl,%bl
+ 499:	0f 84 9e 01 00 00    	je     63d <printf+0x1b5>
+ 49f:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4a2:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4a8:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4ad:	eb 2d                	jmp    4dc <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4af:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4b2:	83 ec 04             	sub    $0x4,%esp
+ 4b5:	6a 01                	push   $0x1
+ 4b7:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4ba:	50                   	push   %eax
+ 4bb:	ff 75 08             	push   0x8(%ebp)
+ 4be:	e8 3d fe ff ff       	call   300 <write>
+        putc(fd, c);
+ 4c3:	83 c4 10             	add    $0x10,%esp
+ 4c6:	eb 05                	jmp    4cd <printf+0x45>
+      }
+    } else if(state == '%'){
+ 4c8:	83 ff 25             	cmp    $0x25,%edi
+ 4cb:	74 1f                	je     4ec <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 4cd:	83 c6 01             	add    $0x1,%esi
+ 4d0:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 4d4:	84 db                	test   %bl,%bl
+ 4d6:	0f 84 61 01 00 00    	je     63d <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 4dc:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4df:	85 ff                	test   %edi,%edi
+ 4e1:	75 e5                	jne    4c8 <printf+0x40>
+      if(c == '%'){
+ 4e3:	83 f8 25             	cmp    $0x25,%eax
+ 4e6:	75 c7                	jne    4af <printf+0x27>
+        state = '%';
+ 4e8:	89 c7                	mov    %eax,%edi
+ 4ea:	eb e1                	jmp    4cd <printf+0x45>
+      if(c == 'd'){
+ 4ec:	83 f8 25             	cmp    $0x25,%eax
+ 4ef:	0f 84 f4 00 00 00    	je     5e9 <printf+0x161>
+ 4f5:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 4f8:	83 fa 15             	cmp    $0x15,%edx
+ 4fb:	0f 87 09 01 00 00    	ja     60a <printf+0x182>
+ 501:	0f 87 03 01 00 00    	ja     60a <printf+0x182>
+ 507:	ff 24 95 ac 07 00 00 	jmp    *0x7ac(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 50e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 511:	8b 17                	mov    (%edi),%edx
+ 513:	83 ec 0c             	sub    $0xc,%esp
+ 516:	6a 01                	push   $0x1
+ 518:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 51d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 520:	e8 cb fe ff ff       	call   3f0 <printint>
+        ap++;
+ 525:	83 c7 04             	add    $0x4,%edi
+ 528:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 52b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 52e:	bf 00 00 00 00       	mov    $0x0,%edi
+ 533:	eb 98                	jmp    4cd <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 535:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 538:	8b 17                	mov    (%edi),%edx
+ 53a:	83 ec 0c             	sub    $0xc,%esp
+ 53d:	6a 00                	push   $0x0
+ 53f:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 544:	8b 45 08             	mov    0x8(%ebp),%eax
+ 547:	e8 a4 fe ff ff       	call   3f0 <printint>
+        ap++;
+ 54c:	83 c7 04             	add    $0x4,%edi
+ 54f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 552:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 555:	bf 00 00 00 00       	mov    $0x0,%edi
+ 55a:	e9 6e ff ff ff       	jmp    4cd <printf+0x45>
+        s = (char*)*ap;
+ 55f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 562:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 564:	83 c1 04             	add    $0x4,%ecx
+ 567:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 56a:	85 c0                	test   %eax,%eax
+ 56c:	74 13                	je     581 <printf+0xf9>
+        s = (char*)*ap;
+ 56e:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 570:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 573:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 578:	84 c0                	test   %al,%al
+ 57a:	75 0f                	jne    58b <printf+0x103>
+ 57c:	e9 4c ff ff ff       	jmp    4cd <printf+0x45>
+          s = "(null)";
+ 581:	bb a3 07 00 00       	mov    $0x7a3,%ebx
+        while(*s != 0){
+ 586:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 58b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 58e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 591:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 594:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 597:	83 ec 04             	sub    $0x4,%esp
+ 59a:	6a 01                	push   $0x1
+ 59c:	57                   	push   %edi
+ 59d:	56                   	push   %esi
+ 59e:	e8 5d fd ff ff       	call   300 <write>
+          s++;
+ 5a3:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5a6:	0f b6 03             	movzbl (%ebx),%eax
+ 5a9:	83 c4 10             	add    $0x10,%esp
+ 5ac:	84 c0                	test   %al,%al
+ 5ae:	75 e4                	jne    594 <printf+0x10c>
+      state = 0;
+ 5b0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5b3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5b8:	e9 10 ff ff ff       	jmp    4cd <printf+0x45>
+        putc(fd, *ap);
+ 5bd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5c0:	8b 07                	mov    (%edi),%eax
+ 5c2:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5c5:	83 ec 04             	sub    $0x4,%esp
+ 5c8:	6a 01                	push   $0x1
+ 5ca:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5cd:	50                   	push   %eax
+ 5ce:	ff 75 08             	push   0x8(%ebp)
+ 5d1:	e8 2a fd ff ff       	call   300 <write>
+        ap++;
+ 5d6:	83 c7 04             	add    $0x4,%edi
+ 5d9:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5df:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e4:	e9 e4 fe ff ff       	jmp    4cd <printf+0x45>
+        putc(fd, c);
+ 5e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5ec:	83 ec 04             	sub    $0x4,%esp
+ 5ef:	6a 01                	push   $0x1
+ 5f1:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5f4:	50                   	push   %eax
+ 5f5:	ff 75 08             	push   0x8(%ebp)
+ 5f8:	e8 03 fd ff ff       	call   300 <write>
+ 5fd:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 600:	bf 00 00 00 00       	mov    $0x0,%edi
+ 605:	e9 c3 fe ff ff       	jmp    4cd <printf+0x45>
+        putc(fd, '%');
+ 60a:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 60e:	83 ec 04             	sub    $0x4,%esp
+ 611:	6a 01                	push   $0x1
+ 613:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 616:	57                   	push   %edi
+ 617:	ff 75 08             	push   0x8(%ebp)
+ 61a:	e8 e1 fc ff ff       	call   300 <write>
+        putc(fd, c);
+ 61f:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 622:	83 c4 0c             	add    $0xc,%esp
+ 625:	6a 01                	push   $0x1
+ 627:	57                   	push   %edi
+ 628:	ff 75 08             	push   0x8(%ebp)
+ 62b:	e8 d0 fc ff ff       	call   300 <write>
+        putc(fd, c);
+ 630:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 633:	bf 00 00 00 00       	mov    $0x0,%edi
+ 638:	e9 90 fe ff ff       	jmp    4cd <printf+0x45>
+    }
+  }
+}
+ 63d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 640:	5b                   	pop    %ebx
+ 641:	5e                   	pop    %esi
+ 642:	5f                   	pop    %edi
+ 643:	5d                   	pop    %ebp
+ 644:	c3                   	ret
+
+00000645 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 645:	55                   	push   %ebp
+ 646:	89 e5                	mov    %esp,%ebp
+ 648:	57                   	push   %edi
+ 649:	56                   	push   %esi
+ 64a:	53                   	push   %ebx
+ 64b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 64e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 651:	a1 78 0a 00 00       	mov    0xa78,%eax
+ 656:	eb 0c                	jmp    664 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 658:	8b 10                	mov    (%eax),%edx
+ 65a:	39 d0                	cmp    %edx,%eax
+ 65c:	72 04                	jb     662 <free+0x1d>
+ 65e:	39 d1                	cmp    %edx,%ecx
+ 660:	72 10                	jb     672 <free+0x2d>
+{
+ 662:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 664:	39 c8                	cmp    %ecx,%eax
+ 666:	73 f0                	jae    658 <free+0x13>
+ 668:	8b 10                	mov    (%eax),%edx
+ 66a:	39 d1                	cmp    %edx,%ecx
+ 66c:	72 04                	jb     672 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 66e:	39 d0                	cmp    %edx,%eax
+ 670:	72 f0                	jb     662 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 672:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 675:	8b 10                	mov    (%eax),%edx
+ 677:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 67a:	39 fa                	cmp    %edi,%edx
+ 67c:	74 19                	je     697 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 67e:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 681:	8b 50 04             	mov    0x4(%eax),%edx
+ 684:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 687:	39 f1                	cmp    %esi,%ecx
+ 689:	74 18                	je     6a3 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 68b:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 68d:	a3 78 0a 00 00       	mov    %eax,0xa78
+}
+ 692:	5b                   	pop    %ebx
+ 693:	5e                   	pop    %esi
+ 694:	5f                   	pop    %edi
+ 695:	5d                   	pop    %ebp
+ 696:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 697:	03 72 04             	add    0x4(%edx),%esi
+ 69a:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 69d:	8b 10                	mov    (%eax),%edx
+ 69f:	8b 12                	mov    (%edx),%edx
+ 6a1:	eb db                	jmp    67e <free+0x39>
+    p->s.size += bp->s.size;
+ 6a3:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6a6:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6a9:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6ac:	eb dd                	jmp    68b <free+0x46>
+
+000006ae <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6ae:	55                   	push   %ebp
+ 6af:	89 e5                	mov    %esp,%ebp
+ 6b1:	57                   	push   %edi
+ 6b2:	56                   	push   %esi
+ 6b3:	53                   	push   %ebx
+ 6b4:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ba:	8d 58 07             	lea    0x7(%eax),%ebx
+ 6bd:	c1 eb 03             	shr    $0x3,%ebx
+ 6c0:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 6c3:	8b 15 78 0a 00 00    	mov    0xa78,%edx
+ 6c9:	85 d2                	test   %edx,%edx
+ 6cb:	74 1c                	je     6e9 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 6cd:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 6cf:	8b 48 04             	mov    0x4(%eax),%ecx
+ 6d2:	39 d9                	cmp    %ebx,%ecx
+ 6d4:	73 38                	jae    70e <malloc+0x60>
+  if(nu < 4096)
+ 6d6:	be 00 10 00 00       	mov    $0x1000,%esi
+ 6db:	39 f3                	cmp    %esi,%ebx
+ 6dd:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 6e0:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 6e7:	eb 72                	jmp    75b <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 6e9:	c7 05 78 0a 00 00 7c 	movl   $0xa7c,0xa78
+ 6f0:	0a 00 00 
+ 6f3:	c7 05 7c 0a 00 00 7c 	movl   $0xa7c,0xa7c
+ 6fa:	0a 00 00 
+    base.s.size = 0;
+ 6fd:	c7 05 80 0a 00 00 00 	movl   $0x0,0xa80
+ 704:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 707:	b8 7c 0a 00 00       	mov    $0xa7c,%eax
+    if(p->s.size >= nunits){
+ 70c:	eb c8                	jmp    6d6 <malloc+0x28>
+      if(p->s.size == nunits)
+ 70e:	39 cb                	cmp    %ecx,%ebx
+ 710:	74 1e                	je     730 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 712:	29 d9                	sub    %ebx,%ecx
+ 714:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 717:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 71a:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 71d:	89 15 78 0a 00 00    	mov    %edx,0xa78
+      return (void*)(p + 1);
+ 723:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 726:	89 d0                	mov    %edx,%eax
+ 728:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 72b:	5b                   	pop    %ebx
+ 72c:	5e                   	pop    %esi
+ 72d:	5f                   	pop    %edi
+ 72e:	5d                   	pop    %ebp
+ 72f:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 730:	8b 08                	mov    (%eax),%ecx
+ 732:	89 0a                	mov    %ecx,(%edx)
+ 734:	eb e7                	jmp    71d <malloc+0x6f>
+  hp->s.size = nu;
+ 736:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 739:	83 ec 0c             	sub    $0xc,%esp
+ 73c:	83 c0 08             	add    $0x8,%eax
+ 73f:	50                   	push   %eax
+ 740:	e8 00 ff ff ff       	call   645 <free>
+  return freep;
+ 745:	8b 15 78 0a 00 00    	mov    0xa78,%edx
+      if((p = morecore(nunits)) == 0)
+ 74b:	83 c4 10             	add    $0x10,%esp
+ 74e:	85 d2                	test   %edx,%edx
+ 750:	74 d4                	je     726 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 752:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 754:	8b 48 04             	mov    0x4(%eax),%ecx
+ 757:	39 d9                	cmp    %ebx,%ecx
+ 759:	73 b3                	jae    70e <malloc+0x60>
+    if(p == freep)
+ 75b:	89 c2                	mov    %eax,%edx
+ 75d:	39 05 78 0a 00 00    	cmp    %eax,0xa78
+ 763:	75 ed                	jne    752 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 765:	83 ec 0c             	sub    $0xc,%esp
+ 768:	57                   	push   %edi
+ 769:	e8 fa fb ff ff       	call   368 <sbrk>
+  if(p == (char*)-1)
+ 76e:	83 c4 10             	add    $0x10,%esp
+ 771:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 774:	75 c0                	jne    736 <malloc+0x88>
+        return 0;
+ 776:	ba 00 00 00 00       	mov    $0x0,%edx
+ 77b:	eb a9                	jmp    726 <malloc+0x78>
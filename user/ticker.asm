@@ -0,0 +1,1302 @@
+
+_ticker:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <flipcoin>:
+};
+
+// it takes ~10 printf() for 1 tick
+
+int flipcoin(){
+    changer=(seed1*100/((int)&changer)*rando*100*seed2/changer);
+   0:	c7 05 3c 0b 00 00 00 	movl   $0x0,0xb3c
+   7:	00 00 00 
+    return changer;
+}
+   a:	b8 00 00 00 00       	mov    $0x0,%eax
+   f:	c3                   	ret
+
+00000010 <main>:
+
+int main(){
+  10:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  14:	83 e4 f0             	and    $0xfffffff0,%esp
+  17:	ff 71 fc             	push   -0x4(%ecx)
+  1a:	55                   	push   %ebp
+  1b:	89 e5                	mov    %esp,%ebp
+  1d:	57                   	push   %edi
+  1e:	56                   	push   %esi
+  1f:	53                   	push   %ebx
+  20:	51                   	push   %ecx
+  21:	83 ec 34             	sub    $0x34,%esp
+    predict_cpu(-1);
+  24:	6a ff                	push   $0xffffffff
+  26:	e8 40 04 00 00       	call   46b <predict_cpu>
+
+    int n=0; // number of total workers
+    int r=0; // number of running workers
+    int t10=0; // number of reaped workers over 10 ticks
+    int stop=0;
+    struct ptimes times={-1,-1,-1,-1};
+  2b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  32:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+  39:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+  40:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+    while(stop==0){
+  47:	83 c4 10             	add    $0x10,%esp
+    int r=0; // number of running workers
+  4a:	be 00 00 00 00       	mov    $0x0,%esi
+    int n=0; // number of total workers
+  4f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    while(stop==0){
+  56:	e9 d3 00 00 00       	jmp    12e <main+0x11e>
+        int coin=flipcoin()%100;
+        if(r<6 && (coin<(((6-r)*100)/6)%100)){
+            n++;
+  5b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  5e:	8d 78 01             	lea    0x1(%eax),%edi
+            r++;
+  61:	83 c6 01             	add    $0x1,%esi
+            if(fork()==0){
+  64:	e8 22 03 00 00       	call   38b <fork>
+  69:	85 c0                	test   %eax,%eax
+  6b:	74 08                	je     75 <main+0x65>
+            n++;
+  6d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  70:	e9 a6 00 00 00       	jmp    11b <main+0x10b>
+                // Child
+                int ticks=1;
+                while(1){
+                    int coin2=flipcoin()%100;
+                    if(coin2<((n-t10+1)*100/(t10+1+ticks))%100){
+  75:	89 c3                	mov    %eax,%ebx
+  77:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  7a:	83 c0 02             	add    $0x2,%eax
+  7d:	6b c0 64             	imul   $0x64,%eax,%eax
+  80:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+                int ticks=1;
+  83:	bf 01 00 00 00       	mov    $0x1,%edi
+                    int coin2=flipcoin()%100;
+  88:	e8 73 ff ff ff       	call   0 <flipcoin>
+  8d:	89 c1                	mov    %eax,%ecx
+                    if(coin2<((n-t10+1)*100/(t10+1+ticks))%100){
+  8f:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  92:	83 c7 01             	add    $0x1,%edi
+  95:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  98:	99                   	cltd
+  99:	f7 ff                	idiv   %edi
+  9b:	be 64 00 00 00       	mov    $0x64,%esi
+  a0:	99                   	cltd
+  a1:	f7 fe                	idiv   %esi
+  a3:	89 d6                	mov    %edx,%esi
+                    int coin2=flipcoin()%100;
+  a5:	89 c8                	mov    %ecx,%eax
+  a7:	b9 64 00 00 00       	mov    $0x64,%ecx
+  ac:	99                   	cltd
+  ad:	f7 f9                	idiv   %ecx
+                    if(coin2<((n-t10+1)*100/(t10+1+ticks))%100){
+  af:	39 d6                	cmp    %edx,%esi
+  b1:	7f d5                	jg     88 <main+0x78>
+                        ticks++;
+                        continue;
+                    }
+                    break;
+                }
+                predict_cpu(ticks);
+  b3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  b6:	83 ec 0c             	sub    $0xc,%esp
+  b9:	56                   	push   %esi
+  ba:	e8 ac 03 00 00       	call   46b <predict_cpu>
+                // execute time
+                for(int i=0; i<ticks; i++){
+  bf:	83 c4 10             	add    $0x10,%esp
+  c2:	85 f6                	test   %esi,%esi
+  c4:	7e 23                	jle    e9 <main+0xd9>
+                int ticks=1;
+  c6:	bf 0a 00 00 00       	mov    $0xa,%edi
+                    for(int x=0; x<10; x++){
+                        printf(1, ""); // print nothing to console
+  cb:	83 ec 08             	sub    $0x8,%esp
+  ce:	68 59 08 00 00       	push   $0x859
+  d3:	6a 01                	push   $0x1
+  d5:	e8 61 04 00 00       	call   53b <printf>
+                    for(int x=0; x<10; x++){
+  da:	83 c4 10             	add    $0x10,%esp
+  dd:	83 ef 01             	sub    $0x1,%edi
+  e0:	75 e9                	jne    cb <main+0xbb>
+                for(int i=0; i<ticks; i++){
+  e2:	83 c3 01             	add    $0x1,%ebx
+  e5:	39 de                	cmp    %ebx,%esi
+  e7:	75 dd                	jne    c6 <main+0xb6>
+                    }
+                }
+                exit();
+  e9:	e8 a5 02 00 00       	call   393 <exit>
+            }
+        }else{
+            // dont create a process
+            // see if it has a process and take 1 out
+            if(r>3){
+                wait(&times);
+  ee:	83 ec 0c             	sub    $0xc,%esp
+  f1:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  f4:	50                   	push   %eax
+  f5:	e8 a1 02 00 00       	call   39b <wait>
+                printf(1, "real:%d  cpu:%d  wait:%d  sleep:%d", times.pt_real, times.pt_cpu, times.pt_wait, times.pt_sleep);
+  fa:	83 c4 08             	add    $0x8,%esp
+  fd:	ff 75 e4             	push   -0x1c(%ebp)
+ 100:	ff 75 e0             	push   -0x20(%ebp)
+ 103:	ff 75 dc             	push   -0x24(%ebp)
+ 106:	ff 75 d8             	push   -0x28(%ebp)
+ 109:	68 30 08 00 00       	push   $0x830
+ 10e:	6a 01                	push   $0x1
+ 110:	e8 26 04 00 00       	call   53b <printf>
+                r--;
+ 115:	83 ee 01             	sub    $0x1,%esi
+ 118:	83 c4 20             	add    $0x20,%esp
+            }
+        }
+        if(n>1 && (t10*100/n)<=10){
+ 11b:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+ 11f:	7f 72                	jg     193 <main+0x183>
+            stop=1;
+            break;
+        }
+        sleep(1);
+ 121:	83 ec 0c             	sub    $0xc,%esp
+ 124:	6a 01                	push   $0x1
+ 126:	e8 f8 02 00 00       	call   423 <sleep>
+ 12b:	83 c4 10             	add    $0x10,%esp
+        int coin=flipcoin()%100;
+ 12e:	e8 cd fe ff ff       	call   0 <flipcoin>
+ 133:	89 c7                	mov    %eax,%edi
+        if(r<6 && (coin<(((6-r)*100)/6)%100)){
+ 135:	83 fe 05             	cmp    $0x5,%esi
+ 138:	7f b4                	jg     ee <main+0xde>
+ 13a:	b9 06 00 00 00       	mov    $0x6,%ecx
+ 13f:	29 f1                	sub    %esi,%ecx
+ 141:	6b c9 64             	imul   $0x64,%ecx,%ecx
+ 144:	bb ab aa aa 2a       	mov    $0x2aaaaaab,%ebx
+ 149:	89 c8                	mov    %ecx,%eax
+ 14b:	f7 eb                	imul   %ebx
+ 14d:	89 d3                	mov    %edx,%ebx
+ 14f:	c1 f9 1f             	sar    $0x1f,%ecx
+ 152:	29 cb                	sub    %ecx,%ebx
+ 154:	b9 1f 85 eb 51       	mov    $0x51eb851f,%ecx
+ 159:	89 d8                	mov    %ebx,%eax
+ 15b:	f7 e9                	imul   %ecx
+ 15d:	c1 fa 05             	sar    $0x5,%edx
+ 160:	89 d8                	mov    %ebx,%eax
+ 162:	c1 f8 1f             	sar    $0x1f,%eax
+ 165:	29 c2                	sub    %eax,%edx
+ 167:	6b d2 64             	imul   $0x64,%edx,%edx
+ 16a:	29 d3                	sub    %edx,%ebx
+        int coin=flipcoin()%100;
+ 16c:	89 f8                	mov    %edi,%eax
+ 16e:	f7 e9                	imul   %ecx
+ 170:	89 d1                	mov    %edx,%ecx
+ 172:	c1 f9 05             	sar    $0x5,%ecx
+ 175:	89 f8                	mov    %edi,%eax
+ 177:	c1 f8 1f             	sar    $0x1f,%eax
+ 17a:	29 c1                	sub    %eax,%ecx
+ 17c:	6b c9 64             	imul   $0x64,%ecx,%ecx
+ 17f:	29 cf                	sub    %ecx,%edi
+        if(r<6 && (coin<(((6-r)*100)/6)%100)){
+ 181:	39 fb                	cmp    %edi,%ebx
+ 183:	0f 8f d2 fe ff ff    	jg     5b <main+0x4b>
+            if(r>3){
+ 189:	83 fe 03             	cmp    $0x3,%esi
+ 18c:	7e 8d                	jle    11b <main+0x10b>
+ 18e:	e9 5b ff ff ff       	jmp    ee <main+0xde>
+    }
+
+    // finalize leftover worker process
+    while(r){
+        wait(&times);
+ 193:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    while(r){
+ 196:	85 f6                	test   %esi,%esi
+ 198:	74 2c                	je     1c6 <main+0x1b6>
+        wait(&times);
+ 19a:	83 ec 0c             	sub    $0xc,%esp
+ 19d:	53                   	push   %ebx
+ 19e:	e8 f8 01 00 00       	call   39b <wait>
+        printf(1, "real:%d  cpu:%d  wait:%d  sleep:%d", times.pt_real, times.pt_cpu, times.pt_wait, times.pt_sleep);
+ 1a3:	83 c4 08             	add    $0x8,%esp
+ 1a6:	ff 75 e4             	push   -0x1c(%ebp)
+ 1a9:	ff 75 e0             	push   -0x20(%ebp)
+ 1ac:	ff 75 dc             	push   -0x24(%ebp)
+ 1af:	ff 75 d8             	push   -0x28(%ebp)
+ 1b2:	68 30 08 00 00       	push   $0x830
+ 1b7:	6a 01                	push   $0x1
+ 1b9:	e8 7d 03 00 00       	call   53b <printf>
+    while(r){
+ 1be:	83 c4 20             	add    $0x20,%esp
+ 1c1:	83 ee 01             	sub    $0x1,%esi
+ 1c4:	75 d4                	jne    19a <main+0x18a>
+        r--;
+    }
+    exit();
+ 1c6:	e8 c8 01 00 00       	call   393 <exit>
+
+000001cb <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1cb:	55                   	push   %ebp
+ 1cc:	89 e5                	mov    %esp,%ebp
+ 1ce:	53                   	push   %ebx
+ 1cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d5:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1da:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1de:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e1:	83 c0 01             	add    $0x1,%eax
+ 1e4:	84 d2                	test   %dl,%dl
+ 1e6:	75 f2                	jne    1da <strcpy+0xf>
+    ;
+  return os;
+}
+ 1e8:	89 c8                	mov    %ecx,%eax
+ 1ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1ed:	c9                   	leave
+ 1ee:	c3                   	ret
+
+000001ef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1ef:	55                   	push   %ebp
+ 1f0:	89 e5                	mov    %esp,%ebp
+ 1f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 1f8:	0f b6 01             	movzbl (%ecx),%eax
+ 1fb:	84 c0                	test   %al,%al
+ 1fd:	74 11                	je     210 <strcmp+0x21>
+ 1ff:	38 02                	cmp    %al,(%edx)
+ 201:	75 0d                	jne    210 <strcmp+0x21>
+    p++, q++;
+ 203:	83 c1 01             	add    $0x1,%ecx
+ 206:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 209:	0f b6 01             	movzbl (%ecx),%eax
+ 20c:	84 c0                	test   %al,%al
+ 20e:	75 ef                	jne    1ff <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 c0             	movzbl %al,%eax
+ 213:	0f b6 12             	movzbl (%edx),%edx
+ 216:	29 d0                	sub    %edx,%eax
+}
+ 218:	5d                   	pop    %ebp
+ 219:	c3                   	ret
+
+0000021a <strlen>:
+
+uint
+strlen(char *s)
+{
+ 21a:	55                   	push   %ebp
+ 21b:	89 e5                	mov    %esp,%ebp
+ 21d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 220:	80 3a 00             	cmpb   $0x0,(%edx)
+ 223:	74 14                	je     239 <strlen+0x1f>
+ 225:	b8 00 00 00 00       	mov    $0x0,%eax
+ 22a:	83 c0 01             	add    $0x1,%eax
+ 22d:	89 c1                	mov    %eax,%ecx
+ 22f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 233:	75 f5                	jne    22a <strlen+0x10>
+    ;
+  return n;
+}
+ 235:	89 c8                	mov    %ecx,%eax
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 239:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 23e:	eb f5                	jmp    235 <strlen+0x1b>
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	89 d7                	mov    %edx,%edi
+ 249:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	89 d0                	mov    %edx,%eax
+ 254:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+
+00000259 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 259:	55                   	push   %ebp
+ 25a:	89 e5                	mov    %esp,%ebp
+ 25c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 263:	0f b6 10             	movzbl (%eax),%edx
+ 266:	84 d2                	test   %dl,%dl
+ 268:	74 15                	je     27f <strchr+0x26>
+    if(*s == c)
+ 26a:	38 d1                	cmp    %dl,%cl
+ 26c:	74 0f                	je     27d <strchr+0x24>
+  for(; *s; s++)
+ 26e:	83 c0 01             	add    $0x1,%eax
+ 271:	0f b6 10             	movzbl (%eax),%edx
+ 274:	84 d2                	test   %dl,%dl
+ 276:	75 f2                	jne    26a <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 278:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+  return 0;
+ 27f:	b8 00 00 00 00       	mov    $0x0,%eax
+ 284:	eb f7                	jmp    27d <strchr+0x24>
+
+00000286 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 286:	55                   	push   %ebp
+ 287:	89 e5                	mov    %esp,%ebp
+ 289:	57                   	push   %edi
+ 28a:	56                   	push   %esi
+ 28b:	53                   	push   %ebx
+ 28c:	83 ec 2c             	sub    $0x2c,%esp
+ 28f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 292:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 297:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 29a:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 29d:	83 c3 01             	add    $0x1,%ebx
+ 2a0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2a3:	7d 27                	jge    2cc <gets+0x46>
+    cc = read(0, &c, 1);
+ 2a5:	83 ec 04             	sub    $0x4,%esp
+ 2a8:	6a 01                	push   $0x1
+ 2aa:	57                   	push   %edi
+ 2ab:	6a 00                	push   $0x0
+ 2ad:	e8 f9 00 00 00       	call   3ab <read>
+    if(cc < 1)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	7e 13                	jle    2cc <gets+0x46>
+      break;
+    buf[i++] = c;
+ 2b9:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2bd:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2c1:	3c 0a                	cmp    $0xa,%al
+ 2c3:	74 04                	je     2c9 <gets+0x43>
+ 2c5:	3c 0d                	cmp    $0xd,%al
+ 2c7:	75 d1                	jne    29a <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 2c9:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 2cc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 2cf:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 2d3:	89 f0                	mov    %esi,%eax
+ 2d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d8:	5b                   	pop    %ebx
+ 2d9:	5e                   	pop    %esi
+ 2da:	5f                   	pop    %edi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+
+000002dd <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2dd:	55                   	push   %ebp
+ 2de:	89 e5                	mov    %esp,%ebp
+ 2e0:	56                   	push   %esi
+ 2e1:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2e2:	83 ec 08             	sub    $0x8,%esp
+ 2e5:	6a 00                	push   $0x0
+ 2e7:	ff 75 08             	push   0x8(%ebp)
+ 2ea:	e8 e4 00 00 00       	call   3d3 <open>
+  if(fd < 0)
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	85 c0                	test   %eax,%eax
+ 2f4:	78 24                	js     31a <stat+0x3d>
+ 2f6:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 2f8:	83 ec 08             	sub    $0x8,%esp
+ 2fb:	ff 75 0c             	push   0xc(%ebp)
+ 2fe:	50                   	push   %eax
+ 2ff:	e8 e7 00 00 00       	call   3eb <fstat>
+ 304:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 306:	89 1c 24             	mov    %ebx,(%esp)
+ 309:	e8 ad 00 00 00       	call   3bb <close>
+  return r;
+ 30e:	83 c4 10             	add    $0x10,%esp
+}
+ 311:	89 f0                	mov    %esi,%eax
+ 313:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 316:	5b                   	pop    %ebx
+ 317:	5e                   	pop    %esi
+ 318:	5d                   	pop    %ebp
+ 319:	c3                   	ret
+    return -1;
+ 31a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 31f:	eb f0                	jmp    311 <stat+0x34>
+
+00000321 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 321:	55                   	push   %ebp
+ 322:	89 e5                	mov    %esp,%ebp
+ 324:	53                   	push   %ebx
+ 325:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 328:	0f b6 02             	movzbl (%edx),%eax
+ 32b:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32e:	80 f9 09             	cmp    $0x9,%cl
+ 331:	77 24                	ja     357 <atoi+0x36>
+  n = 0;
+ 333:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 338:	83 c2 01             	add    $0x1,%edx
+ 33b:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 33e:	0f be c0             	movsbl %al,%eax
+ 341:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 345:	0f b6 02             	movzbl (%edx),%eax
+ 348:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 34b:	80 fb 09             	cmp    $0x9,%bl
+ 34e:	76 e8                	jbe    338 <atoi+0x17>
+  return n;
+}
+ 350:	89 c8                	mov    %ecx,%eax
+ 352:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 355:	c9                   	leave
+ 356:	c3                   	ret
+  n = 0;
+ 357:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 35c:	eb f2                	jmp    350 <atoi+0x2f>
+
+0000035e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 35e:	55                   	push   %ebp
+ 35f:	89 e5                	mov    %esp,%ebp
+ 361:	56                   	push   %esi
+ 362:	53                   	push   %ebx
+ 363:	8b 75 08             	mov    0x8(%ebp),%esi
+ 366:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 369:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 36c:	85 db                	test   %ebx,%ebx
+ 36e:	7e 15                	jle    385 <memmove+0x27>
+ 370:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 372:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 374:	83 c2 01             	add    $0x1,%edx
+ 377:	83 c0 01             	add    $0x1,%eax
+ 37a:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 37e:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 381:	39 c3                	cmp    %eax,%ebx
+ 383:	75 ef                	jne    374 <memmove+0x16>
+  return vdst;
+}
+ 385:	89 f0                	mov    %esi,%eax
+ 387:	5b                   	pop    %ebx
+ 388:	5e                   	pop    %esi
+ 389:	5d                   	pop    %ebp
+ 38a:	c3                   	ret
+
+0000038b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <exit>:
+SYSCALL(exit)
+ 393:	b8 02 00 00 00       	mov    $0x2,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <wait>:
+SYSCALL(wait)
+ 39b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <pipe>:
+SYSCALL(pipe)
+ 3a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <read>:
+SYSCALL(read)
+ 3ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <write>:
+SYSCALL(write)
+ 3b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <close>:
+SYSCALL(close)
+ 3bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <kill>:
+SYSCALL(kill)
+ 3c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <exec>:
+SYSCALL(exec)
+ 3cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <open>:
+SYSCALL(open)
+ 3d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <mknod>:
+SYSCALL(mknod)
+ 3db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <unlink>:
+SYSCALL(unlink)
+ 3e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <fstat>:
+SYSCALL(fstat)
+ 3eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <link>:
+SYSCALL(link)
+ 3f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <mkdir>:
+SYSCALL(mkdir)
+ 3fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <chdir>:
+SYSCALL(chdir)
+ 403:	b8 09 00 00 00       	mov    $0x9,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <dup>:
+SYSCALL(dup)
+ 40b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <getpid>:
+SYSCALL(getpid)
+ 413:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <sbrk>:
+SYSCALL(sbrk)
+ 41b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <sleep>:
+SYSCALL(sleep)
+ 423:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <uptime>:
+SYSCALL(uptime)
+ 42b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <readmouse>:
+SYSCALL(readmouse)
+ 433:	b8 16 00 00 00       	mov    $0x16,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <sigsend>:
+SYSCALL(sigsend)
+ 43b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 443:	b8 18 00 00 00       	mov    $0x18,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <sigreturn>:
+SYSCALL(sigreturn)
+ 44b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <siggetmask>:
+SYSCALL(siggetmask)
+ 453:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <sigsetmask>:
+SYSCALL(sigsetmask)
+ 45b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <sigpause>:
+SYSCALL(sigpause)
+ 463:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <predict_cpu>:
+SYSCALL(predict_cpu)
+ 46b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <sleeptick>:
+SYSCALL(sleeptick)
+ 473:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <schedctl>:
+SYSCALL(schedctl)
+ 47b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <nswtch>:
+SYSCALL(nswtch)
+ 483:	b8 20 00 00 00       	mov    $0x20,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <getloadavg>:
+SYSCALL(getloadavg)
+ 48b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <memstat>:
+SYSCALL(memstat)
+ 493:	b8 22 00 00 00       	mov    $0x22,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <iostat>:
+SYSCALL(iostat)
+ 49b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4a3:	55                   	push   %ebp
+ 4a4:	89 e5                	mov    %esp,%ebp
+ 4a6:	57                   	push   %edi
+ 4a7:	56                   	push   %esi
+ 4a8:	53                   	push   %ebx
+ 4a9:	83 ec 3c             	sub    $0x3c,%esp
+ 4ac:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4af:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 4b1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 4b5:	74 79                	je     530 <printint+0x8d>
+ 4b7:	85 d2                	test   %edx,%edx
+ 4b9:	79 75                	jns    530 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 4bb:	89 d1                	mov    %edx,%ecx
+ 4bd:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4bf:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 4cb:	89 df                	mov    %ebx,%edi
+ 4cd:	83 c3 01             	add    $0x1,%ebx
+ 4d0:	89 c8                	mov    %ecx,%eax
+ 4d2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4d7:	f7 f6                	div    %esi
+ 4d9:	0f b6 92 b4 08 00 00 	movzbl 0x8b4(%edx),%edx
+ 4e0:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 4e4:	89 ca                	mov    %ecx,%edx
+ 4e6:	89 c1                	mov    %eax,%ecx
+ 4e8:	39 f2                	cmp    %esi,%edx
+ 4ea:	73 df                	jae    4cb <printint+0x28>
+  if(neg)
+ 4ec:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 4f0:	74 08                	je     4fa <printint+0x57>
+    buf[i++] = '-';
+ 4f2:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 4f7:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 4fa:	85 db                	test   %ebx,%ebx
+ 4fc:	7e 2a                	jle    528 <printint+0x85>
+ 4fe:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 501:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 505:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 508:	0f b6 03             	movzbl (%ebx),%eax
+ 50b:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 50e:	83 ec 04             	sub    $0x4,%esp
+ 511:	6a 01                	push   $0x1
+ 513:	57                   	push   %edi
+ 514:	ff 75 c4             	push   -0x3c(%ebp)
+ 517:	e8 97 fe ff ff       	call   3b3 <write>
+  while(--i >= 0)
+ 51c:	89 d8                	mov    %ebx,%eax
+ 51e:	83 eb 01             	sub    $0x1,%ebx
+ 521:	83 c4 10             	add    $0x10,%esp
+ 524:	39 f0                	cmp    %esi,%eax
+ 526:	75 e0                	jne    508 <printint+0x65>
+}
+ 528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 52b:	5b                   	pop    %ebx
+ 52c:	5e                   	pop    %esi
+ 52d:	5f                   	pop    %edi
+ 52e:	5d                   	pop    %ebp
+ 52f:	c3                   	ret
+    x = xx;
+ 530:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 532:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 539:	eb 8b                	jmp    4c6 <printint+0x23>
+
+0000053b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 53b:	55                   	push   %ebp
+ 53c:	89 e5                	mov    %esp,%ebp
+ 53e:	57                   	push   %edi
+ 53f:	56                   	push   %esi
+ 540:	53                   	push   %ebx
+ 541:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 544:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 547:	0f b6 1e             	movzbl (%esi),%ebx
+ 54a:	84 db                	test   %bl,%bl
+ 54c:	0f 84 9e 01 00 00    	je     6f0 <printf+0x1b5>
+ 552:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 555:	8d 45 10             	lea    0x10(%ebp),%eax
+ 558:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 55b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 560:	eb 2d                	jmp    58f <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 562:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 565:	83 ec 04             	sub    $0x4,%esp
+ 568:	6a 01                	push   $0x1
+ 56a:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 56d:	50                   	push   %eax
+ 56e:	ff 75 08             	push   0x8(%ebp)
+ 571:	e8 3d fe ff ff       	call   3b3 <write>
+        putc(fd, c);
+ 576:	83 c4 10             	add    $0x10,%esp
+ 579:	eb 05                	jmp    580 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 57b:	83 ff 25             	cmp    $0x25,%edi
+ 57e:	74 1f                	je     59f <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 580:	83 c6 01             	add    $0x1,%esi
+ 583:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 587:	84 db                	test   %bl,%bl
+ 589:	0f 84 61 01 00 00    	je     6f0 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 58f:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 592:	85 ff                	test   %edi,%edi
+ 594:	75 e5                	jne    57b <printf+0x40>
+      if(c == '%'){
+ 596:	83 f8 25             	cmp    $0x25,%eax
+ 599:	75 c7                	jne    562 <printf+0x27>
+        state = '%';
+ 59b:	89 c7                	mov    %eax,%edi
+ 59d:	eb e1                	jmp    580 <printf+0x45>
+      if(c == 'd'){
+ 59f:	83 f8 25             	cmp    $0x25,%eax
+ 5a2:	0f 84 f4 00 00 00    	je     69c <printf+0x161>
+ 5a8:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 5ab:	83 fa 15             	cmp    $0x15,%edx
+ 5ae:	0f 87 09 01 00 00    	ja     6bd <printf+0x182>
+ 5b4:	0f 87 03 01 00 00    	ja     6bd <printf+0x182>
+ 5ba:	ff 24 95 5c 08 00 00 	jmp    *0x85c(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 5c1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5c4:	8b 17                	mov    (%edi),%edx
+ 5c6:	83 ec 0c             	sub    $0xc,%esp
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d3:	e8 cb fe ff ff       	call   4a3 <printint>
+        ap++;
+ 5d8:	83 c7 04             	add    $0x4,%edi
+ 5db:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 5de:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 5e1:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5e6:	eb 98                	jmp    580 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 5e8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 5eb:	8b 17                	mov    (%edi),%edx
+ 5ed:	83 ec 0c             	sub    $0xc,%esp
+ 5f0:	6a 00                	push   $0x0
+ 5f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fa:	e8 a4 fe ff ff       	call   4a3 <printint>
+        ap++;
+ 5ff:	83 c7 04             	add    $0x4,%edi
+ 602:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 605:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 608:	bf 00 00 00 00       	mov    $0x0,%edi
+ 60d:	e9 6e ff ff ff       	jmp    580 <printf+0x45>
+        s = (char*)*ap;
+ 612:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 615:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 617:	83 c1 04             	add    $0x4,%ecx
+ 61a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 61d:	85 c0                	test   %eax,%eax
+ 61f:	74 13                	je     634 <printf+0xf9>
+        s = (char*)*ap;
+ 621:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 623:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 626:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 62b:	84 c0                	test   %al,%al
+ 62d:	75 0f                	jne    63e <printf+0x103>
+ 62f:	e9 4c ff ff ff       	jmp    580 <printf+0x45>
+          s = "(null)";
+ 634:	bb 53 08 00 00       	mov    $0x853,%ebx
+        while(*s != 0){
+ 639:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 63e:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 641:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 644:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 647:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 64a:	83 ec 04             	sub    $0x4,%esp
+ 64d:	6a 01                	push   $0x1
+ 64f:	57                   	push   %edi
+ 650:	56                   	push   %esi
+ 651:	e8 5d fd ff ff       	call   3b3 <write>
+          s++;
+ 656:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 659:	0f b6 03             	movzbl (%ebx),%eax
+ 65c:	83 c4 10             	add    $0x10,%esp
+ 65f:	84 c0                	test   %al,%al
+ 661:	75 e4                	jne    647 <printf+0x10c>
+      state = 0;
+ 663:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 666:	bf 00 00 00 00       	mov    $0x0,%edi
+ 66b:	e9 10 ff ff ff       	jmp    580 <printf+0x45>
+        putc(fd, *ap);
+ 670:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 673:	8b 07                	mov    (%edi),%eax
+ 675:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 678:	83 ec 04             	sub    $0x4,%esp
+ 67b:	6a 01                	push   $0x1
+ 67d:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 680:	50                   	push   %eax
+ 681:	ff 75 08             	push   0x8(%ebp)
+ 684:	e8 2a fd ff ff       	call   3b3 <write>
+        ap++;
+ 689:	83 c7 04             	add    $0x4,%edi
+ 68c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 68f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 692:	bf 00 00 00 00       	mov    $0x0,%edi
+ 697:	e9 e4 fe ff ff       	jmp    580 <printf+0x45>
+        putc(fd, c);
+ 69c:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 69f:	83 ec 04             	sub    $0x4,%esp
+ 6a2:	6a 01                	push   $0x1
+ 6a4:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6a7:	50                   	push   %eax
+ 6a8:	ff 75 08             	push   0x8(%ebp)
+ 6ab:	e8 03 fd ff ff       	call   3b3 <write>
+ 6b0:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6b3:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6b8:	e9 c3 fe ff ff       	jmp    580 <printf+0x45>
+        putc(fd, '%');
+ 6bd:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c1:	83 ec 04             	sub    $0x4,%esp
+ 6c4:	6a 01                	push   $0x1
+ 6c6:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 6c9:	57                   	push   %edi
+ 6ca:	ff 75 08             	push   0x8(%ebp)
+ 6cd:	e8 e1 fc ff ff       	call   3b3 <write>
+        putc(fd, c);
+ 6d2:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d5:	83 c4 0c             	add    $0xc,%esp
+ 6d8:	6a 01                	push   $0x1
+ 6da:	57                   	push   %edi
+ 6db:	ff 75 08             	push   0x8(%ebp)
+ 6de:	e8 d0 fc ff ff       	call   3b3 <write>
+        putc(fd, c);
+ 6e3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e6:	bf 00 00 00 00       	mov    $0x0,%edi
+ 6eb:	e9 90 fe ff ff       	jmp    580 <printf+0x45>
+    }
+  }
+}
+ 6f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f3:	5b                   	pop    %ebx
+ 6f4:	5e                   	pop    %esi
+ 6f5:	5f                   	pop    %edi
+ 6f6:	5d                   	pop    %ebp
+ 6f7:	c3                   	ret
+
+000006f8 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6f8:	55                   	push   %ebp
+ 6f9:	89 e5                	mov    %esp,%ebp
+ 6fb:	57                   	push   %edi
+ 6fc:	56                   	push   %esi
+ 6fd:	53                   	push   %ebx
+ 6fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 701:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 704:	a1 40 0b 00 00       	mov    0xb40,%eax
+ 709:	eb 0c                	jmp    717 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 70b:	8b 10                	mov    (%eax),%edx
+ 70d:	39 d0                	cmp    %edx,%eax
+ 70f:	72 04                	jb     715 <free+0x1d>
+ 711:	39 d1                	cmp    %edx,%ecx
+ 713:	72 10                	jb     725 <free+0x2d>
+{
+ 715:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 717:	39 c8                	cmp    %ecx,%eax
+ 719:	73 f0                	jae    70b <free+0x13>
+ 71b:	8b 10                	mov    (%eax),%edx
+ 71d:	39 d1                	cmp    %edx,%ecx
+ 71f:	72 04                	jb     725 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 721:	39 d0                	cmp    %edx,%eax
+ 723:	72 f0                	jb     715 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 725:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 728:	8b 10                	mov    (%eax),%edx
+ 72a:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 72d:	39 fa                	cmp    %edi,%edx
+ 72f:	74 19                	je     74a <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 731:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 734:	8b 50 04             	mov    0x4(%eax),%edx
+ 737:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 73a:	39 f1                	cmp    %esi,%ecx
+ 73c:	74 18                	je     756 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 73e:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 740:	a3 40 0b 00 00       	mov    %eax,0xb40
+}
+ 745:	5b                   	pop    %ebx
+ 746:	5e                   	pop    %esi
+ 747:	5f                   	pop    %edi
+ 748:	5d                   	pop    %ebp
+ 749:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 74a:	03 72 04             	add    0x4(%edx),%esi
+ 74d:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 750:	8b 10                	mov    (%eax),%edx
+ 752:	8b 12                	mov    (%edx),%edx
+ 754:	eb db                	jmp    731 <free+0x39>
+    p->s.size += bp->s.size;
+ 756:	03 53 fc             	add    -0x4(%ebx),%edx
+ 759:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 75c:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 75f:	eb dd                	jmp    73e <free+0x46>
+
+00000761 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 761:	55                   	push   %ebp
+ 762:	89 e5                	mov    %esp,%ebp
+ 764:	57                   	push   %edi
+ 765:	56                   	push   %esi
+ 766:	53                   	push   %ebx
+ 767:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 76a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76d:	8d 58 07             	lea    0x7(%eax),%ebx
+ 770:	c1 eb 03             	shr    $0x3,%ebx
+ 773:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 776:	8b 15 40 0b 00 00    	mov    0xb40,%edx
+ 77c:	85 d2                	test   %edx,%edx
+ 77e:	74 1c                	je     79c <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 780:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 782:	8b 48 04             	mov    0x4(%eax),%ecx
+ 785:	39 d9                	cmp    %ebx,%ecx
+ 787:	73 38                	jae    7c1 <malloc+0x60>
+  if(nu < 4096)
+ 789:	be 00 10 00 00       	mov    $0x1000,%esi
+ 78e:	39 f3                	cmp    %esi,%ebx
+ 790:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 793:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 79a:	eb 72                	jmp    80e <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 79c:	c7 05 40 0b 00 00 44 	movl   $0xb44,0xb40
+ 7a3:	0b 00 00 
+ 7a6:	c7 05 44 0b 00 00 44 	movl   $0xb44,0xb44
+ 7ad:	0b 00 00 
+    base.s.size = 0;
+ 7b0:	c7 05 48 0b 00 00 00 	movl   $0x0,0xb48
+ 7b7:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7ba:	b8 44 0b 00 00       	mov    $0xb44,%eax
+    if(p->s.size >= nunits){
+ 7bf:	eb c8                	jmp    789 <malloc+0x28>
+      if(p->s.size == nunits)
+ 7c1:	39 cb                	cmp    %ecx,%ebx
+ 7c3:	74 1e                	je     7e3 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 7c5:	29 d9                	sub    %ebx,%ecx
+ 7c7:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7ca:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7cd:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 7d0:	89 15 40 0b 00 00    	mov    %edx,0xb40
+      return (void*)(p + 1);
+ 7d6:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 7d9:	89 d0                	mov    %edx,%eax
+ 7db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7de:	5b                   	pop    %ebx
+ 7df:	5e                   	pop    %esi
+ 7e0:	5f                   	pop    %edi
+ 7e1:	5d                   	pop    %ebp
+ 7e2:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 7e3:	8b 08                	mov    (%eax),%ecx
+ 7e5:	89 0a                	mov    %ecx,(%edx)
+ 7e7:	eb e7                	jmp    7d0 <malloc+0x6f>
+  hp->s.size = nu;
+ 7e9:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 7ec:	83 ec 0c             	sub    $0xc,%esp
+ 7ef:	83 c0 08             	add    $0x8,%eax
+ 7f2:	50                   	push   %eax
+ 7f3:	e8 00 ff ff ff       	call   6f8 <free>
+  return freep;
+ 7f8:	8b 15 40 0b 00 00    	mov    0xb40,%edx
+      if((p = morecore(nunits)) == 0)
+ 7fe:	83 c4 10             	add    $0x10,%esp
+ 801:	85 d2                	test   %edx,%edx
+ 803:	74 d4                	je     7d9 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 805:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 807:	8b 48 04             	mov    0x4(%eax),%ecx
+ 80a:	39 d9                	cmp    %ebx,%ecx
+ 80c:	73 b3                	jae    7c1 <malloc+0x60>
+    if(p == freep)
+ 80e:	89 c2                	mov    %eax,%edx
+ 810:	39 05 40 0b 00 00    	cmp    %eax,0xb40
+ 816:	75 ed                	jne    805 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 818:	83 ec 0c             	sub    $0xc,%esp
+ 81b:	57                   	push   %edi
+ 81c:	e8 fa fb ff ff       	call   41b <sbrk>
+  if(p == (char*)-1)
+ 821:	83 c4 10             	add    $0x10,%esp
+ 824:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 827:	75 c0                	jne    7e9 <malloc+0x88>
+        return 0;
+ 829:	ba 00 00 00 00       	mov    $0x0,%edx
+ 82e:	eb a9                	jmp    7d9 <malloc+0x78>
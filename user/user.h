@@ -1,6 +1,9 @@
 struct stat;
 struct rtcdate;
 struct ptimes;
+struct schedparam;
+struct memstat;
+struct iostat;
 
 // system calls
 int fork(void);
@@ -33,6 +36,11 @@ int sigsetmask(int *maskp);
 int sigpause(int mask);
 int predict_cpu(int pretick); // hw 3 step 4
 int sleeptick(int); // hw 3 step 5 (but sleep(int)) is already implemented in default xv6
+int schedctl(struct schedparam*);
+int nswtch(void);
+int getloadavg(int*);
+int memstat(int, struct memstat*);
+int iostat(int, struct iostat*);
 
 // ulib.c
 int stat(char*, struct stat*);
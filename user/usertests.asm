@@ -0,0 +1,7223 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+       6:	68 54 3d 00 00       	push   $0x3d54
+       b:	ff 35 2c 5d 00 00    	push   0x5d2c
+      11:	e8 b3 39 00 00       	call   39c9 <printf>
+
+  if(mkdir("iputdir") < 0){
+      16:	c7 04 24 e7 3c 00 00 	movl   $0x3ce7,(%esp)
+      1d:	e8 67 38 00 00       	call   3889 <mkdir>
+      22:	83 c4 10             	add    $0x10,%esp
+      25:	85 c0                	test   %eax,%eax
+      27:	78 54                	js     7d <iputtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+  if(chdir("iputdir") < 0){
+      29:	83 ec 0c             	sub    $0xc,%esp
+      2c:	68 e7 3c 00 00       	push   $0x3ce7
+      31:	e8 5b 38 00 00       	call   3891 <chdir>
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	85 c0                	test   %eax,%eax
+      3b:	78 58                	js     95 <iputtest+0x95>
+    printf(stdout, "chdir iputdir failed\n");
+    exit();
+  }
+  if(unlink("../iputdir") < 0){
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	68 e4 3c 00 00       	push   $0x3ce4
+      45:	e8 27 38 00 00       	call   3871 <unlink>
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	85 c0                	test   %eax,%eax
+      4f:	78 5c                	js     ad <iputtest+0xad>
+    printf(stdout, "unlink ../iputdir failed\n");
+    exit();
+  }
+  if(chdir("/") < 0){
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	68 09 3d 00 00       	push   $0x3d09
+      59:	e8 33 38 00 00       	call   3891 <chdir>
+      5e:	83 c4 10             	add    $0x10,%esp
+      61:	85 c0                	test   %eax,%eax
+      63:	78 60                	js     c5 <iputtest+0xc5>
+    printf(stdout, "chdir / failed\n");
+    exit();
+  }
+  printf(stdout, "iput test ok\n");
+      65:	83 ec 08             	sub    $0x8,%esp
+      68:	68 8c 3d 00 00       	push   $0x3d8c
+      6d:	ff 35 2c 5d 00 00    	push   0x5d2c
+      73:	e8 51 39 00 00       	call   39c9 <printf>
+}
+      78:	83 c4 10             	add    $0x10,%esp
+      7b:	c9                   	leave
+      7c:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+      7d:	83 ec 08             	sub    $0x8,%esp
+      80:	68 c0 3c 00 00       	push   $0x3cc0
+      85:	ff 35 2c 5d 00 00    	push   0x5d2c
+      8b:	e8 39 39 00 00       	call   39c9 <printf>
+    exit();
+      90:	e8 8c 37 00 00       	call   3821 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+      95:	83 ec 08             	sub    $0x8,%esp
+      98:	68 ce 3c 00 00       	push   $0x3cce
+      9d:	ff 35 2c 5d 00 00    	push   0x5d2c
+      a3:	e8 21 39 00 00       	call   39c9 <printf>
+    exit();
+      a8:	e8 74 37 00 00       	call   3821 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 ef 3c 00 00       	push   $0x3cef
+      b5:	ff 35 2c 5d 00 00    	push   0x5d2c
+      bb:	e8 09 39 00 00       	call   39c9 <printf>
+    exit();
+      c0:	e8 5c 37 00 00       	call   3821 <exit>
+    printf(stdout, "chdir / failed\n");
+      c5:	83 ec 08             	sub    $0x8,%esp
+      c8:	68 0b 3d 00 00       	push   $0x3d0b
+      cd:	ff 35 2c 5d 00 00    	push   0x5d2c
+      d3:	e8 f1 38 00 00       	call   39c9 <printf>
+    exit();
+      d8:	e8 44 37 00 00       	call   3821 <exit>
+
+000000dd <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      dd:	55                   	push   %ebp
+      de:	89 e5                	mov    %esp,%ebp
+      e0:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      e3:	68 1b 3d 00 00       	push   $0x3d1b
+      e8:	ff 35 2c 5d 00 00    	push   0x5d2c
+      ee:	e8 d6 38 00 00       	call   39c9 <printf>
+
+  pid = fork();
+      f3:	e8 21 37 00 00       	call   3819 <fork>
+  if(pid < 0){
+      f8:	83 c4 10             	add    $0x10,%esp
+      fb:	85 c0                	test   %eax,%eax
+      fd:	78 47                	js     146 <exitiputtest+0x69>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+      ff:	0f 85 a1 00 00 00    	jne    1a6 <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	68 e7 3c 00 00       	push   $0x3ce7
+     10d:	e8 77 37 00 00       	call   3889 <mkdir>
+     112:	83 c4 10             	add    $0x10,%esp
+     115:	85 c0                	test   %eax,%eax
+     117:	78 45                	js     15e <exitiputtest+0x81>
+      printf(stdout, "mkdir failed\n");
+      exit();
+    }
+    if(chdir("iputdir") < 0){
+     119:	83 ec 0c             	sub    $0xc,%esp
+     11c:	68 e7 3c 00 00       	push   $0x3ce7
+     121:	e8 6b 37 00 00       	call   3891 <chdir>
+     126:	83 c4 10             	add    $0x10,%esp
+     129:	85 c0                	test   %eax,%eax
+     12b:	78 49                	js     176 <exitiputtest+0x99>
+      printf(stdout, "child chdir failed\n");
+      exit();
+    }
+    if(unlink("../iputdir") < 0){
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	68 e4 3c 00 00       	push   $0x3ce4
+     135:	e8 37 37 00 00       	call   3871 <unlink>
+     13a:	83 c4 10             	add    $0x10,%esp
+     13d:	85 c0                	test   %eax,%eax
+     13f:	78 4d                	js     18e <exitiputtest+0xb1>
+      printf(stdout, "unlink ../iputdir failed\n");
+      exit();
+    }
+    exit();
+     141:	e8 db 36 00 00       	call   3821 <exit>
+    printf(stdout, "fork failed\n");
+     146:	83 ec 08             	sub    $0x8,%esp
+     149:	68 01 4c 00 00       	push   $0x4c01
+     14e:	ff 35 2c 5d 00 00    	push   0x5d2c
+     154:	e8 70 38 00 00       	call   39c9 <printf>
+    exit();
+     159:	e8 c3 36 00 00       	call   3821 <exit>
+      printf(stdout, "mkdir failed\n");
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	68 c0 3c 00 00       	push   $0x3cc0
+     166:	ff 35 2c 5d 00 00    	push   0x5d2c
+     16c:	e8 58 38 00 00       	call   39c9 <printf>
+      exit();
+     171:	e8 ab 36 00 00       	call   3821 <exit>
+      printf(stdout, "child chdir failed\n");
+     176:	83 ec 08             	sub    $0x8,%esp
+     179:	68 2a 3d 00 00       	push   $0x3d2a
+     17e:	ff 35 2c 5d 00 00    	push   0x5d2c
+     184:	e8 40 38 00 00       	call   39c9 <printf>
+      exit();
+     189:	e8 93 36 00 00       	call   3821 <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     18e:	83 ec 08             	sub    $0x8,%esp
+     191:	68 ef 3c 00 00       	push   $0x3cef
+     196:	ff 35 2c 5d 00 00    	push   0x5d2c
+     19c:	e8 28 38 00 00       	call   39c9 <printf>
+      exit();
+     1a1:	e8 7b 36 00 00       	call   3821 <exit>
+  }
+  wait(0);
+     1a6:	83 ec 0c             	sub    $0xc,%esp
+     1a9:	6a 00                	push   $0x0
+     1ab:	e8 79 36 00 00       	call   3829 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1b0:	83 c4 08             	add    $0x8,%esp
+     1b3:	68 3e 3d 00 00       	push   $0x3d3e
+     1b8:	ff 35 2c 5d 00 00    	push   0x5d2c
+     1be:	e8 06 38 00 00       	call   39c9 <printf>
+}
+     1c3:	83 c4 10             	add    $0x10,%esp
+     1c6:	c9                   	leave
+     1c7:	c3                   	ret
+
+000001c8 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1c8:	55                   	push   %ebp
+     1c9:	89 e5                	mov    %esp,%ebp
+     1cb:	83 ec 10             	sub    $0x10,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1ce:	68 50 3d 00 00       	push   $0x3d50
+     1d3:	ff 35 2c 5d 00 00    	push   0x5d2c
+     1d9:	e8 eb 37 00 00       	call   39c9 <printf>
+  if(mkdir("oidir") < 0){
+     1de:	c7 04 24 5f 3d 00 00 	movl   $0x3d5f,(%esp)
+     1e5:	e8 9f 36 00 00       	call   3889 <mkdir>
+     1ea:	83 c4 10             	add    $0x10,%esp
+     1ed:	85 c0                	test   %eax,%eax
+     1ef:	78 39                	js     22a <openiputtest+0x62>
+    printf(stdout, "mkdir oidir failed\n");
+    exit();
+  }
+  pid = fork();
+     1f1:	e8 23 36 00 00       	call   3819 <fork>
+  if(pid < 0){
+     1f6:	85 c0                	test   %eax,%eax
+     1f8:	78 48                	js     242 <openiputtest+0x7a>
+    printf(stdout, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     1fa:	75 63                	jne    25f <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     1fc:	83 ec 08             	sub    $0x8,%esp
+     1ff:	6a 02                	push   $0x2
+     201:	68 5f 3d 00 00       	push   $0x3d5f
+     206:	e8 56 36 00 00       	call   3861 <open>
+    if(fd >= 0){
+     20b:	83 c4 10             	add    $0x10,%esp
+     20e:	85 c0                	test   %eax,%eax
+     210:	78 48                	js     25a <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     212:	83 ec 08             	sub    $0x8,%esp
+     215:	68 e4 4c 00 00       	push   $0x4ce4
+     21a:	ff 35 2c 5d 00 00    	push   0x5d2c
+     220:	e8 a4 37 00 00       	call   39c9 <printf>
+      exit();
+     225:	e8 f7 35 00 00       	call   3821 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     22a:	83 ec 08             	sub    $0x8,%esp
+     22d:	68 65 3d 00 00       	push   $0x3d65
+     232:	ff 35 2c 5d 00 00    	push   0x5d2c
+     238:	e8 8c 37 00 00       	call   39c9 <printf>
+    exit();
+     23d:	e8 df 35 00 00       	call   3821 <exit>
+    printf(stdout, "fork failed\n");
+     242:	83 ec 08             	sub    $0x8,%esp
+     245:	68 01 4c 00 00       	push   $0x4c01
+     24a:	ff 35 2c 5d 00 00    	push   0x5d2c
+     250:	e8 74 37 00 00       	call   39c9 <printf>
+    exit();
+     255:	e8 c7 35 00 00       	call   3821 <exit>
+    }
+    exit();
+     25a:	e8 c2 35 00 00       	call   3821 <exit>
+  }
+  sleep(1);
+     25f:	83 ec 0c             	sub    $0xc,%esp
+     262:	6a 01                	push   $0x1
+     264:	e8 48 36 00 00       	call   38b1 <sleep>
+  if(unlink("oidir") != 0){
+     269:	c7 04 24 5f 3d 00 00 	movl   $0x3d5f,(%esp)
+     270:	e8 fc 35 00 00       	call   3871 <unlink>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	75 22                	jne    29e <openiputtest+0xd6>
+    printf(stdout, "unlink failed\n");
+    exit();
+  }
+  wait(0);
+     27c:	83 ec 0c             	sub    $0xc,%esp
+     27f:	6a 00                	push   $0x0
+     281:	e8 a3 35 00 00       	call   3829 <wait>
+  printf(stdout, "openiput test ok\n");
+     286:	83 c4 08             	add    $0x8,%esp
+     289:	68 88 3d 00 00       	push   $0x3d88
+     28e:	ff 35 2c 5d 00 00    	push   0x5d2c
+     294:	e8 30 37 00 00       	call   39c9 <printf>
+}
+     299:	83 c4 10             	add    $0x10,%esp
+     29c:	c9                   	leave
+     29d:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     29e:	83 ec 08             	sub    $0x8,%esp
+     2a1:	68 79 3d 00 00       	push   $0x3d79
+     2a6:	ff 35 2c 5d 00 00    	push   0x5d2c
+     2ac:	e8 18 37 00 00       	call   39c9 <printf>
+    exit();
+     2b1:	e8 6b 35 00 00       	call   3821 <exit>
+
+000002b6 <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2b6:	55                   	push   %ebp
+     2b7:	89 e5                	mov    %esp,%ebp
+     2b9:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     2bc:	68 9a 3d 00 00       	push   $0x3d9a
+     2c1:	ff 35 2c 5d 00 00    	push   0x5d2c
+     2c7:	e8 fd 36 00 00       	call   39c9 <printf>
+  fd = open("echo", 0);
+     2cc:	83 c4 08             	add    $0x8,%esp
+     2cf:	6a 00                	push   $0x0
+     2d1:	68 a5 3d 00 00       	push   $0x3da5
+     2d6:	e8 86 35 00 00       	call   3861 <open>
+  if(fd < 0){
+     2db:	83 c4 10             	add    $0x10,%esp
+     2de:	85 c0                	test   %eax,%eax
+     2e0:	78 37                	js     319 <opentest+0x63>
+    printf(stdout, "open echo failed!\n");
+    exit();
+  }
+  close(fd);
+     2e2:	83 ec 0c             	sub    $0xc,%esp
+     2e5:	50                   	push   %eax
+     2e6:	e8 5e 35 00 00       	call   3849 <close>
+  fd = open("doesnotexist", 0);
+     2eb:	83 c4 08             	add    $0x8,%esp
+     2ee:	6a 00                	push   $0x0
+     2f0:	68 bd 3d 00 00       	push   $0x3dbd
+     2f5:	e8 67 35 00 00       	call   3861 <open>
+  if(fd >= 0){
+     2fa:	83 c4 10             	add    $0x10,%esp
+     2fd:	85 c0                	test   %eax,%eax
+     2ff:	79 30                	jns    331 <opentest+0x7b>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    exit();
+  }
+  printf(stdout, "open test ok\n");
+     301:	83 ec 08             	sub    $0x8,%esp
+     304:	68 e8 3d 00 00       	push   $0x3de8
+     309:	ff 35 2c 5d 00 00    	push   0x5d2c
+     30f:	e8 b5 36 00 00       	call   39c9 <printf>
+}
+     314:	83 c4 10             	add    $0x10,%esp
+     317:	c9                   	leave
+     318:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     319:	83 ec 08             	sub    $0x8,%esp
+     31c:	68 aa 3d 00 00       	push   $0x3daa
+     321:	ff 35 2c 5d 00 00    	push   0x5d2c
+     327:	e8 9d 36 00 00       	call   39c9 <printf>
+    exit();
+     32c:	e8 f0 34 00 00       	call   3821 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     331:	83 ec 08             	sub    $0x8,%esp
+     334:	68 ca 3d 00 00       	push   $0x3dca
+     339:	ff 35 2c 5d 00 00    	push   0x5d2c
+     33f:	e8 85 36 00 00       	call   39c9 <printf>
+    exit();
+     344:	e8 d8 34 00 00       	call   3821 <exit>
+
+00000349 <writetest>:
+
+void
+writetest(void)
+{
+     349:	55                   	push   %ebp
+     34a:	89 e5                	mov    %esp,%ebp
+     34c:	56                   	push   %esi
+     34d:	53                   	push   %ebx
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     34e:	83 ec 08             	sub    $0x8,%esp
+     351:	68 f6 3d 00 00       	push   $0x3df6
+     356:	ff 35 2c 5d 00 00    	push   0x5d2c
+     35c:	e8 68 36 00 00       	call   39c9 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     361:	83 c4 08             	add    $0x8,%esp
+     364:	68 02 02 00 00       	push   $0x202
+     369:	68 07 3e 00 00       	push   $0x3e07
+     36e:	e8 ee 34 00 00       	call   3861 <open>
+  if(fd >= 0){
+     373:	83 c4 10             	add    $0x10,%esp
+     376:	85 c0                	test   %eax,%eax
+     378:	0f 88 17 01 00 00    	js     495 <writetest+0x14c>
+     37e:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     380:	83 ec 08             	sub    $0x8,%esp
+     383:	68 0d 3e 00 00       	push   $0x3e0d
+     388:	ff 35 2c 5d 00 00    	push   0x5d2c
+     38e:	e8 36 36 00 00       	call   39c9 <printf>
+     393:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     396:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     39b:	83 ec 04             	sub    $0x4,%esp
+     39e:	6a 0a                	push   $0xa
+     3a0:	68 44 3e 00 00       	push   $0x3e44
+     3a5:	56                   	push   %esi
+     3a6:	e8 96 34 00 00       	call   3841 <write>
+     3ab:	83 c4 10             	add    $0x10,%esp
+     3ae:	83 f8 0a             	cmp    $0xa,%eax
+     3b1:	0f 85 f6 00 00 00    	jne    4ad <writetest+0x164>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+      exit();
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     3b7:	83 ec 04             	sub    $0x4,%esp
+     3ba:	6a 0a                	push   $0xa
+     3bc:	68 4f 3e 00 00       	push   $0x3e4f
+     3c1:	56                   	push   %esi
+     3c2:	e8 7a 34 00 00       	call   3841 <write>
+     3c7:	83 c4 10             	add    $0x10,%esp
+     3ca:	83 f8 0a             	cmp    $0xa,%eax
+     3cd:	0f 85 f3 00 00 00    	jne    4c6 <writetest+0x17d>
+  for(i = 0; i < 100; i++){
+     3d3:	83 c3 01             	add    $0x1,%ebx
+     3d6:	83 fb 64             	cmp    $0x64,%ebx
+     3d9:	75 c0                	jne    39b <writetest+0x52>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+      exit();
+    }
+  }
+  printf(stdout, "writes ok\n");
+     3db:	83 ec 08             	sub    $0x8,%esp
+     3de:	68 5a 3e 00 00       	push   $0x3e5a
+     3e3:	ff 35 2c 5d 00 00    	push   0x5d2c
+     3e9:	e8 db 35 00 00       	call   39c9 <printf>
+  close(fd);
+     3ee:	89 34 24             	mov    %esi,(%esp)
+     3f1:	e8 53 34 00 00       	call   3849 <close>
+  fd = open("small", O_RDONLY);
+     3f6:	83 c4 08             	add    $0x8,%esp
+     3f9:	6a 00                	push   $0x0
+     3fb:	68 07 3e 00 00       	push   $0x3e07
+     400:	e8 5c 34 00 00       	call   3861 <open>
+     405:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     407:	83 c4 10             	add    $0x10,%esp
+     40a:	85 c0                	test   %eax,%eax
+     40c:	0f 88 cd 00 00 00    	js     4df <writetest+0x196>
+    printf(stdout, "open small succeeded ok\n");
+     412:	83 ec 08             	sub    $0x8,%esp
+     415:	68 65 3e 00 00       	push   $0x3e65
+     41a:	ff 35 2c 5d 00 00    	push   0x5d2c
+     420:	e8 a4 35 00 00       	call   39c9 <printf>
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     425:	83 c4 0c             	add    $0xc,%esp
+     428:	68 d0 07 00 00       	push   $0x7d0
+     42d:	68 80 84 00 00       	push   $0x8480
+     432:	53                   	push   %ebx
+     433:	e8 01 34 00 00       	call   3839 <read>
+  if(i == 2000){
+     438:	83 c4 10             	add    $0x10,%esp
+     43b:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     440:	0f 85 b1 00 00 00    	jne    4f7 <writetest+0x1ae>
+    printf(stdout, "read succeeded ok\n");
+     446:	83 ec 08             	sub    $0x8,%esp
+     449:	68 99 3e 00 00       	push   $0x3e99
+     44e:	ff 35 2c 5d 00 00    	push   0x5d2c
+     454:	e8 70 35 00 00       	call   39c9 <printf>
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     459:	89 1c 24             	mov    %ebx,(%esp)
+     45c:	e8 e8 33 00 00       	call   3849 <close>
+
+  if(unlink("small") < 0){
+     461:	c7 04 24 07 3e 00 00 	movl   $0x3e07,(%esp)
+     468:	e8 04 34 00 00       	call   3871 <unlink>
+     46d:	83 c4 10             	add    $0x10,%esp
+     470:	85 c0                	test   %eax,%eax
+     472:	0f 88 97 00 00 00    	js     50f <writetest+0x1c6>
+    printf(stdout, "unlink small failed\n");
+    exit();
+  }
+  printf(stdout, "small file test ok\n");
+     478:	83 ec 08             	sub    $0x8,%esp
+     47b:	68 c1 3e 00 00       	push   $0x3ec1
+     480:	ff 35 2c 5d 00 00    	push   0x5d2c
+     486:	e8 3e 35 00 00       	call   39c9 <printf>
+}
+     48b:	83 c4 10             	add    $0x10,%esp
+     48e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     491:	5b                   	pop    %ebx
+     492:	5e                   	pop    %esi
+     493:	5d                   	pop    %ebp
+     494:	c3                   	ret
+    printf(stdout, "error: creat small failed!\n");
+     495:	83 ec 08             	sub    $0x8,%esp
+     498:	68 28 3e 00 00       	push   $0x3e28
+     49d:	ff 35 2c 5d 00 00    	push   0x5d2c
+     4a3:	e8 21 35 00 00       	call   39c9 <printf>
+    exit();
+     4a8:	e8 74 33 00 00       	call   3821 <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     4ad:	83 ec 04             	sub    $0x4,%esp
+     4b0:	53                   	push   %ebx
+     4b1:	68 08 4d 00 00       	push   $0x4d08
+     4b6:	ff 35 2c 5d 00 00    	push   0x5d2c
+     4bc:	e8 08 35 00 00       	call   39c9 <printf>
+      exit();
+     4c1:	e8 5b 33 00 00       	call   3821 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     4c6:	83 ec 04             	sub    $0x4,%esp
+     4c9:	53                   	push   %ebx
+     4ca:	68 2c 4d 00 00       	push   $0x4d2c
+     4cf:	ff 35 2c 5d 00 00    	push   0x5d2c
+     4d5:	e8 ef 34 00 00       	call   39c9 <printf>
+      exit();
+     4da:	e8 42 33 00 00       	call   3821 <exit>
+    printf(stdout, "error: open small failed!\n");
+     4df:	83 ec 08             	sub    $0x8,%esp
+     4e2:	68 7e 3e 00 00       	push   $0x3e7e
+     4e7:	ff 35 2c 5d 00 00    	push   0x5d2c
+     4ed:	e8 d7 34 00 00       	call   39c9 <printf>
+    exit();
+     4f2:	e8 2a 33 00 00       	call   3821 <exit>
+    printf(stdout, "read failed\n");
+     4f7:	83 ec 08             	sub    $0x8,%esp
+     4fa:	68 c5 41 00 00       	push   $0x41c5
+     4ff:	ff 35 2c 5d 00 00    	push   0x5d2c
+     505:	e8 bf 34 00 00       	call   39c9 <printf>
+    exit();
+     50a:	e8 12 33 00 00       	call   3821 <exit>
+    printf(stdout, "unlink small failed\n");
+     50f:	83 ec 08             	sub    $0x8,%esp
+     512:	68 ac 3e 00 00       	push   $0x3eac
+     517:	ff 35 2c 5d 00 00    	push   0x5d2c
+     51d:	e8 a7 34 00 00       	call   39c9 <printf>
+    exit();
+     522:	e8 fa 32 00 00       	call   3821 <exit>
+
+00000527 <writetest1>:
+
+void
+writetest1(void)
+{
+     527:	55                   	push   %ebp
+     528:	89 e5                	mov    %esp,%ebp
+     52a:	56                   	push   %esi
+     52b:	53                   	push   %ebx
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     52c:	83 ec 08             	sub    $0x8,%esp
+     52f:	68 d5 3e 00 00       	push   $0x3ed5
+     534:	ff 35 2c 5d 00 00    	push   0x5d2c
+     53a:	e8 8a 34 00 00       	call   39c9 <printf>
+
+  fd = open("big", O_CREATE|O_RDWR);
+     53f:	83 c4 08             	add    $0x8,%esp
+     542:	68 02 02 00 00       	push   $0x202
+     547:	68 4f 3f 00 00       	push   $0x3f4f
+     54c:	e8 10 33 00 00       	call   3861 <open>
+  if(fd < 0){
+     551:	83 c4 10             	add    $0x10,%esp
+     554:	85 c0                	test   %eax,%eax
+     556:	0f 88 96 00 00 00    	js     5f2 <writetest1+0xcb>
+     55c:	89 c6                	mov    %eax,%esi
+    printf(stdout, "error: creat big failed!\n");
+    exit();
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     55e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    ((int*)buf)[0] = i;
+     563:	89 1d 80 84 00 00    	mov    %ebx,0x8480
+    if(write(fd, buf, 512) != 512){
+     569:	83 ec 04             	sub    $0x4,%esp
+     56c:	68 00 02 00 00       	push   $0x200
+     571:	68 80 84 00 00       	push   $0x8480
+     576:	56                   	push   %esi
+     577:	e8 c5 32 00 00       	call   3841 <write>
+     57c:	83 c4 10             	add    $0x10,%esp
+     57f:	3d 00 02 00 00       	cmp    $0x200,%eax
+     584:	0f 85 80 00 00 00    	jne    60a <writetest1+0xe3>
+  for(i = 0; i < MAXFILE; i++){
+     58a:	83 c3 01             	add    $0x1,%ebx
+     58d:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     593:	75 ce                	jne    563 <writetest1+0x3c>
+      printf(stdout, "error: write big file failed\n", i);
+      exit();
+    }
+  }
+
+  close(fd);
+     595:	83 ec 0c             	sub    $0xc,%esp
+     598:	56                   	push   %esi
+     599:	e8 ab 32 00 00       	call   3849 <close>
+
+  fd = open("big", O_RDONLY);
+     59e:	83 c4 08             	add    $0x8,%esp
+     5a1:	6a 00                	push   $0x0
+     5a3:	68 4f 3f 00 00       	push   $0x3f4f
+     5a8:	e8 b4 32 00 00       	call   3861 <open>
+     5ad:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     5af:	83 c4 10             	add    $0x10,%esp
+     5b2:	85 c0                	test   %eax,%eax
+     5b4:	78 6d                	js     623 <writetest1+0xfc>
+    printf(stdout, "error: open big failed!\n");
+    exit();
+  }
+
+  n = 0;
+     5b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(;;){
+    i = read(fd, buf, 512);
+     5bb:	83 ec 04             	sub    $0x4,%esp
+     5be:	68 00 02 00 00       	push   $0x200
+     5c3:	68 80 84 00 00       	push   $0x8480
+     5c8:	56                   	push   %esi
+     5c9:	e8 6b 32 00 00       	call   3839 <read>
+    if(i == 0){
+     5ce:	83 c4 10             	add    $0x10,%esp
+     5d1:	85 c0                	test   %eax,%eax
+     5d3:	74 66                	je     63b <writetest1+0x114>
+      if(n == MAXFILE - 1){
+        printf(stdout, "read only %d blocks from big", n);
+        exit();
+      }
+      break;
+    } else if(i != 512){
+     5d5:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5da:	0f 85 b9 00 00 00    	jne    699 <writetest1+0x172>
+      printf(stdout, "read failed %d\n", i);
+      exit();
+    }
+    if(((int*)buf)[0] != n){
+     5e0:	a1 80 84 00 00       	mov    0x8480,%eax
+     5e5:	39 d8                	cmp    %ebx,%eax
+     5e7:	0f 85 c5 00 00 00    	jne    6b2 <writetest1+0x18b>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+      exit();
+    }
+    n++;
+     5ed:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, 512);
+     5f0:	eb c9                	jmp    5bb <writetest1+0x94>
+    printf(stdout, "error: creat big failed!\n");
+     5f2:	83 ec 08             	sub    $0x8,%esp
+     5f5:	68 e5 3e 00 00       	push   $0x3ee5
+     5fa:	ff 35 2c 5d 00 00    	push   0x5d2c
+     600:	e8 c4 33 00 00       	call   39c9 <printf>
+    exit();
+     605:	e8 17 32 00 00       	call   3821 <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     60a:	83 ec 04             	sub    $0x4,%esp
+     60d:	53                   	push   %ebx
+     60e:	68 ff 3e 00 00       	push   $0x3eff
+     613:	ff 35 2c 5d 00 00    	push   0x5d2c
+     619:	e8 ab 33 00 00       	call   39c9 <printf>
+      exit();
+     61e:	e8 fe 31 00 00       	call   3821 <exit>
+    printf(stdout, "error: open big failed!\n");
+     623:	83 ec 08             	sub    $0x8,%esp
+     626:	68 1d 3f 00 00       	push   $0x3f1d
+     62b:	ff 35 2c 5d 00 00    	push   0x5d2c
+     631:	e8 93 33 00 00       	call   39c9 <printf>
+    exit();
+     636:	e8 e6 31 00 00       	call   3821 <exit>
+      if(n == MAXFILE - 1){
+     63b:	81 fb 8b 00 00 00    	cmp    $0x8b,%ebx
+     641:	74 39                	je     67c <writetest1+0x155>
+  }
+  close(fd);
+     643:	83 ec 0c             	sub    $0xc,%esp
+     646:	56                   	push   %esi
+     647:	e8 fd 31 00 00       	call   3849 <close>
+  if(unlink("big") < 0){
+     64c:	c7 04 24 4f 3f 00 00 	movl   $0x3f4f,(%esp)
+     653:	e8 19 32 00 00       	call   3871 <unlink>
+     658:	83 c4 10             	add    $0x10,%esp
+     65b:	85 c0                	test   %eax,%eax
+     65d:	78 6a                	js     6c9 <writetest1+0x1a2>
+    printf(stdout, "unlink big failed\n");
+    exit();
+  }
+  printf(stdout, "big files ok\n");
+     65f:	83 ec 08             	sub    $0x8,%esp
+     662:	68 76 3f 00 00       	push   $0x3f76
+     667:	ff 35 2c 5d 00 00    	push   0x5d2c
+     66d:	e8 57 33 00 00       	call   39c9 <printf>
+}
+     672:	83 c4 10             	add    $0x10,%esp
+     675:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     678:	5b                   	pop    %ebx
+     679:	5e                   	pop    %esi
+     67a:	5d                   	pop    %ebp
+     67b:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     67c:	83 ec 04             	sub    $0x4,%esp
+     67f:	68 8b 00 00 00       	push   $0x8b
+     684:	68 36 3f 00 00       	push   $0x3f36
+     689:	ff 35 2c 5d 00 00    	push   0x5d2c
+     68f:	e8 35 33 00 00       	call   39c9 <printf>
+        exit();
+     694:	e8 88 31 00 00       	call   3821 <exit>
+      printf(stdout, "read failed %d\n", i);
+     699:	83 ec 04             	sub    $0x4,%esp
+     69c:	50                   	push   %eax
+     69d:	68 53 3f 00 00       	push   $0x3f53
+     6a2:	ff 35 2c 5d 00 00    	push   0x5d2c
+     6a8:	e8 1c 33 00 00       	call   39c9 <printf>
+      exit();
+     6ad:	e8 6f 31 00 00       	call   3821 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     6b2:	50                   	push   %eax
+     6b3:	53                   	push   %ebx
+     6b4:	68 50 4d 00 00       	push   $0x4d50
+     6b9:	ff 35 2c 5d 00 00    	push   0x5d2c
+     6bf:	e8 05 33 00 00       	call   39c9 <printf>
+      exit();
+     6c4:	e8 58 31 00 00       	call   3821 <exit>
+    printf(stdout, "unlink big failed\n");
+     6c9:	83 ec 08             	sub    $0x8,%esp
+     6cc:	68 63 3f 00 00       	push   $0x3f63
+     6d1:	ff 35 2c 5d 00 00    	push   0x5d2c
+     6d7:	e8 ed 32 00 00       	call   39c9 <printf>
+    exit();
+     6dc:	e8 40 31 00 00       	call   3821 <exit>
+
+000006e1 <createtest>:
+
+void
+createtest(void)
+{
+     6e1:	55                   	push   %ebp
+     6e2:	89 e5                	mov    %esp,%ebp
+     6e4:	53                   	push   %ebx
+     6e5:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     6e8:	68 70 4d 00 00       	push   $0x4d70
+     6ed:	ff 35 2c 5d 00 00    	push   0x5d2c
+     6f3:	e8 d1 32 00 00       	call   39c9 <printf>
+
+  name[0] = 'a';
+     6f8:	c6 05 70 84 00 00 61 	movb   $0x61,0x8470
+  name[2] = '\0';
+     6ff:	c6 05 72 84 00 00 00 	movb   $0x0,0x8472
+     706:	83 c4 10             	add    $0x10,%esp
+     709:	bb 30 00 00 00       	mov    $0x30,%ebx
+  for(i = 0; i < 52; i++){
+    name[1] = '0' + i;
+     70e:	88 1d 71 84 00 00    	mov    %bl,0x8471
+    fd = open(name, O_CREATE|O_RDWR);
+     714:	83 ec 08             	sub    $0x8,%esp
+     717:	68 02 02 00 00       	push   $0x202
+     71c:	68 70 84 00 00       	push   $0x8470
+     721:	e8 3b 31 00 00       	call   3861 <open>
+    close(fd);
+     726:	89 04 24             	mov    %eax,(%esp)
+     729:	e8 1b 31 00 00       	call   3849 <close>
+  for(i = 0; i < 52; i++){
+     72e:	83 c3 01             	add    $0x1,%ebx
+     731:	83 c4 10             	add    $0x10,%esp
+     734:	80 fb 64             	cmp    $0x64,%bl
+     737:	75 d5                	jne    70e <createtest+0x2d>
+  }
+  name[0] = 'a';
+     739:	c6 05 70 84 00 00 61 	movb   $0x61,0x8470
+  name[2] = '\0';
+     740:	c6 05 72 84 00 00 00 	movb   $0x0,0x8472
+     747:	bb 30 00 00 00       	mov    $0x30,%ebx
+  for(i = 0; i < 52; i++){
+    name[1] = '0' + i;
+     74c:	88 1d 71 84 00 00    	mov    %bl,0x8471
+    unlink(name);
+     752:	83 ec 0c             	sub    $0xc,%esp
+     755:	68 70 84 00 00       	push   $0x8470
+     75a:	e8 12 31 00 00       	call   3871 <unlink>
+  for(i = 0; i < 52; i++){
+     75f:	83 c3 01             	add    $0x1,%ebx
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	80 fb 64             	cmp    $0x64,%bl
+     768:	75 e2                	jne    74c <createtest+0x6b>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     76a:	83 ec 08             	sub    $0x8,%esp
+     76d:	68 98 4d 00 00       	push   $0x4d98
+     772:	ff 35 2c 5d 00 00    	push   0x5d2c
+     778:	e8 4c 32 00 00       	call   39c9 <printf>
+}
+     77d:	83 c4 10             	add    $0x10,%esp
+     780:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     783:	c9                   	leave
+     784:	c3                   	ret
+
+00000785 <dirtest>:
+
+void dirtest(void)
+{
+     785:	55                   	push   %ebp
+     786:	89 e5                	mov    %esp,%ebp
+     788:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     78b:	68 84 3f 00 00       	push   $0x3f84
+     790:	ff 35 2c 5d 00 00    	push   0x5d2c
+     796:	e8 2e 32 00 00       	call   39c9 <printf>
+
+  if(mkdir("dir0") < 0){
+     79b:	c7 04 24 90 3f 00 00 	movl   $0x3f90,(%esp)
+     7a2:	e8 e2 30 00 00       	call   3889 <mkdir>
+     7a7:	83 c4 10             	add    $0x10,%esp
+     7aa:	85 c0                	test   %eax,%eax
+     7ac:	78 54                	js     802 <dirtest+0x7d>
+    printf(stdout, "mkdir failed\n");
+    exit();
+  }
+
+  if(chdir("dir0") < 0){
+     7ae:	83 ec 0c             	sub    $0xc,%esp
+     7b1:	68 90 3f 00 00       	push   $0x3f90
+     7b6:	e8 d6 30 00 00       	call   3891 <chdir>
+     7bb:	83 c4 10             	add    $0x10,%esp
+     7be:	85 c0                	test   %eax,%eax
+     7c0:	78 58                	js     81a <dirtest+0x95>
+    printf(stdout, "chdir dir0 failed\n");
+    exit();
+  }
+
+  if(chdir("..") < 0){
+     7c2:	83 ec 0c             	sub    $0xc,%esp
+     7c5:	68 35 45 00 00       	push   $0x4535
+     7ca:	e8 c2 30 00 00       	call   3891 <chdir>
+     7cf:	83 c4 10             	add    $0x10,%esp
+     7d2:	85 c0                	test   %eax,%eax
+     7d4:	78 5c                	js     832 <dirtest+0xad>
+    printf(stdout, "chdir .. failed\n");
+    exit();
+  }
+
+  if(unlink("dir0") < 0){
+     7d6:	83 ec 0c             	sub    $0xc,%esp
+     7d9:	68 90 3f 00 00       	push   $0x3f90
+     7de:	e8 8e 30 00 00       	call   3871 <unlink>
+     7e3:	83 c4 10             	add    $0x10,%esp
+     7e6:	85 c0                	test   %eax,%eax
+     7e8:	78 60                	js     84a <dirtest+0xc5>
+    printf(stdout, "unlink dir0 failed\n");
+    exit();
+  }
+  printf(stdout, "mkdir test ok\n");
+     7ea:	83 ec 08             	sub    $0x8,%esp
+     7ed:	68 cd 3f 00 00       	push   $0x3fcd
+     7f2:	ff 35 2c 5d 00 00    	push   0x5d2c
+     7f8:	e8 cc 31 00 00       	call   39c9 <printf>
+}
+     7fd:	83 c4 10             	add    $0x10,%esp
+     800:	c9                   	leave
+     801:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     802:	83 ec 08             	sub    $0x8,%esp
+     805:	68 c0 3c 00 00       	push   $0x3cc0
+     80a:	ff 35 2c 5d 00 00    	push   0x5d2c
+     810:	e8 b4 31 00 00       	call   39c9 <printf>
+    exit();
+     815:	e8 07 30 00 00       	call   3821 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     81a:	83 ec 08             	sub    $0x8,%esp
+     81d:	68 95 3f 00 00       	push   $0x3f95
+     822:	ff 35 2c 5d 00 00    	push   0x5d2c
+     828:	e8 9c 31 00 00       	call   39c9 <printf>
+    exit();
+     82d:	e8 ef 2f 00 00       	call   3821 <exit>
+    printf(stdout, "chdir .. failed\n");
+     832:	83 ec 08             	sub    $0x8,%esp
+     835:	68 a8 3f 00 00       	push   $0x3fa8
+     83a:	ff 35 2c 5d 00 00    	push   0x5d2c
+     840:	e8 84 31 00 00       	call   39c9 <printf>
+    exit();
+     845:	e8 d7 2f 00 00       	call   3821 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     84a:	83 ec 08             	sub    $0x8,%esp
+     84d:	68 b9 3f 00 00       	push   $0x3fb9
+     852:	ff 35 2c 5d 00 00    	push   0x5d2c
+     858:	e8 6c 31 00 00       	call   39c9 <printf>
+    exit();
+     85d:	e8 bf 2f 00 00       	call   3821 <exit>
+
+00000862 <exectest>:
+
+void
+exectest(void)
+{
+     862:	55                   	push   %ebp
+     863:	89 e5                	mov    %esp,%ebp
+     865:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     868:	68 dc 3f 00 00       	push   $0x3fdc
+     86d:	ff 35 2c 5d 00 00    	push   0x5d2c
+     873:	e8 51 31 00 00       	call   39c9 <printf>
+  if(exec("echo", echoargv) < 0){
+     878:	83 c4 08             	add    $0x8,%esp
+     87b:	68 30 5d 00 00       	push   $0x5d30
+     880:	68 a5 3d 00 00       	push   $0x3da5
+     885:	e8 cf 2f 00 00       	call   3859 <exec>
+     88a:	83 c4 10             	add    $0x10,%esp
+     88d:	85 c0                	test   %eax,%eax
+     88f:	78 02                	js     893 <exectest+0x31>
+    printf(stdout, "exec echo failed\n");
+    exit();
+  }
+}
+     891:	c9                   	leave
+     892:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     893:	83 ec 08             	sub    $0x8,%esp
+     896:	68 e7 3f 00 00       	push   $0x3fe7
+     89b:	ff 35 2c 5d 00 00    	push   0x5d2c
+     8a1:	e8 23 31 00 00       	call   39c9 <printf>
+    exit();
+     8a6:	e8 76 2f 00 00       	call   3821 <exit>
+
+000008ab <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     8ab:	55                   	push   %ebp
+     8ac:	89 e5                	mov    %esp,%ebp
+     8ae:	57                   	push   %edi
+     8af:	56                   	push   %esi
+     8b0:	53                   	push   %ebx
+     8b1:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     8b4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     8b7:	50                   	push   %eax
+     8b8:	e8 74 2f 00 00       	call   3831 <pipe>
+     8bd:	83 c4 10             	add    $0x10,%esp
+     8c0:	85 c0                	test   %eax,%eax
+     8c2:	0f 85 8c 00 00 00    	jne    954 <pipe1+0xa9>
+     8c8:	89 c3                	mov    %eax,%ebx
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+     8ca:	e8 4a 2f 00 00       	call   3819 <fork>
+     8cf:	89 c6                	mov    %eax,%esi
+  seq = 0;
+  if(pid == 0){
+     8d1:	85 c0                	test   %eax,%eax
+     8d3:	0f 84 8f 00 00 00    	je     968 <pipe1+0xbd>
+        printf(1, "pipe1 oops 1\n");
+        exit();
+      }
+    }
+    exit();
+  } else if(pid > 0){
+     8d9:	0f 8e 52 01 00 00    	jle    a31 <pipe1+0x186>
+    close(fds[1]);
+     8df:	83 ec 0c             	sub    $0xc,%esp
+     8e2:	ff 75 e4             	push   -0x1c(%ebp)
+     8e5:	e8 5f 2f 00 00       	call   3849 <close>
+    total = 0;
+    cc = 1;
+    while((n = read(fds[0], buf, cc)) > 0){
+     8ea:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     8ed:	89 df                	mov    %ebx,%edi
+    cc = 1;
+     8ef:	be 01 00 00 00       	mov    $0x1,%esi
+    while((n = read(fds[0], buf, cc)) > 0){
+     8f4:	83 ec 04             	sub    $0x4,%esp
+     8f7:	56                   	push   %esi
+     8f8:	68 80 84 00 00       	push   $0x8480
+     8fd:	ff 75 e0             	push   -0x20(%ebp)
+     900:	e8 34 2f 00 00       	call   3839 <read>
+     905:	89 c2                	mov    %eax,%edx
+     907:	83 c4 10             	add    $0x10,%esp
+     90a:	85 c0                	test   %eax,%eax
+     90c:	0f 8e d4 00 00 00    	jle    9e6 <pipe1+0x13b>
+      for(i = 0; i < n; i++){
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     912:	89 d8                	mov    %ebx,%eax
+     914:	32 05 80 84 00 00    	xor    0x8480,%al
+     91a:	0f b6 c0             	movzbl %al,%eax
+     91d:	85 c0                	test   %eax,%eax
+     91f:	75 19                	jne    93a <pipe1+0x8f>
+     921:	8d 4b 01             	lea    0x1(%ebx),%ecx
+     924:	8d 1c 01             	lea    (%ecx,%eax,1),%ebx
+      for(i = 0; i < n; i++){
+     927:	83 c0 01             	add    $0x1,%eax
+     92a:	39 c2                	cmp    %eax,%edx
+     92c:	0f 84 a1 00 00 00    	je     9d3 <pipe1+0x128>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     932:	38 98 80 84 00 00    	cmp    %bl,0x8480(%eax)
+     938:	74 ea                	je     924 <pipe1+0x79>
+          printf(1, "pipe1 oops 2\n");
+     93a:	83 ec 08             	sub    $0x8,%esp
+     93d:	68 16 40 00 00       	push   $0x4016
+     942:	6a 01                	push   $0x1
+     944:	e8 80 30 00 00       	call   39c9 <printf>
+     949:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+}
+     94c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     94f:	5b                   	pop    %ebx
+     950:	5e                   	pop    %esi
+     951:	5f                   	pop    %edi
+     952:	5d                   	pop    %ebp
+     953:	c3                   	ret
+    printf(1, "pipe() failed\n");
+     954:	83 ec 08             	sub    $0x8,%esp
+     957:	68 f9 3f 00 00       	push   $0x3ff9
+     95c:	6a 01                	push   $0x1
+     95e:	e8 66 30 00 00       	call   39c9 <printf>
+    exit();
+     963:	e8 b9 2e 00 00       	call   3821 <exit>
+    close(fds[0]);
+     968:	83 ec 0c             	sub    $0xc,%esp
+     96b:	ff 75 e0             	push   -0x20(%ebp)
+     96e:	e8 d6 2e 00 00       	call   3849 <close>
+     973:	83 c4 10             	add    $0x10,%esp
+  seq = 0;
+     976:	89 f3                	mov    %esi,%ebx
+      for(i = 0; i < 1033; i++)
+     978:	89 f0                	mov    %esi,%eax
+        buf[i] = seq++;
+     97a:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     97d:	88 90 80 84 00 00    	mov    %dl,0x8480(%eax)
+      for(i = 0; i < 1033; i++)
+     983:	83 c0 01             	add    $0x1,%eax
+     986:	3d 09 04 00 00       	cmp    $0x409,%eax
+     98b:	75 ed                	jne    97a <pipe1+0xcf>
+        buf[i] = seq++;
+     98d:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     993:	83 ec 04             	sub    $0x4,%esp
+     996:	68 09 04 00 00       	push   $0x409
+     99b:	68 80 84 00 00       	push   $0x8480
+     9a0:	ff 75 e4             	push   -0x1c(%ebp)
+     9a3:	e8 99 2e 00 00       	call   3841 <write>
+     9a8:	83 c4 10             	add    $0x10,%esp
+     9ab:	3d 09 04 00 00       	cmp    $0x409,%eax
+     9b0:	75 0d                	jne    9bf <pipe1+0x114>
+    for(n = 0; n < 5; n++){
+     9b2:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     9b8:	75 be                	jne    978 <pipe1+0xcd>
+    exit();
+     9ba:	e8 62 2e 00 00       	call   3821 <exit>
+        printf(1, "pipe1 oops 1\n");
+     9bf:	83 ec 08             	sub    $0x8,%esp
+     9c2:	68 08 40 00 00       	push   $0x4008
+     9c7:	6a 01                	push   $0x1
+     9c9:	e8 fb 2f 00 00       	call   39c9 <printf>
+        exit();
+     9ce:	e8 4e 2e 00 00       	call   3821 <exit>
+      total += n;
+     9d3:	01 c7                	add    %eax,%edi
+      cc = cc * 2;
+     9d5:	01 f6                	add    %esi,%esi
+        cc = sizeof(buf);
+     9d7:	b8 00 20 00 00       	mov    $0x2000,%eax
+     9dc:	39 c6                	cmp    %eax,%esi
+     9de:	0f 47 f0             	cmova  %eax,%esi
+     9e1:	e9 0e ff ff ff       	jmp    8f4 <pipe1+0x49>
+    if(total != 5 * 1033){
+     9e6:	81 ff 2d 14 00 00    	cmp    $0x142d,%edi
+     9ec:	75 2e                	jne    a1c <pipe1+0x171>
+    close(fds[0]);
+     9ee:	83 ec 0c             	sub    $0xc,%esp
+     9f1:	ff 75 e0             	push   -0x20(%ebp)
+     9f4:	e8 50 2e 00 00       	call   3849 <close>
+    wait(0);
+     9f9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     a00:	e8 24 2e 00 00       	call   3829 <wait>
+  printf(1, "pipe1 ok\n");
+     a05:	83 c4 08             	add    $0x8,%esp
+     a08:	68 3b 40 00 00       	push   $0x403b
+     a0d:	6a 01                	push   $0x1
+     a0f:	e8 b5 2f 00 00       	call   39c9 <printf>
+     a14:	83 c4 10             	add    $0x10,%esp
+     a17:	e9 30 ff ff ff       	jmp    94c <pipe1+0xa1>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     a1c:	83 ec 04             	sub    $0x4,%esp
+     a1f:	57                   	push   %edi
+     a20:	68 24 40 00 00       	push   $0x4024
+     a25:	6a 01                	push   $0x1
+     a27:	e8 9d 2f 00 00       	call   39c9 <printf>
+      exit();
+     a2c:	e8 f0 2d 00 00       	call   3821 <exit>
+    printf(1, "fork() failed\n");
+     a31:	83 ec 08             	sub    $0x8,%esp
+     a34:	68 45 40 00 00       	push   $0x4045
+     a39:	6a 01                	push   $0x1
+     a3b:	e8 89 2f 00 00       	call   39c9 <printf>
+    exit();
+     a40:	e8 dc 2d 00 00       	call   3821 <exit>
+
+00000a45 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     a45:	55                   	push   %ebp
+     a46:	89 e5                	mov    %esp,%ebp
+     a48:	57                   	push   %edi
+     a49:	56                   	push   %esi
+     a4a:	53                   	push   %ebx
+     a4b:	83 ec 24             	sub    $0x24,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     a4e:	68 54 40 00 00       	push   $0x4054
+     a53:	6a 01                	push   $0x1
+     a55:	e8 6f 2f 00 00       	call   39c9 <printf>
+  pid1 = fork();
+     a5a:	e8 ba 2d 00 00       	call   3819 <fork>
+  if(pid1 == 0)
+     a5f:	83 c4 10             	add    $0x10,%esp
+     a62:	85 c0                	test   %eax,%eax
+     a64:	75 02                	jne    a68 <preempt+0x23>
+    for(;;)
+     a66:	eb fe                	jmp    a66 <preempt+0x21>
+     a68:	89 c3                	mov    %eax,%ebx
+      ;
+
+  pid2 = fork();
+     a6a:	e8 aa 2d 00 00       	call   3819 <fork>
+     a6f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     a71:	85 c0                	test   %eax,%eax
+     a73:	75 02                	jne    a77 <preempt+0x32>
+    for(;;)
+     a75:	eb fe                	jmp    a75 <preempt+0x30>
+      ;
+
+  pipe(pfds);
+     a77:	83 ec 0c             	sub    $0xc,%esp
+     a7a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a7d:	50                   	push   %eax
+     a7e:	e8 ae 2d 00 00       	call   3831 <pipe>
+  pid3 = fork();
+     a83:	e8 91 2d 00 00       	call   3819 <fork>
+     a88:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     a8a:	83 c4 10             	add    $0x10,%esp
+     a8d:	85 c0                	test   %eax,%eax
+     a8f:	75 49                	jne    ada <preempt+0x95>
+    close(pfds[0]);
+     a91:	83 ec 0c             	sub    $0xc,%esp
+     a94:	ff 75 e0             	push   -0x20(%ebp)
+     a97:	e8 ad 2d 00 00       	call   3849 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     a9c:	83 c4 0c             	add    $0xc,%esp
+     a9f:	6a 01                	push   $0x1
+     aa1:	68 19 46 00 00       	push   $0x4619
+     aa6:	ff 75 e4             	push   -0x1c(%ebp)
+     aa9:	e8 93 2d 00 00       	call   3841 <write>
+     aae:	83 c4 10             	add    $0x10,%esp
+     ab1:	83 f8 01             	cmp    $0x1,%eax
+     ab4:	75 10                	jne    ac6 <preempt+0x81>
+      printf(1, "preempt write error");
+    close(pfds[1]);
+     ab6:	83 ec 0c             	sub    $0xc,%esp
+     ab9:	ff 75 e4             	push   -0x1c(%ebp)
+     abc:	e8 88 2d 00 00       	call   3849 <close>
+     ac1:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     ac4:	eb fe                	jmp    ac4 <preempt+0x7f>
+      printf(1, "preempt write error");
+     ac6:	83 ec 08             	sub    $0x8,%esp
+     ac9:	68 5e 40 00 00       	push   $0x405e
+     ace:	6a 01                	push   $0x1
+     ad0:	e8 f4 2e 00 00       	call   39c9 <printf>
+     ad5:	83 c4 10             	add    $0x10,%esp
+     ad8:	eb dc                	jmp    ab6 <preempt+0x71>
+      ;
+  }
+
+  close(pfds[1]);
+     ada:	83 ec 0c             	sub    $0xc,%esp
+     add:	ff 75 e4             	push   -0x1c(%ebp)
+     ae0:	e8 64 2d 00 00       	call   3849 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     ae5:	83 c4 0c             	add    $0xc,%esp
+     ae8:	68 00 20 00 00       	push   $0x2000
+     aed:	68 80 84 00 00       	push   $0x8480
+     af2:	ff 75 e0             	push   -0x20(%ebp)
+     af5:	e8 3f 2d 00 00       	call   3839 <read>
+     afa:	83 c4 10             	add    $0x10,%esp
+     afd:	83 f8 01             	cmp    $0x1,%eax
+     b00:	74 1a                	je     b1c <preempt+0xd7>
+    printf(1, "preempt read error");
+     b02:	83 ec 08             	sub    $0x8,%esp
+     b05:	68 72 40 00 00       	push   $0x4072
+     b0a:	6a 01                	push   $0x1
+     b0c:	e8 b8 2e 00 00       	call   39c9 <printf>
+     b11:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+  wait(0);
+  wait(0);
+  wait(0);
+  printf(1, "preempt ok\n");
+}
+     b14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b17:	5b                   	pop    %ebx
+     b18:	5e                   	pop    %esi
+     b19:	5f                   	pop    %edi
+     b1a:	5d                   	pop    %ebp
+     b1b:	c3                   	ret
+  close(pfds[0]);
+     b1c:	83 ec 0c             	sub    $0xc,%esp
+     b1f:	ff 75 e0             	push   -0x20(%ebp)
+     b22:	e8 22 2d 00 00       	call   3849 <close>
+  printf(1, "kill... ");
+     b27:	83 c4 08             	add    $0x8,%esp
+     b2a:	68 85 40 00 00       	push   $0x4085
+     b2f:	6a 01                	push   $0x1
+     b31:	e8 93 2e 00 00       	call   39c9 <printf>
+  kill(pid1);
+     b36:	89 1c 24             	mov    %ebx,(%esp)
+     b39:	e8 13 2d 00 00       	call   3851 <kill>
+  kill(pid2);
+     b3e:	89 34 24             	mov    %esi,(%esp)
+     b41:	e8 0b 2d 00 00       	call   3851 <kill>
+  kill(pid3);
+     b46:	89 3c 24             	mov    %edi,(%esp)
+     b49:	e8 03 2d 00 00       	call   3851 <kill>
+  printf(1, "wait... ");
+     b4e:	83 c4 08             	add    $0x8,%esp
+     b51:	68 8e 40 00 00       	push   $0x408e
+     b56:	6a 01                	push   $0x1
+     b58:	e8 6c 2e 00 00       	call   39c9 <printf>
+  wait(0);
+     b5d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     b64:	e8 c0 2c 00 00       	call   3829 <wait>
+  wait(0);
+     b69:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     b70:	e8 b4 2c 00 00       	call   3829 <wait>
+  wait(0);
+     b75:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     b7c:	e8 a8 2c 00 00       	call   3829 <wait>
+  printf(1, "preempt ok\n");
+     b81:	83 c4 08             	add    $0x8,%esp
+     b84:	68 97 40 00 00       	push   $0x4097
+     b89:	6a 01                	push   $0x1
+     b8b:	e8 39 2e 00 00       	call   39c9 <printf>
+     b90:	83 c4 10             	add    $0x10,%esp
+     b93:	e9 7c ff ff ff       	jmp    b14 <preempt+0xcf>
+
+00000b98 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     b98:	55                   	push   %ebp
+     b99:	89 e5                	mov    %esp,%ebp
+     b9b:	56                   	push   %esi
+     b9c:	53                   	push   %ebx
+     b9d:	be 64 00 00 00       	mov    $0x64,%esi
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    pid = fork();
+     ba2:	e8 72 2c 00 00       	call   3819 <fork>
+     ba7:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     ba9:	85 c0                	test   %eax,%eax
+     bab:	78 2c                	js     bd9 <exitwait+0x41>
+      printf(1, "fork failed\n");
+      return;
+    }
+    if(pid){
+     bad:	74 57                	je     c06 <exitwait+0x6e>
+      if(wait(0) != pid){
+     baf:	83 ec 0c             	sub    $0xc,%esp
+     bb2:	6a 00                	push   $0x0
+     bb4:	e8 70 2c 00 00       	call   3829 <wait>
+     bb9:	83 c4 10             	add    $0x10,%esp
+     bbc:	39 d8                	cmp    %ebx,%eax
+     bbe:	75 32                	jne    bf2 <exitwait+0x5a>
+  for(i = 0; i < 100; i++){
+     bc0:	83 ee 01             	sub    $0x1,%esi
+     bc3:	75 dd                	jne    ba2 <exitwait+0xa>
+      }
+    } else {
+      exit();
+    }
+  }
+  printf(1, "exitwait ok\n");
+     bc5:	83 ec 08             	sub    $0x8,%esp
+     bc8:	68 b3 40 00 00       	push   $0x40b3
+     bcd:	6a 01                	push   $0x1
+     bcf:	e8 f5 2d 00 00       	call   39c9 <printf>
+     bd4:	83 c4 10             	add    $0x10,%esp
+     bd7:	eb 12                	jmp    beb <exitwait+0x53>
+      printf(1, "fork failed\n");
+     bd9:	83 ec 08             	sub    $0x8,%esp
+     bdc:	68 01 4c 00 00       	push   $0x4c01
+     be1:	6a 01                	push   $0x1
+     be3:	e8 e1 2d 00 00       	call   39c9 <printf>
+      return;
+     be8:	83 c4 10             	add    $0x10,%esp
+}
+     beb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bee:	5b                   	pop    %ebx
+     bef:	5e                   	pop    %esi
+     bf0:	5d                   	pop    %ebp
+     bf1:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+     bf2:	83 ec 08             	sub    $0x8,%esp
+     bf5:	68 a3 40 00 00       	push   $0x40a3
+     bfa:	6a 01                	push   $0x1
+     bfc:	e8 c8 2d 00 00       	call   39c9 <printf>
+        return;
+     c01:	83 c4 10             	add    $0x10,%esp
+     c04:	eb e5                	jmp    beb <exitwait+0x53>
+      exit();
+     c06:	e8 16 2c 00 00       	call   3821 <exit>
+
+00000c0b <mem>:
+
+void
+mem(void)
+{
+     c0b:	55                   	push   %ebp
+     c0c:	89 e5                	mov    %esp,%ebp
+     c0e:	56                   	push   %esi
+     c0f:	53                   	push   %ebx
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+     c10:	83 ec 08             	sub    $0x8,%esp
+     c13:	68 c0 40 00 00       	push   $0x40c0
+     c18:	6a 01                	push   $0x1
+     c1a:	e8 aa 2d 00 00       	call   39c9 <printf>
+  ppid = getpid();
+     c1f:	e8 7d 2c 00 00       	call   38a1 <getpid>
+     c24:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+     c26:	e8 ee 2b 00 00       	call   3819 <fork>
+     c2b:	83 c4 10             	add    $0x10,%esp
+    m1 = 0;
+     c2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if((pid = fork()) == 0){
+     c33:	85 c0                	test   %eax,%eax
+     c35:	74 18                	je     c4f <mem+0x44>
+    }
+    free(m1);
+    printf(1, "mem ok\n");
+    exit();
+  } else {
+    wait(0);
+     c37:	83 ec 0c             	sub    $0xc,%esp
+     c3a:	6a 00                	push   $0x0
+     c3c:	e8 e8 2b 00 00       	call   3829 <wait>
+  }
+}
+     c41:	83 c4 10             	add    $0x10,%esp
+     c44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c47:	5b                   	pop    %ebx
+     c48:	5e                   	pop    %esi
+     c49:	5d                   	pop    %ebp
+     c4a:	c3                   	ret
+      *(char**)m2 = m1;
+     c4b:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+     c4d:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+     c4f:	83 ec 0c             	sub    $0xc,%esp
+     c52:	68 11 27 00 00       	push   $0x2711
+     c57:	e8 93 2f 00 00       	call   3bef <malloc>
+     c5c:	83 c4 10             	add    $0x10,%esp
+     c5f:	85 c0                	test   %eax,%eax
+     c61:	75 e8                	jne    c4b <mem+0x40>
+    while(m1){
+     c63:	85 db                	test   %ebx,%ebx
+     c65:	74 14                	je     c7b <mem+0x70>
+      m2 = *(char**)m1;
+     c67:	89 d8                	mov    %ebx,%eax
+     c69:	8b 1b                	mov    (%ebx),%ebx
+      free(m1);
+     c6b:	83 ec 0c             	sub    $0xc,%esp
+     c6e:	50                   	push   %eax
+     c6f:	e8 12 2f 00 00       	call   3b86 <free>
+    while(m1){
+     c74:	83 c4 10             	add    $0x10,%esp
+     c77:	85 db                	test   %ebx,%ebx
+     c79:	75 ec                	jne    c67 <mem+0x5c>
+    m1 = malloc(1024*20);
+     c7b:	83 ec 0c             	sub    $0xc,%esp
+     c7e:	68 00 50 00 00       	push   $0x5000
+     c83:	e8 67 2f 00 00       	call   3bef <malloc>
+    if(m1 == 0){
+     c88:	83 c4 10             	add    $0x10,%esp
+     c8b:	85 c0                	test   %eax,%eax
+     c8d:	74 1d                	je     cac <mem+0xa1>
+    free(m1);
+     c8f:	83 ec 0c             	sub    $0xc,%esp
+     c92:	50                   	push   %eax
+     c93:	e8 ee 2e 00 00       	call   3b86 <free>
+    printf(1, "mem ok\n");
+     c98:	83 c4 08             	add    $0x8,%esp
+     c9b:	68 e4 40 00 00       	push   $0x40e4
+     ca0:	6a 01                	push   $0x1
+     ca2:	e8 22 2d 00 00       	call   39c9 <printf>
+    exit();
+     ca7:	e8 75 2b 00 00       	call   3821 <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+     cac:	83 ec 08             	sub    $0x8,%esp
+     caf:	68 ca 40 00 00       	push   $0x40ca
+     cb4:	6a 01                	push   $0x1
+     cb6:	e8 0e 2d 00 00       	call   39c9 <printf>
+      kill(ppid);
+     cbb:	89 34 24             	mov    %esi,(%esp)
+     cbe:	e8 8e 2b 00 00       	call   3851 <kill>
+      exit();
+     cc3:	e8 59 2b 00 00       	call   3821 <exit>
+
+00000cc8 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+     cc8:	55                   	push   %ebp
+     cc9:	89 e5                	mov    %esp,%ebp
+     ccb:	57                   	push   %edi
+     ccc:	56                   	push   %esi
+     ccd:	53                   	push   %ebx
+     cce:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+     cd1:	68 ec 40 00 00       	push   $0x40ec
+     cd6:	6a 01                	push   $0x1
+     cd8:	e8 ec 2c 00 00       	call   39c9 <printf>
+
+  unlink("sharedfd");
+     cdd:	c7 04 24 fb 40 00 00 	movl   $0x40fb,(%esp)
+     ce4:	e8 88 2b 00 00       	call   3871 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     ce9:	83 c4 08             	add    $0x8,%esp
+     cec:	68 02 02 00 00       	push   $0x202
+     cf1:	68 fb 40 00 00       	push   $0x40fb
+     cf6:	e8 66 2b 00 00       	call   3861 <open>
+  if(fd < 0){
+     cfb:	83 c4 10             	add    $0x10,%esp
+     cfe:	85 c0                	test   %eax,%eax
+     d00:	78 4a                	js     d4c <sharedfd+0x84>
+     d02:	89 c6                	mov    %eax,%esi
+    printf(1, "fstests: cannot open sharedfd for writing");
+    return;
+  }
+  pid = fork();
+     d04:	e8 10 2b 00 00       	call   3819 <fork>
+     d09:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     d0c:	83 f8 01             	cmp    $0x1,%eax
+     d0f:	19 c0                	sbb    %eax,%eax
+     d11:	83 e0 f3             	and    $0xfffffff3,%eax
+     d14:	83 c0 70             	add    $0x70,%eax
+     d17:	83 ec 04             	sub    $0x4,%esp
+     d1a:	6a 0a                	push   $0xa
+     d1c:	50                   	push   %eax
+     d1d:	8d 45 de             	lea    -0x22(%ebp),%eax
+     d20:	50                   	push   %eax
+     d21:	e8 a8 29 00 00       	call   36ce <memset>
+     d26:	83 c4 10             	add    $0x10,%esp
+     d29:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  for(i = 0; i < 1000; i++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     d2e:	8d 7d de             	lea    -0x22(%ebp),%edi
+     d31:	83 ec 04             	sub    $0x4,%esp
+     d34:	6a 0a                	push   $0xa
+     d36:	57                   	push   %edi
+     d37:	56                   	push   %esi
+     d38:	e8 04 2b 00 00       	call   3841 <write>
+     d3d:	83 c4 10             	add    $0x10,%esp
+     d40:	83 f8 0a             	cmp    $0xa,%eax
+     d43:	75 1e                	jne    d63 <sharedfd+0x9b>
+  for(i = 0; i < 1000; i++){
+     d45:	83 eb 01             	sub    $0x1,%ebx
+     d48:	75 e7                	jne    d31 <sharedfd+0x69>
+     d4a:	eb 29                	jmp    d75 <sharedfd+0xad>
+    printf(1, "fstests: cannot open sharedfd for writing");
+     d4c:	83 ec 08             	sub    $0x8,%esp
+     d4f:	68 c0 4d 00 00       	push   $0x4dc0
+     d54:	6a 01                	push   $0x1
+     d56:	e8 6e 2c 00 00       	call   39c9 <printf>
+    return;
+     d5b:	83 c4 10             	add    $0x10,%esp
+     d5e:	e9 e2 00 00 00       	jmp    e45 <sharedfd+0x17d>
+      printf(1, "fstests: write sharedfd failed\n");
+     d63:	83 ec 08             	sub    $0x8,%esp
+     d66:	68 ec 4d 00 00       	push   $0x4dec
+     d6b:	6a 01                	push   $0x1
+     d6d:	e8 57 2c 00 00       	call   39c9 <printf>
+      break;
+     d72:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  if(pid == 0)
+     d75:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     d79:	74 55                	je     dd0 <sharedfd+0x108>
+    exit();
+  else
+    wait(0);
+     d7b:	83 ec 0c             	sub    $0xc,%esp
+     d7e:	6a 00                	push   $0x0
+     d80:	e8 a4 2a 00 00       	call   3829 <wait>
+  close(fd);
+     d85:	89 34 24             	mov    %esi,(%esp)
+     d88:	e8 bc 2a 00 00       	call   3849 <close>
+  fd = open("sharedfd", 0);
+     d8d:	83 c4 08             	add    $0x8,%esp
+     d90:	6a 00                	push   $0x0
+     d92:	68 fb 40 00 00       	push   $0x40fb
+     d97:	e8 c5 2a 00 00       	call   3861 <open>
+  if(fd < 0){
+     d9c:	83 c4 10             	add    $0x10,%esp
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    return;
+  }
+  nc = np = 0;
+     d9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     da4:	bf 00 00 00 00       	mov    $0x0,%edi
+     da9:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  if(fd < 0){
+     dac:	85 c0                	test   %eax,%eax
+     dae:	78 25                	js     dd5 <sharedfd+0x10d>
+     db0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     db3:	83 ec 04             	sub    $0x4,%esp
+     db6:	6a 0a                	push   $0xa
+     db8:	8d 45 de             	lea    -0x22(%ebp),%eax
+     dbb:	50                   	push   %eax
+     dbc:	ff 75 d4             	push   -0x2c(%ebp)
+     dbf:	e8 75 2a 00 00       	call   3839 <read>
+     dc4:	83 c4 10             	add    $0x10,%esp
+     dc7:	85 c0                	test   %eax,%eax
+     dc9:	7e 3d                	jle    e08 <sharedfd+0x140>
+     dcb:	8d 45 de             	lea    -0x22(%ebp),%eax
+     dce:	eb 2b                	jmp    dfb <sharedfd+0x133>
+    exit();
+     dd0:	e8 4c 2a 00 00       	call   3821 <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     dd5:	83 ec 08             	sub    $0x8,%esp
+     dd8:	68 0c 4e 00 00       	push   $0x4e0c
+     ddd:	6a 01                	push   $0x1
+     ddf:	e8 e5 2b 00 00       	call   39c9 <printf>
+    return;
+     de4:	83 c4 10             	add    $0x10,%esp
+     de7:	eb 5c                	jmp    e45 <sharedfd+0x17d>
+    for(i = 0; i < sizeof(buf); i++){
+      if(buf[i] == 'c')
+        nc++;
+      if(buf[i] == 'p')
+        np++;
+     de9:	80 fa 70             	cmp    $0x70,%dl
+     dec:	0f 94 c2             	sete   %dl
+     def:	0f b6 d2             	movzbl %dl,%edx
+     df2:	01 d3                	add    %edx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     df4:	83 c0 01             	add    $0x1,%eax
+     df7:	39 f0                	cmp    %esi,%eax
+     df9:	74 b8                	je     db3 <sharedfd+0xeb>
+      if(buf[i] == 'c')
+     dfb:	0f b6 10             	movzbl (%eax),%edx
+     dfe:	80 fa 63             	cmp    $0x63,%dl
+     e01:	75 e6                	jne    de9 <sharedfd+0x121>
+        nc++;
+     e03:	83 c7 01             	add    $0x1,%edi
+      if(buf[i] == 'p')
+     e06:	eb ec                	jmp    df4 <sharedfd+0x12c>
+    }
+  }
+  close(fd);
+     e08:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     e0b:	83 ec 0c             	sub    $0xc,%esp
+     e0e:	51                   	push   %ecx
+     e0f:	e8 35 2a 00 00       	call   3849 <close>
+  unlink("sharedfd");
+     e14:	c7 04 24 fb 40 00 00 	movl   $0x40fb,(%esp)
+     e1b:	e8 51 2a 00 00       	call   3871 <unlink>
+  if(nc == 10000 && np == 10000){
+     e20:	83 c4 10             	add    $0x10,%esp
+     e23:	81 ff 10 27 00 00    	cmp    $0x2710,%edi
+     e29:	75 22                	jne    e4d <sharedfd+0x185>
+     e2b:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     e31:	75 1a                	jne    e4d <sharedfd+0x185>
+    printf(1, "sharedfd ok\n");
+     e33:	83 ec 08             	sub    $0x8,%esp
+     e36:	68 04 41 00 00       	push   $0x4104
+     e3b:	6a 01                	push   $0x1
+     e3d:	e8 87 2b 00 00       	call   39c9 <printf>
+     e42:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    exit();
+  }
+}
+     e45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e48:	5b                   	pop    %ebx
+     e49:	5e                   	pop    %esi
+     e4a:	5f                   	pop    %edi
+     e4b:	5d                   	pop    %ebp
+     e4c:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     e4d:	53                   	push   %ebx
+     e4e:	57                   	push   %edi
+     e4f:	68 11 41 00 00       	push   $0x4111
+     e54:	6a 01                	push   $0x1
+     e56:	e8 6e 2b 00 00       	call   39c9 <printf>
+    exit();
+     e5b:	e8 c1 29 00 00       	call   3821 <exit>
+
+00000e60 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	57                   	push   %edi
+     e64:	56                   	push   %esi
+     e65:	53                   	push   %ebx
+     e66:	83 ec 34             	sub    $0x34,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     e69:	c7 45 d8 26 41 00 00 	movl   $0x4126,-0x28(%ebp)
+     e70:	c7 45 dc 6f 42 00 00 	movl   $0x426f,-0x24(%ebp)
+     e77:	c7 45 e0 73 42 00 00 	movl   $0x4273,-0x20(%ebp)
+     e7e:	c7 45 e4 29 41 00 00 	movl   $0x4129,-0x1c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+     e85:	68 2c 41 00 00       	push   $0x412c
+     e8a:	6a 01                	push   $0x1
+     e8c:	e8 38 2b 00 00       	call   39c9 <printf>
+     e91:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+     e94:	bb 00 00 00 00       	mov    $0x0,%ebx
+    fname = names[pi];
+     e99:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+     e9d:	83 ec 0c             	sub    $0xc,%esp
+     ea0:	56                   	push   %esi
+     ea1:	e8 cb 29 00 00       	call   3871 <unlink>
+
+    pid = fork();
+     ea6:	e8 6e 29 00 00       	call   3819 <fork>
+    if(pid < 0){
+     eab:	83 c4 10             	add    $0x10,%esp
+     eae:	85 c0                	test   %eax,%eax
+     eb0:	78 45                	js     ef7 <fourfiles+0x97>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+     eb2:	74 57                	je     f0b <fourfiles+0xab>
+  for(pi = 0; pi < 4; pi++){
+     eb4:	83 c3 01             	add    $0x1,%ebx
+     eb7:	83 fb 04             	cmp    $0x4,%ebx
+     eba:	75 dd                	jne    e99 <fourfiles+0x39>
+      exit();
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    wait(0);
+     ebc:	83 ec 0c             	sub    $0xc,%esp
+     ebf:	6a 00                	push   $0x0
+     ec1:	e8 63 29 00 00       	call   3829 <wait>
+     ec6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     ecd:	e8 57 29 00 00       	call   3829 <wait>
+     ed2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     ed9:	e8 4b 29 00 00       	call   3829 <wait>
+     ede:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     ee5:	e8 3f 29 00 00       	call   3829 <wait>
+     eea:	83 c4 10             	add    $0x10,%esp
+     eed:	bb 30 00 00 00       	mov    $0x30,%ebx
+     ef2:	e9 0c 01 00 00       	jmp    1003 <fourfiles+0x1a3>
+      printf(1, "fork failed\n");
+     ef7:	83 ec 08             	sub    $0x8,%esp
+     efa:	68 01 4c 00 00       	push   $0x4c01
+     eff:	6a 01                	push   $0x1
+     f01:	e8 c3 2a 00 00       	call   39c9 <printf>
+      exit();
+     f06:	e8 16 29 00 00       	call   3821 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+     f0b:	83 ec 08             	sub    $0x8,%esp
+     f0e:	68 02 02 00 00       	push   $0x202
+     f13:	56                   	push   %esi
+     f14:	e8 48 29 00 00       	call   3861 <open>
+     f19:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+     f1b:	83 c4 10             	add    $0x10,%esp
+     f1e:	85 c0                	test   %eax,%eax
+     f20:	78 45                	js     f67 <fourfiles+0x107>
+      memset(buf, '0'+pi, 512);
+     f22:	83 ec 04             	sub    $0x4,%esp
+     f25:	68 00 02 00 00       	push   $0x200
+     f2a:	83 c3 30             	add    $0x30,%ebx
+     f2d:	53                   	push   %ebx
+     f2e:	68 80 84 00 00       	push   $0x8480
+     f33:	e8 96 27 00 00       	call   36ce <memset>
+     f38:	83 c4 10             	add    $0x10,%esp
+     f3b:	bb 0c 00 00 00       	mov    $0xc,%ebx
+        if((n = write(fd, buf, 500)) != 500){
+     f40:	83 ec 04             	sub    $0x4,%esp
+     f43:	68 f4 01 00 00       	push   $0x1f4
+     f48:	68 80 84 00 00       	push   $0x8480
+     f4d:	56                   	push   %esi
+     f4e:	e8 ee 28 00 00       	call   3841 <write>
+     f53:	83 c4 10             	add    $0x10,%esp
+     f56:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     f5b:	75 1e                	jne    f7b <fourfiles+0x11b>
+      for(i = 0; i < 12; i++){
+     f5d:	83 eb 01             	sub    $0x1,%ebx
+     f60:	75 de                	jne    f40 <fourfiles+0xe0>
+      exit();
+     f62:	e8 ba 28 00 00       	call   3821 <exit>
+        printf(1, "create failed\n");
+     f67:	83 ec 08             	sub    $0x8,%esp
+     f6a:	68 c7 43 00 00       	push   $0x43c7
+     f6f:	6a 01                	push   $0x1
+     f71:	e8 53 2a 00 00       	call   39c9 <printf>
+        exit();
+     f76:	e8 a6 28 00 00       	call   3821 <exit>
+          printf(1, "write failed %d\n", n);
+     f7b:	83 ec 04             	sub    $0x4,%esp
+     f7e:	50                   	push   %eax
+     f7f:	68 3c 41 00 00       	push   $0x413c
+     f84:	6a 01                	push   $0x1
+     f86:	e8 3e 2a 00 00       	call   39c9 <printf>
+          exit();
+     f8b:	e8 91 28 00 00       	call   3821 <exit>
+    fd = open(fname, 0);
+    total = 0;
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+      for(j = 0; j < n; j++){
+        if(buf[j] != '0'+i){
+          printf(1, "wrong char\n");
+     f90:	83 ec 08             	sub    $0x8,%esp
+     f93:	68 4d 41 00 00       	push   $0x414d
+     f98:	6a 01                	push   $0x1
+     f9a:	e8 2a 2a 00 00       	call   39c9 <printf>
+          exit();
+     f9f:	e8 7d 28 00 00       	call   3821 <exit>
+        }
+      }
+      total += n;
+     fa4:	01 d6                	add    %edx,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     fa6:	83 ec 04             	sub    $0x4,%esp
+     fa9:	68 00 20 00 00       	push   $0x2000
+     fae:	68 80 84 00 00       	push   $0x8480
+     fb3:	57                   	push   %edi
+     fb4:	e8 80 28 00 00       	call   3839 <read>
+     fb9:	83 c4 10             	add    $0x10,%esp
+     fbc:	85 c0                	test   %eax,%eax
+     fbe:	7e 19                	jle    fd9 <fourfiles+0x179>
+      for(j = 0; j < n; j++){
+     fc0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if(buf[j] != '0'+i){
+     fc5:	0f be 8a 80 84 00 00 	movsbl 0x8480(%edx),%ecx
+     fcc:	39 d9                	cmp    %ebx,%ecx
+     fce:	75 c0                	jne    f90 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+     fd0:	83 c2 01             	add    $0x1,%edx
+     fd3:	39 d0                	cmp    %edx,%eax
+     fd5:	75 ee                	jne    fc5 <fourfiles+0x165>
+     fd7:	eb cb                	jmp    fa4 <fourfiles+0x144>
+    }
+    close(fd);
+     fd9:	83 ec 0c             	sub    $0xc,%esp
+     fdc:	57                   	push   %edi
+     fdd:	e8 67 28 00 00       	call   3849 <close>
+    if(total != 12*500){
+     fe2:	83 c4 10             	add    $0x10,%esp
+     fe5:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+     feb:	75 37                	jne    1024 <fourfiles+0x1c4>
+      printf(1, "wrong length %d\n", total);
+      exit();
+    }
+    unlink(fname);
+     fed:	83 ec 0c             	sub    $0xc,%esp
+     ff0:	ff 75 d4             	push   -0x2c(%ebp)
+     ff3:	e8 79 28 00 00       	call   3871 <unlink>
+  for(i = 0; i < 2; i++){
+     ff8:	83 c3 01             	add    $0x1,%ebx
+     ffb:	83 c4 10             	add    $0x10,%esp
+     ffe:	83 fb 32             	cmp    $0x32,%ebx
+    1001:	74 36                	je     1039 <fourfiles+0x1d9>
+    fname = names[i];
+    1003:	8b 84 9d 18 ff ff ff 	mov    -0xe8(%ebp,%ebx,4),%eax
+    100a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    fd = open(fname, 0);
+    100d:	83 ec 08             	sub    $0x8,%esp
+    1010:	6a 00                	push   $0x0
+    1012:	50                   	push   %eax
+    1013:	e8 49 28 00 00       	call   3861 <open>
+    1018:	89 c7                	mov    %eax,%edi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    101a:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+    101d:	be 00 00 00 00       	mov    $0x0,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1022:	eb 82                	jmp    fa6 <fourfiles+0x146>
+      printf(1, "wrong length %d\n", total);
+    1024:	83 ec 04             	sub    $0x4,%esp
+    1027:	56                   	push   %esi
+    1028:	68 59 41 00 00       	push   $0x4159
+    102d:	6a 01                	push   $0x1
+    102f:	e8 95 29 00 00       	call   39c9 <printf>
+      exit();
+    1034:	e8 e8 27 00 00       	call   3821 <exit>
+  }
+
+  printf(1, "fourfiles ok\n");
+    1039:	83 ec 08             	sub    $0x8,%esp
+    103c:	68 6a 41 00 00       	push   $0x416a
+    1041:	6a 01                	push   $0x1
+    1043:	e8 81 29 00 00       	call   39c9 <printf>
+}
+    1048:	83 c4 10             	add    $0x10,%esp
+    104b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    104e:	5b                   	pop    %ebx
+    104f:	5e                   	pop    %esi
+    1050:	5f                   	pop    %edi
+    1051:	5d                   	pop    %ebp
+    1052:	c3                   	ret
+
+00001053 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1053:	55                   	push   %ebp
+    1054:	89 e5                	mov    %esp,%ebp
+    1056:	57                   	push   %edi
+    1057:	56                   	push   %esi
+    1058:	53                   	push   %ebx
+    1059:	83 ec 44             	sub    $0x44,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    105c:	68 78 41 00 00       	push   $0x4178
+    1061:	6a 01                	push   $0x1
+    1063:	e8 61 29 00 00       	call   39c9 <printf>
+    1068:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    106b:	be 00 00 00 00       	mov    $0x0,%esi
+    pid = fork();
+    1070:	e8 a4 27 00 00       	call   3819 <fork>
+    if(pid < 0){
+    1075:	85 c0                	test   %eax,%eax
+    1077:	78 52                	js     10cb <createdelete+0x78>
+      printf(1, "fork failed\n");
+      exit();
+    }
+
+    if(pid == 0){
+    1079:	74 64                	je     10df <createdelete+0x8c>
+  for(pi = 0; pi < 4; pi++){
+    107b:	83 c6 01             	add    $0x1,%esi
+    107e:	83 fe 04             	cmp    $0x4,%esi
+    1081:	75 ed                	jne    1070 <createdelete+0x1d>
+      exit();
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    wait(0);
+    1083:	83 ec 0c             	sub    $0xc,%esp
+    1086:	6a 00                	push   $0x0
+    1088:	e8 9c 27 00 00       	call   3829 <wait>
+    108d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    1094:	e8 90 27 00 00       	call   3829 <wait>
+    1099:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    10a0:	e8 84 27 00 00       	call   3829 <wait>
+    10a5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    10ac:	e8 78 27 00 00       	call   3829 <wait>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    10b1:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    10b5:	83 c4 10             	add    $0x10,%esp
+    10b8:	c6 45 c7 30          	movb   $0x30,-0x39(%ebp)
+    10bc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  for(i = 0; i < N; i++){
+    10c1:	bf 00 00 00 00       	mov    $0x0,%edi
+    10c6:	e9 39 01 00 00       	jmp    1204 <createdelete+0x1b1>
+      printf(1, "fork failed\n");
+    10cb:	83 ec 08             	sub    $0x8,%esp
+    10ce:	68 01 4c 00 00       	push   $0x4c01
+    10d3:	6a 01                	push   $0x1
+    10d5:	e8 ef 28 00 00       	call   39c9 <printf>
+      exit();
+    10da:	e8 42 27 00 00       	call   3821 <exit>
+      name[0] = 'p' + pi;
+    10df:	89 c3                	mov    %eax,%ebx
+    10e1:	8d 46 70             	lea    0x70(%esi),%eax
+    10e4:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    10e7:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    10eb:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    10ee:	eb 1c                	jmp    110c <createdelete+0xb9>
+          printf(1, "create failed\n");
+    10f0:	83 ec 08             	sub    $0x8,%esp
+    10f3:	68 c7 43 00 00       	push   $0x43c7
+    10f8:	6a 01                	push   $0x1
+    10fa:	e8 ca 28 00 00       	call   39c9 <printf>
+          exit();
+    10ff:	e8 1d 27 00 00       	call   3821 <exit>
+      for(i = 0; i < N; i++){
+    1104:	83 c3 01             	add    $0x1,%ebx
+    1107:	83 fb 14             	cmp    $0x14,%ebx
+    110a:	74 63                	je     116f <createdelete+0x11c>
+        name[1] = '0' + i;
+    110c:	8d 43 30             	lea    0x30(%ebx),%eax
+    110f:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1112:	83 ec 08             	sub    $0x8,%esp
+    1115:	68 02 02 00 00       	push   $0x202
+    111a:	56                   	push   %esi
+    111b:	e8 41 27 00 00       	call   3861 <open>
+        if(fd < 0){
+    1120:	83 c4 10             	add    $0x10,%esp
+    1123:	85 c0                	test   %eax,%eax
+    1125:	78 c9                	js     10f0 <createdelete+0x9d>
+        close(fd);
+    1127:	83 ec 0c             	sub    $0xc,%esp
+    112a:	50                   	push   %eax
+    112b:	e8 19 27 00 00       	call   3849 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1130:	83 c4 10             	add    $0x10,%esp
+    1133:	85 db                	test   %ebx,%ebx
+    1135:	7e cd                	jle    1104 <createdelete+0xb1>
+    1137:	f6 c3 01             	test   $0x1,%bl
+    113a:	75 c8                	jne    1104 <createdelete+0xb1>
+          name[1] = '0' + (i / 2);
+    113c:	89 d8                	mov    %ebx,%eax
+    113e:	c1 e8 1f             	shr    $0x1f,%eax
+    1141:	01 d8                	add    %ebx,%eax
+    1143:	d1 f8                	sar    %eax
+    1145:	83 c0 30             	add    $0x30,%eax
+    1148:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    114b:	83 ec 0c             	sub    $0xc,%esp
+    114e:	56                   	push   %esi
+    114f:	e8 1d 27 00 00       	call   3871 <unlink>
+    1154:	83 c4 10             	add    $0x10,%esp
+    1157:	85 c0                	test   %eax,%eax
+    1159:	79 a9                	jns    1104 <createdelete+0xb1>
+            printf(1, "unlink failed\n");
+    115b:	83 ec 08             	sub    $0x8,%esp
+    115e:	68 79 3d 00 00       	push   $0x3d79
+    1163:	6a 01                	push   $0x1
+    1165:	e8 5f 28 00 00       	call   39c9 <printf>
+            exit();
+    116a:	e8 b2 26 00 00       	call   3821 <exit>
+      exit();
+    116f:	e8 ad 26 00 00       	call   3821 <exit>
+      name[1] = '0' + i;
+      fd = open(name, 0);
+      if((i == 0 || i >= N/2) && fd < 0){
+        printf(1, "oops createdelete %s didn't exist\n", name);
+        exit();
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1174:	83 fe 08             	cmp    $0x8,%esi
+    1177:	76 52                	jbe    11cb <createdelete+0x178>
+        printf(1, "oops createdelete %s did exist\n", name);
+        exit();
+      }
+      if(fd >= 0)
+    1179:	85 c0                	test   %eax,%eax
+    117b:	79 6a                	jns    11e7 <createdelete+0x194>
+    for(pi = 0; pi < 4; pi++){
+    117d:	83 c3 01             	add    $0x1,%ebx
+    1180:	80 fb 74             	cmp    $0x74,%bl
+    1183:	74 70                	je     11f5 <createdelete+0x1a2>
+      name[0] = 'p' + pi;
+    1185:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    1188:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    118c:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    118f:	83 ec 08             	sub    $0x8,%esp
+    1192:	6a 00                	push   $0x0
+    1194:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1197:	50                   	push   %eax
+    1198:	e8 c4 26 00 00       	call   3861 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    119d:	83 c4 10             	add    $0x10,%esp
+    11a0:	85 ff                	test   %edi,%edi
+    11a2:	0f 94 c2             	sete   %dl
+    11a5:	83 ff 09             	cmp    $0x9,%edi
+    11a8:	0f 9f c1             	setg   %cl
+    11ab:	08 ca                	or     %cl,%dl
+    11ad:	74 c5                	je     1174 <createdelete+0x121>
+    11af:	85 c0                	test   %eax,%eax
+    11b1:	79 c1                	jns    1174 <createdelete+0x121>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    11b3:	83 ec 04             	sub    $0x4,%esp
+    11b6:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    11b9:	50                   	push   %eax
+    11ba:	68 38 4e 00 00       	push   $0x4e38
+    11bf:	6a 01                	push   $0x1
+    11c1:	e8 03 28 00 00       	call   39c9 <printf>
+        exit();
+    11c6:	e8 56 26 00 00       	call   3821 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    11cb:	85 c0                	test   %eax,%eax
+    11cd:	78 ae                	js     117d <createdelete+0x12a>
+        printf(1, "oops createdelete %s did exist\n", name);
+    11cf:	83 ec 04             	sub    $0x4,%esp
+    11d2:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    11d5:	50                   	push   %eax
+    11d6:	68 5c 4e 00 00       	push   $0x4e5c
+    11db:	6a 01                	push   $0x1
+    11dd:	e8 e7 27 00 00       	call   39c9 <printf>
+        exit();
+    11e2:	e8 3a 26 00 00       	call   3821 <exit>
+        close(fd);
+    11e7:	83 ec 0c             	sub    $0xc,%esp
+    11ea:	50                   	push   %eax
+    11eb:	e8 59 26 00 00       	call   3849 <close>
+    11f0:	83 c4 10             	add    $0x10,%esp
+    11f3:	eb 88                	jmp    117d <createdelete+0x12a>
+  for(i = 0; i < N; i++){
+    11f5:	83 c7 01             	add    $0x1,%edi
+    11f8:	83 c6 01             	add    $0x1,%esi
+    11fb:	80 45 c7 01          	addb   $0x1,-0x39(%ebp)
+    11ff:	83 ff 14             	cmp    $0x14,%edi
+    1202:	74 3b                	je     123f <createdelete+0x1ec>
+  for(pi = 0; pi < 4; pi++){
+    1204:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1209:	e9 77 ff ff ff       	jmp    1185 <createdelete+0x132>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    120e:	83 c6 01             	add    $0x1,%esi
+    1211:	83 c7 01             	add    $0x1,%edi
+    1214:	89 f0                	mov    %esi,%eax
+    1216:	3c 84                	cmp    $0x84,%al
+    1218:	74 31                	je     124b <createdelete+0x1f8>
+  for(i = 0; i < N; i++){
+    121a:	bb 04 00 00 00       	mov    $0x4,%ebx
+    for(pi = 0; pi < 4; pi++){
+      name[0] = 'p' + i;
+    121f:	89 f0                	mov    %esi,%eax
+    1221:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1224:	89 f8                	mov    %edi,%eax
+    1226:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    1229:	83 ec 0c             	sub    $0xc,%esp
+    122c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    122f:	50                   	push   %eax
+    1230:	e8 3c 26 00 00       	call   3871 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1235:	83 c4 10             	add    $0x10,%esp
+    1238:	83 eb 01             	sub    $0x1,%ebx
+    123b:	75 e2                	jne    121f <createdelete+0x1cc>
+    123d:	eb cf                	jmp    120e <createdelete+0x1bb>
+    123f:	bf 30 00 00 00       	mov    $0x30,%edi
+    1244:	be 70 00 00 00       	mov    $0x70,%esi
+    1249:	eb cf                	jmp    121a <createdelete+0x1c7>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    124b:	83 ec 08             	sub    $0x8,%esp
+    124e:	68 8b 41 00 00       	push   $0x418b
+    1253:	6a 01                	push   $0x1
+    1255:	e8 6f 27 00 00       	call   39c9 <printf>
+}
+    125a:	83 c4 10             	add    $0x10,%esp
+    125d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1260:	5b                   	pop    %ebx
+    1261:	5e                   	pop    %esi
+    1262:	5f                   	pop    %edi
+    1263:	5d                   	pop    %ebp
+    1264:	c3                   	ret
+
+00001265 <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    1265:	55                   	push   %ebp
+    1266:	89 e5                	mov    %esp,%ebp
+    1268:	56                   	push   %esi
+    1269:	53                   	push   %ebx
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    126a:	83 ec 08             	sub    $0x8,%esp
+    126d:	68 9c 41 00 00       	push   $0x419c
+    1272:	6a 01                	push   $0x1
+    1274:	e8 50 27 00 00       	call   39c9 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1279:	83 c4 08             	add    $0x8,%esp
+    127c:	68 02 02 00 00       	push   $0x202
+    1281:	68 ad 41 00 00       	push   $0x41ad
+    1286:	e8 d6 25 00 00       	call   3861 <open>
+  if(fd < 0){
+    128b:	83 c4 10             	add    $0x10,%esp
+    128e:	85 c0                	test   %eax,%eax
+    1290:	0f 88 f0 00 00 00    	js     1386 <unlinkread+0x121>
+    1296:	89 c3                	mov    %eax,%ebx
+    printf(1, "create unlinkread failed\n");
+    exit();
+  }
+  write(fd, "hello", 5);
+    1298:	83 ec 04             	sub    $0x4,%esp
+    129b:	6a 05                	push   $0x5
+    129d:	68 d2 41 00 00       	push   $0x41d2
+    12a2:	50                   	push   %eax
+    12a3:	e8 99 25 00 00       	call   3841 <write>
+  close(fd);
+    12a8:	89 1c 24             	mov    %ebx,(%esp)
+    12ab:	e8 99 25 00 00       	call   3849 <close>
+
+  fd = open("unlinkread", O_RDWR);
+    12b0:	83 c4 08             	add    $0x8,%esp
+    12b3:	6a 02                	push   $0x2
+    12b5:	68 ad 41 00 00       	push   $0x41ad
+    12ba:	e8 a2 25 00 00       	call   3861 <open>
+    12bf:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    12c1:	83 c4 10             	add    $0x10,%esp
+    12c4:	85 c0                	test   %eax,%eax
+    12c6:	0f 88 ce 00 00 00    	js     139a <unlinkread+0x135>
+    printf(1, "open unlinkread failed\n");
+    exit();
+  }
+  if(unlink("unlinkread") != 0){
+    12cc:	83 ec 0c             	sub    $0xc,%esp
+    12cf:	68 ad 41 00 00       	push   $0x41ad
+    12d4:	e8 98 25 00 00       	call   3871 <unlink>
+    12d9:	83 c4 10             	add    $0x10,%esp
+    12dc:	85 c0                	test   %eax,%eax
+    12de:	0f 85 ca 00 00 00    	jne    13ae <unlinkread+0x149>
+    printf(1, "unlink unlinkread failed\n");
+    exit();
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    12e4:	83 ec 08             	sub    $0x8,%esp
+    12e7:	68 02 02 00 00       	push   $0x202
+    12ec:	68 ad 41 00 00       	push   $0x41ad
+    12f1:	e8 6b 25 00 00       	call   3861 <open>
+    12f6:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    12f8:	83 c4 0c             	add    $0xc,%esp
+    12fb:	6a 03                	push   $0x3
+    12fd:	68 0a 42 00 00       	push   $0x420a
+    1302:	50                   	push   %eax
+    1303:	e8 39 25 00 00       	call   3841 <write>
+  close(fd1);
+    1308:	89 34 24             	mov    %esi,(%esp)
+    130b:	e8 39 25 00 00       	call   3849 <close>
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1310:	83 c4 0c             	add    $0xc,%esp
+    1313:	68 00 20 00 00       	push   $0x2000
+    1318:	68 80 84 00 00       	push   $0x8480
+    131d:	53                   	push   %ebx
+    131e:	e8 16 25 00 00       	call   3839 <read>
+    1323:	83 c4 10             	add    $0x10,%esp
+    1326:	83 f8 05             	cmp    $0x5,%eax
+    1329:	0f 85 93 00 00 00    	jne    13c2 <unlinkread+0x15d>
+    printf(1, "unlinkread read failed");
+    exit();
+  }
+  if(buf[0] != 'h'){
+    132f:	80 3d 80 84 00 00 68 	cmpb   $0x68,0x8480
+    1336:	0f 85 9a 00 00 00    	jne    13d6 <unlinkread+0x171>
+    printf(1, "unlinkread wrong data\n");
+    exit();
+  }
+  if(write(fd, buf, 10) != 10){
+    133c:	83 ec 04             	sub    $0x4,%esp
+    133f:	6a 0a                	push   $0xa
+    1341:	68 80 84 00 00       	push   $0x8480
+    1346:	53                   	push   %ebx
+    1347:	e8 f5 24 00 00       	call   3841 <write>
+    134c:	83 c4 10             	add    $0x10,%esp
+    134f:	83 f8 0a             	cmp    $0xa,%eax
+    1352:	0f 85 92 00 00 00    	jne    13ea <unlinkread+0x185>
+    printf(1, "unlinkread write failed\n");
+    exit();
+  }
+  close(fd);
+    1358:	83 ec 0c             	sub    $0xc,%esp
+    135b:	53                   	push   %ebx
+    135c:	e8 e8 24 00 00       	call   3849 <close>
+  unlink("unlinkread");
+    1361:	c7 04 24 ad 41 00 00 	movl   $0x41ad,(%esp)
+    1368:	e8 04 25 00 00       	call   3871 <unlink>
+  printf(1, "unlinkread ok\n");
+    136d:	83 c4 08             	add    $0x8,%esp
+    1370:	68 55 42 00 00       	push   $0x4255
+    1375:	6a 01                	push   $0x1
+    1377:	e8 4d 26 00 00       	call   39c9 <printf>
+}
+    137c:	83 c4 10             	add    $0x10,%esp
+    137f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1382:	5b                   	pop    %ebx
+    1383:	5e                   	pop    %esi
+    1384:	5d                   	pop    %ebp
+    1385:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1386:	83 ec 08             	sub    $0x8,%esp
+    1389:	68 b8 41 00 00       	push   $0x41b8
+    138e:	6a 01                	push   $0x1
+    1390:	e8 34 26 00 00       	call   39c9 <printf>
+    exit();
+    1395:	e8 87 24 00 00       	call   3821 <exit>
+    printf(1, "open unlinkread failed\n");
+    139a:	83 ec 08             	sub    $0x8,%esp
+    139d:	68 d8 41 00 00       	push   $0x41d8
+    13a2:	6a 01                	push   $0x1
+    13a4:	e8 20 26 00 00       	call   39c9 <printf>
+    exit();
+    13a9:	e8 73 24 00 00       	call   3821 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    13ae:	83 ec 08             	sub    $0x8,%esp
+    13b1:	68 f0 41 00 00       	push   $0x41f0
+    13b6:	6a 01                	push   $0x1
+    13b8:	e8 0c 26 00 00       	call   39c9 <printf>
+    exit();
+    13bd:	e8 5f 24 00 00       	call   3821 <exit>
+    printf(1, "unlinkread read failed");
+    13c2:	83 ec 08             	sub    $0x8,%esp
+    13c5:	68 0e 42 00 00       	push   $0x420e
+    13ca:	6a 01                	push   $0x1
+    13cc:	e8 f8 25 00 00       	call   39c9 <printf>
+    exit();
+    13d1:	e8 4b 24 00 00       	call   3821 <exit>
+    printf(1, "unlinkread wrong data\n");
+    13d6:	83 ec 08             	sub    $0x8,%esp
+    13d9:	68 25 42 00 00       	push   $0x4225
+    13de:	6a 01                	push   $0x1
+    13e0:	e8 e4 25 00 00       	call   39c9 <printf>
+    exit();
+    13e5:	e8 37 24 00 00       	call   3821 <exit>
+    printf(1, "unlinkread write failed\n");
+    13ea:	83 ec 08             	sub    $0x8,%esp
+    13ed:	68 3c 42 00 00       	push   $0x423c
+    13f2:	6a 01                	push   $0x1
+    13f4:	e8 d0 25 00 00       	call   39c9 <printf>
+    exit();
+    13f9:	e8 23 24 00 00       	call   3821 <exit>
+
+000013fe <linktest>:
+
+void
+linktest(void)
+{
+    13fe:	55                   	push   %ebp
+    13ff:	89 e5                	mov    %esp,%ebp
+    1401:	53                   	push   %ebx
+    1402:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    1405:	68 64 42 00 00       	push   $0x4264
+    140a:	6a 01                	push   $0x1
+    140c:	e8 b8 25 00 00       	call   39c9 <printf>
+
+  unlink("lf1");
+    1411:	c7 04 24 6e 42 00 00 	movl   $0x426e,(%esp)
+    1418:	e8 54 24 00 00       	call   3871 <unlink>
+  unlink("lf2");
+    141d:	c7 04 24 72 42 00 00 	movl   $0x4272,(%esp)
+    1424:	e8 48 24 00 00       	call   3871 <unlink>
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1429:	83 c4 08             	add    $0x8,%esp
+    142c:	68 02 02 00 00       	push   $0x202
+    1431:	68 6e 42 00 00       	push   $0x426e
+    1436:	e8 26 24 00 00       	call   3861 <open>
+  if(fd < 0){
+    143b:	83 c4 10             	add    $0x10,%esp
+    143e:	85 c0                	test   %eax,%eax
+    1440:	0f 88 2a 01 00 00    	js     1570 <linktest+0x172>
+    1446:	89 c3                	mov    %eax,%ebx
+    printf(1, "create lf1 failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5){
+    1448:	83 ec 04             	sub    $0x4,%esp
+    144b:	6a 05                	push   $0x5
+    144d:	68 d2 41 00 00       	push   $0x41d2
+    1452:	50                   	push   %eax
+    1453:	e8 e9 23 00 00       	call   3841 <write>
+    1458:	83 c4 10             	add    $0x10,%esp
+    145b:	83 f8 05             	cmp    $0x5,%eax
+    145e:	0f 85 20 01 00 00    	jne    1584 <linktest+0x186>
+    printf(1, "write lf1 failed\n");
+    exit();
+  }
+  close(fd);
+    1464:	83 ec 0c             	sub    $0xc,%esp
+    1467:	53                   	push   %ebx
+    1468:	e8 dc 23 00 00       	call   3849 <close>
+
+  if(link("lf1", "lf2") < 0){
+    146d:	83 c4 08             	add    $0x8,%esp
+    1470:	68 72 42 00 00       	push   $0x4272
+    1475:	68 6e 42 00 00       	push   $0x426e
+    147a:	e8 02 24 00 00       	call   3881 <link>
+    147f:	83 c4 10             	add    $0x10,%esp
+    1482:	85 c0                	test   %eax,%eax
+    1484:	0f 88 0e 01 00 00    	js     1598 <linktest+0x19a>
+    printf(1, "link lf1 lf2 failed\n");
+    exit();
+  }
+  unlink("lf1");
+    148a:	83 ec 0c             	sub    $0xc,%esp
+    148d:	68 6e 42 00 00       	push   $0x426e
+    1492:	e8 da 23 00 00       	call   3871 <unlink>
+
+  if(open("lf1", 0) >= 0){
+    1497:	83 c4 08             	add    $0x8,%esp
+    149a:	6a 00                	push   $0x0
+    149c:	68 6e 42 00 00       	push   $0x426e
+    14a1:	e8 bb 23 00 00       	call   3861 <open>
+    14a6:	83 c4 10             	add    $0x10,%esp
+    14a9:	85 c0                	test   %eax,%eax
+    14ab:	0f 89 fb 00 00 00    	jns    15ac <linktest+0x1ae>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    exit();
+  }
+
+  fd = open("lf2", 0);
+    14b1:	83 ec 08             	sub    $0x8,%esp
+    14b4:	6a 00                	push   $0x0
+    14b6:	68 72 42 00 00       	push   $0x4272
+    14bb:	e8 a1 23 00 00       	call   3861 <open>
+    14c0:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    14c2:	83 c4 10             	add    $0x10,%esp
+    14c5:	85 c0                	test   %eax,%eax
+    14c7:	0f 88 f3 00 00 00    	js     15c0 <linktest+0x1c2>
+    printf(1, "open lf2 failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    14cd:	83 ec 04             	sub    $0x4,%esp
+    14d0:	68 00 20 00 00       	push   $0x2000
+    14d5:	68 80 84 00 00       	push   $0x8480
+    14da:	50                   	push   %eax
+    14db:	e8 59 23 00 00       	call   3839 <read>
+    14e0:	83 c4 10             	add    $0x10,%esp
+    14e3:	83 f8 05             	cmp    $0x5,%eax
+    14e6:	0f 85 e8 00 00 00    	jne    15d4 <linktest+0x1d6>
+    printf(1, "read lf2 failed\n");
+    exit();
+  }
+  close(fd);
+    14ec:	83 ec 0c             	sub    $0xc,%esp
+    14ef:	53                   	push   %ebx
+    14f0:	e8 54 23 00 00       	call   3849 <close>
+
+  if(link("lf2", "lf2") >= 0){
+    14f5:	83 c4 08             	add    $0x8,%esp
+    14f8:	68 72 42 00 00       	push   $0x4272
+    14fd:	68 72 42 00 00       	push   $0x4272
+    1502:	e8 7a 23 00 00       	call   3881 <link>
+    1507:	83 c4 10             	add    $0x10,%esp
+    150a:	85 c0                	test   %eax,%eax
+    150c:	0f 89 d6 00 00 00    	jns    15e8 <linktest+0x1ea>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    exit();
+  }
+
+  unlink("lf2");
+    1512:	83 ec 0c             	sub    $0xc,%esp
+    1515:	68 72 42 00 00       	push   $0x4272
+    151a:	e8 52 23 00 00       	call   3871 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    151f:	83 c4 08             	add    $0x8,%esp
+    1522:	68 6e 42 00 00       	push   $0x426e
+    1527:	68 72 42 00 00       	push   $0x4272
+    152c:	e8 50 23 00 00       	call   3881 <link>
+    1531:	83 c4 10             	add    $0x10,%esp
+    1534:	85 c0                	test   %eax,%eax
+    1536:	0f 89 c0 00 00 00    	jns    15fc <linktest+0x1fe>
+    printf(1, "link non-existant succeeded! oops\n");
+    exit();
+  }
+
+  if(link(".", "lf1") >= 0){
+    153c:	83 ec 08             	sub    $0x8,%esp
+    153f:	68 6e 42 00 00       	push   $0x426e
+    1544:	68 36 45 00 00       	push   $0x4536
+    1549:	e8 33 23 00 00       	call   3881 <link>
+    154e:	83 c4 10             	add    $0x10,%esp
+    1551:	85 c0                	test   %eax,%eax
+    1553:	0f 89 b7 00 00 00    	jns    1610 <linktest+0x212>
+    printf(1, "link . lf1 succeeded! oops\n");
+    exit();
+  }
+
+  printf(1, "linktest ok\n");
+    1559:	83 ec 08             	sub    $0x8,%esp
+    155c:	68 0c 43 00 00       	push   $0x430c
+    1561:	6a 01                	push   $0x1
+    1563:	e8 61 24 00 00       	call   39c9 <printf>
+}
+    1568:	83 c4 10             	add    $0x10,%esp
+    156b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    156e:	c9                   	leave
+    156f:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1570:	83 ec 08             	sub    $0x8,%esp
+    1573:	68 76 42 00 00       	push   $0x4276
+    1578:	6a 01                	push   $0x1
+    157a:	e8 4a 24 00 00       	call   39c9 <printf>
+    exit();
+    157f:	e8 9d 22 00 00       	call   3821 <exit>
+    printf(1, "write lf1 failed\n");
+    1584:	83 ec 08             	sub    $0x8,%esp
+    1587:	68 89 42 00 00       	push   $0x4289
+    158c:	6a 01                	push   $0x1
+    158e:	e8 36 24 00 00       	call   39c9 <printf>
+    exit();
+    1593:	e8 89 22 00 00       	call   3821 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1598:	83 ec 08             	sub    $0x8,%esp
+    159b:	68 9b 42 00 00       	push   $0x429b
+    15a0:	6a 01                	push   $0x1
+    15a2:	e8 22 24 00 00       	call   39c9 <printf>
+    exit();
+    15a7:	e8 75 22 00 00       	call   3821 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    15ac:	83 ec 08             	sub    $0x8,%esp
+    15af:	68 7c 4e 00 00       	push   $0x4e7c
+    15b4:	6a 01                	push   $0x1
+    15b6:	e8 0e 24 00 00       	call   39c9 <printf>
+    exit();
+    15bb:	e8 61 22 00 00       	call   3821 <exit>
+    printf(1, "open lf2 failed\n");
+    15c0:	83 ec 08             	sub    $0x8,%esp
+    15c3:	68 b0 42 00 00       	push   $0x42b0
+    15c8:	6a 01                	push   $0x1
+    15ca:	e8 fa 23 00 00       	call   39c9 <printf>
+    exit();
+    15cf:	e8 4d 22 00 00       	call   3821 <exit>
+    printf(1, "read lf2 failed\n");
+    15d4:	83 ec 08             	sub    $0x8,%esp
+    15d7:	68 c1 42 00 00       	push   $0x42c1
+    15dc:	6a 01                	push   $0x1
+    15de:	e8 e6 23 00 00       	call   39c9 <printf>
+    exit();
+    15e3:	e8 39 22 00 00       	call   3821 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    15e8:	83 ec 08             	sub    $0x8,%esp
+    15eb:	68 d2 42 00 00       	push   $0x42d2
+    15f0:	6a 01                	push   $0x1
+    15f2:	e8 d2 23 00 00       	call   39c9 <printf>
+    exit();
+    15f7:	e8 25 22 00 00       	call   3821 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    15fc:	83 ec 08             	sub    $0x8,%esp
+    15ff:	68 a4 4e 00 00       	push   $0x4ea4
+    1604:	6a 01                	push   $0x1
+    1606:	e8 be 23 00 00       	call   39c9 <printf>
+    exit();
+    160b:	e8 11 22 00 00       	call   3821 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1610:	83 ec 08             	sub    $0x8,%esp
+    1613:	68 f0 42 00 00       	push   $0x42f0
+    1618:	6a 01                	push   $0x1
+    161a:	e8 aa 23 00 00       	call   39c9 <printf>
+    exit();
+    161f:	e8 fd 21 00 00       	call   3821 <exit>
+
+00001624 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    1624:	55                   	push   %ebp
+    1625:	89 e5                	mov    %esp,%ebp
+    1627:	57                   	push   %edi
+    1628:	56                   	push   %esi
+    1629:	53                   	push   %ebx
+    162a:	83 ec 54             	sub    $0x54,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    162d:	68 19 43 00 00       	push   $0x4319
+    1632:	6a 01                	push   $0x1
+    1634:	e8 90 23 00 00       	call   39c9 <printf>
+  file[0] = 'C';
+    1639:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    163d:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    1641:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 40; i++){
+    1644:	bb 00 00 00 00       	mov    $0x0,%ebx
+    file[1] = '0' + i;
+    unlink(file);
+    1649:	8d 75 e5             	lea    -0x1b(%ebp),%esi
+    pid = fork();
+    if(pid && (i % 3) == 1){
+    164c:	bf 56 55 55 55       	mov    $0x55555556,%edi
+    1651:	e9 85 02 00 00       	jmp    18db <concreate+0x2b7>
+      link("C0", file);
+    1656:	83 ec 08             	sub    $0x8,%esp
+    1659:	56                   	push   %esi
+    165a:	68 29 43 00 00       	push   $0x4329
+    165f:	e8 1d 22 00 00       	call   3881 <link>
+    1664:	83 c4 10             	add    $0x10,%esp
+    1667:	e9 56 02 00 00       	jmp    18c2 <concreate+0x29e>
+    } else if(pid == 0 && (i % 5) == 1){
+    166c:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1671:	89 d8                	mov    %ebx,%eax
+    1673:	f7 ea                	imul   %edx
+    1675:	d1 fa                	sar    %edx
+    1677:	89 d8                	mov    %ebx,%eax
+    1679:	c1 f8 1f             	sar    $0x1f,%eax
+    167c:	29 c2                	sub    %eax,%edx
+    167e:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1681:	29 c3                	sub    %eax,%ebx
+    1683:	83 fb 01             	cmp    $0x1,%ebx
+    1686:	74 34                	je     16bc <concreate+0x98>
+      link("C0", file);
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    1688:	83 ec 08             	sub    $0x8,%esp
+    168b:	68 02 02 00 00       	push   $0x202
+    1690:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1693:	50                   	push   %eax
+    1694:	e8 c8 21 00 00       	call   3861 <open>
+      if(fd < 0){
+    1699:	83 c4 10             	add    $0x10,%esp
+    169c:	85 c0                	test   %eax,%eax
+    169e:	0f 89 01 02 00 00    	jns    18a5 <concreate+0x281>
+        printf(1, "concreate create %s failed\n", file);
+    16a4:	83 ec 04             	sub    $0x4,%esp
+    16a7:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16aa:	50                   	push   %eax
+    16ab:	68 2c 43 00 00       	push   $0x432c
+    16b0:	6a 01                	push   $0x1
+    16b2:	e8 12 23 00 00       	call   39c9 <printf>
+        exit();
+    16b7:	e8 65 21 00 00       	call   3821 <exit>
+      link("C0", file);
+    16bc:	83 ec 08             	sub    $0x8,%esp
+    16bf:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    16c2:	50                   	push   %eax
+    16c3:	68 29 43 00 00       	push   $0x4329
+    16c8:	e8 b4 21 00 00       	call   3881 <link>
+    16cd:	83 c4 10             	add    $0x10,%esp
+      }
+      close(fd);
+    }
+    if(pid == 0)
+      exit();
+    16d0:	e8 4c 21 00 00       	call   3821 <exit>
+    else
+      wait(0);
+  }
+
+  memset(fa, 0, sizeof(fa));
+    16d5:	83 ec 04             	sub    $0x4,%esp
+    16d8:	6a 28                	push   $0x28
+    16da:	6a 00                	push   $0x0
+    16dc:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    16df:	50                   	push   %eax
+    16e0:	e8 e9 1f 00 00       	call   36ce <memset>
+  fd = open(".", 0);
+    16e5:	83 c4 08             	add    $0x8,%esp
+    16e8:	6a 00                	push   $0x0
+    16ea:	68 36 45 00 00       	push   $0x4536
+    16ef:	e8 6d 21 00 00       	call   3861 <open>
+    16f4:	89 c3                	mov    %eax,%ebx
+  n = 0;
+  while(read(fd, &de, sizeof(de)) > 0){
+    16f6:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    16f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  while(read(fd, &de, sizeof(de)) > 0){
+    16fe:	8d 75 ac             	lea    -0x54(%ebp),%esi
+    1701:	83 ec 04             	sub    $0x4,%esp
+    1704:	6a 10                	push   $0x10
+    1706:	56                   	push   %esi
+    1707:	53                   	push   %ebx
+    1708:	e8 2c 21 00 00       	call   3839 <read>
+    170d:	83 c4 10             	add    $0x10,%esp
+    1710:	85 c0                	test   %eax,%eax
+    1712:	7e 60                	jle    1774 <concreate+0x150>
+    if(de.inum == 0)
+    1714:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    1719:	74 e6                	je     1701 <concreate+0xdd>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    171b:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    171f:	75 e0                	jne    1701 <concreate+0xdd>
+    1721:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    1725:	75 da                	jne    1701 <concreate+0xdd>
+      i = de.name[1] - '0';
+    1727:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    172b:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    172e:	83 f8 27             	cmp    $0x27,%eax
+    1731:	77 11                	ja     1744 <concreate+0x120>
+        printf(1, "concreate weird file %s\n", de.name);
+        exit();
+      }
+      if(fa[i]){
+    1733:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    1738:	75 22                	jne    175c <concreate+0x138>
+        printf(1, "concreate duplicate file %s\n", de.name);
+        exit();
+      }
+      fa[i] = 1;
+    173a:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    173f:	83 c7 01             	add    $0x1,%edi
+    1742:	eb bd                	jmp    1701 <concreate+0xdd>
+        printf(1, "concreate weird file %s\n", de.name);
+    1744:	83 ec 04             	sub    $0x4,%esp
+    1747:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    174a:	50                   	push   %eax
+    174b:	68 48 43 00 00       	push   $0x4348
+    1750:	6a 01                	push   $0x1
+    1752:	e8 72 22 00 00       	call   39c9 <printf>
+        exit();
+    1757:	e8 c5 20 00 00       	call   3821 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    175c:	83 ec 04             	sub    $0x4,%esp
+    175f:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    1762:	50                   	push   %eax
+    1763:	68 61 43 00 00       	push   $0x4361
+    1768:	6a 01                	push   $0x1
+    176a:	e8 5a 22 00 00       	call   39c9 <printf>
+        exit();
+    176f:	e8 ad 20 00 00       	call   3821 <exit>
+    }
+  }
+  close(fd);
+    1774:	83 ec 0c             	sub    $0xc,%esp
+    1777:	53                   	push   %ebx
+    1778:	e8 cc 20 00 00       	call   3849 <close>
+
+  if(n != 40){
+    177d:	83 c4 10             	add    $0x10,%esp
+    1780:	83 ff 28             	cmp    $0x28,%edi
+    1783:	75 0d                	jne    1792 <concreate+0x16e>
+    printf(1, "concreate not enough files in directory listing\n");
+    exit();
+  }
+
+  for(i = 0; i < 40; i++){
+    1785:	bb 00 00 00 00       	mov    $0x0,%ebx
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+       ((i % 3) == 1 && pid != 0)){
+      close(open(file, 0));
+    178a:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    178d:	e9 90 00 00 00       	jmp    1822 <concreate+0x1fe>
+    printf(1, "concreate not enough files in directory listing\n");
+    1792:	83 ec 08             	sub    $0x8,%esp
+    1795:	68 c8 4e 00 00       	push   $0x4ec8
+    179a:	6a 01                	push   $0x1
+    179c:	e8 28 22 00 00       	call   39c9 <printf>
+    exit();
+    17a1:	e8 7b 20 00 00       	call   3821 <exit>
+      printf(1, "fork failed\n");
+    17a6:	83 ec 08             	sub    $0x8,%esp
+    17a9:	68 01 4c 00 00       	push   $0x4c01
+    17ae:	6a 01                	push   $0x1
+    17b0:	e8 14 22 00 00       	call   39c9 <printf>
+      exit();
+    17b5:	e8 67 20 00 00       	call   3821 <exit>
+      close(open(file, 0));
+    17ba:	83 ec 08             	sub    $0x8,%esp
+    17bd:	6a 00                	push   $0x0
+    17bf:	57                   	push   %edi
+    17c0:	e8 9c 20 00 00       	call   3861 <open>
+    17c5:	89 04 24             	mov    %eax,(%esp)
+    17c8:	e8 7c 20 00 00       	call   3849 <close>
+      close(open(file, 0));
+    17cd:	83 c4 08             	add    $0x8,%esp
+    17d0:	6a 00                	push   $0x0
+    17d2:	57                   	push   %edi
+    17d3:	e8 89 20 00 00       	call   3861 <open>
+    17d8:	89 04 24             	mov    %eax,(%esp)
+    17db:	e8 69 20 00 00       	call   3849 <close>
+      close(open(file, 0));
+    17e0:	83 c4 08             	add    $0x8,%esp
+    17e3:	6a 00                	push   $0x0
+    17e5:	57                   	push   %edi
+    17e6:	e8 76 20 00 00       	call   3861 <open>
+    17eb:	89 04 24             	mov    %eax,(%esp)
+    17ee:	e8 56 20 00 00       	call   3849 <close>
+      close(open(file, 0));
+    17f3:	83 c4 08             	add    $0x8,%esp
+    17f6:	6a 00                	push   $0x0
+    17f8:	57                   	push   %edi
+    17f9:	e8 63 20 00 00       	call   3861 <open>
+    17fe:	89 04 24             	mov    %eax,(%esp)
+    1801:	e8 43 20 00 00       	call   3849 <close>
+    1806:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+      unlink(file);
+      unlink(file);
+      unlink(file);
+    }
+    if(pid == 0)
+    1809:	85 f6                	test   %esi,%esi
+    180b:	74 7c                	je     1889 <concreate+0x265>
+      exit();
+    else
+      wait(0);
+    180d:	83 ec 0c             	sub    $0xc,%esp
+    1810:	6a 00                	push   $0x0
+    1812:	e8 12 20 00 00       	call   3829 <wait>
+  for(i = 0; i < 40; i++){
+    1817:	83 c3 01             	add    $0x1,%ebx
+    181a:	83 c4 10             	add    $0x10,%esp
+    181d:	83 fb 28             	cmp    $0x28,%ebx
+    1820:	74 6c                	je     188e <concreate+0x26a>
+    file[1] = '0' + i;
+    1822:	8d 43 30             	lea    0x30(%ebx),%eax
+    1825:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    1828:	e8 ec 1f 00 00       	call   3819 <fork>
+    182d:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    182f:	85 c0                	test   %eax,%eax
+    1831:	0f 88 6f ff ff ff    	js     17a6 <concreate+0x182>
+    if(((i % 3) == 0 && pid == 0) ||
+    1837:	b8 56 55 55 55       	mov    $0x55555556,%eax
+    183c:	f7 eb                	imul   %ebx
+    183e:	89 d8                	mov    %ebx,%eax
+    1840:	c1 f8 1f             	sar    $0x1f,%eax
+    1843:	29 c2                	sub    %eax,%edx
+    1845:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    1848:	89 da                	mov    %ebx,%edx
+    184a:	29 c2                	sub    %eax,%edx
+    184c:	89 d0                	mov    %edx,%eax
+    184e:	09 f0                	or     %esi,%eax
+    1850:	0f 84 64 ff ff ff    	je     17ba <concreate+0x196>
+       ((i % 3) == 1 && pid != 0)){
+    1856:	85 f6                	test   %esi,%esi
+    1858:	74 09                	je     1863 <concreate+0x23f>
+    185a:	83 fa 01             	cmp    $0x1,%edx
+    185d:	0f 84 57 ff ff ff    	je     17ba <concreate+0x196>
+      unlink(file);
+    1863:	83 ec 0c             	sub    $0xc,%esp
+    1866:	57                   	push   %edi
+    1867:	e8 05 20 00 00       	call   3871 <unlink>
+      unlink(file);
+    186c:	89 3c 24             	mov    %edi,(%esp)
+    186f:	e8 fd 1f 00 00       	call   3871 <unlink>
+      unlink(file);
+    1874:	89 3c 24             	mov    %edi,(%esp)
+    1877:	e8 f5 1f 00 00       	call   3871 <unlink>
+      unlink(file);
+    187c:	89 3c 24             	mov    %edi,(%esp)
+    187f:	e8 ed 1f 00 00       	call   3871 <unlink>
+    1884:	83 c4 10             	add    $0x10,%esp
+    1887:	eb 80                	jmp    1809 <concreate+0x1e5>
+      exit();
+    1889:	e8 93 1f 00 00       	call   3821 <exit>
+  }
+
+  printf(1, "concreate ok\n");
+    188e:	83 ec 08             	sub    $0x8,%esp
+    1891:	68 7e 43 00 00       	push   $0x437e
+    1896:	6a 01                	push   $0x1
+    1898:	e8 2c 21 00 00       	call   39c9 <printf>
+}
+    189d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    18a0:	5b                   	pop    %ebx
+    18a1:	5e                   	pop    %esi
+    18a2:	5f                   	pop    %edi
+    18a3:	5d                   	pop    %ebp
+    18a4:	c3                   	ret
+      close(fd);
+    18a5:	83 ec 0c             	sub    $0xc,%esp
+    18a8:	50                   	push   %eax
+    18a9:	e8 9b 1f 00 00       	call   3849 <close>
+    18ae:	83 c4 10             	add    $0x10,%esp
+    18b1:	e9 1a fe ff ff       	jmp    16d0 <concreate+0xac>
+    18b6:	83 ec 0c             	sub    $0xc,%esp
+    18b9:	50                   	push   %eax
+    18ba:	e8 8a 1f 00 00       	call   3849 <close>
+    18bf:	83 c4 10             	add    $0x10,%esp
+      wait(0);
+    18c2:	83 ec 0c             	sub    $0xc,%esp
+    18c5:	6a 00                	push   $0x0
+    18c7:	e8 5d 1f 00 00       	call   3829 <wait>
+  for(i = 0; i < 40; i++){
+    18cc:	83 c3 01             	add    $0x1,%ebx
+    18cf:	83 c4 10             	add    $0x10,%esp
+    18d2:	83 fb 28             	cmp    $0x28,%ebx
+    18d5:	0f 84 fa fd ff ff    	je     16d5 <concreate+0xb1>
+    file[1] = '0' + i;
+    18db:	8d 43 30             	lea    0x30(%ebx),%eax
+    18de:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    18e1:	83 ec 0c             	sub    $0xc,%esp
+    18e4:	56                   	push   %esi
+    18e5:	e8 87 1f 00 00       	call   3871 <unlink>
+    pid = fork();
+    18ea:	e8 2a 1f 00 00       	call   3819 <fork>
+    if(pid && (i % 3) == 1){
+    18ef:	83 c4 10             	add    $0x10,%esp
+    18f2:	85 c0                	test   %eax,%eax
+    18f4:	0f 84 72 fd ff ff    	je     166c <concreate+0x48>
+    18fa:	89 d8                	mov    %ebx,%eax
+    18fc:	f7 ef                	imul   %edi
+    18fe:	89 d8                	mov    %ebx,%eax
+    1900:	c1 f8 1f             	sar    $0x1f,%eax
+    1903:	29 c2                	sub    %eax,%edx
+    1905:	8d 14 52             	lea    (%edx,%edx,2),%edx
+    1908:	89 d8                	mov    %ebx,%eax
+    190a:	29 d0                	sub    %edx,%eax
+    190c:	83 f8 01             	cmp    $0x1,%eax
+    190f:	0f 84 41 fd ff ff    	je     1656 <concreate+0x32>
+      fd = open(file, O_CREATE | O_RDWR);
+    1915:	83 ec 08             	sub    $0x8,%esp
+    1918:	68 02 02 00 00       	push   $0x202
+    191d:	56                   	push   %esi
+    191e:	e8 3e 1f 00 00       	call   3861 <open>
+      if(fd < 0){
+    1923:	83 c4 10             	add    $0x10,%esp
+    1926:	85 c0                	test   %eax,%eax
+    1928:	79 8c                	jns    18b6 <concreate+0x292>
+    192a:	e9 75 fd ff ff       	jmp    16a4 <concreate+0x80>
+
+0000192f <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    192f:	55                   	push   %ebp
+    1930:	89 e5                	mov    %esp,%ebp
+    1932:	57                   	push   %edi
+    1933:	56                   	push   %esi
+    1934:	53                   	push   %ebx
+    1935:	83 ec 24             	sub    $0x24,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    1938:	68 8c 43 00 00       	push   $0x438c
+    193d:	6a 01                	push   $0x1
+    193f:	e8 85 20 00 00       	call   39c9 <printf>
+
+  unlink("x");
+    1944:	c7 04 24 19 46 00 00 	movl   $0x4619,(%esp)
+    194b:	e8 21 1f 00 00       	call   3871 <unlink>
+  pid = fork();
+    1950:	e8 c4 1e 00 00       	call   3819 <fork>
+    1955:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1958:	83 c4 10             	add    $0x10,%esp
+    195b:	85 c0                	test   %eax,%eax
+    195d:	78 18                	js     1977 <linkunlink+0x48>
+    printf(1, "fork failed\n");
+    exit();
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    195f:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1963:	19 db                	sbb    %ebx,%ebx
+    1965:	83 e3 60             	and    $0x60,%ebx
+    1968:	83 c3 01             	add    $0x1,%ebx
+    196b:	be 64 00 00 00       	mov    $0x64,%esi
+  for(i = 0; i < 100; i++){
+    x = x * 1103515245 + 12345;
+    if((x % 3) == 0){
+    1970:	bf ab aa aa aa       	mov    $0xaaaaaaab,%edi
+    1975:	eb 36                	jmp    19ad <linkunlink+0x7e>
+    printf(1, "fork failed\n");
+    1977:	83 ec 08             	sub    $0x8,%esp
+    197a:	68 01 4c 00 00       	push   $0x4c01
+    197f:	6a 01                	push   $0x1
+    1981:	e8 43 20 00 00       	call   39c9 <printf>
+    exit();
+    1986:	e8 96 1e 00 00       	call   3821 <exit>
+      close(open("x", O_RDWR | O_CREATE));
+    198b:	83 ec 08             	sub    $0x8,%esp
+    198e:	68 02 02 00 00       	push   $0x202
+    1993:	68 19 46 00 00       	push   $0x4619
+    1998:	e8 c4 1e 00 00       	call   3861 <open>
+    199d:	89 04 24             	mov    %eax,(%esp)
+    19a0:	e8 a4 1e 00 00       	call   3849 <close>
+    19a5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    19a8:	83 ee 01             	sub    $0x1,%esi
+    19ab:	74 4d                	je     19fa <linkunlink+0xcb>
+    x = x * 1103515245 + 12345;
+    19ad:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    19b3:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    19b9:	89 d8                	mov    %ebx,%eax
+    19bb:	f7 e7                	mul    %edi
+    19bd:	89 d0                	mov    %edx,%eax
+    19bf:	d1 e8                	shr    %eax
+    19c1:	83 e2 fe             	and    $0xfffffffe,%edx
+    19c4:	01 c2                	add    %eax,%edx
+    19c6:	89 d8                	mov    %ebx,%eax
+    19c8:	29 d0                	sub    %edx,%eax
+    19ca:	74 bf                	je     198b <linkunlink+0x5c>
+    } else if((x % 3) == 1){
+    19cc:	83 f8 01             	cmp    $0x1,%eax
+    19cf:	74 12                	je     19e3 <linkunlink+0xb4>
+      link("cat", "x");
+    } else {
+      unlink("x");
+    19d1:	83 ec 0c             	sub    $0xc,%esp
+    19d4:	68 19 46 00 00       	push   $0x4619
+    19d9:	e8 93 1e 00 00       	call   3871 <unlink>
+    19de:	83 c4 10             	add    $0x10,%esp
+    19e1:	eb c5                	jmp    19a8 <linkunlink+0x79>
+      link("cat", "x");
+    19e3:	83 ec 08             	sub    $0x8,%esp
+    19e6:	68 19 46 00 00       	push   $0x4619
+    19eb:	68 9d 43 00 00       	push   $0x439d
+    19f0:	e8 8c 1e 00 00       	call   3881 <link>
+    19f5:	83 c4 10             	add    $0x10,%esp
+    19f8:	eb ae                	jmp    19a8 <linkunlink+0x79>
+    }
+  }
+
+  if(pid)
+    19fa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    19fe:	74 21                	je     1a21 <linkunlink+0xf2>
+    wait(0);
+    1a00:	83 ec 0c             	sub    $0xc,%esp
+    1a03:	6a 00                	push   $0x0
+    1a05:	e8 1f 1e 00 00       	call   3829 <wait>
+  else
+    exit();
+
+  printf(1, "linkunlink ok\n");
+    1a0a:	83 c4 08             	add    $0x8,%esp
+    1a0d:	68 a1 43 00 00       	push   $0x43a1
+    1a12:	6a 01                	push   $0x1
+    1a14:	e8 b0 1f 00 00       	call   39c9 <printf>
+}
+    1a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a1c:	5b                   	pop    %ebx
+    1a1d:	5e                   	pop    %esi
+    1a1e:	5f                   	pop    %edi
+    1a1f:	5d                   	pop    %ebp
+    1a20:	c3                   	ret
+    exit();
+    1a21:	e8 fb 1d 00 00       	call   3821 <exit>
+
+00001a26 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    1a26:	55                   	push   %ebp
+    1a27:	89 e5                	mov    %esp,%ebp
+    1a29:	57                   	push   %edi
+    1a2a:	56                   	push   %esi
+    1a2b:	53                   	push   %ebx
+    1a2c:	83 ec 24             	sub    $0x24,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    1a2f:	68 b0 43 00 00       	push   $0x43b0
+    1a34:	6a 01                	push   $0x1
+    1a36:	e8 8e 1f 00 00       	call   39c9 <printf>
+  unlink("bd");
+    1a3b:	c7 04 24 bd 43 00 00 	movl   $0x43bd,(%esp)
+    1a42:	e8 2a 1e 00 00       	call   3871 <unlink>
+
+  fd = open("bd", O_CREATE);
+    1a47:	83 c4 08             	add    $0x8,%esp
+    1a4a:	68 00 02 00 00       	push   $0x200
+    1a4f:	68 bd 43 00 00       	push   $0x43bd
+    1a54:	e8 08 1e 00 00       	call   3861 <open>
+  if(fd < 0){
+    1a59:	83 c4 10             	add    $0x10,%esp
+    1a5c:	85 c0                	test   %eax,%eax
+    1a5e:	0f 88 e0 00 00 00    	js     1b44 <bigdir+0x11e>
+    printf(1, "bigdir create failed\n");
+    exit();
+  }
+  close(fd);
+    1a64:	83 ec 0c             	sub    $0xc,%esp
+    1a67:	50                   	push   %eax
+    1a68:	e8 dc 1d 00 00       	call   3849 <close>
+    1a6d:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    1a70:	be 00 00 00 00       	mov    $0x0,%esi
+    name[0] = 'x';
+    name[1] = '0' + (i / 64);
+    name[2] = '0' + (i % 64);
+    name[3] = '\0';
+    if(link("bd", name) != 0){
+    1a75:	8d 7d de             	lea    -0x22(%ebp),%edi
+    name[0] = 'x';
+    1a78:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1a7c:	8d 46 3f             	lea    0x3f(%esi),%eax
+    1a7f:	85 f6                	test   %esi,%esi
+    1a81:	0f 49 c6             	cmovns %esi,%eax
+    1a84:	c1 f8 06             	sar    $0x6,%eax
+    1a87:	83 c0 30             	add    $0x30,%eax
+    1a8a:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1a8d:	89 f2                	mov    %esi,%edx
+    1a8f:	c1 fa 1f             	sar    $0x1f,%edx
+    1a92:	c1 ea 1a             	shr    $0x1a,%edx
+    1a95:	8d 04 16             	lea    (%esi,%edx,1),%eax
+    1a98:	83 e0 3f             	and    $0x3f,%eax
+    1a9b:	29 d0                	sub    %edx,%eax
+    1a9d:	83 c0 30             	add    $0x30,%eax
+    1aa0:	88 45 e0             	mov    %al,-0x20(%ebp)
+    name[3] = '\0';
+    1aa3:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    if(link("bd", name) != 0){
+    1aa7:	83 ec 08             	sub    $0x8,%esp
+    1aaa:	57                   	push   %edi
+    1aab:	68 bd 43 00 00       	push   $0x43bd
+    1ab0:	e8 cc 1d 00 00       	call   3881 <link>
+    1ab5:	89 c3                	mov    %eax,%ebx
+    1ab7:	83 c4 10             	add    $0x10,%esp
+    1aba:	85 c0                	test   %eax,%eax
+    1abc:	0f 85 96 00 00 00    	jne    1b58 <bigdir+0x132>
+  for(i = 0; i < 500; i++){
+    1ac2:	83 c6 01             	add    $0x1,%esi
+    1ac5:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1acb:	75 ab                	jne    1a78 <bigdir+0x52>
+      printf(1, "bigdir link failed\n");
+      exit();
+    }
+  }
+
+  unlink("bd");
+    1acd:	83 ec 0c             	sub    $0xc,%esp
+    1ad0:	68 bd 43 00 00       	push   $0x43bd
+    1ad5:	e8 97 1d 00 00       	call   3871 <unlink>
+    1ada:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    name[0] = 'x';
+    name[1] = '0' + (i / 64);
+    name[2] = '0' + (i % 64);
+    name[3] = '\0';
+    if(unlink(name) != 0){
+    1add:	8d 75 de             	lea    -0x22(%ebp),%esi
+    name[0] = 'x';
+    1ae0:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1ae4:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    1ae7:	85 db                	test   %ebx,%ebx
+    1ae9:	0f 49 c3             	cmovns %ebx,%eax
+    1aec:	c1 f8 06             	sar    $0x6,%eax
+    1aef:	83 c0 30             	add    $0x30,%eax
+    1af2:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1af5:	89 da                	mov    %ebx,%edx
+    1af7:	c1 fa 1f             	sar    $0x1f,%edx
+    1afa:	c1 ea 1a             	shr    $0x1a,%edx
+    1afd:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    1b00:	83 e0 3f             	and    $0x3f,%eax
+    1b03:	29 d0                	sub    %edx,%eax
+    1b05:	83 c0 30             	add    $0x30,%eax
+    1b08:	88 45 e0             	mov    %al,-0x20(%ebp)
+    name[3] = '\0';
+    1b0b:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    if(unlink(name) != 0){
+    1b0f:	83 ec 0c             	sub    $0xc,%esp
+    1b12:	56                   	push   %esi
+    1b13:	e8 59 1d 00 00       	call   3871 <unlink>
+    1b18:	83 c4 10             	add    $0x10,%esp
+    1b1b:	85 c0                	test   %eax,%eax
+    1b1d:	75 4d                	jne    1b6c <bigdir+0x146>
+  for(i = 0; i < 500; i++){
+    1b1f:	83 c3 01             	add    $0x1,%ebx
+    1b22:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1b28:	75 b6                	jne    1ae0 <bigdir+0xba>
+      printf(1, "bigdir unlink failed");
+      exit();
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    1b2a:	83 ec 08             	sub    $0x8,%esp
+    1b2d:	68 ff 43 00 00       	push   $0x43ff
+    1b32:	6a 01                	push   $0x1
+    1b34:	e8 90 1e 00 00       	call   39c9 <printf>
+}
+    1b39:	83 c4 10             	add    $0x10,%esp
+    1b3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1b3f:	5b                   	pop    %ebx
+    1b40:	5e                   	pop    %esi
+    1b41:	5f                   	pop    %edi
+    1b42:	5d                   	pop    %ebp
+    1b43:	c3                   	ret
+    printf(1, "bigdir create failed\n");
+    1b44:	83 ec 08             	sub    $0x8,%esp
+    1b47:	68 c0 43 00 00       	push   $0x43c0
+    1b4c:	6a 01                	push   $0x1
+    1b4e:	e8 76 1e 00 00       	call   39c9 <printf>
+    exit();
+    1b53:	e8 c9 1c 00 00       	call   3821 <exit>
+      printf(1, "bigdir link failed\n");
+    1b58:	83 ec 08             	sub    $0x8,%esp
+    1b5b:	68 d6 43 00 00       	push   $0x43d6
+    1b60:	6a 01                	push   $0x1
+    1b62:	e8 62 1e 00 00       	call   39c9 <printf>
+      exit();
+    1b67:	e8 b5 1c 00 00       	call   3821 <exit>
+      printf(1, "bigdir unlink failed");
+    1b6c:	83 ec 08             	sub    $0x8,%esp
+    1b6f:	68 ea 43 00 00       	push   $0x43ea
+    1b74:	6a 01                	push   $0x1
+    1b76:	e8 4e 1e 00 00       	call   39c9 <printf>
+      exit();
+    1b7b:	e8 a1 1c 00 00       	call   3821 <exit>
+
+00001b80 <subdir>:
+
+void
+subdir(void)
+{
+    1b80:	55                   	push   %ebp
+    1b81:	89 e5                	mov    %esp,%ebp
+    1b83:	53                   	push   %ebx
+    1b84:	83 ec 0c             	sub    $0xc,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    1b87:	68 0a 44 00 00       	push   $0x440a
+    1b8c:	6a 01                	push   $0x1
+    1b8e:	e8 36 1e 00 00       	call   39c9 <printf>
+
+  unlink("ff");
+    1b93:	c7 04 24 93 44 00 00 	movl   $0x4493,(%esp)
+    1b9a:	e8 d2 1c 00 00       	call   3871 <unlink>
+  if(mkdir("dd") != 0){
+    1b9f:	c7 04 24 30 45 00 00 	movl   $0x4530,(%esp)
+    1ba6:	e8 de 1c 00 00       	call   3889 <mkdir>
+    1bab:	83 c4 10             	add    $0x10,%esp
+    1bae:	85 c0                	test   %eax,%eax
+    1bb0:	0f 85 14 04 00 00    	jne    1fca <subdir+0x44a>
+    printf(1, "subdir mkdir dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1bb6:	83 ec 08             	sub    $0x8,%esp
+    1bb9:	68 02 02 00 00       	push   $0x202
+    1bbe:	68 69 44 00 00       	push   $0x4469
+    1bc3:	e8 99 1c 00 00       	call   3861 <open>
+    1bc8:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1bca:	83 c4 10             	add    $0x10,%esp
+    1bcd:	85 c0                	test   %eax,%eax
+    1bcf:	0f 88 09 04 00 00    	js     1fde <subdir+0x45e>
+    printf(1, "create dd/ff failed\n");
+    exit();
+  }
+  write(fd, "ff", 2);
+    1bd5:	83 ec 04             	sub    $0x4,%esp
+    1bd8:	6a 02                	push   $0x2
+    1bda:	68 93 44 00 00       	push   $0x4493
+    1bdf:	50                   	push   %eax
+    1be0:	e8 5c 1c 00 00       	call   3841 <write>
+  close(fd);
+    1be5:	89 1c 24             	mov    %ebx,(%esp)
+    1be8:	e8 5c 1c 00 00       	call   3849 <close>
+
+  if(unlink("dd") >= 0){
+    1bed:	c7 04 24 30 45 00 00 	movl   $0x4530,(%esp)
+    1bf4:	e8 78 1c 00 00       	call   3871 <unlink>
+    1bf9:	83 c4 10             	add    $0x10,%esp
+    1bfc:	85 c0                	test   %eax,%eax
+    1bfe:	0f 89 ee 03 00 00    	jns    1ff2 <subdir+0x472>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    exit();
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    1c04:	83 ec 0c             	sub    $0xc,%esp
+    1c07:	68 44 44 00 00       	push   $0x4444
+    1c0c:	e8 78 1c 00 00       	call   3889 <mkdir>
+    1c11:	83 c4 10             	add    $0x10,%esp
+    1c14:	85 c0                	test   %eax,%eax
+    1c16:	0f 85 ea 03 00 00    	jne    2006 <subdir+0x486>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1c1c:	83 ec 08             	sub    $0x8,%esp
+    1c1f:	68 02 02 00 00       	push   $0x202
+    1c24:	68 66 44 00 00       	push   $0x4466
+    1c29:	e8 33 1c 00 00       	call   3861 <open>
+    1c2e:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1c30:	83 c4 10             	add    $0x10,%esp
+    1c33:	85 c0                	test   %eax,%eax
+    1c35:	0f 88 df 03 00 00    	js     201a <subdir+0x49a>
+    printf(1, "create dd/dd/ff failed\n");
+    exit();
+  }
+  write(fd, "FF", 2);
+    1c3b:	83 ec 04             	sub    $0x4,%esp
+    1c3e:	6a 02                	push   $0x2
+    1c40:	68 87 44 00 00       	push   $0x4487
+    1c45:	50                   	push   %eax
+    1c46:	e8 f6 1b 00 00       	call   3841 <write>
+  close(fd);
+    1c4b:	89 1c 24             	mov    %ebx,(%esp)
+    1c4e:	e8 f6 1b 00 00       	call   3849 <close>
+
+  fd = open("dd/dd/../ff", 0);
+    1c53:	83 c4 08             	add    $0x8,%esp
+    1c56:	6a 00                	push   $0x0
+    1c58:	68 8a 44 00 00       	push   $0x448a
+    1c5d:	e8 ff 1b 00 00       	call   3861 <open>
+    1c62:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1c64:	83 c4 10             	add    $0x10,%esp
+    1c67:	85 c0                	test   %eax,%eax
+    1c69:	0f 88 bf 03 00 00    	js     202e <subdir+0x4ae>
+    printf(1, "open dd/dd/../ff failed\n");
+    exit();
+  }
+  cc = read(fd, buf, sizeof(buf));
+    1c6f:	83 ec 04             	sub    $0x4,%esp
+    1c72:	68 00 20 00 00       	push   $0x2000
+    1c77:	68 80 84 00 00       	push   $0x8480
+    1c7c:	50                   	push   %eax
+    1c7d:	e8 b7 1b 00 00       	call   3839 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1c82:	83 c4 10             	add    $0x10,%esp
+    1c85:	83 f8 02             	cmp    $0x2,%eax
+    1c88:	0f 85 b4 03 00 00    	jne    2042 <subdir+0x4c2>
+    1c8e:	80 3d 80 84 00 00 66 	cmpb   $0x66,0x8480
+    1c95:	0f 85 a7 03 00 00    	jne    2042 <subdir+0x4c2>
+    printf(1, "dd/dd/../ff wrong content\n");
+    exit();
+  }
+  close(fd);
+    1c9b:	83 ec 0c             	sub    $0xc,%esp
+    1c9e:	53                   	push   %ebx
+    1c9f:	e8 a5 1b 00 00       	call   3849 <close>
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1ca4:	83 c4 08             	add    $0x8,%esp
+    1ca7:	68 ca 44 00 00       	push   $0x44ca
+    1cac:	68 66 44 00 00       	push   $0x4466
+    1cb1:	e8 cb 1b 00 00       	call   3881 <link>
+    1cb6:	83 c4 10             	add    $0x10,%esp
+    1cb9:	85 c0                	test   %eax,%eax
+    1cbb:	0f 85 95 03 00 00    	jne    2056 <subdir+0x4d6>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    1cc1:	83 ec 0c             	sub    $0xc,%esp
+    1cc4:	68 66 44 00 00       	push   $0x4466
+    1cc9:	e8 a3 1b 00 00       	call   3871 <unlink>
+    1cce:	83 c4 10             	add    $0x10,%esp
+    1cd1:	85 c0                	test   %eax,%eax
+    1cd3:	0f 85 91 03 00 00    	jne    206a <subdir+0x4ea>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1cd9:	83 ec 08             	sub    $0x8,%esp
+    1cdc:	6a 00                	push   $0x0
+    1cde:	68 66 44 00 00       	push   $0x4466
+    1ce3:	e8 79 1b 00 00       	call   3861 <open>
+    1ce8:	83 c4 10             	add    $0x10,%esp
+    1ceb:	85 c0                	test   %eax,%eax
+    1ced:	0f 89 8b 03 00 00    	jns    207e <subdir+0x4fe>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    exit();
+  }
+
+  if(chdir("dd") != 0){
+    1cf3:	83 ec 0c             	sub    $0xc,%esp
+    1cf6:	68 30 45 00 00       	push   $0x4530
+    1cfb:	e8 91 1b 00 00       	call   3891 <chdir>
+    1d00:	83 c4 10             	add    $0x10,%esp
+    1d03:	85 c0                	test   %eax,%eax
+    1d05:	0f 85 87 03 00 00    	jne    2092 <subdir+0x512>
+    printf(1, "chdir dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../dd") != 0){
+    1d0b:	83 ec 0c             	sub    $0xc,%esp
+    1d0e:	68 fe 44 00 00       	push   $0x44fe
+    1d13:	e8 79 1b 00 00       	call   3891 <chdir>
+    1d18:	83 c4 10             	add    $0x10,%esp
+    1d1b:	85 c0                	test   %eax,%eax
+    1d1d:	0f 85 83 03 00 00    	jne    20a6 <subdir+0x526>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("dd/../../../dd") != 0){
+    1d23:	83 ec 0c             	sub    $0xc,%esp
+    1d26:	68 24 45 00 00       	push   $0x4524
+    1d2b:	e8 61 1b 00 00       	call   3891 <chdir>
+    1d30:	83 c4 10             	add    $0x10,%esp
+    1d33:	85 c0                	test   %eax,%eax
+    1d35:	0f 85 7f 03 00 00    	jne    20ba <subdir+0x53a>
+    printf(1, "chdir dd/../../dd failed\n");
+    exit();
+  }
+  if(chdir("./..") != 0){
+    1d3b:	83 ec 0c             	sub    $0xc,%esp
+    1d3e:	68 33 45 00 00       	push   $0x4533
+    1d43:	e8 49 1b 00 00       	call   3891 <chdir>
+    1d48:	83 c4 10             	add    $0x10,%esp
+    1d4b:	85 c0                	test   %eax,%eax
+    1d4d:	0f 85 7b 03 00 00    	jne    20ce <subdir+0x54e>
+    printf(1, "chdir ./.. failed\n");
+    exit();
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    1d53:	83 ec 08             	sub    $0x8,%esp
+    1d56:	6a 00                	push   $0x0
+    1d58:	68 ca 44 00 00       	push   $0x44ca
+    1d5d:	e8 ff 1a 00 00       	call   3861 <open>
+    1d62:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1d64:	83 c4 10             	add    $0x10,%esp
+    1d67:	85 c0                	test   %eax,%eax
+    1d69:	0f 88 73 03 00 00    	js     20e2 <subdir+0x562>
+    printf(1, "open dd/dd/ffff failed\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1d6f:	83 ec 04             	sub    $0x4,%esp
+    1d72:	68 00 20 00 00       	push   $0x2000
+    1d77:	68 80 84 00 00       	push   $0x8480
+    1d7c:	50                   	push   %eax
+    1d7d:	e8 b7 1a 00 00       	call   3839 <read>
+    1d82:	83 c4 10             	add    $0x10,%esp
+    1d85:	83 f8 02             	cmp    $0x2,%eax
+    1d88:	0f 85 68 03 00 00    	jne    20f6 <subdir+0x576>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    exit();
+  }
+  close(fd);
+    1d8e:	83 ec 0c             	sub    $0xc,%esp
+    1d91:	53                   	push   %ebx
+    1d92:	e8 b2 1a 00 00       	call   3849 <close>
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1d97:	83 c4 08             	add    $0x8,%esp
+    1d9a:	6a 00                	push   $0x0
+    1d9c:	68 66 44 00 00       	push   $0x4466
+    1da1:	e8 bb 1a 00 00       	call   3861 <open>
+    1da6:	83 c4 10             	add    $0x10,%esp
+    1da9:	85 c0                	test   %eax,%eax
+    1dab:	0f 89 59 03 00 00    	jns    210a <subdir+0x58a>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    exit();
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1db1:	83 ec 08             	sub    $0x8,%esp
+    1db4:	68 02 02 00 00       	push   $0x202
+    1db9:	68 7e 45 00 00       	push   $0x457e
+    1dbe:	e8 9e 1a 00 00       	call   3861 <open>
+    1dc3:	83 c4 10             	add    $0x10,%esp
+    1dc6:	85 c0                	test   %eax,%eax
+    1dc8:	0f 89 50 03 00 00    	jns    211e <subdir+0x59e>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1dce:	83 ec 08             	sub    $0x8,%esp
+    1dd1:	68 02 02 00 00       	push   $0x202
+    1dd6:	68 a3 45 00 00       	push   $0x45a3
+    1ddb:	e8 81 1a 00 00       	call   3861 <open>
+    1de0:	83 c4 10             	add    $0x10,%esp
+    1de3:	85 c0                	test   %eax,%eax
+    1de5:	0f 89 47 03 00 00    	jns    2132 <subdir+0x5b2>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_CREATE) >= 0){
+    1deb:	83 ec 08             	sub    $0x8,%esp
+    1dee:	68 00 02 00 00       	push   $0x200
+    1df3:	68 30 45 00 00       	push   $0x4530
+    1df8:	e8 64 1a 00 00       	call   3861 <open>
+    1dfd:	83 c4 10             	add    $0x10,%esp
+    1e00:	85 c0                	test   %eax,%eax
+    1e02:	0f 89 3e 03 00 00    	jns    2146 <subdir+0x5c6>
+    printf(1, "create dd succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_RDWR) >= 0){
+    1e08:	83 ec 08             	sub    $0x8,%esp
+    1e0b:	6a 02                	push   $0x2
+    1e0d:	68 30 45 00 00       	push   $0x4530
+    1e12:	e8 4a 1a 00 00       	call   3861 <open>
+    1e17:	83 c4 10             	add    $0x10,%esp
+    1e1a:	85 c0                	test   %eax,%eax
+    1e1c:	0f 89 38 03 00 00    	jns    215a <subdir+0x5da>
+    printf(1, "open dd rdwr succeeded!\n");
+    exit();
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    1e22:	83 ec 08             	sub    $0x8,%esp
+    1e25:	6a 01                	push   $0x1
+    1e27:	68 30 45 00 00       	push   $0x4530
+    1e2c:	e8 30 1a 00 00       	call   3861 <open>
+    1e31:	83 c4 10             	add    $0x10,%esp
+    1e34:	85 c0                	test   %eax,%eax
+    1e36:	0f 89 32 03 00 00    	jns    216e <subdir+0x5ee>
+    printf(1, "open dd wronly succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1e3c:	83 ec 08             	sub    $0x8,%esp
+    1e3f:	68 12 46 00 00       	push   $0x4612
+    1e44:	68 7e 45 00 00       	push   $0x457e
+    1e49:	e8 33 1a 00 00       	call   3881 <link>
+    1e4e:	83 c4 10             	add    $0x10,%esp
+    1e51:	85 c0                	test   %eax,%eax
+    1e53:	0f 84 29 03 00 00    	je     2182 <subdir+0x602>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1e59:	83 ec 08             	sub    $0x8,%esp
+    1e5c:	68 12 46 00 00       	push   $0x4612
+    1e61:	68 a3 45 00 00       	push   $0x45a3
+    1e66:	e8 16 1a 00 00       	call   3881 <link>
+    1e6b:	83 c4 10             	add    $0x10,%esp
+    1e6e:	85 c0                	test   %eax,%eax
+    1e70:	0f 84 20 03 00 00    	je     2196 <subdir+0x616>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    exit();
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1e76:	83 ec 08             	sub    $0x8,%esp
+    1e79:	68 ca 44 00 00       	push   $0x44ca
+    1e7e:	68 69 44 00 00       	push   $0x4469
+    1e83:	e8 f9 19 00 00       	call   3881 <link>
+    1e88:	83 c4 10             	add    $0x10,%esp
+    1e8b:	85 c0                	test   %eax,%eax
+    1e8d:	0f 84 17 03 00 00    	je     21aa <subdir+0x62a>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    1e93:	83 ec 0c             	sub    $0xc,%esp
+    1e96:	68 7e 45 00 00       	push   $0x457e
+    1e9b:	e8 e9 19 00 00       	call   3889 <mkdir>
+    1ea0:	83 c4 10             	add    $0x10,%esp
+    1ea3:	85 c0                	test   %eax,%eax
+    1ea5:	0f 84 13 03 00 00    	je     21be <subdir+0x63e>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    1eab:	83 ec 0c             	sub    $0xc,%esp
+    1eae:	68 a3 45 00 00       	push   $0x45a3
+    1eb3:	e8 d1 19 00 00       	call   3889 <mkdir>
+    1eb8:	83 c4 10             	add    $0x10,%esp
+    1ebb:	85 c0                	test   %eax,%eax
+    1ebd:	0f 84 0f 03 00 00    	je     21d2 <subdir+0x652>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    1ec3:	83 ec 0c             	sub    $0xc,%esp
+    1ec6:	68 ca 44 00 00       	push   $0x44ca
+    1ecb:	e8 b9 19 00 00       	call   3889 <mkdir>
+    1ed0:	83 c4 10             	add    $0x10,%esp
+    1ed3:	85 c0                	test   %eax,%eax
+    1ed5:	0f 84 0b 03 00 00    	je     21e6 <subdir+0x666>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/xx/ff") == 0){
+    1edb:	83 ec 0c             	sub    $0xc,%esp
+    1ede:	68 a3 45 00 00       	push   $0x45a3
+    1ee3:	e8 89 19 00 00       	call   3871 <unlink>
+    1ee8:	83 c4 10             	add    $0x10,%esp
+    1eeb:	85 c0                	test   %eax,%eax
+    1eed:	0f 84 07 03 00 00    	je     21fa <subdir+0x67a>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/ff/ff") == 0){
+    1ef3:	83 ec 0c             	sub    $0xc,%esp
+    1ef6:	68 7e 45 00 00       	push   $0x457e
+    1efb:	e8 71 19 00 00       	call   3871 <unlink>
+    1f00:	83 c4 10             	add    $0x10,%esp
+    1f03:	85 c0                	test   %eax,%eax
+    1f05:	0f 84 03 03 00 00    	je     220e <subdir+0x68e>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/ff") == 0){
+    1f0b:	83 ec 0c             	sub    $0xc,%esp
+    1f0e:	68 69 44 00 00       	push   $0x4469
+    1f13:	e8 79 19 00 00       	call   3891 <chdir>
+    1f18:	83 c4 10             	add    $0x10,%esp
+    1f1b:	85 c0                	test   %eax,%eax
+    1f1d:	0f 84 ff 02 00 00    	je     2222 <subdir+0x6a2>
+    printf(1, "chdir dd/ff succeeded!\n");
+    exit();
+  }
+  if(chdir("dd/xx") == 0){
+    1f23:	83 ec 0c             	sub    $0xc,%esp
+    1f26:	68 15 46 00 00       	push   $0x4615
+    1f2b:	e8 61 19 00 00       	call   3891 <chdir>
+    1f30:	83 c4 10             	add    $0x10,%esp
+    1f33:	85 c0                	test   %eax,%eax
+    1f35:	0f 84 fb 02 00 00    	je     2236 <subdir+0x6b6>
+    printf(1, "chdir dd/xx succeeded!\n");
+    exit();
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    1f3b:	83 ec 0c             	sub    $0xc,%esp
+    1f3e:	68 ca 44 00 00       	push   $0x44ca
+    1f43:	e8 29 19 00 00       	call   3871 <unlink>
+    1f48:	83 c4 10             	add    $0x10,%esp
+    1f4b:	85 c0                	test   %eax,%eax
+    1f4d:	0f 85 f7 02 00 00    	jne    224a <subdir+0x6ca>
+    printf(1, "unlink dd/dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd/ff") != 0){
+    1f53:	83 ec 0c             	sub    $0xc,%esp
+    1f56:	68 69 44 00 00       	push   $0x4469
+    1f5b:	e8 11 19 00 00       	call   3871 <unlink>
+    1f60:	83 c4 10             	add    $0x10,%esp
+    1f63:	85 c0                	test   %eax,%eax
+    1f65:	0f 85 f3 02 00 00    	jne    225e <subdir+0x6de>
+    printf(1, "unlink dd/ff failed\n");
+    exit();
+  }
+  if(unlink("dd") == 0){
+    1f6b:	83 ec 0c             	sub    $0xc,%esp
+    1f6e:	68 30 45 00 00       	push   $0x4530
+    1f73:	e8 f9 18 00 00       	call   3871 <unlink>
+    1f78:	83 c4 10             	add    $0x10,%esp
+    1f7b:	85 c0                	test   %eax,%eax
+    1f7d:	0f 84 ef 02 00 00    	je     2272 <subdir+0x6f2>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    exit();
+  }
+  if(unlink("dd/dd") < 0){
+    1f83:	83 ec 0c             	sub    $0xc,%esp
+    1f86:	68 45 44 00 00       	push   $0x4445
+    1f8b:	e8 e1 18 00 00       	call   3871 <unlink>
+    1f90:	83 c4 10             	add    $0x10,%esp
+    1f93:	85 c0                	test   %eax,%eax
+    1f95:	0f 88 eb 02 00 00    	js     2286 <subdir+0x706>
+    printf(1, "unlink dd/dd failed\n");
+    exit();
+  }
+  if(unlink("dd") < 0){
+    1f9b:	83 ec 0c             	sub    $0xc,%esp
+    1f9e:	68 30 45 00 00       	push   $0x4530
+    1fa3:	e8 c9 18 00 00       	call   3871 <unlink>
+    1fa8:	83 c4 10             	add    $0x10,%esp
+    1fab:	85 c0                	test   %eax,%eax
+    1fad:	0f 88 e7 02 00 00    	js     229a <subdir+0x71a>
+    printf(1, "unlink dd failed\n");
+    exit();
+  }
+
+  printf(1, "subdir ok\n");
+    1fb3:	83 ec 08             	sub    $0x8,%esp
+    1fb6:	68 12 47 00 00       	push   $0x4712
+    1fbb:	6a 01                	push   $0x1
+    1fbd:	e8 07 1a 00 00       	call   39c9 <printf>
+}
+    1fc2:	83 c4 10             	add    $0x10,%esp
+    1fc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1fc8:	c9                   	leave
+    1fc9:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    1fca:	83 ec 08             	sub    $0x8,%esp
+    1fcd:	68 17 44 00 00       	push   $0x4417
+    1fd2:	6a 01                	push   $0x1
+    1fd4:	e8 f0 19 00 00       	call   39c9 <printf>
+    exit();
+    1fd9:	e8 43 18 00 00       	call   3821 <exit>
+    printf(1, "create dd/ff failed\n");
+    1fde:	83 ec 08             	sub    $0x8,%esp
+    1fe1:	68 2f 44 00 00       	push   $0x442f
+    1fe6:	6a 01                	push   $0x1
+    1fe8:	e8 dc 19 00 00       	call   39c9 <printf>
+    exit();
+    1fed:	e8 2f 18 00 00       	call   3821 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    1ff2:	83 ec 08             	sub    $0x8,%esp
+    1ff5:	68 fc 4e 00 00       	push   $0x4efc
+    1ffa:	6a 01                	push   $0x1
+    1ffc:	e8 c8 19 00 00       	call   39c9 <printf>
+    exit();
+    2001:	e8 1b 18 00 00       	call   3821 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2006:	83 ec 08             	sub    $0x8,%esp
+    2009:	68 4b 44 00 00       	push   $0x444b
+    200e:	6a 01                	push   $0x1
+    2010:	e8 b4 19 00 00       	call   39c9 <printf>
+    exit();
+    2015:	e8 07 18 00 00       	call   3821 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    201a:	83 ec 08             	sub    $0x8,%esp
+    201d:	68 6f 44 00 00       	push   $0x446f
+    2022:	6a 01                	push   $0x1
+    2024:	e8 a0 19 00 00       	call   39c9 <printf>
+    exit();
+    2029:	e8 f3 17 00 00       	call   3821 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    202e:	83 ec 08             	sub    $0x8,%esp
+    2031:	68 96 44 00 00       	push   $0x4496
+    2036:	6a 01                	push   $0x1
+    2038:	e8 8c 19 00 00       	call   39c9 <printf>
+    exit();
+    203d:	e8 df 17 00 00       	call   3821 <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    2042:	83 ec 08             	sub    $0x8,%esp
+    2045:	68 af 44 00 00       	push   $0x44af
+    204a:	6a 01                	push   $0x1
+    204c:	e8 78 19 00 00       	call   39c9 <printf>
+    exit();
+    2051:	e8 cb 17 00 00       	call   3821 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2056:	83 ec 08             	sub    $0x8,%esp
+    2059:	68 24 4f 00 00       	push   $0x4f24
+    205e:	6a 01                	push   $0x1
+    2060:	e8 64 19 00 00       	call   39c9 <printf>
+    exit();
+    2065:	e8 b7 17 00 00       	call   3821 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    206a:	83 ec 08             	sub    $0x8,%esp
+    206d:	68 d5 44 00 00       	push   $0x44d5
+    2072:	6a 01                	push   $0x1
+    2074:	e8 50 19 00 00       	call   39c9 <printf>
+    exit();
+    2079:	e8 a3 17 00 00       	call   3821 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    207e:	83 ec 08             	sub    $0x8,%esp
+    2081:	68 48 4f 00 00       	push   $0x4f48
+    2086:	6a 01                	push   $0x1
+    2088:	e8 3c 19 00 00       	call   39c9 <printf>
+    exit();
+    208d:	e8 8f 17 00 00       	call   3821 <exit>
+    printf(1, "chdir dd failed\n");
+    2092:	83 ec 08             	sub    $0x8,%esp
+    2095:	68 ed 44 00 00       	push   $0x44ed
+    209a:	6a 01                	push   $0x1
+    209c:	e8 28 19 00 00       	call   39c9 <printf>
+    exit();
+    20a1:	e8 7b 17 00 00       	call   3821 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    20a6:	83 ec 08             	sub    $0x8,%esp
+    20a9:	68 0a 45 00 00       	push   $0x450a
+    20ae:	6a 01                	push   $0x1
+    20b0:	e8 14 19 00 00       	call   39c9 <printf>
+    exit();
+    20b5:	e8 67 17 00 00       	call   3821 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    20ba:	83 ec 08             	sub    $0x8,%esp
+    20bd:	68 0a 45 00 00       	push   $0x450a
+    20c2:	6a 01                	push   $0x1
+    20c4:	e8 00 19 00 00       	call   39c9 <printf>
+    exit();
+    20c9:	e8 53 17 00 00       	call   3821 <exit>
+    printf(1, "chdir ./.. failed\n");
+    20ce:	83 ec 08             	sub    $0x8,%esp
+    20d1:	68 38 45 00 00       	push   $0x4538
+    20d6:	6a 01                	push   $0x1
+    20d8:	e8 ec 18 00 00       	call   39c9 <printf>
+    exit();
+    20dd:	e8 3f 17 00 00       	call   3821 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    20e2:	83 ec 08             	sub    $0x8,%esp
+    20e5:	68 4b 45 00 00       	push   $0x454b
+    20ea:	6a 01                	push   $0x1
+    20ec:	e8 d8 18 00 00       	call   39c9 <printf>
+    exit();
+    20f1:	e8 2b 17 00 00       	call   3821 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    20f6:	83 ec 08             	sub    $0x8,%esp
+    20f9:	68 63 45 00 00       	push   $0x4563
+    20fe:	6a 01                	push   $0x1
+    2100:	e8 c4 18 00 00       	call   39c9 <printf>
+    exit();
+    2105:	e8 17 17 00 00       	call   3821 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    210a:	83 ec 08             	sub    $0x8,%esp
+    210d:	68 6c 4f 00 00       	push   $0x4f6c
+    2112:	6a 01                	push   $0x1
+    2114:	e8 b0 18 00 00       	call   39c9 <printf>
+    exit();
+    2119:	e8 03 17 00 00       	call   3821 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    211e:	83 ec 08             	sub    $0x8,%esp
+    2121:	68 87 45 00 00       	push   $0x4587
+    2126:	6a 01                	push   $0x1
+    2128:	e8 9c 18 00 00       	call   39c9 <printf>
+    exit();
+    212d:	e8 ef 16 00 00       	call   3821 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2132:	83 ec 08             	sub    $0x8,%esp
+    2135:	68 ac 45 00 00       	push   $0x45ac
+    213a:	6a 01                	push   $0x1
+    213c:	e8 88 18 00 00       	call   39c9 <printf>
+    exit();
+    2141:	e8 db 16 00 00       	call   3821 <exit>
+    printf(1, "create dd succeeded!\n");
+    2146:	83 ec 08             	sub    $0x8,%esp
+    2149:	68 c8 45 00 00       	push   $0x45c8
+    214e:	6a 01                	push   $0x1
+    2150:	e8 74 18 00 00       	call   39c9 <printf>
+    exit();
+    2155:	e8 c7 16 00 00       	call   3821 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    215a:	83 ec 08             	sub    $0x8,%esp
+    215d:	68 de 45 00 00       	push   $0x45de
+    2162:	6a 01                	push   $0x1
+    2164:	e8 60 18 00 00       	call   39c9 <printf>
+    exit();
+    2169:	e8 b3 16 00 00       	call   3821 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    216e:	83 ec 08             	sub    $0x8,%esp
+    2171:	68 f7 45 00 00       	push   $0x45f7
+    2176:	6a 01                	push   $0x1
+    2178:	e8 4c 18 00 00       	call   39c9 <printf>
+    exit();
+    217d:	e8 9f 16 00 00       	call   3821 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    2182:	83 ec 08             	sub    $0x8,%esp
+    2185:	68 94 4f 00 00       	push   $0x4f94
+    218a:	6a 01                	push   $0x1
+    218c:	e8 38 18 00 00       	call   39c9 <printf>
+    exit();
+    2191:	e8 8b 16 00 00       	call   3821 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2196:	83 ec 08             	sub    $0x8,%esp
+    2199:	68 b8 4f 00 00       	push   $0x4fb8
+    219e:	6a 01                	push   $0x1
+    21a0:	e8 24 18 00 00       	call   39c9 <printf>
+    exit();
+    21a5:	e8 77 16 00 00       	call   3821 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    21aa:	83 ec 08             	sub    $0x8,%esp
+    21ad:	68 dc 4f 00 00       	push   $0x4fdc
+    21b2:	6a 01                	push   $0x1
+    21b4:	e8 10 18 00 00       	call   39c9 <printf>
+    exit();
+    21b9:	e8 63 16 00 00       	call   3821 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    21be:	83 ec 08             	sub    $0x8,%esp
+    21c1:	68 1b 46 00 00       	push   $0x461b
+    21c6:	6a 01                	push   $0x1
+    21c8:	e8 fc 17 00 00       	call   39c9 <printf>
+    exit();
+    21cd:	e8 4f 16 00 00       	call   3821 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    21d2:	83 ec 08             	sub    $0x8,%esp
+    21d5:	68 36 46 00 00       	push   $0x4636
+    21da:	6a 01                	push   $0x1
+    21dc:	e8 e8 17 00 00       	call   39c9 <printf>
+    exit();
+    21e1:	e8 3b 16 00 00       	call   3821 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    21e6:	83 ec 08             	sub    $0x8,%esp
+    21e9:	68 51 46 00 00       	push   $0x4651
+    21ee:	6a 01                	push   $0x1
+    21f0:	e8 d4 17 00 00       	call   39c9 <printf>
+    exit();
+    21f5:	e8 27 16 00 00       	call   3821 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    21fa:	83 ec 08             	sub    $0x8,%esp
+    21fd:	68 6e 46 00 00       	push   $0x466e
+    2202:	6a 01                	push   $0x1
+    2204:	e8 c0 17 00 00       	call   39c9 <printf>
+    exit();
+    2209:	e8 13 16 00 00       	call   3821 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    220e:	83 ec 08             	sub    $0x8,%esp
+    2211:	68 8a 46 00 00       	push   $0x468a
+    2216:	6a 01                	push   $0x1
+    2218:	e8 ac 17 00 00       	call   39c9 <printf>
+    exit();
+    221d:	e8 ff 15 00 00       	call   3821 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    2222:	83 ec 08             	sub    $0x8,%esp
+    2225:	68 a6 46 00 00       	push   $0x46a6
+    222a:	6a 01                	push   $0x1
+    222c:	e8 98 17 00 00       	call   39c9 <printf>
+    exit();
+    2231:	e8 eb 15 00 00       	call   3821 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2236:	83 ec 08             	sub    $0x8,%esp
+    2239:	68 be 46 00 00       	push   $0x46be
+    223e:	6a 01                	push   $0x1
+    2240:	e8 84 17 00 00       	call   39c9 <printf>
+    exit();
+    2245:	e8 d7 15 00 00       	call   3821 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    224a:	83 ec 08             	sub    $0x8,%esp
+    224d:	68 d5 44 00 00       	push   $0x44d5
+    2252:	6a 01                	push   $0x1
+    2254:	e8 70 17 00 00       	call   39c9 <printf>
+    exit();
+    2259:	e8 c3 15 00 00       	call   3821 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    225e:	83 ec 08             	sub    $0x8,%esp
+    2261:	68 d6 46 00 00       	push   $0x46d6
+    2266:	6a 01                	push   $0x1
+    2268:	e8 5c 17 00 00       	call   39c9 <printf>
+    exit();
+    226d:	e8 af 15 00 00       	call   3821 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2272:	83 ec 08             	sub    $0x8,%esp
+    2275:	68 00 50 00 00       	push   $0x5000
+    227a:	6a 01                	push   $0x1
+    227c:	e8 48 17 00 00       	call   39c9 <printf>
+    exit();
+    2281:	e8 9b 15 00 00       	call   3821 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    2286:	83 ec 08             	sub    $0x8,%esp
+    2289:	68 eb 46 00 00       	push   $0x46eb
+    228e:	6a 01                	push   $0x1
+    2290:	e8 34 17 00 00       	call   39c9 <printf>
+    exit();
+    2295:	e8 87 15 00 00       	call   3821 <exit>
+    printf(1, "unlink dd failed\n");
+    229a:	83 ec 08             	sub    $0x8,%esp
+    229d:	68 00 47 00 00       	push   $0x4700
+    22a2:	6a 01                	push   $0x1
+    22a4:	e8 20 17 00 00       	call   39c9 <printf>
+    exit();
+    22a9:	e8 73 15 00 00       	call   3821 <exit>
+
+000022ae <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    22ae:	55                   	push   %ebp
+    22af:	89 e5                	mov    %esp,%ebp
+    22b1:	57                   	push   %edi
+    22b2:	56                   	push   %esi
+    22b3:	53                   	push   %ebx
+    22b4:	83 ec 14             	sub    $0x14,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    22b7:	68 1d 47 00 00       	push   $0x471d
+    22bc:	6a 01                	push   $0x1
+    22be:	e8 06 17 00 00       	call   39c9 <printf>
+
+  unlink("bigwrite");
+    22c3:	c7 04 24 2c 47 00 00 	movl   $0x472c,(%esp)
+    22ca:	e8 a2 15 00 00       	call   3871 <unlink>
+    22cf:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    22d2:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    22d7:	83 ec 08             	sub    $0x8,%esp
+    22da:	68 02 02 00 00       	push   $0x202
+    22df:	68 2c 47 00 00       	push   $0x472c
+    22e4:	e8 78 15 00 00       	call   3861 <open>
+    22e9:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    22eb:	83 c4 10             	add    $0x10,%esp
+    22ee:	85 c0                	test   %eax,%eax
+    22f0:	78 6e                	js     2360 <bigwrite+0xb2>
+      printf(1, "cannot create bigwrite\n");
+      exit();
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+      int cc = write(fd, buf, sz);
+    22f2:	83 ec 04             	sub    $0x4,%esp
+    22f5:	53                   	push   %ebx
+    22f6:	68 80 84 00 00       	push   $0x8480
+    22fb:	50                   	push   %eax
+    22fc:	e8 40 15 00 00       	call   3841 <write>
+    2301:	89 c7                	mov    %eax,%edi
+      if(cc != sz){
+    2303:	83 c4 10             	add    $0x10,%esp
+    2306:	39 c3                	cmp    %eax,%ebx
+    2308:	75 6a                	jne    2374 <bigwrite+0xc6>
+      int cc = write(fd, buf, sz);
+    230a:	83 ec 04             	sub    $0x4,%esp
+    230d:	53                   	push   %ebx
+    230e:	68 80 84 00 00       	push   $0x8480
+    2313:	56                   	push   %esi
+    2314:	e8 28 15 00 00       	call   3841 <write>
+      if(cc != sz){
+    2319:	83 c4 10             	add    $0x10,%esp
+    231c:	39 d8                	cmp    %ebx,%eax
+    231e:	75 56                	jne    2376 <bigwrite+0xc8>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+        exit();
+      }
+    }
+    close(fd);
+    2320:	83 ec 0c             	sub    $0xc,%esp
+    2323:	56                   	push   %esi
+    2324:	e8 20 15 00 00       	call   3849 <close>
+    unlink("bigwrite");
+    2329:	c7 04 24 2c 47 00 00 	movl   $0x472c,(%esp)
+    2330:	e8 3c 15 00 00       	call   3871 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2335:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    233b:	83 c4 10             	add    $0x10,%esp
+    233e:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    2344:	75 91                	jne    22d7 <bigwrite+0x29>
+  }
+
+  printf(1, "bigwrite ok\n");
+    2346:	83 ec 08             	sub    $0x8,%esp
+    2349:	68 5f 47 00 00       	push   $0x475f
+    234e:	6a 01                	push   $0x1
+    2350:	e8 74 16 00 00       	call   39c9 <printf>
+}
+    2355:	83 c4 10             	add    $0x10,%esp
+    2358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    235b:	5b                   	pop    %ebx
+    235c:	5e                   	pop    %esi
+    235d:	5f                   	pop    %edi
+    235e:	5d                   	pop    %ebp
+    235f:	c3                   	ret
+      printf(1, "cannot create bigwrite\n");
+    2360:	83 ec 08             	sub    $0x8,%esp
+    2363:	68 35 47 00 00       	push   $0x4735
+    2368:	6a 01                	push   $0x1
+    236a:	e8 5a 16 00 00       	call   39c9 <printf>
+      exit();
+    236f:	e8 ad 14 00 00       	call   3821 <exit>
+      if(cc != sz){
+    2374:	89 df                	mov    %ebx,%edi
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2376:	50                   	push   %eax
+    2377:	57                   	push   %edi
+    2378:	68 4d 47 00 00       	push   $0x474d
+    237d:	6a 01                	push   $0x1
+    237f:	e8 45 16 00 00       	call   39c9 <printf>
+        exit();
+    2384:	e8 98 14 00 00       	call   3821 <exit>
+
+00002389 <bigfile>:
+
+void
+bigfile(void)
+{
+    2389:	55                   	push   %ebp
+    238a:	89 e5                	mov    %esp,%ebp
+    238c:	57                   	push   %edi
+    238d:	56                   	push   %esi
+    238e:	53                   	push   %ebx
+    238f:	83 ec 14             	sub    $0x14,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2392:	68 6c 47 00 00       	push   $0x476c
+    2397:	6a 01                	push   $0x1
+    2399:	e8 2b 16 00 00       	call   39c9 <printf>
+
+  unlink("bigfile");
+    239e:	c7 04 24 88 47 00 00 	movl   $0x4788,(%esp)
+    23a5:	e8 c7 14 00 00       	call   3871 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    23aa:	83 c4 08             	add    $0x8,%esp
+    23ad:	68 02 02 00 00       	push   $0x202
+    23b2:	68 88 47 00 00       	push   $0x4788
+    23b7:	e8 a5 14 00 00       	call   3861 <open>
+  if(fd < 0){
+    23bc:	83 c4 10             	add    $0x10,%esp
+    23bf:	85 c0                	test   %eax,%eax
+    23c1:	0f 88 c3 00 00 00    	js     248a <bigfile+0x101>
+    23c7:	89 c6                	mov    %eax,%esi
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    23c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    memset(buf, i, 600);
+    23ce:	83 ec 04             	sub    $0x4,%esp
+    23d1:	68 58 02 00 00       	push   $0x258
+    23d6:	53                   	push   %ebx
+    23d7:	68 80 84 00 00       	push   $0x8480
+    23dc:	e8 ed 12 00 00       	call   36ce <memset>
+    if(write(fd, buf, 600) != 600){
+    23e1:	83 c4 0c             	add    $0xc,%esp
+    23e4:	68 58 02 00 00       	push   $0x258
+    23e9:	68 80 84 00 00       	push   $0x8480
+    23ee:	56                   	push   %esi
+    23ef:	e8 4d 14 00 00       	call   3841 <write>
+    23f4:	83 c4 10             	add    $0x10,%esp
+    23f7:	3d 58 02 00 00       	cmp    $0x258,%eax
+    23fc:	0f 85 9c 00 00 00    	jne    249e <bigfile+0x115>
+  for(i = 0; i < 20; i++){
+    2402:	83 c3 01             	add    $0x1,%ebx
+    2405:	83 fb 14             	cmp    $0x14,%ebx
+    2408:	75 c4                	jne    23ce <bigfile+0x45>
+      printf(1, "write bigfile failed\n");
+      exit();
+    }
+  }
+  close(fd);
+    240a:	83 ec 0c             	sub    $0xc,%esp
+    240d:	56                   	push   %esi
+    240e:	e8 36 14 00 00       	call   3849 <close>
+
+  fd = open("bigfile", 0);
+    2413:	83 c4 08             	add    $0x8,%esp
+    2416:	6a 00                	push   $0x0
+    2418:	68 88 47 00 00       	push   $0x4788
+    241d:	e8 3f 14 00 00       	call   3861 <open>
+    2422:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    2424:	83 c4 10             	add    $0x10,%esp
+    2427:	85 c0                	test   %eax,%eax
+    2429:	0f 88 83 00 00 00    	js     24b2 <bigfile+0x129>
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+    242f:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    2434:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    2439:	83 ec 04             	sub    $0x4,%esp
+    243c:	68 2c 01 00 00       	push   $0x12c
+    2441:	68 80 84 00 00       	push   $0x8480
+    2446:	57                   	push   %edi
+    2447:	e8 ed 13 00 00       	call   3839 <read>
+    if(cc < 0){
+    244c:	83 c4 10             	add    $0x10,%esp
+    244f:	85 c0                	test   %eax,%eax
+    2451:	78 73                	js     24c6 <bigfile+0x13d>
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+    2453:	0f 84 a9 00 00 00    	je     2502 <bigfile+0x179>
+      break;
+    if(cc != 300){
+    2459:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    245e:	75 7a                	jne    24da <bigfile+0x151>
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2460:	89 d8                	mov    %ebx,%eax
+    2462:	c1 e8 1f             	shr    $0x1f,%eax
+    2465:	01 d8                	add    %ebx,%eax
+    2467:	d1 f8                	sar    %eax
+    2469:	0f be 15 80 84 00 00 	movsbl 0x8480,%edx
+    2470:	39 c2                	cmp    %eax,%edx
+    2472:	75 7a                	jne    24ee <bigfile+0x165>
+    2474:	0f be 15 ab 85 00 00 	movsbl 0x85ab,%edx
+    247b:	39 d0                	cmp    %edx,%eax
+    247d:	75 6f                	jne    24ee <bigfile+0x165>
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+    247f:	81 c6 2c 01 00 00    	add    $0x12c,%esi
+  for(i = 0; ; i++){
+    2485:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    2488:	eb af                	jmp    2439 <bigfile+0xb0>
+    printf(1, "cannot create bigfile");
+    248a:	83 ec 08             	sub    $0x8,%esp
+    248d:	68 7a 47 00 00       	push   $0x477a
+    2492:	6a 01                	push   $0x1
+    2494:	e8 30 15 00 00       	call   39c9 <printf>
+    exit();
+    2499:	e8 83 13 00 00       	call   3821 <exit>
+      printf(1, "write bigfile failed\n");
+    249e:	83 ec 08             	sub    $0x8,%esp
+    24a1:	68 90 47 00 00       	push   $0x4790
+    24a6:	6a 01                	push   $0x1
+    24a8:	e8 1c 15 00 00       	call   39c9 <printf>
+      exit();
+    24ad:	e8 6f 13 00 00       	call   3821 <exit>
+    printf(1, "cannot open bigfile\n");
+    24b2:	83 ec 08             	sub    $0x8,%esp
+    24b5:	68 a6 47 00 00       	push   $0x47a6
+    24ba:	6a 01                	push   $0x1
+    24bc:	e8 08 15 00 00       	call   39c9 <printf>
+    exit();
+    24c1:	e8 5b 13 00 00       	call   3821 <exit>
+      printf(1, "read bigfile failed\n");
+    24c6:	83 ec 08             	sub    $0x8,%esp
+    24c9:	68 bb 47 00 00       	push   $0x47bb
+    24ce:	6a 01                	push   $0x1
+    24d0:	e8 f4 14 00 00       	call   39c9 <printf>
+      exit();
+    24d5:	e8 47 13 00 00       	call   3821 <exit>
+      printf(1, "short read bigfile\n");
+    24da:	83 ec 08             	sub    $0x8,%esp
+    24dd:	68 d0 47 00 00       	push   $0x47d0
+    24e2:	6a 01                	push   $0x1
+    24e4:	e8 e0 14 00 00       	call   39c9 <printf>
+      exit();
+    24e9:	e8 33 13 00 00       	call   3821 <exit>
+      printf(1, "read bigfile wrong data\n");
+    24ee:	83 ec 08             	sub    $0x8,%esp
+    24f1:	68 e4 47 00 00       	push   $0x47e4
+    24f6:	6a 01                	push   $0x1
+    24f8:	e8 cc 14 00 00       	call   39c9 <printf>
+      exit();
+    24fd:	e8 1f 13 00 00       	call   3821 <exit>
+  }
+  close(fd);
+    2502:	83 ec 0c             	sub    $0xc,%esp
+    2505:	57                   	push   %edi
+    2506:	e8 3e 13 00 00       	call   3849 <close>
+  if(total != 20*600){
+    250b:	83 c4 10             	add    $0x10,%esp
+    250e:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    2514:	75 27                	jne    253d <bigfile+0x1b4>
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+    2516:	83 ec 0c             	sub    $0xc,%esp
+    2519:	68 88 47 00 00       	push   $0x4788
+    251e:	e8 4e 13 00 00       	call   3871 <unlink>
+
+  printf(1, "bigfile test ok\n");
+    2523:	83 c4 08             	add    $0x8,%esp
+    2526:	68 17 48 00 00       	push   $0x4817
+    252b:	6a 01                	push   $0x1
+    252d:	e8 97 14 00 00       	call   39c9 <printf>
+}
+    2532:	83 c4 10             	add    $0x10,%esp
+    2535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2538:	5b                   	pop    %ebx
+    2539:	5e                   	pop    %esi
+    253a:	5f                   	pop    %edi
+    253b:	5d                   	pop    %ebp
+    253c:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    253d:	83 ec 08             	sub    $0x8,%esp
+    2540:	68 fd 47 00 00       	push   $0x47fd
+    2545:	6a 01                	push   $0x1
+    2547:	e8 7d 14 00 00       	call   39c9 <printf>
+    exit();
+    254c:	e8 d0 12 00 00       	call   3821 <exit>
+
+00002551 <fourteen>:
+
+void
+fourteen(void)
+{
+    2551:	55                   	push   %ebp
+    2552:	89 e5                	mov    %esp,%ebp
+    2554:	83 ec 10             	sub    $0x10,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    2557:	68 28 48 00 00       	push   $0x4828
+    255c:	6a 01                	push   $0x1
+    255e:	e8 66 14 00 00       	call   39c9 <printf>
+
+  if(mkdir("12345678901234") != 0){
+    2563:	c7 04 24 63 48 00 00 	movl   $0x4863,(%esp)
+    256a:	e8 1a 13 00 00       	call   3889 <mkdir>
+    256f:	83 c4 10             	add    $0x10,%esp
+    2572:	85 c0                	test   %eax,%eax
+    2574:	0f 85 9c 00 00 00    	jne    2616 <fourteen+0xc5>
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    257a:	83 ec 0c             	sub    $0xc,%esp
+    257d:	68 20 50 00 00       	push   $0x5020
+    2582:	e8 02 13 00 00       	call   3889 <mkdir>
+    2587:	83 c4 10             	add    $0x10,%esp
+    258a:	85 c0                	test   %eax,%eax
+    258c:	0f 85 98 00 00 00    	jne    262a <fourteen+0xd9>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2592:	83 ec 08             	sub    $0x8,%esp
+    2595:	68 00 02 00 00       	push   $0x200
+    259a:	68 70 50 00 00       	push   $0x5070
+    259f:	e8 bd 12 00 00       	call   3861 <open>
+  if(fd < 0){
+    25a4:	83 c4 10             	add    $0x10,%esp
+    25a7:	85 c0                	test   %eax,%eax
+    25a9:	0f 88 8f 00 00 00    	js     263e <fourteen+0xed>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+    25af:	83 ec 0c             	sub    $0xc,%esp
+    25b2:	50                   	push   %eax
+    25b3:	e8 91 12 00 00       	call   3849 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    25b8:	83 c4 08             	add    $0x8,%esp
+    25bb:	6a 00                	push   $0x0
+    25bd:	68 e0 50 00 00       	push   $0x50e0
+    25c2:	e8 9a 12 00 00       	call   3861 <open>
+  if(fd < 0){
+    25c7:	83 c4 10             	add    $0x10,%esp
+    25ca:	85 c0                	test   %eax,%eax
+    25cc:	0f 88 80 00 00 00    	js     2652 <fourteen+0x101>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+    25d2:	83 ec 0c             	sub    $0xc,%esp
+    25d5:	50                   	push   %eax
+    25d6:	e8 6e 12 00 00       	call   3849 <close>
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    25db:	c7 04 24 54 48 00 00 	movl   $0x4854,(%esp)
+    25e2:	e8 a2 12 00 00       	call   3889 <mkdir>
+    25e7:	83 c4 10             	add    $0x10,%esp
+    25ea:	85 c0                	test   %eax,%eax
+    25ec:	74 78                	je     2666 <fourteen+0x115>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    25ee:	83 ec 0c             	sub    $0xc,%esp
+    25f1:	68 7c 51 00 00       	push   $0x517c
+    25f6:	e8 8e 12 00 00       	call   3889 <mkdir>
+    25fb:	83 c4 10             	add    $0x10,%esp
+    25fe:	85 c0                	test   %eax,%eax
+    2600:	74 78                	je     267a <fourteen+0x129>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+    2602:	83 ec 08             	sub    $0x8,%esp
+    2605:	68 72 48 00 00       	push   $0x4872
+    260a:	6a 01                	push   $0x1
+    260c:	e8 b8 13 00 00       	call   39c9 <printf>
+}
+    2611:	83 c4 10             	add    $0x10,%esp
+    2614:	c9                   	leave
+    2615:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2616:	83 ec 08             	sub    $0x8,%esp
+    2619:	68 37 48 00 00       	push   $0x4837
+    261e:	6a 01                	push   $0x1
+    2620:	e8 a4 13 00 00       	call   39c9 <printf>
+    exit();
+    2625:	e8 f7 11 00 00       	call   3821 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    262a:	83 ec 08             	sub    $0x8,%esp
+    262d:	68 40 50 00 00       	push   $0x5040
+    2632:	6a 01                	push   $0x1
+    2634:	e8 90 13 00 00       	call   39c9 <printf>
+    exit();
+    2639:	e8 e3 11 00 00       	call   3821 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    263e:	83 ec 08             	sub    $0x8,%esp
+    2641:	68 a0 50 00 00       	push   $0x50a0
+    2646:	6a 01                	push   $0x1
+    2648:	e8 7c 13 00 00       	call   39c9 <printf>
+    exit();
+    264d:	e8 cf 11 00 00       	call   3821 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2652:	83 ec 08             	sub    $0x8,%esp
+    2655:	68 10 51 00 00       	push   $0x5110
+    265a:	6a 01                	push   $0x1
+    265c:	e8 68 13 00 00       	call   39c9 <printf>
+    exit();
+    2661:	e8 bb 11 00 00       	call   3821 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2666:	83 ec 08             	sub    $0x8,%esp
+    2669:	68 4c 51 00 00       	push   $0x514c
+    266e:	6a 01                	push   $0x1
+    2670:	e8 54 13 00 00       	call   39c9 <printf>
+    exit();
+    2675:	e8 a7 11 00 00       	call   3821 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    267a:	83 ec 08             	sub    $0x8,%esp
+    267d:	68 9c 51 00 00       	push   $0x519c
+    2682:	6a 01                	push   $0x1
+    2684:	e8 40 13 00 00       	call   39c9 <printf>
+    exit();
+    2689:	e8 93 11 00 00       	call   3821 <exit>
+
+0000268e <rmdot>:
+
+void
+rmdot(void)
+{
+    268e:	55                   	push   %ebp
+    268f:	89 e5                	mov    %esp,%ebp
+    2691:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2694:	68 7f 48 00 00       	push   $0x487f
+    2699:	6a 01                	push   $0x1
+    269b:	e8 29 13 00 00       	call   39c9 <printf>
+  if(mkdir("dots") != 0){
+    26a0:	c7 04 24 8b 48 00 00 	movl   $0x488b,(%esp)
+    26a7:	e8 dd 11 00 00       	call   3889 <mkdir>
+    26ac:	83 c4 10             	add    $0x10,%esp
+    26af:	85 c0                	test   %eax,%eax
+    26b1:	0f 85 bc 00 00 00    	jne    2773 <rmdot+0xe5>
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    26b7:	83 ec 0c             	sub    $0xc,%esp
+    26ba:	68 8b 48 00 00       	push   $0x488b
+    26bf:	e8 cd 11 00 00       	call   3891 <chdir>
+    26c4:	83 c4 10             	add    $0x10,%esp
+    26c7:	85 c0                	test   %eax,%eax
+    26c9:	0f 85 b8 00 00 00    	jne    2787 <rmdot+0xf9>
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    26cf:	83 ec 0c             	sub    $0xc,%esp
+    26d2:	68 36 45 00 00       	push   $0x4536
+    26d7:	e8 95 11 00 00       	call   3871 <unlink>
+    26dc:	83 c4 10             	add    $0x10,%esp
+    26df:	85 c0                	test   %eax,%eax
+    26e1:	0f 84 b4 00 00 00    	je     279b <rmdot+0x10d>
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    26e7:	83 ec 0c             	sub    $0xc,%esp
+    26ea:	68 35 45 00 00       	push   $0x4535
+    26ef:	e8 7d 11 00 00       	call   3871 <unlink>
+    26f4:	83 c4 10             	add    $0x10,%esp
+    26f7:	85 c0                	test   %eax,%eax
+    26f9:	0f 84 b0 00 00 00    	je     27af <rmdot+0x121>
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    26ff:	83 ec 0c             	sub    $0xc,%esp
+    2702:	68 09 3d 00 00       	push   $0x3d09
+    2707:	e8 85 11 00 00       	call   3891 <chdir>
+    270c:	83 c4 10             	add    $0x10,%esp
+    270f:	85 c0                	test   %eax,%eax
+    2711:	0f 85 ac 00 00 00    	jne    27c3 <rmdot+0x135>
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    2717:	83 ec 0c             	sub    $0xc,%esp
+    271a:	68 d3 48 00 00       	push   $0x48d3
+    271f:	e8 4d 11 00 00       	call   3871 <unlink>
+    2724:	83 c4 10             	add    $0x10,%esp
+    2727:	85 c0                	test   %eax,%eax
+    2729:	0f 84 a8 00 00 00    	je     27d7 <rmdot+0x149>
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    272f:	83 ec 0c             	sub    $0xc,%esp
+    2732:	68 f1 48 00 00       	push   $0x48f1
+    2737:	e8 35 11 00 00       	call   3871 <unlink>
+    273c:	83 c4 10             	add    $0x10,%esp
+    273f:	85 c0                	test   %eax,%eax
+    2741:	0f 84 a4 00 00 00    	je     27eb <rmdot+0x15d>
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    2747:	83 ec 0c             	sub    $0xc,%esp
+    274a:	68 8b 48 00 00       	push   $0x488b
+    274f:	e8 1d 11 00 00       	call   3871 <unlink>
+    2754:	83 c4 10             	add    $0x10,%esp
+    2757:	85 c0                	test   %eax,%eax
+    2759:	0f 85 a0 00 00 00    	jne    27ff <rmdot+0x171>
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+    275f:	83 ec 08             	sub    $0x8,%esp
+    2762:	68 26 49 00 00       	push   $0x4926
+    2767:	6a 01                	push   $0x1
+    2769:	e8 5b 12 00 00       	call   39c9 <printf>
+}
+    276e:	83 c4 10             	add    $0x10,%esp
+    2771:	c9                   	leave
+    2772:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2773:	83 ec 08             	sub    $0x8,%esp
+    2776:	68 90 48 00 00       	push   $0x4890
+    277b:	6a 01                	push   $0x1
+    277d:	e8 47 12 00 00       	call   39c9 <printf>
+    exit();
+    2782:	e8 9a 10 00 00       	call   3821 <exit>
+    printf(1, "chdir dots failed\n");
+    2787:	83 ec 08             	sub    $0x8,%esp
+    278a:	68 a3 48 00 00       	push   $0x48a3
+    278f:	6a 01                	push   $0x1
+    2791:	e8 33 12 00 00       	call   39c9 <printf>
+    exit();
+    2796:	e8 86 10 00 00       	call   3821 <exit>
+    printf(1, "rm . worked!\n");
+    279b:	83 ec 08             	sub    $0x8,%esp
+    279e:	68 b6 48 00 00       	push   $0x48b6
+    27a3:	6a 01                	push   $0x1
+    27a5:	e8 1f 12 00 00       	call   39c9 <printf>
+    exit();
+    27aa:	e8 72 10 00 00       	call   3821 <exit>
+    printf(1, "rm .. worked!\n");
+    27af:	83 ec 08             	sub    $0x8,%esp
+    27b2:	68 c4 48 00 00       	push   $0x48c4
+    27b7:	6a 01                	push   $0x1
+    27b9:	e8 0b 12 00 00       	call   39c9 <printf>
+    exit();
+    27be:	e8 5e 10 00 00       	call   3821 <exit>
+    printf(1, "chdir / failed\n");
+    27c3:	83 ec 08             	sub    $0x8,%esp
+    27c6:	68 0b 3d 00 00       	push   $0x3d0b
+    27cb:	6a 01                	push   $0x1
+    27cd:	e8 f7 11 00 00       	call   39c9 <printf>
+    exit();
+    27d2:	e8 4a 10 00 00       	call   3821 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    27d7:	83 ec 08             	sub    $0x8,%esp
+    27da:	68 da 48 00 00       	push   $0x48da
+    27df:	6a 01                	push   $0x1
+    27e1:	e8 e3 11 00 00       	call   39c9 <printf>
+    exit();
+    27e6:	e8 36 10 00 00       	call   3821 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    27eb:	83 ec 08             	sub    $0x8,%esp
+    27ee:	68 f9 48 00 00       	push   $0x48f9
+    27f3:	6a 01                	push   $0x1
+    27f5:	e8 cf 11 00 00       	call   39c9 <printf>
+    exit();
+    27fa:	e8 22 10 00 00       	call   3821 <exit>
+    printf(1, "unlink dots failed!\n");
+    27ff:	83 ec 08             	sub    $0x8,%esp
+    2802:	68 11 49 00 00       	push   $0x4911
+    2807:	6a 01                	push   $0x1
+    2809:	e8 bb 11 00 00       	call   39c9 <printf>
+    exit();
+    280e:	e8 0e 10 00 00       	call   3821 <exit>
+
+00002813 <dirfile>:
+
+void
+dirfile(void)
+{
+    2813:	55                   	push   %ebp
+    2814:	89 e5                	mov    %esp,%ebp
+    2816:	53                   	push   %ebx
+    2817:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    281a:	68 30 49 00 00       	push   $0x4930
+    281f:	6a 01                	push   $0x1
+    2821:	e8 a3 11 00 00       	call   39c9 <printf>
+
+  fd = open("dirfile", O_CREATE);
+    2826:	83 c4 08             	add    $0x8,%esp
+    2829:	68 00 02 00 00       	push   $0x200
+    282e:	68 3d 49 00 00       	push   $0x493d
+    2833:	e8 29 10 00 00       	call   3861 <open>
+  if(fd < 0){
+    2838:	83 c4 10             	add    $0x10,%esp
+    283b:	85 c0                	test   %eax,%eax
+    283d:	0f 88 22 01 00 00    	js     2965 <dirfile+0x152>
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+    2843:	83 ec 0c             	sub    $0xc,%esp
+    2846:	50                   	push   %eax
+    2847:	e8 fd 0f 00 00       	call   3849 <close>
+  if(chdir("dirfile") == 0){
+    284c:	c7 04 24 3d 49 00 00 	movl   $0x493d,(%esp)
+    2853:	e8 39 10 00 00       	call   3891 <chdir>
+    2858:	83 c4 10             	add    $0x10,%esp
+    285b:	85 c0                	test   %eax,%eax
+    285d:	0f 84 16 01 00 00    	je     2979 <dirfile+0x166>
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+    2863:	83 ec 08             	sub    $0x8,%esp
+    2866:	6a 00                	push   $0x0
+    2868:	68 76 49 00 00       	push   $0x4976
+    286d:	e8 ef 0f 00 00       	call   3861 <open>
+  if(fd >= 0){
+    2872:	83 c4 10             	add    $0x10,%esp
+    2875:	85 c0                	test   %eax,%eax
+    2877:	0f 89 10 01 00 00    	jns    298d <dirfile+0x17a>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    287d:	83 ec 08             	sub    $0x8,%esp
+    2880:	68 00 02 00 00       	push   $0x200
+    2885:	68 76 49 00 00       	push   $0x4976
+    288a:	e8 d2 0f 00 00       	call   3861 <open>
+  if(fd >= 0){
+    288f:	83 c4 10             	add    $0x10,%esp
+    2892:	85 c0                	test   %eax,%eax
+    2894:	0f 89 07 01 00 00    	jns    29a1 <dirfile+0x18e>
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    289a:	83 ec 0c             	sub    $0xc,%esp
+    289d:	68 76 49 00 00       	push   $0x4976
+    28a2:	e8 e2 0f 00 00       	call   3889 <mkdir>
+    28a7:	83 c4 10             	add    $0x10,%esp
+    28aa:	85 c0                	test   %eax,%eax
+    28ac:	0f 84 03 01 00 00    	je     29b5 <dirfile+0x1a2>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    28b2:	83 ec 0c             	sub    $0xc,%esp
+    28b5:	68 76 49 00 00       	push   $0x4976
+    28ba:	e8 b2 0f 00 00       	call   3871 <unlink>
+    28bf:	83 c4 10             	add    $0x10,%esp
+    28c2:	85 c0                	test   %eax,%eax
+    28c4:	0f 84 ff 00 00 00    	je     29c9 <dirfile+0x1b6>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    28ca:	83 ec 08             	sub    $0x8,%esp
+    28cd:	68 76 49 00 00       	push   $0x4976
+    28d2:	68 da 49 00 00       	push   $0x49da
+    28d7:	e8 a5 0f 00 00       	call   3881 <link>
+    28dc:	83 c4 10             	add    $0x10,%esp
+    28df:	85 c0                	test   %eax,%eax
+    28e1:	0f 84 f6 00 00 00    	je     29dd <dirfile+0x1ca>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    28e7:	83 ec 0c             	sub    $0xc,%esp
+    28ea:	68 3d 49 00 00       	push   $0x493d
+    28ef:	e8 7d 0f 00 00       	call   3871 <unlink>
+    28f4:	83 c4 10             	add    $0x10,%esp
+    28f7:	85 c0                	test   %eax,%eax
+    28f9:	0f 85 f2 00 00 00    	jne    29f1 <dirfile+0x1de>
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+    28ff:	83 ec 08             	sub    $0x8,%esp
+    2902:	6a 02                	push   $0x2
+    2904:	68 36 45 00 00       	push   $0x4536
+    2909:	e8 53 0f 00 00       	call   3861 <open>
+  if(fd >= 0){
+    290e:	83 c4 10             	add    $0x10,%esp
+    2911:	85 c0                	test   %eax,%eax
+    2913:	0f 89 ec 00 00 00    	jns    2a05 <dirfile+0x1f2>
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+    2919:	83 ec 08             	sub    $0x8,%esp
+    291c:	6a 00                	push   $0x0
+    291e:	68 36 45 00 00       	push   $0x4536
+    2923:	e8 39 0f 00 00       	call   3861 <open>
+    2928:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    292a:	83 c4 0c             	add    $0xc,%esp
+    292d:	6a 01                	push   $0x1
+    292f:	68 19 46 00 00       	push   $0x4619
+    2934:	50                   	push   %eax
+    2935:	e8 07 0f 00 00       	call   3841 <write>
+    293a:	83 c4 10             	add    $0x10,%esp
+    293d:	85 c0                	test   %eax,%eax
+    293f:	0f 8f d4 00 00 00    	jg     2a19 <dirfile+0x206>
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+    2945:	83 ec 0c             	sub    $0xc,%esp
+    2948:	53                   	push   %ebx
+    2949:	e8 fb 0e 00 00       	call   3849 <close>
+
+  printf(1, "dir vs file OK\n");
+    294e:	83 c4 08             	add    $0x8,%esp
+    2951:	68 0d 4a 00 00       	push   $0x4a0d
+    2956:	6a 01                	push   $0x1
+    2958:	e8 6c 10 00 00       	call   39c9 <printf>
+}
+    295d:	83 c4 10             	add    $0x10,%esp
+    2960:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2963:	c9                   	leave
+    2964:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    2965:	83 ec 08             	sub    $0x8,%esp
+    2968:	68 45 49 00 00       	push   $0x4945
+    296d:	6a 01                	push   $0x1
+    296f:	e8 55 10 00 00       	call   39c9 <printf>
+    exit();
+    2974:	e8 a8 0e 00 00       	call   3821 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2979:	83 ec 08             	sub    $0x8,%esp
+    297c:	68 5c 49 00 00       	push   $0x495c
+    2981:	6a 01                	push   $0x1
+    2983:	e8 41 10 00 00       	call   39c9 <printf>
+    exit();
+    2988:	e8 94 0e 00 00       	call   3821 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    298d:	83 ec 08             	sub    $0x8,%esp
+    2990:	68 81 49 00 00       	push   $0x4981
+    2995:	6a 01                	push   $0x1
+    2997:	e8 2d 10 00 00       	call   39c9 <printf>
+    exit();
+    299c:	e8 80 0e 00 00       	call   3821 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    29a1:	83 ec 08             	sub    $0x8,%esp
+    29a4:	68 81 49 00 00       	push   $0x4981
+    29a9:	6a 01                	push   $0x1
+    29ab:	e8 19 10 00 00       	call   39c9 <printf>
+    exit();
+    29b0:	e8 6c 0e 00 00       	call   3821 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    29b5:	83 ec 08             	sub    $0x8,%esp
+    29b8:	68 9f 49 00 00       	push   $0x499f
+    29bd:	6a 01                	push   $0x1
+    29bf:	e8 05 10 00 00       	call   39c9 <printf>
+    exit();
+    29c4:	e8 58 0e 00 00       	call   3821 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    29c9:	83 ec 08             	sub    $0x8,%esp
+    29cc:	68 bc 49 00 00       	push   $0x49bc
+    29d1:	6a 01                	push   $0x1
+    29d3:	e8 f1 0f 00 00       	call   39c9 <printf>
+    exit();
+    29d8:	e8 44 0e 00 00       	call   3821 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    29dd:	83 ec 08             	sub    $0x8,%esp
+    29e0:	68 d0 51 00 00       	push   $0x51d0
+    29e5:	6a 01                	push   $0x1
+    29e7:	e8 dd 0f 00 00       	call   39c9 <printf>
+    exit();
+    29ec:	e8 30 0e 00 00       	call   3821 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    29f1:	83 ec 08             	sub    $0x8,%esp
+    29f4:	68 e1 49 00 00       	push   $0x49e1
+    29f9:	6a 01                	push   $0x1
+    29fb:	e8 c9 0f 00 00       	call   39c9 <printf>
+    exit();
+    2a00:	e8 1c 0e 00 00       	call   3821 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2a05:	83 ec 08             	sub    $0x8,%esp
+    2a08:	68 f0 51 00 00       	push   $0x51f0
+    2a0d:	6a 01                	push   $0x1
+    2a0f:	e8 b5 0f 00 00       	call   39c9 <printf>
+    exit();
+    2a14:	e8 08 0e 00 00       	call   3821 <exit>
+    printf(1, "write . succeeded!\n");
+    2a19:	83 ec 08             	sub    $0x8,%esp
+    2a1c:	68 f9 49 00 00       	push   $0x49f9
+    2a21:	6a 01                	push   $0x1
+    2a23:	e8 a1 0f 00 00       	call   39c9 <printf>
+    exit();
+    2a28:	e8 f4 0d 00 00       	call   3821 <exit>
+
+00002a2d <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    2a2d:	55                   	push   %ebp
+    2a2e:	89 e5                	mov    %esp,%ebp
+    2a30:	53                   	push   %ebx
+    2a31:	83 ec 0c             	sub    $0xc,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    2a34:	68 1d 4a 00 00       	push   $0x4a1d
+    2a39:	6a 01                	push   $0x1
+    2a3b:	e8 89 0f 00 00       	call   39c9 <printf>
+    2a40:	83 c4 10             	add    $0x10,%esp
+    2a43:	bb 33 00 00 00       	mov    $0x33,%ebx
+    2a48:	eb 4f                	jmp    2a99 <iref+0x6c>
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+    2a4a:	83 ec 08             	sub    $0x8,%esp
+    2a4d:	68 34 4a 00 00       	push   $0x4a34
+    2a52:	6a 01                	push   $0x1
+    2a54:	e8 70 0f 00 00       	call   39c9 <printf>
+      exit();
+    2a59:	e8 c3 0d 00 00       	call   3821 <exit>
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+    2a5e:	83 ec 08             	sub    $0x8,%esp
+    2a61:	68 48 4a 00 00       	push   $0x4a48
+    2a66:	6a 01                	push   $0x1
+    2a68:	e8 5c 0f 00 00       	call   39c9 <printf>
+      exit();
+    2a6d:	e8 af 0d 00 00       	call   3821 <exit>
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    2a72:	83 ec 0c             	sub    $0xc,%esp
+    2a75:	50                   	push   %eax
+    2a76:	e8 ce 0d 00 00       	call   3849 <close>
+    2a7b:	83 c4 10             	add    $0x10,%esp
+    2a7e:	eb 7d                	jmp    2afd <iref+0xd0>
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+    2a80:	83 ec 0c             	sub    $0xc,%esp
+    2a83:	68 18 46 00 00       	push   $0x4618
+    2a88:	e8 e4 0d 00 00       	call   3871 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2a8d:	83 c4 10             	add    $0x10,%esp
+    2a90:	83 eb 01             	sub    $0x1,%ebx
+    2a93:	0f 84 92 00 00 00    	je     2b2b <iref+0xfe>
+    if(mkdir("irefd") != 0){
+    2a99:	83 ec 0c             	sub    $0xc,%esp
+    2a9c:	68 2e 4a 00 00       	push   $0x4a2e
+    2aa1:	e8 e3 0d 00 00       	call   3889 <mkdir>
+    2aa6:	83 c4 10             	add    $0x10,%esp
+    2aa9:	85 c0                	test   %eax,%eax
+    2aab:	75 9d                	jne    2a4a <iref+0x1d>
+    if(chdir("irefd") != 0){
+    2aad:	83 ec 0c             	sub    $0xc,%esp
+    2ab0:	68 2e 4a 00 00       	push   $0x4a2e
+    2ab5:	e8 d7 0d 00 00       	call   3891 <chdir>
+    2aba:	83 c4 10             	add    $0x10,%esp
+    2abd:	85 c0                	test   %eax,%eax
+    2abf:	75 9d                	jne    2a5e <iref+0x31>
+    mkdir("");
+    2ac1:	83 ec 0c             	sub    $0xc,%esp
+    2ac4:	68 e3 40 00 00       	push   $0x40e3
+    2ac9:	e8 bb 0d 00 00       	call   3889 <mkdir>
+    link("README", "");
+    2ace:	83 c4 08             	add    $0x8,%esp
+    2ad1:	68 e3 40 00 00       	push   $0x40e3
+    2ad6:	68 da 49 00 00       	push   $0x49da
+    2adb:	e8 a1 0d 00 00       	call   3881 <link>
+    fd = open("", O_CREATE);
+    2ae0:	83 c4 08             	add    $0x8,%esp
+    2ae3:	68 00 02 00 00       	push   $0x200
+    2ae8:	68 e3 40 00 00       	push   $0x40e3
+    2aed:	e8 6f 0d 00 00       	call   3861 <open>
+    if(fd >= 0)
+    2af2:	83 c4 10             	add    $0x10,%esp
+    2af5:	85 c0                	test   %eax,%eax
+    2af7:	0f 89 75 ff ff ff    	jns    2a72 <iref+0x45>
+    fd = open("xx", O_CREATE);
+    2afd:	83 ec 08             	sub    $0x8,%esp
+    2b00:	68 00 02 00 00       	push   $0x200
+    2b05:	68 18 46 00 00       	push   $0x4618
+    2b0a:	e8 52 0d 00 00       	call   3861 <open>
+    if(fd >= 0)
+    2b0f:	83 c4 10             	add    $0x10,%esp
+    2b12:	85 c0                	test   %eax,%eax
+    2b14:	0f 88 66 ff ff ff    	js     2a80 <iref+0x53>
+      close(fd);
+    2b1a:	83 ec 0c             	sub    $0xc,%esp
+    2b1d:	50                   	push   %eax
+    2b1e:	e8 26 0d 00 00       	call   3849 <close>
+    2b23:	83 c4 10             	add    $0x10,%esp
+    2b26:	e9 55 ff ff ff       	jmp    2a80 <iref+0x53>
+  }
+
+  chdir("/");
+    2b2b:	83 ec 0c             	sub    $0xc,%esp
+    2b2e:	68 09 3d 00 00       	push   $0x3d09
+    2b33:	e8 59 0d 00 00       	call   3891 <chdir>
+  printf(1, "empty file name OK\n");
+    2b38:	83 c4 08             	add    $0x8,%esp
+    2b3b:	68 5c 4a 00 00       	push   $0x4a5c
+    2b40:	6a 01                	push   $0x1
+    2b42:	e8 82 0e 00 00       	call   39c9 <printf>
+}
+    2b47:	83 c4 10             	add    $0x10,%esp
+    2b4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b4d:	c9                   	leave
+    2b4e:	c3                   	ret
+
+00002b4f <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    2b4f:	55                   	push   %ebp
+    2b50:	89 e5                	mov    %esp,%ebp
+    2b52:	53                   	push   %ebx
+    2b53:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    2b56:	68 70 4a 00 00       	push   $0x4a70
+    2b5b:	6a 01                	push   $0x1
+    2b5d:	e8 67 0e 00 00       	call   39c9 <printf>
+    2b62:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    2b65:	bb 00 00 00 00       	mov    $0x0,%ebx
+    pid = fork();
+    2b6a:	e8 aa 0c 00 00       	call   3819 <fork>
+    if(pid < 0)
+    2b6f:	85 c0                	test   %eax,%eax
+    2b71:	78 26                	js     2b99 <forktest+0x4a>
+      break;
+    if(pid == 0)
+    2b73:	74 1f                	je     2b94 <forktest+0x45>
+  for(n=0; n<1000; n++){
+    2b75:	83 c3 01             	add    $0x1,%ebx
+    2b78:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2b7e:	75 ea                	jne    2b6a <forktest+0x1b>
+      exit();
+  }
+
+  if(n == 1000){
+    printf(1, "fork claimed to work 1000 times!\n");
+    2b80:	83 ec 08             	sub    $0x8,%esp
+    2b83:	68 10 52 00 00       	push   $0x5210
+    2b88:	6a 01                	push   $0x1
+    2b8a:	e8 3a 0e 00 00       	call   39c9 <printf>
+    exit();
+    2b8f:	e8 8d 0c 00 00       	call   3821 <exit>
+      exit();
+    2b94:	e8 88 0c 00 00       	call   3821 <exit>
+  if(n == 1000){
+    2b99:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2b9f:	74 df                	je     2b80 <forktest+0x31>
+  }
+
+  for(; n > 0; n--){
+    2ba1:	85 db                	test   %ebx,%ebx
+    2ba3:	7e 16                	jle    2bbb <forktest+0x6c>
+    if(wait(0) < 0){
+    2ba5:	83 ec 0c             	sub    $0xc,%esp
+    2ba8:	6a 00                	push   $0x0
+    2baa:	e8 7a 0c 00 00       	call   3829 <wait>
+    2baf:	83 c4 10             	add    $0x10,%esp
+    2bb2:	85 c0                	test   %eax,%eax
+    2bb4:	78 2e                	js     2be4 <forktest+0x95>
+  for(; n > 0; n--){
+    2bb6:	83 eb 01             	sub    $0x1,%ebx
+    2bb9:	75 ea                	jne    2ba5 <forktest+0x56>
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+
+  if(wait(0) != -1){
+    2bbb:	83 ec 0c             	sub    $0xc,%esp
+    2bbe:	6a 00                	push   $0x0
+    2bc0:	e8 64 0c 00 00       	call   3829 <wait>
+    2bc5:	83 c4 10             	add    $0x10,%esp
+    2bc8:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2bcb:	75 2b                	jne    2bf8 <forktest+0xa9>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+    2bcd:	83 ec 08             	sub    $0x8,%esp
+    2bd0:	68 a2 4a 00 00       	push   $0x4aa2
+    2bd5:	6a 01                	push   $0x1
+    2bd7:	e8 ed 0d 00 00       	call   39c9 <printf>
+}
+    2bdc:	83 c4 10             	add    $0x10,%esp
+    2bdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2be2:	c9                   	leave
+    2be3:	c3                   	ret
+      printf(1, "wait stopped early\n");
+    2be4:	83 ec 08             	sub    $0x8,%esp
+    2be7:	68 7b 4a 00 00       	push   $0x4a7b
+    2bec:	6a 01                	push   $0x1
+    2bee:	e8 d6 0d 00 00       	call   39c9 <printf>
+      exit();
+    2bf3:	e8 29 0c 00 00       	call   3821 <exit>
+    printf(1, "wait got too many\n");
+    2bf8:	83 ec 08             	sub    $0x8,%esp
+    2bfb:	68 8f 4a 00 00       	push   $0x4a8f
+    2c00:	6a 01                	push   $0x1
+    2c02:	e8 c2 0d 00 00       	call   39c9 <printf>
+    exit();
+    2c07:	e8 15 0c 00 00       	call   3821 <exit>
+
+00002c0c <sbrktest>:
+
+void
+sbrktest(void)
+{
+    2c0c:	55                   	push   %ebp
+    2c0d:	89 e5                	mov    %esp,%ebp
+    2c0f:	57                   	push   %edi
+    2c10:	56                   	push   %esi
+    2c11:	53                   	push   %ebx
+    2c12:	83 ec 64             	sub    $0x64,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    2c15:	68 b0 4a 00 00       	push   $0x4ab0
+    2c1a:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2c20:	e8 a4 0d 00 00       	call   39c9 <printf>
+  oldbrk = sbrk(0);
+    2c25:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2c2c:	e8 78 0c 00 00       	call   38a9 <sbrk>
+    2c31:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    2c34:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2c3b:	e8 69 0c 00 00       	call   38a9 <sbrk>
+    2c40:	89 c3                	mov    %eax,%ebx
+    2c42:	83 c4 10             	add    $0x10,%esp
+  int i;
+  for(i = 0; i < 5000; i++){
+    2c45:	be 00 00 00 00       	mov    $0x0,%esi
+    2c4a:	eb 02                	jmp    2c4e <sbrktest+0x42>
+    if(b != a){
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+      exit();
+    }
+    *b = 1;
+    a = b + 1;
+    2c4c:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2c4e:	83 ec 0c             	sub    $0xc,%esp
+    2c51:	6a 01                	push   $0x1
+    2c53:	e8 51 0c 00 00       	call   38a9 <sbrk>
+    if(b != a){
+    2c58:	83 c4 10             	add    $0x10,%esp
+    2c5b:	39 d8                	cmp    %ebx,%eax
+    2c5d:	0f 85 a1 01 00 00    	jne    2e04 <sbrktest+0x1f8>
+    *b = 1;
+    2c63:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    2c66:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    2c69:	83 c6 01             	add    $0x1,%esi
+    2c6c:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    2c72:	75 d8                	jne    2c4c <sbrktest+0x40>
+  }
+  pid = fork();
+    2c74:	e8 a0 0b 00 00       	call   3819 <fork>
+    2c79:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2c7b:	85 c0                	test   %eax,%eax
+    2c7d:	0f 88 9f 01 00 00    	js     2e22 <sbrktest+0x216>
+    printf(stdout, "sbrk test fork failed\n");
+    exit();
+  }
+  c = sbrk(1);
+    2c83:	83 ec 0c             	sub    $0xc,%esp
+    2c86:	6a 01                	push   $0x1
+    2c88:	e8 1c 0c 00 00       	call   38a9 <sbrk>
+  c = sbrk(1);
+    2c8d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2c94:	e8 10 0c 00 00       	call   38a9 <sbrk>
+  if(c != a + 1){
+    2c99:	83 c3 02             	add    $0x2,%ebx
+    2c9c:	83 c4 10             	add    $0x10,%esp
+    2c9f:	39 c3                	cmp    %eax,%ebx
+    2ca1:	0f 85 93 01 00 00    	jne    2e3a <sbrktest+0x22e>
+    printf(stdout, "sbrk test failed post-fork\n");
+    exit();
+  }
+  if(pid == 0)
+    2ca7:	85 f6                	test   %esi,%esi
+    2ca9:	0f 84 a3 01 00 00    	je     2e52 <sbrktest+0x246>
+    exit();
+  wait(0);
+    2caf:	83 ec 0c             	sub    $0xc,%esp
+    2cb2:	6a 00                	push   $0x0
+    2cb4:	e8 70 0b 00 00       	call   3829 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    2cb9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2cc0:	e8 e4 0b 00 00       	call   38a9 <sbrk>
+    2cc5:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    2cc7:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2ccc:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    2cce:	89 04 24             	mov    %eax,(%esp)
+    2cd1:	e8 d3 0b 00 00       	call   38a9 <sbrk>
+  if (p != a) {
+    2cd6:	83 c4 10             	add    $0x10,%esp
+    2cd9:	39 c3                	cmp    %eax,%ebx
+    2cdb:	0f 85 76 01 00 00    	jne    2e57 <sbrktest+0x24b>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    exit();
+  }
+  lastaddr = (char*) (BIG-1);
+  *lastaddr = 99;
+    2ce1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+
+  // can one de-allocate?
+  a = sbrk(0);
+    2ce8:	83 ec 0c             	sub    $0xc,%esp
+    2ceb:	6a 00                	push   $0x0
+    2ced:	e8 b7 0b 00 00       	call   38a9 <sbrk>
+    2cf2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    2cf4:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    2cfb:	e8 a9 0b 00 00       	call   38a9 <sbrk>
+  if(c == (char*)0xffffffff){
+    2d00:	83 c4 10             	add    $0x10,%esp
+    2d03:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2d06:	0f 84 63 01 00 00    	je     2e6f <sbrktest+0x263>
+    printf(stdout, "sbrk could not deallocate\n");
+    exit();
+  }
+  c = sbrk(0);
+    2d0c:	83 ec 0c             	sub    $0xc,%esp
+    2d0f:	6a 00                	push   $0x0
+    2d11:	e8 93 0b 00 00       	call   38a9 <sbrk>
+  if(c != a - 4096){
+    2d16:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    2d1c:	83 c4 10             	add    $0x10,%esp
+    2d1f:	39 d0                	cmp    %edx,%eax
+    2d21:	0f 85 60 01 00 00    	jne    2e87 <sbrktest+0x27b>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    2d27:	83 ec 0c             	sub    $0xc,%esp
+    2d2a:	6a 00                	push   $0x0
+    2d2c:	e8 78 0b 00 00       	call   38a9 <sbrk>
+    2d31:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    2d33:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    2d3a:	e8 6a 0b 00 00       	call   38a9 <sbrk>
+    2d3f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    2d41:	83 c4 10             	add    $0x10,%esp
+    2d44:	39 c3                	cmp    %eax,%ebx
+    2d46:	0f 85 52 01 00 00    	jne    2e9e <sbrktest+0x292>
+    2d4c:	83 ec 0c             	sub    $0xc,%esp
+    2d4f:	6a 00                	push   $0x0
+    2d51:	e8 53 0b 00 00       	call   38a9 <sbrk>
+    2d56:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    2d5c:	83 c4 10             	add    $0x10,%esp
+    2d5f:	39 c2                	cmp    %eax,%edx
+    2d61:	0f 85 37 01 00 00    	jne    2e9e <sbrktest+0x292>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    exit();
+  }
+  if(*lastaddr == 99){
+    2d67:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    2d6e:	0f 84 41 01 00 00    	je     2eb5 <sbrktest+0x2a9>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    exit();
+  }
+
+  a = sbrk(0);
+    2d74:	83 ec 0c             	sub    $0xc,%esp
+    2d77:	6a 00                	push   $0x0
+    2d79:	e8 2b 0b 00 00       	call   38a9 <sbrk>
+    2d7e:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    2d80:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2d87:	e8 1d 0b 00 00       	call   38a9 <sbrk>
+    2d8c:	89 c2                	mov    %eax,%edx
+    2d8e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    2d91:	29 d0                	sub    %edx,%eax
+    2d93:	89 04 24             	mov    %eax,(%esp)
+    2d96:	e8 0e 0b 00 00       	call   38a9 <sbrk>
+  if(c != a){
+    2d9b:	83 c4 10             	add    $0x10,%esp
+    2d9e:	39 c3                	cmp    %eax,%ebx
+    2da0:	0f 85 27 01 00 00    	jne    2ecd <sbrktest+0x2c1>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    exit();
+  }
+
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2da6:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    ppid = getpid();
+    2dab:	e8 f1 0a 00 00       	call   38a1 <getpid>
+    2db0:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    2db2:	e8 62 0a 00 00       	call   3819 <fork>
+    if(pid < 0){
+    2db7:	85 c0                	test   %eax,%eax
+    2db9:	0f 88 25 01 00 00    	js     2ee4 <sbrktest+0x2d8>
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+    2dbf:	0f 84 37 01 00 00    	je     2efc <sbrktest+0x2f0>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+      kill(ppid);
+      exit();
+    }
+    wait(0);
+    2dc5:	83 ec 0c             	sub    $0xc,%esp
+    2dc8:	6a 00                	push   $0x0
+    2dca:	e8 5a 0a 00 00       	call   3829 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    2dcf:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    2dd5:	83 c4 10             	add    $0x10,%esp
+    2dd8:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    2dde:	75 cb                	jne    2dab <sbrktest+0x19f>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    2de0:	83 ec 0c             	sub    $0xc,%esp
+    2de3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2de6:	50                   	push   %eax
+    2de7:	e8 45 0a 00 00       	call   3831 <pipe>
+    2dec:	83 c4 10             	add    $0x10,%esp
+    2def:	85 c0                	test   %eax,%eax
+    2df1:	0f 85 27 01 00 00    	jne    2f1e <sbrktest+0x312>
+    2df7:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+    2dfa:	8d 7d e0             	lea    -0x20(%ebp),%edi
+    2dfd:	89 de                	mov    %ebx,%esi
+    2dff:	e9 77 01 00 00       	jmp    2f7b <sbrktest+0x36f>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    2e04:	83 ec 0c             	sub    $0xc,%esp
+    2e07:	50                   	push   %eax
+    2e08:	53                   	push   %ebx
+    2e09:	56                   	push   %esi
+    2e0a:	68 bb 4a 00 00       	push   $0x4abb
+    2e0f:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2e15:	e8 af 0b 00 00       	call   39c9 <printf>
+      exit();
+    2e1a:	83 c4 20             	add    $0x20,%esp
+    2e1d:	e8 ff 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    2e22:	83 ec 08             	sub    $0x8,%esp
+    2e25:	68 d6 4a 00 00       	push   $0x4ad6
+    2e2a:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2e30:	e8 94 0b 00 00       	call   39c9 <printf>
+    exit();
+    2e35:	e8 e7 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    2e3a:	83 ec 08             	sub    $0x8,%esp
+    2e3d:	68 ed 4a 00 00       	push   $0x4aed
+    2e42:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2e48:	e8 7c 0b 00 00       	call   39c9 <printf>
+    exit();
+    2e4d:	e8 cf 09 00 00       	call   3821 <exit>
+    exit();
+    2e52:	e8 ca 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    2e57:	83 ec 08             	sub    $0x8,%esp
+    2e5a:	68 34 52 00 00       	push   $0x5234
+    2e5f:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2e65:	e8 5f 0b 00 00       	call   39c9 <printf>
+    exit();
+    2e6a:	e8 b2 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    2e6f:	83 ec 08             	sub    $0x8,%esp
+    2e72:	68 09 4b 00 00       	push   $0x4b09
+    2e77:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2e7d:	e8 47 0b 00 00       	call   39c9 <printf>
+    exit();
+    2e82:	e8 9a 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    2e87:	50                   	push   %eax
+    2e88:	53                   	push   %ebx
+    2e89:	68 74 52 00 00       	push   $0x5274
+    2e8e:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2e94:	e8 30 0b 00 00       	call   39c9 <printf>
+    exit();
+    2e99:	e8 83 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    2e9e:	56                   	push   %esi
+    2e9f:	53                   	push   %ebx
+    2ea0:	68 ac 52 00 00       	push   $0x52ac
+    2ea5:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2eab:	e8 19 0b 00 00       	call   39c9 <printf>
+    exit();
+    2eb0:	e8 6c 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    2eb5:	83 ec 08             	sub    $0x8,%esp
+    2eb8:	68 d4 52 00 00       	push   $0x52d4
+    2ebd:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2ec3:	e8 01 0b 00 00       	call   39c9 <printf>
+    exit();
+    2ec8:	e8 54 09 00 00       	call   3821 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    2ecd:	50                   	push   %eax
+    2ece:	53                   	push   %ebx
+    2ecf:	68 04 53 00 00       	push   $0x5304
+    2ed4:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2eda:	e8 ea 0a 00 00       	call   39c9 <printf>
+    exit();
+    2edf:	e8 3d 09 00 00       	call   3821 <exit>
+      printf(stdout, "fork failed\n");
+    2ee4:	83 ec 08             	sub    $0x8,%esp
+    2ee7:	68 01 4c 00 00       	push   $0x4c01
+    2eec:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2ef2:	e8 d2 0a 00 00       	call   39c9 <printf>
+      exit();
+    2ef7:	e8 25 09 00 00       	call   3821 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    2efc:	0f be 03             	movsbl (%ebx),%eax
+    2eff:	50                   	push   %eax
+    2f00:	53                   	push   %ebx
+    2f01:	68 24 4b 00 00       	push   $0x4b24
+    2f06:	ff 35 2c 5d 00 00    	push   0x5d2c
+    2f0c:	e8 b8 0a 00 00       	call   39c9 <printf>
+      kill(ppid);
+    2f11:	89 34 24             	mov    %esi,(%esp)
+    2f14:	e8 38 09 00 00       	call   3851 <kill>
+      exit();
+    2f19:	e8 03 09 00 00       	call   3821 <exit>
+    printf(1, "pipe() failed\n");
+    2f1e:	83 ec 08             	sub    $0x8,%esp
+    2f21:	68 f9 3f 00 00       	push   $0x3ff9
+    2f26:	6a 01                	push   $0x1
+    2f28:	e8 9c 0a 00 00       	call   39c9 <printf>
+    exit();
+    2f2d:	e8 ef 08 00 00       	call   3821 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    if((pids[i] = fork()) == 0){
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    2f32:	83 ec 0c             	sub    $0xc,%esp
+    2f35:	6a 00                	push   $0x0
+    2f37:	e8 6d 09 00 00       	call   38a9 <sbrk>
+    2f3c:	89 c2                	mov    %eax,%edx
+    2f3e:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    2f43:	29 d0                	sub    %edx,%eax
+    2f45:	89 04 24             	mov    %eax,(%esp)
+    2f48:	e8 5c 09 00 00       	call   38a9 <sbrk>
+      write(fds[1], "x", 1);
+    2f4d:	83 c4 0c             	add    $0xc,%esp
+    2f50:	6a 01                	push   $0x1
+    2f52:	68 19 46 00 00       	push   $0x4619
+    2f57:	ff 75 e4             	push   -0x1c(%ebp)
+    2f5a:	e8 e2 08 00 00       	call   3841 <write>
+    2f5f:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    2f62:	83 ec 0c             	sub    $0xc,%esp
+    2f65:	68 e8 03 00 00       	push   $0x3e8
+    2f6a:	e8 42 09 00 00       	call   38b1 <sleep>
+    2f6f:	83 c4 10             	add    $0x10,%esp
+    2f72:	eb ee                	jmp    2f62 <sbrktest+0x356>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2f74:	83 c6 04             	add    $0x4,%esi
+    2f77:	39 fe                	cmp    %edi,%esi
+    2f79:	74 26                	je     2fa1 <sbrktest+0x395>
+    if((pids[i] = fork()) == 0){
+    2f7b:	e8 99 08 00 00       	call   3819 <fork>
+    2f80:	89 06                	mov    %eax,(%esi)
+    2f82:	85 c0                	test   %eax,%eax
+    2f84:	74 ac                	je     2f32 <sbrktest+0x326>
+    }
+    if(pids[i] != -1)
+    2f86:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f89:	74 e9                	je     2f74 <sbrktest+0x368>
+      read(fds[0], &scratch, 1);
+    2f8b:	83 ec 04             	sub    $0x4,%esp
+    2f8e:	6a 01                	push   $0x1
+    2f90:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    2f93:	50                   	push   %eax
+    2f94:	ff 75 e0             	push   -0x20(%ebp)
+    2f97:	e8 9d 08 00 00       	call   3839 <read>
+    2f9c:	83 c4 10             	add    $0x10,%esp
+    2f9f:	eb d3                	jmp    2f74 <sbrktest+0x368>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    2fa1:	83 ec 0c             	sub    $0xc,%esp
+    2fa4:	68 00 10 00 00       	push   $0x1000
+    2fa9:	e8 fb 08 00 00       	call   38a9 <sbrk>
+    2fae:	89 c6                	mov    %eax,%esi
+    2fb0:	83 c4 10             	add    $0x10,%esp
+    2fb3:	eb 07                	jmp    2fbc <sbrktest+0x3b0>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    2fb5:	83 c3 04             	add    $0x4,%ebx
+    2fb8:	39 fb                	cmp    %edi,%ebx
+    2fba:	74 21                	je     2fdd <sbrktest+0x3d1>
+    if(pids[i] == -1)
+    2fbc:	8b 03                	mov    (%ebx),%eax
+    2fbe:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2fc1:	74 f2                	je     2fb5 <sbrktest+0x3a9>
+      continue;
+    kill(pids[i]);
+    2fc3:	83 ec 0c             	sub    $0xc,%esp
+    2fc6:	50                   	push   %eax
+    2fc7:	e8 85 08 00 00       	call   3851 <kill>
+    wait(0);
+    2fcc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fd3:	e8 51 08 00 00       	call   3829 <wait>
+    2fd8:	83 c4 10             	add    $0x10,%esp
+    2fdb:	eb d8                	jmp    2fb5 <sbrktest+0x3a9>
+  }
+  if(c == (char*)0xffffffff){
+    2fdd:	83 fe ff             	cmp    $0xffffffff,%esi
+    2fe0:	74 30                	je     3012 <sbrktest+0x406>
+    printf(stdout, "failed sbrk leaked memory\n");
+    exit();
+  }
+
+  if(sbrk(0) > oldbrk)
+    2fe2:	83 ec 0c             	sub    $0xc,%esp
+    2fe5:	6a 00                	push   $0x0
+    2fe7:	e8 bd 08 00 00       	call   38a9 <sbrk>
+    2fec:	83 c4 10             	add    $0x10,%esp
+    2fef:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    2ff2:	72 36                	jb     302a <sbrktest+0x41e>
+    sbrk(-(sbrk(0) - oldbrk));
+
+  printf(stdout, "sbrk test OK\n");
+    2ff4:	83 ec 08             	sub    $0x8,%esp
+    2ff7:	68 58 4b 00 00       	push   $0x4b58
+    2ffc:	ff 35 2c 5d 00 00    	push   0x5d2c
+    3002:	e8 c2 09 00 00       	call   39c9 <printf>
+}
+    3007:	83 c4 10             	add    $0x10,%esp
+    300a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    300d:	5b                   	pop    %ebx
+    300e:	5e                   	pop    %esi
+    300f:	5f                   	pop    %edi
+    3010:	5d                   	pop    %ebp
+    3011:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    3012:	83 ec 08             	sub    $0x8,%esp
+    3015:	68 3d 4b 00 00       	push   $0x4b3d
+    301a:	ff 35 2c 5d 00 00    	push   0x5d2c
+    3020:	e8 a4 09 00 00       	call   39c9 <printf>
+    exit();
+    3025:	e8 f7 07 00 00       	call   3821 <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    302a:	83 ec 0c             	sub    $0xc,%esp
+    302d:	6a 00                	push   $0x0
+    302f:	e8 75 08 00 00       	call   38a9 <sbrk>
+    3034:	89 c2                	mov    %eax,%edx
+    3036:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3039:	29 d0                	sub    %edx,%eax
+    303b:	89 04 24             	mov    %eax,(%esp)
+    303e:	e8 66 08 00 00       	call   38a9 <sbrk>
+    3043:	83 c4 10             	add    $0x10,%esp
+    3046:	eb ac                	jmp    2ff4 <sbrktest+0x3e8>
+
+00003048 <validateint>:
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    3048:	c3                   	ret
+
+00003049 <validatetest>:
+
+void
+validatetest(void)
+{
+    3049:	55                   	push   %ebp
+    304a:	89 e5                	mov    %esp,%ebp
+    304c:	56                   	push   %esi
+    304d:	53                   	push   %ebx
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    304e:	83 ec 08             	sub    $0x8,%esp
+    3051:	68 66 4b 00 00       	push   $0x4b66
+    3056:	ff 35 2c 5d 00 00    	push   0x5d2c
+    305c:	e8 68 09 00 00       	call   39c9 <printf>
+    3061:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3064:	be 00 00 00 00       	mov    $0x0,%esi
+    if((pid = fork()) == 0){
+    3069:	e8 ab 07 00 00       	call   3819 <fork>
+    306e:	89 c3                	mov    %eax,%ebx
+    3070:	85 c0                	test   %eax,%eax
+    3072:	74 6b                	je     30df <validatetest+0x96>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+      exit();
+    }
+    sleep(0);
+    3074:	83 ec 0c             	sub    $0xc,%esp
+    3077:	6a 00                	push   $0x0
+    3079:	e8 33 08 00 00       	call   38b1 <sleep>
+    sleep(0);
+    307e:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3085:	e8 27 08 00 00       	call   38b1 <sleep>
+    kill(pid);
+    308a:	89 1c 24             	mov    %ebx,(%esp)
+    308d:	e8 bf 07 00 00       	call   3851 <kill>
+    wait(0);
+    3092:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3099:	e8 8b 07 00 00       	call   3829 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    309e:	83 c4 08             	add    $0x8,%esp
+    30a1:	56                   	push   %esi
+    30a2:	68 75 4b 00 00       	push   $0x4b75
+    30a7:	e8 d5 07 00 00       	call   3881 <link>
+    30ac:	83 c4 10             	add    $0x10,%esp
+    30af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    30b2:	75 30                	jne    30e4 <validatetest+0x9b>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    30b4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    30ba:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    30c0:	75 a7                	jne    3069 <validatetest+0x20>
+      printf(stdout, "link should not succeed\n");
+      exit();
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    30c2:	83 ec 08             	sub    $0x8,%esp
+    30c5:	68 99 4b 00 00       	push   $0x4b99
+    30ca:	ff 35 2c 5d 00 00    	push   0x5d2c
+    30d0:	e8 f4 08 00 00       	call   39c9 <printf>
+}
+    30d5:	83 c4 10             	add    $0x10,%esp
+    30d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    30db:	5b                   	pop    %ebx
+    30dc:	5e                   	pop    %esi
+    30dd:	5d                   	pop    %ebp
+    30de:	c3                   	ret
+      exit();
+    30df:	e8 3d 07 00 00       	call   3821 <exit>
+      printf(stdout, "link should not succeed\n");
+    30e4:	83 ec 08             	sub    $0x8,%esp
+    30e7:	68 80 4b 00 00       	push   $0x4b80
+    30ec:	ff 35 2c 5d 00 00    	push   0x5d2c
+    30f2:	e8 d2 08 00 00       	call   39c9 <printf>
+      exit();
+    30f7:	e8 25 07 00 00       	call   3821 <exit>
+
+000030fc <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    30fc:	55                   	push   %ebp
+    30fd:	89 e5                	mov    %esp,%ebp
+    30ff:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3102:	68 a6 4b 00 00       	push   $0x4ba6
+    3107:	ff 35 2c 5d 00 00    	push   0x5d2c
+    310d:	e8 b7 08 00 00       	call   39c9 <printf>
+    3112:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3115:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(uninit[i] != '\0'){
+    311a:	80 b8 60 5d 00 00 00 	cmpb   $0x0,0x5d60(%eax)
+    3121:	75 22                	jne    3145 <bsstest+0x49>
+  for(i = 0; i < sizeof(uninit); i++){
+    3123:	83 c0 01             	add    $0x1,%eax
+    3126:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    312b:	75 ed                	jne    311a <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+      exit();
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    312d:	83 ec 08             	sub    $0x8,%esp
+    3130:	68 c1 4b 00 00       	push   $0x4bc1
+    3135:	ff 35 2c 5d 00 00    	push   0x5d2c
+    313b:	e8 89 08 00 00       	call   39c9 <printf>
+}
+    3140:	83 c4 10             	add    $0x10,%esp
+    3143:	c9                   	leave
+    3144:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3145:	83 ec 08             	sub    $0x8,%esp
+    3148:	68 b0 4b 00 00       	push   $0x4bb0
+    314d:	ff 35 2c 5d 00 00    	push   0x5d2c
+    3153:	e8 71 08 00 00       	call   39c9 <printf>
+      exit();
+    3158:	e8 c4 06 00 00       	call   3821 <exit>
+
+0000315d <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    315d:	55                   	push   %ebp
+    315e:	89 e5                	mov    %esp,%ebp
+    3160:	83 ec 14             	sub    $0x14,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3163:	68 ce 4b 00 00       	push   $0x4bce
+    3168:	e8 04 07 00 00       	call   3871 <unlink>
+  pid = fork();
+    316d:	e8 a7 06 00 00       	call   3819 <fork>
+  if(pid == 0){
+    3172:	83 c4 10             	add    $0x10,%esp
+    3175:	85 c0                	test   %eax,%eax
+    3177:	74 44                	je     31bd <bigargtest+0x60>
+    exec("echo", args);
+    printf(stdout, "bigarg test ok\n");
+    fd = open("bigarg-ok", O_CREATE);
+    close(fd);
+    exit();
+  } else if(pid < 0){
+    3179:	0f 88 b2 00 00 00    	js     3231 <bigargtest+0xd4>
+    printf(stdout, "bigargtest: fork failed\n");
+    exit();
+  }
+  wait(0);
+    317f:	83 ec 0c             	sub    $0xc,%esp
+    3182:	6a 00                	push   $0x0
+    3184:	e8 a0 06 00 00       	call   3829 <wait>
+  fd = open("bigarg-ok", 0);
+    3189:	83 c4 08             	add    $0x8,%esp
+    318c:	6a 00                	push   $0x0
+    318e:	68 ce 4b 00 00       	push   $0x4bce
+    3193:	e8 c9 06 00 00       	call   3861 <open>
+  if(fd < 0){
+    3198:	83 c4 10             	add    $0x10,%esp
+    319b:	85 c0                	test   %eax,%eax
+    319d:	0f 88 a6 00 00 00    	js     3249 <bigargtest+0xec>
+    printf(stdout, "bigarg test failed!\n");
+    exit();
+  }
+  close(fd);
+    31a3:	83 ec 0c             	sub    $0xc,%esp
+    31a6:	50                   	push   %eax
+    31a7:	e8 9d 06 00 00       	call   3849 <close>
+  unlink("bigarg-ok");
+    31ac:	c7 04 24 ce 4b 00 00 	movl   $0x4bce,(%esp)
+    31b3:	e8 b9 06 00 00       	call   3871 <unlink>
+}
+    31b8:	83 c4 10             	add    $0x10,%esp
+    31bb:	c9                   	leave
+    31bc:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    31bd:	c7 04 85 80 a4 00 00 	movl   $0x5328,0xa480(,%eax,4)
+    31c4:	28 53 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    31c8:	83 c0 01             	add    $0x1,%eax
+    31cb:	83 f8 1f             	cmp    $0x1f,%eax
+    31ce:	75 ed                	jne    31bd <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    31d0:	c7 05 fc a4 00 00 00 	movl   $0x0,0xa4fc
+    31d7:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    31da:	83 ec 08             	sub    $0x8,%esp
+    31dd:	68 d8 4b 00 00       	push   $0x4bd8
+    31e2:	ff 35 2c 5d 00 00    	push   0x5d2c
+    31e8:	e8 dc 07 00 00       	call   39c9 <printf>
+    exec("echo", args);
+    31ed:	83 c4 08             	add    $0x8,%esp
+    31f0:	68 80 a4 00 00       	push   $0xa480
+    31f5:	68 a5 3d 00 00       	push   $0x3da5
+    31fa:	e8 5a 06 00 00       	call   3859 <exec>
+    printf(stdout, "bigarg test ok\n");
+    31ff:	83 c4 08             	add    $0x8,%esp
+    3202:	68 e5 4b 00 00       	push   $0x4be5
+    3207:	ff 35 2c 5d 00 00    	push   0x5d2c
+    320d:	e8 b7 07 00 00       	call   39c9 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3212:	83 c4 08             	add    $0x8,%esp
+    3215:	68 00 02 00 00       	push   $0x200
+    321a:	68 ce 4b 00 00       	push   $0x4bce
+    321f:	e8 3d 06 00 00       	call   3861 <open>
+    close(fd);
+    3224:	89 04 24             	mov    %eax,(%esp)
+    3227:	e8 1d 06 00 00       	call   3849 <close>
+    exit();
+    322c:	e8 f0 05 00 00       	call   3821 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3231:	83 ec 08             	sub    $0x8,%esp
+    3234:	68 f5 4b 00 00       	push   $0x4bf5
+    3239:	ff 35 2c 5d 00 00    	push   0x5d2c
+    323f:	e8 85 07 00 00       	call   39c9 <printf>
+    exit();
+    3244:	e8 d8 05 00 00       	call   3821 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3249:	83 ec 08             	sub    $0x8,%esp
+    324c:	68 0e 4c 00 00       	push   $0x4c0e
+    3251:	ff 35 2c 5d 00 00    	push   0x5d2c
+    3257:	e8 6d 07 00 00       	call   39c9 <printf>
+    exit();
+    325c:	e8 c0 05 00 00       	call   3821 <exit>
+
+00003261 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    3261:	55                   	push   %ebp
+    3262:	89 e5                	mov    %esp,%ebp
+    3264:	57                   	push   %edi
+    3265:	56                   	push   %esi
+    3266:	53                   	push   %ebx
+    3267:	83 ec 54             	sub    $0x54,%esp
+  int nfiles;
+  int fsblocks = 0;
+
+  printf(1, "fsfull test\n");
+    326a:	68 23 4c 00 00       	push   $0x4c23
+    326f:	6a 01                	push   $0x1
+    3271:	e8 53 07 00 00       	call   39c9 <printf>
+    3276:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    3279:	bb 00 00 00 00       	mov    $0x0,%ebx
+    char name[64];
+    name[0] = 'f';
+    327e:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3282:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    3287:	f7 eb                	imul   %ebx
+    3289:	c1 fa 06             	sar    $0x6,%edx
+    328c:	89 de                	mov    %ebx,%esi
+    328e:	c1 fe 1f             	sar    $0x1f,%esi
+    3291:	29 f2                	sub    %esi,%edx
+    3293:	8d 42 30             	lea    0x30(%edx),%eax
+    3296:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3299:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    329f:	89 d9                	mov    %ebx,%ecx
+    32a1:	29 d1                	sub    %edx,%ecx
+    32a3:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    32a8:	f7 e9                	imul   %ecx
+    32aa:	c1 fa 05             	sar    $0x5,%edx
+    32ad:	c1 f9 1f             	sar    $0x1f,%ecx
+    32b0:	29 ca                	sub    %ecx,%edx
+    32b2:	83 c2 30             	add    $0x30,%edx
+    32b5:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    32b8:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    32bd:	f7 eb                	imul   %ebx
+    32bf:	c1 fa 05             	sar    $0x5,%edx
+    32c2:	29 f2                	sub    %esi,%edx
+    32c4:	6b d2 64             	imul   $0x64,%edx,%edx
+    32c7:	89 df                	mov    %ebx,%edi
+    32c9:	29 d7                	sub    %edx,%edi
+    32cb:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    32d0:	89 f8                	mov    %edi,%eax
+    32d2:	f7 e9                	imul   %ecx
+    32d4:	c1 fa 02             	sar    $0x2,%edx
+    32d7:	c1 ff 1f             	sar    $0x1f,%edi
+    32da:	29 fa                	sub    %edi,%edx
+    32dc:	83 c2 30             	add    $0x30,%edx
+    32df:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    32e2:	89 d8                	mov    %ebx,%eax
+    32e4:	f7 e9                	imul   %ecx
+    32e6:	c1 fa 02             	sar    $0x2,%edx
+    32e9:	29 f2                	sub    %esi,%edx
+    32eb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    32ee:	01 d2                	add    %edx,%edx
+    32f0:	89 d8                	mov    %ebx,%eax
+    32f2:	29 d0                	sub    %edx,%eax
+    32f4:	83 c0 30             	add    $0x30,%eax
+    32f7:	88 45 ac             	mov    %al,-0x54(%ebp)
+    name[5] = '\0';
+    32fa:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    32fe:	83 ec 04             	sub    $0x4,%esp
+    3301:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    3304:	56                   	push   %esi
+    3305:	68 30 4c 00 00       	push   $0x4c30
+    330a:	6a 01                	push   $0x1
+    330c:	e8 b8 06 00 00       	call   39c9 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3311:	83 c4 08             	add    $0x8,%esp
+    3314:	68 02 02 00 00       	push   $0x202
+    3319:	56                   	push   %esi
+    331a:	e8 42 05 00 00       	call   3861 <open>
+    331f:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    3321:	83 c4 10             	add    $0x10,%esp
+    3324:	85 c0                	test   %eax,%eax
+    3326:	0f 89 d3 00 00 00    	jns    33ff <fsfull+0x19e>
+      printf(1, "open %s failed\n", name);
+    332c:	83 ec 04             	sub    $0x4,%esp
+    332f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3332:	50                   	push   %eax
+    3333:	68 3c 4c 00 00       	push   $0x4c3c
+    3338:	6a 01                	push   $0x1
+    333a:	e8 8a 06 00 00       	call   39c9 <printf>
+      break;
+    333f:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    if(total == 0)
+      break;
+  }
+
+  while(nfiles >= 0){
+    3342:	85 db                	test   %ebx,%ebx
+    3344:	0f 88 9b 00 00 00    	js     33e5 <fsfull+0x184>
+    char name[64];
+    name[0] = 'f';
+    334a:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    334e:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    3353:	f7 eb                	imul   %ebx
+    3355:	c1 fa 06             	sar    $0x6,%edx
+    3358:	89 de                	mov    %ebx,%esi
+    335a:	c1 fe 1f             	sar    $0x1f,%esi
+    335d:	29 f2                	sub    %esi,%edx
+    335f:	8d 42 30             	lea    0x30(%edx),%eax
+    3362:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3365:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    336b:	89 d9                	mov    %ebx,%ecx
+    336d:	29 d1                	sub    %edx,%ecx
+    336f:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    3374:	f7 e9                	imul   %ecx
+    3376:	c1 fa 05             	sar    $0x5,%edx
+    3379:	c1 f9 1f             	sar    $0x1f,%ecx
+    337c:	29 ca                	sub    %ecx,%edx
+    337e:	83 c2 30             	add    $0x30,%edx
+    3381:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3384:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    3389:	f7 eb                	imul   %ebx
+    338b:	c1 fa 05             	sar    $0x5,%edx
+    338e:	29 f2                	sub    %esi,%edx
+    3390:	6b d2 64             	imul   $0x64,%edx,%edx
+    3393:	89 df                	mov    %ebx,%edi
+    3395:	29 d7                	sub    %edx,%edi
+    3397:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    339c:	89 f8                	mov    %edi,%eax
+    339e:	f7 e9                	imul   %ecx
+    33a0:	c1 fa 02             	sar    $0x2,%edx
+    33a3:	c1 ff 1f             	sar    $0x1f,%edi
+    33a6:	29 fa                	sub    %edi,%edx
+    33a8:	83 c2 30             	add    $0x30,%edx
+    33ab:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    33ae:	89 d8                	mov    %ebx,%eax
+    33b0:	f7 e9                	imul   %ecx
+    33b2:	c1 fa 02             	sar    $0x2,%edx
+    33b5:	29 f2                	sub    %esi,%edx
+    33b7:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    33ba:	01 d2                	add    %edx,%edx
+    33bc:	89 d8                	mov    %ebx,%eax
+    33be:	29 d0                	sub    %edx,%eax
+    33c0:	83 c0 30             	add    $0x30,%eax
+    33c3:	88 45 ac             	mov    %al,-0x54(%ebp)
+    name[5] = '\0';
+    33c6:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    33ca:	83 ec 0c             	sub    $0xc,%esp
+    33cd:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    33d0:	50                   	push   %eax
+    33d1:	e8 9b 04 00 00       	call   3871 <unlink>
+    nfiles--;
+    33d6:	83 eb 01             	sub    $0x1,%ebx
+  while(nfiles >= 0){
+    33d9:	83 c4 10             	add    $0x10,%esp
+    33dc:	83 fb ff             	cmp    $0xffffffff,%ebx
+    33df:	0f 85 65 ff ff ff    	jne    334a <fsfull+0xe9>
+  }
+
+  printf(1, "fsfull test finished\n");
+    33e5:	83 ec 08             	sub    $0x8,%esp
+    33e8:	68 5c 4c 00 00       	push   $0x4c5c
+    33ed:	6a 01                	push   $0x1
+    33ef:	e8 d5 05 00 00       	call   39c9 <printf>
+}
+    33f4:	83 c4 10             	add    $0x10,%esp
+    33f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    33fa:	5b                   	pop    %ebx
+    33fb:	5e                   	pop    %esi
+    33fc:	5f                   	pop    %edi
+    33fd:	5d                   	pop    %ebp
+    33fe:	c3                   	ret
+    int total = 0;
+    33ff:	bf 00 00 00 00       	mov    $0x0,%edi
+      int cc = write(fd, buf, 512);
+    3404:	83 ec 04             	sub    $0x4,%esp
+    3407:	68 00 02 00 00       	push   $0x200
+    340c:	68 80 84 00 00       	push   $0x8480
+    3411:	56                   	push   %esi
+    3412:	e8 2a 04 00 00       	call   3841 <write>
+      if(cc < 512)
+    3417:	83 c4 10             	add    $0x10,%esp
+    341a:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    341f:	7e 04                	jle    3425 <fsfull+0x1c4>
+      total += cc;
+    3421:	01 c7                	add    %eax,%edi
+    while(1){
+    3423:	eb df                	jmp    3404 <fsfull+0x1a3>
+    printf(1, "wrote %d bytes\n", total);
+    3425:	83 ec 04             	sub    $0x4,%esp
+    3428:	57                   	push   %edi
+    3429:	68 4c 4c 00 00       	push   $0x4c4c
+    342e:	6a 01                	push   $0x1
+    3430:	e8 94 05 00 00       	call   39c9 <printf>
+    close(fd);
+    3435:	89 34 24             	mov    %esi,(%esp)
+    3438:	e8 0c 04 00 00       	call   3849 <close>
+    if(total == 0)
+    343d:	83 c4 10             	add    $0x10,%esp
+    3440:	85 ff                	test   %edi,%edi
+    3442:	0f 84 fa fe ff ff    	je     3342 <fsfull+0xe1>
+  for(nfiles = 0; ; nfiles++){
+    3448:	83 c3 01             	add    $0x1,%ebx
+    344b:	e9 2e fe ff ff       	jmp    327e <fsfull+0x1d>
+
+00003450 <uio>:
+
+void
+uio()
+{
+    3450:	55                   	push   %ebp
+    3451:	89 e5                	mov    %esp,%ebp
+    3453:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+    3456:	68 72 4c 00 00       	push   $0x4c72
+    345b:	6a 01                	push   $0x1
+    345d:	e8 67 05 00 00       	call   39c9 <printf>
+  pid = fork();
+    3462:	e8 b2 03 00 00       	call   3819 <fork>
+  if(pid == 0){
+    3467:	83 c4 10             	add    $0x10,%esp
+    346a:	85 c0                	test   %eax,%eax
+    346c:	74 20                	je     348e <uio+0x3e>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+    346e:	78 43                	js     34b3 <uio+0x63>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait(0);
+    3470:	83 ec 0c             	sub    $0xc,%esp
+    3473:	6a 00                	push   $0x0
+    3475:	e8 af 03 00 00       	call   3829 <wait>
+  printf(1, "uio test done\n");
+    347a:	83 c4 08             	add    $0x8,%esp
+    347d:	68 7c 4c 00 00       	push   $0x4c7c
+    3482:	6a 01                	push   $0x1
+    3484:	e8 40 05 00 00       	call   39c9 <printf>
+}
+    3489:	83 c4 10             	add    $0x10,%esp
+    348c:	c9                   	leave
+    348d:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    348e:	b8 09 00 00 00       	mov    $0x9,%eax
+    3493:	ba 70 00 00 00       	mov    $0x70,%edx
+    3498:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3499:	ba 71 00 00 00       	mov    $0x71,%edx
+    349e:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    349f:	83 ec 08             	sub    $0x8,%esp
+    34a2:	68 08 54 00 00       	push   $0x5408
+    34a7:	6a 01                	push   $0x1
+    34a9:	e8 1b 05 00 00       	call   39c9 <printf>
+    exit();
+    34ae:	e8 6e 03 00 00       	call   3821 <exit>
+    printf (1, "fork failed\n");
+    34b3:	83 ec 08             	sub    $0x8,%esp
+    34b6:	68 01 4c 00 00       	push   $0x4c01
+    34bb:	6a 01                	push   $0x1
+    34bd:	e8 07 05 00 00       	call   39c9 <printf>
+    exit();
+    34c2:	e8 5a 03 00 00       	call   3821 <exit>
+
+000034c7 <argptest>:
+
+void argptest()
+{
+    34c7:	55                   	push   %ebp
+    34c8:	89 e5                	mov    %esp,%ebp
+    34ca:	53                   	push   %ebx
+    34cb:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    34ce:	6a 00                	push   $0x0
+    34d0:	68 8b 4c 00 00       	push   $0x4c8b
+    34d5:	e8 87 03 00 00       	call   3861 <open>
+  if (fd < 0) {
+    34da:	83 c4 10             	add    $0x10,%esp
+    34dd:	85 c0                	test   %eax,%eax
+    34df:	78 3a                	js     351b <argptest+0x54>
+    34e1:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    34e3:	83 ec 0c             	sub    $0xc,%esp
+    34e6:	6a 00                	push   $0x0
+    34e8:	e8 bc 03 00 00       	call   38a9 <sbrk>
+    34ed:	83 c4 0c             	add    $0xc,%esp
+    34f0:	6a ff                	push   $0xffffffff
+    34f2:	83 e8 01             	sub    $0x1,%eax
+    34f5:	50                   	push   %eax
+    34f6:	53                   	push   %ebx
+    34f7:	e8 3d 03 00 00       	call   3839 <read>
+  close(fd);
+    34fc:	89 1c 24             	mov    %ebx,(%esp)
+    34ff:	e8 45 03 00 00       	call   3849 <close>
+  printf(1, "arg test passed\n");
+    3504:	83 c4 08             	add    $0x8,%esp
+    3507:	68 9d 4c 00 00       	push   $0x4c9d
+    350c:	6a 01                	push   $0x1
+    350e:	e8 b6 04 00 00       	call   39c9 <printf>
+}
+    3513:	83 c4 10             	add    $0x10,%esp
+    3516:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3519:	c9                   	leave
+    351a:	c3                   	ret
+    printf(2, "open failed\n");
+    351b:	83 ec 08             	sub    $0x8,%esp
+    351e:	68 90 4c 00 00       	push   $0x4c90
+    3523:	6a 02                	push   $0x2
+    3525:	e8 9f 04 00 00       	call   39c9 <printf>
+    exit();
+    352a:	e8 f2 02 00 00       	call   3821 <exit>
+
+0000352f <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    352f:	69 05 28 5d 00 00 0d 	imul   $0x19660d,0x5d28,%eax
+    3536:	66 19 00 
+    3539:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    353e:	a3 28 5d 00 00       	mov    %eax,0x5d28
+  return randstate;
+}
+    3543:	c3                   	ret
+
+00003544 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    3544:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    3548:	83 e4 f0             	and    $0xfffffff0,%esp
+    354b:	ff 71 fc             	push   -0x4(%ecx)
+    354e:	55                   	push   %ebp
+    354f:	89 e5                	mov    %esp,%ebp
+    3551:	51                   	push   %ecx
+    3552:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+    3555:	68 ae 4c 00 00       	push   $0x4cae
+    355a:	6a 01                	push   $0x1
+    355c:	e8 68 04 00 00       	call   39c9 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    3561:	83 c4 08             	add    $0x8,%esp
+    3564:	6a 00                	push   $0x0
+    3566:	68 c2 4c 00 00       	push   $0x4cc2
+    356b:	e8 f1 02 00 00       	call   3861 <open>
+    3570:	83 c4 10             	add    $0x10,%esp
+    3573:	85 c0                	test   %eax,%eax
+    3575:	78 14                	js     358b <main+0x47>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    3577:	83 ec 08             	sub    $0x8,%esp
+    357a:	68 2c 54 00 00       	push   $0x542c
+    357f:	6a 01                	push   $0x1
+    3581:	e8 43 04 00 00       	call   39c9 <printf>
+    exit();
+    3586:	e8 96 02 00 00       	call   3821 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    358b:	83 ec 08             	sub    $0x8,%esp
+    358e:	68 00 02 00 00       	push   $0x200
+    3593:	68 c2 4c 00 00       	push   $0x4cc2
+    3598:	e8 c4 02 00 00       	call   3861 <open>
+    359d:	89 04 24             	mov    %eax,(%esp)
+    35a0:	e8 a4 02 00 00       	call   3849 <close>
+
+  argptest();
+    35a5:	e8 1d ff ff ff       	call   34c7 <argptest>
+  createdelete();
+    35aa:	e8 a4 da ff ff       	call   1053 <createdelete>
+  linkunlink();
+    35af:	e8 7b e3 ff ff       	call   192f <linkunlink>
+  concreate();
+    35b4:	e8 6b e0 ff ff       	call   1624 <concreate>
+  fourfiles();
+    35b9:	e8 a2 d8 ff ff       	call   e60 <fourfiles>
+  sharedfd();
+    35be:	e8 05 d7 ff ff       	call   cc8 <sharedfd>
+
+  bigargtest();
+    35c3:	e8 95 fb ff ff       	call   315d <bigargtest>
+  bigwrite();
+    35c8:	e8 e1 ec ff ff       	call   22ae <bigwrite>
+  bigargtest();
+    35cd:	e8 8b fb ff ff       	call   315d <bigargtest>
+  bsstest();
+    35d2:	e8 25 fb ff ff       	call   30fc <bsstest>
+  sbrktest();
+    35d7:	e8 30 f6 ff ff       	call   2c0c <sbrktest>
+  validatetest();
+    35dc:	e8 68 fa ff ff       	call   3049 <validatetest>
+
+  opentest();
+    35e1:	e8 d0 cc ff ff       	call   2b6 <opentest>
+  writetest();
+    35e6:	e8 5e cd ff ff       	call   349 <writetest>
+  writetest1();
+    35eb:	e8 37 cf ff ff       	call   527 <writetest1>
+  createtest();
+    35f0:	e8 ec d0 ff ff       	call   6e1 <createtest>
+
+  openiputtest();
+    35f5:	e8 ce cb ff ff       	call   1c8 <openiputtest>
+  exitiputtest();
+    35fa:	e8 de ca ff ff       	call   dd <exitiputtest>
+  iputtest();
+    35ff:	e8 fc c9 ff ff       	call   0 <iputtest>
+
+  mem();
+    3604:	e8 02 d6 ff ff       	call   c0b <mem>
+  pipe1();
+    3609:	e8 9d d2 ff ff       	call   8ab <pipe1>
+  preempt();
+    360e:	e8 32 d4 ff ff       	call   a45 <preempt>
+  exitwait();
+    3613:	e8 80 d5 ff ff       	call   b98 <exitwait>
+
+  rmdot();
+    3618:	e8 71 f0 ff ff       	call   268e <rmdot>
+  fourteen();
+    361d:	e8 2f ef ff ff       	call   2551 <fourteen>
+  bigfile();
+    3622:	e8 62 ed ff ff       	call   2389 <bigfile>
+  subdir();
+    3627:	e8 54 e5 ff ff       	call   1b80 <subdir>
+  linktest();
+    362c:	e8 cd dd ff ff       	call   13fe <linktest>
+  unlinkread();
+    3631:	e8 2f dc ff ff       	call   1265 <unlinkread>
+  dirfile();
+    3636:	e8 d8 f1 ff ff       	call   2813 <dirfile>
+  iref();
+    363b:	e8 ed f3 ff ff       	call   2a2d <iref>
+  forktest();
+    3640:	e8 0a f5 ff ff       	call   2b4f <forktest>
+  bigdir(); // slow
+    3645:	e8 dc e3 ff ff       	call   1a26 <bigdir>
+
+  uio();
+    364a:	e8 01 fe ff ff       	call   3450 <uio>
+
+  exectest();
+    364f:	e8 0e d2 ff ff       	call   862 <exectest>
+
+  exit();
+    3654:	e8 c8 01 00 00       	call   3821 <exit>
+
+00003659 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    3659:	55                   	push   %ebp
+    365a:	89 e5                	mov    %esp,%ebp
+    365c:	53                   	push   %ebx
+    365d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3660:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3663:	b8 00 00 00 00       	mov    $0x0,%eax
+    3668:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    366c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    366f:	83 c0 01             	add    $0x1,%eax
+    3672:	84 d2                	test   %dl,%dl
+    3674:	75 f2                	jne    3668 <strcpy+0xf>
+    ;
+  return os;
+}
+    3676:	89 c8                	mov    %ecx,%eax
+    3678:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    367b:	c9                   	leave
+    367c:	c3                   	ret
+
+0000367d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    367d:	55                   	push   %ebp
+    367e:	89 e5                	mov    %esp,%ebp
+    3680:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3683:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    3686:	0f b6 01             	movzbl (%ecx),%eax
+    3689:	84 c0                	test   %al,%al
+    368b:	74 11                	je     369e <strcmp+0x21>
+    368d:	38 02                	cmp    %al,(%edx)
+    368f:	75 0d                	jne    369e <strcmp+0x21>
+    p++, q++;
+    3691:	83 c1 01             	add    $0x1,%ecx
+    3694:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    3697:	0f b6 01             	movzbl (%ecx),%eax
+    369a:	84 c0                	test   %al,%al
+    369c:	75 ef                	jne    368d <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+    369e:	0f b6 c0             	movzbl %al,%eax
+    36a1:	0f b6 12             	movzbl (%edx),%edx
+    36a4:	29 d0                	sub    %edx,%eax
+}
+    36a6:	5d                   	pop    %ebp
+    36a7:	c3                   	ret
+
+000036a8 <strlen>:
+
+uint
+strlen(char *s)
+{
+    36a8:	55                   	push   %ebp
+    36a9:	89 e5                	mov    %esp,%ebp
+    36ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    36ae:	80 3a 00             	cmpb   $0x0,(%edx)
+    36b1:	74 14                	je     36c7 <strlen+0x1f>
+    36b3:	b8 00 00 00 00       	mov    $0x0,%eax
+    36b8:	83 c0 01             	add    $0x1,%eax
+    36bb:	89 c1                	mov    %eax,%ecx
+    36bd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    36c1:	75 f5                	jne    36b8 <strlen+0x10>
+    ;
+  return n;
+}
+    36c3:	89 c8                	mov    %ecx,%eax
+    36c5:	5d                   	pop    %ebp
+    36c6:	c3                   	ret
+  for(n = 0; s[n]; n++)
+    36c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+    36cc:	eb f5                	jmp    36c3 <strlen+0x1b>
+
+000036ce <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    36ce:	55                   	push   %ebp
+    36cf:	89 e5                	mov    %esp,%ebp
+    36d1:	57                   	push   %edi
+    36d2:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    36d5:	89 d7                	mov    %edx,%edi
+    36d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    36da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    36dd:	fc                   	cld
+    36de:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    36e0:	89 d0                	mov    %edx,%eax
+    36e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    36e5:	c9                   	leave
+    36e6:	c3                   	ret
+
+000036e7 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    36e7:	55                   	push   %ebp
+    36e8:	89 e5                	mov    %esp,%ebp
+    36ea:	8b 45 08             	mov    0x8(%ebp),%eax
+    36ed:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    36f1:	0f b6 10             	movzbl (%eax),%edx
+    36f4:	84 d2                	test   %dl,%dl
+    36f6:	74 15                	je     370d <strchr+0x26>
+    if(*s == c)
+    36f8:	38 d1                	cmp    %dl,%cl
+    36fa:	74 0f                	je     370b <strchr+0x24>
+  for(; *s; s++)
+    36fc:	83 c0 01             	add    $0x1,%eax
+    36ff:	0f b6 10             	movzbl (%eax),%edx
+    3702:	84 d2                	test   %dl,%dl
+    3704:	75 f2                	jne    36f8 <strchr+0x11>
+      return (char*)s;
+  return 0;
+    3706:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    370b:	5d                   	pop    %ebp
+    370c:	c3                   	ret
+  return 0;
+    370d:	b8 00 00 00 00       	mov    $0x0,%eax
+    3712:	eb f7                	jmp    370b <strchr+0x24>
+
+00003714 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3714:	55                   	push   %ebp
+    3715:	89 e5                	mov    %esp,%ebp
+    3717:	57                   	push   %edi
+    3718:	56                   	push   %esi
+    3719:	53                   	push   %ebx
+    371a:	83 ec 2c             	sub    $0x2c,%esp
+    371d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    3720:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+    3725:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+    3728:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    372b:	83 c3 01             	add    $0x1,%ebx
+    372e:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3731:	7d 27                	jge    375a <gets+0x46>
+    cc = read(0, &c, 1);
+    3733:	83 ec 04             	sub    $0x4,%esp
+    3736:	6a 01                	push   $0x1
+    3738:	57                   	push   %edi
+    3739:	6a 00                	push   $0x0
+    373b:	e8 f9 00 00 00       	call   3839 <read>
+    if(cc < 1)
+    3740:	83 c4 10             	add    $0x10,%esp
+    3743:	85 c0                	test   %eax,%eax
+    3745:	7e 13                	jle    375a <gets+0x46>
+      break;
+    buf[i++] = c;
+    3747:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    374b:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+    374f:	3c 0a                	cmp    $0xa,%al
+    3751:	74 04                	je     3757 <gets+0x43>
+    3753:	3c 0d                	cmp    $0xd,%al
+    3755:	75 d1                	jne    3728 <gets+0x14>
+  for(i=0; i+1 < max; ){
+    3757:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+    375a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    375d:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+    3761:	89 f0                	mov    %esi,%eax
+    3763:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3766:	5b                   	pop    %ebx
+    3767:	5e                   	pop    %esi
+    3768:	5f                   	pop    %edi
+    3769:	5d                   	pop    %ebp
+    376a:	c3                   	ret
+
+0000376b <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    376b:	55                   	push   %ebp
+    376c:	89 e5                	mov    %esp,%ebp
+    376e:	56                   	push   %esi
+    376f:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3770:	83 ec 08             	sub    $0x8,%esp
+    3773:	6a 00                	push   $0x0
+    3775:	ff 75 08             	push   0x8(%ebp)
+    3778:	e8 e4 00 00 00       	call   3861 <open>
+  if(fd < 0)
+    377d:	83 c4 10             	add    $0x10,%esp
+    3780:	85 c0                	test   %eax,%eax
+    3782:	78 24                	js     37a8 <stat+0x3d>
+    3784:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    3786:	83 ec 08             	sub    $0x8,%esp
+    3789:	ff 75 0c             	push   0xc(%ebp)
+    378c:	50                   	push   %eax
+    378d:	e8 e7 00 00 00       	call   3879 <fstat>
+    3792:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3794:	89 1c 24             	mov    %ebx,(%esp)
+    3797:	e8 ad 00 00 00       	call   3849 <close>
+  return r;
+    379c:	83 c4 10             	add    $0x10,%esp
+}
+    379f:	89 f0                	mov    %esi,%eax
+    37a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    37a4:	5b                   	pop    %ebx
+    37a5:	5e                   	pop    %esi
+    37a6:	5d                   	pop    %ebp
+    37a7:	c3                   	ret
+    return -1;
+    37a8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    37ad:	eb f0                	jmp    379f <stat+0x34>
+
+000037af <atoi>:
+
+int
+atoi(const char *s)
+{
+    37af:	55                   	push   %ebp
+    37b0:	89 e5                	mov    %esp,%ebp
+    37b2:	53                   	push   %ebx
+    37b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    37b6:	0f b6 02             	movzbl (%edx),%eax
+    37b9:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    37bc:	80 f9 09             	cmp    $0x9,%cl
+    37bf:	77 24                	ja     37e5 <atoi+0x36>
+  n = 0;
+    37c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+    37c6:	83 c2 01             	add    $0x1,%edx
+    37c9:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    37cc:	0f be c0             	movsbl %al,%eax
+    37cf:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    37d3:	0f b6 02             	movzbl (%edx),%eax
+    37d6:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    37d9:	80 fb 09             	cmp    $0x9,%bl
+    37dc:	76 e8                	jbe    37c6 <atoi+0x17>
+  return n;
+}
+    37de:	89 c8                	mov    %ecx,%eax
+    37e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    37e3:	c9                   	leave
+    37e4:	c3                   	ret
+  n = 0;
+    37e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+    37ea:	eb f2                	jmp    37de <atoi+0x2f>
+
+000037ec <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    37ec:	55                   	push   %ebp
+    37ed:	89 e5                	mov    %esp,%ebp
+    37ef:	56                   	push   %esi
+    37f0:	53                   	push   %ebx
+    37f1:	8b 75 08             	mov    0x8(%ebp),%esi
+    37f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+    37f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    37fa:	85 db                	test   %ebx,%ebx
+    37fc:	7e 15                	jle    3813 <memmove+0x27>
+    37fe:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+    3800:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+    3802:	83 c2 01             	add    $0x1,%edx
+    3805:	83 c0 01             	add    $0x1,%eax
+    3808:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+    380c:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+    380f:	39 c3                	cmp    %eax,%ebx
+    3811:	75 ef                	jne    3802 <memmove+0x16>
+  return vdst;
+}
+    3813:	89 f0                	mov    %esi,%eax
+    3815:	5b                   	pop    %ebx
+    3816:	5e                   	pop    %esi
+    3817:	5d                   	pop    %ebp
+    3818:	c3                   	ret
+
+00003819 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3819:	b8 01 00 00 00       	mov    $0x1,%eax
+    381e:	cd 40                	int    $0x40
+    3820:	c3                   	ret
+
+00003821 <exit>:
+SYSCALL(exit)
+    3821:	b8 02 00 00 00       	mov    $0x2,%eax
+    3826:	cd 40                	int    $0x40
+    3828:	c3                   	ret
+
+00003829 <wait>:
+SYSCALL(wait)
+    3829:	b8 03 00 00 00       	mov    $0x3,%eax
+    382e:	cd 40                	int    $0x40
+    3830:	c3                   	ret
+
+00003831 <pipe>:
+SYSCALL(pipe)
+    3831:	b8 04 00 00 00       	mov    $0x4,%eax
+    3836:	cd 40                	int    $0x40
+    3838:	c3                   	ret
+
+00003839 <read>:
+SYSCALL(read)
+    3839:	b8 05 00 00 00       	mov    $0x5,%eax
+    383e:	cd 40                	int    $0x40
+    3840:	c3                   	ret
+
+00003841 <write>:
+SYSCALL(write)
+    3841:	b8 10 00 00 00       	mov    $0x10,%eax
+    3846:	cd 40                	int    $0x40
+    3848:	c3                   	ret
+
+00003849 <close>:
+SYSCALL(close)
+    3849:	b8 15 00 00 00       	mov    $0x15,%eax
+    384e:	cd 40                	int    $0x40
+    3850:	c3                   	ret
+
+00003851 <kill>:
+SYSCALL(kill)
+    3851:	b8 06 00 00 00       	mov    $0x6,%eax
+    3856:	cd 40                	int    $0x40
+    3858:	c3                   	ret
+
+00003859 <exec>:
+SYSCALL(exec)
+    3859:	b8 07 00 00 00       	mov    $0x7,%eax
+    385e:	cd 40                	int    $0x40
+    3860:	c3                   	ret
+
+00003861 <open>:
+SYSCALL(open)
+    3861:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3866:	cd 40                	int    $0x40
+    3868:	c3                   	ret
+
+00003869 <mknod>:
+SYSCALL(mknod)
+    3869:	b8 11 00 00 00       	mov    $0x11,%eax
+    386e:	cd 40                	int    $0x40
+    3870:	c3                   	ret
+
+00003871 <unlink>:
+SYSCALL(unlink)
+    3871:	b8 12 00 00 00       	mov    $0x12,%eax
+    3876:	cd 40                	int    $0x40
+    3878:	c3                   	ret
+
+00003879 <fstat>:
+SYSCALL(fstat)
+    3879:	b8 08 00 00 00       	mov    $0x8,%eax
+    387e:	cd 40                	int    $0x40
+    3880:	c3                   	ret
+
+00003881 <link>:
+SYSCALL(link)
+    3881:	b8 13 00 00 00       	mov    $0x13,%eax
+    3886:	cd 40                	int    $0x40
+    3888:	c3                   	ret
+
+00003889 <mkdir>:
+SYSCALL(mkdir)
+    3889:	b8 14 00 00 00       	mov    $0x14,%eax
+    388e:	cd 40                	int    $0x40
+    3890:	c3                   	ret
+
+00003891 <chdir>:
+SYSCALL(chdir)
+    3891:	b8 09 00 00 00       	mov    $0x9,%eax
+    3896:	cd 40                	int    $0x40
+    3898:	c3                   	ret
+
+00003899 <dup>:
+SYSCALL(dup)
+    3899:	b8 0a 00 00 00       	mov    $0xa,%eax
+    389e:	cd 40                	int    $0x40
+    38a0:	c3                   	ret
+
+000038a1 <getpid>:
+SYSCALL(getpid)
+    38a1:	b8 0b 00 00 00       	mov    $0xb,%eax
+    38a6:	cd 40                	int    $0x40
+    38a8:	c3                   	ret
+
+000038a9 <sbrk>:
+SYSCALL(sbrk)
+    38a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+    38ae:	cd 40                	int    $0x40
+    38b0:	c3                   	ret
+
+000038b1 <sleep>:
+SYSCALL(sleep)
+    38b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+    38b6:	cd 40                	int    $0x40
+    38b8:	c3                   	ret
+
+000038b9 <uptime>:
+SYSCALL(uptime)
+    38b9:	b8 0e 00 00 00       	mov    $0xe,%eax
+    38be:	cd 40                	int    $0x40
+    38c0:	c3                   	ret
+
+000038c1 <readmouse>:
+SYSCALL(readmouse)
+    38c1:	b8 16 00 00 00       	mov    $0x16,%eax
+    38c6:	cd 40                	int    $0x40
+    38c8:	c3                   	ret
+
+000038c9 <sigsend>:
+SYSCALL(sigsend)
+    38c9:	b8 17 00 00 00       	mov    $0x17,%eax
+    38ce:	cd 40                	int    $0x40
+    38d0:	c3                   	ret
+
+000038d1 <sigsethandler>:
+SYSCALL(sigsethandler)
+    38d1:	b8 18 00 00 00       	mov    $0x18,%eax
+    38d6:	cd 40                	int    $0x40
+    38d8:	c3                   	ret
+
+000038d9 <sigreturn>:
+SYSCALL(sigreturn)
+    38d9:	b8 19 00 00 00       	mov    $0x19,%eax
+    38de:	cd 40                	int    $0x40
+    38e0:	c3                   	ret
+
+000038e1 <siggetmask>:
+SYSCALL(siggetmask)
+    38e1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    38e6:	cd 40                	int    $0x40
+    38e8:	c3                   	ret
+
+000038e9 <sigsetmask>:
+SYSCALL(sigsetmask)
+    38e9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    38ee:	cd 40                	int    $0x40
+    38f0:	c3                   	ret
+
+000038f1 <sigpause>:
+SYSCALL(sigpause)
+    38f1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    38f6:	cd 40                	int    $0x40
+    38f8:	c3                   	ret
+
+000038f9 <predict_cpu>:
+SYSCALL(predict_cpu)
+    38f9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    38fe:	cd 40                	int    $0x40
+    3900:	c3                   	ret
+
+00003901 <sleeptick>:
+SYSCALL(sleeptick)
+    3901:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3906:	cd 40                	int    $0x40
+    3908:	c3                   	ret
+
+00003909 <schedctl>:
+SYSCALL(schedctl)
+    3909:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    390e:	cd 40                	int    $0x40
+    3910:	c3                   	ret
+
+00003911 <nswtch>:
+SYSCALL(nswtch)
+    3911:	b8 20 00 00 00       	mov    $0x20,%eax
+    3916:	cd 40                	int    $0x40
+    3918:	c3                   	ret
+
+00003919 <getloadavg>:
+SYSCALL(getloadavg)
+    3919:	b8 21 00 00 00       	mov    $0x21,%eax
+    391e:	cd 40                	int    $0x40
+    3920:	c3                   	ret
+
+00003921 <memstat>:
+SYSCALL(memstat)
+    3921:	b8 22 00 00 00       	mov    $0x22,%eax
+    3926:	cd 40                	int    $0x40
+    3928:	c3                   	ret
+
+00003929 <iostat>:
+SYSCALL(iostat)
+    3929:	b8 23 00 00 00       	mov    $0x23,%eax
+    392e:	cd 40                	int    $0x40
+    3930:	c3                   	ret
+
+00003931 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3931:	55                   	push   %ebp
+    3932:	89 e5                	mov    %esp,%ebp
+    3934:	57                   	push   %edi
+    3935:	56                   	push   %esi
+    3936:	53                   	push   %ebx
+    3937:	83 ec 3c             	sub    $0x3c,%esp
+    393a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    393d:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    393f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    3943:	74 79                	je     39be <printint+0x8d>
+    3945:	85 d2                	test   %edx,%edx
+    3947:	79 75                	jns    39be <printint+0x8d>
+    neg = 1;
+    x = -xx;
+    3949:	89 d1                	mov    %edx,%ecx
+    394b:	f7 d9                	neg    %ecx
+    neg = 1;
+    394d:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3954:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    3959:	89 df                	mov    %ebx,%edi
+    395b:	83 c3 01             	add    $0x1,%ebx
+    395e:	89 c8                	mov    %ecx,%eax
+    3960:	ba 00 00 00 00       	mov    $0x0,%edx
+    3965:	f7 f6                	div    %esi
+    3967:	0f b6 92 b8 54 00 00 	movzbl 0x54b8(%edx),%edx
+    396e:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+    3972:	89 ca                	mov    %ecx,%edx
+    3974:	89 c1                	mov    %eax,%ecx
+    3976:	39 f2                	cmp    %esi,%edx
+    3978:	73 df                	jae    3959 <printint+0x28>
+  if(neg)
+    397a:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+    397e:	74 08                	je     3988 <printint+0x57>
+    buf[i++] = '-';
+    3980:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    3985:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+    3988:	85 db                	test   %ebx,%ebx
+    398a:	7e 2a                	jle    39b6 <printint+0x85>
+    398c:	8d 75 d8             	lea    -0x28(%ebp),%esi
+    398f:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+    3993:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+    3996:	0f b6 03             	movzbl (%ebx),%eax
+    3999:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+    399c:	83 ec 04             	sub    $0x4,%esp
+    399f:	6a 01                	push   $0x1
+    39a1:	57                   	push   %edi
+    39a2:	ff 75 c4             	push   -0x3c(%ebp)
+    39a5:	e8 97 fe ff ff       	call   3841 <write>
+  while(--i >= 0)
+    39aa:	89 d8                	mov    %ebx,%eax
+    39ac:	83 eb 01             	sub    $0x1,%ebx
+    39af:	83 c4 10             	add    $0x10,%esp
+    39b2:	39 f0                	cmp    %esi,%eax
+    39b4:	75 e0                	jne    3996 <printint+0x65>
+}
+    39b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    39b9:	5b                   	pop    %ebx
+    39ba:	5e                   	pop    %esi
+    39bb:	5f                   	pop    %edi
+    39bc:	5d                   	pop    %ebp
+    39bd:	c3                   	ret
+    x = xx;
+    39be:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+    39c0:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+    39c7:	eb 8b                	jmp    3954 <printint+0x23>
+
+000039c9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    39c9:	55                   	push   %ebp
+    39ca:	89 e5                	mov    %esp,%ebp
+    39cc:	57                   	push   %edi
+    39cd:	56                   	push   %esi
+    39ce:	53                   	push   %ebx
+    39cf:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    39d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+    39d5:	0f b6 1e             	movzbl (%esi),%ebx
+    39d8:	84 db                	test   %bl,%bl
+    39da:	0f 84 9e 01 00 00    	je     3b7e <printf+0x1b5>
+    39e0:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+    39e3:	8d 45 10             	lea    0x10(%ebp),%eax
+    39e6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+    39e9:	bf 00 00 00 00       	mov    $0x0,%edi
+    39ee:	eb 2d                	jmp    3a1d <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+    39f0:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    39f3:	83 ec 04             	sub    $0x4,%esp
+    39f6:	6a 01                	push   $0x1
+    39f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    39fb:	50                   	push   %eax
+    39fc:	ff 75 08             	push   0x8(%ebp)
+    39ff:	e8 3d fe ff ff       	call   3841 <write>
+        putc(fd, c);
+    3a04:	83 c4 10             	add    $0x10,%esp
+    3a07:	eb 05                	jmp    3a0e <printf+0x45>
+      }
+    } else if(state == '%'){
+    3a09:	83 ff 25             	cmp    $0x25,%edi
+    3a0c:	74 1f                	je     3a2d <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+    3a0e:	83 c6 01             	add    $0x1,%esi
+    3a11:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+    3a15:	84 db                	test   %bl,%bl
+    3a17:	0f 84 61 01 00 00    	je     3b7e <printf+0x1b5>
+    c = fmt[i] & 0xff;
+    3a1d:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    3a20:	85 ff                	test   %edi,%edi
+    3a22:	75 e5                	jne    3a09 <printf+0x40>
+      if(c == '%'){
+    3a24:	83 f8 25             	cmp    $0x25,%eax
+    3a27:	75 c7                	jne    39f0 <printf+0x27>
+        state = '%';
+    3a29:	89 c7                	mov    %eax,%edi
+    3a2b:	eb e1                	jmp    3a0e <printf+0x45>
+      if(c == 'd'){
+    3a2d:	83 f8 25             	cmp    $0x25,%eax
+    3a30:	0f 84 f4 00 00 00    	je     3b2a <printf+0x161>
+    3a36:	8d 50 9d             	lea    -0x63(%eax),%edx
+    3a39:	83 fa 15             	cmp    $0x15,%edx
+    3a3c:	0f 87 09 01 00 00    	ja     3b4b <printf+0x182>
+    3a42:	0f 87 03 01 00 00    	ja     3b4b <printf+0x182>
+    3a48:	ff 24 95 60 54 00 00 	jmp    *0x5460(,%edx,4)
+        printint(fd, *ap, 10, 1);
+    3a4f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    3a52:	8b 17                	mov    (%edi),%edx
+    3a54:	83 ec 0c             	sub    $0xc,%esp
+    3a57:	6a 01                	push   $0x1
+    3a59:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    3a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a61:	e8 cb fe ff ff       	call   3931 <printint>
+        ap++;
+    3a66:	83 c7 04             	add    $0x4,%edi
+    3a69:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    3a6c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+    3a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+    3a74:	eb 98                	jmp    3a0e <printf+0x45>
+        printint(fd, *ap, 16, 0);
+    3a76:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    3a79:	8b 17                	mov    (%edi),%edx
+    3a7b:	83 ec 0c             	sub    $0xc,%esp
+    3a7e:	6a 00                	push   $0x0
+    3a80:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3a85:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a88:	e8 a4 fe ff ff       	call   3931 <printint>
+        ap++;
+    3a8d:	83 c7 04             	add    $0x4,%edi
+    3a90:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    3a93:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3a96:	bf 00 00 00 00       	mov    $0x0,%edi
+    3a9b:	e9 6e ff ff ff       	jmp    3a0e <printf+0x45>
+        s = (char*)*ap;
+    3aa0:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    3aa3:	8b 01                	mov    (%ecx),%eax
+        ap++;
+    3aa5:	83 c1 04             	add    $0x4,%ecx
+    3aa8:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+    3aab:	85 c0                	test   %eax,%eax
+    3aad:	74 13                	je     3ac2 <printf+0xf9>
+        s = (char*)*ap;
+    3aaf:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+    3ab1:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+    3ab4:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+    3ab9:	84 c0                	test   %al,%al
+    3abb:	75 0f                	jne    3acc <printf+0x103>
+    3abd:	e9 4c ff ff ff       	jmp    3a0e <printf+0x45>
+          s = "(null)";
+    3ac2:	bb 56 54 00 00       	mov    $0x5456,%ebx
+        while(*s != 0){
+    3ac7:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+    3acc:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    3acf:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    3ad2:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+    3ad5:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    3ad8:	83 ec 04             	sub    $0x4,%esp
+    3adb:	6a 01                	push   $0x1
+    3add:	57                   	push   %edi
+    3ade:	56                   	push   %esi
+    3adf:	e8 5d fd ff ff       	call   3841 <write>
+          s++;
+    3ae4:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+    3ae7:	0f b6 03             	movzbl (%ebx),%eax
+    3aea:	83 c4 10             	add    $0x10,%esp
+    3aed:	84 c0                	test   %al,%al
+    3aef:	75 e4                	jne    3ad5 <printf+0x10c>
+      state = 0;
+    3af1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    3af4:	bf 00 00 00 00       	mov    $0x0,%edi
+    3af9:	e9 10 ff ff ff       	jmp    3a0e <printf+0x45>
+        putc(fd, *ap);
+    3afe:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    3b01:	8b 07                	mov    (%edi),%eax
+    3b03:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b06:	83 ec 04             	sub    $0x4,%esp
+    3b09:	6a 01                	push   $0x1
+    3b0b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3b0e:	50                   	push   %eax
+    3b0f:	ff 75 08             	push   0x8(%ebp)
+    3b12:	e8 2a fd ff ff       	call   3841 <write>
+        ap++;
+    3b17:	83 c7 04             	add    $0x4,%edi
+    3b1a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    3b1d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3b20:	bf 00 00 00 00       	mov    $0x0,%edi
+    3b25:	e9 e4 fe ff ff       	jmp    3a0e <printf+0x45>
+        putc(fd, c);
+    3b2a:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b2d:	83 ec 04             	sub    $0x4,%esp
+    3b30:	6a 01                	push   $0x1
+    3b32:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3b35:	50                   	push   %eax
+    3b36:	ff 75 08             	push   0x8(%ebp)
+    3b39:	e8 03 fd ff ff       	call   3841 <write>
+    3b3e:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3b41:	bf 00 00 00 00       	mov    $0x0,%edi
+    3b46:	e9 c3 fe ff ff       	jmp    3a0e <printf+0x45>
+        putc(fd, '%');
+    3b4b:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b4f:	83 ec 04             	sub    $0x4,%esp
+    3b52:	6a 01                	push   $0x1
+    3b54:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    3b57:	57                   	push   %edi
+    3b58:	ff 75 08             	push   0x8(%ebp)
+    3b5b:	e8 e1 fc ff ff       	call   3841 <write>
+        putc(fd, c);
+    3b60:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+    3b63:	83 c4 0c             	add    $0xc,%esp
+    3b66:	6a 01                	push   $0x1
+    3b68:	57                   	push   %edi
+    3b69:	ff 75 08             	push   0x8(%ebp)
+    3b6c:	e8 d0 fc ff ff       	call   3841 <write>
+        putc(fd, c);
+    3b71:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3b74:	bf 00 00 00 00       	mov    $0x0,%edi
+    3b79:	e9 90 fe ff ff       	jmp    3a0e <printf+0x45>
+    }
+  }
+}
+    3b7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3b81:	5b                   	pop    %ebx
+    3b82:	5e                   	pop    %esi
+    3b83:	5f                   	pop    %edi
+    3b84:	5d                   	pop    %ebp
+    3b85:	c3                   	ret
+
+00003b86 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    3b86:	55                   	push   %ebp
+    3b87:	89 e5                	mov    %esp,%ebp
+    3b89:	57                   	push   %edi
+    3b8a:	56                   	push   %esi
+    3b8b:	53                   	push   %ebx
+    3b8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    3b8f:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3b92:	a1 00 a5 00 00       	mov    0xa500,%eax
+    3b97:	eb 0c                	jmp    3ba5 <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3b99:	8b 10                	mov    (%eax),%edx
+    3b9b:	39 d0                	cmp    %edx,%eax
+    3b9d:	72 04                	jb     3ba3 <free+0x1d>
+    3b9f:	39 d1                	cmp    %edx,%ecx
+    3ba1:	72 10                	jb     3bb3 <free+0x2d>
+{
+    3ba3:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    3ba5:	39 c8                	cmp    %ecx,%eax
+    3ba7:	73 f0                	jae    3b99 <free+0x13>
+    3ba9:	8b 10                	mov    (%eax),%edx
+    3bab:	39 d1                	cmp    %edx,%ecx
+    3bad:	72 04                	jb     3bb3 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    3baf:	39 d0                	cmp    %edx,%eax
+    3bb1:	72 f0                	jb     3ba3 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    3bb3:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    3bb6:	8b 10                	mov    (%eax),%edx
+    3bb8:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    3bbb:	39 fa                	cmp    %edi,%edx
+    3bbd:	74 19                	je     3bd8 <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3bbf:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    3bc2:	8b 50 04             	mov    0x4(%eax),%edx
+    3bc5:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+    3bc8:	39 f1                	cmp    %esi,%ecx
+    3bca:	74 18                	je     3be4 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    3bcc:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    3bce:	a3 00 a5 00 00       	mov    %eax,0xa500
+}
+    3bd3:	5b                   	pop    %ebx
+    3bd4:	5e                   	pop    %esi
+    3bd5:	5f                   	pop    %edi
+    3bd6:	5d                   	pop    %ebp
+    3bd7:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+    3bd8:	03 72 04             	add    0x4(%edx),%esi
+    3bdb:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    3bde:	8b 10                	mov    (%eax),%edx
+    3be0:	8b 12                	mov    (%edx),%edx
+    3be2:	eb db                	jmp    3bbf <free+0x39>
+    p->s.size += bp->s.size;
+    3be4:	03 53 fc             	add    -0x4(%ebx),%edx
+    3be7:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    3bea:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    3bed:	eb dd                	jmp    3bcc <free+0x46>
+
+00003bef <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    3bef:	55                   	push   %ebp
+    3bf0:	89 e5                	mov    %esp,%ebp
+    3bf2:	57                   	push   %edi
+    3bf3:	56                   	push   %esi
+    3bf4:	53                   	push   %ebx
+    3bf5:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    3bf8:	8b 45 08             	mov    0x8(%ebp),%eax
+    3bfb:	8d 58 07             	lea    0x7(%eax),%ebx
+    3bfe:	c1 eb 03             	shr    $0x3,%ebx
+    3c01:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+    3c04:	8b 15 00 a5 00 00    	mov    0xa500,%edx
+    3c0a:	85 d2                	test   %edx,%edx
+    3c0c:	74 1c                	je     3c2a <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3c0e:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    3c10:	8b 48 04             	mov    0x4(%eax),%ecx
+    3c13:	39 d9                	cmp    %ebx,%ecx
+    3c15:	73 38                	jae    3c4f <malloc+0x60>
+  if(nu < 4096)
+    3c17:	be 00 10 00 00       	mov    $0x1000,%esi
+    3c1c:	39 f3                	cmp    %esi,%ebx
+    3c1e:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+    3c21:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+    3c28:	eb 72                	jmp    3c9c <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+    3c2a:	c7 05 00 a5 00 00 04 	movl   $0xa504,0xa500
+    3c31:	a5 00 00 
+    3c34:	c7 05 04 a5 00 00 04 	movl   $0xa504,0xa504
+    3c3b:	a5 00 00 
+    base.s.size = 0;
+    3c3e:	c7 05 08 a5 00 00 00 	movl   $0x0,0xa508
+    3c45:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3c48:	b8 04 a5 00 00       	mov    $0xa504,%eax
+    if(p->s.size >= nunits){
+    3c4d:	eb c8                	jmp    3c17 <malloc+0x28>
+      if(p->s.size == nunits)
+    3c4f:	39 cb                	cmp    %ecx,%ebx
+    3c51:	74 1e                	je     3c71 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+    3c53:	29 d9                	sub    %ebx,%ecx
+    3c55:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    3c58:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    3c5b:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+    3c5e:	89 15 00 a5 00 00    	mov    %edx,0xa500
+      return (void*)(p + 1);
+    3c64:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+    3c67:	89 d0                	mov    %edx,%eax
+    3c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c6c:	5b                   	pop    %ebx
+    3c6d:	5e                   	pop    %esi
+    3c6e:	5f                   	pop    %edi
+    3c6f:	5d                   	pop    %ebp
+    3c70:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+    3c71:	8b 08                	mov    (%eax),%ecx
+    3c73:	89 0a                	mov    %ecx,(%edx)
+    3c75:	eb e7                	jmp    3c5e <malloc+0x6f>
+  hp->s.size = nu;
+    3c77:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+    3c7a:	83 ec 0c             	sub    $0xc,%esp
+    3c7d:	83 c0 08             	add    $0x8,%eax
+    3c80:	50                   	push   %eax
+    3c81:	e8 00 ff ff ff       	call   3b86 <free>
+  return freep;
+    3c86:	8b 15 00 a5 00 00    	mov    0xa500,%edx
+      if((p = morecore(nunits)) == 0)
+    3c8c:	83 c4 10             	add    $0x10,%esp
+    3c8f:	85 d2                	test   %edx,%edx
+    3c91:	74 d4                	je     3c67 <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    3c93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    3c95:	8b 48 04             	mov    0x4(%eax),%ecx
+    3c98:	39 d9                	cmp    %ebx,%ecx
+    3c9a:	73 b3                	jae    3c4f <malloc+0x60>
+    if(p == freep)
+    3c9c:	89 c2                	mov    %eax,%edx
+    3c9e:	39 05 00 a5 00 00    	cmp    %eax,0xa500
+    3ca4:	75 ed                	jne    3c93 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+    3ca6:	83 ec 0c             	sub    $0xc,%esp
+    3ca9:	57                   	push   %edi
+    3caa:	e8 fa fb ff ff       	call   38a9 <sbrk>
+  if(p == (char*)-1)
+    3caf:	83 c4 10             	add    $0x10,%esp
+    3cb2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3cb5:	75 c0                	jne    3c77 <malloc+0x88>
+        return 0;
+    3cb7:	ba 00 00 00 00       	mov    $0x0,%edx
+    3cbc:	eb a9                	jmp    3c67 <malloc+0x78>
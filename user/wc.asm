@@ -0,0 +1,1249 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	83 ec 1c             	sub    $0x1c,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+  inword = 0;
+   9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  l = w = c = 0;
+  10:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  17:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  1e:	be 00 00 00 00       	mov    $0x0,%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  23:	eb 4d                	jmp    72 <wc+0x72>
+    for(i=0; i<n; i++){
+      c++;
+      if(buf[i] == '\n')
+        l++;
+      if(strchr(" \r\t\n\v", buf[i]))
+        inword = 0;
+  25:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  2c:	83 c3 01             	add    $0x1,%ebx
+  2f:	39 df                	cmp    %ebx,%edi
+  31:	74 3c                	je     6f <wc+0x6f>
+      if(buf[i] == '\n')
+  33:	0f b6 83 00 0b 00 00 	movzbl 0xb00(%ebx),%eax
+        l++;
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	0f 94 c2             	sete   %dl
+  3f:	0f b6 d2             	movzbl %dl,%edx
+  42:	01 d6                	add    %edx,%esi
+      if(strchr(" \r\t\n\v", buf[i]))
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	0f be c0             	movsbl %al,%eax
+  4a:	50                   	push   %eax
+  4b:	68 c4 07 00 00       	push   $0x7c4
+  50:	e8 98 01 00 00       	call   1ed <strchr>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	85 c0                	test   %eax,%eax
+  5a:	75 c9                	jne    25 <wc+0x25>
+      else if(!inword){
+  5c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  60:	75 ca                	jne    2c <wc+0x2c>
+        w++;
+  62:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+  66:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  6d:	eb bd                	jmp    2c <wc+0x2c>
+      c++;
+  6f:	01 5d dc             	add    %ebx,-0x24(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	68 00 02 00 00       	push   $0x200
+  7a:	68 00 0b 00 00       	push   $0xb00
+  7f:	ff 75 08             	push   0x8(%ebp)
+  82:	e8 b8 02 00 00       	call   33f <read>
+  87:	89 c7                	mov    %eax,%edi
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	85 c0                	test   %eax,%eax
+  8e:	7e 07                	jle    97 <wc+0x97>
+    for(i=0; i<n; i++){
+  90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  95:	eb 9c                	jmp    33 <wc+0x33>
+      }
+    }
+  }
+  if(n < 0){
+  97:	78 24                	js     bd <wc+0xbd>
+    printf(1, "wc: read error\n");
+    exit();
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  99:	83 ec 08             	sub    $0x8,%esp
+  9c:	ff 75 0c             	push   0xc(%ebp)
+  9f:	ff 75 dc             	push   -0x24(%ebp)
+  a2:	ff 75 e0             	push   -0x20(%ebp)
+  a5:	56                   	push   %esi
+  a6:	68 da 07 00 00       	push   $0x7da
+  ab:	6a 01                	push   $0x1
+  ad:	e8 1d 04 00 00       	call   4cf <printf>
+}
+  b2:	83 c4 20             	add    $0x20,%esp
+  b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  b8:	5b                   	pop    %ebx
+  b9:	5e                   	pop    %esi
+  ba:	5f                   	pop    %edi
+  bb:	5d                   	pop    %ebp
+  bc:	c3                   	ret
+    printf(1, "wc: read error\n");
+  bd:	83 ec 08             	sub    $0x8,%esp
+  c0:	68 ca 07 00 00       	push   $0x7ca
+  c5:	6a 01                	push   $0x1
+  c7:	e8 03 04 00 00       	call   4cf <printf>
+    exit();
+  cc:	e8 56 02 00 00       	call   327 <exit>
+
+000000d1 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  d1:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  d5:	83 e4 f0             	and    $0xfffffff0,%esp
+  d8:	ff 71 fc             	push   -0x4(%ecx)
+  db:	55                   	push   %ebp
+  dc:	89 e5                	mov    %esp,%ebp
+  de:	57                   	push   %edi
+  df:	56                   	push   %esi
+  e0:	53                   	push   %ebx
+  e1:	51                   	push   %ecx
+  e2:	83 ec 18             	sub    $0x18,%esp
+  e5:	8b 01                	mov    (%ecx),%eax
+  e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  ea:	8b 71 04             	mov    0x4(%ecx),%esi
+  int fd, i;
+
+  if(argc <= 1){
+  ed:	83 c6 04             	add    $0x4,%esi
+    wc(0, "");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  if(argc <= 1){
+  f5:	83 f8 01             	cmp    $0x1,%eax
+  f8:	7e 3b                	jle    135 <main+0x64>
+    if((fd = open(argv[i], 0)) < 0){
+  fa:	83 ec 08             	sub    $0x8,%esp
+  fd:	6a 00                	push   $0x0
+  ff:	ff 36                	push   (%esi)
+ 101:	e8 61 02 00 00       	call   367 <open>
+ 106:	89 c3                	mov    %eax,%ebx
+ 108:	83 c4 10             	add    $0x10,%esp
+ 10b:	85 c0                	test   %eax,%eax
+ 10d:	78 3a                	js     149 <main+0x78>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+ 10f:	83 ec 08             	sub    $0x8,%esp
+ 112:	ff 36                	push   (%esi)
+ 114:	50                   	push   %eax
+ 115:	e8 e6 fe ff ff       	call   0 <wc>
+    close(fd);
+ 11a:	89 1c 24             	mov    %ebx,(%esp)
+ 11d:	e8 2d 02 00 00       	call   34f <close>
+  for(i = 1; i < argc; i++){
+ 122:	83 c7 01             	add    $0x1,%edi
+ 125:	83 c6 04             	add    $0x4,%esi
+ 128:	83 c4 10             	add    $0x10,%esp
+ 12b:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12e:	75 ca                	jne    fa <main+0x29>
+  }
+  exit();
+ 130:	e8 f2 01 00 00       	call   327 <exit>
+    wc(0, "");
+ 135:	83 ec 08             	sub    $0x8,%esp
+ 138:	68 d9 07 00 00       	push   $0x7d9
+ 13d:	6a 00                	push   $0x0
+ 13f:	e8 bc fe ff ff       	call   0 <wc>
+    exit();
+ 144:	e8 de 01 00 00       	call   327 <exit>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 149:	83 ec 04             	sub    $0x4,%esp
+ 14c:	ff 36                	push   (%esi)
+ 14e:	68 e7 07 00 00       	push   $0x7e7
+ 153:	6a 01                	push   $0x1
+ 155:	e8 75 03 00 00       	call   4cf <printf>
+      exit();
+ 15a:	e8 c8 01 00 00       	call   327 <exit>
+
+0000015f <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 15f:	55                   	push   %ebp
+ 160:	89 e5                	mov    %esp,%ebp
+ 162:	53                   	push   %ebx
+ 163:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 166:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 169:	b8 00 00 00 00       	mov    $0x0,%eax
+ 16e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 172:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 175:	83 c0 01             	add    $0x1,%eax
+ 178:	84 d2                	test   %dl,%dl
+ 17a:	75 f2                	jne    16e <strcpy+0xf>
+    ;
+  return os;
+}
+ 17c:	89 c8                	mov    %ecx,%eax
+ 17e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 181:	c9                   	leave
+ 182:	c3                   	ret
+
+00000183 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 183:	55                   	push   %ebp
+ 184:	89 e5                	mov    %esp,%ebp
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 18c:	0f b6 01             	movzbl (%ecx),%eax
+ 18f:	84 c0                	test   %al,%al
+ 191:	74 11                	je     1a4 <strcmp+0x21>
+ 193:	38 02                	cmp    %al,(%edx)
+ 195:	75 0d                	jne    1a4 <strcmp+0x21>
+    p++, q++;
+ 197:	83 c1 01             	add    $0x1,%ecx
+ 19a:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 19d:	0f b6 01             	movzbl (%ecx),%eax
+ 1a0:	84 c0                	test   %al,%al
+ 1a2:	75 ef                	jne    193 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+ 1a4:	0f b6 c0             	movzbl %al,%eax
+ 1a7:	0f b6 12             	movzbl (%edx),%edx
+ 1aa:	29 d0                	sub    %edx,%eax
+}
+ 1ac:	5d                   	pop    %ebp
+ 1ad:	c3                   	ret
+
+000001ae <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1ae:	55                   	push   %ebp
+ 1af:	89 e5                	mov    %esp,%ebp
+ 1b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b4:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b7:	74 14                	je     1cd <strlen+0x1f>
+ 1b9:	b8 00 00 00 00       	mov    $0x0,%eax
+ 1be:	83 c0 01             	add    $0x1,%eax
+ 1c1:	89 c1                	mov    %eax,%ecx
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	75 f5                	jne    1be <strlen+0x10>
+    ;
+  return n;
+}
+ 1c9:	89 c8                	mov    %ecx,%eax
+ 1cb:	5d                   	pop    %ebp
+ 1cc:	c3                   	ret
+  for(n = 0; s[n]; n++)
+ 1cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1d2:	eb f5                	jmp    1c9 <strlen+0x1b>
+
+000001d4 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d4:	55                   	push   %ebp
+ 1d5:	89 e5                	mov    %esp,%ebp
+ 1d7:	57                   	push   %edi
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1db:	89 d7                	mov    %edx,%edi
+ 1dd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e3:	fc                   	cld
+ 1e4:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e6:	89 d0                	mov    %edx,%eax
+ 1e8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1eb:	c9                   	leave
+ 1ec:	c3                   	ret
+
+000001ed <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1ed:	55                   	push   %ebp
+ 1ee:	89 e5                	mov    %esp,%ebp
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1f7:	0f b6 10             	movzbl (%eax),%edx
+ 1fa:	84 d2                	test   %dl,%dl
+ 1fc:	74 15                	je     213 <strchr+0x26>
+    if(*s == c)
+ 1fe:	38 d1                	cmp    %dl,%cl
+ 200:	74 0f                	je     211 <strchr+0x24>
+  for(; *s; s++)
+ 202:	83 c0 01             	add    $0x1,%eax
+ 205:	0f b6 10             	movzbl (%eax),%edx
+ 208:	84 d2                	test   %dl,%dl
+ 20a:	75 f2                	jne    1fe <strchr+0x11>
+      return (char*)s;
+  return 0;
+ 20c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 211:	5d                   	pop    %ebp
+ 212:	c3                   	ret
+  return 0;
+ 213:	b8 00 00 00 00       	mov    $0x0,%eax
+ 218:	eb f7                	jmp    211 <strchr+0x24>
+
+0000021a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 21a:	55                   	push   %ebp
+ 21b:	89 e5                	mov    %esp,%ebp
+ 21d:	57                   	push   %edi
+ 21e:	56                   	push   %esi
+ 21f:	53                   	push   %ebx
+ 220:	83 ec 2c             	sub    $0x2c,%esp
+ 223:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 226:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+ 22b:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+ 22e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 231:	83 c3 01             	add    $0x1,%ebx
+ 234:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 237:	7d 27                	jge    260 <gets+0x46>
+    cc = read(0, &c, 1);
+ 239:	83 ec 04             	sub    $0x4,%esp
+ 23c:	6a 01                	push   $0x1
+ 23e:	57                   	push   %edi
+ 23f:	6a 00                	push   $0x0
+ 241:	e8 f9 00 00 00       	call   33f <read>
+    if(cc < 1)
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	7e 13                	jle    260 <gets+0x46>
+      break;
+    buf[i++] = c;
+ 24d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 251:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 255:	3c 0a                	cmp    $0xa,%al
+ 257:	74 04                	je     25d <gets+0x43>
+ 259:	3c 0d                	cmp    $0xd,%al
+ 25b:	75 d1                	jne    22e <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 25d:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 260:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 263:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 267:	89 f0                	mov    %esi,%eax
+ 269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 26c:	5b                   	pop    %ebx
+ 26d:	5e                   	pop    %esi
+ 26e:	5f                   	pop    %edi
+ 26f:	5d                   	pop    %ebp
+ 270:	c3                   	ret
+
+00000271 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 271:	55                   	push   %ebp
+ 272:	89 e5                	mov    %esp,%ebp
+ 274:	56                   	push   %esi
+ 275:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 276:	83 ec 08             	sub    $0x8,%esp
+ 279:	6a 00                	push   $0x0
+ 27b:	ff 75 08             	push   0x8(%ebp)
+ 27e:	e8 e4 00 00 00       	call   367 <open>
+  if(fd < 0)
+ 283:	83 c4 10             	add    $0x10,%esp
+ 286:	85 c0                	test   %eax,%eax
+ 288:	78 24                	js     2ae <stat+0x3d>
+ 28a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 28c:	83 ec 08             	sub    $0x8,%esp
+ 28f:	ff 75 0c             	push   0xc(%ebp)
+ 292:	50                   	push   %eax
+ 293:	e8 e7 00 00 00       	call   37f <fstat>
+ 298:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29a:	89 1c 24             	mov    %ebx,(%esp)
+ 29d:	e8 ad 00 00 00       	call   34f <close>
+  return r;
+ 2a2:	83 c4 10             	add    $0x10,%esp
+}
+ 2a5:	89 f0                	mov    %esi,%eax
+ 2a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2aa:	5b                   	pop    %ebx
+ 2ab:	5e                   	pop    %esi
+ 2ac:	5d                   	pop    %ebp
+ 2ad:	c3                   	ret
+    return -1;
+ 2ae:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b3:	eb f0                	jmp    2a5 <stat+0x34>
+
+000002b5 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2b5:	55                   	push   %ebp
+ 2b6:	89 e5                	mov    %esp,%ebp
+ 2b8:	53                   	push   %ebx
+ 2b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2bc:	0f b6 02             	movzbl (%edx),%eax
+ 2bf:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2c2:	80 f9 09             	cmp    $0x9,%cl
+ 2c5:	77 24                	ja     2eb <atoi+0x36>
+  n = 0;
+ 2c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d2:	0f be c0             	movsbl %al,%eax
+ 2d5:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2d9:	0f b6 02             	movzbl (%edx),%eax
+ 2dc:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2df:	80 fb 09             	cmp    $0x9,%bl
+ 2e2:	76 e8                	jbe    2cc <atoi+0x17>
+  return n;
+}
+ 2e4:	89 c8                	mov    %ecx,%eax
+ 2e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e9:	c9                   	leave
+ 2ea:	c3                   	ret
+  n = 0;
+ 2eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 2f0:	eb f2                	jmp    2e4 <atoi+0x2f>
+
+000002f2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2f2:	55                   	push   %ebp
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	56                   	push   %esi
+ 2f6:	53                   	push   %ebx
+ 2f7:	8b 75 08             	mov    0x8(%ebp),%esi
+ 2fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 300:	85 db                	test   %ebx,%ebx
+ 302:	7e 15                	jle    319 <memmove+0x27>
+ 304:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 306:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 308:	83 c2 01             	add    $0x1,%edx
+ 30b:	83 c0 01             	add    $0x1,%eax
+ 30e:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 312:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 315:	39 c3                	cmp    %eax,%ebx
+ 317:	75 ef                	jne    308 <memmove+0x16>
+  return vdst;
+}
+ 319:	89 f0                	mov    %esi,%eax
+ 31b:	5b                   	pop    %ebx
+ 31c:	5e                   	pop    %esi
+ 31d:	5d                   	pop    %ebp
+ 31e:	c3                   	ret
+
+0000031f <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 31f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <exit>:
+SYSCALL(exit)
+ 327:	b8 02 00 00 00       	mov    $0x2,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <wait>:
+SYSCALL(wait)
+ 32f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <pipe>:
+SYSCALL(pipe)
+ 337:	b8 04 00 00 00       	mov    $0x4,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <read>:
+SYSCALL(read)
+ 33f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <write>:
+SYSCALL(write)
+ 347:	b8 10 00 00 00       	mov    $0x10,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <close>:
+SYSCALL(close)
+ 34f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <kill>:
+SYSCALL(kill)
+ 357:	b8 06 00 00 00       	mov    $0x6,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <exec>:
+SYSCALL(exec)
+ 35f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <open>:
+SYSCALL(open)
+ 367:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <mknod>:
+SYSCALL(mknod)
+ 36f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <unlink>:
+SYSCALL(unlink)
+ 377:	b8 12 00 00 00       	mov    $0x12,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <fstat>:
+SYSCALL(fstat)
+ 37f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <link>:
+SYSCALL(link)
+ 387:	b8 13 00 00 00       	mov    $0x13,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <mkdir>:
+SYSCALL(mkdir)
+ 38f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <chdir>:
+SYSCALL(chdir)
+ 397:	b8 09 00 00 00       	mov    $0x9,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <dup>:
+SYSCALL(dup)
+ 39f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <getpid>:
+SYSCALL(getpid)
+ 3a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <sbrk>:
+SYSCALL(sbrk)
+ 3af:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <sleep>:
+SYSCALL(sleep)
+ 3b7:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <uptime>:
+SYSCALL(uptime)
+ 3bf:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <readmouse>:
+SYSCALL(readmouse)
+ 3c7:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
+
+000003cf <sigsend>:
+SYSCALL(sigsend)
+ 3cf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 3d7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3dc:	cd 40                	int    $0x40
+ 3de:	c3                   	ret
+
+000003df <sigreturn>:
+SYSCALL(sigreturn)
+ 3df:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e4:	cd 40                	int    $0x40
+ 3e6:	c3                   	ret
+
+000003e7 <siggetmask>:
+SYSCALL(siggetmask)
+ 3e7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <sigsetmask>:
+SYSCALL(sigsetmask)
+ 3ef:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f4:	cd 40                	int    $0x40
+ 3f6:	c3                   	ret
+
+000003f7 <sigpause>:
+SYSCALL(sigpause)
+ 3f7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3fc:	cd 40                	int    $0x40
+ 3fe:	c3                   	ret
+
+000003ff <predict_cpu>:
+SYSCALL(predict_cpu)
+ 3ff:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 404:	cd 40                	int    $0x40
+ 406:	c3                   	ret
+
+00000407 <sleeptick>:
+SYSCALL(sleeptick)
+ 407:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 40c:	cd 40                	int    $0x40
+ 40e:	c3                   	ret
+
+0000040f <schedctl>:
+SYSCALL(schedctl)
+ 40f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 414:	cd 40                	int    $0x40
+ 416:	c3                   	ret
+
+00000417 <nswtch>:
+SYSCALL(nswtch)
+ 417:	b8 20 00 00 00       	mov    $0x20,%eax
+ 41c:	cd 40                	int    $0x40
+ 41e:	c3                   	ret
+
+0000041f <getloadavg>:
+SYSCALL(getloadavg)
+ 41f:	b8 21 00 00 00       	mov    $0x21,%eax
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <memstat>:
+SYSCALL(memstat)
+ 427:	b8 22 00 00 00       	mov    $0x22,%eax
+ 42c:	cd 40                	int    $0x40
+ 42e:	c3                   	ret
+
+0000042f <iostat>:
+SYSCALL(iostat)
+ 42f:	b8 23 00 00 00       	mov    $0x23,%eax
+ 434:	cd 40                	int    $0x40
+ 436:	c3                   	ret
+
+00000437 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 437:	55                   	push   %ebp
+ 438:	89 e5                	mov    %esp,%ebp
+ 43a:	57                   	push   %edi
+ 43b:	56                   	push   %esi
+ 43c:	53                   	push   %ebx
+ 43d:	83 ec 3c             	sub    $0x3c,%esp
+ 440:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 443:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 445:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 449:	74 79                	je     4c4 <printint+0x8d>
+ 44b:	85 d2                	test   %edx,%edx
+ 44d:	79 75                	jns    4c4 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 44f:	89 d1                	mov    %edx,%ecx
+ 451:	f7 d9                	neg    %ecx
+    neg = 1;
+ 453:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 45a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 45f:	89 df                	mov    %ebx,%edi
+ 461:	83 c3 01             	add    $0x1,%ebx
+ 464:	89 c8                	mov    %ecx,%eax
+ 466:	ba 00 00 00 00       	mov    $0x0,%edx
+ 46b:	f7 f6                	div    %esi
+ 46d:	0f b6 92 5c 08 00 00 	movzbl 0x85c(%edx),%edx
+ 474:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 478:	89 ca                	mov    %ecx,%edx
+ 47a:	89 c1                	mov    %eax,%ecx
+ 47c:	39 f2                	cmp    %esi,%edx
+ 47e:	73 df                	jae    45f <printint+0x28>
+  if(neg)
+ 480:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 484:	74 08                	je     48e <printint+0x57>
+    buf[i++] = '-';
+ 486:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 48b:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 48e:	85 db                	test   %ebx,%ebx
+ 490:	7e 2a                	jle    4bc <printint+0x85>
+ 492:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 495:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 499:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 49c:	0f b6 03             	movzbl (%ebx),%eax
+ 49f:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 4a2:	83 ec 04             	sub    $0x4,%esp
+ 4a5:	6a 01                	push   $0x1
+ 4a7:	57                   	push   %edi
+ 4a8:	ff 75 c4             	push   -0x3c(%ebp)
+ 4ab:	e8 97 fe ff ff       	call   347 <write>
+  while(--i >= 0)
+ 4b0:	89 d8                	mov    %ebx,%eax
+ 4b2:	83 eb 01             	sub    $0x1,%ebx
+ 4b5:	83 c4 10             	add    $0x10,%esp
+ 4b8:	39 f0                	cmp    %esi,%eax
+ 4ba:	75 e0                	jne    49c <printint+0x65>
+}
+ 4bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bf:	5b                   	pop    %ebx
+ 4c0:	5e                   	pop    %esi
+ 4c1:	5f                   	pop    %edi
+ 4c2:	5d                   	pop    %ebp
+ 4c3:	c3                   	ret
+    x = xx;
+ 4c4:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 4c6:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 4cd:	eb 8b                	jmp    45a <printint+0x23>
+
+000004cf <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4cf:	55                   	push   %ebp
+ 4d0:	89 e5                	mov    %esp,%ebp
+ 4d2:	57                   	push   %edi
+ 4d3:	56                   	push   %esi
+ 4d4:	53                   	push   %ebx
+ 4d5:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 4db:	0f b6 1e             	movzbl (%esi),%ebx
+ 4de:	84 db                	test   %bl,%bl
+ 4e0:	0f 84 9e 01 00 00    	je     684 <printf+0x1b5>
+ 4e6:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 4e9:	8d 45 10             	lea    0x10(%ebp),%eax
+ 4ec:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 4ef:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4f4:	eb 2d                	jmp    523 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 4f6:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4f9:	83 ec 04             	sub    $0x4,%esp
+ 4fc:	6a 01                	push   $0x1
+ 4fe:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 501:	50                   	push   %eax
+ 502:	ff 75 08             	push   0x8(%ebp)
+ 505:	e8 3d fe ff ff       	call   347 <write>
+        putc(fd, c);
+ 50a:	83 c4 10             	add    $0x10,%esp
+ 50d:	eb 05                	jmp    514 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 50f:	83 ff 25             	cmp    $0x25,%edi
+ 512:	74 1f                	je     533 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 514:	83 c6 01             	add    $0x1,%esi
+ 517:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 51b:	84 db                	test   %bl,%bl
+ 51d:	0f 84 61 01 00 00    	je     684 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 523:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 526:	85 ff                	test   %edi,%edi
+ 528:	75 e5                	jne    50f <printf+0x40>
+      if(c == '%'){
+ 52a:	83 f8 25             	cmp    $0x25,%eax
+ 52d:	75 c7                	jne    4f6 <printf+0x27>
+        state = '%';
+ 52f:	89 c7                	mov    %eax,%edi
+ 531:	eb e1                	jmp    514 <printf+0x45>
+      if(c == 'd'){
+ 533:	83 f8 25             	cmp    $0x25,%eax
+ 536:	0f 84 f4 00 00 00    	je     630 <printf+0x161>
+ 53c:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 53f:	83 fa 15             	cmp    $0x15,%edx
+ 542:	0f 87 09 01 00 00    	ja     651 <printf+0x182>
+ 548:	0f 87 03 01 00 00    	ja     651 <printf+0x182>
+ 54e:	ff 24 95 04 08 00 00 	jmp    *0x804(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 555:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 558:	8b 17                	mov    (%edi),%edx
+ 55a:	83 ec 0c             	sub    $0xc,%esp
+ 55d:	6a 01                	push   $0x1
+ 55f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 564:	8b 45 08             	mov    0x8(%ebp),%eax
+ 567:	e8 cb fe ff ff       	call   437 <printint>
+        ap++;
+ 56c:	83 c7 04             	add    $0x4,%edi
+ 56f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 572:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 575:	bf 00 00 00 00       	mov    $0x0,%edi
+ 57a:	eb 98                	jmp    514 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 57c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 57f:	8b 17                	mov    (%edi),%edx
+ 581:	83 ec 0c             	sub    $0xc,%esp
+ 584:	6a 00                	push   $0x0
+ 586:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 58b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58e:	e8 a4 fe ff ff       	call   437 <printint>
+        ap++;
+ 593:	83 c7 04             	add    $0x4,%edi
+ 596:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 599:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 59c:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5a1:	e9 6e ff ff ff       	jmp    514 <printf+0x45>
+        s = (char*)*ap;
+ 5a6:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 5a9:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 5ab:	83 c1 04             	add    $0x4,%ecx
+ 5ae:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 5b1:	85 c0                	test   %eax,%eax
+ 5b3:	74 13                	je     5c8 <printf+0xf9>
+        s = (char*)*ap;
+ 5b5:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 5b7:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 5ba:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 5bf:	84 c0                	test   %al,%al
+ 5c1:	75 0f                	jne    5d2 <printf+0x103>
+ 5c3:	e9 4c ff ff ff       	jmp    514 <printf+0x45>
+          s = "(null)";
+ 5c8:	bb fb 07 00 00       	mov    $0x7fb,%ebx
+        while(*s != 0){
+ 5cd:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 5d2:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 5d5:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 5d8:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 5db:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 5de:	83 ec 04             	sub    $0x4,%esp
+ 5e1:	6a 01                	push   $0x1
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	e8 5d fd ff ff       	call   347 <write>
+          s++;
+ 5ea:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 5ed:	0f b6 03             	movzbl (%ebx),%eax
+ 5f0:	83 c4 10             	add    $0x10,%esp
+ 5f3:	84 c0                	test   %al,%al
+ 5f5:	75 e4                	jne    5db <printf+0x10c>
+      state = 0;
+ 5f7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5fa:	bf 00 00 00 00       	mov    $0x0,%edi
+ 5ff:	e9 10 ff ff ff       	jmp    514 <printf+0x45>
+        putc(fd, *ap);
+ 604:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 607:	8b 07                	mov    (%edi),%eax
+ 609:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 60c:	83 ec 04             	sub    $0x4,%esp
+ 60f:	6a 01                	push   $0x1
+ 611:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 614:	50                   	push   %eax
+ 615:	ff 75 08             	push   0x8(%ebp)
+ 618:	e8 2a fd ff ff       	call   347 <write>
+        ap++;
+ 61d:	83 c7 04             	add    $0x4,%edi
+ 620:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 623:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 626:	bf 00 00 00 00       	mov    $0x0,%edi
+ 62b:	e9 e4 fe ff ff       	jmp    514 <printf+0x45>
+        putc(fd, c);
+ 630:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 633:	83 ec 04             	sub    $0x4,%esp
+ 636:	6a 01                	push   $0x1
+ 638:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 63b:	50                   	push   %eax
+ 63c:	ff 75 08             	push   0x8(%ebp)
+ 63f:	e8 03 fd ff ff       	call   347 <write>
+ 644:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 647:	bf 00 00 00 00       	mov    $0x0,%edi
+ 64c:	e9 c3 fe ff ff       	jmp    514 <printf+0x45>
+        putc(fd, '%');
+ 651:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	6a 01                	push   $0x1
+ 65a:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 65d:	57                   	push   %edi
+ 65e:	ff 75 08             	push   0x8(%ebp)
+ 661:	e8 e1 fc ff ff       	call   347 <write>
+        putc(fd, c);
+ 666:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 669:	83 c4 0c             	add    $0xc,%esp
+ 66c:	6a 01                	push   $0x1
+ 66e:	57                   	push   %edi
+ 66f:	ff 75 08             	push   0x8(%ebp)
+ 672:	e8 d0 fc ff ff       	call   347 <write>
+        putc(fd, c);
+ 677:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 67a:	bf 00 00 00 00       	mov    $0x0,%edi
+ 67f:	e9 90 fe ff ff       	jmp    514 <printf+0x45>
+    }
+  }
+}
+ 684:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 687:	5b                   	pop    %ebx
+ 688:	5e                   	pop    %esi
+ 689:	5f                   	pop    %edi
+ 68a:	5d                   	pop    %ebp
+ 68b:	c3                   	ret
+
+0000068c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 68c:	55                   	push   %ebp
+ 68d:	89 e5                	mov    %esp,%ebp
+ 68f:	57                   	push   %edi
+ 690:	56                   	push   %esi
+ 691:	53                   	push   %ebx
+ 692:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 695:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 698:	a1 00 0d 00 00       	mov    0xd00,%eax
+ 69d:	eb 0c                	jmp    6ab <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 69f:	8b 10                	mov    (%eax),%edx
+ 6a1:	39 d0                	cmp    %edx,%eax
+ 6a3:	72 04                	jb     6a9 <free+0x1d>
+ 6a5:	39 d1                	cmp    %edx,%ecx
+ 6a7:	72 10                	jb     6b9 <free+0x2d>
+{
+ 6a9:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ab:	39 c8                	cmp    %ecx,%eax
+ 6ad:	73 f0                	jae    69f <free+0x13>
+ 6af:	8b 10                	mov    (%eax),%edx
+ 6b1:	39 d1                	cmp    %edx,%ecx
+ 6b3:	72 04                	jb     6b9 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b5:	39 d0                	cmp    %edx,%eax
+ 6b7:	72 f0                	jb     6a9 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6b9:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6bc:	8b 10                	mov    (%eax),%edx
+ 6be:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6c1:	39 fa                	cmp    %edi,%edx
+ 6c3:	74 19                	je     6de <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6c5:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6c8:	8b 50 04             	mov    0x4(%eax),%edx
+ 6cb:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 6ce:	39 f1                	cmp    %esi,%ecx
+ 6d0:	74 18                	je     6ea <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6d2:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 6d4:	a3 00 0d 00 00       	mov    %eax,0xd00
+}
+ 6d9:	5b                   	pop    %ebx
+ 6da:	5e                   	pop    %esi
+ 6db:	5f                   	pop    %edi
+ 6dc:	5d                   	pop    %ebp
+ 6dd:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 6de:	03 72 04             	add    0x4(%edx),%esi
+ 6e1:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6e4:	8b 10                	mov    (%eax),%edx
+ 6e6:	8b 12                	mov    (%edx),%edx
+ 6e8:	eb db                	jmp    6c5 <free+0x39>
+    p->s.size += bp->s.size;
+ 6ea:	03 53 fc             	add    -0x4(%ebx),%edx
+ 6ed:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 6f0:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6f3:	eb dd                	jmp    6d2 <free+0x46>
+
+000006f5 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6f5:	55                   	push   %ebp
+ 6f6:	89 e5                	mov    %esp,%ebp
+ 6f8:	57                   	push   %edi
+ 6f9:	56                   	push   %esi
+ 6fa:	53                   	push   %ebx
+ 6fb:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 701:	8d 58 07             	lea    0x7(%eax),%ebx
+ 704:	c1 eb 03             	shr    $0x3,%ebx
+ 707:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 70a:	8b 15 00 0d 00 00    	mov    0xd00,%edx
+ 710:	85 d2                	test   %edx,%edx
+ 712:	74 1c                	je     730 <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 714:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 716:	8b 48 04             	mov    0x4(%eax),%ecx
+ 719:	39 d9                	cmp    %ebx,%ecx
+ 71b:	73 38                	jae    755 <malloc+0x60>
+  if(nu < 4096)
+ 71d:	be 00 10 00 00       	mov    $0x1000,%esi
+ 722:	39 f3                	cmp    %esi,%ebx
+ 724:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 727:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 72e:	eb 72                	jmp    7a2 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 730:	c7 05 00 0d 00 00 04 	movl   $0xd04,0xd00
+ 737:	0d 00 00 
+ 73a:	c7 05 04 0d 00 00 04 	movl   $0xd04,0xd04
+ 741:	0d 00 00 
+    base.s.size = 0;
+ 744:	c7 05 08 0d 00 00 00 	movl   $0x0,0xd08
+ 74b:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 74e:	b8 04 0d 00 00       	mov    $0xd04,%eax
+    if(p->s.size >= nunits){
+ 753:	eb c8                	jmp    71d <malloc+0x28>
+      if(p->s.size == nunits)
+ 755:	39 cb                	cmp    %ecx,%ebx
+ 757:	74 1e                	je     777 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 759:	29 d9                	sub    %ebx,%ecx
+ 75b:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 75e:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 761:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 764:	89 15 00 0d 00 00    	mov    %edx,0xd00
+      return (void*)(p + 1);
+ 76a:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 76d:	89 d0                	mov    %edx,%eax
+ 76f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 772:	5b                   	pop    %ebx
+ 773:	5e                   	pop    %esi
+ 774:	5f                   	pop    %edi
+ 775:	5d                   	pop    %ebp
+ 776:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 777:	8b 08                	mov    (%eax),%ecx
+ 779:	89 0a                	mov    %ecx,(%edx)
+ 77b:	eb e7                	jmp    764 <malloc+0x6f>
+  hp->s.size = nu;
+ 77d:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 780:	83 ec 0c             	sub    $0xc,%esp
+ 783:	83 c0 08             	add    $0x8,%eax
+ 786:	50                   	push   %eax
+ 787:	e8 00 ff ff ff       	call   68c <free>
+  return freep;
+ 78c:	8b 15 00 0d 00 00    	mov    0xd00,%edx
+      if((p = morecore(nunits)) == 0)
+ 792:	83 c4 10             	add    $0x10,%esp
+ 795:	85 d2                	test   %edx,%edx
+ 797:	74 d4                	je     76d <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 799:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 79b:	8b 48 04             	mov    0x4(%eax),%ecx
+ 79e:	39 d9                	cmp    %ebx,%ecx
+ 7a0:	73 b3                	jae    755 <malloc+0x60>
+    if(p == freep)
+ 7a2:	89 c2                	mov    %eax,%edx
+ 7a4:	39 05 00 0d 00 00    	cmp    %eax,0xd00
+ 7aa:	75 ed                	jne    799 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 7ac:	83 ec 0c             	sub    $0xc,%esp
+ 7af:	57                   	push   %edi
+ 7b0:	e8 fa fb ff ff       	call   3af <sbrk>
+  if(p == (char*)-1)
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7bb:	75 c0                	jne    77d <malloc+0x88>
+        return 0;
+ 7bd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7c2:	eb a9                	jmp    76d <malloc+0x78>
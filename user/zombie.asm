@@ -0,0 +1,1093 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 d8 01 00 00       	call   1ee <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7f 05                	jg     1f <main+0x1f>
+    sleep(5);  // Let child exit before parent.
+  exit();
+  1a:	e8 d7 01 00 00       	call   1f6 <exit>
+    sleep(5);  // Let child exit before parent.
+  1f:	83 ec 0c             	sub    $0xc,%esp
+  22:	6a 05                	push   $0x5
+  24:	e8 5d 02 00 00       	call   286 <sleep>
+  29:	83 c4 10             	add    $0x10,%esp
+  2c:	eb ec                	jmp    1a <main+0x1a>
+
+0000002e <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  2e:	55                   	push   %ebp
+  2f:	89 e5                	mov    %esp,%ebp
+  31:	53                   	push   %ebx
+  32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  38:	b8 00 00 00 00       	mov    $0x0,%eax
+  3d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  41:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  44:	83 c0 01             	add    $0x1,%eax
+  47:	84 d2                	test   %dl,%dl
+  49:	75 f2                	jne    3d <strcpy+0xf>
+    ;
+  return os;
+}
+  4b:	89 c8                	mov    %ecx,%eax
+  4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  50:	c9                   	leave
+  51:	c3                   	ret
+
+00000052 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+  5b:	0f b6 01             	movzbl (%ecx),%eax
+  5e:	84 c0                	test   %al,%al
+  60:	74 11                	je     73 <strcmp+0x21>
+  62:	38 02                	cmp    %al,(%edx)
+  64:	75 0d                	jne    73 <strcmp+0x21>
+    p++, q++;
+  66:	83 c1 01             	add    $0x1,%ecx
+  69:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+  6c:	0f b6 01             	movzbl (%ecx),%eax
+  6f:	84 c0                	test   %al,%al
+  71:	75 ef                	jne    62 <strcmp+0x10>
+  return (uchar)*p - (uchar)*q;
+  73:	0f b6 c0             	movzbl %al,%eax
+  76:	0f b6 12             	movzbl (%edx),%edx
+  79:	29 d0                	sub    %edx,%eax
+}
+  7b:	5d                   	pop    %ebp
+  7c:	c3                   	ret
+
+0000007d <strlen>:
+
+uint
+strlen(char *s)
+{
+  7d:	55                   	push   %ebp
+  7e:	89 e5                	mov    %esp,%ebp
+  80:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  83:	80 3a 00             	cmpb   $0x0,(%edx)
+  86:	74 14                	je     9c <strlen+0x1f>
+  88:	b8 00 00 00 00       	mov    $0x0,%eax
+  8d:	83 c0 01             	add    $0x1,%eax
+  90:	89 c1                	mov    %eax,%ecx
+  92:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  96:	75 f5                	jne    8d <strlen+0x10>
+    ;
+  return n;
+}
+  98:	89 c8                	mov    %ecx,%eax
+  9a:	5d                   	pop    %ebp
+  9b:	c3                   	ret
+  for(n = 0; s[n]; n++)
+  9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+  a1:	eb f5                	jmp    98 <strlen+0x1b>
+
+000000a3 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  a3:	55                   	push   %ebp
+  a4:	89 e5                	mov    %esp,%ebp
+  a6:	57                   	push   %edi
+  a7:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  aa:	89 d7                	mov    %edx,%edi
+  ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b2:	fc                   	cld
+  b3:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+  b5:	89 d0                	mov    %edx,%eax
+  b7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  ba:	c9                   	leave
+  bb:	c3                   	ret
+
+000000bc <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  bc:	55                   	push   %ebp
+  bd:	89 e5                	mov    %esp,%ebp
+  bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  c2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+  c6:	0f b6 10             	movzbl (%eax),%edx
+  c9:	84 d2                	test   %dl,%dl
+  cb:	74 15                	je     e2 <strchr+0x26>
+    if(*s == c)
+  cd:	38 d1                	cmp    %dl,%cl
+  cf:	74 0f                	je     e0 <strchr+0x24>
+  for(; *s; s++)
+  d1:	83 c0 01             	add    $0x1,%eax
+  d4:	0f b6 10             	movzbl (%eax),%edx
+  d7:	84 d2                	test   %dl,%dl
+  d9:	75 f2                	jne    cd <strchr+0x11>
+      return (char*)s;
+  return 0;
+  db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  e0:	5d                   	pop    %ebp
+  e1:	c3                   	ret
+  return 0;
+  e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  e7:	eb f7                	jmp    e0 <strchr+0x24>
+
+000000e9 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  e9:	55                   	push   %ebp
+  ea:	89 e5                	mov    %esp,%ebp
+  ec:	57                   	push   %edi
+  ed:	56                   	push   %esi
+  ee:	53                   	push   %ebx
+  ef:	83 ec 2c             	sub    $0x2c,%esp
+  f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(0, &c, 1);
+  fa:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  for(i=0; i+1 < max; ){
+  fd:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+ 100:	83 c3 01             	add    $0x1,%ebx
+ 103:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 106:	7d 27                	jge    12f <gets+0x46>
+    cc = read(0, &c, 1);
+ 108:	83 ec 04             	sub    $0x4,%esp
+ 10b:	6a 01                	push   $0x1
+ 10d:	57                   	push   %edi
+ 10e:	6a 00                	push   $0x0
+ 110:	e8 f9 00 00 00       	call   20e <read>
+    if(cc < 1)
+ 115:	83 c4 10             	add    $0x10,%esp
+ 118:	85 c0                	test   %eax,%eax
+ 11a:	7e 13                	jle    12f <gets+0x46>
+      break;
+    buf[i++] = c;
+ 11c:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 120:	88 44 1e ff          	mov    %al,-0x1(%esi,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 124:	3c 0a                	cmp    $0xa,%al
+ 126:	74 04                	je     12c <gets+0x43>
+ 128:	3c 0d                	cmp    $0xd,%al
+ 12a:	75 d1                	jne    fd <gets+0x14>
+  for(i=0; i+1 < max; ){
+ 12c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+      break;
+  }
+  buf[i] = '\0';
+ 12f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 132:	c6 04 06 00          	movb   $0x0,(%esi,%eax,1)
+  return buf;
+}
+ 136:	89 f0                	mov    %esi,%eax
+ 138:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 13b:	5b                   	pop    %ebx
+ 13c:	5e                   	pop    %esi
+ 13d:	5f                   	pop    %edi
+ 13e:	5d                   	pop    %ebp
+ 13f:	c3                   	ret
+
+00000140 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	56                   	push   %esi
+ 144:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	6a 00                	push   $0x0
+ 14a:	ff 75 08             	push   0x8(%ebp)
+ 14d:	e8 e4 00 00 00       	call   236 <open>
+  if(fd < 0)
+ 152:	83 c4 10             	add    $0x10,%esp
+ 155:	85 c0                	test   %eax,%eax
+ 157:	78 24                	js     17d <stat+0x3d>
+ 159:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 15b:	83 ec 08             	sub    $0x8,%esp
+ 15e:	ff 75 0c             	push   0xc(%ebp)
+ 161:	50                   	push   %eax
+ 162:	e8 e7 00 00 00       	call   24e <fstat>
+ 167:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 169:	89 1c 24             	mov    %ebx,(%esp)
+ 16c:	e8 ad 00 00 00       	call   21e <close>
+  return r;
+ 171:	83 c4 10             	add    $0x10,%esp
+}
+ 174:	89 f0                	mov    %esi,%eax
+ 176:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 179:	5b                   	pop    %ebx
+ 17a:	5e                   	pop    %esi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return -1;
+ 17d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 182:	eb f0                	jmp    174 <stat+0x34>
+
+00000184 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 184:	55                   	push   %ebp
+ 185:	89 e5                	mov    %esp,%ebp
+ 187:	53                   	push   %ebx
+ 188:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 18b:	0f b6 02             	movzbl (%edx),%eax
+ 18e:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 191:	80 f9 09             	cmp    $0x9,%cl
+ 194:	77 24                	ja     1ba <atoi+0x36>
+  n = 0;
+ 196:	b9 00 00 00 00       	mov    $0x0,%ecx
+    n = n*10 + *s++ - '0';
+ 19b:	83 c2 01             	add    $0x1,%edx
+ 19e:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 1a1:	0f be c0             	movsbl %al,%eax
+ 1a4:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 1a8:	0f b6 02             	movzbl (%edx),%eax
+ 1ab:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 1ae:	80 fb 09             	cmp    $0x9,%bl
+ 1b1:	76 e8                	jbe    19b <atoi+0x17>
+  return n;
+}
+ 1b3:	89 c8                	mov    %ecx,%eax
+ 1b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b8:	c9                   	leave
+ 1b9:	c3                   	ret
+  n = 0;
+ 1ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  return n;
+ 1bf:	eb f2                	jmp    1b3 <atoi+0x2f>
+
+000001c1 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 1c1:	55                   	push   %ebp
+ 1c2:	89 e5                	mov    %esp,%ebp
+ 1c4:	56                   	push   %esi
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 75 08             	mov    0x8(%ebp),%esi
+ 1c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1cf:	85 db                	test   %ebx,%ebx
+ 1d1:	7e 15                	jle    1e8 <memmove+0x27>
+ 1d3:	01 f3                	add    %esi,%ebx
+  dst = vdst;
+ 1d5:	89 f0                	mov    %esi,%eax
+    *dst++ = *src++;
+ 1d7:	83 c2 01             	add    $0x1,%edx
+ 1da:	83 c0 01             	add    $0x1,%eax
+ 1dd:	0f b6 4a ff          	movzbl -0x1(%edx),%ecx
+ 1e1:	88 48 ff             	mov    %cl,-0x1(%eax)
+  while(n-- > 0)
+ 1e4:	39 c3                	cmp    %eax,%ebx
+ 1e6:	75 ef                	jne    1d7 <memmove+0x16>
+  return vdst;
+}
+ 1e8:	89 f0                	mov    %esi,%eax
+ 1ea:	5b                   	pop    %ebx
+ 1eb:	5e                   	pop    %esi
+ 1ec:	5d                   	pop    %ebp
+ 1ed:	c3                   	ret
+
+000001ee <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 1ee:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1f3:	cd 40                	int    $0x40
+ 1f5:	c3                   	ret
+
+000001f6 <exit>:
+SYSCALL(exit)
+ 1f6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1fb:	cd 40                	int    $0x40
+ 1fd:	c3                   	ret
+
+000001fe <wait>:
+SYSCALL(wait)
+ 1fe:	b8 03 00 00 00       	mov    $0x3,%eax
+ 203:	cd 40                	int    $0x40
+ 205:	c3                   	ret
+
+00000206 <pipe>:
+SYSCALL(pipe)
+ 206:	b8 04 00 00 00       	mov    $0x4,%eax
+ 20b:	cd 40                	int    $0x40
+ 20d:	c3                   	ret
+
+0000020e <read>:
+SYSCALL(read)
+ 20e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 213:	cd 40                	int    $0x40
+ 215:	c3                   	ret
+
+00000216 <write>:
+SYSCALL(write)
+ 216:	b8 10 00 00 00       	mov    $0x10,%eax
+ 21b:	cd 40                	int    $0x40
+ 21d:	c3                   	ret
+
+0000021e <close>:
+SYSCALL(close)
+ 21e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 223:	cd 40                	int    $0x40
+ 225:	c3                   	ret
+
+00000226 <kill>:
+SYSCALL(kill)
+ 226:	b8 06 00 00 00       	mov    $0x6,%eax
+ 22b:	cd 40                	int    $0x40
+ 22d:	c3                   	ret
+
+0000022e <exec>:
+SYSCALL(exec)
+ 22e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 233:	cd 40                	int    $0x40
+ 235:	c3                   	ret
+
+00000236 <open>:
+SYSCALL(open)
+ 236:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 23b:	cd 40                	int    $0x40
+ 23d:	c3                   	ret
+
+0000023e <mknod>:
+SYSCALL(mknod)
+ 23e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 243:	cd 40                	int    $0x40
+ 245:	c3                   	ret
+
+00000246 <unlink>:
+SYSCALL(unlink)
+ 246:	b8 12 00 00 00       	mov    $0x12,%eax
+ 24b:	cd 40                	int    $0x40
+ 24d:	c3                   	ret
+
+0000024e <fstat>:
+SYSCALL(fstat)
+ 24e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 253:	cd 40                	int    $0x40
+ 255:	c3                   	ret
+
+00000256 <link>:
+SYSCALL(link)
+ 256:	b8 13 00 00 00       	mov    $0x13,%eax
+ 25b:	cd 40                	int    $0x40
+ 25d:	c3                   	ret
+
+0000025e <mkdir>:
+SYSCALL(mkdir)
+ 25e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 263:	cd 40                	int    $0x40
+ 265:	c3                   	ret
+
+00000266 <chdir>:
+SYSCALL(chdir)
+ 266:	b8 09 00 00 00       	mov    $0x9,%eax
+ 26b:	cd 40                	int    $0x40
+ 26d:	c3                   	ret
+
+0000026e <dup>:
+SYSCALL(dup)
+ 26e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 273:	cd 40                	int    $0x40
+ 275:	c3                   	ret
+
+00000276 <getpid>:
+SYSCALL(getpid)
+ 276:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 27b:	cd 40                	int    $0x40
+ 27d:	c3                   	ret
+
+0000027e <sbrk>:
+SYSCALL(sbrk)
+ 27e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 283:	cd 40                	int    $0x40
+ 285:	c3                   	ret
+
+00000286 <sleep>:
+SYSCALL(sleep)
+ 286:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 28b:	cd 40                	int    $0x40
+ 28d:	c3                   	ret
+
+0000028e <uptime>:
+SYSCALL(uptime)
+ 28e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 293:	cd 40                	int    $0x40
+ 295:	c3                   	ret
+
+00000296 <readmouse>:
+SYSCALL(readmouse)
+ 296:	b8 16 00 00 00       	mov    $0x16,%eax
+ 29b:	cd 40                	int    $0x40
+ 29d:	c3                   	ret
+
+0000029e <sigsend>:
+SYSCALL(sigsend)
+ 29e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 2a3:	cd 40                	int    $0x40
+ 2a5:	c3                   	ret
+
+000002a6 <sigsethandler>:
+SYSCALL(sigsethandler)
+ 2a6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 2ab:	cd 40                	int    $0x40
+ 2ad:	c3                   	ret
+
+000002ae <sigreturn>:
+SYSCALL(sigreturn)
+ 2ae:	b8 19 00 00 00       	mov    $0x19,%eax
+ 2b3:	cd 40                	int    $0x40
+ 2b5:	c3                   	ret
+
+000002b6 <siggetmask>:
+SYSCALL(siggetmask)
+ 2b6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 2bb:	cd 40                	int    $0x40
+ 2bd:	c3                   	ret
+
+000002be <sigsetmask>:
+SYSCALL(sigsetmask)
+ 2be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 2c3:	cd 40                	int    $0x40
+ 2c5:	c3                   	ret
+
+000002c6 <sigpause>:
+SYSCALL(sigpause)
+ 2c6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 2cb:	cd 40                	int    $0x40
+ 2cd:	c3                   	ret
+
+000002ce <predict_cpu>:
+SYSCALL(predict_cpu)
+ 2ce:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 2d3:	cd 40                	int    $0x40
+ 2d5:	c3                   	ret
+
+000002d6 <sleeptick>:
+SYSCALL(sleeptick)
+ 2d6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+000002de <schedctl>:
+SYSCALL(schedctl)
+ 2de:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+000002e6 <nswtch>:
+SYSCALL(nswtch)
+ 2e6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+000002ee <getloadavg>:
+SYSCALL(getloadavg)
+ 2ee:	b8 21 00 00 00       	mov    $0x21,%eax
+ 2f3:	cd 40                	int    $0x40
+ 2f5:	c3                   	ret
+
+000002f6 <memstat>:
+SYSCALL(memstat)
+ 2f6:	b8 22 00 00 00       	mov    $0x22,%eax
+ 2fb:	cd 40                	int    $0x40
+ 2fd:	c3                   	ret
+
+000002fe <iostat>:
+SYSCALL(iostat)
+ 2fe:	b8 23 00 00 00       	mov    $0x23,%eax
+ 303:	cd 40                	int    $0x40
+ 305:	c3                   	ret
+
+00000306 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 306:	55                   	push   %ebp
+ 307:	89 e5                	mov    %esp,%ebp
+ 309:	57                   	push   %edi
+ 30a:	56                   	push   %esi
+ 30b:	53                   	push   %ebx
+ 30c:	83 ec 3c             	sub    $0x3c,%esp
+ 30f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 312:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 314:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 318:	74 79                	je     393 <printint+0x8d>
+ 31a:	85 d2                	test   %edx,%edx
+ 31c:	79 75                	jns    393 <printint+0x8d>
+    neg = 1;
+    x = -xx;
+ 31e:	89 d1                	mov    %edx,%ecx
+ 320:	f7 d9                	neg    %ecx
+    neg = 1;
+ 322:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 329:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+ 32e:	89 df                	mov    %ebx,%edi
+ 330:	83 c3 01             	add    $0x1,%ebx
+ 333:	89 c8                	mov    %ecx,%eax
+ 335:	ba 00 00 00 00       	mov    $0x0,%edx
+ 33a:	f7 f6                	div    %esi
+ 33c:	0f b6 92 f4 06 00 00 	movzbl 0x6f4(%edx),%edx
+ 343:	88 54 1d d7          	mov    %dl,-0x29(%ebp,%ebx,1)
+  }while((x /= base) != 0);
+ 347:	89 ca                	mov    %ecx,%edx
+ 349:	89 c1                	mov    %eax,%ecx
+ 34b:	39 f2                	cmp    %esi,%edx
+ 34d:	73 df                	jae    32e <printint+0x28>
+  if(neg)
+ 34f:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+ 353:	74 08                	je     35d <printint+0x57>
+    buf[i++] = '-';
+ 355:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+ 35a:	8d 5f 02             	lea    0x2(%edi),%ebx
+
+  while(--i >= 0)
+ 35d:	85 db                	test   %ebx,%ebx
+ 35f:	7e 2a                	jle    38b <printint+0x85>
+ 361:	8d 75 d8             	lea    -0x28(%ebp),%esi
+ 364:	8d 5c 1d d7          	lea    -0x29(%ebp,%ebx,1),%ebx
+  write(fd, &c, 1);
+ 368:	8d 7d d7             	lea    -0x29(%ebp),%edi
+    putc(fd, buf[i]);
+ 36b:	0f b6 03             	movzbl (%ebx),%eax
+ 36e:	88 45 d7             	mov    %al,-0x29(%ebp)
+  write(fd, &c, 1);
+ 371:	83 ec 04             	sub    $0x4,%esp
+ 374:	6a 01                	push   $0x1
+ 376:	57                   	push   %edi
+ 377:	ff 75 c4             	push   -0x3c(%ebp)
+ 37a:	e8 97 fe ff ff       	call   216 <write>
+  while(--i >= 0)
+ 37f:	89 d8                	mov    %ebx,%eax
+ 381:	83 eb 01             	sub    $0x1,%ebx
+ 384:	83 c4 10             	add    $0x10,%esp
+ 387:	39 f0                	cmp    %esi,%eax
+ 389:	75 e0                	jne    36b <printint+0x65>
+}
+ 38b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 38e:	5b                   	pop    %ebx
+ 38f:	5e                   	pop    %esi
+ 390:	5f                   	pop    %edi
+ 391:	5d                   	pop    %ebp
+ 392:	c3                   	ret
+    x = xx;
+ 393:	89 d1                	mov    %edx,%ecx
+  neg = 0;
+ 395:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+ 39c:	eb 8b                	jmp    329 <printint+0x23>
+
+0000039e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 39e:	55                   	push   %ebp
+ 39f:	89 e5                	mov    %esp,%ebp
+ 3a1:	57                   	push   %edi
+ 3a2:	56                   	push   %esi
+ 3a3:	53                   	push   %ebx
+ 3a4:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 3a7:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 3aa:	0f b6 1e             	movzbl (%esi),%ebx
+ 3ad:	84 db                	test   %bl,%bl
+ 3af:	0f 84 9e 01 00 00    	je     553 <printf+0x1b5>
+ 3b5:	83 c6 01             	add    $0x1,%esi
+  ap = (uint*)(void*)&fmt + 1;
+ 3b8:	8d 45 10             	lea    0x10(%ebp),%eax
+ 3bb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  state = 0;
+ 3be:	bf 00 00 00 00       	mov    $0x0,%edi
+ 3c3:	eb 2d                	jmp    3f2 <printf+0x54>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(fd, c);
+ 3c5:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 3c8:	83 ec 04             	sub    $0x4,%esp
+ 3cb:	6a 01                	push   $0x1
+ 3cd:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 3d0:	50                   	push   %eax
+ 3d1:	ff 75 08             	push   0x8(%ebp)
+ 3d4:	e8 3d fe ff ff       	call   216 <write>
+        putc(fd, c);
+ 3d9:	83 c4 10             	add    $0x10,%esp
+ 3dc:	eb 05                	jmp    3e3 <printf+0x45>
+      }
+    } else if(state == '%'){
+ 3de:	83 ff 25             	cmp    $0x25,%edi
+ 3e1:	74 1f                	je     402 <printf+0x64>
+  for(i = 0; fmt[i]; i++){
+ 3e3:	83 c6 01             	add    $0x1,%esi
+ 3e6:	0f b6 5e ff          	movzbl -0x1(%esi),%ebx
+ 3ea:	84 db                	test   %bl,%bl
+ 3ec:	0f 84 61 01 00 00    	je     553 <printf+0x1b5>
+    c = fmt[i] & 0xff;
+ 3f2:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 3f5:	85 ff                	test   %edi,%edi
+ 3f7:	75 e5                	jne    3de <printf+0x40>
+      if(c == '%'){
+ 3f9:	83 f8 25             	cmp    $0x25,%eax
+ 3fc:	75 c7                	jne    3c5 <printf+0x27>
+        state = '%';
+ 3fe:	89 c7                	mov    %eax,%edi
+ 400:	eb e1                	jmp    3e3 <printf+0x45>
+      if(c == 'd'){
+ 402:	83 f8 25             	cmp    $0x25,%eax
+ 405:	0f 84 f4 00 00 00    	je     4ff <printf+0x161>
+ 40b:	8d 50 9d             	lea    -0x63(%eax),%edx
+ 40e:	83 fa 15             	cmp    $0x15,%edx
+ 411:	0f 87 09 01 00 00    	ja     520 <printf+0x182>
+ 417:	0f 87 03 01 00 00    	ja     520 <printf+0x182>
+ 41d:	ff 24 95 9c 06 00 00 	jmp    *0x69c(,%edx,4)
+        printint(fd, *ap, 10, 1);
+ 424:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 427:	8b 17                	mov    (%edi),%edx
+ 429:	83 ec 0c             	sub    $0xc,%esp
+ 42c:	6a 01                	push   $0x1
+ 42e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	e8 cb fe ff ff       	call   306 <printint>
+        ap++;
+ 43b:	83 c7 04             	add    $0x4,%edi
+ 43e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 441:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+        putc(fd, c);
+      }
+      state = 0;
+ 444:	bf 00 00 00 00       	mov    $0x0,%edi
+ 449:	eb 98                	jmp    3e3 <printf+0x45>
+        printint(fd, *ap, 16, 0);
+ 44b:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 44e:	8b 17                	mov    (%edi),%edx
+ 450:	83 ec 0c             	sub    $0xc,%esp
+ 453:	6a 00                	push   $0x0
+ 455:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 45a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45d:	e8 a4 fe ff ff       	call   306 <printint>
+        ap++;
+ 462:	83 c7 04             	add    $0x4,%edi
+ 465:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 468:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 46b:	bf 00 00 00 00       	mov    $0x0,%edi
+ 470:	e9 6e ff ff ff       	jmp    3e3 <printf+0x45>
+        s = (char*)*ap;
+ 475:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 478:	8b 01                	mov    (%ecx),%eax
+        ap++;
+ 47a:	83 c1 04             	add    $0x4,%ecx
+ 47d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+        if(s == 0)
+ 480:	85 c0                	test   %eax,%eax
+ 482:	74 13                	je     497 <printf+0xf9>
+        s = (char*)*ap;
+ 484:	89 c3                	mov    %eax,%ebx
+        while(*s != 0){
+ 486:	0f b6 00             	movzbl (%eax),%eax
+      state = 0;
+ 489:	bf 00 00 00 00       	mov    $0x0,%edi
+        while(*s != 0){
+ 48e:	84 c0                	test   %al,%al
+ 490:	75 0f                	jne    4a1 <printf+0x103>
+ 492:	e9 4c ff ff ff       	jmp    3e3 <printf+0x45>
+          s = "(null)";
+ 497:	bb 94 06 00 00       	mov    $0x694,%ebx
+        while(*s != 0){
+ 49c:	b8 28 00 00 00       	mov    $0x28,%eax
+  write(fd, &c, 1);
+ 4a1:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 4a4:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 4a7:	8b 75 08             	mov    0x8(%ebp),%esi
+          putc(fd, *s);
+ 4aa:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4ad:	83 ec 04             	sub    $0x4,%esp
+ 4b0:	6a 01                	push   $0x1
+ 4b2:	57                   	push   %edi
+ 4b3:	56                   	push   %esi
+ 4b4:	e8 5d fd ff ff       	call   216 <write>
+          s++;
+ 4b9:	83 c3 01             	add    $0x1,%ebx
+        while(*s != 0){
+ 4bc:	0f b6 03             	movzbl (%ebx),%eax
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	84 c0                	test   %al,%al
+ 4c4:	75 e4                	jne    4aa <printf+0x10c>
+      state = 0;
+ 4c6:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 4c9:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4ce:	e9 10 ff ff ff       	jmp    3e3 <printf+0x45>
+        putc(fd, *ap);
+ 4d3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ 4d6:	8b 07                	mov    (%edi),%eax
+ 4d8:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 4db:	83 ec 04             	sub    $0x4,%esp
+ 4de:	6a 01                	push   $0x1
+ 4e0:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4e3:	50                   	push   %eax
+ 4e4:	ff 75 08             	push   0x8(%ebp)
+ 4e7:	e8 2a fd ff ff       	call   216 <write>
+        ap++;
+ 4ec:	83 c7 04             	add    $0x4,%edi
+ 4ef:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+ 4f2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 4f5:	bf 00 00 00 00       	mov    $0x0,%edi
+ 4fa:	e9 e4 fe ff ff       	jmp    3e3 <printf+0x45>
+        putc(fd, c);
+ 4ff:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 502:	83 ec 04             	sub    $0x4,%esp
+ 505:	6a 01                	push   $0x1
+ 507:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 50a:	50                   	push   %eax
+ 50b:	ff 75 08             	push   0x8(%ebp)
+ 50e:	e8 03 fd ff ff       	call   216 <write>
+ 513:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 516:	bf 00 00 00 00       	mov    $0x0,%edi
+ 51b:	e9 c3 fe ff ff       	jmp    3e3 <printf+0x45>
+        putc(fd, '%');
+ 520:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+  write(fd, &c, 1);
+ 524:	83 ec 04             	sub    $0x4,%esp
+ 527:	6a 01                	push   $0x1
+ 529:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 52c:	57                   	push   %edi
+ 52d:	ff 75 08             	push   0x8(%ebp)
+ 530:	e8 e1 fc ff ff       	call   216 <write>
+        putc(fd, c);
+ 535:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  write(fd, &c, 1);
+ 538:	83 c4 0c             	add    $0xc,%esp
+ 53b:	6a 01                	push   $0x1
+ 53d:	57                   	push   %edi
+ 53e:	ff 75 08             	push   0x8(%ebp)
+ 541:	e8 d0 fc ff ff       	call   216 <write>
+        putc(fd, c);
+ 546:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 549:	bf 00 00 00 00       	mov    $0x0,%edi
+ 54e:	e9 90 fe ff ff       	jmp    3e3 <printf+0x45>
+    }
+  }
+}
+ 553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 556:	5b                   	pop    %ebx
+ 557:	5e                   	pop    %esi
+ 558:	5f                   	pop    %edi
+ 559:	5d                   	pop    %ebp
+ 55a:	c3                   	ret
+
+0000055b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 55b:	55                   	push   %ebp
+ 55c:	89 e5                	mov    %esp,%ebp
+ 55e:	57                   	push   %edi
+ 55f:	56                   	push   %esi
+ 560:	53                   	push   %ebx
+ 561:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 564:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 567:	a1 5c 09 00 00       	mov    0x95c,%eax
+ 56c:	eb 0c                	jmp    57a <free+0x1f>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 56e:	8b 10                	mov    (%eax),%edx
+ 570:	39 d0                	cmp    %edx,%eax
+ 572:	72 04                	jb     578 <free+0x1d>
+ 574:	39 d1                	cmp    %edx,%ecx
+ 576:	72 10                	jb     588 <free+0x2d>
+{
+ 578:	89 d0                	mov    %edx,%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 57a:	39 c8                	cmp    %ecx,%eax
+ 57c:	73 f0                	jae    56e <free+0x13>
+ 57e:	8b 10                	mov    (%eax),%edx
+ 580:	39 d1                	cmp    %edx,%ecx
+ 582:	72 04                	jb     588 <free+0x2d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 584:	39 d0                	cmp    %edx,%eax
+ 586:	72 f0                	jb     578 <free+0x1d>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 588:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 58b:	8b 10                	mov    (%eax),%edx
+ 58d:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 590:	39 fa                	cmp    %edi,%edx
+ 592:	74 19                	je     5ad <free+0x52>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 594:	89 53 f8             	mov    %edx,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 597:	8b 50 04             	mov    0x4(%eax),%edx
+ 59a:	8d 34 d0             	lea    (%eax,%edx,8),%esi
+ 59d:	39 f1                	cmp    %esi,%ecx
+ 59f:	74 18                	je     5b9 <free+0x5e>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 5a1:	89 08                	mov    %ecx,(%eax)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 5a3:	a3 5c 09 00 00       	mov    %eax,0x95c
+}
+ 5a8:	5b                   	pop    %ebx
+ 5a9:	5e                   	pop    %esi
+ 5aa:	5f                   	pop    %edi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+    bp->s.size += p->s.ptr->s.size;
+ 5ad:	03 72 04             	add    0x4(%edx),%esi
+ 5b0:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5b3:	8b 10                	mov    (%eax),%edx
+ 5b5:	8b 12                	mov    (%edx),%edx
+ 5b7:	eb db                	jmp    594 <free+0x39>
+    p->s.size += bp->s.size;
+ 5b9:	03 53 fc             	add    -0x4(%ebx),%edx
+ 5bc:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 5bf:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 5c2:	eb dd                	jmp    5a1 <free+0x46>
+
+000005c4 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 5c4:	55                   	push   %ebp
+ 5c5:	89 e5                	mov    %esp,%ebp
+ 5c7:	57                   	push   %edi
+ 5c8:	56                   	push   %esi
+ 5c9:	53                   	push   %ebx
+ 5ca:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d0:	8d 58 07             	lea    0x7(%eax),%ebx
+ 5d3:	c1 eb 03             	shr    $0x3,%ebx
+ 5d6:	83 c3 01             	add    $0x1,%ebx
+  if((prevp = freep) == 0){
+ 5d9:	8b 15 5c 09 00 00    	mov    0x95c,%edx
+ 5df:	85 d2                	test   %edx,%edx
+ 5e1:	74 1c                	je     5ff <malloc+0x3b>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 5e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 5e8:	39 d9                	cmp    %ebx,%ecx
+ 5ea:	73 38                	jae    624 <malloc+0x60>
+  if(nu < 4096)
+ 5ec:	be 00 10 00 00       	mov    $0x1000,%esi
+ 5f1:	39 f3                	cmp    %esi,%ebx
+ 5f3:	0f 43 f3             	cmovae %ebx,%esi
+  p = sbrk(nu * sizeof(Header));
+ 5f6:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+ 5fd:	eb 72                	jmp    671 <malloc+0xad>
+    base.s.ptr = freep = prevp = &base;
+ 5ff:	c7 05 5c 09 00 00 60 	movl   $0x960,0x95c
+ 606:	09 00 00 
+ 609:	c7 05 60 09 00 00 60 	movl   $0x960,0x960
+ 610:	09 00 00 
+    base.s.size = 0;
+ 613:	c7 05 64 09 00 00 00 	movl   $0x0,0x964
+ 61a:	00 00 00 
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 61d:	b8 60 09 00 00       	mov    $0x960,%eax
+    if(p->s.size >= nunits){
+ 622:	eb c8                	jmp    5ec <malloc+0x28>
+      if(p->s.size == nunits)
+ 624:	39 cb                	cmp    %ecx,%ebx
+ 626:	74 1e                	je     646 <malloc+0x82>
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+ 628:	29 d9                	sub    %ebx,%ecx
+ 62a:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 62d:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 630:	89 58 04             	mov    %ebx,0x4(%eax)
+      }
+      freep = prevp;
+ 633:	89 15 5c 09 00 00    	mov    %edx,0x95c
+      return (void*)(p + 1);
+ 639:	8d 50 08             	lea    0x8(%eax),%edx
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+ 63c:	89 d0                	mov    %edx,%eax
+ 63e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 641:	5b                   	pop    %ebx
+ 642:	5e                   	pop    %esi
+ 643:	5f                   	pop    %edi
+ 644:	5d                   	pop    %ebp
+ 645:	c3                   	ret
+        prevp->s.ptr = p->s.ptr;
+ 646:	8b 08                	mov    (%eax),%ecx
+ 648:	89 0a                	mov    %ecx,(%edx)
+ 64a:	eb e7                	jmp    633 <malloc+0x6f>
+  hp->s.size = nu;
+ 64c:	89 70 04             	mov    %esi,0x4(%eax)
+  free((void*)(hp + 1));
+ 64f:	83 ec 0c             	sub    $0xc,%esp
+ 652:	83 c0 08             	add    $0x8,%eax
+ 655:	50                   	push   %eax
+ 656:	e8 00 ff ff ff       	call   55b <free>
+  return freep;
+ 65b:	8b 15 5c 09 00 00    	mov    0x95c,%edx
+      if((p = morecore(nunits)) == 0)
+ 661:	83 c4 10             	add    $0x10,%esp
+ 664:	85 d2                	test   %edx,%edx
+ 666:	74 d4                	je     63c <malloc+0x78>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 668:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 66a:	8b 48 04             	mov    0x4(%eax),%ecx
+ 66d:	39 d9                	cmp    %ebx,%ecx
+ 66f:	73 b3                	jae    624 <malloc+0x60>
+    if(p == freep)
+ 671:	89 c2                	mov    %eax,%edx
+ 673:	39 05 5c 09 00 00    	cmp    %eax,0x95c
+ 679:	75 ed                	jne    668 <malloc+0xa4>
+  p = sbrk(nu * sizeof(Header));
+ 67b:	83 ec 0c             	sub    $0xc,%esp
+ 67e:	57                   	push   %edi
+ 67f:	e8 fa fb ff ff       	call   27e <sbrk>
+  if(p == (char*)-1)
+ 684:	83 c4 10             	add    $0x10,%esp
+ 687:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 68a:	75 c0                	jne    64c <malloc+0x88>
+        return 0;
+ 68c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 691:	eb a9                	jmp    63c <malloc+0x78>